@@ -1,13 +1,21 @@
 /**
  * @file ec11_encoder.hpp
  * @brief EC11 rotary encoder driver with quadrature decoding and button handling
- * 
+ *
  * Features:
- * - Quadrature decoding using GPIO interrupts
+ * - Quadrature decoding using GPIO interrupts or the PCNT peripheral
  * - Software debouncing for rotation and button
  * - Direction detection (clockwise/counter-clockwise)
  * - Position tracking with configurable min/max bounds
  * - Push button handling with debouncing
+ * - Gesture classification in the driver task: single/double click, long
+ *   press and press-and-rotate chords as typed events with tunable timing
+ *
+ * Backend selection (compile time): with EC11_USE_PCNT=1 the quadrature
+ * edges are counted by the ESP32 PCNT peripheral, so fast spins cost zero
+ * CPU per transition and never drop counts under load. The default (0)
+ * keeps the GPIO-interrupt decoder. The public Event API is identical in
+ * both builds; the button always uses a GPIO interrupt.
  */
 
 #pragma once
@@ -19,6 +27,14 @@
 #include "freertos/queue.h"
 #include "freertos/task.h"
 
+#ifndef EC11_USE_PCNT
+#define EC11_USE_PCNT 0
+#endif
+
+#if EC11_USE_PCNT
+#include "driver/pulse_cnt.h"
+#endif
+
 /**
  * @brief EC11 rotary encoder driver class
  */
@@ -29,9 +45,28 @@ public:
      */
     enum class EventType {
         ROTATION,   // Encoder rotated
-        BUTTON      // Encoder button pressed/released
+        BUTTON,     // Encoder button pressed/released (raw edge)
+        GESTURE     // Classified button gesture (see Gesture)
     };
-    
+
+    /**
+     * @brief Classified button gestures
+     *
+     * Emitted by the driver task so consumers never track press timing
+     * themselves. LONG_PRESS fires while the button is still held (not on
+     * release) and suppresses the click for that hold. A rotation detent
+     * while the button is held becomes PRESS_ROTATE instead of ROTATION
+     * and likewise suppresses the click; once LONG_PRESS has fired,
+     * further detents in the same hold revert to plain ROTATION.
+     */
+    enum class Gesture {
+        NONE = 0,
+        SINGLE_CLICK,   // Press + release below the long-press threshold
+        DOUBLE_CLICK,   // Second click within the double-click window
+        LONG_PRESS,     // Held past the long-press threshold
+        PRESS_ROTATE    // Rotation detent while the button is held (chord)
+    };
+
     /**
      * @brief Rotation direction
      */
@@ -46,11 +81,12 @@ public:
      */
     struct Event {
         EventType type;
-        Direction direction;  // Valid only for ROTATION events
+        Direction direction;  // Valid for ROTATION and PRESS_ROTATE events
         int32_t position;      // Current position
         bool button_pressed;   // Valid only for BUTTON events
+        Gesture gesture;       // Valid only for GESTURE events
     };
-    
+
     /**
      * @brief Internal ISR event structure for ISR->task communication
      */
@@ -59,6 +95,7 @@ public:
         uint8_t new_state;     // State after transition
         bool is_button;        // true if button event, false if rotation
         bool button_pressed;   // Button state (valid only if is_button)
+        bool pre_debounced;    // Skip software debounce (host-fed button state)
     };
     
     /**
@@ -156,6 +193,108 @@ public:
     /// Returns true if a valid push-button pin was configured.
     bool hasButton() const { return has_button_; }
 
+    /**
+     * @brief Tune gesture classification timing
+     * @param long_press_ms Hold duration before LONG_PRESS fires (while held)
+     * @param double_click_window_ms Max gap between clicks for DOUBLE_CLICK;
+     *        0 (default) disables double-click so single clicks emit
+     *        immediately on release instead of after the window expires
+     */
+    void setGestureTiming(uint32_t long_press_ms, uint32_t double_click_window_ms) {
+        long_press_ms_ = long_press_ms;
+        double_click_window_ms_ = double_click_window_ms;
+    }
+
+    /**
+     * @brief Detent feedback callback (driver-task context)
+     */
+    using DetentFeedbackCb = void (*)(Direction direction, void* ctx);
+
+    /**
+     * @brief Register a feedback hook fired per detent from the driver task
+     *
+     * The callback runs at detent time in the driver task, so feedback
+     * latency is independent of how quickly the consumer drains the event
+     * queue. Fast spins are rate-limited: detents landing within
+     * @p min_gap_ms of the last feedback still emit their ROTATION events
+     * but skip the callback, collapsing a velocity spin into a sparse
+     * click train instead of a backlog. The callback must be short and
+     * queue-only (it runs on the driver task's budget); pass nullptr to
+     * unhook.
+     * @param cb Callback, or nullptr to disable
+     * @param ctx Opaque pointer handed back to the callback
+     * @param min_gap_ms Minimum gap between feedback invocations
+     */
+    void setDetentFeedback(DetentFeedbackCb cb, void* ctx, uint32_t min_gap_ms = 30) {
+        feedback_cb_ = nullptr;  // Quiesce before swapping ctx (driver task reads cb first)
+        feedback_ctx_ = ctx;
+        feedback_min_gap_ms_ = min_gap_ms;
+        feedback_cb_ = cb;
+    }
+
+    /**
+     * @brief Emergency hold callback (driver-task context)
+     */
+    using EmergencyHoldCb = void (*)(void* ctx);
+
+    /**
+     * @brief Register a hook fired when the button is held past @p hold_ms
+     *
+     * Fires once per hold, from the driver task, the moment the hold
+     * crosses the threshold - independent of gesture classification
+     * (LONG_PRESS and chords do not suppress it) and of how quickly the
+     * consumer drains the event queue, so it is suitable for safety
+     * actions whose latency must not depend on the UI loop. The callback
+     * runs on the driver task's budget and should do bounded work only;
+     * pass nullptr to unhook.
+     * @param cb Callback, or nullptr to disable
+     * @param ctx Opaque pointer handed back to the callback
+     * @param hold_ms Hold duration before the hook fires
+     */
+    void setEmergencyHold(EmergencyHoldCb cb, void* ctx, uint32_t hold_ms = 1000) {
+        emergency_cb_ = nullptr;  // Quiesce before swapping ctx (driver task reads cb first)
+        emergency_ctx_ = ctx;
+        emergency_hold_ms_ = hold_ms;
+        emergency_cb_ = cb;
+    }
+
+    /**
+     * @brief Cross-check the logical position against the hardware counter
+     *
+     * PCNT build only: compares the transitions the hardware has counted
+     * since the last sync point against the transitions the detent logic
+     * has consumed (emitted detents plus the partial-detent accumulator).
+     * A nonzero result means detents were lost or duplicated somewhere in
+     * the software path - e.g. the driver task stalled across a counter
+     * wrap. Call during input-idle windows; mid-spin the counter is
+     * legitimately ahead of the last poll and would read as drift. The
+     * GPIO-interrupt build has no independent count and always returns 0.
+     * @return Drift in whole detents (hardware minus logical); 0 = in sync
+     */
+    int32_t checkDrift();
+
+    /**
+     * @brief Adopt the hardware count as truth and correct the position
+     *
+     * Applies the drift reported by checkDrift() to the position (clamped
+     * to bounds) and rebaselines the sync point. Call from the same idle
+     * windows as checkDrift(); no-op (returns 0) in the GPIO build.
+     * @return The correction applied, in detents
+     */
+    int32_t resyncPosition();
+
+    /**
+     * @brief Inject button state for boards whose button GPIO is owned by
+     *        another driver (e.g. M5Unified's BtnA on the M5Dial)
+     *
+     * Call once per input pass with the current debounced state; edges are
+     * forwarded to the driver task and classified exactly like a wired
+     * button pin. No-op when a push-button pin is configured — the ISR
+     * path is authoritative then.
+     * @param pressed Current (already debounced) button state
+     */
+    void feedButtonState(bool pressed);
+
 private:
     static constexpr bool isValidPin_(gpio_num_t pin) {
         return static_cast<int>(pin) >= 0 && static_cast<int>(pin) < GPIO_NUM_MAX;
@@ -187,14 +326,79 @@ private:
     // Debounce timers
     uint32_t rotation_debounce_ms_;
     uint32_t button_debounce_ms_;
-    
+
+    // Gesture classifier (all state owned by the driver task)
+    static constexpr uint32_t GESTURE_POLL_MS = 10; // Service period while a gesture is pending
+    uint32_t long_press_ms_;          // Hold time before LONG_PRESS fires
+    uint32_t double_click_window_ms_; // 0 disables double-click detection
+    int64_t press_down_time_;         // ms timestamp of current press (0 = released)
+    int64_t click_up_time_;           // ms timestamp of a click awaiting a possible second
+    bool press_long_fired_;           // LONG_PRESS emitted for the current hold
+    bool press_chorded_;              // PRESS_ROTATE emitted for the current hold
+    bool press_is_second_;            // Current press landed within the double-click window
+    bool fed_button_state_;           // Last state injected via feedButtonState()
+
+    // Classify a debounced button edge (driver task context)
+    void classifyButtonEdge_(bool pressed, int64_t now_ms);
+
+    // Fire time-based gestures (long press, expired double-click window)
+    void serviceGestures_(int64_t now_ms);
+
+    // True while the classifier needs periodic service
+    bool gestureServicePending_() const {
+        return press_down_time_ != 0 || click_up_time_ != 0;
+    }
+
+    // Queue a GESTURE event
+    void emitGesture_(Gesture gesture);
+
+    // Queue a detent as ROTATION, or as a PRESS_ROTATE chord while held
+    void emitDetent_(Direction direction);
+
+    // Detent feedback hook (see setDetentFeedback)
+    volatile DetentFeedbackCb feedback_cb_ = nullptr;
+    void* feedback_ctx_ = nullptr;
+    uint32_t feedback_min_gap_ms_ = 30;
+    int64_t feedback_last_ms_ = 0;
+
+    // Emergency hold hook (see setEmergencyHold)
+    volatile EmergencyHoldCb emergency_cb_ = nullptr;
+    void* emergency_ctx_ = nullptr;
+    uint32_t emergency_hold_ms_ = 1000;
+    bool emergency_fired_ = false;    // Fired for the current hold
+
     // ISR context
     static void IRAM_ATTR gpio_isr_handler(void* arg);
     static void encoder_task(void* arg);
     TaskHandle_t task_handle_;
 
     bool has_button_ = true;
-    
+
+#if EC11_USE_PCNT
+    // PCNT backend: hardware counter state
+    static constexpr int PCNT_LIMIT = 30000;        // HW counter range before accumulation wraps
+    static constexpr uint32_t PCNT_POLL_MS = 10;    // Rotation poll period
+    pcnt_unit_handle_t pcnt_unit_ = nullptr;
+    pcnt_channel_handle_t pcnt_chan_a_ = nullptr;
+    pcnt_channel_handle_t pcnt_chan_b_ = nullptr;
+    int last_pcnt_count_ = 0;      // Counter value at last poll
+    int32_t pcnt_accum_ = 0;       // Transitions accumulated toward next detent
+
+    // Drift-check baseline (see checkDrift): counter value and logical
+    // position captured at begin/setPosition/resyncPosition time.
+    int sync_count_ = 0;
+    int32_t sync_position_ = 0;
+
+    // Bring up the PCNT unit and both quadrature channels
+    bool beginPcnt();
+
+    // Drain the hardware counter and emit one Event per full detent
+    void pollPcnt();
+
+    // Backend task: polls PCNT for rotation, drains ISR queue for button
+    static void pcnt_task(void* arg);
+#endif
+
     // Quadrature decoding table (Gray code)
     static const int8_t QUADRATURE_TABLE[16];
     
@@ -42,7 +42,11 @@ EC11Encoder::EC11Encoder(gpio_num_t tra_pin, gpio_num_t trb_pin, gpio_num_t psh_
       max_pos_(INT32_MAX), button_state_(false), button_press_count_(0),
       last_direction_(Direction::NONE), event_queue_(nullptr), isr_queue_(nullptr),
       last_state_(0), detent_counter_(0), last_rotation_time_(0), last_button_time_(0),
-      rotation_debounce_ms_(5), button_debounce_ms_(50), task_handle_(nullptr) {
+      rotation_debounce_ms_(5), button_debounce_ms_(50),
+      long_press_ms_(500), double_click_window_ms_(0),
+      press_down_time_(0), click_up_time_(0), press_long_fired_(false),
+      press_chorded_(false), press_is_second_(false), fed_button_state_(false),
+      task_handle_(nullptr) {
         has_button_ = isValidPin_(psh_pin_);
 }
 
@@ -75,19 +79,39 @@ bool EC11Encoder::begin(int32_t min_pos, int32_t max_pos) {
     io_conf.mode = GPIO_MODE_INPUT;
     io_conf.pull_up_en = GPIO_PULLUP_ENABLE;
     io_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
+#if EC11_USE_PCNT
+    // A/B are plain pulled-up inputs; the PCNT peripheral consumes the edges
+    // directly, so they never interrupt the CPU. Only the button does.
+    io_conf.intr_type = GPIO_INTR_DISABLE;
+    io_conf.pin_bit_mask = (1ULL << tra_pin_) | (1ULL << trb_pin_);
+#else
     io_conf.intr_type = GPIO_INTR_ANYEDGE;
     io_conf.pin_bit_mask = (1ULL << tra_pin_) | (1ULL << trb_pin_);
     if (has_button_) {
         io_conf.pin_bit_mask |= (1ULL << psh_pin_);
     }
-    
+#endif
+
     esp_err_t ret = gpio_config(&io_conf);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG_EC11, "Failed to configure GPIO: %s", esp_err_to_name(ret));
         return false;
     }
 
+#if EC11_USE_PCNT
+    if (has_button_) {
+        io_conf.intr_type = GPIO_INTR_ANYEDGE;
+        io_conf.pin_bit_mask = (1ULL << psh_pin_);
+        ret = gpio_config(&io_conf);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG_EC11, "Failed to configure button GPIO: %s", esp_err_to_name(ret));
+            return false;
+        }
+    }
+#endif
+
     // Enable hardware glitch filters per pin
+    // (with the PCNT backend A/B use the PCNT unit's own glitch filter)
     auto enable_glitch_filter = [](gpio_num_t pin) {
         gpio_pin_glitch_filter_config_t cfg = {
             .clk_src = GLITCH_FILTER_CLK_SRC_DEFAULT,
@@ -101,15 +125,17 @@ bool EC11Encoder::begin(int32_t min_pos, int32_t max_pos) {
         return false;
     };
     bool filter_ok = true;
+#if !EC11_USE_PCNT
     filter_ok &= enable_glitch_filter(tra_pin_);
     filter_ok &= enable_glitch_filter(trb_pin_);
+#endif
     if (has_button_) {
         filter_ok &= enable_glitch_filter(psh_pin_);
     }
     if (!filter_ok) {
         ESP_LOGW(TAG_EC11, "Glitch filter not enabled on all pins");
     }
-    
+
     // Install GPIO ISR service (if not already installed)
     ret = gpio_install_isr_service(0);
     if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
@@ -117,19 +143,21 @@ bool EC11Encoder::begin(int32_t min_pos, int32_t max_pos) {
         return false;
     }
     // ESP_ERR_INVALID_STATE means service is already installed, which is OK
-    
+
     // Add ISR handlers
+#if !EC11_USE_PCNT
     ret = gpio_isr_handler_add(tra_pin_, gpio_isr_handler, this);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG_EC11, "Failed to add ISR handler for TRA: %s", esp_err_to_name(ret));
         return false;
     }
-    
+
     ret = gpio_isr_handler_add(trb_pin_, gpio_isr_handler, this);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG_EC11, "Failed to add ISR handler for TRB: %s", esp_err_to_name(ret));
         return false;
     }
+#endif
 
     if (has_button_) {
         ret = gpio_isr_handler_add(psh_pin_, gpio_isr_handler, this);
@@ -138,7 +166,7 @@ bool EC11Encoder::begin(int32_t min_pos, int32_t max_pos) {
             return false;
         }
     }
-    
+
     // Read initial state
     uint8_t tra_state = gpio_get_level(tra_pin_);
     uint8_t trb_state = gpio_get_level(trb_pin_);
@@ -148,24 +176,195 @@ bool EC11Encoder::begin(int32_t min_pos, int32_t max_pos) {
     if (has_button_) {
         button_state_ = (gpio_get_level(psh_pin_) == 0); // Active LOW
     }
-    
+
+#if EC11_USE_PCNT
+    if (!beginPcnt()) {
+        return false;
+    }
+
+    // Create processing task (button events + counter polling)
+    xTaskCreate(pcnt_task, "ec11_task", 2048, this, 5, &task_handle_);
+    if (!task_handle_) {
+        ESP_LOGE(TAG_EC11, "Failed to create encoder task");
+        return false;
+    }
+#else
     // Create processing task
     xTaskCreate(encoder_task, "ec11_task", 2048, this, 5, &task_handle_);
     if (!task_handle_) {
         ESP_LOGE(TAG_EC11, "Failed to create encoder task");
         return false;
     }
-    
+#endif
+
     if (has_button_) {
-        ESP_LOGI(TAG_EC11, "EC11 encoder initialized: TRA=GPIO%d, TRB=GPIO%d, PSH=GPIO%d",
-                 tra_pin_, trb_pin_, psh_pin_);
+        ESP_LOGI(TAG_EC11, "EC11 encoder initialized (%s): TRA=GPIO%d, TRB=GPIO%d, PSH=GPIO%d",
+                 EC11_USE_PCNT ? "PCNT" : "GPIO ISR", tra_pin_, trb_pin_, psh_pin_);
     } else {
-        ESP_LOGI(TAG_EC11, "EC11 encoder initialized: TRA=GPIO%d, TRB=GPIO%d (no button pin)",
-                 tra_pin_, trb_pin_);
+        ESP_LOGI(TAG_EC11, "EC11 encoder initialized (%s): TRA=GPIO%d, TRB=GPIO%d (no button pin)",
+                 EC11_USE_PCNT ? "PCNT" : "GPIO ISR", tra_pin_, trb_pin_);
     }
     return true;
 }
 
+#if EC11_USE_PCNT
+bool EC11Encoder::beginPcnt() {
+    pcnt_unit_config_t unit_cfg = {};
+    unit_cfg.high_limit = PCNT_LIMIT;
+    unit_cfg.low_limit = -PCNT_LIMIT;
+    unit_cfg.flags.accum_count = true; // Software-accumulate across limit wraps
+    esp_err_t ret = pcnt_new_unit(&unit_cfg, &pcnt_unit_);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG_EC11, "Failed to create PCNT unit: %s", esp_err_to_name(ret));
+        return false;
+    }
+
+    // PCNT's own glitch filter debounces the contacts in hardware
+    pcnt_glitch_filter_config_t filter_cfg = {};
+    filter_cfg.max_glitch_ns = 1000;
+    if (pcnt_unit_set_glitch_filter(pcnt_unit_, &filter_cfg) != ESP_OK) {
+        ESP_LOGW(TAG_EC11, "PCNT glitch filter not enabled");
+    }
+
+    // Two channels, each clocked by one phase and gated by the other,
+    // give full 4x quadrature decoding in hardware
+    pcnt_chan_config_t chan_a_cfg = {};
+    chan_a_cfg.edge_gpio_num = tra_pin_;
+    chan_a_cfg.level_gpio_num = trb_pin_;
+    ret = pcnt_new_channel(pcnt_unit_, &chan_a_cfg, &pcnt_chan_a_);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG_EC11, "Failed to create PCNT channel A: %s", esp_err_to_name(ret));
+        return false;
+    }
+
+    pcnt_chan_config_t chan_b_cfg = {};
+    chan_b_cfg.edge_gpio_num = trb_pin_;
+    chan_b_cfg.level_gpio_num = tra_pin_;
+    ret = pcnt_new_channel(pcnt_unit_, &chan_b_cfg, &pcnt_chan_b_);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG_EC11, "Failed to create PCNT channel B: %s", esp_err_to_name(ret));
+        return false;
+    }
+
+    pcnt_channel_set_edge_action(pcnt_chan_a_, PCNT_CHANNEL_EDGE_ACTION_DECREASE,
+                                 PCNT_CHANNEL_EDGE_ACTION_INCREASE);
+    pcnt_channel_set_level_action(pcnt_chan_a_, PCNT_CHANNEL_LEVEL_ACTION_KEEP,
+                                  PCNT_CHANNEL_LEVEL_ACTION_INVERSE);
+    pcnt_channel_set_edge_action(pcnt_chan_b_, PCNT_CHANNEL_EDGE_ACTION_INCREASE,
+                                 PCNT_CHANNEL_EDGE_ACTION_DECREASE);
+    pcnt_channel_set_level_action(pcnt_chan_b_, PCNT_CHANNEL_LEVEL_ACTION_KEEP,
+                                  PCNT_CHANNEL_LEVEL_ACTION_INVERSE);
+
+    // Watch points at the limits are required for accum_count to work
+    pcnt_unit_add_watch_point(pcnt_unit_, PCNT_LIMIT);
+    pcnt_unit_add_watch_point(pcnt_unit_, -PCNT_LIMIT);
+
+    ret = pcnt_unit_enable(pcnt_unit_);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG_EC11, "Failed to enable PCNT unit: %s", esp_err_to_name(ret));
+        return false;
+    }
+    pcnt_unit_clear_count(pcnt_unit_);
+    pcnt_unit_start(pcnt_unit_);
+
+    last_pcnt_count_ = 0;
+    pcnt_accum_ = 0;
+    sync_count_ = 0;
+    sync_position_ = position_;
+    return true;
+}
+
+void EC11Encoder::pollPcnt() {
+    int count = 0;
+    if (pcnt_unit_get_count(pcnt_unit_, &count) != ESP_OK) {
+        return;
+    }
+
+    int delta = count - last_pcnt_count_;
+    if (delta == 0) {
+        return;
+    }
+    last_pcnt_count_ = count;
+    pcnt_accum_ += delta;
+
+    // Same detent semantics as the ISR backend: 4 transitions per click
+    const int32_t TRANSITIONS_PER_DETENT = 4;
+    while (pcnt_accum_ >= TRANSITIONS_PER_DETENT) {
+        pcnt_accum_ -= TRANSITIONS_PER_DETENT;
+        position_ = clampPosition(position_ + 1);
+        last_direction_ = Direction::CW;
+        emitDetent_(Direction::CW);
+    }
+    while (pcnt_accum_ <= -TRANSITIONS_PER_DETENT) {
+        pcnt_accum_ += TRANSITIONS_PER_DETENT;
+        position_ = clampPosition(position_ - 1);
+        last_direction_ = Direction::CCW;
+        emitDetent_(Direction::CCW);
+    }
+}
+
+int32_t EC11Encoder::checkDrift() {
+    int count = 0;
+    if (pcnt_unit_ == nullptr || pcnt_unit_get_count(pcnt_unit_, &count) != ESP_OK) {
+        return 0;
+    }
+    // Transitions the hardware saw since the baseline vs transitions the
+    // detent logic consumed (4 per emitted detent plus the partial-detent
+    // accumulator). Integer division drops the sub-detent residue the dial
+    // normally rests on between clicks.
+    const int32_t hw = count - sync_count_;
+    const int32_t consumed = (position_ - sync_position_) * 4 + pcnt_accum_;
+    return (hw - consumed) / 4;
+}
+
+int32_t EC11Encoder::resyncPosition() {
+    int count = 0;
+    if (pcnt_unit_ == nullptr || pcnt_unit_get_count(pcnt_unit_, &count) != ESP_OK) {
+        return 0;
+    }
+    const int32_t hw = count - sync_count_;
+    const int32_t consumed = (position_ - sync_position_) * 4 + pcnt_accum_;
+    const int32_t drift_detents = (hw - consumed) / 4;
+    if (drift_detents != 0) {
+        position_ = clampPosition(position_ + drift_detents);
+    }
+    // Rebaseline so the residue carried in pcnt_accum_ stays accounted for.
+    sync_count_ = count - pcnt_accum_;
+    sync_position_ = position_;
+    return drift_detents;
+}
+
+void EC11Encoder::pcnt_task(void* arg) {
+    EC11Encoder* encoder = static_cast<EC11Encoder*>(arg);
+    IsrEvent isr_evt;
+
+    while (1) {
+        // Button events still arrive via the GPIO ISR queue; the receive
+        // timeout doubles as the rotation poll period, so the counter is
+        // drained at least every PCNT_POLL_MS regardless of button traffic.
+        if (xQueueReceive(encoder->isr_queue_, &isr_evt, pdMS_TO_TICKS(PCNT_POLL_MS)) == pdTRUE) {
+            if (isr_evt.is_button) {
+                int64_t now = esp_timer_get_time() / 1000;
+                if (isr_evt.pre_debounced ||
+                    (now - encoder->last_button_time_) >= encoder->button_debounce_ms_) {
+                    encoder->processButtonChange(isr_evt.button_pressed);
+                    encoder->last_button_time_ = now;
+                }
+            }
+        }
+        encoder->pollPcnt();
+        encoder->serviceGestures_(esp_timer_get_time() / 1000);
+    }
+}
+#else // !EC11_USE_PCNT
+
+// The GPIO-interrupt build has no independent hardware count to check
+// against; the quadrature ISR is the only source of truth.
+int32_t EC11Encoder::checkDrift() { return 0; }
+int32_t EC11Encoder::resyncPosition() { return 0; }
+
+#endif // EC11_USE_PCNT
+
 void EC11Encoder::end() {
     if (task_handle_) {
         vTaskDelete(task_handle_);
@@ -181,9 +380,26 @@ void EC11Encoder::end() {
         vQueueDelete(isr_queue_);
         isr_queue_ = nullptr;
     }
-    
+
+#if EC11_USE_PCNT
+    if (pcnt_unit_) {
+        pcnt_unit_stop(pcnt_unit_);
+        pcnt_unit_disable(pcnt_unit_);
+        if (pcnt_chan_a_) {
+            pcnt_del_channel(pcnt_chan_a_);
+            pcnt_chan_a_ = nullptr;
+        }
+        if (pcnt_chan_b_) {
+            pcnt_del_channel(pcnt_chan_b_);
+            pcnt_chan_b_ = nullptr;
+        }
+        pcnt_del_unit(pcnt_unit_);
+        pcnt_unit_ = nullptr;
+    }
+#else
     gpio_isr_handler_remove(tra_pin_);
     gpio_isr_handler_remove(trb_pin_);
+#endif
     if (has_button_) {
         gpio_isr_handler_remove(psh_pin_);
     }
@@ -192,6 +408,14 @@ void EC11Encoder::end() {
 void EC11Encoder::setPosition(int32_t pos) {
     position_ = clampPosition(pos);
     detent_counter_ = 0;  // Reset partial detent accumulation
+#if EC11_USE_PCNT
+    pcnt_accum_ = 0;
+    // Rebaseline the drift check - a host-initiated jump is not drift.
+    if (pcnt_unit_ != nullptr) {
+        (void)pcnt_unit_get_count(pcnt_unit_, &sync_count_);
+    }
+    sync_position_ = position_;
+#endif
 }
 
 int32_t EC11Encoder::clampPosition(int32_t pos) const {
@@ -220,7 +444,8 @@ void IRAM_ATTR EC11Encoder::gpio_isr_handler(void* arg) {
             .old_state = old_state,
             .new_state = new_state,
             .is_button = false,
-            .button_pressed = false
+            .button_pressed = false,
+            .pre_debounced = false
         };
         xQueueSendFromISR(encoder->isr_queue_, &evt, &xHigherPriorityTaskWoken);
     }
@@ -233,7 +458,8 @@ void IRAM_ATTR EC11Encoder::gpio_isr_handler(void* arg) {
                 .old_state = 0,
                 .new_state = 0,
                 .is_button = true,
-                .button_pressed = button_pressed
+                .button_pressed = button_pressed,
+                .pre_debounced = false
             };
             xQueueSendFromISR(encoder->isr_queue_, &evt, &xHigherPriorityTaskWoken);
         }
@@ -247,13 +473,18 @@ void EC11Encoder::encoder_task(void* arg) {
     IsrEvent isr_evt;
     
     while (1) {
-        // Wait for events from ISR queue
-        if (xQueueReceive(encoder->isr_queue_, &isr_evt, portMAX_DELAY) == pdTRUE) {
+        // Wait for events from ISR queue. While a gesture is pending the
+        // wait is bounded so time-based gestures (long press, double-click
+        // window expiry) fire without needing another edge.
+        TickType_t wait = encoder->gestureServicePending_()
+                              ? pdMS_TO_TICKS(GESTURE_POLL_MS) : portMAX_DELAY;
+        if (xQueueReceive(encoder->isr_queue_, &isr_evt, wait) == pdTRUE) {
             int64_t now = esp_timer_get_time() / 1000; // Convert to milliseconds
-            
+
             if (isr_evt.is_button) {
                 // Process button event with debouncing
-                if ((now - encoder->last_button_time_) >= encoder->button_debounce_ms_) {
+                if (isr_evt.pre_debounced ||
+                    (now - encoder->last_button_time_) >= encoder->button_debounce_ms_) {
                     encoder->processButtonChange(isr_evt.button_pressed);
                     encoder->last_button_time_ = now;
                 }
@@ -266,6 +497,7 @@ void EC11Encoder::encoder_task(void* arg) {
                 }
             }
         }
+        encoder->serviceGestures_(esp_timer_get_time() / 1000);
     }
 }
 
@@ -299,29 +531,15 @@ void EC11Encoder::processQuadratureChangeFromStates(uint8_t old_state, uint8_t n
             position_++;
             last_direction_ = Direction::CW;
             position_ = clampPosition(position_);
-            
-            Event evt = {
-                .type = EventType::ROTATION,
-                .direction = Direction::CW,
-                .position = position_,
-                .button_pressed = false
-            };
-            xQueueSend(event_queue_, &evt, 0);
-            
+            emitDetent_(Direction::CW);
+
         } else if (detent_counter_ <= -TRANSITIONS_PER_DETENT) {
             // Full CCW detent
             detent_counter_ += TRANSITIONS_PER_DETENT;
             position_--;
             last_direction_ = Direction::CCW;
             position_ = clampPosition(position_);
-            
-            Event evt = {
-                .type = EventType::ROTATION,
-                .direction = Direction::CCW,
-                .position = position_,
-                .button_pressed = false
-            };
-            xQueueSend(event_queue_, &evt, 0);
+            emitDetent_(Direction::CCW);
         }
         // If counter hasn't reached threshold, wait for more transitions
     }
@@ -330,24 +548,161 @@ void EC11Encoder::processQuadratureChangeFromStates(uint8_t old_state, uint8_t n
 }
 
 void EC11Encoder::processButtonChange(bool pressed) {
-    if (!has_button_) {
-        return;
-    }
     if (pressed != button_state_) {
         button_state_ = pressed;
-        
+
         if (pressed) {
             button_press_count_++;
         }
-        
+
         Event evt = {
             .type = EventType::BUTTON,
             .direction = Direction::NONE,
             .position = position_,
-            .button_pressed = pressed
+            .button_pressed = pressed,
+            .gesture = Gesture::NONE
         };
-        
+
         xQueueSend(event_queue_, &evt, 0); // Non-blocking
+
+        classifyButtonEdge_(pressed, esp_timer_get_time() / 1000);
+    }
+}
+
+void EC11Encoder::feedButtonState(bool pressed) {
+    if (has_button_ || isr_queue_ == nullptr) {
+        return; // A wired button pin is authoritative
+    }
+    if (pressed == fed_button_state_) {
+        return;
+    }
+    fed_button_state_ = pressed;
+
+    IsrEvent evt = {
+        .old_state = 0,
+        .new_state = 0,
+        .is_button = true,
+        .button_pressed = pressed,
+        .pre_debounced = true
+    };
+    xQueueSend(isr_queue_, &evt, 0);
+}
+
+void EC11Encoder::emitDetent_(Direction direction) {
+    // A detent while the button is held is a press-and-rotate chord; the
+    // chord suppresses both the click and the long press for that hold.
+    // Once LONG_PRESS has fired the hold is spent, so later detents go
+    // back to plain rotation.
+    const bool chord = (press_down_time_ != 0) && !press_long_fired_;
+    if (chord) {
+        press_chorded_ = true;
+    }
+
+    Event evt = {
+        .type = chord ? EventType::GESTURE : EventType::ROTATION,
+        .direction = direction,
+        .position = position_,
+        .button_pressed = chord,
+        .gesture = chord ? Gesture::PRESS_ROTATE : Gesture::NONE
+    };
+    xQueueSend(event_queue_, &evt, 0);
+
+    // Detent feedback fires here, in the driver task, so the click lands
+    // at detent time regardless of what the consumer is doing with the
+    // event queue. Fast spins collapse to one feedback per gap window -
+    // at velocity individual clicks are indistinguishable anyway, and the
+    // queue behind the callback stays shallow.
+    const DetentFeedbackCb cb = feedback_cb_;
+    if (cb != nullptr) {
+        const int64_t now = esp_timer_get_time() / 1000;
+        if (now - feedback_last_ms_ >= static_cast<int64_t>(feedback_min_gap_ms_)) {
+            feedback_last_ms_ = now;
+            cb(direction, feedback_ctx_);
+        }
+    }
+}
+
+void EC11Encoder::emitGesture_(Gesture gesture) {
+    Event evt = {
+        .type = EventType::GESTURE,
+        .direction = Direction::NONE,
+        .position = position_,
+        .button_pressed = (press_down_time_ != 0),
+        .gesture = gesture
+    };
+    xQueueSend(event_queue_, &evt, 0);
+}
+
+void EC11Encoder::classifyButtonEdge_(bool pressed, int64_t now_ms) {
+    if (pressed) {
+        press_down_time_ = now_ms;
+        press_long_fired_ = false;
+        press_chorded_ = false;
+        emergency_fired_ = false;
+        // Pair with a pending first click at press time, so a second press
+        // held near the window edge still resolves as a double click.
+        press_is_second_ = (click_up_time_ != 0) &&
+                           ((now_ms - click_up_time_) <= double_click_window_ms_);
+        if (press_is_second_) {
+            click_up_time_ = 0;
+        }
+        return;
+    }
+
+    if (press_down_time_ == 0) {
+        return; // Release without a tracked press
+    }
+    const int64_t held_ms = now_ms - press_down_time_;
+    const bool consumed = press_long_fired_ || press_chorded_;
+    const bool second = press_is_second_;
+    press_down_time_ = 0;
+    press_long_fired_ = false;
+    press_chorded_ = false;
+    press_is_second_ = false;
+
+    if (consumed) {
+        return; // Long press or chord already reported this hold
+    }
+    if (held_ms >= long_press_ms_) {
+        // Threshold crossed between service polls and release
+        emitGesture_(Gesture::LONG_PRESS);
+        return;
+    }
+
+    if (double_click_window_ms_ == 0) {
+        emitGesture_(Gesture::SINGLE_CLICK);
+    } else if (second) {
+        emitGesture_(Gesture::DOUBLE_CLICK);
+    } else {
+        // First click: hold it until the window expires or a second lands
+        click_up_time_ = now_ms;
+    }
+}
+
+void EC11Encoder::serviceGestures_(int64_t now_ms) {
+    if (press_down_time_ != 0 && !press_long_fired_ && !press_chorded_ &&
+        (now_ms - press_down_time_) >= long_press_ms_) {
+        press_long_fired_ = true;
+        emitGesture_(Gesture::LONG_PRESS);
+    }
+
+    // Emergency hold: fires here in the driver task, deliberately outside
+    // gesture classification - a chord or an already-reported LONG_PRESS
+    // does not suppress it, and no event queue sits between the hold
+    // crossing the threshold and the callback running.
+    if (press_down_time_ != 0 && !emergency_fired_ &&
+        (now_ms - press_down_time_) >= emergency_hold_ms_) {
+        const EmergencyHoldCb cb = emergency_cb_;
+        if (cb != nullptr) {
+            emergency_fired_ = true;
+            cb(emergency_ctx_);
+        }
+    }
+
+    if (click_up_time_ != 0 &&
+        (now_ms - click_up_time_) > double_click_window_ms_) {
+        click_up_time_ = 0;
+        emitGesture_(Gesture::SINGLE_CLICK);
     }
 }
 
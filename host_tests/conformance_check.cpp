@@ -0,0 +1,169 @@
+/**
+ * @file conformance_check.cpp
+ * @brief Wire-compatibility conformance runner for recorded unit traffic
+ * @details Replays the vector files under vectors/ against the host-built
+ *          parsers. Each line is `<kind> <ok|rej> <hex>`: a frame as a unit
+ *          sent it (or a malformed shape fielded units have produced) and
+ *          the verdict the parser gave when the vector was recorded. A
+ *          parser change that flips any verdict fails the run - that is
+ *          the compatibility contract with units we cannot reflash on our
+ *          schedule. New vectors come from the on-device capture mode
+ *          (`wirecap dump` on the console prints ready-to-paste lines).
+ *          status2 streams are stateful: lines in one file decode in order
+ *          against a decoder reset at file start.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "protocol/fatigue_protocol.hpp"
+
+namespace fp = fatigue_proto;
+
+static int g_failures = 0;
+static int g_frames = 0;
+
+static bool hexDecode(const char* hex, uint8_t* out, size_t cap, size_t& len)
+{
+    len = 0;
+    const size_t n = std::strlen(hex);
+    if (n % 2 != 0 || n / 2 > cap) {
+        return false;
+    }
+    for (size_t i = 0; i < n; i += 2) {
+        unsigned byte = 0;
+        if (std::sscanf(hex + i, "%2x", &byte) != 1) {
+            return false;
+        }
+        out[len++] = static_cast<uint8_t>(byte);
+    }
+    return true;
+}
+
+/// Run one frame through the parser its kind names; return the verdict.
+static bool runFrame(const char* kind, const uint8_t* data, size_t len,
+                     fp::StatusDecoder& ctx)
+{
+    if (std::strcmp(kind, "status") == 0) {
+        fp::StatusPayload st{};
+        return fp::ParseStatus(data, len, st);
+    }
+    if (std::strcmp(kind, "status2") == 0) {
+        fp::StatusPayload st{};
+        return fp::ParseStatus(2, data, len, ctx, st);
+    }
+    if (std::strcmp(kind, "batch") == 0) {
+        fp::StatusSample samples[fp::STATUS_BATCH_MAX_SAMPLES_];
+        size_t count = 0;
+        return fp::ParseStatusBatch(data, len, samples,
+                                    fp::STATUS_BATCH_MAX_SAMPLES_, count);
+    }
+    if (std::strcmp(kind, "config") == 0) {
+        fp::ConfigPayload cfg{};
+        if (!fp::ParseConfig(data, len, cfg)) {
+            return false;
+        }
+        // Determinism pin: a parsed config re-packed must byte-match the
+        // wire for the span the frame carried (defaults fill the rest).
+        const size_t span = (len < sizeof(cfg)) ? len : sizeof(cfg);
+        if (std::memcmp(&cfg, data, span) != 0) {
+            std::fprintf(stderr, "FAIL: config roundtrip mismatch (%zuB frame)\n", len);
+            ++g_failures;
+        }
+        return true;
+    }
+    if (std::strcmp(kind, "confgen") == 0) {
+        uint16_t gen = 0;
+        return fp::ParseConfigGeneration(data, len, gen);
+    }
+    if (std::strcmp(kind, "ackcrc") == 0) {
+        uint32_t crc = 0;
+        return fp::ParseConfigAckCrc(data, len, crc);
+    }
+    if (std::strcmp(kind, "bounds") == 0) {
+        fp::BoundsResultPayload br{};
+        return fp::ParseBoundsResult(data, len, br);
+    }
+    if (std::strcmp(kind, "boundsprog") == 0) {
+        fp::BoundsProgressPayload bp{};
+        return fp::ParseBoundsProgress(data, len, bp);
+    }
+    std::fprintf(stderr, "FAIL: unknown vector kind '%s'\n", kind);
+    ++g_failures;
+    return false;
+}
+
+static void runFile(const char* path)
+{
+    FILE* f = std::fopen(path, "r");
+    if (f == nullptr) {
+        std::fprintf(stderr, "FAIL: cannot open %s\n", path);
+        ++g_failures;
+        return;
+    }
+
+    fp::StatusDecoder ctx;  // status2 state, scoped to this file
+    char line[1024];
+    int lineno = 0;
+    while (std::fgets(line, sizeof(line), f) != nullptr) {
+        ++lineno;
+        char kind[16];
+        char expect[8];
+        char hex[512];
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\0') {
+            continue;
+        }
+        if (std::sscanf(line, "%15s %7s %511s", kind, expect, hex) != 3) {
+            std::fprintf(stderr, "FAIL %s:%d: malformed vector line\n", path, lineno);
+            ++g_failures;
+            continue;
+        }
+
+        uint8_t data[512];
+        size_t len = 0;
+        if (!hexDecode(hex, data, sizeof(data), len)) {
+            std::fprintf(stderr, "FAIL %s:%d: bad hex\n", path, lineno);
+            ++g_failures;
+            continue;
+        }
+
+        // Frames land in the pooled receive buffers at a word boundary on
+        // device; replay aligned and deliberately misaligned so both the
+        // in-place and copying parse paths face every vector.
+        const bool want_ok = std::strcmp(expect, "ok") == 0;
+        fp::StatusDecoder skew_ctx = ctx;  // same stream state for both runs
+        const bool got_aligned = runFrame(kind, data, len, ctx);
+        uint8_t skewed[513];
+        std::memcpy(skewed + 1, data, len);
+        const bool got_skewed = runFrame(kind, skewed + 1, len, skew_ctx);
+
+        if (got_aligned != want_ok || got_skewed != want_ok) {
+            std::fprintf(stderr, "FAIL %s:%d: %s expected %s, got %s/%s\n",
+                         path, lineno, kind, expect,
+                         got_aligned ? "ok" : "rej", got_skewed ? "ok" : "rej");
+            ++g_failures;
+        }
+        ++g_frames;
+    }
+    std::fclose(f);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s vectors/*.vec\n", argv[0]);
+        return 2;
+    }
+    for (int i = 1; i < argc; ++i) {
+        runFile(argv[i]);
+    }
+    if (g_failures != 0) {
+        std::fprintf(stderr, "%d conformance failure(s)\n", g_failures);
+        return 1;
+    }
+    std::printf("all %d recorded frames parse as fielded (%d files)\n",
+                g_frames, argc - 1);
+    return 0;
+}
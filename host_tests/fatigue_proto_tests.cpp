@@ -0,0 +1,377 @@
+/**
+ * @file fatigue_proto_tests.cpp
+ * @brief Host-side tests for the fatigue protocol parsing layer
+ * @details Exercises the three-format ParseConfig compatibility logic, the
+ *          v1/v2 StatusUpdate decoders, batch expansion, the ConfigDelta
+ *          builder, and finally a randomized fuzz pass feeding malformed
+ *          frames to every parser. The parsers are header-only and free of
+ *          ESP-IDF dependencies, so regressions in exactly the code paths
+ *          that guard test data integrity surface here in seconds instead
+ *          of on hardware against a live unit.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "protocol/fatigue_protocol.hpp"
+
+static int g_failures = 0;
+
+#define CHECK(cond)                                                          \
+    do {                                                                     \
+        if (!(cond)) {                                                       \
+            std::fprintf(stderr, "FAIL %s:%d: %s\n", __FILE__, __LINE__,     \
+                         #cond);                                             \
+            ++g_failures;                                                    \
+        }                                                                    \
+    } while (0)
+
+namespace fp = fatigue_proto;
+
+/// xorshift32; deterministic so a fuzz failure reproduces from the seed.
+static uint32_t rnd(uint32_t& state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// ===== Legacy StatusUpdate =====
+
+static void testParseStatusLegacy()
+{
+    uint8_t buf[7] = {0};
+    const uint32_t cycle = 123456;
+    std::memcpy(buf, &cycle, 4);
+    buf[4] = static_cast<uint8_t>(fp::TestState::Running);
+    buf[5] = 9;
+    buf[6] = 1;
+
+    fp::StatusPayload st{};
+    CHECK(fp::ParseStatus(buf, 7, st));
+    CHECK(st.cycle_number == cycle);
+    CHECK(st.state == static_cast<uint8_t>(fp::TestState::Running));
+    CHECK(st.err_code == 9);
+    CHECK(st.bounds_valid == 1);
+
+    // 6-byte frame from older firmware: bounds_valid defaults to unknown.
+    CHECK(fp::ParseStatus(buf, 6, st));
+    CHECK(st.bounds_valid == 255);
+
+    CHECK(!fp::ParseStatus(buf, 5, st));
+    CHECK(!fp::ParseStatus(nullptr, 7, st));
+}
+
+// ===== Delta-encoded StatusUpdate v2 =====
+
+static size_t encodeVarint(uint8_t* out, uint32_t value)
+{
+    size_t n = 0;
+    do {
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        if (value != 0) {
+            byte |= 0x80;
+        }
+        out[n++] = byte;
+    } while (value != 0);
+    return n;
+}
+
+static void testParseStatusV2()
+{
+    fp::StatusDecoder ctx;
+    fp::StatusPayload st{};
+    uint8_t buf[16];
+
+    // Delta before any keyframe must not decode.
+    size_t n = 0;
+    buf[n++] = 0;  // flags: delta
+    n += encodeVarint(buf + n, 5);
+    buf[n++] = static_cast<uint8_t>(fp::TestState::Running);
+    CHECK(!fp::ParseStatus(2, buf, n, ctx, st));
+
+    // Keyframe with err_code.
+    n = 0;
+    buf[n++] = fp::STATUS_V2_FLAG_KEYFRAME_ | fp::STATUS_V2_FLAG_ERR_;
+    n += encodeVarint(buf + n, 100000);
+    buf[n++] = static_cast<uint8_t>(fp::TestState::Running);
+    buf[n++] = 4;
+    CHECK(fp::ParseStatus(2, buf, n, ctx, st));
+    CHECK(st.cycle_number == 100000);
+    CHECK(st.err_code == 4);
+    CHECK(st.bounds_valid == 255);
+
+    // Delta frame: cycle advances, omitted err_code carries over.
+    n = 0;
+    buf[n++] = 0;
+    n += encodeVarint(buf + n, 7);
+    buf[n++] = static_cast<uint8_t>(fp::TestState::Running);
+    CHECK(fp::ParseStatus(2, buf, n, ctx, st));
+    CHECK(st.cycle_number == 100007);
+    CHECK(st.err_code == 4);
+
+    // A legacy 7-byte frame with a v2 header must fall through and also
+    // seed the decoder for subsequent deltas.
+    ctx.Reset();
+    uint8_t legacy[7] = {0};
+    const uint32_t cycle = 42;
+    std::memcpy(legacy, &cycle, 4);
+    legacy[4] = static_cast<uint8_t>(fp::TestState::Paused);
+    legacy[5] = 0;
+    legacy[6] = 0;
+    CHECK(fp::ParseStatus(2, legacy, 7, ctx, st));
+    CHECK(st.cycle_number == 42);
+    n = 0;
+    buf[n++] = 0;
+    n += encodeVarint(buf + n, 1);
+    buf[n++] = static_cast<uint8_t>(fp::TestState::Paused);
+    CHECK(fp::ParseStatus(2, buf, n, ctx, st));
+    CHECK(st.cycle_number == 43);
+
+    // Version 1 headers always take the legacy path.
+    ctx.Reset();
+    CHECK(fp::ParseStatus(1, legacy, 7, ctx, st));
+    CHECK(st.cycle_number == 42);
+}
+
+// ===== StatusBatch =====
+
+static void testParseStatusBatch()
+{
+    uint8_t buf[64];
+    const uint32_t base_ms = 50000;
+    std::memcpy(buf, &base_ms, 4);
+    buf[4] = 3;
+    size_t n = fp::STATUS_BATCH_HEADER_SIZE_;
+    for (uint32_t i = 0; i < 3; ++i) {
+        const uint16_t dt = static_cast<uint16_t>(i * 100);
+        const uint32_t cycle = 1000 + i;
+        std::memcpy(buf + n, &dt, 2);
+        std::memcpy(buf + n + 2, &cycle, 4);
+        buf[n + 6] = static_cast<uint8_t>(fp::TestState::Running);
+        n += fp::STATUS_BATCH_SAMPLE_SIZE_;
+    }
+
+    fp::StatusSample samples[8];
+    size_t count = 0;
+    CHECK(fp::ParseStatusBatch(buf, n, samples, 8, count));
+    CHECK(count == 3);
+    CHECK(samples[0].timestamp_ms == 50000);
+    CHECK(samples[2].timestamp_ms == 50200);
+    CHECK(samples[2].cycle_number == 1002);
+
+    // Output capacity clamps the expansion without failing.
+    CHECK(fp::ParseStatusBatch(buf, n, samples, 2, count));
+    CHECK(count == 2);
+
+    // Truncated payload and oversized count both reject.
+    CHECK(!fp::ParseStatusBatch(buf, n - 1, samples, 8, count));
+    buf[4] = static_cast<uint8_t>(fp::STATUS_BATCH_MAX_SAMPLES_ + 1);
+    CHECK(!fp::ParseStatusBatch(buf, n, samples, 8, count));
+    buf[4] = 0;
+    CHECK(!fp::ParseStatusBatch(buf, n, samples, 8, count));
+}
+
+// ===== ParseConfig format compatibility =====
+
+static void testParseConfig()
+{
+    Settings settings{};
+    settings.test_unit.cycle_amount = 5000;
+    settings.test_unit.oscillation_vmax_rpm = 75.5f;
+    settings.test_unit.oscillation_amax_rev_s2 = 12.25f;
+    settings.test_unit.dwell_time_ms = 1500;
+    settings.test_unit.bounds_method_stallguard = false;
+    settings.test_unit.bounds_search_velocity_rpm = 20.0f;
+    settings.test_unit.stallguard_min_velocity_rpm = 8.0f;
+    settings.test_unit.stall_detection_current_factor = 0.7f;
+    settings.test_unit.bounds_search_accel_rev_s2 = 5.0f;
+    settings.test_unit.stallguard_sgt = -10;
+
+    const fp::ConfigPayload built = fp::BuildConfigPayload(settings);
+    // ConfigPayload is pack(1), so its bytes are the full-extended wire form.
+    uint8_t wire[sizeof(fp::ConfigPayload)];
+    std::memcpy(wire, &built, sizeof(built));
+
+    // Full extended v2 roundtrip.
+    fp::ConfigPayload out{};
+    CHECK(fp::ParseConfig(wire, fp::CONFIG_EXTENDED_V2_SIZE_, out));
+    CHECK(std::memcmp(&out, &built, sizeof(out)) == 0);
+
+    // Extended v1 (no SGT byte): SGT falls back to "use unit default".
+    out = {};
+    CHECK(fp::ParseConfig(wire, fp::CONFIG_EXTENDED_V1_SIZE_, out));
+    CHECK(out.stallguard_sgt == 127);
+    CHECK(out.bounds_search_accel_rev_s2 == 5.0f);
+
+    // Base-only (oldest units): extended fields come back as defaults.
+    out = {};
+    CHECK(fp::ParseConfig(wire, fp::CONFIG_BASE_SIZE_, out));
+    CHECK(out.cycle_amount == 5000);
+    CHECK(out.bounds_method == 1);
+    CHECK(out.bounds_search_velocity_rpm == 0.0f);
+    CHECK(out.stallguard_sgt == 127);
+
+    CHECK(!fp::ParseConfig(wire, fp::CONFIG_BASE_SIZE_ - 1, out));
+    CHECK(!fp::ParseConfig(nullptr, sizeof(wire), out));
+}
+
+// ===== Config generation extraction =====
+
+static void testParseConfigGeneration()
+{
+    uint16_t gen = 0;
+
+    // ConfigAck: the generation is the whole payload.
+    const uint16_t ack_gen = 0xBEEF;
+    uint8_t ack[2];
+    std::memcpy(ack, &ack_gen, 2);
+    CHECK(fp::ParseConfigGeneration(ack, 2, gen));
+    CHECK(gen == 0xBEEF);
+
+    // ConfigResponse v3: appended after the v2 fields.
+    uint8_t resp[fp::CONFIG_EXTENDED_V3_SIZE_] = {0};
+    const uint16_t resp_gen = 7;
+    std::memcpy(resp + fp::CONFIG_EXTENDED_V2_SIZE_, &resp_gen, 2);
+    CHECK(fp::ParseConfigGeneration(resp, sizeof(resp), gen));
+    CHECK(gen == 7);
+
+    // v2 response (no generation) and junk lengths reject.
+    CHECK(!fp::ParseConfigGeneration(resp, fp::CONFIG_EXTENDED_V2_SIZE_, gen));
+    CHECK(!fp::ParseConfigGeneration(resp, 1, gen));
+    CHECK(!fp::ParseConfigGeneration(nullptr, 2, gen));
+}
+
+// ===== ConfigDelta builder =====
+
+static void testBuildConfigDelta()
+{
+    Settings settings{};
+    const fp::ConfigPayload base = fp::BuildConfigPayload(settings);
+    uint8_t buf[fp::CONFIG_DELTA_HEADER_SIZE_ + sizeof(fp::ConfigPayload)];
+
+    // Identical snapshots: header only, empty mask.
+    size_t n = fp::BuildConfigDelta(base, base, 3, buf, sizeof(buf));
+    CHECK(n == fp::CONFIG_DELTA_HEADER_SIZE_);
+    uint16_t field = 0;
+    std::memcpy(&field, buf + 2, 2);
+    CHECK(field == 0);
+
+    // Single float change: 4-byte header + 4-byte value.
+    fp::ConfigPayload changed = base;
+    changed.oscillation_vmax_rpm = 90.0f;
+    n = fp::BuildConfigDelta(base, changed, 3, buf, sizeof(buf));
+    CHECK(n == fp::CONFIG_DELTA_HEADER_SIZE_ + 4);
+    uint16_t base_gen = 0;
+    std::memcpy(&base_gen, buf, 2);
+    std::memcpy(&field, buf + 2, 2);
+    CHECK(base_gen == 3);
+    CHECK(field == fp::CFG_FIELD_VMAX_);
+    float vmax = 0.0f;
+    std::memcpy(&vmax, buf + fp::CONFIG_DELTA_HEADER_SIZE_, 4);
+    CHECK(vmax == 90.0f);
+
+    // Multi-field: values appear in declaration order regardless of which
+    // fields changed; the 1-byte SGT rides last.
+    changed = base;
+    changed.dwell_time_ms = 2500;
+    changed.stallguard_sgt = 5;
+    n = fp::BuildConfigDelta(base, changed, 9, buf, sizeof(buf));
+    CHECK(n == fp::CONFIG_DELTA_HEADER_SIZE_ + 4 + 1);
+    std::memcpy(&field, buf + 2, 2);
+    CHECK(field == (fp::CFG_FIELD_DWELL_ | fp::CFG_FIELD_SGT_));
+    uint32_t dwell = 0;
+    std::memcpy(&dwell, buf + fp::CONFIG_DELTA_HEADER_SIZE_, 4);
+    CHECK(dwell == 2500);
+    CHECK(static_cast<int8_t>(buf[fp::CONFIG_DELTA_HEADER_SIZE_ + 4]) == 5);
+
+    // Undersized buffer refuses outright.
+    CHECK(fp::BuildConfigDelta(base, changed, 9, buf, 8) == 0);
+    CHECK(fp::BuildConfigDelta(base, changed, 9, nullptr, sizeof(buf)) == 0);
+}
+
+// ===== Randomized malformed-frame fuzz =====
+
+static void fuzzParsers(uint32_t iters)
+{
+    uint32_t seed = 0x1234ABCD;
+    uint8_t buf[256];
+    fp::StatusDecoder ctx;
+
+    for (uint32_t i = 0; i < iters; ++i) {
+        const size_t len = rnd(seed) % (sizeof(buf) + 1);
+        for (size_t j = 0; j < len; ++j) {
+            buf[j] = static_cast<uint8_t>(rnd(seed));
+        }
+
+        // The sanitizers assert memory safety; these assert the documented
+        // rejection floors so a parser can never "succeed" on a frame too
+        // short to contain what it claims to have read.
+        fp::StatusPayload st{};
+        if (fp::ParseStatus(buf, len, st)) {
+            CHECK(len >= 6);
+        }
+        const uint8_t wire_version = static_cast<uint8_t>(1 + (rnd(seed) % 3));
+        (void)fp::ParseStatus(wire_version, buf, len, ctx, st);
+
+        fp::StatusSample samples[8];
+        size_t count = 0;
+        if (fp::ParseStatusBatch(buf, len, samples, 8, count)) {
+            CHECK(count <= 8);
+            CHECK(len >= fp::STATUS_BATCH_HEADER_SIZE_ + fp::STATUS_BATCH_SAMPLE_SIZE_);
+        }
+
+        fp::ConfigPayload cfg{};
+        if (fp::ParseConfig(buf, len, cfg)) {
+            CHECK(len >= fp::CONFIG_BASE_SIZE_);
+        }
+
+        uint16_t gen = 0;
+        if (fp::ParseConfigGeneration(buf, len, gen)) {
+            CHECK(len == 2 || len == 6 || len >= fp::CONFIG_EXTENDED_V3_SIZE_);
+        }
+
+        fp::BoundsResultPayload br{};
+        if (fp::ParseBoundsResult(buf, len, br)) {
+            CHECK(len >= sizeof(fp::BoundsResultPayload));
+        }
+
+        const uint8_t* p = buf;
+        uint32_t value = 0;
+        (void)fp::DecodeVarint32(p, buf + len, value);
+        CHECK(p <= buf + len);
+
+        if ((rnd(seed) & 0x3F) == 0) {
+            ctx.Reset();
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t fuzz_iters = 200000;
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--fuzz-iters") == 0) {
+            fuzz_iters = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+        }
+    }
+
+    testParseStatusLegacy();
+    testParseStatusV2();
+    testParseStatusBatch();
+    testParseConfig();
+    testParseConfigGeneration();
+    testBuildConfigDelta();
+    fuzzParsers(fuzz_iters);
+
+    if (g_failures != 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("all checks passed (fuzz iters: %u)\n", fuzz_iters);
+    return 0;
+}
@@ -0,0 +1,165 @@
+/**
+ * @file asset_store.cpp
+ * @brief Memory-mapped asset partition implementation.
+ */
+
+#include "asset_store.hpp"
+
+#include <cstring>
+
+#include "esp_log.h"
+#include "esp_partition.h"
+
+namespace {
+
+const char* TAG_ = "assets";
+
+// ============================================================================
+// IMAGE FORMAT (must match tools/pack_assets.py)
+// ============================================================================
+//
+// [ Header 16 B ][ Directory count * 16 B ][ payloads, 4-byte aligned ]
+//
+// Entries are indexed by asset id: the packer assigns dense ids in
+// manifest order and refuses gaps, so dir[id] IS the entry. Offsets are
+// from the start of the partition; payload CRCs are verified on demand
+// (Verify), the directory CRC at mount.
+
+constexpr uint32_t MAGIC_ = 0x5341354D;  // "M5AS" little-endian
+constexpr uint16_t VERSION_ = 1;
+
+#pragma pack(push, 1)
+struct Header {
+    uint32_t magic;      ///< MAGIC_
+    uint16_t version;    ///< VERSION_
+    uint16_t count;      ///< Directory entries (= dense id space)
+    uint32_t dir_crc32;  ///< CRC32-IEEE over the directory entries
+    uint32_t reserved;   ///< Zero
+};
+struct Entry {
+    uint16_t id;        ///< Equals its directory index (packer invariant)
+    uint16_t flags;     ///< Reserved, zero
+    uint32_t offset;    ///< Payload start, from partition base
+    uint32_t size;      ///< Payload bytes
+    uint32_t crc32;     ///< CRC32-IEEE of the payload
+};
+#pragma pack(pop)
+
+static_assert(sizeof(Header) == 16, "asset image header is 16 bytes");
+static_assert(sizeof(Entry) == 16, "asset directory entry is 16 bytes");
+
+const uint8_t* s_base_ = nullptr;   ///< Mapped partition base (nullptr = unmounted)
+const Entry* s_dir_ = nullptr;      ///< Directory, inside the mapping
+uint16_t s_count_ = 0;
+
+/** @brief CRC32-IEEE, same polynomial the settings blob uses. */
+uint32_t crc32_ieee(const uint8_t* data, size_t len) noexcept
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= data[i];
+        for (int j = 0; j < 8; ++j) {
+            const uint32_t mask = -(crc & 1u);
+            crc = (crc >> 1) ^ (0xEDB88320u & mask);
+        }
+    }
+    return ~crc;
+}
+
+}  // namespace
+
+void asset_store::Init() noexcept
+{
+    const esp_partition_t* part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "assets");
+    if (part == nullptr) {
+        ESP_LOGW(TAG_, "No assets partition; compiled-in fallbacks only");
+        return;
+    }
+
+    const void* base = nullptr;
+    esp_partition_mmap_handle_t handle;  // kept mapped for the app lifetime
+    const esp_err_t err = esp_partition_mmap(part, 0, part->size,
+                                             ESP_PARTITION_MMAP_DATA, &base, &handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG_, "mmap failed: %s", esp_err_to_name(err));
+        return;
+    }
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(base);
+    Header hdr;
+    std::memcpy(&hdr, bytes, sizeof(hdr));
+    if (hdr.magic != MAGIC_) {
+        // An erased partition is the normal first-boot state; only log
+        // loudly when something that isn't blank flash fails to parse.
+        if (hdr.magic != 0xFFFFFFFFu) {
+            ESP_LOGE(TAG_, "Bad image magic 0x%08x", static_cast<unsigned>(hdr.magic));
+        } else {
+            ESP_LOGW(TAG_, "Assets partition empty; compiled-in fallbacks only");
+        }
+        esp_partition_munmap(handle);
+        return;
+    }
+    if (hdr.version != VERSION_) {
+        ESP_LOGE(TAG_, "Unsupported image version %u", hdr.version);
+        esp_partition_munmap(handle);
+        return;
+    }
+    const size_t dir_bytes = static_cast<size_t>(hdr.count) * sizeof(Entry);
+    if (sizeof(Header) + dir_bytes > part->size) {
+        ESP_LOGE(TAG_, "Directory (%u entries) exceeds partition", hdr.count);
+        esp_partition_munmap(handle);
+        return;
+    }
+    const Entry* dir = reinterpret_cast<const Entry*>(bytes + sizeof(Header));
+    if (crc32_ieee(bytes + sizeof(Header), dir_bytes) != hdr.dir_crc32) {
+        ESP_LOGE(TAG_, "Directory CRC mismatch; image ignored");
+        esp_partition_munmap(handle);
+        return;
+    }
+    for (uint16_t i = 0; i < hdr.count; ++i) {
+        if (dir[i].id != i ||
+            dir[i].offset + dir[i].size > part->size ||
+            dir[i].offset + dir[i].size < dir[i].offset) {
+            ESP_LOGE(TAG_, "Entry %u malformed; image ignored", i);
+            esp_partition_munmap(handle);
+            return;
+        }
+    }
+
+    s_base_ = bytes;
+    s_dir_ = dir;
+    s_count_ = hdr.count;
+    ESP_LOGI(TAG_, "Mounted %u assets (%lu KB partition, mapped)",
+             s_count_, static_cast<unsigned long>(part->size / 1024));
+}
+
+bool asset_store::Mounted() noexcept
+{
+    return s_base_ != nullptr;
+}
+
+size_t asset_store::Count() noexcept
+{
+    return s_count_;
+}
+
+bool asset_store::Get(uint16_t id, View& out) noexcept
+{
+    if (s_base_ == nullptr || id >= s_count_) {
+        return false;
+    }
+    const Entry& e = s_dir_[id];
+    out.data = s_base_ + e.offset;
+    out.size = e.size;
+    return true;
+}
+
+bool asset_store::Verify(uint16_t id) noexcept
+{
+    View v;
+    if (!Get(id, v)) {
+        return false;
+    }
+    return crc32_ieee(v.data, v.size) == s_dir_[id].crc32;
+}
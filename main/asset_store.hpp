@@ -0,0 +1,61 @@
+/**
+ * @file asset_store.hpp
+ * @brief Memory-mapped asset partition (fonts, sprites, keyframe sets).
+ * @details Large UI resources no longer ride in the app image: a packed
+ *          image built by tools/pack_assets.py lives in the dedicated
+ *          "assets" data partition and is memory-mapped once at boot, so
+ *          an asset tweak reflashes 256 KB instead of both OTA slots and
+ *          a code-only OTA stays asset-free. Reads are zero-copy — Get()
+ *          hands back a pointer straight into the mapped flash region,
+ *          served through the cache like any const data.
+ *
+ *          The image starts with a fixed directory indexed by asset id
+ *          (ids are dense, assigned by the manifest), so lookup is one
+ *          bounds check and one array index. If the partition is missing
+ *          or fails validation the module degrades to a no-op and every
+ *          Get() misses; callers keep their compiled-in fallbacks.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace asset_store {
+
+/** @brief One mapped asset: borrowed pointer into flash, valid forever. */
+struct View {
+    const uint8_t* data;  ///< Start of the payload in mapped flash
+    uint32_t size;        ///< Payload size in bytes
+};
+
+/**
+ * @brief Locate, map and validate the assets partition
+ * @details Safe to call once at boot. Header magic, version, directory
+ *          bounds and the directory CRC are all checked before any
+ *          entry is served; a bad image logs once and stays unmounted.
+ */
+void Init() noexcept;
+
+/** @brief True when a valid image is mapped and Get() can succeed. */
+bool Mounted() noexcept;
+
+/** @brief Number of assets in the mounted image (0 when unmounted). */
+size_t Count() noexcept;
+
+/**
+ * @brief Look up an asset by id (O(1): directory is indexed by id)
+ * @param id Dense asset id assigned by the pack manifest
+ * @param out Receives the mapped payload view
+ * @return true if mounted and @p id names an entry
+ */
+bool Get(uint16_t id, View& out) noexcept;
+
+/**
+ * @brief Verify one payload against its stored CRC32
+ * @details Reads the whole payload through cache — boot-time or
+ *          self-test use, not a hot path.
+ */
+bool Verify(uint16_t id) noexcept;
+
+}  // namespace asset_store
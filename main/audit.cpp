@@ -0,0 +1,385 @@
+/**
+ * @file audit.cpp
+ * @brief Flash-backed settings audit trail implementation.
+ */
+
+#include "audit.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "flash_gov.hpp"
+#include "rfid_badge.hpp"
+
+namespace {
+
+const char* TAG_ = "audit";
+
+// ============================================================================
+// SETTINGS SCHEMA TABLE
+// ============================================================================
+//
+// One row per config field, keyed by the same CFG_FIELD_ bits the delta
+// sync uses on the wire, so an audit record and a ConfigDelta agree on
+// what "field 1<<2" means. Offsets index into ConfigPayload; recording a
+// change is a table walk comparing raw bytes, and all formatting (names,
+// float rendering) happens only at readback.
+
+enum class ValType : uint8_t { U32, F32, U8, I8 };
+
+struct FieldDesc {
+    uint16_t bit;       ///< CFG_FIELD_ schema id
+    uint8_t offset;     ///< Byte offset into ConfigPayload
+    uint8_t size;       ///< Raw width (1 or 4)
+    ValType type;       ///< How FormatValue renders the bytes
+    const char* name;   ///< Short display name
+};
+
+#define AUDIT_FIELD_(bit, member, type, name) \
+    { bit, static_cast<uint8_t>(offsetof(fatigue_proto::ConfigPayload, member)), \
+      static_cast<uint8_t>(sizeof(fatigue_proto::ConfigPayload{}.member)), type, name }
+
+constexpr FieldDesc SCHEMA_[] = {
+    AUDIT_FIELD_(fatigue_proto::CFG_FIELD_CYCLE_AMOUNT_, cycle_amount, ValType::U32, "cycles"),
+    AUDIT_FIELD_(fatigue_proto::CFG_FIELD_VMAX_, oscillation_vmax_rpm, ValType::F32, "vmax"),
+    AUDIT_FIELD_(fatigue_proto::CFG_FIELD_AMAX_, oscillation_amax_rev_s2, ValType::F32, "amax"),
+    AUDIT_FIELD_(fatigue_proto::CFG_FIELD_DWELL_, dwell_time_ms, ValType::U32, "dwell"),
+    AUDIT_FIELD_(fatigue_proto::CFG_FIELD_BOUNDS_METHOD_, bounds_method, ValType::U8, "method"),
+    AUDIT_FIELD_(fatigue_proto::CFG_FIELD_BOUNDS_VEL_, bounds_search_velocity_rpm, ValType::F32, "b.vel"),
+    AUDIT_FIELD_(fatigue_proto::CFG_FIELD_SG_MIN_VEL_, stallguard_min_velocity_rpm, ValType::F32, "sg.vmin"),
+    AUDIT_FIELD_(fatigue_proto::CFG_FIELD_STALL_FACTOR_, stall_detection_current_factor, ValType::F32, "stall.f"),
+    AUDIT_FIELD_(fatigue_proto::CFG_FIELD_BOUNDS_ACCEL_, bounds_search_accel_rev_s2, ValType::F32, "b.acc"),
+    AUDIT_FIELD_(fatigue_proto::CFG_FIELD_SGT_, stallguard_sgt, ValType::I8, "sgt"),
+};
+
+#undef AUDIT_FIELD_
+
+const FieldDesc* findField(uint16_t bit) noexcept
+{
+    for (const auto& f : SCHEMA_) {
+        if (f.bit == bit) {
+            return &f;
+        }
+    }
+    return nullptr;
+}
+
+// ============================================================================
+// ON-FLASH LAYOUT
+// ============================================================================
+//
+// Same shape as run_db: 4 KB sectors, slot 0 is a header with a monotonic
+// sequence number, the remaining slots hold fixed 28-byte records
+// appended oldest-first; sectors are consumed circularly. Saves are
+// operator actions (a handful per shift), so the caller eats the
+// occasional program directly - no staging page, no writer task.
+
+constexpr size_t SECTOR_SIZE_ = 4096;
+constexpr size_t RECORD_SIZE_ = sizeof(audit::Record);
+constexpr size_t RECORDS_PER_SECTOR_ = SECTOR_SIZE_ / RECORD_SIZE_ - 1;  // slot 0 = header
+constexpr size_t MAX_SECTORS_ = 8;       ///< Bookkeeping cap (32 KB partition)
+constexpr uint32_t SECTOR_MAGIC_ = 0x31544441;   // "ADT1"
+constexpr uint32_t ERASED_WORD_ = 0xFFFFFFFFu;
+
+struct SectorHeader {
+    uint32_t magic;
+    uint32_t seq;          ///< Monotonic; newest sector has the largest value
+    uint8_t reserved[RECORD_SIZE_ - 8];
+};
+static_assert(sizeof(SectorHeader) == RECORD_SIZE_, "header fills one slot");
+
+const esp_partition_t* s_part_ = nullptr;
+size_t s_sector_count_total_ = 0;        ///< Usable sectors in the partition
+SemaphoreHandle_t s_mutex_ = nullptr;    ///< Guards the bookkeeping
+
+uint32_t s_next_seq_ = 1;                ///< Number for the next record
+size_t s_cur_sector_ = 0;                ///< Sector records are appended into
+size_t s_cur_used_ = RECORDS_PER_SECTOR_;  ///< Records in it (full = open a new one)
+uint32_t s_sector_seq_[MAX_SECTORS_] = {};   ///< 0 = sector invalid/erased
+uint8_t s_sector_used_[MAX_SECTORS_] = {};   ///< Valid records in the sector
+size_t s_flash_total_ = 0;               ///< Sum of s_sector_used_
+
+/** @brief First unused record slot in @p sector (binary search over seq words). */
+uint8_t scanSectorUsed(size_t sector) noexcept
+{
+    size_t lo = 0;                     // slots [0, lo) are known used
+    size_t hi = RECORDS_PER_SECTOR_;   // slots [hi, end) are known erased
+    while (lo < hi) {
+        const size_t mid = (lo + hi) / 2;
+        uint32_t seq = ERASED_WORD_;
+        (void)esp_partition_read(s_part_,
+                                 sector * SECTOR_SIZE_ + (1 + mid) * RECORD_SIZE_,
+                                 &seq, sizeof(seq));
+        if (seq == ERASED_WORD_) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return static_cast<uint8_t>(lo);
+}
+
+/**
+ * @brief Erase the next circular sector and stamp its header
+ * @details Drops the sector from the bookkeeping first so a concurrent
+ *          reader never sees the recycled sector as valid history.
+ */
+bool openNextSector() noexcept
+{
+    const size_t sector = (s_cur_used_ >= RECORDS_PER_SECTOR_ && s_sector_seq_[s_cur_sector_] != 0)
+        ? (s_cur_sector_ + 1) % s_sector_count_total_
+        : s_cur_sector_;
+
+    s_flash_total_ -= s_sector_used_[sector];
+    s_sector_seq_[sector] = 0;
+    s_sector_used_[sector] = 0;
+
+    SectorHeader hdr;
+    memset(&hdr, 0xFF, sizeof(hdr));
+    hdr.magic = SECTOR_MAGIC_;
+    hdr.seq = s_next_seq_;
+
+    esp_err_t err = esp_partition_erase_range(s_part_, sector * SECTOR_SIZE_, SECTOR_SIZE_);
+    // Not deferrable - the record carries an operator action - but the
+    // governor's pacing should still account for the stall.
+    flash_gov::NoteErase();
+    if (err == ESP_OK) {
+        err = esp_partition_write(s_part_, sector * SECTOR_SIZE_, &hdr, sizeof(hdr));
+    }
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG_, "Sector %u open failed: %s",
+                 static_cast<unsigned>(sector), esp_err_to_name(err));
+        return false;
+    }
+
+    s_cur_sector_ = sector;
+    s_cur_used_ = 0;
+    s_sector_seq_[sector] = hdr.seq;
+    return true;
+}
+
+/** @brief Append one record under the bookkeeping lock (seq assigned here). */
+bool appendLocked(audit::Record& rec) noexcept
+{
+    if (s_cur_used_ >= RECORDS_PER_SECTOR_ || s_sector_seq_[s_cur_sector_] == 0) {
+        if (!openNextSector()) {
+            return false;
+        }
+    }
+
+    rec.seq = s_next_seq_;
+    const size_t offset =
+        s_cur_sector_ * SECTOR_SIZE_ + (1 + s_cur_used_) * RECORD_SIZE_;
+    if (esp_partition_write(s_part_, offset, &rec, sizeof(rec)) != ESP_OK) {
+        return false;
+    }
+
+    ++s_next_seq_;
+    ++s_cur_used_;
+    s_sector_used_[s_cur_sector_] = static_cast<uint8_t>(s_cur_used_);
+    ++s_flash_total_;
+    return true;
+}
+
+} // namespace
+
+void audit::Init() noexcept
+{
+    s_part_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                       ESP_PARTITION_SUBTYPE_ANY, "auditlog");
+    if (s_part_ == nullptr) {
+        ESP_LOGW(TAG_, "No auditlog partition; audit trail disabled");
+        return;
+    }
+    s_sector_count_total_ = s_part_->size / SECTOR_SIZE_;
+    if (s_sector_count_total_ > MAX_SECTORS_) {
+        s_sector_count_total_ = MAX_SECTORS_;
+    }
+    s_mutex_ = xSemaphoreCreateMutex();
+    if (s_mutex_ == nullptr || s_sector_count_total_ == 0) {
+        ESP_LOGW(TAG_, "Init failed; audit trail disabled");
+        s_part_ = nullptr;
+        return;
+    }
+
+    // Scan sector headers to find where the previous session left off.
+    uint32_t max_seq = 0;
+    size_t max_sector = 0;
+    for (size_t i = 0; i < s_sector_count_total_; ++i) {
+        SectorHeader hdr{};
+        if (esp_partition_read(s_part_, i * SECTOR_SIZE_, &hdr,
+                               sizeof(hdr.magic) + sizeof(hdr.seq)) != ESP_OK) {
+            continue;
+        }
+        if (hdr.magic != SECTOR_MAGIC_ || hdr.seq == 0) {
+            continue;
+        }
+        s_sector_seq_[i] = hdr.seq;
+        s_sector_used_[i] = scanSectorUsed(i);
+        s_flash_total_ += s_sector_used_[i];
+        if (hdr.seq > max_seq) {
+            max_seq = hdr.seq;
+            max_sector = i;
+        }
+    }
+    if (max_seq != 0) {
+        s_cur_sector_ = max_sector;
+        s_cur_used_ = s_sector_used_[max_sector];
+        // Highest stored change number wins; the header seq is the number
+        // of the sector's first record.
+        s_next_seq_ = max_seq + s_cur_used_;
+        if (s_next_seq_ <= max_seq) {
+            s_next_seq_ = max_seq + 1;
+        }
+    }
+
+    ESP_LOGI(TAG_, "%u sectors, %u changes on record",
+             static_cast<unsigned>(s_sector_count_total_),
+             static_cast<unsigned>(s_flash_total_));
+}
+
+size_t audit::NoteConfigChange(const fatigue_proto::ConfigPayload& from,
+                               const fatigue_proto::ConfigPayload& to,
+                               uint32_t ms) noexcept
+{
+    if (s_part_ == nullptr) {
+        return 0;
+    }
+
+    // Badge resolved once per save, shared by every field record.
+    uint8_t badge_uid[rfid::MAX_UID_LEN] = {};
+    uint8_t badge_len = 0;
+    (void)rfid::GetCurrentBadge(badge_uid, badge_len);
+
+    const auto* from_bytes = reinterpret_cast<const uint8_t*>(&from);
+    const auto* to_bytes = reinterpret_cast<const uint8_t*>(&to);
+
+    size_t recorded = 0;
+    xSemaphoreTake(s_mutex_, portMAX_DELAY);
+    for (const auto& f : SCHEMA_) {
+        if (memcmp(from_bytes + f.offset, to_bytes + f.offset, f.size) == 0) {
+            continue;
+        }
+        Record rec{};
+        rec.ms = ms;
+        rec.field = f.bit;
+        rec.val_len = f.size;
+        rec.badge_len = badge_len;
+        memcpy(rec.old_val, from_bytes + f.offset, f.size);
+        memcpy(rec.new_val, to_bytes + f.offset, f.size);
+        memcpy(rec.badge_uid, badge_uid, sizeof(rec.badge_uid));
+        if (!appendLocked(rec)) {
+            break;  // flash trouble; later fields would fail the same way
+        }
+        ++recorded;
+    }
+    xSemaphoreGive(s_mutex_);
+    return recorded;
+}
+
+size_t audit::Count() noexcept
+{
+    if (s_part_ == nullptr) {
+        return 0;
+    }
+    xSemaphoreTake(s_mutex_, portMAX_DELAY);
+    const size_t n = s_flash_total_;
+    xSemaphoreGive(s_mutex_);
+    return n;
+}
+
+bool audit::ReadBack(size_t index_back, Record& out) noexcept
+{
+    if (s_part_ == nullptr) {
+        return false;
+    }
+    xSemaphoreTake(s_mutex_, portMAX_DELAY);
+
+    // Newest first: walk sectors backwards from the one being filled,
+    // bounded by the sector count (see run_db::ReadBack).
+    size_t idx = index_back;
+    size_t sector = (s_cur_sector_ + 1) % s_sector_count_total_;
+    for (size_t i = 0; i < s_sector_count_total_; ++i) {
+        sector = (sector + s_sector_count_total_ - 1) % s_sector_count_total_;
+        if (s_sector_seq_[sector] == 0) {
+            break;  // reached unwritten space; nothing older exists
+        }
+        const size_t used = s_sector_used_[sector];
+        if (idx < used) {
+            const size_t offset =
+                sector * SECTOR_SIZE_ + (1 + used - 1 - idx) * RECORD_SIZE_;
+            xSemaphoreGive(s_mutex_);  // flash read needs no bookkeeping
+            return esp_partition_read(s_part_, offset, &out, sizeof(out)) == ESP_OK;
+        }
+        idx -= used;
+    }
+    xSemaphoreGive(s_mutex_);
+    return false;
+}
+
+const char* audit::FieldName(uint16_t field) noexcept
+{
+    const FieldDesc* f = findField(field);
+    return (f != nullptr) ? f->name : "?";
+}
+
+void audit::FormatValue(uint16_t field, const uint8_t val[4],
+                        char* out, size_t cap) noexcept
+{
+    const FieldDesc* f = findField(field);
+    if (f == nullptr) {
+        snprintf(out, cap, "?");
+        return;
+    }
+    switch (f->type) {
+        case ValType::U32: {
+            uint32_t v = 0;
+            memcpy(&v, val, sizeof(v));
+            snprintf(out, cap, "%" PRIu32, v);
+            break;
+        }
+        case ValType::F32: {
+            float v = 0.0f;
+            memcpy(&v, val, sizeof(v));
+            snprintf(out, cap, "%.1f", static_cast<double>(v));
+            break;
+        }
+        case ValType::U8:
+            snprintf(out, cap, "%u", static_cast<unsigned>(val[0]));
+            break;
+        case ValType::I8:
+            snprintf(out, cap, "%d", static_cast<int>(static_cast<int8_t>(val[0])));
+            break;
+    }
+}
+
+void audit::DumpSerial() noexcept
+{
+    const size_t n = Count();
+    printf("audit: %u records\r\n", static_cast<unsigned>(n));
+    printf("change,uptime_s,field,old,new,badge\r\n");
+    char old_buf[16];
+    char new_buf[16];
+    for (size_t i = 0; i < n; ++i) {
+        Record r{};
+        if (!ReadBack(i, r)) {
+            break;
+        }
+        FormatValue(r.field, r.old_val, old_buf, sizeof(old_buf));
+        FormatValue(r.field, r.new_val, new_buf, sizeof(new_buf));
+        char badge[2 * sizeof(r.badge_uid) + 1] = "-";
+        if (r.badge_len > 0 && r.badge_len <= sizeof(r.badge_uid)) {
+            for (unsigned b = 0; b < r.badge_len; ++b) {
+                snprintf(badge + 2 * b, 3, "%02X", r.badge_uid[b]);
+            }
+        }
+        printf("%" PRIu32 ",%" PRIu32 ",%s,%s,%s,%s\r\n",
+               r.seq, r.ms / 1000U, FieldName(r.field), old_buf, new_buf, badge);
+    }
+}
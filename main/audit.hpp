@@ -0,0 +1,104 @@
+/**
+ * @file audit.hpp
+ * @brief Flash-backed settings audit trail (dedicated partition).
+ * @details Every applied config change appends one fixed 28-byte record
+ *          per changed field to the "auditlog" data partition, so quality
+ *          audits can answer "who changed AMAX and when" from the device
+ *          itself. Records carry the field's schema id (the ConfigDelta
+ *          CFG_FIELD_ bit), the raw old/new value bytes and the operator
+ *          badge present at save time; formatting is deferred to readback,
+ *          so recording a save costs a few partition writes, not a
+ *          formatting pass. Sector recycling follows the run_db circular
+ *          layout.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "protocol/fatigue_protocol.hpp"
+
+namespace audit {
+
+/**
+ * @brief One persisted change record (28-byte flash format)
+ * @details The layout is part of the on-flash format; seq is assigned by
+ *          the recorder and doubles as the erased-slot marker. Values are
+ *          stored as raw field bytes (val_len of them); FormatValue()
+ *          renders them using the schema table.
+ */
+struct Record {
+    uint32_t seq;          ///< Monotonic change number
+    uint32_t ms;           ///< Uptime when the change was applied
+    uint16_t field;        ///< Schema id (fatigue_proto CFG_FIELD_ bit)
+    uint8_t  val_len;      ///< Raw value width (1 or 4 bytes)
+    uint8_t  badge_len;    ///< Operator badge UID length (0 = unattributed)
+    uint8_t  old_val[4];   ///< Previous value, raw little-endian bytes
+    uint8_t  new_val[4];   ///< Applied value, raw little-endian bytes
+    uint8_t  badge_uid[7]; ///< Operator badge UID at save time (rfid_badge)
+    uint8_t  reserved;
+};
+static_assert(sizeof(Record) == 28, "record layout is part of the format");
+
+/**
+ * @brief Locate the auditlog partition and scan existing records
+ * @details Safe to call once at boot before any recording. If the
+ *          partition is missing the module degrades to a no-op (Count()
+ *          returns 0).
+ */
+void Init() noexcept;
+
+/**
+ * @brief Record an applied config change
+ * @details Walks the settings schema table and appends one record per
+ *          field that differs between @p from and @p to, all stamped with
+ *          the same timestamp and the current operator badge. A no-op
+ *          diff appends nothing.
+ * @param from Config before the save
+ * @param to Config as applied
+ * @param ms Uptime of the save (milliseconds)
+ * @return Number of field changes recorded
+ */
+size_t NoteConfigChange(const fatigue_proto::ConfigPayload& from,
+                        const fatigue_proto::ConfigPayload& to,
+                        uint32_t ms) noexcept;
+
+/**
+ * @brief Total change records stored, newest first
+ */
+size_t Count() noexcept;
+
+/**
+ * @brief Read the n-th record back from the newest
+ * @param index_back 0 = most recent change, Count()-1 = oldest retained
+ * @param out Receives the record
+ * @return true if the record exists and was read
+ */
+bool ReadBack(size_t index_back, Record& out) noexcept;
+
+/**
+ * @brief Short display name for a schema field id
+ * @param field CFG_FIELD_ bit from a record
+ * @return Static name ("vmax", "dwell", ...), "?" if unknown
+ */
+const char* FieldName(uint16_t field) noexcept;
+
+/**
+ * @brief Render a stored raw value for display
+ * @param field CFG_FIELD_ bit the value belongs to (selects the type)
+ * @param val Raw value bytes as stored in the record
+ * @param out Output buffer
+ * @param cap Capacity of @p out
+ */
+void FormatValue(uint16_t field, const uint8_t val[4],
+                 char* out, size_t cap) noexcept;
+
+/**
+ * @brief Dump every stored change to the serial console as CSV
+ * @details Newest first; header line plus one line per record, so the
+ *          output pastes straight into a spreadsheet.
+ */
+void DumpSerial() noexcept;
+
+} // namespace audit
@@ -0,0 +1,338 @@
+/**
+ * @file bench_main.cpp
+ * @brief On-device micro-benchmark suite for render and protocol hot paths
+ * @details Alternate app entry (APP_TYPE "bench", see app_config.yml) that
+ *          runs a scripted set of micro-benchmarks and prints one
+ *          machine-readable line per result over serial:
+ *
+ *              BENCH name=<id> iters=<n> total_us=<t> per_us=<t/n> [bytes_per_s=<b>]
+ *
+ *          bracketed by BENCH-REPORT-BEGIN/END markers so a host capture can
+ *          be diffed between runs with scripts/bench_diff.py. Covered:
+ *          page-shaped canvas composition, sprite push bandwidth,
+ *          crc16_ccitt throughput, ParseStatus/ParseStatusBatch/ParseConfig
+ *          rates, pairing HMAC cost and NVS settings save latency. The
+ *          firmware idles after the report; it is a measurement tool, not
+ *          an app.
+ */
+
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "nvs_flash.h"
+
+#include "M5Unified.h"
+
+#include "mem_budget.hpp"
+#include "settings.hpp"
+#include "protocol/espnow_protocol.hpp"
+#include "protocol/espnow_security.hpp"
+#include "protocol/fatigue_protocol.hpp"
+
+static const char* TAG_ = "bench";
+
+static LGFX_Sprite* s_canvas_ = nullptr;
+
+/**
+ * @brief Emit one result line in the machine-readable report format
+ * @param name Benchmark identifier (stable across releases; the diff keys on it)
+ * @param iters Iterations measured
+ * @param total_us Wall time for all iterations
+ * @param bytes Payload bytes processed in total, 0 if not a throughput bench
+ */
+static void report(const char* name, uint32_t iters, int64_t total_us, uint64_t bytes)
+{
+    const int64_t per_us = (iters > 0) ? total_us / iters : 0;
+    if (bytes > 0 && total_us > 0) {
+        const uint64_t bps = bytes * 1000000ULL / (uint64_t)total_us;
+        printf("BENCH name=%s iters=%" PRIu32 " total_us=%lld per_us=%lld bytes_per_s=%llu\n",
+               name, iters, (long long)total_us, (long long)per_us,
+               (unsigned long long)bps);
+    } else {
+        printf("BENCH name=%s iters=%" PRIu32 " total_us=%lld per_us=%lld\n",
+               name, iters, (long long)total_us, (long long)per_us);
+    }
+}
+
+// ============================================================================
+// RENDER BENCHMARKS
+// ============================================================================
+//
+// The UI pages are private to UiController, so these compose stand-in scenes
+// from the same primitive mix each page uses (ring arcs + icon circles for
+// the landing carousel, rounded cards + text for Settings, a large progress
+// arc + big digits for the Live Counter). Costs track the real pages closely
+// enough to catch primitive-level regressions in M5GFX or the flush path.
+
+/** @brief Landing-shaped scene: ring, icon discs, selector dot, labels */
+static void drawSceneLanding(uint32_t frame)
+{
+    s_canvas_->fillScreen(TFT_BLACK);
+    s_canvas_->drawArc(120, 120, 115, 115, 0, 360, 0x1084);
+    for (int i = 0; i < 6; ++i) {
+        const float a = (float)i * 1.047f + (float)(frame % 60) * 0.01f;
+        const int16_t x = 120 + (int16_t)(cosf(a) * 95.0f);
+        const int16_t y = 120 + (int16_t)(sinf(a) * 95.0f);
+        s_canvas_->fillSmoothCircle(x, y, 22, 0xFA00);
+    }
+    s_canvas_->fillSmoothCircle(120, 60, 5, 0xF3E9);
+    s_canvas_->setTextSize(2);
+    s_canvas_->setTextColor(TFT_WHITE);
+    s_canvas_->drawString("Bounds", 90, 110);
+}
+
+/** @brief Settings-shaped scene: four rounded cards with two text lines each */
+static void drawSceneSettings(uint32_t frame)
+{
+    s_canvas_->fillScreen(TFT_BLACK);
+    for (int i = 0; i < 4; ++i) {
+        const int16_t y = (int16_t)(44 + i * 44);
+        s_canvas_->fillRoundRect(25, y, 190, 40, 8, 0x18E3);
+        if ((int)(frame % 4) == i) {
+            s_canvas_->drawRoundRect(25, y, 190, 40, 8, 0xFA00);
+        }
+        s_canvas_->setTextSize(2);
+        s_canvas_->setTextColor(TFT_WHITE);
+        s_canvas_->drawString("Cycles", 39, y + 4);
+        s_canvas_->setTextSize(1);
+        s_canvas_->setTextColor(0x9CD3);
+        s_canvas_->drawString("1000", 39, y + 26);
+    }
+    s_canvas_->setTextSize(2);
+    s_canvas_->drawString("SETTINGS", 75, 14);
+}
+
+/** @brief Live-counter-shaped scene: progress arc plus large digits */
+static void drawSceneCounter(uint32_t frame)
+{
+    s_canvas_->fillScreen(TFT_BLACK);
+    const int32_t sweep = (int32_t)(frame * 7 % 360);
+    s_canvas_->drawArc(120, 120, 110, 102, 0, 360, 0x1084);
+    s_canvas_->drawArc(120, 120, 110, 102, 270, 270 + sweep, 0x04FF);
+    s_canvas_->setTextSize(5);
+    s_canvas_->setTextColor(TFT_WHITE);
+    s_canvas_->drawString("12345", 50, 95);
+    s_canvas_->setTextSize(1);
+    s_canvas_->setTextColor(0x9CD3);
+    s_canvas_->drawString("60.0 /min  ETA 2m30s", 60, 150);
+}
+
+static void benchRender()
+{
+    constexpr uint32_t kFrames = 60;
+
+    struct Scene {
+        const char* name;
+        void (*draw)(uint32_t);
+    };
+    const Scene scenes[] = {
+        {"draw_page_landing", drawSceneLanding},
+        {"draw_page_settings", drawSceneSettings},
+        {"draw_page_counter", drawSceneCounter},
+    };
+    for (const Scene& s : scenes) {
+        const int64_t t0 = esp_timer_get_time();
+        for (uint32_t f = 0; f < kFrames; ++f) {
+            s.draw(f);
+        }
+        report(s.name, kFrames, esp_timer_get_time() - t0, 0);
+    }
+
+    // Sprite push bandwidth: full 240x240 16-bit frame to the panel.
+    constexpr uint32_t kPushes = 30;
+    const uint64_t frame_bytes = 240ULL * 240ULL * 2ULL;
+    const int64_t t0 = esp_timer_get_time();
+    for (uint32_t f = 0; f < kPushes; ++f) {
+        s_canvas_->pushSprite(0, 0);
+    }
+    M5.Display.waitDMA();
+    report("sprite_push_full", kPushes, esp_timer_get_time() - t0,
+           frame_bytes * kPushes);
+}
+
+// ============================================================================
+// PROTOCOL BENCHMARKS
+// ============================================================================
+
+static void benchCrc16()
+{
+    constexpr uint32_t kIters = 2000;
+    constexpr size_t kLen = sizeof(espnow::EspNowHeader) + espnow::MAX_PAYLOAD_SIZE_;
+    uint8_t buf[kLen];
+    for (size_t i = 0; i < kLen; ++i) {
+        buf[i] = (uint8_t)(i * 31u);
+    }
+    volatile uint16_t sink = 0;
+    const int64_t t0 = esp_timer_get_time();
+    for (uint32_t i = 0; i < kIters; ++i) {
+        sink = sink ^ espnow::crc16_ccitt(buf, kLen);
+    }
+    report("crc16_ccitt", kIters, esp_timer_get_time() - t0,
+           (uint64_t)kLen * kIters);
+    (void)sink;
+}
+
+static void benchParsers()
+{
+    constexpr uint32_t kIters = 5000;
+
+    // Both parser paths are measured: "parse_*" hits the aligned in-place
+    // fast path (the case every pooled receive buffer takes, see RawMsg),
+    // "parse_*_unaligned" forces the memcpy fallback with a one-byte skew.
+    fatigue_proto::StatusPayload status{};
+    status.cycle_number = 12345;
+    status.state = (uint8_t)fatigue_proto::TestState::Running;
+    alignas(4) uint8_t status_wire[sizeof(status) + 1];
+    std::memcpy(status_wire, &status, sizeof(status));
+    std::memcpy(status_wire + 1, &status, sizeof(status));
+
+    fatigue_proto::StatusPayload status_out{};
+    int64_t t0 = esp_timer_get_time();
+    for (uint32_t i = 0; i < kIters; ++i) {
+        (void)fatigue_proto::ParseStatus(status_wire, sizeof(status), status_out);
+    }
+    report("parse_status", kIters, esp_timer_get_time() - t0,
+           (uint64_t)sizeof(status) * kIters);
+
+    t0 = esp_timer_get_time();
+    for (uint32_t i = 0; i < kIters; ++i) {
+        (void)fatigue_proto::ParseStatus(status_wire + 1, sizeof(status), status_out);
+    }
+    report("parse_status_unaligned", kIters, esp_timer_get_time() - t0,
+           (uint64_t)sizeof(status) * kIters);
+
+    Settings defaults{};
+    const fatigue_proto::ConfigPayload config =
+        fatigue_proto::BuildConfigPayload(defaults);
+    alignas(4) uint8_t config_wire[sizeof(config) + 1];
+    std::memcpy(config_wire, &config, sizeof(config));
+    std::memcpy(config_wire + 1, &config, sizeof(config));
+
+    fatigue_proto::ConfigPayload config_out{};
+    t0 = esp_timer_get_time();
+    for (uint32_t i = 0; i < kIters; ++i) {
+        (void)fatigue_proto::ParseConfig(config_wire, sizeof(config), config_out);
+    }
+    report("parse_config", kIters, esp_timer_get_time() - t0,
+           (uint64_t)sizeof(config) * kIters);
+
+    t0 = esp_timer_get_time();
+    for (uint32_t i = 0; i < kIters; ++i) {
+        (void)fatigue_proto::ParseConfig(config_wire + 1, sizeof(config), config_out);
+    }
+    report("parse_config_unaligned", kIters, esp_timer_get_time() - t0,
+           (uint64_t)sizeof(config) * kIters);
+}
+
+static void benchHmac()
+{
+    constexpr uint32_t kIters = 200;
+    uint8_t msg[CHALLENGE_SIZE + MAX_DEVICE_NAME_LEN] = {0x5A};
+    uint8_t mac[HMAC_SIZE];
+    const int64_t t0 = esp_timer_get_time();
+    for (uint32_t i = 0; i < kIters; ++i) {
+        ComputePairingHmac(msg, sizeof(msg), mac);
+    }
+    report("pairing_hmac", kIters, esp_timer_get_time() - t0,
+           (uint64_t)sizeof(msg) * kIters);
+}
+
+// ============================================================================
+// STORAGE BENCHMARKS
+// ============================================================================
+
+static void benchNvsSave()
+{
+    Settings s = SettingsStore::Load();
+
+    // First save migrates/initializes the section keys; measure steady state
+    // by alternating a field so every timed Save() commits a dirty section.
+    s.test_unit.cycle_amount ^= 1U;
+    (void)SettingsStore::Save(s);
+
+    constexpr uint32_t kIters = 8;
+    const int64_t t0 = esp_timer_get_time();
+    for (uint32_t i = 0; i < kIters; ++i) {
+        s.test_unit.cycle_amount ^= 1U;
+        (void)SettingsStore::Save(s);
+    }
+    report("nvs_settings_save", kIters, esp_timer_get_time() - t0, 0);
+}
+
+// ============================================================================
+// MEMORY BUDGET REPORT
+// ============================================================================
+
+/**
+ * @brief Report the memory split through the same regression gate
+ * @details Byte counts ride in the per_us field: bench_diff.py only
+ *          compares per_us, so a static footprint or heap floor that
+ *          grows past the threshold fails the run exactly like a slow
+ *          parser. "Free" floors are reported as consumption (total -
+ *          free) so growth is always the failing direction.
+ */
+static void benchMemBudget()
+{
+    mem_budget::Splits s{};
+    mem_budget::Get(s);
+    report("mem_static_data", 1, static_cast<int64_t>(s.data_bytes), 0);
+    report("mem_static_bss", 1, static_cast<int64_t>(s.bss_bytes), 0);
+    report("mem_internal_used", 1,
+           static_cast<int64_t>(s.internal_total - s.internal_free), 0);
+    report("mem_internal_peak", 1,
+           static_cast<int64_t>(s.internal_total - s.internal_min_free), 0);
+    if (s.psram_total > 0) {
+        report("mem_psram_used", 1,
+               static_cast<int64_t>(s.psram_total - s.psram_free), 0);
+    }
+}
+
+/**
+ * @brief Benchmark entry point: run the suite once, print the report, idle
+ */
+extern "C" void app_main(void)
+{
+    esp_err_t nvs_err = nvs_flash_init();
+    if (nvs_err == ESP_ERR_NVS_NO_FREE_PAGES || nvs_err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        ESP_ERROR_CHECK(nvs_flash_erase());
+        nvs_err = nvs_flash_init();
+    }
+    if (nvs_err != ESP_OK) {
+        ESP_LOGE(TAG_, "NVS init failed: %s", esp_err_to_name(nvs_err));
+    }
+    (void)SettingsStore::Init();
+
+    auto cfg = M5.config();
+    cfg.fallback_board = m5gfx::board_t::board_M5Dial;
+    cfg.clear_display = true;
+    M5.begin(cfg);
+    M5.Display.setBrightness(32);
+
+    s_canvas_ = new LGFX_Sprite(&M5.Display);
+    s_canvas_->setColorDepth(16);
+    if (s_canvas_->createSprite(240, 240) == nullptr) {
+        ESP_LOGE(TAG_, "Canvas allocation failed; render benches skipped");
+    }
+
+    printf("BENCH-REPORT-BEGIN v1\n");
+    if (s_canvas_->getBuffer() != nullptr) {
+        benchRender();
+    }
+    benchCrc16();
+    benchParsers();
+    benchHmac();
+    benchNvsSave();
+    benchMemBudget();
+    printf("BENCH-REPORT-END\n");
+
+    ESP_LOGI(TAG_, "Benchmark complete");
+    while (true) {
+        vTaskDelay(pdMS_TO_TICKS(1000));
+    }
+}
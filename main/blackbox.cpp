@@ -0,0 +1,146 @@
+/**
+ * @file blackbox.cpp
+ * @brief Crash-safe black-box recorder implementation.
+ */
+
+#include "blackbox.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "session_log.hpp"
+
+namespace {
+
+constexpr const char* TAG_ = "blackbox";
+
+constexpr uint32_t RING_MAGIC_ = 0x58424B42;  // "BKBX"
+constexpr size_t RING_DEPTH_ = 64;            ///< Entries kept per session
+
+/**
+ * @brief One ring entry (8 bytes)
+ */
+struct Entry {
+    uint32_t ms;            ///< Uptime at record time (milliseconds)
+    blackbox::Kind kind;    ///< Event kind
+    uint8_t a;              ///< Kind-specific detail
+    uint16_t b;             ///< Kind-specific extra
+};
+static_assert(sizeof(Entry) == 8, "Entry must stay 8 bytes");
+
+/**
+ * @brief The RTC-resident ring
+ * @details head counts total writes this session; the slot index is
+ *          head % RING_DEPTH_. A simple magic marks the ring valid — RTC
+ *          noinit RAM is garbage after power loss, and esp_reset_reason()
+ *          distinguishes that case anyway.
+ */
+struct RtcRing {
+    uint32_t magic;
+    uint32_t head;
+    Entry entries[RING_DEPTH_];
+};
+
+RTC_NOINIT_ATTR RtcRing s_ring_;
+
+portMUX_TYPE s_ring_lock_ = portMUX_INITIALIZER_UNLOCKED;
+bool s_armed_ = false;
+
+/**
+ * @brief Short tag for an entry kind in the dump
+ */
+const char* kindName_(blackbox::Kind kind)
+{
+    switch (kind) {
+        case blackbox::Kind::Boot:
+            return "boot";
+        case blackbox::Kind::RxMsg:
+            return "rx";
+        case blackbox::Kind::TxCmd:
+            return "tx";
+        case blackbox::Kind::Page:
+            return "page";
+        case blackbox::Kind::Conn:
+            return "conn";
+        case blackbox::Kind::Health:
+            return "slo";
+        default:
+            return "?";
+    }
+}
+
+/**
+ * @brief Replay the previous session's ring into the logs
+ */
+void dumpPreviousSession_(esp_reset_reason_t reason)
+{
+    const uint32_t count = (s_ring_.head < RING_DEPTH_) ? s_ring_.head : RING_DEPTH_;
+    const uint32_t now_ms = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+
+    char line[session_log::MAX_TEXT];
+    snprintf(line, sizeof(line), "BB: reset reason=%d, %" PRIu32 " events",
+             static_cast<int>(reason), count);
+    ESP_LOGW(TAG_, "%s", line);
+    session_log::Append(now_ms, line);
+
+    // Oldest first; timestamps are the previous session's uptime.
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint32_t slot = (s_ring_.head - count + i) % RING_DEPTH_;
+        const Entry& e = s_ring_.entries[slot];
+        if (e.kind == blackbox::Kind::None) {
+            continue;
+        }
+        snprintf(line, sizeof(line), "BB: +%" PRIu32 ".%03" PRIu32 "s %s a=%u b=%u",
+                 e.ms / 1000U, e.ms % 1000U, kindName_(e.kind),
+                 static_cast<unsigned>(e.a), static_cast<unsigned>(e.b));
+        ESP_LOGW(TAG_, "%s", line);
+        session_log::Append(now_ms, line);
+    }
+}
+
+} // namespace
+
+void blackbox::Init() noexcept
+{
+    const esp_reset_reason_t reason = esp_reset_reason();
+
+    // Power-on leaves RTC RAM undefined; anything else preserved it, and a
+    // valid magic means the previous session left evidence worth replaying.
+    if (reason != ESP_RST_POWERON && reason != ESP_RST_UNKNOWN &&
+        s_ring_.magic == RING_MAGIC_ && s_ring_.head > 0) {
+        dumpPreviousSession_(reason);
+    } else {
+        ESP_LOGI(TAG_, "reset reason=%d, no prior session", static_cast<int>(reason));
+    }
+
+    std::memset(&s_ring_, 0, sizeof(s_ring_));
+    s_ring_.magic = RING_MAGIC_;
+    s_armed_ = true;
+
+    Note(Kind::Boot, static_cast<uint8_t>(reason));
+}
+
+void blackbox::Note(Kind kind, uint8_t a, uint16_t b) noexcept
+{
+    if (!s_armed_) {
+        return;
+    }
+    const uint32_t ms = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+    taskENTER_CRITICAL(&s_ring_lock_);
+    Entry& e = s_ring_.entries[s_ring_.head % RING_DEPTH_];
+    e.ms = ms;
+    e.kind = kind;
+    e.a = a;
+    e.b = b;
+    ++s_ring_.head;
+    taskEXIT_CRITICAL(&s_ring_lock_);
+}
@@ -0,0 +1,49 @@
+/**
+ * @file blackbox.hpp
+ * @brief Crash-safe black-box recorder (RTC-noinit event ring).
+ * @details Records a small ring of recent events — protocol traffic,
+ *          commands sent, UI page and connection transitions — in RTC
+ *          noinit RAM, which survives watchdog resets, panics and
+ *          brownouts (but not power loss). On the next boot the previous
+ *          session's ring is dumped together with esp_reset_reason() into
+ *          the console log and the flash session log, so a mystery reboot
+ *          in the field arrives with the context that preceded it.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace blackbox {
+
+/**
+ * @brief What a ring entry records
+ */
+enum class Kind : uint8_t {
+    None = 0,   ///< Empty slot
+    Boot,       ///< Session start (a = reset reason)
+    RxMsg,      ///< Protocol message received (a = MsgType, b = payload len)
+    TxCmd,      ///< Reliable packet sent (a = MsgType, b = command id / len)
+    Page,       ///< UI page change (a = new Page)
+    Conn,       ///< Connection status change (a = new ConnStatus)
+    Health,     ///< Sustained task budget breach (a = health::Task, b = ms)
+};
+
+/**
+ * @brief Validate the ring, dump the previous session, re-arm
+ * @details Call once at boot after session_log::Init(). If the reset was
+ *          not a cold power-on and the ring carries a valid previous
+ *          session, its entries are replayed into the console log and the
+ *          flash session log before the ring is cleared for this session.
+ */
+void Init() noexcept;
+
+/**
+ * @brief Record one event (cheap: a few RTC RAM writes under a spinlock)
+ * @param kind Event kind
+ * @param a Kind-specific detail (message type, page, status, ...)
+ * @param b Kind-specific extra (payload length, command id, ...)
+ */
+void Note(Kind kind, uint8_t a, uint16_t b = 0) noexcept;
+
+} // namespace blackbox
@@ -43,3 +43,21 @@ static constexpr gpio_num_t DIAL_ENCODER_PIN_SW_ = GPIO_NUM_NC;
  * @details Used for UI feel; component uses detents.
  */
 static constexpr uint8_t ENCODER_PULSES_PER_REV_ = 20;
+
+/**
+ * @brief RFID reader (WS1850S) interrupt pin
+ * @details Active low. The stock M5Dial does not route the reader's IRQ
+ *          line to the StampS3, so this defaults to NC and the badge task
+ *          waits on the chip's internal timeout timer instead. Reworked
+ *          units that wire the line get true event-driven scans by setting
+ *          the GPIO here.
+ */
+static constexpr gpio_num_t DIAL_RFID_IRQ_PIN_ = GPIO_NUM_NC;
+
+/**
+ * @brief Capacitive touch controller (FT3267) interrupt pin
+ * @details Active low. M5Unified polls touch over I2C, but the INT line is
+ *          armed as a light-sleep wake source by the power governor so a
+ *          tap wakes the dial instantly.
+ */
+static constexpr gpio_num_t DIAL_TOUCH_INT_PIN_ = GPIO_NUM_14;
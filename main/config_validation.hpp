@@ -0,0 +1,167 @@
+/**
+ * @file config_validation.hpp
+ * @brief Table-driven config validation (per-field ranges + cross-field rules).
+ * @details A mistyped VMAX goes straight to the TMC5160 unless something in
+ *          between knows 600 RPM is not a speed this fixture survives. Every
+ *          ConfigSet/ConfigDelta funnels through Validate() before it is
+ *          sent: per-field ranges come from a constexpr table keyed to the
+ *          ConfigPayload schema, cross-field constraints (AMAX able to reach
+ *          VMAX, StallGuard floor below the search velocity) are checked
+ *          after. Header-only and evaluated only when an editor commits a
+ *          value — nothing here runs per frame. The editors use the same
+ *          table to paint an out-of-range value red while it is being
+ *          dialed in.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "protocol/fatigue_protocol.hpp"
+
+namespace config_check {
+
+/**
+ * @brief One validation finding
+ * @details Both strings are literals with static lifetime, safe to hand to
+ *          the deferred-format UI log.
+ */
+struct Violation {
+    const char* name;  ///< Field (or rule) display name
+    const char* rule;  ///< What was violated, operator-readable
+};
+
+/**
+ * @brief Identifies a ConfigPayload field in the rule table
+ */
+enum class Field : uint8_t {
+    CycleAmount,
+    Vmax,
+    Amax,
+    Dwell,
+    BoundsVel,
+    SgMinVel,
+    StallFactor,
+    BoundsAccel,
+};
+
+/**
+ * @brief Per-field range rule
+ * @details Optional fields use 0 as the "unit default" sentinel and skip the
+ *          range check at exactly 0. Limits are fixture limits, not motor
+ *          driver limits: the TMC5160 would happily accept more.
+ */
+struct FieldRule {
+    Field field;
+    const char* name;   ///< Display name (matches the editor labels)
+    float min;          ///< Lowest accepted value
+    float max;          ///< Highest accepted value
+    bool optional;      ///< 0 means "use unit default", always valid
+    float (*get)(const fatigue_proto::ConfigPayload&);  ///< Field accessor
+};
+
+namespace detail {
+constexpr float getCycles(const fatigue_proto::ConfigPayload& p) { return static_cast<float>(p.cycle_amount); }
+constexpr float getVmax(const fatigue_proto::ConfigPayload& p) { return p.oscillation_vmax_rpm; }
+constexpr float getAmax(const fatigue_proto::ConfigPayload& p) { return p.oscillation_amax_rev_s2; }
+constexpr float getDwell(const fatigue_proto::ConfigPayload& p) { return static_cast<float>(p.dwell_time_ms); }
+constexpr float getBoundsVel(const fatigue_proto::ConfigPayload& p) { return p.bounds_search_velocity_rpm; }
+constexpr float getSgMinVel(const fatigue_proto::ConfigPayload& p) { return p.stallguard_min_velocity_rpm; }
+constexpr float getStallFactor(const fatigue_proto::ConfigPayload& p) { return p.stall_detection_current_factor; }
+constexpr float getBoundsAccel(const fatigue_proto::ConfigPayload& p) { return p.bounds_search_accel_rev_s2; }
+} // namespace detail
+
+/// Slowest full spin-up the oscillation profile tolerates (cross-field rule)
+inline constexpr float kMaxSpinupS = 5.0f;
+
+/**
+ * @brief The schema rule table (cycle_amount 0 = infinite is deliberate)
+ */
+inline constexpr FieldRule kRules[] = {
+    { Field::CycleAmount, "Cycles",       0.0f, 10000000.0f, false, detail::getCycles },
+    { Field::Vmax,        "VMAX",         1.0f, 240.0f,      false, detail::getVmax },
+    { Field::Amax,        "AMAX",         0.5f, 50.0f,       false, detail::getAmax },
+    { Field::Dwell,       "Dwell",        0.0f, 60000.0f,    false, detail::getDwell },
+    { Field::BoundsVel,   "Search Speed", 0.5f, 120.0f,      true,  detail::getBoundsVel },
+    { Field::SgMinVel,    "SG Min Vel",   0.5f, 60.0f,       true,  detail::getSgMinVel },
+    { Field::StallFactor, "Stall Factor", 0.1f, 2.0f,        true,  detail::getStallFactor },
+    { Field::BoundsAccel, "Search Accel", 0.5f, 50.0f,       true,  detail::getBoundsAccel },
+};
+
+/**
+ * @brief Range-check a single value against one field's rule
+ * @details Used by the editors to highlight a value while it is dialed in;
+ *          the full Validate() still gates the send.
+ * @param field Field being edited
+ * @param value Candidate value, in the field's ConfigPayload unit
+ * @return true if the value would pass the range rule
+ */
+constexpr bool InRange(Field field, float value) noexcept
+{
+    for (const FieldRule& r : kRules) {
+        if (r.field == field) {
+            if (r.optional && value == 0.0f) {
+                return true;
+            }
+            return value >= r.min && value <= r.max;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Validate a config payload against the schema
+ * @details Range rules first, then cross-field constraints. SGT lives
+ *          outside the float table: valid range [-64, 63] with 127 as the
+ *          "unit default" sentinel.
+ * @param p Payload about to be sent
+ * @param out Receives up to @p cap findings
+ * @param cap Capacity of @p out
+ * @return Total violations found (may exceed @p cap; only @p cap written)
+ */
+inline size_t Validate(const fatigue_proto::ConfigPayload& p,
+                       Violation* out, size_t cap) noexcept
+{
+    size_t count = 0;
+    const auto add = [&](const char* name, const char* rule) {
+        if (count < cap) {
+            out[count] = Violation{name, rule};
+        }
+        ++count;
+    };
+
+    for (const FieldRule& r : kRules) {
+        const float v = r.get(p);
+        if (r.optional && v == 0.0f) {
+            continue;
+        }
+        if (v < r.min) {
+            add(r.name, "below minimum");
+        } else if (v > r.max) {
+            add(r.name, "above maximum");
+        }
+    }
+
+    if (p.stallguard_sgt != 127 && (p.stallguard_sgt < -64 || p.stallguard_sgt > 63)) {
+        add("SGT", "outside [-64, 63]");
+    }
+
+    // Cross-field: the acceleration must reach VMAX within kMaxSpinupS, or
+    // the profile never hits its commanded speed and the cycle rate lies.
+    if (p.oscillation_amax_rev_s2 > 0.0f &&
+        p.oscillation_amax_rev_s2 * kMaxSpinupS < p.oscillation_vmax_rpm / 60.0f) {
+        add("AMAX", "too low to reach VMAX");
+    }
+
+    // Cross-field: StallGuard is blind below its minimum velocity, so the
+    // floor must stay under the speed the bounds search actually runs at.
+    if (p.stallguard_min_velocity_rpm > 0.0f && p.bounds_search_velocity_rpm > 0.0f &&
+        p.stallguard_min_velocity_rpm >= p.bounds_search_velocity_rpm) {
+        add("SG Min Vel", "at or above Search Speed");
+    }
+
+    return count;
+}
+
+} // namespace config_check
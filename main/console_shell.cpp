@@ -0,0 +1,345 @@
+/**
+ * @file console_shell.cpp
+ * @brief Diagnostics command shell implementation.
+ */
+
+#include "console_shell.hpp"
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "audit.hpp"
+#include "mem_budget.hpp"
+#include "queue_stats.hpp"
+#include "run_db.hpp"
+#include "self_test.hpp"
+#include "trace.hpp"
+#include "protocol/espnow_protocol.hpp"
+#include "protocol/wire_capture.hpp"
+
+namespace {
+
+const char* TAG_ = "shell";
+
+constexpr size_t MAX_COMMANDS_ = 16;
+constexpr size_t LINE_MAX_ = 96;
+constexpr int ARGV_MAX_ = 8;
+// Yield cadence for paced output: enough lines to keep a dump brisk,
+// short enough that the console FIFO drains between bursts.
+constexpr uint32_t PACE_EVERY_ = 8;
+
+struct Command {
+    const char* name;
+    const char* help;
+    console_shell::CommandFn fn;
+};
+
+Command s_commands_[MAX_COMMANDS_];
+size_t s_command_count_ = 0;
+
+char s_line_[LINE_MAX_];
+size_t s_fill_ = 0;
+uint32_t s_paced_lines_ = 0;
+
+void prompt() noexcept
+{
+    fputs("dial> ", stdout);
+    fflush(stdout);
+}
+
+const Command* findCommand(const char* name) noexcept
+{
+    for (size_t i = 0; i < s_command_count_; ++i) {
+        if (strcmp(s_commands_[i].name, name) == 0) {
+            return &s_commands_[i];
+        }
+    }
+    return nullptr;
+}
+
+/** @brief Complete the current line against the command table. */
+void complete() noexcept
+{
+    s_line_[s_fill_] = '\0';
+    // Only the command word completes; arguments are subsystem-specific.
+    if (memchr(s_line_, ' ', s_fill_) != nullptr) {
+        return;
+    }
+    const Command* match = nullptr;
+    size_t matches = 0;
+    for (size_t i = 0; i < s_command_count_; ++i) {
+        if (strncmp(s_commands_[i].name, s_line_, s_fill_) == 0) {
+            match = &s_commands_[i];
+            ++matches;
+        }
+    }
+    if (matches == 1) {
+        // Unique: type the rest for the operator, plus a separating space.
+        const char* rest = match->name + s_fill_;
+        while (*rest != '\0' && s_fill_ < LINE_MAX_ - 2) {
+            s_line_[s_fill_++] = *rest;
+            putchar(*rest++);
+        }
+        s_line_[s_fill_++] = ' ';
+        putchar(' ');
+        fflush(stdout);
+    } else if (matches > 1) {
+        // Ambiguous: list the candidates, then redraw the line.
+        putchar('\n');
+        for (size_t i = 0; i < s_command_count_; ++i) {
+            if (strncmp(s_commands_[i].name, s_line_, s_fill_) == 0) {
+                printf("  %s\n", s_commands_[i].name);
+            }
+        }
+        prompt();
+        fwrite(s_line_, 1, s_fill_, stdout);
+        fflush(stdout);
+    }
+}
+
+/** @brief Tokenize and run the accumulated line. */
+void dispatch() noexcept
+{
+    s_line_[s_fill_] = '\0';
+    s_fill_ = 0;
+    putchar('\n');
+
+    const char* argv[ARGV_MAX_];
+    int argc = 0;
+    char* p = s_line_;
+    while (*p != '\0' && argc < ARGV_MAX_) {
+        while (*p == ' ') {
+            *p++ = '\0';
+        }
+        if (*p == '\0') {
+            break;
+        }
+        argv[argc++] = p;
+        while (*p != '\0' && *p != ' ') {
+            ++p;
+        }
+    }
+    if (argc == 0) {
+        prompt();
+        return;
+    }
+
+    const Command* cmd = findCommand(argv[0]);
+    if (cmd == nullptr) {
+        printf("unknown command '%s' (try 'help')\n", argv[0]);
+        prompt();
+        return;
+    }
+    s_paced_lines_ = 0;
+    cmd->fn(argc, argv);
+    fflush(stdout);
+    prompt();
+}
+
+// ============================================================================
+// BUILT-IN COMMANDS
+// ============================================================================
+
+void cmdHelp(int, const char* const*) noexcept
+{
+    for (size_t i = 0; i < s_command_count_; ++i) {
+        console_shell::Line("  %-10s %s", s_commands_[i].name, s_commands_[i].help);
+    }
+}
+
+void cmdMem(int, const char* const*) noexcept
+{
+    mem_budget::Splits s{};
+    mem_budget::Get(s);
+    console_shell::Line("static:   data %u B, bss %u B",
+                        static_cast<unsigned>(s.data_bytes),
+                        static_cast<unsigned>(s.bss_bytes));
+    console_shell::Line("internal: %u/%u KB free, floor %u KB, DMA block %u KB",
+                        static_cast<unsigned>(s.internal_free / 1024),
+                        static_cast<unsigned>(s.internal_total / 1024),
+                        static_cast<unsigned>(s.internal_min_free / 1024),
+                        static_cast<unsigned>(s.dma_largest / 1024));
+    if (s.psram_total > 0) {
+        console_shell::Line("psram:    %u/%u KB free",
+                            static_cast<unsigned>(s.psram_free / 1024),
+                            static_cast<unsigned>(s.psram_total / 1024));
+    }
+}
+
+void cmdLink(int, const char* const*) noexcept
+{
+    espnow::LinkStats ls{};
+    espnow::GetLinkStats(ls);
+    console_shell::Line("tracked %lu acked %lu lost %lu retx %lu",
+                        static_cast<unsigned long>(ls.tracked_sent),
+                        static_cast<unsigned long>(ls.acked),
+                        static_cast<unsigned long>(ls.lost),
+                        static_cast<unsigned long>(ls.retransmits));
+    console_shell::Line("rx: dup %lu reorder %lu shed %lu",
+                        static_cast<unsigned long>(ls.rx_duplicates),
+                        static_cast<unsigned long>(ls.rx_reordered),
+                        static_cast<unsigned long>(ls.rx_shed));
+    for (size_t i = 0; i < espnow::LinkStats::HIST_BUCKETS; ++i) {
+        if (ls.hist[i] > 0) {
+            console_shell::Line("rtt <%4u ms: %lu", 2u << i,
+                                static_cast<unsigned long>(ls.hist[i]));
+        }
+    }
+}
+
+void cmdRx(int, const char* const*) noexcept
+{
+    espnow::RxRejectStats rs{};
+    espnow::GetRxRejectStats(rs);
+    console_shell::Line(
+        "runt %lu sync %lu ver %lu len %lu crc %lu unapproved %lu payload %lu",
+        static_cast<unsigned long>(rs.runt), static_cast<unsigned long>(rs.bad_sync),
+        static_cast<unsigned long>(rs.bad_version),
+        static_cast<unsigned long>(rs.bad_length), static_cast<unsigned long>(rs.bad_crc),
+        static_cast<unsigned long>(rs.unapproved),
+        static_cast<unsigned long>(rs.bad_payload));
+}
+
+void cmdPeers(int, const char* const*) noexcept
+{
+    espnow::PresenceEntry entries[8];
+    const size_t n = espnow::GetPresence(entries, 8);
+    if (n == 0) {
+        console_shell::Line("no peers heard");
+        return;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        const espnow::PresenceEntry& e = entries[i];
+        console_shell::Line("%02X:%02X:%02X:%02X:%02X:%02X dev=%u age=%lums %s",
+                            e.mac[0], e.mac[1], e.mac[2], e.mac[3], e.mac[4], e.mac[5],
+                            e.device_id, static_cast<unsigned long>(e.age_ms),
+                            e.name[0] != '\0' ? e.name : "-");
+    }
+}
+
+void cmdQueues(int, const char* const*) noexcept
+{
+    queue_stats::DumpSerial();
+}
+
+void cmdTrace(int, const char* const*) noexcept
+{
+    trace::Dump();
+}
+
+void cmdJobs(int, const char* const*) noexcept
+{
+    espnow::DumpPeriodicJobs();
+}
+
+void cmdAudit(int, const char* const*) noexcept
+{
+    audit::DumpSerial();
+}
+
+void cmdRuns(int, const char* const*) noexcept
+{
+    run_db::DumpSerial();
+}
+
+void cmdSelfTest(int, const char* const*) noexcept
+{
+    self_test::DumpSerial();
+}
+
+void cmdWirecap(int argc, const char* const* argv) noexcept
+{
+    if (argc < 2) {
+        console_shell::Line("wirecap %s (on|off|dump|clear)",
+                            wire_capture::Armed() ? "armed" : "disarmed");
+        return;
+    }
+    if (strcmp(argv[1], "on") == 0) {
+        wire_capture::SetArmed(true);
+    } else if (strcmp(argv[1], "off") == 0) {
+        wire_capture::SetArmed(false);
+    } else if (strcmp(argv[1], "dump") == 0) {
+        wire_capture::DumpSerial();
+    } else if (strcmp(argv[1], "clear") == 0) {
+        wire_capture::Clear();
+    } else {
+        console_shell::Line("usage: wirecap [on|off|dump|clear]");
+    }
+}
+
+}  // namespace
+
+bool console_shell::Register(const char* name, const char* help, CommandFn fn) noexcept
+{
+    if (name == nullptr || fn == nullptr || s_command_count_ >= MAX_COMMANDS_) {
+        return false;
+    }
+    s_commands_[s_command_count_++] = Command{name, help, fn};
+    return true;
+}
+
+void console_shell::Line(const char* fmt, ...) noexcept
+{
+    va_list args;
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+    putchar('\n');
+    if (++s_paced_lines_ % PACE_EVERY_ == 0) {
+        fflush(stdout);
+        vTaskDelay(1);
+    }
+}
+
+void console_shell::FeedByte(uint8_t byte) noexcept
+{
+    switch (byte) {
+        case '\r':
+        case '\n':
+            dispatch();
+            return;
+        case '\t':
+            complete();
+            return;
+        case 0x08:  // Backspace / DEL
+        case 0x7F:
+            if (s_fill_ > 0) {
+                --s_fill_;
+                fputs("\b \b", stdout);
+                fflush(stdout);
+            }
+            return;
+        default:
+            break;
+    }
+    if (byte < 0x20 || byte >= 0x7F) {
+        return;  // Other control bytes: console noise, not typing
+    }
+    if (s_fill_ < LINE_MAX_ - 1) {
+        s_line_[s_fill_++] = static_cast<char>(byte);
+        putchar(byte);
+        fflush(stdout);
+    }
+}
+
+void console_shell::Init() noexcept
+{
+    Register("help", "list commands", cmdHelp);
+    Register("mem", "memory split and heap floors", cmdMem);
+    Register("link", "command/ack link stats and RTT histogram", cmdLink);
+    Register("rx", "frame rejection counters", cmdRx);
+    Register("peers", "peer presence table", cmdPeers);
+    Register("queues", "queue depth high-water marks", cmdQueues);
+    Register("trace", "dump the trace ring", cmdTrace);
+    Register("jobs", "periodic job scheduler state", cmdJobs);
+    Register("audit", "settings change history", cmdAudit);
+    Register("runs", "persisted run records", cmdRuns);
+    Register("selftest", "power-on self-test results", cmdSelfTest);
+    Register("wirecap", "conformance frame capture (on|off|dump|clear)", cmdWirecap);
+    ESP_LOGI(TAG_, "%u commands registered", static_cast<unsigned>(s_command_count_));
+}
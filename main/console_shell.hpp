@@ -0,0 +1,62 @@
+/**
+ * @file console_shell.hpp
+ * @brief Diagnostics command shell on the USB console.
+ * @details A line-oriented shell sharing the console with log output and
+ *          the provisioning frame protocol: the provisioning listener owns
+ *          stdin and hands plain-text bytes here (COBS frames are 0x00
+ *          delimited and never look like typed text). Commands register a
+ *          name, a one-line help string and a handler; the shell adds line
+ *          editing, tab completion and paced output, and executes handlers
+ *          on the listener's low-priority task so a dump never perturbs
+ *          the timing it is measuring.
+ *
+ *          Init() registers the built-in commands (memory report, link and
+ *          rejection statistics, queue depths, trace dump, audit/run/self-
+ *          test history); other subsystems may add their own via Register.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace console_shell {
+
+/**
+ * @brief Command handler
+ * @param argc Token count (argv[0] is the command name)
+ * @param argv NUL-terminated tokens, valid only for the call
+ */
+using CommandFn = void (*)(int argc, const char* const* argv);
+
+/**
+ * @brief Initialize the shell and register the built-in commands
+ */
+void Init() noexcept;
+
+/**
+ * @brief Register a command
+ * @param name Command name (lowercase, no spaces; not copied)
+ * @param help One-line description for `help` (not copied)
+ * @param fn Handler, executed on the console listener task
+ * @return true if a slot was available
+ */
+bool Register(const char* name, const char* help, CommandFn fn) noexcept;
+
+/**
+ * @brief Feed one byte of console input
+ * @details Called by the provisioning listener for bytes outside COBS
+ *          frames. Handles echo, backspace, tab completion and dispatch;
+ *          handlers run on the caller's task.
+ */
+void FeedByte(uint8_t byte) noexcept;
+
+/**
+ * @brief Emit one output line, pacing the console
+ * @details printf-style. Every few lines the task yields briefly so a
+ *          long dump drains the console FIFO instead of blocking on it —
+ *          that pause, not priority alone, is what keeps a dump from
+ *          stalling the log path mid-measurement. For use from handlers.
+ */
+void Line(const char* fmt, ...) noexcept __attribute__((format(printf, 1, 2)));
+
+}  // namespace console_shell
@@ -0,0 +1,84 @@
+/**
+ * @file fast_boot.cpp
+ * @brief Warm-boot validity token implementation.
+ */
+
+#include "fast_boot.hpp"
+
+#include <cstring>
+
+#include "esp_app_desc.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_system.h"
+
+namespace {
+
+constexpr const char* TAG_ = "fastboot";
+
+constexpr uint32_t TOKEN_MAGIC_ = 0x54424246;  // "FBBT"
+
+/**
+ * @brief The RTC-resident token
+ * @details One fixed slot, rewritten whole by NoteChannel. The build field
+ *          ties the token to the image that wrote it: after an OTA the
+ *          stored configuration was proven by different code, so the next
+ *          boot takes the cold path and re-validates everything.
+ */
+struct RtcToken {
+    uint32_t magic;
+    uint32_t build;
+    uint8_t channel;
+};
+
+RTC_NOINIT_ATTR RtcToken s_token_;
+
+bool s_warm_ = false;
+uint8_t s_cached_channel_ = 0;
+
+/// First word of the running image's ELF SHA-256.
+uint32_t buildId_() noexcept
+{
+    uint32_t id = 0;
+    std::memcpy(&id, esp_app_get_description()->app_elf_sha256, sizeof(id));
+    return id;
+}
+
+} // namespace
+
+void fast_boot::Init() noexcept
+{
+    const esp_reset_reason_t reason = esp_reset_reason();
+
+    // Same gate as the black box: power-on leaves RTC RAM undefined, any
+    // warm reset preserved it; the magic and build checks prove the token
+    // was written by this image reaching operational state.
+    if (reason != ESP_RST_POWERON && reason != ESP_RST_UNKNOWN &&
+        s_token_.magic == TOKEN_MAGIC_ && s_token_.build == buildId_()) {
+        s_warm_ = true;
+        s_cached_channel_ = s_token_.channel;
+        ESP_LOGI(TAG_, "warm boot: token valid, channel %u cached",
+                 static_cast<unsigned>(s_cached_channel_));
+    }
+
+    // Disarm until this session proves itself; a crash during bring-up
+    // must not warm-skip validation twice in a row.
+    std::memset(&s_token_, 0, sizeof(s_token_));
+}
+
+bool fast_boot::IsWarm() noexcept
+{
+    return s_warm_;
+}
+
+uint8_t fast_boot::CachedChannel() noexcept
+{
+    return s_warm_ ? s_cached_channel_ : 0;
+}
+
+void fast_boot::NoteChannel(uint8_t channel) noexcept
+{
+    s_token_.channel = channel;
+    s_token_.build = buildId_();
+    s_token_.magic = TOKEN_MAGIC_;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file fast_boot.hpp
+ * @brief Warm-boot fast path gated by an RTC-RAM validity token.
+ * @details A session that reached operational state (radio up on a proven
+ *          channel) stamps a token into RTC noinit RAM. After a warm reset
+ *          the token vouches for the stored configuration, so the boot path
+ *          skips work that only exists to distrust it: the timed NVS health
+ *          probe, the per-peer restore logging and the boot splash. The
+ *          radio channel rides in the token itself, so bring-up tunes
+ *          straight to it and the NVS copy is verified later from the
+ *          receive task, off the boot path. The token carries the app image
+ *          hash — an OTA invalidates it — and, like the black box, survives
+ *          warm resets only: power loss leaves RTC RAM undefined and the
+ *          magic check rejects it.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace fast_boot {
+
+/**
+ * @brief Validate the token and latch the boot path for this session
+ * @details Call once at boot, before any subsystem that consults IsWarm().
+ *          The RTC copy is cleared afterwards, so a session that dies
+ *          before re-arming (see NoteChannel) cold-boots next time.
+ */
+void Init() noexcept;
+
+/// True when the previous session vouched for the stored configuration.
+bool IsWarm() noexcept;
+
+/**
+ * @brief Radio channel the previous session confirmed
+ * @return Channel number, or 0 when the boot is cold
+ */
+uint8_t CachedChannel() noexcept;
+
+/**
+ * @brief Record the operational channel and (re-)arm the token
+ * @details Called by the protocol layer when bring-up completes and again
+ *          whenever a channel hop is confirmed, mirroring the NVS persist.
+ */
+void NoteChannel(uint8_t channel) noexcept;
+
+} // namespace fast_boot
@@ -0,0 +1,104 @@
+/**
+ * @file flash_gov.cpp
+ * @brief Flash maintenance governor implementation.
+ */
+
+#include "flash_gov.hpp"
+
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+
+namespace {
+
+/// Longest a sensitive window may hold an erase. A fault mid-run must
+/// still reach flash while its context is fresh, so starvation beats a
+/// hitch only up to this point.
+constexpr uint32_t DEFER_CAP_MS_ = 30000;
+
+/// Minimum spacing between governed erases outside idle windows, so
+/// stacked persistence features cannot line their stalls up back-to-back.
+constexpr uint32_t ERASE_SPACING_MS_ = 250;
+
+portMUX_TYPE s_lock_ = portMUX_INITIALIZER_UNLOCKED;
+bool s_sensitive_ = false;
+bool s_idle_ = false;
+uint32_t s_defer_start_ms_ = 0;   ///< First held answer of the open streak
+uint32_t s_last_erase_ms_ = 0;
+uint32_t s_erases_ = 0;
+uint32_t s_deferrals_ = 0;
+uint32_t s_max_defer_ms_ = 0;
+
+inline uint32_t nowMs_() noexcept
+{
+    return static_cast<uint32_t>(esp_timer_get_time() / 1000);
+}
+
+/// Close an open defer streak and fold it into the max (lock held).
+inline void closeStreak_(uint32_t now_ms) noexcept
+{
+    if (s_defer_start_ms_ != 0) {
+        const uint32_t held = now_ms - s_defer_start_ms_;
+        if (held > s_max_defer_ms_) {
+            s_max_defer_ms_ = held;
+        }
+        s_defer_start_ms_ = 0;
+    }
+}
+
+} // namespace
+
+void flash_gov::NoteUiWindow(bool sensitive, bool idle) noexcept
+{
+    taskENTER_CRITICAL(&s_lock_);
+    if (s_sensitive_ && !sensitive) {
+        closeStreak_(nowMs_());
+    }
+    s_sensitive_ = sensitive;
+    s_idle_ = idle;
+    taskEXIT_CRITICAL(&s_lock_);
+}
+
+bool flash_gov::DeferErase() noexcept
+{
+    const uint32_t now_ms = nowMs_();
+    bool defer = false;
+    taskENTER_CRITICAL(&s_lock_);
+    if (s_sensitive_) {
+        if (s_defer_start_ms_ == 0) {
+            s_defer_start_ms_ = now_ms;
+        }
+        defer = (now_ms - s_defer_start_ms_) < DEFER_CAP_MS_;
+    }
+    if (!defer && !s_idle_ && s_last_erase_ms_ != 0 &&
+        (now_ms - s_last_erase_ms_) < ERASE_SPACING_MS_) {
+        defer = true;  // pace: the previous stall is too recent
+    }
+    if (defer) {
+        ++s_deferrals_;
+    } else {
+        closeStreak_(now_ms);
+    }
+    taskEXIT_CRITICAL(&s_lock_);
+    return defer;
+}
+
+void flash_gov::NoteErase() noexcept
+{
+    const uint32_t now_ms = nowMs_();
+    taskENTER_CRITICAL(&s_lock_);
+    s_last_erase_ms_ = now_ms;
+    ++s_erases_;
+    closeStreak_(now_ms);
+    taskEXIT_CRITICAL(&s_lock_);
+}
+
+void flash_gov::GetStats(Stats& out) noexcept
+{
+    taskENTER_CRITICAL(&s_lock_);
+    out.erases = s_erases_;
+    out.deferrals = s_deferrals_;
+    out.max_defer_ms = s_max_defer_ms_;
+    out.sensitive = s_sensitive_;
+    out.idle = s_idle_;
+    taskEXIT_CRITICAL(&s_lock_);
+}
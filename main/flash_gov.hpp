@@ -0,0 +1,61 @@
+/**
+ * @file flash_gov.hpp
+ * @brief Flash maintenance governor: schedules background erase work
+ *        around test-critical rendering windows.
+ * @details A sector erase stalls the flash cache for tens of milliseconds,
+ *          and each persistence feature (session log pages, lifecycle
+ *          batched commits, wirecap persists) would otherwise pick its own
+ *          worst moment. Deferrable writers ask DeferErase() before
+ *          touching flash: while a test is Running with the LiveCounter
+ *          foregrounded the stall would land in a visible frame, so the
+ *          work is held (bounded, so evidence logging is never starved);
+ *          during screensaver windows the backlog drains freely. Outside
+ *          those windows erases are paced apart so stacked features cannot
+ *          queue back-to-back stalls.
+ *
+ *          Non-deferrable sites - audit/run-db record appends carrying an
+ *          operator action, and the crash blackbox - never ask, but their
+ *          erase paths still stamp NoteErase() so the pacing accounts for
+ *          the stall they just caused. Boot-time NVS compaction runs before
+ *          rendering starts and stays outside the governor entirely.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace flash_gov {
+
+/**
+ * @brief Feed the governor the UI window it schedules around
+ * @param sensitive A running test has the LiveCounter foregrounded
+ * @param idle Screensaver is up; erase backlog may drain freely
+ * @details Called from the UI housekeeping pass whenever either edge moves.
+ */
+void NoteUiWindow(bool sensitive, bool idle) noexcept;
+
+/**
+ * @brief Should a deferrable erase hold off right now?
+ * @return true while the sensitive window is open (up to the defer cap) or
+ *         the previous erase is too recent; callable from any task. The
+ *         caller retries on its own cadence - the governor never blocks.
+ */
+bool DeferErase() noexcept;
+
+/**
+ * @brief Stamp a flash erase/commit that just happened (all erase sites)
+ */
+void NoteErase() noexcept;
+
+/// Counters for the perf dump.
+struct Stats {
+    uint32_t erases = 0;        ///< NoteErase() calls since boot
+    uint32_t deferrals = 0;     ///< DeferErase() answers that held work
+    uint32_t max_defer_ms = 0;  ///< Longest single hold so far
+    bool sensitive = false;     ///< Current window state
+    bool idle = false;
+};
+
+void GetStats(Stats& out) noexcept;
+
+} // namespace flash_gov
@@ -0,0 +1,190 @@
+/**
+ * @file health_monitor.cpp
+ * @brief Task health monitor implementation.
+ */
+
+#include "health_monitor.hpp"
+
+#include <cstdio>
+
+#include "esp_log.h"
+#include "esp_system.h"
+#include "esp_task_wdt.h"
+#include "esp_timer.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "blackbox.hpp"
+#include "session_log.hpp"
+
+namespace {
+
+constexpr const char* TAG_ = "health";
+
+/// TWDT period when this module has to initialize it itself. Generous on
+/// purpose: it only has to catch tasks that stopped running entirely.
+constexpr uint32_t WDT_TIMEOUT_MS_ = 5000;
+
+/// Consecutive budget misses that count as a sustained breach.
+constexpr uint32_t BREACH_STREAK_ = 16;
+
+/// No controlled resets this early after boot; a breach loop at startup
+/// should wedge visibly rather than brick the unit with restart cycling.
+constexpr uint32_t RESET_MIN_UPTIME_MS_ = 60000;
+
+struct Slot {
+    bool registered;
+    TaskHandle_t handle;
+    uint32_t work_budget_ms;
+    uint32_t turnaround_ms;
+    uint32_t last_checkin_ms;
+    uint32_t miss_streak;       ///< Consecutive misses (work or turnaround)
+    health::Stats stats;
+};
+
+Slot s_slots_[static_cast<size_t>(health::Task::Count)];
+bool s_wdt_ok_ = false;
+
+const char* taskName_(health::Task task)
+{
+    switch (task) {
+        case health::Task::MainLoop:
+            return "main";
+        case health::Task::Render:
+            return "render";
+        case health::Task::ProtoRecv:
+            return "proto";
+        default:
+            return "?";
+    }
+}
+
+uint32_t nowMs_()
+{
+    return static_cast<uint32_t>(esp_timer_get_time() / 1000);
+}
+
+/**
+ * @brief Escalate a sustained budget breach
+ * @details The breach and its magnitude go to the black box (RTC RAM, so
+ *          they survive the reset) and the flash session log, then the
+ *          unit restarts deliberately instead of limping on. Early-boot
+ *          breaches only log: restart cycling would be worse than the
+ *          degradation it hides.
+ */
+void escalate_(health::Task task, Slot& slot, uint32_t observed_ms)
+{
+    blackbox::Note(blackbox::Kind::Health, static_cast<uint8_t>(task),
+                   static_cast<uint16_t>(observed_ms > 0xFFFF ? 0xFFFF : observed_ms));
+
+    const uint32_t now_ms = nowMs_();
+    char line[session_log::MAX_TEXT];
+    snprintf(line, sizeof(line), "HM: %s sustained breach (%lu misses, worst %lums)",
+             taskName_(task), static_cast<unsigned long>(slot.miss_streak),
+             static_cast<unsigned long>(slot.stats.worst_work_ms));
+    ESP_LOGE(TAG_, "%s", line);
+    session_log::Append(now_ms, line);
+
+    if (now_ms < RESET_MIN_UPTIME_MS_) {
+        slot.miss_streak = 0;
+        return;
+    }
+    session_log::Flush();
+    esp_restart();
+}
+
+} // namespace
+
+void health::Register(Task task, uint32_t work_budget_ms, uint32_t turnaround_ms) noexcept
+{
+    const size_t idx = static_cast<size_t>(task);
+    if (idx >= static_cast<size_t>(Task::Count)) {
+        return;
+    }
+
+    // Join the TWDT; initialize it first if the sdkconfig left it off. A
+    // failure here downgrades to soft monitoring only — never fatal.
+    esp_err_t err = esp_task_wdt_add(nullptr);
+    if (err == ESP_ERR_INVALID_STATE) {
+        esp_task_wdt_config_t cfg{};
+        cfg.timeout_ms = WDT_TIMEOUT_MS_;
+        cfg.idle_core_mask = 0;
+        cfg.trigger_panic = true;
+        if (esp_task_wdt_init(&cfg) == ESP_OK) {
+            err = esp_task_wdt_add(nullptr);
+        }
+    }
+    s_wdt_ok_ = (err == ESP_OK);
+    if (!s_wdt_ok_) {
+        ESP_LOGW(TAG_, "%s: TWDT unavailable (%s), soft monitoring only",
+                 taskName_(task), esp_err_to_name(err));
+    }
+
+    Slot& slot = s_slots_[idx];
+    slot.registered = true;
+    slot.handle = xTaskGetCurrentTaskHandle();
+    slot.work_budget_ms = work_budget_ms;
+    slot.turnaround_ms = turnaround_ms;
+    slot.last_checkin_ms = nowMs_();
+    slot.miss_streak = 0;
+    slot.stats = {};
+}
+
+void health::CheckIn(Task task) noexcept
+{
+    const size_t idx = static_cast<size_t>(task);
+    if (idx >= static_cast<size_t>(Task::Count) || !s_slots_[idx].registered) {
+        return;
+    }
+    Slot& slot = s_slots_[idx];
+
+    if (s_wdt_ok_) {
+        esp_task_wdt_reset();
+    }
+
+    const uint32_t now_ms = nowMs_();
+    const uint32_t gap_ms = now_ms - slot.last_checkin_ms;
+    slot.last_checkin_ms = now_ms;
+    ++slot.stats.checkins;
+
+    if (gap_ms > slot.turnaround_ms) {
+        ++slot.stats.late_checkins;
+        if (++slot.miss_streak >= BREACH_STREAK_) {
+            escalate_(task, slot, gap_ms);
+        }
+    } else {
+        slot.miss_streak = 0;
+    }
+}
+
+void health::ReportWork(Task task, uint32_t work_ms) noexcept
+{
+    const size_t idx = static_cast<size_t>(task);
+    if (idx >= static_cast<size_t>(Task::Count) || !s_slots_[idx].registered) {
+        return;
+    }
+    Slot& slot = s_slots_[idx];
+
+    if (work_ms > slot.stats.worst_work_ms) {
+        slot.stats.worst_work_ms = work_ms;
+    }
+    if (work_ms > slot.work_budget_ms) {
+        ++slot.stats.work_misses;
+        if (++slot.miss_streak >= BREACH_STREAK_) {
+            escalate_(task, slot, work_ms);
+        }
+    }
+    // Within budget leaves the streak alone: CheckIn() clears it, so one
+    // slow loop with many fast work units inside cannot mask itself.
+}
+
+bool health::GetStats(Task task, Stats& out) noexcept
+{
+    const size_t idx = static_cast<size_t>(task);
+    if (idx >= static_cast<size_t>(Task::Count) || !s_slots_[idx].registered) {
+        return false;
+    }
+    out = s_slots_[idx].stats;
+    return true;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file health_monitor.hpp
+ * @brief Task health monitor: watchdog check-ins plus latency budgets.
+ * @details Field units have wedged with the display frozen while the radio
+ *          kept running — silent, because nothing watched the tasks. Each
+ *          critical task registers here with two budgets: a turnaround
+ *          bound (how often its loop must come around, idle waits
+ *          included) and a work bound (how long one unit of work may
+ *          take, e.g. one frame or one protocol drain). Check-ins feed
+ *          the hardware task watchdog, so a fully wedged task still ends
+ *          in a TWDT panic whose evidence the black box preserves; budget
+ *          misses are merely counted and surfaced on the diagnostics
+ *          page. A sustained breach — many consecutive misses — records a
+ *          black-box event and performs a controlled reset, turning
+ *          creeping degradation into a measured, recoverable event.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace health {
+
+/**
+ * @brief Monitored tasks
+ */
+enum class Task : uint8_t {
+    MainLoop = 0,  ///< Core-0 input/event loop (UiController::Tick)
+    Render,        ///< Core-1 render task
+    ProtoRecv,     ///< ESP-NOW receive/service task
+    Count
+};
+
+/**
+ * @brief Per-task health counters (see GetStats)
+ */
+struct Stats {
+    uint32_t checkins;       ///< Loop turnarounds observed
+    uint32_t late_checkins;  ///< Turnarounds over the registered bound
+    uint32_t work_misses;    ///< Work units over the latency budget
+    uint32_t worst_work_ms;  ///< Slowest work unit seen
+};
+
+/**
+ * @brief Register the calling task for monitoring
+ * @details Joins the task watchdog (initializing it if the sdkconfig did
+ *          not) and records the budgets. Call once from the task itself.
+ * @param task Which monitored slot this task fills
+ * @param work_budget_ms Latency budget for one unit of work
+ * @param turnaround_ms Maximum time between CheckIn() calls, idle included
+ */
+void Register(Task task, uint32_t work_budget_ms, uint32_t turnaround_ms) noexcept;
+
+/**
+ * @brief Per-loop check-in: feeds the watchdog, checks the turnaround bound
+ * @details Call once per loop iteration from the registered task.
+ */
+void CheckIn(Task task) noexcept;
+
+/**
+ * @brief Report the duration of one unit of work against the budget
+ * @param task Reporting task
+ * @param work_ms Time the unit of work took
+ */
+void ReportWork(Task task, uint32_t work_ms) noexcept;
+
+/**
+ * @brief Snapshot a task's health counters
+ * @return true if the task has registered
+ */
+bool GetStats(Task task, Stats& out) noexcept;
+
+} // namespace health
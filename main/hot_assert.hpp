@@ -0,0 +1,39 @@
+/**
+ * @file hot_assert.hpp
+ * @brief Checked/unchecked invariant discipline for hot-path code.
+ * @details HOT_ASSERT states an invariant that holds by construction —
+ *          ring indices already reduced modulo their capacity, enum values
+ *          produced by our own state machine, cache slots derived from a
+ *          validated digit. Debug builds verify it like a normal assert
+ *          and abort with file/line on violation; Release builds compile
+ *          the false branch to __builtin_unreachable(), so the check
+ *          disappears from the straight-line path and the optimizer may
+ *          drop range tests and wrap guards the invariant makes redundant.
+ *
+ *          Soak builds re-enable every check on top of Release codegen by
+ *          passing -DSOAK_CHECKS=1 to the build (see main/CMakeLists.txt,
+ *          same opt-in shape as TRACE_ENABLED), so a week on the bench
+ *          runs with the shipping optimizer AND the full checking.
+ *
+ *          Never use it on conditions that depend on external input
+ *          (payload lengths, NVS contents, touch coordinates): a wrong
+ *          hint is undefined behavior, not a caught bug. Those stay real
+ *          branches.
+ */
+
+#pragma once
+
+#include <cassert>
+
+#if defined(NDEBUG) && !defined(M5DIAL_SOAK_CHECKS)
+// Release: the invariant becomes an optimizer hint, not code.
+#define HOT_ASSERT(cond)                 \
+    do {                                 \
+        if (!(cond)) {                   \
+            __builtin_unreachable();     \
+        }                                \
+    } while (0)
+#else
+// Debug and soak: a violated invariant aborts loudly with file/line.
+#define HOT_ASSERT(cond) assert(cond)
+#endif
@@ -0,0 +1,146 @@
+/**
+ * @file input_trace.cpp
+ * @brief Input event ring and replay cursor implementation.
+ */
+
+#include "input_trace.hpp"
+
+#include <cstring>
+
+#include "esp_log.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+namespace {
+
+const char* TAG_ = "itrace";
+
+input_trace::Event s_ring_[input_trace::CAPACITY];
+size_t s_head_ = 0;   ///< Next write slot
+size_t s_count_ = 0;  ///< Valid events (<= CAPACITY)
+
+// Replay cursor. Events are consumed oldest-first; timestamps are mapped
+// onto the current clock as (t - t_first) / speed from the replay start.
+bool s_replaying_ = false;
+size_t s_replay_pos_ = 0;     ///< Consumed so far (oldest-first index)
+uint32_t s_replay_t0_ = 0;    ///< First recorded timestamp
+uint32_t s_replay_start_ = 0; ///< Uptime when the replay began
+uint8_t s_replay_speed_ = 1;
+
+// The ring is written from the UI task and read from the provisioning
+// task; operations are a few words, so a spinlock is the right tool.
+portMUX_TYPE s_lock_ = portMUX_INITIALIZER_UNLOCKED;
+
+/** @brief Oldest-first index -> ring slot (caller holds the lock). */
+inline size_t slotAt(size_t i)
+{
+    return (s_head_ + input_trace::CAPACITY - s_count_ + i) % input_trace::CAPACITY;
+}
+
+} // namespace
+
+void input_trace::Note(Kind kind, int16_t a, int16_t b, uint32_t now_ms) noexcept
+{
+    if (s_replaying_) {
+        return;  // Injected events must not re-enter the ring
+    }
+    taskENTER_CRITICAL(&s_lock_);
+    Event& e = s_ring_[s_head_];
+    e.t_ms = now_ms;
+    e.kind = static_cast<uint8_t>(kind);
+    e.a = a;
+    e.b = b;
+    s_head_ = (s_head_ + 1) % CAPACITY;
+    if (s_count_ < CAPACITY) {
+        ++s_count_;
+    }
+    taskEXIT_CRITICAL(&s_lock_);
+}
+
+size_t input_trace::Snapshot(Event* out, size_t max) noexcept
+{
+    taskENTER_CRITICAL(&s_lock_);
+    const size_t n = (s_count_ < max) ? s_count_ : max;
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = s_ring_[slotAt(i)];
+    }
+    taskEXIT_CRITICAL(&s_lock_);
+    return n;
+}
+
+void input_trace::LoadBegin() noexcept
+{
+    taskENTER_CRITICAL(&s_lock_);
+    s_head_ = 0;
+    s_count_ = 0;
+    taskEXIT_CRITICAL(&s_lock_);
+}
+
+bool input_trace::LoadAppend(const Event* events, size_t count) noexcept
+{
+    bool fit = true;
+    taskENTER_CRITICAL(&s_lock_);
+    for (size_t i = 0; i < count; ++i) {
+        if (s_count_ >= CAPACITY) {
+            fit = false;
+            break;
+        }
+        s_ring_[s_head_] = events[i];
+        s_head_ = (s_head_ + 1) % CAPACITY;
+        ++s_count_;
+    }
+    taskEXIT_CRITICAL(&s_lock_);
+    return fit;
+}
+
+bool input_trace::StartReplay(uint8_t speed) noexcept
+{
+    taskENTER_CRITICAL(&s_lock_);
+    const size_t count = s_count_;
+    const uint32_t t0 = (count > 0) ? s_ring_[slotAt(0)].t_ms : 0;
+    taskEXIT_CRITICAL(&s_lock_);
+    if (count == 0) {
+        return false;
+    }
+    s_replay_speed_ = (speed < 1) ? 1 : (speed > 16) ? 16 : speed;
+    s_replay_pos_ = 0;
+    s_replay_t0_ = t0;
+    s_replay_start_ = static_cast<uint32_t>(xTaskGetTickCount() * portTICK_PERIOD_MS);
+    s_replaying_ = true;
+    ESP_LOGI(TAG_, "Replaying %u events at %ux",
+             static_cast<unsigned>(count), static_cast<unsigned>(s_replay_speed_));
+    return true;
+}
+
+bool input_trace::Replaying() noexcept
+{
+    return s_replaying_;
+}
+
+bool input_trace::ReplayNext(uint32_t now_ms, Event& out) noexcept
+{
+    while (s_replaying_) {
+        taskENTER_CRITICAL(&s_lock_);
+        const bool have = s_replay_pos_ < s_count_;
+        if (have) {
+            out = s_ring_[slotAt(s_replay_pos_)];
+        }
+        taskEXIT_CRITICAL(&s_lock_);
+        if (!have) {
+            s_replaying_ = false;
+            ESP_LOGI(TAG_, "Replay done");
+            return false;
+        }
+        const uint32_t due = (out.t_ms - s_replay_t0_) / s_replay_speed_;
+        if (now_ms - s_replay_start_ < due) {
+            return false;  // Not yet
+        }
+        ++s_replay_pos_;
+        if (out.kind == static_cast<uint8_t>(Kind::Proto)) {
+            continue;  // Correlation-only; never re-injected
+        }
+        return true;
+    }
+    return false;
+}
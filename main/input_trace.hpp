@@ -0,0 +1,103 @@
+/**
+ * @file input_trace.hpp
+ * @brief Input event recorder and deterministic replay for the UI.
+ * @details Interaction bugs ("rotate twice during the popup, then
+ *          long-press") are easy to hit and hard to re-create by hand.
+ *          This ring records every distilled input event the UI
+ *          dispatches (rotate, click, long press, touch gestures) plus
+ *          the protocol event types interleaved with them, each with its
+ *          uptime timestamp. The ring exports over the provisioning
+ *          console, and a recorded stream - the live ring or one loaded
+ *          back from the host - can be replayed through the normal input
+ *          dispatch at a time-compressed rate, reproducing the sequence
+ *          deterministically as far as the UI state machine is concerned.
+ *          Protocol events are recorded for correlation but not
+ *          re-injected: replay drives the input half only.
+ *
+ *          Recording is always on (a few KB of RAM, no flash traffic) and
+ *          suppressed while a replay is running so injected events do not
+ *          re-enter the ring.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace input_trace {
+
+/// Event kinds. Values are wire format (serial export) - append only.
+enum class Kind : uint8_t {
+    None = 0,
+    Rotate,          ///< a = signed detent delta (chorded rotations too)
+    Click,
+    LongPress,
+    TouchClick,      ///< a = x, b = y
+    TouchDrag,       ///< a = y delta
+    TouchLongPress,  ///< a = x, b = y
+    Swipe,           ///< a = total dx, b = total dy
+    Proto,           ///< a = espnow::MsgType (correlation only, not replayed)
+};
+
+/// One recorded event (wire format == RAM format)
+struct __attribute__((packed)) Event {
+    uint32_t t_ms;  ///< Uptime when captured
+    uint8_t kind;   ///< Kind
+    int16_t a;      ///< Kind-specific (see Kind)
+    int16_t b;      ///< Kind-specific (see Kind)
+};
+static_assert(sizeof(Event) == 9, "Event is wire format - keep it packed");
+
+/// Ring capacity in events (~2.3 KB; minutes of normal interaction)
+constexpr size_t CAPACITY = 256;
+
+/**
+ * @brief Record one event (no-op while a replay is running)
+ */
+void Note(Kind kind, int16_t a, int16_t b, uint32_t now_ms) noexcept;
+
+/**
+ * @brief Copy the ring oldest-first
+ * @param out Receives up to @p max events
+ * @param max Capacity of @p out
+ * @return Events copied
+ */
+size_t Snapshot(Event* out, size_t max) noexcept;
+
+/**
+ * @brief Start loading an externally supplied stream (clears the ring)
+ * @details The loaded stream occupies the recording ring, so recording
+ *          effectively restarts once the replay ends.
+ */
+void LoadBegin() noexcept;
+
+/**
+ * @brief Append events to a stream started with LoadBegin
+ * @return false once the ring is full (excess is dropped)
+ */
+bool LoadAppend(const Event* events, size_t count) noexcept;
+
+/**
+ * @brief Replay the ring contents through the UI dispatch
+ * @param speed Time compression factor (1 = realtime, clamped to 1..16)
+ * @return false if the ring is empty
+ */
+bool StartReplay(uint8_t speed) noexcept;
+
+/**
+ * @brief True while a replay is in progress
+ */
+bool Replaying() noexcept;
+
+/**
+ * @brief Next due event, if any
+ * @details Called by the UI tick. Returns true and fills @p out when the
+ *          next recorded event's compressed timestamp has been reached;
+ *          Proto events are skipped. Replay ends (and recording resumes)
+ *          when the ring is exhausted.
+ * @param now_ms Current uptime in milliseconds
+ * @param out Receives the due event
+ */
+bool ReplayNext(uint32_t now_ms, Event& out) noexcept;
+
+} // namespace input_trace
@@ -0,0 +1,206 @@
+/**
+ * @file lifecycle.cpp
+ * @brief Boot counter / uptime / reset-history implementation.
+ */
+
+#include "lifecycle.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_system.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "nvs.h"
+
+#include "flash_gov.hpp"
+#include "session_log.hpp"
+
+namespace {
+
+constexpr const char* TAG_ = "lifecycle";
+
+constexpr const char* NVS_NAMESPACE_ = "m5dial_lc";  ///< Separate from settings
+constexpr const char* NVS_KEY_ = "stats";
+
+constexpr uint32_t BLOB_MAGIC_ = 0x3143464C;   // "LCF1" — bump on layout change
+constexpr uint32_t RTC_MAGIC_ = 0x50554C43;    // "CLUP"
+
+constexpr uint32_t RTC_TICK_MS_ = 60U * 1000U;        ///< RTC uptime granularity
+constexpr uint32_t COMMIT_EVERY_MS_ = 30U * 60U * 1000U;  ///< NVS batch period
+
+/**
+ * @brief The persisted blob (one NVS key, one commit per batch)
+ * @details session_min is the last batch-committed uptime of the running
+ *          session: it seeds the reset ring when power loss wipes the RTC
+ *          figure, and is folded into the total on the next boot.
+ */
+struct PersistBlob {
+    uint32_t magic;
+    uint32_t boot_count;
+    uint32_t total_uptime_min;
+    uint32_t session_min;                       ///< Committed uptime of the open session
+    uint8_t ring_count;                         ///< Valid entries (grows to RESET_RING)
+    uint8_t ring_head;                          ///< Next write slot
+    uint8_t pad[2];
+    lifecycle::ResetEntry ring[lifecycle::RESET_RING];
+};
+
+/**
+ * @brief Live session uptime in RTC noinit RAM
+ * @details Survives everything but power loss; check is the value XORed
+ *          with the magic so a torn write reads as invalid rather than as
+ *          a bogus uptime.
+ */
+struct RtcUptime {
+    uint32_t magic;
+    uint32_t uptime_min;
+    uint32_t check;
+};
+
+RTC_NOINIT_ATTR RtcUptime s_rtc_;
+
+PersistBlob s_blob_{};
+bool s_armed_ = false;
+uint32_t s_session_min_ = 0;        ///< This session's uptime, minutes
+uint32_t s_last_rtc_tick_ms_ = 0;
+uint32_t s_last_commit_ms_ = 0;
+
+portMUX_TYPE s_lock_ = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief Write the blob and commit (the one flash touch per batch)
+ */
+void commitBlob_() noexcept
+{
+    nvs_handle_t handle;
+    if (nvs_open(NVS_NAMESPACE_, NVS_READWRITE, &handle) != ESP_OK) {
+        return;
+    }
+    if (nvs_set_blob(handle, NVS_KEY_, &s_blob_, sizeof(s_blob_)) == ESP_OK) {
+        (void)nvs_commit(handle);
+    }
+    nvs_close(handle);
+}
+
+void armRtc_(uint32_t minutes) noexcept
+{
+    s_rtc_.magic = RTC_MAGIC_;
+    s_rtc_.uptime_min = minutes;
+    s_rtc_.check = minutes ^ RTC_MAGIC_;
+}
+
+} // namespace
+
+void lifecycle::Init() noexcept
+{
+    const esp_reset_reason_t reason = esp_reset_reason();
+
+    nvs_handle_t handle;
+    size_t len = sizeof(s_blob_);
+    bool loaded = false;
+    if (nvs_open(NVS_NAMESPACE_, NVS_READONLY, &handle) == ESP_OK) {
+        loaded = nvs_get_blob(handle, NVS_KEY_, &s_blob_, &len) == ESP_OK &&
+                 len == sizeof(s_blob_) && s_blob_.magic == BLOB_MAGIC_;
+        nvs_close(handle);
+    }
+    if (!loaded) {
+        std::memset(&s_blob_, 0, sizeof(s_blob_));
+        s_blob_.magic = BLOB_MAGIC_;
+    }
+
+    // Previous session's uptime: exact from RTC RAM on a warm reset,
+    // otherwise the last committed batch (at most 30 minutes stale).
+    const bool rtc_valid = reason != ESP_RST_POWERON && reason != ESP_RST_UNKNOWN &&
+                           s_rtc_.magic == RTC_MAGIC_ &&
+                           s_rtc_.check == (s_rtc_.uptime_min ^ RTC_MAGIC_);
+    const uint32_t prev_min = rtc_valid ? s_rtc_.uptime_min : s_blob_.session_min;
+
+    // Account the session that just ended (none on the very first boot).
+    if (s_blob_.boot_count > 0) {
+        s_blob_.total_uptime_min += prev_min;
+        s_blob_.ring[s_blob_.ring_head] =
+            ResetEntry{static_cast<uint8_t>(reason), prev_min};
+        s_blob_.ring_head = static_cast<uint8_t>((s_blob_.ring_head + 1) % RESET_RING);
+        if (s_blob_.ring_count < RESET_RING) {
+            ++s_blob_.ring_count;
+        }
+    }
+    ++s_blob_.boot_count;
+    s_blob_.session_min = 0;
+    commitBlob_();
+
+    armRtc_(0);
+    s_armed_ = true;
+
+    char line[session_log::MAX_TEXT];
+    snprintf(line, sizeof(line), "LC: boot #%" PRIu32 " total %" PRIu32 "h prev %" PRIu32 "m %s",
+             s_blob_.boot_count, s_blob_.total_uptime_min / 60U, prev_min,
+             ReasonName(static_cast<uint8_t>(reason)));
+    ESP_LOGI(TAG_, "%s", line);
+    session_log::Append(0, line);
+}
+
+void lifecycle::Service(uint32_t now_ms) noexcept
+{
+    if (!s_armed_) {
+        return;
+    }
+    if ((now_ms - s_last_rtc_tick_ms_) < RTC_TICK_MS_) {
+        return;
+    }
+    s_last_rtc_tick_ms_ = now_ms;
+
+    const uint32_t minutes = now_ms / 60000U;
+    taskENTER_CRITICAL(&s_lock_);
+    s_session_min_ = minutes;
+    taskEXIT_CRITICAL(&s_lock_);
+    armRtc_(minutes);
+
+    // The batched commit is deferrable by nature; let the flash governor
+    // slide it out of a test-critical window (retried on the next tick).
+    if ((now_ms - s_last_commit_ms_) >= COMMIT_EVERY_MS_ && !flash_gov::DeferErase()) {
+        s_last_commit_ms_ = now_ms;
+        s_blob_.session_min = minutes;
+        commitBlob_();
+        flash_gov::NoteErase();
+    }
+}
+
+void lifecycle::GetStats(Stats& out) noexcept
+{
+    taskENTER_CRITICAL(&s_lock_);
+    out.boot_count = s_blob_.boot_count;
+    out.total_uptime_min = s_blob_.total_uptime_min;
+    out.session_min = s_session_min_;
+    out.ring_count = s_blob_.ring_count;
+    // Newest first: walk back from the write head.
+    for (uint8_t i = 0; i < s_blob_.ring_count; ++i) {
+        const uint8_t slot = static_cast<uint8_t>(
+            (s_blob_.ring_head + RESET_RING - 1 - i) % RESET_RING);
+        out.ring[i] = s_blob_.ring[slot];
+    }
+    taskEXIT_CRITICAL(&s_lock_);
+}
+
+const char* lifecycle::ReasonName(uint8_t reason) noexcept
+{
+    switch (static_cast<esp_reset_reason_t>(reason)) {
+        case ESP_RST_POWERON: return "PWR";
+        case ESP_RST_EXT: return "EXT";
+        case ESP_RST_SW: return "SW";
+        case ESP_RST_PANIC: return "PANIC";
+        case ESP_RST_INT_WDT: return "IWDT";
+        case ESP_RST_TASK_WDT: return "TWDT";
+        case ESP_RST_WDT: return "WDT";
+        case ESP_RST_DEEPSLEEP: return "SLEEP";
+        case ESP_RST_BROWNOUT: return "BROWN";
+        case ESP_RST_SDIO: return "SDIO";
+        default: return "?";
+    }
+}
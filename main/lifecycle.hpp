@@ -0,0 +1,74 @@
+/**
+ * @file lifecycle.hpp
+ * @brief Durable boot counter, cumulative uptime and reset-reason history.
+ * @details Answers "did this remote reboot over the weekend?" without a
+ *          serial cable. A boot counter, lifetime uptime and a small ring
+ *          of recent (reset reason, uptime at reset) entries persist in
+ *          NVS; the live session uptime ticks in RTC noinit RAM so a warm
+ *          reset (panic, watchdog, brownout) carries the exact figure to
+ *          the next boot. NVS writes are batched — one commit at boot and
+ *          one every 30 minutes — so the counters cost flash wear in the
+ *          same class as a settings save, not a per-minute commit stream.
+ *          Power loss forfeits at most the last uncommitted half hour.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace lifecycle {
+
+/// Reset-history ring depth (oldest entries fall off)
+static constexpr size_t RESET_RING = 8;
+
+/**
+ * @brief One historical reset
+ */
+struct ResetEntry {
+    uint8_t reason;       ///< esp_reset_reason_t of the reset that ended the session
+    uint32_t uptime_min;  ///< Session uptime at that reset, minutes
+};
+
+/**
+ * @brief Lifetime statistics snapshot (see GetStats)
+ */
+struct Stats {
+    uint32_t boot_count;        ///< Total boots, this one included
+    uint32_t total_uptime_min;  ///< Cumulative uptime across all sessions, minutes
+    uint32_t session_min;       ///< Current session uptime, minutes
+    uint8_t ring_count;         ///< Valid entries in @ref ring
+    ResetEntry ring[RESET_RING];  ///< Newest first
+};
+
+/**
+ * @brief Load history, account the previous session, arm this one
+ * @details Call once at boot after nvs_flash_init() and session_log::Init().
+ *          Folds the previous session (uptime from RTC RAM on a warm reset,
+ *          last committed batch on power loss) into the totals and the
+ *          reset ring, then commits once. Logs a summary line into the
+ *          session log so every session record opens with its boot number
+ *          and what ended the previous run.
+ */
+void Init() noexcept;
+
+/**
+ * @brief Periodic upkeep: tick the RTC uptime, batch-commit to NVS
+ * @details Call from a housekeeping path (any cadence up to ~1 min is
+ *          fine). RTC RAM updates every minute; NVS sees one commit per
+ *          30 minutes.
+ * @param now_ms Current uptime in milliseconds
+ */
+void Service(uint32_t now_ms) noexcept;
+
+/**
+ * @brief Copy out the lifetime statistics
+ */
+void GetStats(Stats& out) noexcept;
+
+/**
+ * @brief Short display name for an esp_reset_reason_t value ("WDT", "PANIC", ...)
+ */
+const char* ReasonName(uint8_t reason) noexcept;
+
+} // namespace lifecycle
@@ -10,16 +10,74 @@
 #include "freertos/queue.h"
 
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "nvs_flash.h"
 
 #include "M5Unified.h"
 
+#include "asset_store.hpp"
+#include "audit.hpp"
+#include "blackbox.hpp"
+#include "console_shell.hpp"
+#include "fast_boot.hpp"
+#include "lifecycle.hpp"
+#include "mem_budget.hpp"
+#include "provisioning.hpp"
+#include "queue_stats.hpp"
+#include "rfid_badge.hpp"
+#include "run_db.hpp"
+#include "self_test.hpp"
+#include "session_log.hpp"
+#include "session_restore.hpp"
 #include "settings.hpp"
+#include "storage_maint.hpp"
+#include "telemetry_bridge.hpp"
+#include "thermal.hpp"
 #include "protocol/espnow_protocol.hpp"
+#include "protocol/wire_capture.hpp"
+#include "ui/display_tuner.hpp"
 #include "ui/ui_controller.hpp"
 
 static const char* TAG_ = "app";
 
+/**
+ * @brief Background bring-up for peripherals the boot path does not need
+ * @details M5.begin() normally serializes the RTC probe, the IMU probe (the
+ *          Dial has no IMU, so that one is pure I2C-timeout wait) and the
+ *          speaker setup in front of the first frame. Those flags are turned
+ *          off in app_main and the I2C peripherals are probed here instead,
+ *          concurrently with the radio bring-up: the RTC (plus system clock
+ *          sync) and the RFID badge reader, serialized on this one task so
+ *          the internal bus sees the same single-prober pattern as stock
+ *          M5.begin(). Consumers already tolerate late arrival: timestamps
+ *          fall back to the boot epoch until the RTC lands, and badge scans
+ *          simply start once rfid::Init has run. Deletes itself when done.
+ * @param arg Protocol event queue (QueueHandle_t) handed to rfid::Init
+ */
+static void periphInitTask_(void* arg)
+{
+    const int64_t t0_us = esp_timer_get_time();
+
+    // RTC probe + wall-clock sync (mirrors M5Unified::_begin_rtc_imu minus
+    // the IMU scan). Session log lines gain real dates from here on.
+    if (m5::In_I2C.isEnabled()) {
+        M5.Rtc.begin(&m5::In_I2C, M5.getBoard());
+    }
+    if (M5.Rtc.isEnabled()) {
+        M5.Rtc.setSystemTimeFromRtc();
+        M5.Rtc.disableIRQ();
+    }
+
+    // Badge reader probe + configuration (includes a 50 ms soft-reset wait
+    // that used to sit on the boot path).
+    (void)rfid::Init(static_cast<QueueHandle_t>(arg));
+
+    ESP_LOGI(TAG_, "Peripheral bring-up done in %u ms (rtc=%d)",
+             static_cast<unsigned>((esp_timer_get_time() - t0_us) / 1000),
+             M5.Rtc.isEnabled() ? 1 : 0);
+    vTaskDelete(nullptr);
+}
+
 /**
  * @brief Main application entry point
  * @details Initializes the M5Dial remote controller system:
@@ -28,15 +86,21 @@ static const char* TAG_ = "app";
  *          - ESP-NOW protocol stack with event queue
  *          - UI controller for user interaction
  * 
- *          Then enters the main loop:
+ *          Then enters the main loop (core 0):
  *          - Updates M5 hardware state
- *          - Processes UI events and rendering
- *          - Delays 16ms (~60 FPS)
+ *          - Processes UI input and protocol events
+ *          Rendering runs on a dedicated task pinned to core 1 (see
+ *          UiController), so frame time never delays ESP-NOW handling.
  */
 extern "C" void app_main(void)
 {
     ESP_LOGI(TAG_, "Booting M5Dial remote controller...");
-    
+
+    // Warm-boot token: when the previous session reached operational state
+    // and the reset preserved RTC RAM, downstream init skips re-validation
+    // work (NVS probe, peer-restore logging, boot splash).
+    fast_boot::Init();
+
     // Initialize NVS - required for WiFi/ESP-NOW
     esp_err_t nvs_err = nvs_flash_init();
     if (nvs_err == ESP_ERR_NVS_NO_FREE_PAGES || nvs_err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
@@ -48,27 +112,119 @@ extern "C" void app_main(void)
         ESP_LOGE(TAG_, "NVS init failed: %s", esp_err_to_name(nvs_err));
         // Continue anyway - WiFi may not work but display will
     }
-    
-    // Use default settings (skip full settings store for now)
-    Settings settings{};
 
-    // Initialize M5Unified with M5Dial board
+    // NVS health check, and the compaction the previous session may have
+    // scheduled. Must run before any other subsystem opens a handle.
+    storage_maint::Init();
+
+    // Persisted settings (defaults on first boot or CRC failure); saves
+    // from the UI and serial provisioning land here on the next boot.
+    Settings settings = SettingsStore::Load();
+
+    // Bring up the flash-backed session log so fault evidence survives
+    // reboots; the Terminal page scrolls back into its history.
+    session_log::Init();
+
+    // Replay the previous session's black box (if the reset preserved RTC
+    // RAM) into the logs, then arm it for this session.
+    blackbox::Init();
+
+    // Session checkpoint: if a warm reset interrupted a running test, the
+    // UI jumps straight back to the live view (same gating as blackbox).
+    session_restore::Init();
+
+    // Run database: persisted per-test records behind the History page.
+    run_db::Init();
+
+    // Settings audit trail: per-field change records behind the same page.
+    audit::Init();
+
+    // Conformance frame capture: persisted harvest of novel unit traffic
+    // for the host-side wire-compatibility suite. Inert unless armed.
+    wire_capture::Init();
+
+    // Map the assets partition so large UI resources read zero-copy from
+    // flash; missing or blank leaves the compiled-in fallbacks in charge.
+    asset_store::Init();
+
+    // Lifecycle stats: boot counter, cumulative uptime, reset history.
+    // Accounts the session the reset just ended, so it follows blackbox
+    // (reset reason context) and session_log (its summary line lands there).
+    lifecycle::Init();
+
+    // Die temperature telemetry + display derate verdict. Sampled from the
+    // UI housekeeping tick; inert if the sensor fails to come up.
+    thermal::Init();
+
+    // Initialize M5Unified with M5Dial board. Display-first: the RTC and
+    // IMU I2C probes are taken off the boot path (see periphInitTask_) so
+    // M5.begin returns as soon as pixels are possible. The speaker stays
+    // enabled — its M5.begin cost is a config copy; I2S only comes up on
+    // the first tone.
     auto cfg = M5.config();
     cfg.fallback_board = m5gfx::board_t::board_M5Dial;
     cfg.clear_display = true;
+    cfg.internal_rtc = false;
+    cfg.internal_imu = false;
     M5.begin(cfg);
     
     // Apply brightness
     M5.Display.setBrightness(settings.ui.brightness);
 
-    // Create protocol event queue for ESP-NOW
+    // Prove the panel's SPI write clock (read-back self-test) before any
+    // real frame is pushed; the proven level persists across boots.
+    ui::display_tuner::Run(M5.Display);
+
+    // Power-on self-test: hardware checks run on a background task during
+    // the boot animation window, so they add no serialized boot time.
+    // Failures are advisory - logged and flagged on the diagnostics page.
+    self_test::Start();
+
+    // Create protocol event queue for ESP-NOW. Events are slim descriptors
+    // into the protocol layer's pooled receive buffers (no payload copy);
+    // the enqueue policy in espnow_protocol.cpp is class-aware, so a status
+    // burst filling the queue can never evict a command ack.
     QueueHandle_t proto_queue = xQueueCreate(10, sizeof(espnow::ProtoEvent));
     if (!proto_queue) {
         ESP_LOGE(TAG_, "Failed to create protocol queue");
         return;
     }
+    (void)queue_stats::Register(proto_queue, "proto", 10);
+
+    // Bring the radio up in the background so the boot screen appears at
+    // display-init time; a RadioReady event arrives on the queue when done.
+    (void)espnow::InitAsync(proto_queue);
+
+    // Probe the remaining I2C peripherals (RTC, badge reader) concurrently
+    // with the radio bring-up; see periphInitTask_. Inline fallback keeps
+    // the peripherals working if task creation ever fails.
+    if (xTaskCreate(periphInitTask_, "periph_init", 3072, proto_queue, 3,
+                    nullptr) != pdPASS) {
+        ESP_LOGW(TAG_, "Peripheral task creation failed; probing inline");
+        if (m5::In_I2C.isEnabled()) {
+            M5.Rtc.begin(&m5::In_I2C, M5.getBoard());
+        }
+        if (M5.Rtc.isEnabled()) {
+            M5.Rtc.setSystemTimeFromRtc();
+            M5.Rtc.disableIRQ();
+        }
+        (void)rfid::Init(proto_queue);
+    }
+
+    // Serial provisioning listener (settings clone over the USB console).
+    provisioning::Init();
+
+    // Diagnostics shell on the same console: typed lines outside the
+    // provisioning frames reach registered commands (stats, dumps).
+    console_shell::Init();
+
+    // Fleet telemetry bridge: idle until a host collector arms it through
+    // the provisioning listener, then streams status/run/link records.
+    telemetry_bridge::Init();
 
-    (void)espnow::Init(proto_queue);
+    // Every subsystem has claimed its allocations; log the memory split
+    // so a budget regression shows on the first flash, not at integration.
+    mem_budget::Report();
 
     // Initialize and run UI
     ui::UiController ui(proto_queue, &settings);
@@ -76,7 +232,8 @@ extern "C" void app_main(void)
 
     while (true) {
         M5.update();
+        // Tick() blocks on the proto/encoder queue set with a computed
+        // timeout (16 ms while active, 100 ms idle), so no fixed delay here.
         ui.Tick();
-        vTaskDelay(pdMS_TO_TICKS(16));
     }
 }
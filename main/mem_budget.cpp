@@ -0,0 +1,71 @@
+/**
+ * @file mem_budget.cpp
+ * @brief Memory split accounting and the compile-time budget caps.
+ */
+
+#include "mem_budget.hpp"
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+#include "input_trace.hpp"
+#include "protocol/espnow_protocol.hpp"
+#include "ui/ui_controller.hpp"
+
+// Image section bounds, defined by the IDF linker script.
+extern "C" char _data_start[], _data_end[];
+extern "C" char _bss_start[], _bss_end[];
+
+namespace {
+
+const char* TAG_ = "mem";
+
+// ============================================================================
+// BUDGET CAPS
+// ============================================================================
+//
+// The caps ARE the budgets: each is the size the named object is allowed
+// to grow to, with today's headroom part of the plan. Raising one is a
+// deliberate act in review, not a side effect of adding a field. These
+// fire at compile time — the cheapest possible place to catch a
+// regression; the runtime split lands in Report() and the bench report.
+
+static_assert(sizeof(ui::UiController) <= 64 * 1024,
+              "UiController static footprint over its 64 KB budget");
+static_assert(sizeof(espnow::ProtoEvent) <= 64,
+              "ProtoEvent over 64 B: the event queue multiplies this");
+static_assert(input_trace::CAPACITY * sizeof(input_trace::Event) <= 2560,
+              "input trace buffer over its 2.5 KB budget");
+
+}  // namespace
+
+void mem_budget::Get(Splits& out) noexcept
+{
+    out.data_bytes = static_cast<size_t>(_data_end - _data_start);
+    out.bss_bytes = static_cast<size_t>(_bss_end - _bss_start);
+    out.internal_total = heap_caps_get_total_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    out.internal_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    out.internal_min_free =
+        heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    out.dma_largest = heap_caps_get_largest_free_block(MALLOC_CAP_DMA);
+    out.psram_total = heap_caps_get_total_size(MALLOC_CAP_SPIRAM);
+    out.psram_free = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+}
+
+void mem_budget::Report() noexcept
+{
+    Splits s{};
+    Get(s);
+    ESP_LOGI(TAG_, "static: data %u B, bss %u B",
+             static_cast<unsigned>(s.data_bytes), static_cast<unsigned>(s.bss_bytes));
+    ESP_LOGI(TAG_, "internal heap: %u/%u KB free (floor %u KB), DMA block %u KB",
+             static_cast<unsigned>(s.internal_free / 1024),
+             static_cast<unsigned>(s.internal_total / 1024),
+             static_cast<unsigned>(s.internal_min_free / 1024),
+             static_cast<unsigned>(s.dma_largest / 1024));
+    if (s.psram_total > 0) {
+        ESP_LOGI(TAG_, "psram: %u/%u KB free",
+                 static_cast<unsigned>(s.psram_free / 1024),
+                 static_cast<unsigned>(s.psram_total / 1024));
+    }
+}
@@ -0,0 +1,53 @@
+/**
+ * @file mem_budget.hpp
+ * @brief Static/heap/PSRAM accounting with compile-time budget caps.
+ * @details RAM is the scarcest resource on this board (canvas + WiFi +
+ *          caches), and until now nobody could say where the static
+ *          budget went without running idf_size by hand. This module
+ *          makes the split visible and the big consumers bounded:
+ *
+ *          - Get()/Report(): the image's .data/.bss footprint read from
+ *            the linker symbols, plus internal-heap, DMA-capable and
+ *            PSRAM totals/floors from heap_caps. Report() logs the
+ *            table once at boot, after every subsystem has claimed its
+ *            allocations, so a regression shows up on the first flash.
+ *
+ *          - Compile-time caps (mem_budget.cpp): static_asserts pin the
+ *            dominant object sizes — UiController, the protocol event
+ *            record, the input-trace buffer — so a field creeping past
+ *            its budget fails the build, not the integration bench.
+ *
+ *          The bench firmware reports the same numbers as BENCH lines
+ *          (name=mem_*), so scripts/bench_diff.py flags a split that
+ *          regressed beyond threshold the same way it flags a slow parser.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace mem_budget {
+
+/** @brief One snapshot of the memory split. */
+struct Splits {
+    size_t data_bytes;         ///< Image .data (initialized statics)
+    size_t bss_bytes;          ///< Image .bss (zeroed statics)
+    size_t internal_total;     ///< Internal 8-bit heap capacity
+    size_t internal_free;      ///< Internal heap free right now
+    size_t internal_min_free;  ///< Lowest internal free since boot
+    size_t dma_largest;        ///< Largest DMA-capable free block
+    size_t psram_total;        ///< PSRAM heap capacity (0 if absent)
+    size_t psram_free;         ///< PSRAM free right now
+};
+
+/** @brief Fill @p out from the linker symbols and heap_caps. */
+void Get(Splits& out) noexcept;
+
+/**
+ * @brief Log the split table once
+ * @details Call after all subsystem Init()s so the heap numbers reflect
+ *          the real steady-state claim, not an empty arena.
+ */
+void Report() noexcept;
+
+}  // namespace mem_budget
@@ -6,9 +6,14 @@
 #include "espnow_peer_store.hpp"
 
 #include <cstring>
+#include <ctime>
 
 #include "esp_crc.h"
 #include "esp_log.h"
+#include "esp_system.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
 #include "nvs.h"
 
 static const char* TAG = "PeerStore";
@@ -18,6 +23,7 @@ namespace {
 const char* NVS_NAMESPACE = "espnow_peers";
 const char* KEY_PEERS = "peers";
 const char* KEY_CRC = "peers_crc";
+const char* KEY_CHANNEL = "channel";
 
 ApprovedPeer s_preconfigured_peer{};
 bool s_has_preconfigured = false;
@@ -93,6 +99,13 @@ bool PeerStore::AddPeer(SecuritySettings& sec, const uint8_t mac[6],
 {
     if (IsZeroMac(mac)) return false;
 
+    // Stamped on every (re-)pairing; replication merges resolve conflicts
+    // by this, so a re-paired unit wins over a stale replicated entry.
+    // Falls back to 0 before the RTC has synced the system clock, which
+    // merges treat as "oldest".
+    const time_t now = time(nullptr);
+    const uint32_t stamp = now > 0 ? static_cast<uint32_t>(now) : 0;
+
     for (auto& peer : sec.approved_peers) {
         if (peer.valid && MacEquals(peer.mac, mac)) {
             peer.device_type = static_cast<uint8_t>(type);
@@ -100,7 +113,8 @@ bool PeerStore::AddPeer(SecuritySettings& sec, const uint8_t mac[6],
                 strncpy(peer.name, name, sizeof(peer.name) - 1);
                 peer.name[sizeof(peer.name) - 1] = '\0';
             }
-            Save(sec);
+            peer.paired_timestamp = stamp;
+            SaveAsync(sec);
             return true;
         }
     }
@@ -109,7 +123,7 @@ bool PeerStore::AddPeer(SecuritySettings& sec, const uint8_t mac[6],
         if (!peer.valid) {
             std::memcpy(peer.mac, mac, 6);
             peer.device_type = static_cast<uint8_t>(type);
-            peer.paired_timestamp = 0;
+            peer.paired_timestamp = stamp;
             peer.valid = true;
             if (name) {
                 strncpy(peer.name, name, sizeof(peer.name) - 1);
@@ -120,7 +134,7 @@ bool PeerStore::AddPeer(SecuritySettings& sec, const uint8_t mac[6],
 
             ESP_LOGI(TAG, "Added peer: %02X:%02X:%02X:%02X:%02X:%02X (%s)",
                      mac[0], mac[1], mac[2], mac[3], mac[4], mac[5], peer.name);
-            Save(sec);
+            SaveAsync(sec);
             return true;
         }
     }
@@ -129,13 +143,51 @@ bool PeerStore::AddPeer(SecuritySettings& sec, const uint8_t mac[6],
     return false;
 }
 
+bool PeerStore::MergePeer(SecuritySettings& sec, const ApprovedPeer& incoming) noexcept
+{
+    if (IsZeroMac(incoming.mac)) return false;
+
+    for (auto& peer : sec.approved_peers) {
+        if (peer.valid && MacEquals(peer.mac, incoming.mac)) {
+            if (incoming.paired_timestamp <= peer.paired_timestamp) {
+                return false;
+            }
+            peer.device_type = incoming.device_type;
+            std::memcpy(peer.name, incoming.name, sizeof(peer.name));
+            peer.name[sizeof(peer.name) - 1] = '\0';
+            peer.paired_timestamp = incoming.paired_timestamp;
+            ESP_LOGI(TAG, "Merged newer entry for %02X:%02X:%02X:%02X:%02X:%02X (%s)",
+                     peer.mac[0], peer.mac[1], peer.mac[2],
+                     peer.mac[3], peer.mac[4], peer.mac[5], peer.name);
+            SaveAsync(sec);
+            return true;
+        }
+    }
+
+    for (auto& peer : sec.approved_peers) {
+        if (!peer.valid) {
+            peer = incoming;
+            peer.name[sizeof(peer.name) - 1] = '\0';
+            peer.valid = true;
+            ESP_LOGI(TAG, "Merged peer: %02X:%02X:%02X:%02X:%02X:%02X (%s)",
+                     peer.mac[0], peer.mac[1], peer.mac[2],
+                     peer.mac[3], peer.mac[4], peer.mac[5], peer.name);
+            SaveAsync(sec);
+            return true;
+        }
+    }
+
+    ESP_LOGW(TAG, "No room for replicated peer");
+    return false;
+}
+
 bool PeerStore::RemovePeer(SecuritySettings& sec, const uint8_t mac[6]) noexcept
 {
     for (auto& peer : sec.approved_peers) {
         if (peer.valid && MacEquals(peer.mac, mac)) {
             peer.valid = false;
             std::memset(&peer, 0, sizeof(peer));
-            Save(sec);
+            SaveAsync(sec);
             return true;
         }
     }
@@ -193,6 +245,33 @@ bool PeerStore::GetFirstPeerOfType(const SecuritySettings& sec, DeviceType type,
     return false;
 }
 
+size_t PeerStore::GetPeersOfType(const SecuritySettings& sec, DeviceType type,
+                                 uint8_t (*macs_out)[6], size_t max_out) noexcept
+{
+    const uint8_t type_val = static_cast<uint8_t>(type);
+    size_t count = 0;
+
+    if (s_has_preconfigured && s_preconfigured_peer.device_type == type_val && count < max_out) {
+        std::memcpy(macs_out[count], s_preconfigured_peer.mac, 6);
+        ++count;
+    }
+
+    for (const auto& peer : sec.approved_peers) {
+        if (count >= max_out) {
+            break;
+        }
+        if (peer.valid && peer.device_type == type_val) {
+            // Skip a duplicate of the pre-configured entry.
+            if (s_has_preconfigured && std::memcmp(peer.mac, s_preconfigured_peer.mac, 6) == 0) {
+                continue;
+            }
+            std::memcpy(macs_out[count], peer.mac, 6);
+            ++count;
+        }
+    }
+    return count;
+}
+
 void PeerStore::Save(const SecuritySettings& sec) noexcept
 {
     nvs_handle_t h;
@@ -216,6 +295,118 @@ void PeerStore::Save(const SecuritySettings& sec) noexcept
     nvs_close(h);
 }
 
+// ============================================================================
+// ASYNC PERSISTENCE
+// ============================================================================
+//
+// Pairing flows trigger several saves back-to-back (add, rename, confirm),
+// each a blocking NVS commit if done synchronously in the protocol path.
+// Mutations therefore queue a snapshot of the whole list; a low-priority
+// writer absorbs the burst and commits only the final state, so pairing
+// completion is bounded by radio round-trips rather than flash latency.
+
+namespace {
+
+constexpr uint32_t SAVE_DEBOUNCE_MS_ = 500;      ///< Coalescing window
+constexpr uint32_t WRITER_TASK_STACK_ = 3072;    ///< Writer stack size
+constexpr UBaseType_t WRITER_TASK_PRIO_ = 1;     ///< Just above idle
+
+QueueHandle_t s_save_queue_ = nullptr;  ///< Depth 1; newest snapshot wins
+SecuritySettings s_pending_{};          ///< Snapshot the writer is holding
+volatile bool s_pending_dirty_ = false; ///< Snapshot not yet committed
+
+/**
+ * @brief Low-priority writer task: debounce, coalesce, commit
+ * @details Same shape as the settings writer: block for a snapshot, absorb
+ *          newer ones until the debounce window passes quietly, then do a
+ *          single CRC-stamped commit.
+ */
+void peerWriterTask(void* /*arg*/)
+{
+    while (true) {
+        if (xQueueReceive(s_save_queue_, &s_pending_, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        s_pending_dirty_ = true;
+        while (xQueueReceive(s_save_queue_, &s_pending_, pdMS_TO_TICKS(SAVE_DEBOUNCE_MS_)) == pdTRUE) {
+        }
+        PeerStore::Save(s_pending_);
+        s_pending_dirty_ = false;
+    }
+}
+
+/** @brief Shutdown hook: commit whatever the writer has not flushed yet. */
+void peerShutdownFlush(void)
+{
+    PeerStore::Flush();
+}
+
+} // namespace
+
+void PeerStore::SaveAsync(const SecuritySettings& sec) noexcept
+{
+    if (s_save_queue_ == nullptr) {
+        s_save_queue_ = xQueueCreate(1, sizeof(SecuritySettings));
+        if (s_save_queue_ == nullptr ||
+            xTaskCreate(peerWriterTask, "peers_wr", WRITER_TASK_STACK_, nullptr,
+                        WRITER_TASK_PRIO_, nullptr) != pdPASS) {
+            ESP_LOGW(TAG, "Async writer unavailable; saving synchronously");
+            if (s_save_queue_ != nullptr) {
+                vQueueDelete(s_save_queue_);
+                s_save_queue_ = nullptr;
+            }
+            Save(sec);
+            return;
+        }
+        (void)esp_register_shutdown_handler(&peerShutdownFlush);
+    }
+    (void)xQueueOverwrite(s_save_queue_, &sec);
+}
+
+void PeerStore::Flush() noexcept
+{
+    if (s_save_queue_ != nullptr) {
+        if (xQueueReceive(s_save_queue_, &s_pending_, 0) == pdTRUE) {
+            s_pending_dirty_ = true;
+        }
+    }
+    if (s_pending_dirty_) {
+        Save(s_pending_);
+        s_pending_dirty_ = false;
+    }
+}
+
+bool PeerStore::LoadChannel(uint8_t& channel_out) noexcept
+{
+    nvs_handle_t h;
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &h) != ESP_OK) {
+        return false;
+    }
+    uint8_t ch = 0;
+    const esp_err_t err = nvs_get_u8(h, KEY_CHANNEL, &ch);
+    nvs_close(h);
+    if (err != ESP_OK) {
+        return false;
+    }
+    channel_out = ch;
+    return true;
+}
+
+void PeerStore::SaveChannel(uint8_t channel) noexcept
+{
+    nvs_handle_t h;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &h);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to open NVS: %s", esp_err_to_name(err));
+        return;
+    }
+    err = nvs_set_u8(h, KEY_CHANNEL, channel);
+    if (err == ESP_OK) {
+        nvs_commit(h);
+    }
+    nvs_close(h);
+}
+
 size_t PeerStore::GetPeerCount(const SecuritySettings& sec) noexcept
 {
     size_t count = s_has_preconfigured ? 1 : 0;
@@ -231,7 +422,7 @@ void PeerStore::ClearAll(SecuritySettings& sec) noexcept
         peer.valid = false;
         std::memset(&peer, 0, sizeof(peer));
     }
-    Save(sec);
+    SaveAsync(sec);
 }
 
 void PeerStore::LogPeers(const SecuritySettings& sec) noexcept
@@ -38,6 +38,19 @@ void Init(SecuritySettings& sec,
 bool AddPeer(SecuritySettings& sec, const uint8_t mac[6],
              DeviceType type, const char* name) noexcept;
 
+/**
+ * @brief Merge one replicated peer entry (newest-wins by pairing timestamp)
+ * @details Allowlist replication between remotes: an unknown MAC takes a
+ *          free slot as-is; a known MAC is overwritten only when the
+ *          incoming entry carries a newer paired_timestamp. The incoming
+ *          timestamp is preserved either way, so a table can be relayed
+ *          through several remotes without every hop looking "newest".
+ * @param sec Security settings structure
+ * @param incoming Replicated entry (valid flag ignored)
+ * @return true if the entry changed the table
+ */
+bool MergePeer(SecuritySettings& sec, const ApprovedPeer& incoming) noexcept;
+
 /**
  * @brief Remove a peer from the approved list
  * @param sec Security settings structure
@@ -72,12 +85,58 @@ const ApprovedPeer* GetPeer(const SecuritySettings& sec, const uint8_t mac[6]) n
 bool GetFirstPeerOfType(const SecuritySettings& sec, DeviceType type,
                         uint8_t mac_out[6]) noexcept;
 
+/**
+ * @brief Enumerate all peers of specified device type
+ * @param sec Security settings structure
+ * @param type Device type to search for
+ * @param macs_out Output array of MAC addresses (6 bytes each)
+ * @param max_out Capacity of @p macs_out
+ * @return Number of MAC addresses written
+ */
+size_t GetPeersOfType(const SecuritySettings& sec, DeviceType type,
+                      uint8_t (*macs_out)[6], size_t max_out) noexcept;
+
 /**
  * @brief Save peer list to NVS
  * @param sec Security settings structure to save
  */
 void Save(const SecuritySettings& sec) noexcept;
 
+/**
+ * @brief Queue a peer list snapshot for asynchronous persistence
+ * @details Write-behind: the in-RAM list is already authoritative when this
+ *          returns; a low-priority writer coalesces the back-to-back saves
+ *          a pairing flow produces and commits once (blob + CRC32, which
+ *          Init() validates on load). Falls back to a synchronous Save()
+ *          if the writer cannot be created.
+ * @param sec Security settings structure to snapshot
+ */
+void SaveAsync(const SecuritySettings& sec) noexcept;
+
+/**
+ * @brief Commit any snapshot the async writer has not persisted yet
+ * @details Registered as a shutdown handler by the first SaveAsync().
+ */
+void Flush() noexcept;
+
+/**
+ * @brief Load the persisted ESP-NOW working channel
+ * @details Written by the protocol layer's channel-agility logic once a hop
+ *          has been confirmed, so the device rejoins its peers on the last
+ *          known-good channel after a reboot.
+ * @param channel_out Receives the stored channel number
+ * @return true if a stored channel exists, false otherwise
+ */
+bool LoadChannel(uint8_t& channel_out) noexcept;
+
+/**
+ * @brief Persist the ESP-NOW working channel
+ * @details Synchronous single-key write; callers only invoke this after a
+ *          confirmed channel hop, which is rare, so no write-behind needed.
+ * @param channel Channel number to store
+ */
+void SaveChannel(uint8_t channel) noexcept;
+
 /**
  * @brief Get count of approved peers
  * @param sec Security settings structure
@@ -7,14 +7,27 @@
 
 #include "espnow_peer_store.hpp"
 
+#include "../blackbox.hpp"
 #include "../config.hpp"
+#include "../fast_boot.hpp"
+#include "../health_monitor.hpp"
+#include "../queue_stats.hpp"
+#include "../timebase.hpp"
+#include "../trace.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstring>
 
 #include "esp_event.h"
 #include "esp_netif.h"
+#include "esp_ota_ops.h"
+#include "esp_system.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
+#include "freertos/semphr.h"
 #include "freertos/task.h"
 
 static const char* TAG_ = "espnow";
@@ -23,6 +36,12 @@ static QueueHandle_t s_proto_event_queue_ = nullptr;
 static uint8_t s_next_msg_id_ = 1;
 static QueueHandle_t s_raw_recv_queue_ = nullptr;
 
+// queue_stats registry slots (-1 until registered); the proto event queue
+// is created in main, so its slot is looked up once in Init.
+static int8_t s_qs_rawrx_ = -1;
+static int8_t s_qs_proto_ = -1;
+static int8_t s_qs_pairing_ = -1;
+
 static SecuritySettings s_security_{};
 
 static espnow::PairingState s_pairing_state_ = espnow::PairingState::Idle;
@@ -30,18 +49,177 @@ static uint8_t s_my_challenge_[CHALLENGE_SIZE] = {0};
 static TickType_t s_pairing_timeout_tick_ = 0;
 
 struct RawMsg {
+    // Two reserve bytes ahead of the frame put the payload (frame start +
+    // 6-byte header) on a 4-byte boundary — the network-stack receive-skew
+    // trick — so the aligned parse fast paths in fatigue_protocol.hpp take
+    // for every pooled buffer.
+    uint8_t reserve_[2];
     uint8_t data[sizeof(espnow::EspNowPacket)];
     int len;
     uint8_t src_mac[6];
+    int8_t rssi;  ///< Receive RSSI in dBm, sampled from rx_ctrl in the callback
+    uint16_t crc_calc;  ///< CRC accumulated during the receive copy
+    bool crc_known;     ///< crc_calc is valid (frame length matched its header)
+    std::atomic<int8_t> refs{0};  ///< Outstanding consumers (see retainRxBuffer)
+};
+static_assert((offsetof(RawMsg, data) + sizeof(espnow::EspNowHeader)) % 4 == 0,
+              "Pooled payloads must start word-aligned");
+
+// Fixed pool of receive buffers. The recv callback grabs a free buffer,
+// copies the frame into it once, and only the pointer travels through the
+// queues from then on - no further payload copies until ReleaseEvent().
+// Buffers are reference-counted so the same one can sit behind several
+// consumer queues at once (see AddEventSubscriber); it returns to the
+// pool when the last holder releases.
+static constexpr size_t RX_POOL_SIZE_ = 16;
+static RawMsg s_rx_pool_[RX_POOL_SIZE_];
+static QueueHandle_t s_rx_free_queue_ = nullptr;  ///< Queue of free RawMsg*
+
+// Subscriber fan-out (see AddEventSubscriber). Startup-only registration,
+// so the table needs no lock — same contract as queue_stats::Register.
+static constexpr size_t MAX_EVENT_SUBS_ = 3;
+static QueueHandle_t s_event_subs_[MAX_EVENT_SUBS_] = {};
+static size_t s_event_sub_count_ = 0;
+
+// Reliable delivery: Command and ConfigSet packets are tracked in an
+// in-flight table keyed on the header id byte and retransmitted with
+// exponential backoff until the matching CommandAck/ConfigAck arrives.
+static constexpr size_t INFLIGHT_SIZE_ = 8;       ///< Max concurrent tracked sends
+static constexpr uint32_t RETRY_BASE_MS_ = 60;    ///< First retransmit delay
+static constexpr uint8_t RETRY_MAX_ = 5;          ///< Retransmits before giving up
+
+struct InflightEntry {
+    bool valid;                                   ///< Slot in use
+    uint8_t msg_id;                               ///< Header id of the tracked packet
+    uint8_t device_id;                            ///< Destination device id
+    espnow::MsgType type;                         ///< Command or ConfigSet
+    uint8_t dst_mac[6];                           ///< Destination MAC
+    uint8_t payload[espnow::MAX_PAYLOAD_SIZE_];   ///< Payload for retransmission
+    uint8_t payload_len;                          ///< Payload length
+    uint8_t retries;                              ///< Retransmits performed so far
+    TickType_t first_tick;                        ///< Original send time (for RTT)
+    TickType_t next_retry_tick;                   ///< When to retransmit next
+};
+
+static InflightEntry s_inflight_[INFLIGHT_SIZE_];
+static SemaphoreHandle_t s_inflight_mutex_ = nullptr;
+
+/// Per-peer smoothed round-trip time (EWMA, alpha = 1/8)
+struct PeerRtt {
+    bool valid;
+    uint8_t mac[6];
+    uint32_t srtt_ms;
+};
+static PeerRtt s_peer_rtt_[MAX_APPROVED_PEERS];
+
+/// Per-peer receive-side link quality. RSSI is an EWMA over authenticated
+/// frames; loss is estimated from gaps in the peer's header id sequence
+/// (the sender numbers every outgoing packet from one counter, so a jump
+/// of N means N-1 frames went somewhere we did not hear). Written only on
+/// the receive task, read without a lock like s_peer_rtt_.
+struct PeerLinkQual {
+    bool valid;
+    uint8_t mac[6];
+    int32_t rssi_ewma;     ///< Smoothed RSSI, dBm (EWMA, alpha = 1/8)
+    uint8_t last_id;       ///< Last header id seen from this peer (any type)
+    uint16_t delivered;    ///< Frames heard in the current loss window
+    uint16_t missed;       ///< Frames inferred lost in the current loss window
+    uint8_t loss_pct;      ///< Latest loss estimate, percent
 };
+static PeerLinkQual s_peer_qual_[MAX_APPROVED_PEERS];
+static constexpr uint16_t QUAL_WINDOW_ = 64;  ///< Halve counters past this many samples
+
+/// Channel ESP-NOW is operating on; declared up here because peer
+/// registration needs it, managed by the channel-agility section below.
+static uint8_t s_channel_ = espnow::WIFI_CHANNEL_;
 
 // Forward declarations
 static void espnowRecvCb(const esp_now_recv_info_t* info, const uint8_t* data, int len);
 static void espnowSendCb(const wifi_tx_info_t* info, esp_now_send_status_t status);
 static void recvTask(void*);
-static void handlePacket(const RawMsg& msg, const uint8_t* data, int len);
-static void handlePairingResponse(const uint8_t* src_mac, const espnow::EspNowPacket& pkt);
-static void handlePairingReject(const uint8_t* src_mac, const espnow::EspNowPacket& pkt);
+static bool handlePacket(RawMsg& msg);
+static bool handlePairingResponse(RawMsg& msg, const espnow::EspNowHeader& hdr, const uint8_t* payload);
+static void handlePairingReject(const uint8_t* src_mac, const espnow::EspNowHeader& hdr);
+// Multi-remote arbitration gate (defined with the lease section below):
+// claims the controller lease on first use, refuses writes while passive.
+static bool leaseAllowsWrite();
+static bool queueProtoEvent(espnow::ProtoEvent& evt);
+static void pairingWorkTask(void*);
+
+// ---------------------------------------------------------------------------
+// Message registry. One row per wire MsgType: payload bounds, the pipeline
+// stage that consumes it, a handler for protocol-consumed traffic and the
+// queue-policy class. handlePacket validates lengths from the row and
+// dispatches by indexed lookup instead of a hand-grown if-chain; adding a
+// message is a row in buildMsgSpecs_ (plus its wire-size pin below it).
+// The row types live up here because the queue policy (isTelemetryEvent /
+// isPriorityEvent) reads the class column; the table itself is built next
+// to handlePacket, after the wire structs it takes sizeof from.
+// ---------------------------------------------------------------------------
+
+/// Pipeline stage at which a message is consumed.
+enum class MsgStage : uint8_t {
+    App = 0,   ///< Queued to subscribers after the full gate chain
+    PreAuth,   ///< Consumed before the approved-peer gate
+    PostAuth,  ///< Consumed after the gate but outside the receive window
+    PostSeq,   ///< Consumed after duplicate suppression
+};
+
+/// Queue-policy class (see queueProtoEvent for the eviction rules).
+enum class MsgQos : uint8_t {
+    Normal = 0,  ///< Neither droppable nor privileged
+    Telemetry,   ///< Idempotent; may be evicted under queue pressure
+    Priority,    ///< Must never be starved by telemetry
+};
+
+using MsgHandler = bool (*)(RawMsg& msg, const espnow::EspNowHeader& hdr,
+                            const uint8_t* payload);
+
+/// One registry row. Bounds are structural prefixes: handlers keep their
+/// own format checks (HMAC, state machine) behind them.
+struct MsgSpec {
+    uint8_t min_len = 0;
+    uint8_t max_len = espnow::MAX_PAYLOAD_SIZE_;
+    MsgStage stage = MsgStage::App;
+    MsgQos qos = MsgQos::Normal;
+    MsgHandler handler = nullptr;
+};
+
+static const MsgSpec& specForType_(uint8_t type);
+
+// Pairing crypto worker: HMAC-SHA256 verification takes long enough to
+// delay telemetry if run on the receive task, so validated pairing frames
+// are handed to this queue instead (buffer ownership moves with the
+// pointer). Depth covers a full discovery burst.
+static constexpr size_t PAIRING_WORK_DEPTH_ = 4;
+static QueueHandle_t s_pairing_work_queue_ = nullptr;
+
+/**
+ * @brief Return a receive buffer to the free pool
+ * @param buf Buffer to release
+ */
+static void releaseRxBuffer(RawMsg* buf)
+{
+    if (buf != nullptr && s_rx_free_queue_ != nullptr) {
+        // Last consumer out returns the buffer; each fan-out delivery
+        // holds one reference (see retainRxBuffer).
+        if (buf->refs.fetch_sub(1, std::memory_order_acq_rel) <= 1) {
+            xQueueSend(s_rx_free_queue_, &buf, 0);
+        }
+    }
+}
+
+/**
+ * @brief Take an additional reference on a pooled buffer
+ * @details One matching releaseRxBuffer per retain; the dispense path in
+ *          the receive callback resets the count to one.
+ */
+static void retainRxBuffer(RawMsg* buf)
+{
+    if (buf != nullptr) {
+        buf->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+}
 
 /**
  * @brief Try to add ESP-NOW peer (ignores if already exists)
@@ -53,7 +231,7 @@ static void tryAddEspNowPeer(const uint8_t mac[6])
 
     esp_now_peer_info_t peer{};
     std::memcpy(peer.peer_addr, mac, 6);
-    peer.channel = espnow::WIFI_CHANNEL_;
+    peer.channel = s_channel_;
     peer.ifidx = WIFI_IF_STA;
     peer.encrypt = false;
     const esp_err_t err = esp_now_add_peer(&peer);
@@ -62,42 +240,233 @@ static void tryAddEspNowPeer(const uint8_t mac[6])
     }
 }
 
+// ============================================================================
+// TX SCHEDULER
+// ============================================================================
+//
+// esp_now_send used to be called directly from whatever task invoked a Send
+// API, so a settings burst (ConfigSet + ConfigRequest + discovery) collided
+// with its own frames and with telemetry acks on air. Frames are now staged
+// in a fixed pool and drained by a dedicated sender task that holds exactly
+// one frame in the MAC at a time: the next send waits for the previous
+// frame's send-callback completion, which is what actually serializes
+// airtime. Command-class frames drain before bulk polls, equal-class picks
+// alternate peers so a burst to one unit cannot starve the rest, and bulk
+// frames are followed by a short gap derived from the measured per-frame
+// airtime so the peer's replies get a clear channel. If the sender task is
+// unavailable (or the pool overflows) sends fall back to the old direct
+// path, preserving behavior at the cost of pacing.
+
+static constexpr size_t TX_POOL_SIZE_ = 12;        ///< Staged frames (covers a settings burst)
+static constexpr uint32_t TX_DONE_TIMEOUT_MS_ = 50; ///< Max wait for a send callback
+static constexpr uint32_t TX_AIR_ALPHA_DIV_ = 8;    ///< Airtime EWMA divisor (alpha = 1/8)
+
+/// One staged frame, wire-ready (header + payload + CRC already packed)
+struct TxEntry {
+    bool valid;          ///< Slot in use
+    bool priority;       ///< Command class: drained before bulk
+    uint8_t dst_mac[6];  ///< Destination MAC
+    uint8_t len;         ///< Frame length in bytes
+    uint16_t seq;        ///< Enqueue order within the pool
+    uint8_t frame[sizeof(espnow::EspNowHeader) + espnow::MAX_PAYLOAD_SIZE_ + sizeof(uint16_t)];
+};
+
+static TxEntry s_tx_pool_[TX_POOL_SIZE_];
+static SemaphoreHandle_t s_tx_mutex_ = nullptr;    ///< Guards the TX pool
+static SemaphoreHandle_t s_tx_pending_ = nullptr;  ///< Counting: frames staged
+static SemaphoreHandle_t s_tx_done_ = nullptr;     ///< Binary: send callback fired
+static TaskHandle_t s_tx_task_ = nullptr;          ///< Sender task (null => direct sends)
+static uint16_t s_tx_seq_ = 0;                     ///< Monotonic enqueue counter
+static uint8_t s_tx_last_mac_[6];                  ///< Peer served by the previous send
+static uint32_t s_tx_air_us_ = 0;                  ///< EWMA of send->callback latency
+
 /**
- * @brief Send ESP-NOW packet to specific MAC address
+ * @brief True for frame types that must not queue behind bulk traffic
+ * @details Commands, config writes and their acks carry user intent; probe
+ *          frames feed the RTT estimator and would be skewed by queueing.
+ *          Bulk is the periodic ConfigRequest poll, discovery, and transfer
+ *          chunks — the post-send airtime gap is the transfer backpressure.
+ */
+static bool isPriorityTx(espnow::MsgType type)
+{
+    switch (type) {
+        case espnow::MsgType::ConfigRequest:
+        case espnow::MsgType::DeviceDiscovery:
+        case espnow::MsgType::TransferChunk:
+            return false;
+        default:
+            return true;
+    }
+}
+
+/**
+ * @brief Pack a frame into wire format
+ * @return Total frame length
+ */
+static size_t txPackFrame(uint8_t* out, uint8_t device_id, espnow::MsgType type,
+                          uint8_t msg_id, const void* payload, uint8_t payload_len)
+{
+    auto* hdr = reinterpret_cast<espnow::EspNowHeader*>(out);
+    hdr->sync = espnow::SYNC_BYTE_;
+    hdr->version = espnow::PROTOCOL_VERSION_;
+    hdr->device_id = device_id;
+    hdr->type = static_cast<uint8_t>(type);
+    hdr->id = msg_id;
+    hdr->len = payload_len;
+    // The CRC accumulates during the payload copy itself, so the frame is
+    // read once here instead of copy + full re-read.
+    espnow::Crc16Stream crc_stream;
+    crc_stream.update(out, sizeof(espnow::EspNowHeader));
+    if (payload_len > 0 && payload != nullptr) {
+        crc_stream.updateCopy(out + sizeof(espnow::EspNowHeader),
+                              static_cast<const uint8_t*>(payload), payload_len);
+    }
+    const size_t crc_data_len = sizeof(espnow::EspNowHeader) + payload_len;
+    const uint16_t crc = crc_stream.finish();
+    std::memcpy(out + crc_data_len, &crc, sizeof(uint16_t));
+    return crc_data_len + sizeof(uint16_t);
+}
+
+/**
+ * @brief Pick the next staged frame to transmit (pool mutex held)
+ * @details Command class before bulk; within a class a frame for a peer
+ *          other than the last-served one wins, then enqueue order.
+ * @return Pool index, or -1 if nothing is staged
+ */
+static int txPickNext()
+{
+    int best = -1;
+    for (size_t i = 0; i < TX_POOL_SIZE_; ++i) {
+        const TxEntry& e = s_tx_pool_[i];
+        if (!e.valid) {
+            continue;
+        }
+        if (best < 0) {
+            best = (int)i;
+            continue;
+        }
+        const TxEntry& b = s_tx_pool_[best];
+        if (e.priority != b.priority) {
+            if (e.priority) {
+                best = (int)i;
+            }
+            continue;
+        }
+        const bool e_other = std::memcmp(e.dst_mac, s_tx_last_mac_, 6) != 0;
+        const bool b_other = std::memcmp(b.dst_mac, s_tx_last_mac_, 6) != 0;
+        if (e_other != b_other) {
+            if (e_other) {
+                best = (int)i;
+            }
+            continue;
+        }
+        if ((int16_t)(e.seq - b.seq) < 0) {
+            best = (int)i;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Sender task: one frame in the MAC at a time, paced by completion
+ */
+static void txTask(void* arg)
+{
+    (void)arg;
+    while (true) {
+        if (xSemaphoreTake(s_tx_pending_, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        TxEntry local{};
+        xSemaphoreTake(s_tx_mutex_, portMAX_DELAY);
+        const int idx = txPickNext();
+        if (idx >= 0) {
+            local = s_tx_pool_[idx];
+            s_tx_pool_[idx].valid = false;
+            std::memcpy(s_tx_last_mac_, local.dst_mac, 6);
+        }
+        xSemaphoreGive(s_tx_mutex_);
+        if (idx < 0) {
+            continue;
+        }
+
+        // Clear any completion left over from a direct-path fallback send.
+        (void)xSemaphoreTake(s_tx_done_, 0);
+        const int64_t t0_us = esp_timer_get_time();
+        const esp_err_t err = esp_now_send(local.dst_mac, local.frame, local.len);
+        if (err != ESP_OK) {
+            // No callback will come; tracked types are covered by the
+            // retransmit engine, everything else was fire-and-forget anyway.
+            ESP_LOGE(TAG_, "esp_now_send error: %s", esp_err_to_name(err));
+            continue;
+        }
+        if (xSemaphoreTake(s_tx_done_, pdMS_TO_TICKS(TX_DONE_TIMEOUT_MS_)) == pdTRUE) {
+            const uint32_t air_us = (uint32_t)(esp_timer_get_time() - t0_us);
+            s_tx_air_us_ = (s_tx_air_us_ == 0)
+                               ? air_us
+                               : s_tx_air_us_ - s_tx_air_us_ / TX_AIR_ALPHA_DIV_ +
+                                     air_us / TX_AIR_ALPHA_DIV_;
+        }
+        // Leave one measured airtime of clear channel after a bulk frame so
+        // the polled peer's response is not met by our next transmission.
+        if (!local.priority && s_tx_air_us_ > 0) {
+            uint32_t gap_ms = s_tx_air_us_ / 1000U;
+            if (gap_ms < 1U) {
+                gap_ms = 1U;
+            } else if (gap_ms > 5U) {
+                gap_ms = 5U;
+            }
+            vTaskDelay(pdMS_TO_TICKS(gap_ms));
+        }
+    }
+}
+
+/**
+ * @brief Send ESP-NOW packet with an explicit header id (used for retransmits)
+ * @details Frames are normally staged for the sender task; without a
+ *          scheduler (init failure) or with a full pool they go straight to
+ *          esp_now_send as before.
  * @param dst_mac Destination MAC address (6 bytes)
  * @param device_id Device identifier
  * @param type Message type
+ * @param msg_id Header sequence id to use
  * @param payload Payload data (may be nullptr)
  * @param payload_len Payload length
- * @return true if send successful, false otherwise
+ * @return true if send/staging successful, false otherwise
  */
-static bool sendPacketTo(const uint8_t* dst_mac, uint8_t device_id,
-                         espnow::MsgType type, const void* payload, uint8_t payload_len)
+static bool sendPacketRaw(const uint8_t* dst_mac, uint8_t device_id,
+                          espnow::MsgType type, uint8_t msg_id,
+                          const void* payload, uint8_t payload_len)
 {
     if (payload_len > espnow::MAX_PAYLOAD_SIZE_) {
         ESP_LOGE(TAG_, "Payload too big: %u", payload_len);
         return false;
     }
 
-    uint8_t send_buf[sizeof(espnow::EspNowHeader) + espnow::MAX_PAYLOAD_SIZE_ + sizeof(uint16_t)];
-
-    auto* hdr = reinterpret_cast<espnow::EspNowHeader*>(send_buf);
-    hdr->sync = espnow::SYNC_BYTE_;
-    hdr->version = espnow::PROTOCOL_VERSION_;
-    hdr->device_id = device_id;
-    hdr->type = static_cast<uint8_t>(type);
-    hdr->id = s_next_msg_id_++;
-    hdr->len = payload_len;
-
-    if (payload_len > 0 && payload != nullptr) {
-        std::memcpy(send_buf + sizeof(espnow::EspNowHeader), payload, payload_len);
+    if (s_tx_task_ != nullptr) {
+        xSemaphoreTake(s_tx_mutex_, portMAX_DELAY);
+        for (size_t i = 0; i < TX_POOL_SIZE_; ++i) {
+            TxEntry& e = s_tx_pool_[i];
+            if (e.valid) {
+                continue;
+            }
+            e.len = (uint8_t)txPackFrame(e.frame, device_id, type, msg_id,
+                                         payload, payload_len);
+            std::memcpy(e.dst_mac, dst_mac, 6);
+            e.priority = isPriorityTx(type);
+            e.seq = s_tx_seq_++;
+            e.valid = true;
+            xSemaphoreGive(s_tx_mutex_);
+            xSemaphoreGive(s_tx_pending_);
+            return true;
+        }
+        xSemaphoreGive(s_tx_mutex_);
+        ESP_LOGW(TAG_, "TX pool full; sending direct");
     }
 
-    const size_t crc_data_len = sizeof(espnow::EspNowHeader) + payload_len;
-    const uint16_t crc = espnow::crc16_ccitt(send_buf, crc_data_len);
-    std::memcpy(send_buf + crc_data_len, &crc, sizeof(uint16_t));
-
-    const size_t total_len = crc_data_len + sizeof(uint16_t);
+    uint8_t send_buf[sizeof(espnow::EspNowHeader) + espnow::MAX_PAYLOAD_SIZE_ + sizeof(uint16_t)];
+    const size_t total_len = txPackFrame(send_buf, device_id, type, msg_id,
+                                         payload, payload_len);
     const esp_err_t err = esp_now_send(dst_mac, send_buf, total_len);
     if (err != ESP_OK) {
         ESP_LOGE(TAG_, "esp_now_send error: %s", esp_err_to_name(err));
@@ -107,427 +476,4692 @@ static bool sendPacketTo(const uint8_t* dst_mac, uint8_t device_id,
 }
 
 /**
- * @brief Send ESP-NOW packet to target device (first FatigueTester peer)
+ * @brief Send ESP-NOW packet to specific MAC address
+ * @param dst_mac Destination MAC address (6 bytes)
  * @param device_id Device identifier
  * @param type Message type
  * @param payload Payload data (may be nullptr)
  * @param payload_len Payload length
- * @return true if send successful, false if no target configured
+ * @return true if send successful, false otherwise
  */
-static bool sendPacketToTarget(uint8_t device_id, espnow::MsgType type,
-                               const void* payload, uint8_t payload_len)
+static bool sendPacketTo(const uint8_t* dst_mac, uint8_t device_id,
+                         espnow::MsgType type, const void* payload, uint8_t payload_len)
 {
-    uint8_t target_mac[6];
-    if (!espnow::GetTargetDeviceMac(target_mac)) {
-        ESP_LOGW(TAG_, "No target device configured");
-        return false;
+    return sendPacketRaw(dst_mac, device_id, type, s_next_msg_id_++, payload, payload_len);
+}
+
+/**
+ * @brief Record an acknowledged message type's packet in the in-flight table
+ * @details The packet keeps its original header id across retransmits so the
+ *          responder sees a duplicate, not a new message. If the table is
+ *          full the send degrades to fire-and-forget with a warning.
+ */
+static void trackInflight(const uint8_t* dst_mac, uint8_t device_id, espnow::MsgType type,
+                          uint8_t msg_id, const void* payload, uint8_t payload_len)
+{
+    if (s_inflight_mutex_ == nullptr) {
+        return;
+    }
+    xSemaphoreTake(s_inflight_mutex_, portMAX_DELAY);
+    InflightEntry* slot = nullptr;
+    for (size_t i = 0; i < INFLIGHT_SIZE_; ++i) {
+        if (!s_inflight_[i].valid) {
+            slot = &s_inflight_[i];
+            break;
+        }
+    }
+    if (slot == nullptr) {
+        xSemaphoreGive(s_inflight_mutex_);
+        ESP_LOGW(TAG_, "In-flight table full; msg id=%u is fire-and-forget", msg_id);
+        return;
     }
-    return sendPacketTo(target_mac, device_id, type, payload, payload_len);
+
+    const TickType_t now = xTaskGetTickCount();
+    slot->valid = true;
+    slot->msg_id = msg_id;
+    slot->device_id = device_id;
+    slot->type = type;
+    std::memcpy(slot->dst_mac, dst_mac, 6);
+    slot->payload_len = payload_len;
+    if (payload_len > 0 && payload != nullptr) {
+        std::memcpy(slot->payload, payload, payload_len);
+    }
+    slot->retries = 0;
+    slot->first_tick = now;
+    slot->next_retry_tick = now + pdMS_TO_TICKS(RETRY_BASE_MS_);
+    ++s_link_stats_.tracked_sent;
+    xSemaphoreGive(s_inflight_mutex_);
 }
 
-bool espnow::Init(QueueHandle_t event_queue) noexcept
+// Link statistics: guarded by s_inflight_mutex_, since every mutation site
+// already runs inside its critical sections.
+static espnow::LinkStats s_link_stats_{};
+
+/**
+ * @brief Record an ack RTT sample into the log-scale histogram
+ */
+static void recordLatencySample(uint32_t rtt_ms)
 {
-    s_proto_event_queue_ = event_queue;
-    s_raw_recv_queue_ = xQueueCreate(10, sizeof(RawMsg));
+    size_t bucket = 0;
+    while (bucket + 1 < espnow::LinkStats::HIST_BUCKETS && (rtt_ms >> (bucket + 1)) != 0) {
+        ++bucket;
+    }
+    ++s_link_stats_.hist[bucket];
+}
 
-    // Initialize peer store with pre-configured MAC (backward compatibility)
-    PeerStore::Init(s_security_, TEST_UNIT_MAC_, DeviceType::FatigueTester, "Pre-configured");
+/**
+ * @brief Update a peer's smoothed RTT with a new sample (EWMA, alpha = 1/8)
+ */
+static void updatePeerRtt(const uint8_t mac[6], uint32_t sample_ms)
+{
+    PeerRtt* slot = nullptr;
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        if (s_peer_rtt_[i].valid && std::memcmp(s_peer_rtt_[i].mac, mac, 6) == 0) {
+            slot = &s_peer_rtt_[i];
+            break;
+        }
+        if (slot == nullptr && !s_peer_rtt_[i].valid) {
+            slot = &s_peer_rtt_[i];
+        }
+    }
+    if (slot == nullptr) {
+        return;
+    }
+    if (!slot->valid) {
+        slot->valid = true;
+        std::memcpy(slot->mac, mac, 6);
+        slot->srtt_ms = sample_ms;
+    } else {
+        const int32_t delta = static_cast<int32_t>(sample_ms) - static_cast<int32_t>(slot->srtt_ms);
+        slot->srtt_ms = static_cast<uint32_t>(static_cast<int32_t>(slot->srtt_ms) + delta / 8);
+    }
+}
 
-    esp_err_t err = esp_netif_init();
-    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
-        ESP_LOGE(TAG_, "esp_netif_init failed: %s", esp_err_to_name(err));
-        return false;
+/**
+ * @brief Fold an authenticated frame into the peer's link-quality estimate
+ * @details Runs on the receive task for every frame that passed the
+ *          security gate. Smooths RSSI with the same alpha as the RTT
+ *          estimator, and infers loss from gaps in the peer's header id:
+ *          ids increment per packet on the sender, so hearing id N after
+ *          id N-4 means three frames were either lost or sent to another
+ *          destination. Counters halve past QUAL_WINDOW_ samples so the
+ *          percentage tracks recent conditions.
+ */
+static void linkQualNoteRx(const uint8_t mac[6], uint8_t id, int8_t rssi)
+{
+    PeerLinkQual* slot = nullptr;
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        if (s_peer_qual_[i].valid && std::memcmp(s_peer_qual_[i].mac, mac, 6) == 0) {
+            slot = &s_peer_qual_[i];
+            break;
+        }
+        if (slot == nullptr && !s_peer_qual_[i].valid) {
+            slot = &s_peer_qual_[i];
+        }
+    }
+    if (slot == nullptr) {
+        return;
+    }
+    if (!slot->valid) {
+        slot->valid = true;
+        std::memcpy(slot->mac, mac, 6);
+        slot->rssi_ewma = rssi;
+        slot->last_id = id;
+        slot->delivered = 1;
+        slot->missed = 0;
+        slot->loss_pct = 0;
+        return;
     }
 
-    err = esp_event_loop_create_default();
-    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
-        ESP_LOGE(TAG_, "esp_event_loop_create_default failed: %s", esp_err_to_name(err));
-        return false;
+    slot->rssi_ewma += (static_cast<int32_t>(rssi) - slot->rssi_ewma) / 8;
+
+    // Gap in the id sequence since the last frame we heard. Retransmits
+    // and reordering show up as small or backward steps; only count
+    // plausible forward jumps as loss.
+    const uint8_t gap = static_cast<uint8_t>(id - slot->last_id);
+    if (gap >= 1 && gap < QUAL_WINDOW_) {
+        slot->delivered += 1;
+        slot->missed += gap - 1;
+        slot->last_id = id;
+    } else if (gap >= QUAL_WINDOW_) {
+        // Peer rebooted or long silence - restart the window at this id.
+        slot->last_id = id;
     }
 
-    wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
-    err = esp_wifi_init(&cfg);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG_, "esp_wifi_init failed: %s", esp_err_to_name(err));
-        return false;
+    uint16_t total = slot->delivered + slot->missed;
+    if (total >= QUAL_WINDOW_) {
+        slot->delivered /= 2;
+        slot->missed /= 2;
+        total = slot->delivered + slot->missed;
+    }
+    if (total > 0) {
+        slot->loss_pct = static_cast<uint8_t>((slot->missed * 100U) / total);
     }
+}
 
-    err = esp_wifi_set_storage(WIFI_STORAGE_RAM);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG_, "esp_wifi_set_storage failed: %s", esp_err_to_name(err));
-        return false;
+// ============================================================================
+// PEER PRESENCE (fleet view)
+// ============================================================================
+//
+// A periodic low-rate DeviceDiscovery broadcast keeps every unit in range
+// announcing itself; the table below remembers each approved peer's MAC,
+// advertised name, and when it last spoke. Any authenticated frame counts
+// as presence, so units streaming telemetry never depend on the broadcast
+// at all. The broadcast interval carries jitter so two remotes sharing a
+// channel do not settle into colliding beacon slots. Written only on the
+// receive task, read without a lock like s_peer_qual_.
+
+struct PeerPresence {
+    bool valid;
+    uint8_t mac[6];
+    uint8_t device_id;                               ///< From the last header heard
+    char name[sizeof(espnow::PresenceEntry::name)];  ///< From DeviceInfo ("" until one arrives)
+    char label[18];                                  ///< Display label: name, or formatted MAC
+    TickType_t last_seen_tick;
+};
+static PeerPresence s_presence_[MAX_APPROVED_PEERS];
+static uint8_t s_presence_mru_ = espnow::PEER_INDEX_NONE;  ///< Last ingress hit
+
+/** @brief (Re)build a slot's display label from its name or MAC. */
+static void presenceBuildLabel(PeerPresence& e)
+{
+    if (e.name[0] != '\0') {
+        snprintf(e.label, sizeof(e.label), "%s", e.name);
+    } else {
+        snprintf(e.label, sizeof(e.label), "%02X:%02X:%02X:%02X:%02X:%02X",
+                 e.mac[0], e.mac[1], e.mac[2], e.mac[3], e.mac[4], e.mac[5]);
     }
+}
+static constexpr uint32_t DISCOVERY_PERIOD_MS_ = 15000;  ///< Base broadcast interval
+static constexpr uint32_t DISCOVERY_JITTER_MS_ = 5000;   ///< Uniform jitter on top
 
-    err = esp_wifi_set_mode(WIFI_MODE_STA);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG_, "esp_wifi_set_mode failed: %s", esp_err_to_name(err));
-        return false;
+// Periodic traffic scheduler (see RegisterPeriodicJob in the header): one
+// token bucket per fixed-cadence sender. Bucket depth is deliberately one —
+// after any stall the job has earned exactly one deferred send, never a
+// backlog, and callback jobs additionally run at most one per service pass,
+// so recovery traffic is spread instead of phase-locked. The spinlock
+// covers the table because polled jobs claim tokens from their owning task
+// (the UI tick) while the receive task refills.
+struct PeriodicJob {
+    const char* name = nullptr;       ///< Short label for the PERF dump
+    espnow::PeriodicJobFn fn = nullptr;  ///< nullptr = consumer-polled
+    void* ctx = nullptr;
+    uint32_t period_ms = 0;
+    uint32_t jitter_ms = 0;
+    uint8_t priority = 0;
+    bool token = false;               ///< Bucket state (depth one)
+    TickType_t refill_tick = 0;       ///< Next jittered refill
+    uint32_t runs = 0;                ///< Tokens claimed (PERF dump)
+};
+static constexpr size_t PERIODIC_JOBS_MAX_ = 8;
+static PeriodicJob s_periodic_jobs_[PERIODIC_JOBS_MAX_];
+static size_t s_periodic_job_count_ = 0;
+static portMUX_TYPE s_periodic_lock_ = portMUX_INITIALIZER_UNLOCKED;
+
+int espnow::RegisterPeriodicJob(const char* name, uint32_t period_ms, uint32_t jitter_ms,
+                                uint8_t priority, PeriodicJobFn fn, void* ctx) noexcept
+{
+    if (period_ms == 0) {
+        return -1;
+    }
+    taskENTER_CRITICAL(&s_periodic_lock_);
+    if (s_periodic_job_count_ >= PERIODIC_JOBS_MAX_) {
+        taskEXIT_CRITICAL(&s_periodic_lock_);
+        ESP_LOGE(TAG_, "Periodic job table full (%s dropped)", name);
+        return -1;
     }
+    const int id = static_cast<int>(s_periodic_job_count_++);
+    PeriodicJob& j = s_periodic_jobs_[id];
+    j.name = name;
+    j.fn = fn;
+    j.ctx = ctx;
+    j.period_ms = period_ms;
+    j.jitter_ms = jitter_ms;
+    j.priority = priority;
+    // First token is available immediately; the refill clock starts now.
+    j.token = true;
+    j.refill_tick = xTaskGetTickCount() +
+                    pdMS_TO_TICKS(period_ms + (jitter_ms != 0 ? (esp_random() % jitter_ms) : 0));
+    taskEXIT_CRITICAL(&s_periodic_lock_);
+    return id;
+}
 
-    err = esp_wifi_start();
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG_, "esp_wifi_start failed: %s", esp_err_to_name(err));
+bool espnow::PeriodicJobDue(int job) noexcept
+{
+    if (job < 0 || static_cast<size_t>(job) >= s_periodic_job_count_) {
         return false;
     }
+    bool due = false;
+    taskENTER_CRITICAL(&s_periodic_lock_);
+    PeriodicJob& j = s_periodic_jobs_[job];
+    if (j.token) {
+        j.token = false;
+        ++j.runs;
+        due = true;
+    }
+    taskEXIT_CRITICAL(&s_periodic_lock_);
+    return due;
+}
 
-    err = esp_wifi_set_channel(WIFI_CHANNEL_, WIFI_SECOND_CHAN_NONE);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG_, "esp_wifi_set_channel failed: %s", esp_err_to_name(err));
-        return false;
+void espnow::DumpPeriodicJobs() noexcept
+{
+    ESP_LOGI(TAG_, "periodic jobs:");
+    taskENTER_CRITICAL(&s_periodic_lock_);
+    for (size_t i = 0; i < s_periodic_job_count_; ++i) {
+        const PeriodicJob& j = s_periodic_jobs_[i];
+        ESP_LOGI(TAG_, "  %-10s %6lums +%lums  %s  runs %lu",
+                 j.name,
+                 static_cast<unsigned long>(j.period_ms),
+                 static_cast<unsigned long>(j.jitter_ms),
+                 (j.fn != nullptr) ? "task  " : "polled",
+                 static_cast<unsigned long>(j.runs));
     }
+    taskEXIT_CRITICAL(&s_periodic_lock_);
+}
 
-    uint8_t mac_addr[6];
-    esp_wifi_get_mac(WIFI_IF_STA, mac_addr);
-    ESP_LOGI(TAG_, "Remote Controller MAC (STA): %02X:%02X:%02X:%02X:%02X:%02X",
-             mac_addr[0], mac_addr[1], mac_addr[2], mac_addr[3], mac_addr[4], mac_addr[5]);
+/**
+ * @brief Refill every bucket whose jittered period elapsed, run one job
+ * @details Called from the receive task's service pass. Refills advance
+ *          from grant time, so grants can never come closer than the
+ *          period regardless of how late the token is claimed. Among
+ *          runnable callback jobs only the highest-priority one runs per
+ *          pass (the callback itself runs outside the spinlock).
+ */
+static void servicePeriodicJobs()
+{
+    const TickType_t now = xTaskGetTickCount();
+    espnow::PeriodicJobFn run_fn = nullptr;
+    void* run_ctx = nullptr;
 
-    err = esp_now_init();
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG_, "esp_now_init failed: %s", esp_err_to_name(err));
-        return false;
+    taskENTER_CRITICAL(&s_periodic_lock_);
+    int best = -1;
+    for (size_t i = 0; i < s_periodic_job_count_; ++i) {
+        PeriodicJob& j = s_periodic_jobs_[i];
+        if (!j.token && static_cast<int32_t>(now - j.refill_tick) >= 0) {
+            j.token = true;
+            j.refill_tick = now +
+                pdMS_TO_TICKS(j.period_ms +
+                              (j.jitter_ms != 0 ? (esp_random() % j.jitter_ms) : 0));
+        }
+        if (j.fn != nullptr && j.token &&
+            (best < 0 || j.priority > s_periodic_jobs_[best].priority)) {
+            best = static_cast<int>(i);
+        }
+    }
+    if (best >= 0) {
+        PeriodicJob& j = s_periodic_jobs_[best];
+        j.token = false;
+        ++j.runs;
+        run_fn = j.fn;
+        run_ctx = j.ctx;
     }
+    taskEXIT_CRITICAL(&s_periodic_lock_);
 
-    err = esp_now_register_recv_cb(espnowRecvCb);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG_, "esp_now_register_recv_cb failed: %s", esp_err_to_name(err));
-        return false;
+    if (run_fn != nullptr) {
+        run_fn(run_ctx);
     }
+}
 
-    err = esp_now_register_send_cb(espnowSendCb);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG_, "esp_now_register_send_cb failed: %s", esp_err_to_name(err));
-        return false;
+/**
+ * @brief Note an authenticated frame from @p mac in the presence table
+ * @details Doubles as the identity intern step: the returned slot index is
+ *          the sender's stable 1-byte identity for this session. The MRU
+ *          slot is checked first, so a telemetry stream from one unit costs
+ *          a single 6-byte compare per packet instead of a table scan.
+ * @return Slot index, or PEER_INDEX_NONE if the table is full
+ */
+static uint8_t presenceNoteRx(const uint8_t mac[6], uint8_t device_id)
+{
+    PeerPresence* slot = nullptr;
+    uint8_t index = espnow::PEER_INDEX_NONE;
+
+    if (s_presence_mru_ < MAX_APPROVED_PEERS &&
+        s_presence_[s_presence_mru_].valid &&
+        std::memcmp(s_presence_[s_presence_mru_].mac, mac, 6) == 0) {
+        slot = &s_presence_[s_presence_mru_];
+        index = s_presence_mru_;
+    } else {
+        for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+            if (s_presence_[i].valid && std::memcmp(s_presence_[i].mac, mac, 6) == 0) {
+                slot = &s_presence_[i];
+                index = static_cast<uint8_t>(i);
+                break;
+            }
+            if (slot == nullptr && !s_presence_[i].valid) {
+                slot = &s_presence_[i];
+                index = static_cast<uint8_t>(i);
+            }
+        }
     }
+    if (slot == nullptr) {
+        return espnow::PEER_INDEX_NONE;
+    }
+    if (!slot->valid) {
+        *slot = PeerPresence{};
+        std::memcpy(slot->mac, mac, 6);
+        presenceBuildLabel(*slot);
+        // Publish the row only after the identity fields are in place;
+        // readers on other tasks key off valid.
+        slot->valid = true;
+    }
+    slot->device_id = device_id;
+    slot->last_seen_tick = xTaskGetTickCount();
+    s_presence_mru_ = index;
+    return index;
+}
 
-    // Add broadcast peer for pairing discovery
-    esp_now_peer_info_t broadcast_peer{};
-    std::memcpy(broadcast_peer.peer_addr, BROADCAST_MAC, 6);
-    broadcast_peer.channel = WIFI_CHANNEL_;
-    broadcast_peer.ifidx = WIFI_IF_STA;
-    broadcast_peer.encrypt = false;
-    esp_now_add_peer(&broadcast_peer);
+/**
+ * @brief Record the name a DeviceInfo response carries
+ * @details The payload layout is owned by unit firmware; treat it as an
+ *          ASCII name of whatever length fits and bound the copy, so a
+ *          unit speaking a newer dialect degrades to a truncated name
+ *          rather than garbage on the Fleet page.
+ */
+static void presenceNoteInfo(const uint8_t mac[6], const uint8_t* payload, uint8_t len)
+{
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        PeerPresence& e = s_presence_[i];
+        if (!e.valid || std::memcmp(e.mac, mac, 6) != 0) {
+            continue;
+        }
+        size_t n = 0;
+        while (n < len && n < sizeof(e.name) - 1 &&
+               payload[n] >= 0x20 && payload[n] < 0x7F) {
+            e.name[n] = static_cast<char>(payload[n]);
+            ++n;
+        }
+        e.name[n] = '\0';
+        presenceBuildLabel(e);
+        return;
+    }
+}
+
+/**
+ * @brief Periodic discovery broadcast driving the presence table
+ * @details One bulk-class broadcast per scheduler token (DISCOVERY_PERIOD_MS_
+ *          plus jitter, registered at init); when units answer is their own
+ *          (unit-side) backoff decision, so the cost of a quiet fleet is
+ *          one send per period.
+ */
+static void discoveryJob(void* ctx)
+{
+    (void)ctx;
+    (void)espnow::SendDeviceDiscovery();
+}
+
+/**
+ * @brief Retire the in-flight entry matched by an incoming ack
+ * @details Prefers an exact header-id match; falls back to the oldest
+ *          in-flight packet of the acked type, since CommandAck from older
+ *          firmware does not echo the original id.
+ */
+static void ackInflight(espnow::MsgType ack_type, uint8_t ack_id, const uint8_t* src_mac)
+{
+    // ConfigAck retires both full ConfigSet packets and ConfigDelta diffs.
+    const auto matches = [&](espnow::MsgType t) {
+        if (ack_type == espnow::MsgType::CommandAck) {
+            return t == espnow::MsgType::Command;
+        }
+        return t == espnow::MsgType::ConfigSet || t == espnow::MsgType::ConfigDelta;
+    };
+    if (s_inflight_mutex_ == nullptr) {
+        return;
+    }
+    xSemaphoreTake(s_inflight_mutex_, portMAX_DELAY);
+    InflightEntry* hit = nullptr;
+    for (size_t i = 0; i < INFLIGHT_SIZE_; ++i) {
+        if (s_inflight_[i].valid && matches(s_inflight_[i].type) && s_inflight_[i].msg_id == ack_id) {
+            hit = &s_inflight_[i];
+            break;
+        }
+    }
+    if (hit == nullptr) {
+        for (size_t i = 0; i < INFLIGHT_SIZE_; ++i) {
+            if (s_inflight_[i].valid && matches(s_inflight_[i].type) &&
+                (hit == nullptr || s_inflight_[i].first_tick < hit->first_tick)) {
+                hit = &s_inflight_[i];
+            }
+        }
+    }
+    if (hit != nullptr) {
+        if (hit->retries == 0) {
+            const TickType_t elapsed = xTaskGetTickCount() - hit->first_tick;
+            const uint32_t rtt_ms = pdTICKS_TO_MS(elapsed);
+            updatePeerRtt(src_mac, rtt_ms);
+            recordLatencySample(rtt_ms);
+        }
+        ++s_link_stats_.acked;
+        hit->valid = false;
+    }
+    xSemaphoreGive(s_inflight_mutex_);
+}
+
+/**
+ * @brief Retransmit overdue in-flight packets with exponential backoff
+ * @details Called periodically from the receive task. Delay doubles per
+ *          retry (60, 120, ... ms); after RETRY_MAX_ attempts the packet is
+ *          dropped with a warning.
+ */
+static void serviceRetransmits()
+{
+    if (s_inflight_mutex_ == nullptr) {
+        return;
+    }
+    const TickType_t now = xTaskGetTickCount();
+    xSemaphoreTake(s_inflight_mutex_, portMAX_DELAY);
+    for (size_t i = 0; i < INFLIGHT_SIZE_; ++i) {
+        InflightEntry& e = s_inflight_[i];
+        if (!e.valid || static_cast<int32_t>(now - e.next_retry_tick) < 0) {
+            continue;
+        }
+        if (e.retries >= RETRY_MAX_) {
+            ESP_LOGW(TAG_, "Giving up on msg id=%u type=%u after %u retries",
+                     e.msg_id, static_cast<unsigned>(e.type), e.retries);
+            ++s_link_stats_.lost;
+            e.valid = false;
+            continue;
+        }
+        e.retries++;
+        ++s_link_stats_.retransmits;
+        e.next_retry_tick = now + pdMS_TO_TICKS(RETRY_BASE_MS_ << e.retries);
+        (void)sendPacketRaw(e.dst_mac, e.device_id, e.type, e.msg_id, e.payload, e.payload_len);
+        ESP_LOGD(TAG_, "Retransmit msg id=%u (attempt %u)", e.msg_id, e.retries);
+    }
+    xSemaphoreGive(s_inflight_mutex_);
+}
+
+// ---------------------------------------------------------------------------
+// Critical command journal
+// ---------------------------------------------------------------------------
+// Commands whose loss is expensive (Stop, Pause) outlive the retransmit
+// engine: each is journaled in RAM with a monotonic sequence number and
+// replayed — immediately when the supervisor reports the peer back up, and
+// on a 1 s cadence otherwise — until a CommandAck for the newest attempt
+// retires it. One entry per peer: a newer critical command supersedes the
+// older one, so the journal can never replay a stale command over a fresh
+// decision. Replays carry fresh header ids (the commands are idempotent on
+// the unit), so an ack lost to the air only costs one duplicate delivery.
+// Guarded by s_inflight_mutex_: writers are the UI task (enqueue) and the
+// receive task (ack retire, replay service).
+
+struct CommandJournalEntry {
+    bool valid;
+    uint8_t dst_mac[6];
+    uint8_t device_id;
+    uint8_t command_id;
+    uint8_t last_msg_id;          // Header id of the newest attempt
+    uint32_t journal_seq;         // Monotonic enqueue order (oldest evicted first)
+    TickType_t next_replay_tick;  // Earliest tick for the next replay
+};
+static constexpr size_t CMD_JOURNAL_SIZE_ = 4;
+static constexpr uint32_t CMD_JOURNAL_REPLAY_MS_ = 1000;
+static CommandJournalEntry s_cmd_journal_[CMD_JOURNAL_SIZE_]{};
+static uint32_t s_cmd_journal_seq_ = 0;
+
+/**
+ * @brief Retire the journal entry a CommandAck covers
+ */
+static void journalNoteAck(uint8_t ack_id, const uint8_t* src_mac)
+{
+    if (s_inflight_mutex_ == nullptr) {
+        return;
+    }
+    xSemaphoreTake(s_inflight_mutex_, portMAX_DELAY);
+    for (auto& e : s_cmd_journal_) {
+        if (e.valid && e.last_msg_id == ack_id && std::memcmp(e.dst_mac, src_mac, 6) == 0) {
+            e.valid = false;
+            ESP_LOGI(TAG_, "Journal: command %u delivered (seq %u)",
+                     e.command_id, static_cast<unsigned>(e.journal_seq));
+            break;
+        }
+    }
+    xSemaphoreGive(s_inflight_mutex_);
+}
+
+/**
+ * @brief Pull a peer's journal replays forward to the next service pass
+ */
+static void journalNoteLinkUp(const uint8_t mac[6])
+{
+    if (s_inflight_mutex_ == nullptr) {
+        return;
+    }
+    xSemaphoreTake(s_inflight_mutex_, portMAX_DELAY);
+    for (auto& e : s_cmd_journal_) {
+        if (e.valid && std::memcmp(e.dst_mac, mac, 6) == 0) {
+            e.next_replay_tick = xTaskGetTickCount();
+        }
+    }
+    xSemaphoreGive(s_inflight_mutex_);
+}
+
+/**
+ * @brief Replay overdue journal entries (receive task)
+ * @details The journal is its own retry engine, so replays are not pushed
+ *          through the in-flight table: a fresh header id per attempt plus
+ *          the 1 s cadence replaces the exponential backoff the original
+ *          tracked send already burned through.
+ */
+static void serviceCommandJournal()
+{
+    if (s_inflight_mutex_ == nullptr) {
+        return;
+    }
+    const TickType_t now = xTaskGetTickCount();
+    xSemaphoreTake(s_inflight_mutex_, portMAX_DELAY);
+    for (auto& e : s_cmd_journal_) {
+        if (!e.valid || static_cast<int32_t>(now - e.next_replay_tick) < 0) {
+            continue;
+        }
+        const uint8_t msg_id = s_next_msg_id_++;
+        const uint8_t cmd_buf[1] = { e.command_id };
+        e.last_msg_id = msg_id;
+        e.next_replay_tick = now + pdMS_TO_TICKS(CMD_JOURNAL_REPLAY_MS_);
+        (void)sendPacketRaw(e.dst_mac, e.device_id, espnow::MsgType::Command,
+                            msg_id, cmd_buf, sizeof(cmd_buf));
+        ESP_LOGD(TAG_, "Journal: replay command %u id=%u", e.command_id, msg_id);
+    }
+    xSemaphoreGive(s_inflight_mutex_);
+}
+
+// ============================================================================
+// OTA RECEIVER
+// ============================================================================
+//
+// Chunked firmware transfer layered on the normal packet path, so updates
+// ride the same CRC, security gate and channel agility as everything else.
+// The sender (host-side flasher behind any paired ESP32) announces the image
+// with OtaBegin, then streams OtaChunk packets — full MAX_PAYLOAD_SIZE_, a
+// 2-byte chunk index plus 198 data bytes, each covered by the packet CRC16 —
+// inside the credit window the receiver advertises. The receiver accepts
+// strictly in order: an accepted chunk is staged into a small buffer pool
+// and flashed to the inactive partition by a dedicated low-priority task,
+// so the multi-second erase and the periodic 4 KB write stalls never block
+// the receive task or the UI. A gap triggers an immediate (rate-limited)
+// OtaStatus nack and the sender rewinds (go-back-N); the same periodic
+// OtaStatus resumes a transfer after link loss, since it always names the
+// next chunk still needed. When the last chunk lands the image CRC16 is
+// compared against the announced one, the partition is activated, and the
+// unit restarts after a short on-screen grace period.
+
+#pragma pack(push, 1)
+/** @brief OtaBegin wire payload */
+struct OtaBeginPayload {
+    uint32_t image_size;      ///< Image length in bytes
+    uint16_t chunk_data_len;  ///< Data bytes per OtaChunk (<= OTA_CHUNK_DATA_)
+    uint16_t image_crc16;     ///< CRC16-CCITT over the whole image
+};
+
+/** @brief OtaStatus wire payload (receiver -> sender) */
+struct OtaStatusPayload {
+    uint8_t state;        ///< espnow::OtaState
+    uint8_t error;        ///< OtaErr detail (0 = none)
+    uint16_t next_index;  ///< First chunk index still needed
+    uint16_t credit;      ///< Free staging slots beyond next_index
+};
+#pragma pack(pop)
+
+/** @brief OtaProgress::error / OtaStatusPayload::error detail codes */
+enum OtaErr : uint8_t {
+    OTA_ERR_NONE = 0,
+    OTA_ERR_NO_PARTITION,  ///< No inactive app slot in the partition table
+    OTA_ERR_FLASH_BEGIN,   ///< esp_ota_begin failed (erase)
+    OTA_ERR_FLASH_WRITE,   ///< esp_ota_write failed
+    OTA_ERR_VERIFY,        ///< Image CRC or esp_ota_end validation failed
+    OTA_ERR_TIMEOUT,       ///< Sender silent too long mid-transfer
+    OTA_ERR_RESOURCES,     ///< Worker task/queues could not be created
+};
+
+static constexpr uint16_t OTA_CHUNK_DATA_ = espnow::MAX_PAYLOAD_SIZE_ - sizeof(uint16_t);
+static constexpr size_t OTA_STAGE_SLOTS_ = 8;           ///< Staged chunks (window credit)
+static constexpr uint32_t OTA_STATUS_EVERY_ = 16;       ///< Chunks between cumulative acks
+static constexpr uint32_t OTA_STATUS_MS_ = 500;         ///< Periodic status cadence
+static constexpr uint32_t OTA_NACK_MIN_MS_ = 100;       ///< Gap-nack rate limit
+static constexpr uint32_t OTA_ABORT_TIMEOUT_MS_ = 300000;  ///< Give up after 5 min silence
+static constexpr uint32_t OTA_REBOOT_DELAY_MS_ = 2000;  ///< On-screen grace before restart
+
+/** @brief One unit of work for the flash writer task */
+struct OtaStaged {
+    enum class Op : uint8_t { Begin, Data, Abort };
+    Op op;
+    uint16_t index;                  ///< Chunk index (Data)
+    uint16_t len;                    ///< Data bytes used (Data) / payload bytes (Begin)
+    uint8_t data[OTA_CHUNK_DATA_];   ///< Chunk data, or an OtaBeginPayload for Begin
+};
+
+static OtaStaged s_ota_slots_[OTA_STAGE_SLOTS_];
+static QueueHandle_t s_ota_free_queue_ = nullptr;   ///< Empty slots (OtaStaged*)
+static QueueHandle_t s_ota_write_queue_ = nullptr;  ///< Filled slots, in chunk order
+static SemaphoreHandle_t s_ota_mutex_ = nullptr;
+
+// Guarded by s_ota_mutex_ once it exists (recv task + writer task).
+static espnow::OtaState s_ota_state_ = espnow::OtaState::Idle;
+static uint8_t s_ota_error_ = OTA_ERR_NONE;
+static OtaBeginPayload s_ota_image_{};    ///< Parameters of the announced image
+static uint16_t s_ota_total_chunks_ = 0;
+static uint16_t s_ota_next_index_ = 0;    ///< Next chunk accepted off the air
+static uint16_t s_ota_written_ = 0;       ///< Chunks flashed (writer task)
+static uint8_t s_ota_src_mac_[6] = {};
+static uint8_t s_ota_device_id_ = 0;
+static TickType_t s_ota_last_rx_tick_ = 0;
+static TickType_t s_ota_last_status_tick_ = 0;
+static uint32_t s_ota_since_status_ = 0;
+static esp_ota_handle_t s_ota_handle_ = 0;
+static const esp_partition_t* s_ota_part_ = nullptr;
+static espnow::Crc16Stream s_ota_crc_;
+
+/**
+ * @brief Send the receiver's view of the transfer to the sender
+ * @details Doubles as begin-ack, cumulative ack, gap nack and resume beacon;
+ *          next_index is all the sender needs to know in every case.
+ */
+static void otaSendStatus()
+{
+    OtaStatusPayload st{};
+    st.state = static_cast<uint8_t>(s_ota_state_);
+    st.error = s_ota_error_;
+    st.next_index = s_ota_next_index_;
+    st.credit = static_cast<uint16_t>(uxQueueMessagesWaiting(s_ota_free_queue_));
+    s_ota_last_status_tick_ = xTaskGetTickCount();
+    s_ota_since_status_ = 0;
+    (void)sendPacketTo(s_ota_src_mac_, s_ota_device_id_, espnow::MsgType::OtaStatus,
+                       &st, sizeof(st));
+}
+
+/**
+ * @brief Fail the transfer and tell the sender why
+ * @details Caller holds s_ota_mutex_. The flash handle is released by the
+ *          writer task (Abort op) if one is still open.
+ */
+static void otaFail(uint8_t err)
+{
+    s_ota_state_ = espnow::OtaState::Error;
+    s_ota_error_ = err;
+    ESP_LOGE(TAG_, "OTA: failed (err %u) after %u/%u chunks", err,
+             s_ota_written_, s_ota_total_chunks_);
+    otaSendStatus();
+}
+
+/**
+ * @brief Flash writer task - owns every esp_ota_* call
+ * @details Keeps the erase (seconds) and the per-4KB write stalls off the
+ *          receive task; backpressure reaches the sender naturally through
+ *          the credit field as staging slots stop coming free.
+ * @param arg Task argument (unused)
+ */
+static void otaWriteTask(void* arg)
+{
+    (void)arg;
+    OtaStaged* slot = nullptr;
+    while (true) {
+        if (xQueueReceive(s_ota_write_queue_, &slot, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        const OtaStaged::Op op = slot->op;
+
+        if (op == OtaStaged::Op::Abort) {
+            if (s_ota_handle_ != 0) {
+                esp_ota_abort(s_ota_handle_);
+                s_ota_handle_ = 0;
+            }
+            xQueueSend(s_ota_free_queue_, &slot, 0);
+            continue;
+        }
+
+        if (op == OtaStaged::Op::Begin) {
+            if (s_ota_handle_ != 0) {
+                esp_ota_abort(s_ota_handle_);
+                s_ota_handle_ = 0;
+            }
+            OtaBeginPayload begin{};
+            std::memcpy(&begin, slot->data, sizeof(begin));
+            xQueueSend(s_ota_free_queue_, &slot, 0);
+
+            s_ota_part_ = esp_ota_get_next_update_partition(nullptr);
+            uint8_t err = OTA_ERR_NONE;
+            if (s_ota_part_ == nullptr) {
+                err = OTA_ERR_NO_PARTITION;
+            } else if (esp_ota_begin(s_ota_part_, begin.image_size, &s_ota_handle_) != ESP_OK) {
+                s_ota_handle_ = 0;
+                err = OTA_ERR_FLASH_BEGIN;
+            }
+            xSemaphoreTake(s_ota_mutex_, portMAX_DELAY);
+            if (err != OTA_ERR_NONE) {
+                otaFail(err);
+            } else {
+                s_ota_state_ = espnow::OtaState::Receiving;
+                s_ota_crc_ = espnow::Crc16Stream{};
+                ESP_LOGI(TAG_, "OTA: receiving %u bytes (%u chunks) into %s",
+                         static_cast<unsigned>(begin.image_size),
+                         s_ota_total_chunks_, s_ota_part_->label);
+                otaSendStatus();  // begin-ack: sender may start streaming
+            }
+            xSemaphoreGive(s_ota_mutex_);
+            continue;
+        }
+
+        // Data: sequential by construction (the receive task stages in order).
+        const esp_err_t werr = esp_ota_write(s_ota_handle_, slot->data, slot->len);
+        if (werr == ESP_OK) {
+            s_ota_crc_.update(slot->data, slot->len);
+        }
+        const uint16_t index = slot->index;
+        const bool last = (index + 1 == s_ota_total_chunks_);
+        xQueueSend(s_ota_free_queue_, &slot, 0);
+
+        if (werr != ESP_OK) {
+            xSemaphoreTake(s_ota_mutex_, portMAX_DELAY);
+            otaFail(OTA_ERR_FLASH_WRITE);
+            xSemaphoreGive(s_ota_mutex_);
+            esp_ota_abort(s_ota_handle_);
+            s_ota_handle_ = 0;
+            continue;
+        }
+
+        xSemaphoreTake(s_ota_mutex_, portMAX_DELAY);
+        s_ota_written_ = static_cast<uint16_t>(index + 1);
+        xSemaphoreGive(s_ota_mutex_);
+
+        if (!last) {
+            continue;
+        }
+
+        // Final chunk: verify against the announced image CRC, let
+        // esp_ota_end validate the app descriptor, then activate.
+        const uint16_t image_crc = s_ota_crc_.finish();
+        const esp_err_t eerr = esp_ota_end(s_ota_handle_);
+        s_ota_handle_ = 0;
+        xSemaphoreTake(s_ota_mutex_, portMAX_DELAY);
+        if (image_crc != s_ota_image_.image_crc16 || eerr != ESP_OK ||
+            esp_ota_set_boot_partition(s_ota_part_) != ESP_OK) {
+            otaFail(OTA_ERR_VERIFY);
+            xSemaphoreGive(s_ota_mutex_);
+            continue;
+        }
+        s_ota_state_ = espnow::OtaState::ReadyToReboot;
+        ESP_LOGI(TAG_, "OTA: image verified, restarting into %s", s_ota_part_->label);
+        blackbox::Note(blackbox::Kind::Boot, 0xFE);  // marks the OTA restart
+        otaSendStatus();
+        xSemaphoreGive(s_ota_mutex_);
+        vTaskDelay(pdMS_TO_TICKS(OTA_REBOOT_DELAY_MS_));
+        esp_restart();
+    }
+}
+
+/**
+ * @brief Create the staging pool, mutex and writer task on first use
+ */
+static bool otaEnsureWorker()
+{
+    if (s_ota_write_queue_ != nullptr) {
+        return true;
+    }
+    s_ota_mutex_ = xSemaphoreCreateMutex();
+    s_ota_free_queue_ = xQueueCreate(OTA_STAGE_SLOTS_, sizeof(OtaStaged*));
+    s_ota_write_queue_ = xQueueCreate(OTA_STAGE_SLOTS_, sizeof(OtaStaged*));
+    if (s_ota_mutex_ == nullptr || s_ota_free_queue_ == nullptr ||
+        s_ota_write_queue_ == nullptr ||
+        xTaskCreate(otaWriteTask, "espnow_ota", 4096, nullptr, 3, nullptr) != pdPASS) {
+        ESP_LOGE(TAG_, "OTA: worker unavailable");
+        if (s_ota_free_queue_ != nullptr) { vQueueDelete(s_ota_free_queue_); }
+        if (s_ota_write_queue_ != nullptr) { vQueueDelete(s_ota_write_queue_); }
+        s_ota_free_queue_ = nullptr;
+        s_ota_write_queue_ = nullptr;
+        return false;
+    }
+    for (auto& slot : s_ota_slots_) {
+        OtaStaged* p = &slot;
+        xQueueSend(s_ota_free_queue_, &p, 0);
+    }
+    return true;
+}
+
+/**
+ * @brief Handle OtaBegin (receive task)
+ * @details A repeat of the in-progress image is a resume: the status reply
+ *          names the next chunk needed and the sender rewinds to it. A
+ *          different image supersedes the current transfer.
+ */
+static void otaHandleBegin(const uint8_t* payload, uint8_t len,
+                           const uint8_t* src_mac, uint8_t device_id)
+{
+    if (len < sizeof(OtaBeginPayload) || !otaEnsureWorker()) {
+        return;
+    }
+    OtaBeginPayload begin{};
+    std::memcpy(&begin, payload, sizeof(begin));
+    if (begin.image_size == 0 || begin.chunk_data_len == 0 ||
+        begin.chunk_data_len > OTA_CHUNK_DATA_) {
+        return;
+    }
+
+    xSemaphoreTake(s_ota_mutex_, portMAX_DELAY);
+    std::memcpy(s_ota_src_mac_, src_mac, 6);
+    s_ota_device_id_ = device_id;
+    s_ota_last_rx_tick_ = xTaskGetTickCount();
+
+    const bool same_image = std::memcmp(&begin, &s_ota_image_, sizeof(begin)) == 0;
+    const bool active = s_ota_state_ == espnow::OtaState::Preparing ||
+                        s_ota_state_ == espnow::OtaState::Receiving;
+    if (active && same_image) {
+        otaSendStatus();  // resume: sender rewinds to next_index
+        xSemaphoreGive(s_ota_mutex_);
+        return;
+    }
+
+    s_ota_image_ = begin;
+    s_ota_total_chunks_ = static_cast<uint16_t>(
+        (begin.image_size + begin.chunk_data_len - 1) / begin.chunk_data_len);
+    s_ota_next_index_ = 0;
+    s_ota_written_ = 0;
+    s_ota_error_ = OTA_ERR_NONE;
+    s_ota_state_ = espnow::OtaState::Preparing;
+    xSemaphoreGive(s_ota_mutex_);
+
+    // Queue the (possibly aborting) begin for the writer; the begin-ack goes
+    // out only after the erase, so the sender never streams into it.
+    OtaStaged* slot = nullptr;
+    if (xQueueReceive(s_ota_free_queue_, &slot, 0) == pdTRUE) {
+        slot->op = OtaStaged::Op::Begin;
+        slot->len = sizeof(begin);
+        std::memcpy(slot->data, &begin, sizeof(begin));
+        xQueueSend(s_ota_write_queue_, &slot, 0);
+    }
+}
+
+/**
+ * @brief Handle OtaChunk (receive task)
+ */
+static void otaHandleChunk(const uint8_t* payload, uint8_t len)
+{
+    if (len < sizeof(uint16_t) || s_ota_mutex_ == nullptr) {
+        return;
+    }
+    uint16_t index = 0;
+    std::memcpy(&index, payload, sizeof(index));
+    const uint16_t data_len = static_cast<uint16_t>(len - sizeof(uint16_t));
+
+    xSemaphoreTake(s_ota_mutex_, portMAX_DELAY);
+    if (s_ota_state_ != espnow::OtaState::Receiving) {
+        xSemaphoreGive(s_ota_mutex_);
+        return;
+    }
+    s_ota_last_rx_tick_ = xTaskGetTickCount();
+
+    if (index != s_ota_next_index_) {
+        // Behind: a retransmit of something already staged, drop. Ahead: a
+        // gap — nack immediately so the sender rewinds, rate-limited so a
+        // burst of successors does not flood the reverse path.
+        if (index > s_ota_next_index_ &&
+            (xTaskGetTickCount() - s_ota_last_status_tick_) >= pdMS_TO_TICKS(OTA_NACK_MIN_MS_)) {
+            otaSendStatus();
+        }
+        xSemaphoreGive(s_ota_mutex_);
+        return;
+    }
+
+    OtaStaged* slot = nullptr;
+    if (xQueueReceive(s_ota_free_queue_, &slot, 0) != pdTRUE) {
+        // Writer is behind (4 KB erase stall); the dropped chunk comes back
+        // once the periodic status names it again.
+        xSemaphoreGive(s_ota_mutex_);
+        return;
+    }
+    slot->op = OtaStaged::Op::Data;
+    slot->index = index;
+    slot->len = data_len;
+    std::memcpy(slot->data, payload + sizeof(uint16_t), data_len);
+    xQueueSend(s_ota_write_queue_, &slot, 0);
+    ++s_ota_next_index_;
+    if (++s_ota_since_status_ >= OTA_STATUS_EVERY_) {
+        otaSendStatus();  // cumulative ack keeps the sender's window moving
+    }
+    xSemaphoreGive(s_ota_mutex_);
+}
+
+/**
+ * @brief Periodic OTA service (receive task)
+ * @details The periodic status is the resume beacon after link loss; the
+ *          timeout reclaims the flash handle when a sender disappears for
+ *          good mid-transfer.
+ */
+static void serviceOta()
+{
+    if (s_ota_mutex_ == nullptr) {
+        return;
+    }
+    const TickType_t now = xTaskGetTickCount();
+    xSemaphoreTake(s_ota_mutex_, portMAX_DELAY);
+    const bool active = s_ota_state_ == espnow::OtaState::Preparing ||
+                        s_ota_state_ == espnow::OtaState::Receiving;
+    if (active && (now - s_ota_last_rx_tick_) >= pdMS_TO_TICKS(OTA_ABORT_TIMEOUT_MS_)) {
+        otaFail(OTA_ERR_TIMEOUT);
+        OtaStaged* slot = nullptr;
+        if (xQueueReceive(s_ota_free_queue_, &slot, 0) == pdTRUE) {
+            slot->op = OtaStaged::Op::Abort;
+            xQueueSend(s_ota_write_queue_, &slot, 0);
+        }
+    } else if (s_ota_state_ == espnow::OtaState::Receiving &&
+               (now - s_ota_last_status_tick_) >= pdMS_TO_TICKS(OTA_STATUS_MS_)) {
+        otaSendStatus();
+    }
+    xSemaphoreGive(s_ota_mutex_);
+}
+
+void espnow::GetOtaProgress(OtaProgress& out) noexcept
+{
+    out = OtaProgress{};
+    if (s_ota_mutex_ == nullptr) {
+        return;
+    }
+    xSemaphoreTake(s_ota_mutex_, portMAX_DELAY);
+    out.state = s_ota_state_;
+    out.error = s_ota_error_;
+    out.chunks_done = s_ota_written_;
+    out.chunks_total = s_ota_total_chunks_;
+    out.percent = (s_ota_total_chunks_ > 0)
+        ? static_cast<uint8_t>((static_cast<uint32_t>(s_ota_written_) * 100U) / s_ota_total_chunks_)
+        : 0;
+    xSemaphoreGive(s_ota_mutex_);
+}
+
+// ============================================================================
+// BULK TRANSFER ENGINE
+// ============================================================================
+//
+// Generic chunked payloads above the 200-byte packet limit, layered on the
+// normal packet path like the OTA receiver (same CRC, security gate and
+// channel agility). A stream is announced with TransferBegin (kind, length,
+// chunk size, whole-stream CRC16), then TransferChunk frames flow inside a
+// fixed window. Unlike OTA's strictly-ordered go-back-N, the receiver
+// tracks a cumulative base plus a 32-bit bitmap of chunks received beyond
+// it, so one lost frame costs one retransmit, not a window rewind — the
+// reverse path carries the whole window state in 8 bytes. Chunks ride the
+// TX scheduler's bulk class: commands cut ahead, and the sender task's
+// measured-airtime gap after each chunk is the backpressure that keeps a
+// multi-KB export from flattening telemetry. One outbound and one inbound
+// stream at a time; session export, allowlist replication and unit log
+// pull all share this engine instead of inventing their own chunking.
+
+#pragma pack(push, 1)
+/** @brief TransferBegin wire payload */
+struct TransferBeginPayload {
+    uint8_t stream_id;   ///< Sender-chosen id, increments per stream
+    uint8_t kind;        ///< espnow::TransferKind
+    uint32_t total_len;  ///< Stream length in bytes
+    uint16_t chunk_len;  ///< Data bytes per chunk (<= TRANSFER_CHUNK_DATA_)
+    uint16_t crc16;      ///< CRC16-CCITT over the whole stream
+};
+
+/** @brief TransferAck wire payload (receiver -> sender) */
+struct TransferAckPayload {
+    uint8_t stream_id;   ///< Stream being acknowledged
+    uint8_t status;      ///< TxfrStatus verdict
+    uint16_t base;       ///< Lowest chunk index not yet received
+    uint32_t have_mask;  ///< Bit i set: chunk base+1+i already received
+};
+#pragma pack(pop)
+
+/** @brief TransferAckPayload::status verdicts */
+enum TxfrStatus : uint8_t {
+    TXFR_ACCEPT = 1,   ///< Begin accepted, send chunks
+    TXFR_PROGRESS,     ///< Window state update
+    TXFR_DONE,         ///< Stream complete, CRC verified, sink ran
+    TXFR_BUSY,         ///< Another inbound stream is active
+    TXFR_TOO_BIG,      ///< Length zero or over the receive cap
+    TXFR_NO_SINK,      ///< No consumer registered
+    TXFR_CRC,          ///< Reassembled stream failed its CRC
+};
+
+/// Chunk payload: stream id (1) + index (2) + data
+static constexpr uint16_t TRANSFER_CHUNK_DATA_ = espnow::MAX_PAYLOAD_SIZE_ - 3;
+static constexpr uint16_t TRANSFER_WINDOW_ = 16;      ///< Unacked chunks in flight
+static constexpr uint16_t TRANSFER_BURST_ = 4;        ///< Sends per pump pass (TX pool is 12)
+static constexpr uint32_t TRANSFER_RX_MAX_ = 16384;   ///< Inbound reassembly cap
+static constexpr uint32_t TRANSFER_ACK_EVERY_ = 8;    ///< Chunks between cumulative acks
+static constexpr uint32_t TRANSFER_ACK_MS_ = 200;     ///< Periodic ack cadence
+static constexpr uint32_t TRANSFER_STALL_MS_ = 250;   ///< Sender resend timeout
+static constexpr uint32_t TRANSFER_RETRIES_ = 40;     ///< Stall strikes before giving up
+static constexpr uint32_t TRANSFER_RX_IDLE_MS_ = 10000;  ///< Inbound abandon timeout
+
+/// Outbound stream (guarded by s_txfr_mutex_)
+struct TxfrSender {
+    bool active;
+    bool announced;           ///< Begin acked, chunks flowing
+    uint8_t stream_id;
+    uint8_t kind;
+    uint8_t mac[6];
+    const uint8_t* data;      ///< Caller-owned, valid until the final callback
+    uint32_t len;
+    uint16_t total_chunks;
+    uint16_t next_unsent;     ///< Next fresh chunk index
+    uint16_t base;            ///< Receiver's cumulative base from the last ack
+    uint32_t have_mask;       ///< Receiver's bitmap from the last ack
+    uint8_t retries;          ///< Consecutive stall timeouts
+    TickType_t last_ack_tick;
+    espnow::TransferProgressFn progress;
+};
+
+/// Inbound stream (guarded by s_txfr_mutex_)
+struct TxfrReceiver {
+    bool active;
+    uint8_t stream_id;
+    uint8_t kind;
+    uint8_t mac[6];
+    uint8_t device_id;
+    uint8_t* buf;             ///< Reassembly buffer (malloc'd at Begin)
+    uint32_t len;
+    uint16_t chunk_len;
+    uint16_t total_chunks;
+    uint16_t crc16;
+    uint16_t base;
+    uint32_t have_mask;
+    uint32_t since_ack;       ///< Chunks accepted since the last ack
+    TickType_t last_rx_tick;
+    TickType_t last_ack_tick;
+};
+
+static SemaphoreHandle_t s_txfr_mutex_ = nullptr;
+static TxfrSender s_txfr_tx_{};
+static TxfrReceiver s_txfr_rx_{};
+static uint8_t s_txfr_next_id_ = 1;
+static espnow::TransferSinkFn s_txfr_sink_ = nullptr;
+// Done-echo memory: if the final ack is lost, retransmits of a stream we
+// already delivered get a fresh Done instead of silence.
+static uint8_t s_txfr_done_mac_[6] = {};
+static uint8_t s_txfr_done_id_ = 0;
+static bool s_txfr_done_valid_ = false;
+
+/** @brief Create the engine mutex on first use (either direction). */
+static bool txfrEnsure()
+{
+    if (s_txfr_mutex_ == nullptr) {
+        s_txfr_mutex_ = xSemaphoreCreateMutex();
+    }
+    return s_txfr_mutex_ != nullptr;
+}
+
+/** @brief Send the receiver's window state (doubles as every verdict). */
+static void txfrSendAck(const uint8_t mac[6], uint8_t device_id, uint8_t stream_id,
+                        uint8_t status, uint16_t base, uint32_t have_mask)
+{
+    TransferAckPayload ack{};
+    ack.stream_id = stream_id;
+    ack.status = status;
+    ack.base = base;
+    ack.have_mask = have_mask;
+    (void)sendPacketTo(mac, device_id, espnow::MsgType::TransferAck, &ack, sizeof(ack));
+}
+
+/** @brief Stage one chunk for the sender task (mutex held). */
+static void txfrSendChunk(uint16_t index)
+{
+    uint8_t frame[espnow::MAX_PAYLOAD_SIZE_];
+    frame[0] = s_txfr_tx_.stream_id;
+    std::memcpy(frame + 1, &index, sizeof(index));
+    const uint32_t off = static_cast<uint32_t>(index) * TRANSFER_CHUNK_DATA_;
+    const uint32_t n = std::min<uint32_t>(TRANSFER_CHUNK_DATA_, s_txfr_tx_.len - off);
+    std::memcpy(frame + 3, s_txfr_tx_.data + off, n);
+    (void)sendPacketTo(s_txfr_tx_.mac, 0, espnow::MsgType::TransferChunk,
+                       frame, static_cast<uint8_t>(3 + n));
+}
+
+/** @brief Chunks sent but not yet confirmed by the last ack (mutex held). */
+static uint16_t txfrOutstanding()
+{
+    const uint16_t span = static_cast<uint16_t>(s_txfr_tx_.next_unsent - s_txfr_tx_.base);
+    const int have = __builtin_popcount(s_txfr_tx_.have_mask);
+    return (span > have) ? static_cast<uint16_t>(span - have) : 0;
+}
+
+/**
+ * @brief Drive the outbound window (mutex held)
+ * @details Retransmits before fresh data: holes the last ack exposed are
+ *          what the receiver is stalled on. At most TRANSFER_BURST_ sends
+ *          per pass so a transfer never monopolizes the TX pool.
+ */
+static void txfrPump(bool resend_missing)
+{
+    if (!s_txfr_tx_.active || !s_txfr_tx_.announced) {
+        return;
+    }
+    uint16_t budget = TRANSFER_BURST_;
+    if (resend_missing) {
+        // The base chunk is missing by definition; bitmap holes follow.
+        if (s_txfr_tx_.base < s_txfr_tx_.next_unsent && budget > 0) {
+            txfrSendChunk(s_txfr_tx_.base);
+            --budget;
+        }
+        for (uint16_t i = 0; i < 32 && budget > 0; ++i) {
+            const uint16_t idx = static_cast<uint16_t>(s_txfr_tx_.base + 1 + i);
+            if (idx >= s_txfr_tx_.next_unsent) {
+                break;
+            }
+            if ((s_txfr_tx_.have_mask & (1UL << i)) == 0) {
+                txfrSendChunk(idx);
+                --budget;
+            }
+        }
+    }
+    while (budget > 0 && s_txfr_tx_.next_unsent < s_txfr_tx_.total_chunks &&
+           txfrOutstanding() < TRANSFER_WINDOW_) {
+        txfrSendChunk(s_txfr_tx_.next_unsent++);
+        --budget;
+    }
+}
+
+/** @brief Finish the outbound stream and report (mutex held on entry). */
+static void txfrSenderFinish(bool ok)
+{
+    const espnow::TransferProgressFn cb = s_txfr_tx_.progress;
+    const auto kind = static_cast<espnow::TransferKind>(s_txfr_tx_.kind);
+    const uint32_t total = s_txfr_tx_.len;
+    s_txfr_tx_ = TxfrSender{};
+    xSemaphoreGive(s_txfr_mutex_);
+    if (cb != nullptr) {
+        cb(kind, ok ? total : 0, total, ok, !ok);
+    }
+    xSemaphoreTake(s_txfr_mutex_, portMAX_DELAY);
+}
+
+/** @brief Tear down the inbound stream (mutex held). */
+static void txfrRxReset()
+{
+    free(s_txfr_rx_.buf);
+    s_txfr_rx_ = TxfrReceiver{};
+}
+
+/** @brief Handle TransferBegin (receive task). */
+static void txfrHandleBegin(const uint8_t src_mac[6], uint8_t device_id,
+                            const uint8_t* payload)
+{
+    TransferBeginPayload b{};
+    std::memcpy(&b, payload, sizeof(b));
+    if (!txfrEnsure()) {
+        return;
+    }
+    xSemaphoreTake(s_txfr_mutex_, portMAX_DELAY);
+    if (s_txfr_rx_.active) {
+        if (b.stream_id == s_txfr_rx_.stream_id &&
+            std::memcmp(src_mac, s_txfr_rx_.mac, 6) == 0) {
+            // Duplicate announcement (our accept was lost): re-ack.
+            txfrSendAck(src_mac, device_id, b.stream_id, TXFR_ACCEPT,
+                        s_txfr_rx_.base, s_txfr_rx_.have_mask);
+        } else {
+            txfrSendAck(src_mac, device_id, b.stream_id, TXFR_BUSY, 0, 0);
+        }
+        xSemaphoreGive(s_txfr_mutex_);
+        return;
+    }
+    if (s_txfr_done_valid_ && b.stream_id == s_txfr_done_id_ &&
+        std::memcmp(src_mac, s_txfr_done_mac_, 6) == 0) {
+        // Already delivered; the sender missed the Done.
+        txfrSendAck(src_mac, device_id, b.stream_id, TXFR_DONE, 0, 0);
+        xSemaphoreGive(s_txfr_mutex_);
+        return;
+    }
+    uint8_t verdict = TXFR_ACCEPT;
+    if (s_txfr_sink_ == nullptr) {
+        verdict = TXFR_NO_SINK;
+    } else if (b.total_len == 0 || b.total_len > TRANSFER_RX_MAX_ ||
+               b.chunk_len == 0 || b.chunk_len > TRANSFER_CHUNK_DATA_) {
+        verdict = TXFR_TOO_BIG;
+    }
+    if (verdict != TXFR_ACCEPT) {
+        txfrSendAck(src_mac, device_id, b.stream_id, verdict, 0, 0);
+        xSemaphoreGive(s_txfr_mutex_);
+        return;
+    }
+    uint8_t* buf = static_cast<uint8_t*>(malloc(b.total_len));
+    if (buf == nullptr) {
+        txfrSendAck(src_mac, device_id, b.stream_id, TXFR_TOO_BIG, 0, 0);
+        xSemaphoreGive(s_txfr_mutex_);
+        return;
+    }
+    s_txfr_rx_.active = true;
+    s_txfr_rx_.stream_id = b.stream_id;
+    s_txfr_rx_.kind = b.kind;
+    std::memcpy(s_txfr_rx_.mac, src_mac, 6);
+    s_txfr_rx_.device_id = device_id;
+    s_txfr_rx_.buf = buf;
+    s_txfr_rx_.len = b.total_len;
+    s_txfr_rx_.chunk_len = b.chunk_len;
+    s_txfr_rx_.total_chunks =
+        static_cast<uint16_t>((b.total_len + b.chunk_len - 1) / b.chunk_len);
+    s_txfr_rx_.crc16 = b.crc16;
+    s_txfr_rx_.last_rx_tick = xTaskGetTickCount();
+    s_txfr_rx_.last_ack_tick = s_txfr_rx_.last_rx_tick;
+    ESP_LOGI(TAG_, "Transfer: inbound kind %u, %lu B in %u chunks", b.kind,
+             static_cast<unsigned long>(b.total_len), s_txfr_rx_.total_chunks);
+    txfrSendAck(src_mac, device_id, b.stream_id, TXFR_ACCEPT, 0, 0);
+    xSemaphoreGive(s_txfr_mutex_);
+}
+
+/** @brief Handle TransferChunk (receive task). */
+static void txfrHandleChunk(const uint8_t src_mac[6], const uint8_t* payload,
+                            uint8_t len)
+{
+    if (s_txfr_mutex_ == nullptr) {
+        return;
+    }
+    const uint8_t stream_id = payload[0];
+    uint16_t index = 0;
+    std::memcpy(&index, payload + 1, sizeof(index));
+    const uint16_t data_len = static_cast<uint16_t>(len - 3);
+
+    xSemaphoreTake(s_txfr_mutex_, portMAX_DELAY);
+    if (!s_txfr_rx_.active || stream_id != s_txfr_rx_.stream_id ||
+        std::memcmp(src_mac, s_txfr_rx_.mac, 6) != 0) {
+        if (s_txfr_done_valid_ && stream_id == s_txfr_done_id_ &&
+            std::memcmp(src_mac, s_txfr_done_mac_, 6) == 0) {
+            txfrSendAck(src_mac, 0, stream_id, TXFR_DONE, 0, 0);
+        }
+        xSemaphoreGive(s_txfr_mutex_);
+        return;
+    }
+    TxfrReceiver& rx = s_txfr_rx_;
+    rx.last_rx_tick = xTaskGetTickCount();
+
+    const uint32_t off = static_cast<uint32_t>(index) * rx.chunk_len;
+    const bool in_window = index >= rx.base &&
+                           static_cast<uint16_t>(index - rx.base) <= 32 &&
+                           index < rx.total_chunks &&
+                           off + data_len <= rx.len;
+    if (!in_window) {
+        // Behind: a retransmit of something already placed, drop. Ahead of
+        // the window (or malformed): ack so the sender re-learns the base.
+        if (index >= rx.base &&
+            (xTaskGetTickCount() - rx.last_ack_tick) >= pdMS_TO_TICKS(TRANSFER_ACK_MS_)) {
+            rx.last_ack_tick = xTaskGetTickCount();
+            rx.since_ack = 0;
+            txfrSendAck(rx.mac, rx.device_id, rx.stream_id, TXFR_PROGRESS,
+                        rx.base, rx.have_mask);
+        }
+        xSemaphoreGive(s_txfr_mutex_);
+        return;
+    }
+
+    std::memcpy(rx.buf + off, payload + 3, data_len);
+    if (index == rx.base) {
+        ++rx.base;
+        while ((rx.have_mask & 1UL) != 0) {
+            rx.have_mask >>= 1;
+            ++rx.base;
+        }
+        rx.have_mask >>= 1;
+    } else {
+        rx.have_mask |= 1UL << (index - rx.base - 1);
+    }
+
+    if (rx.base >= rx.total_chunks) {
+        // Complete: verify, deliver, remember the stream for done-echo.
+        const bool crc_ok = espnow::crc16_ccitt(rx.buf, rx.len) == rx.crc16;
+        txfrSendAck(rx.mac, rx.device_id, rx.stream_id,
+                    crc_ok ? TXFR_DONE : TXFR_CRC, rx.base, 0);
+        if (crc_ok) {
+            std::memcpy(s_txfr_done_mac_, rx.mac, 6);
+            s_txfr_done_id_ = rx.stream_id;
+            s_txfr_done_valid_ = true;
+            const espnow::TransferSinkFn sink = s_txfr_sink_;
+            uint8_t* buf = rx.buf;
+            const uint32_t total = rx.len;
+            const auto kind = static_cast<espnow::TransferKind>(rx.kind);
+            uint8_t mac[6];
+            std::memcpy(mac, rx.mac, 6);
+            rx.buf = nullptr;  // ownership moves past the unlock
+            txfrRxReset();
+            xSemaphoreGive(s_txfr_mutex_);
+            if (sink != nullptr) {
+                sink(kind, mac, buf, total);
+            }
+            free(buf);
+            return;
+        }
+        ESP_LOGW(TAG_, "Transfer: stream %u failed CRC", rx.stream_id);
+        txfrRxReset();
+        xSemaphoreGive(s_txfr_mutex_);
+        return;
+    }
+
+    if (++rx.since_ack >= TRANSFER_ACK_EVERY_) {
+        rx.since_ack = 0;
+        rx.last_ack_tick = xTaskGetTickCount();
+        txfrSendAck(rx.mac, rx.device_id, rx.stream_id, TXFR_PROGRESS,
+                    rx.base, rx.have_mask);
+    }
+    xSemaphoreGive(s_txfr_mutex_);
+}
+
+/** @brief Handle TransferAck (receive task). */
+static void txfrHandleAck(const uint8_t src_mac[6], const uint8_t* payload)
+{
+    if (s_txfr_mutex_ == nullptr) {
+        return;
+    }
+    TransferAckPayload ack{};
+    std::memcpy(&ack, payload, sizeof(ack));
+
+    xSemaphoreTake(s_txfr_mutex_, portMAX_DELAY);
+    if (!s_txfr_tx_.active || ack.stream_id != s_txfr_tx_.stream_id ||
+        std::memcmp(src_mac, s_txfr_tx_.mac, 6) != 0) {
+        xSemaphoreGive(s_txfr_mutex_);
+        return;
+    }
+    TxfrSender& tx = s_txfr_tx_;
+    tx.last_ack_tick = xTaskGetTickCount();
+    tx.retries = 0;
+
+    switch (ack.status) {
+        case TXFR_ACCEPT:
+            tx.announced = true;
+            tx.base = ack.base;
+            tx.have_mask = ack.have_mask;
+            txfrPump(false);
+            break;
+        case TXFR_PROGRESS: {
+            const uint16_t old_base = tx.base;
+            tx.base = ack.base;
+            tx.have_mask = ack.have_mask;
+            // A stalled base with holes behind fresh data is a loss signal
+            // worth acting on now, not at the stall timeout.
+            txfrPump(ack.base == old_base && ack.have_mask != 0);
+            if (tx.progress != nullptr && ack.base != old_base) {
+                const espnow::TransferProgressFn cb = tx.progress;
+                const auto kind = static_cast<espnow::TransferKind>(tx.kind);
+                const uint32_t done =
+                    std::min<uint32_t>(static_cast<uint32_t>(ack.base) * TRANSFER_CHUNK_DATA_,
+                                       tx.len);
+                const uint32_t total = tx.len;
+                xSemaphoreGive(s_txfr_mutex_);
+                cb(kind, done, total, false, false);
+                xSemaphoreTake(s_txfr_mutex_, portMAX_DELAY);
+            }
+            break;
+        }
+        case TXFR_DONE:
+            ESP_LOGI(TAG_, "Transfer: stream %u delivered (%lu B)", tx.stream_id,
+                     static_cast<unsigned long>(tx.len));
+            txfrSenderFinish(true);
+            break;
+        default:
+            ESP_LOGW(TAG_, "Transfer: stream %u rejected (status %u)",
+                     tx.stream_id, ack.status);
+            txfrSenderFinish(false);
+            break;
+    }
+    xSemaphoreGive(s_txfr_mutex_);
+}
+
+/**
+ * @brief Periodic transfer service (receive task)
+ * @details Sender side: re-announce or retransmit on stall, give up after
+ *          enough strikes. Receiver side: periodic ack as a resume beacon,
+ *          reclaim the buffer when a sender disappears mid-stream.
+ */
+static void serviceTransfer()
+{
+    if (s_txfr_mutex_ == nullptr) {
+        return;
+    }
+    const TickType_t now = xTaskGetTickCount();
+    xSemaphoreTake(s_txfr_mutex_, portMAX_DELAY);
+    if (s_txfr_tx_.active &&
+        (now - s_txfr_tx_.last_ack_tick) >= pdMS_TO_TICKS(TRANSFER_STALL_MS_)) {
+        s_txfr_tx_.last_ack_tick = now;
+        if (++s_txfr_tx_.retries > TRANSFER_RETRIES_) {
+            ESP_LOGW(TAG_, "Transfer: stream %u timed out", s_txfr_tx_.stream_id);
+            txfrSenderFinish(false);
+        } else if (!s_txfr_tx_.announced) {
+            TransferBeginPayload b{};
+            b.stream_id = s_txfr_tx_.stream_id;
+            b.kind = s_txfr_tx_.kind;
+            b.total_len = s_txfr_tx_.len;
+            b.chunk_len = TRANSFER_CHUNK_DATA_;
+            b.crc16 = espnow::crc16_ccitt(s_txfr_tx_.data, s_txfr_tx_.len);
+            (void)sendPacketTo(s_txfr_tx_.mac, 0, espnow::MsgType::TransferBegin,
+                               &b, sizeof(b));
+        } else {
+            txfrPump(true);
+        }
+    }
+    if (s_txfr_rx_.active) {
+        if ((now - s_txfr_rx_.last_rx_tick) >= pdMS_TO_TICKS(TRANSFER_RX_IDLE_MS_)) {
+            ESP_LOGW(TAG_, "Transfer: inbound stream %u abandoned",
+                     s_txfr_rx_.stream_id);
+            txfrRxReset();
+        } else if ((now - s_txfr_rx_.last_ack_tick) >= pdMS_TO_TICKS(TRANSFER_ACK_MS_)) {
+            s_txfr_rx_.last_ack_tick = now;
+            s_txfr_rx_.since_ack = 0;
+            txfrSendAck(s_txfr_rx_.mac, s_txfr_rx_.device_id, s_txfr_rx_.stream_id,
+                        TXFR_PROGRESS, s_txfr_rx_.base, s_txfr_rx_.have_mask);
+        }
+    }
+    xSemaphoreGive(s_txfr_mutex_);
+}
+
+bool espnow::StartTransfer(const uint8_t mac[6], TransferKind kind,
+                           const uint8_t* data, uint32_t len,
+                           TransferProgressFn progress) noexcept
+{
+    if (mac == nullptr || data == nullptr || len == 0 || !txfrEnsure()) {
+        return false;
+    }
+    xSemaphoreTake(s_txfr_mutex_, portMAX_DELAY);
+    if (s_txfr_tx_.active) {
+        xSemaphoreGive(s_txfr_mutex_);
+        return false;
+    }
+    s_txfr_tx_.active = true;
+    s_txfr_tx_.announced = false;
+    s_txfr_tx_.stream_id = s_txfr_next_id_++;
+    if (s_txfr_next_id_ == 0) {
+        s_txfr_next_id_ = 1;
+    }
+    s_txfr_tx_.kind = static_cast<uint8_t>(kind);
+    std::memcpy(s_txfr_tx_.mac, mac, 6);
+    s_txfr_tx_.data = data;
+    s_txfr_tx_.len = len;
+    s_txfr_tx_.total_chunks =
+        static_cast<uint16_t>((len + TRANSFER_CHUNK_DATA_ - 1) / TRANSFER_CHUNK_DATA_);
+    s_txfr_tx_.progress = progress;
+    s_txfr_tx_.last_ack_tick = xTaskGetTickCount();
+
+    TransferBeginPayload b{};
+    b.stream_id = s_txfr_tx_.stream_id;
+    b.kind = s_txfr_tx_.kind;
+    b.total_len = len;
+    b.chunk_len = TRANSFER_CHUNK_DATA_;
+    b.crc16 = espnow::crc16_ccitt(data, len);
+    const bool sent = sendPacketTo(mac, 0, espnow::MsgType::TransferBegin, &b, sizeof(b));
+    ESP_LOGI(TAG_, "Transfer: stream %u outbound, %lu B in %u chunks",
+             s_txfr_tx_.stream_id, static_cast<unsigned long>(len),
+             s_txfr_tx_.total_chunks);
+    xSemaphoreGive(s_txfr_mutex_);
+    return sent;
+}
+
+bool espnow::TransferBusy() noexcept
+{
+    if (s_txfr_mutex_ == nullptr) {
+        return false;
+    }
+    xSemaphoreTake(s_txfr_mutex_, portMAX_DELAY);
+    const bool busy = s_txfr_tx_.active;
+    xSemaphoreGive(s_txfr_mutex_);
+    return busy;
+}
+
+void espnow::SetTransferSink(TransferSinkFn fn) noexcept
+{
+    s_txfr_sink_ = fn;
+}
+
+// ============================================================================
+// MAC-LAYER TX STATUS FUSION
+// ============================================================================
+//
+// The send callback reports per-frame delivery at the MAC layer (the peer
+// acked the 802.11 frame or it did not). That signal arrives milliseconds
+// after the send - long before any end-to-end ack timeout - so it is fused
+// into the reliability engine: a failed send pulls the matching in-flight
+// entries' retry deadline forward to "now" (the 20 ms receive-task loop
+// becomes the retry latency instead of the 60 ms RTO), and a per-peer
+// consecutive-failure streak lets the supervisor start probing a peer whose
+// transmissions are bouncing without waiting out the quiet window. The
+// callback itself only touches word-sized fields (it runs in the WiFi
+// task); the receive task consumes them.
+
+struct TxPeerStatus {
+    bool valid;                     ///< Slot in use (claimed by the WiFi task)
+    uint8_t mac[6];                 ///< Peer MAC
+    volatile uint32_t fail_streak;  ///< Consecutive MAC-layer send failures
+    volatile bool fail_note;        ///< Unconsumed failure (retry acceleration)
+};
+static TxPeerStatus s_tx_peer_status_[MAX_APPROVED_PEERS];
+
+/// Failure streak at which the supervisor treats a peer as suspect and
+/// starts fast probing even though the rx quiet window has not elapsed.
+static constexpr uint32_t TXFAIL_PROBE_STREAK_ = 4;
+
+/** @brief Record one send outcome for @p mac (WiFi task, send callback). */
+static void txStatusNote(const uint8_t mac[6], bool ok)
+{
+    TxPeerStatus* slot = nullptr;
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        TxPeerStatus& e = s_tx_peer_status_[i];
+        if (e.valid && std::memcmp(e.mac, mac, 6) == 0) {
+            slot = &e;
+            break;
+        }
+        if (slot == nullptr && !e.valid) {
+            slot = &e;
+        }
+    }
+    if (slot == nullptr) {
+        return;
+    }
+    if (!slot->valid) {
+        std::memcpy(slot->mac, mac, 6);
+        slot->fail_streak = 0;
+        slot->fail_note = false;
+        slot->valid = true;  // Last, so the reader never sees a torn slot
+    }
+    if (ok) {
+        slot->fail_streak = 0;
+    } else {
+        slot->fail_streak = slot->fail_streak + 1;
+        slot->fail_note = true;
+    }
+}
+
+/** @brief Current consecutive-failure streak for @p mac (receive task). */
+static uint32_t txFailStreak(const uint8_t mac[6])
+{
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        const TxPeerStatus& e = s_tx_peer_status_[i];
+        if (e.valid && std::memcmp(e.mac, mac, 6) == 0) {
+            return e.fail_streak;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Consume pending failure notes: retry the affected sends now
+ * @details Runs from the receive task every <=20 ms. Deadlines only move
+ *          earlier; the backoff ladder in serviceRetransmits still grows
+ *          per attempt, so a persistently deaf peer cannot pin the radio.
+ */
+static void serviceTxStatus()
+{
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        TxPeerStatus& e = s_tx_peer_status_[i];
+        if (!e.valid || !e.fail_note) {
+            continue;
+        }
+        e.fail_note = false;
+        if (s_inflight_mutex_ == nullptr) {
+            continue;
+        }
+        const TickType_t now = xTaskGetTickCount();
+        xSemaphoreTake(s_inflight_mutex_, portMAX_DELAY);
+        for (size_t j = 0; j < INFLIGHT_SIZE_; ++j) {
+            InflightEntry& f = s_inflight_[j];
+            if (f.valid && std::memcmp(f.dst_mac, e.mac, 6) == 0 &&
+                static_cast<int32_t>(f.next_retry_tick - now) > 0) {
+                f.next_retry_tick = now;
+            }
+        }
+        xSemaphoreGive(s_inflight_mutex_);
+    }
+}
+
+// ============================================================================
+// LINK SUPERVISOR
+// ============================================================================
+//
+// Passive rx-timeout detection alone leaves a peer looking dead until its
+// next unsolicited packet after an RF gap. The supervisor actively probes
+// quiet approved FatigueTester peers with Ping/Echo: not at all while
+// traffic flows, at a rapid cadence once a probe goes unanswered, and at a
+// slow background rate while down. Transitions are posted to the app queue
+// as internal LinkUp/LinkDown events. All state is touched only from the
+// receive task (probe timing and rx notes both run there), so no lock is
+// needed.
+
+static constexpr uint32_t SUPERVISE_QUIET_MS_ = 1200;   ///< Silence before probing
+static constexpr uint32_t PROBE_FAST_MS_ = 150;         ///< Probe cadence while suspect
+static constexpr uint32_t PROBE_DOWN_MS_ = 500;         ///< Probe cadence while down
+static constexpr uint8_t PROBE_LIMIT_ = 4;              ///< Unanswered probes => down
+static constexpr uint32_t SUPERVISE_RESCAN_MS_ = 2000;  ///< Peer table refresh period
+
+struct SupervisedLink {
+    uint8_t mac[6];             ///< Peer MAC
+    bool in_use;                ///< Slot holds a supervised peer
+    bool up;                    ///< Peer currently considered reachable
+    bool ever_seen;             ///< At least one packet received
+    TickType_t last_rx_tick;    ///< Any packet from this peer
+    TickType_t last_probe_tick; ///< Last Ping sent
+    TickType_t ping_sent_tick;  ///< Timestamp of the outstanding Ping
+    uint8_t probes_out;         ///< Unanswered probes since last rx
+    uint8_t ping_id;            ///< Header id of the outstanding Ping
+};
+static SupervisedLink s_links_[MAX_APPROVED_PEERS];
+static TickType_t s_link_rescan_tick_ = 0;
+static uint8_t s_ping_seq_ = 1;
+
+/** @brief Post an internal LinkUp/LinkDown event for @p mac. */
+static void supervisorPostEvent(espnow::MsgType type, const uint8_t mac[6])
+{
+    espnow::ProtoEvent evt{};
+    evt.type = type;
+    std::memcpy(evt.src_mac, mac, 6);
+    // Link verdicts are rare; the scan resolves the identity the consumer
+    // would otherwise look up itself.
+    evt.peer_index = espnow::LookupPeerIndex(mac);
+    if (type == espnow::MsgType::LinkUp) {
+        // A restored link replays any journaled critical command at once
+        // instead of waiting out the rest of its 1 s cadence.
+        journalNoteLinkUp(mac);
+    }
+    (void)queueProtoEvent(evt);
+}
+
+/**
+ * @brief Note traffic from @p mac; drives the down->up transition
+ * @details Any authenticated packet proves liveness, so healthy links with
+ *          regular telemetry are never pinged at all.
+ */
+static void supervisorNoteRx(const uint8_t mac[6])
+{
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        SupervisedLink& e = s_links_[i];
+        if (!e.in_use || std::memcmp(e.mac, mac, 6) != 0) {
+            continue;
+        }
+        e.last_rx_tick = xTaskGetTickCount();
+        e.probes_out = 0;
+        e.ever_seen = true;
+        if (!e.up) {
+            e.up = true;
+            supervisorPostEvent(espnow::MsgType::LinkUp, e.mac);
+        }
+        return;
+    }
+}
+
+/** @brief Echo arrived: feed the RTT estimator if it answers our Ping. */
+static void supervisorNoteEcho(const uint8_t mac[6], uint8_t echo_id)
+{
+    const TickType_t now = xTaskGetTickCount();
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        SupervisedLink& e = s_links_[i];
+        if (e.in_use && e.ping_id == echo_id && std::memcmp(e.mac, mac, 6) == 0) {
+            updatePeerRtt(mac, pdTICKS_TO_MS(now - e.ping_sent_tick));
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Periodic supervision: refresh the peer set and probe quiet links
+ * @details Runs from the receive task every <=20 ms alongside the
+ *          retransmit engine.
+ */
+static void serviceSupervisor()
+{
+    const TickType_t now = xTaskGetTickCount();
+
+    // Refresh the supervised set from the peer store (pairing changes it).
+    if (now - s_link_rescan_tick_ >= pdMS_TO_TICKS(SUPERVISE_RESCAN_MS_) ||
+        s_link_rescan_tick_ == 0) {
+        s_link_rescan_tick_ = now;
+        uint8_t macs[MAX_APPROVED_PEERS][6];
+        const size_t n = PeerStore::GetPeersOfType(s_security_, DeviceType::FatigueTester,
+                                                   macs, MAX_APPROVED_PEERS);
+        for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+            SupervisedLink& e = s_links_[i];
+            if (!e.in_use) {
+                continue;
+            }
+            bool still_approved = false;
+            for (size_t j = 0; j < n; ++j) {
+                if (std::memcmp(e.mac, macs[j], 6) == 0) {
+                    still_approved = true;
+                    break;
+                }
+            }
+            if (!still_approved) {
+                e = SupervisedLink{};
+            }
+        }
+        for (size_t j = 0; j < n; ++j) {
+            bool known = false;
+            for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+                if (s_links_[i].in_use && std::memcmp(s_links_[i].mac, macs[j], 6) == 0) {
+                    known = true;
+                    break;
+                }
+            }
+            if (known) {
+                continue;
+            }
+            for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+                if (!s_links_[i].in_use) {
+                    s_links_[i] = SupervisedLink{};
+                    std::memcpy(s_links_[i].mac, macs[j], 6);
+                    s_links_[i].in_use = true;
+                    tryAddEspNowPeer(macs[j]);
+                    break;
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        SupervisedLink& e = s_links_[i];
+        if (!e.in_use) {
+            continue;
+        }
+        if (e.up) {
+            // A MAC-layer failure streak means our frames are bouncing off
+            // this peer right now; skip the quiet window and start probing
+            // immediately so link-down lands in probe-cadence time.
+            const bool tx_failing = txFailStreak(e.mac) >= TXFAIL_PROBE_STREAK_;
+            if (!tx_failing && now - e.last_rx_tick < pdMS_TO_TICKS(SUPERVISE_QUIET_MS_)) {
+                continue;  // recent traffic, nothing to prove
+            }
+            if (e.probes_out > 0 && now - e.last_probe_tick < pdMS_TO_TICKS(PROBE_FAST_MS_)) {
+                continue;
+            }
+            if (e.probes_out >= PROBE_LIMIT_) {
+                e.up = false;
+                supervisorPostEvent(espnow::MsgType::LinkDown, e.mac);
+                continue;
+            }
+        } else {
+            // Down (or never seen): keep a slow background probe running so
+            // recovery is detected without waiting for unsolicited traffic.
+            if (now - e.last_probe_tick < pdMS_TO_TICKS(PROBE_DOWN_MS_)) {
+                continue;
+            }
+        }
+        e.ping_id = s_ping_seq_++;
+        if (s_ping_seq_ == 0) {
+            s_ping_seq_ = 1;
+        }
+        e.ping_sent_tick = now;
+        e.last_probe_tick = now;
+        if (e.probes_out < PROBE_LIMIT_) {
+            ++e.probes_out;
+        }
+        (void)sendPacketRaw(e.mac, 0, espnow::MsgType::Ping, e.ping_id, nullptr, 0);
+    }
+}
+
+// ============================================================================
+// TIME SYNCHRONIZATION
+// ============================================================================
+//
+// The session log here and the one on the fatigue unit each count from
+// their own millis zero, so correlating the two after an incident means
+// eyeballing timestamps across files. A periodic micro-NTP exchange with
+// every supervised peer establishes the mapping instead: the request
+// carries the local clock, the reply adds the peer's receive and transmit
+// stamps, and the round trip brackets the offset. The dominant error
+// source is an asymmetric round trip (one leg retried at the MAC layer),
+// so only samples whose RTT sits near the best observed pass the filter;
+// the best-RTT floor decays slowly upward so a permanently changed link
+// can re-qualify. Accepted samples are smoothed, and the app is told
+// (TimeSyncUpdate) only when the offset is first established or steps
+// visibly - the resulting log anchors are rare and land in both devices'
+// logs, which is exactly what merging two timelines needs. Peers running
+// firmware without TimeSync never answer and simply stay unsynchronized.
+// All state is touched only from the receive task, like the supervisor.
+
+static constexpr uint32_t TSYNC_PERIOD_MS_ = 10000;  ///< Cadence once locked
+static constexpr uint32_t TSYNC_ACQUIRE_MS_ = 1000;  ///< Cadence until locked
+static constexpr uint32_t TSYNC_RTT_MARGIN_MS_ = 4;  ///< Accept window above best RTT
+static constexpr int32_t TSYNC_STEP_MS_ = 10;        ///< Offset step worth republishing
+
+#pragma pack(push, 1)
+/** @brief TimeSync wire payload; flags bit0 set marks the reply */
+struct TimeSyncWire {
+    uint32_t origin_ms;   ///< Requester clock at request send
+    uint32_t peer_rx_ms;  ///< Responder clock at request receive (reply only)
+    uint32_t peer_tx_ms;  ///< Responder clock at reply send (reply only)
+    uint8_t flags;        ///< bit0: reply
+};
+#pragma pack(pop)
+
+struct TimeSyncPeer {
+    uint8_t mac[6];            ///< Peer MAC
+    bool in_use;               ///< Slot holds a synchronized peer
+    bool valid;                ///< Offset established
+    bool published;            ///< First lock announced to the app
+    int32_t offset_ms;         ///< peer_ms - local_ms, smoothed
+    int32_t published_ms;      ///< Offset last announced to the app
+    uint16_t best_rtt_ms;      ///< RTT floor the accept filter works from
+    uint16_t last_rtt_ms;      ///< RTT of the last accepted sample
+    uint8_t req_id;            ///< Header id of the outstanding request
+    uint32_t origin_ms;        ///< Clock stamp of the outstanding request
+    TickType_t last_tx_tick;   ///< Last request sent
+    TickType_t last_accept_tick;  ///< Last accepted sample
+};
+static TimeSyncPeer s_tsync_[MAX_APPROVED_PEERS];
+static uint8_t s_tsync_seq_ = 1;
+
+/** @brief Millisecond clock the sync stamps are taken from. */
+static uint32_t tsyncNowMs()
+{
+    return timebase::NowMs32();
+}
+
+/** @brief Find (or claim) the sync slot for @p mac; nullptr when full. */
+static TimeSyncPeer* tsyncSlot(const uint8_t mac[6], bool claim)
+{
+    TimeSyncPeer* free_slot = nullptr;
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        TimeSyncPeer& e = s_tsync_[i];
+        if (e.in_use && std::memcmp(e.mac, mac, 6) == 0) {
+            return &e;
+        }
+        if (!e.in_use && free_slot == nullptr) {
+            free_slot = &e;
+        }
+    }
+    if (claim && free_slot != nullptr) {
+        *free_slot = TimeSyncPeer{};
+        std::memcpy(free_slot->mac, mac, 6);
+        free_slot->in_use = true;
+        return free_slot;
+    }
+    return nullptr;
+}
+
+/** @brief A sync reply arrived: filter the sample and fold it in. */
+static void tsyncHandleReply(const uint8_t mac[6], uint8_t id,
+                             const uint8_t* payload, size_t len)
+{
+    if (payload == nullptr || len < sizeof(TimeSyncWire)) {
+        return;
+    }
+    TimeSyncWire w;
+    std::memcpy(&w, payload, sizeof(w));
+
+    TimeSyncPeer* e = tsyncSlot(mac, false);
+    if (e == nullptr || e->req_id != id || e->origin_ms != w.origin_ms) {
+        return;  // stale or duplicated reply
+    }
+    e->req_id = 0;
+
+    const uint32_t t1 = w.origin_ms;
+    const uint32_t t2 = w.peer_rx_ms;
+    const uint32_t t3 = w.peer_tx_ms;
+    const uint32_t t4 = tsyncNowMs();
+    const uint32_t rtt = (t4 - t1) - (t3 - t2);
+    if (rtt > 0x7FFF) {
+        return;  // wrapped or nonsense stamps
+    }
+    // Symmetric-delay estimate; each term is a small signed difference
+    // even though the clocks themselves are unrelated.
+    const int32_t sample =
+        (static_cast<int32_t>(t2 - t1) + static_cast<int32_t>(t3 - t4)) / 2;
+
+    // Popcorn filter: the floor rises by one per sample so a link whose
+    // genuine RTT degraded can re-qualify within a few periods.
+    if (e->best_rtt_ms < 0xFFFF) {
+        ++e->best_rtt_ms;
+    }
+    if (!e->valid || rtt < e->best_rtt_ms) {
+        e->best_rtt_ms = static_cast<uint16_t>(rtt);
+    }
+    if (e->valid && rtt > e->best_rtt_ms + TSYNC_RTT_MARGIN_MS_) {
+        return;  // asymmetric round trip; wait for a cleaner one
+    }
+
+    e->last_rtt_ms = static_cast<uint16_t>(rtt);
+    e->last_accept_tick = xTaskGetTickCount();
+    if (!e->valid) {
+        e->offset_ms = sample;
+        e->valid = true;
+    } else {
+        e->offset_ms += (sample - e->offset_ms) / 4;
+    }
+
+    // Republish only on first lock or a visible step, so the log anchor
+    // the app writes stays rare.
+    const int32_t drift = e->offset_ms - e->published_ms;
+    if (!e->published || drift >= TSYNC_STEP_MS_ || drift <= -TSYNC_STEP_MS_) {
+        e->published = true;
+        e->published_ms = e->offset_ms;
+        // The last peer to publish defines the shared epoch; with one
+        // supervised machine that is simply the machine clock.
+        timebase::NoteSharedOffset(e->offset_ms);
+        supervisorPostEvent(espnow::MsgType::TimeSyncUpdate, e->mac);
+    }
+}
+
+/**
+ * @brief Periodic sync: probe every supervised up link on its cadence
+ * @details Runs from the receive task alongside the supervisor; the
+ *          acquire cadence converges a fresh link within a few seconds,
+ *          then the locked cadence just tracks drift.
+ */
+static void serviceTimeSync()
+{
+    const TickType_t now = xTaskGetTickCount();
+
+    // Drop slots whose peer left the supervised set (unpairing).
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        TimeSyncPeer& e = s_tsync_[i];
+        if (!e.in_use) {
+            continue;
+        }
+        bool supervised = false;
+        for (size_t j = 0; j < MAX_APPROVED_PEERS; ++j) {
+            if (s_links_[j].in_use && std::memcmp(s_links_[j].mac, e.mac, 6) == 0) {
+                supervised = true;
+                break;
+            }
+        }
+        if (!supervised) {
+            e = TimeSyncPeer{};
+        }
+    }
+
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        const SupervisedLink& link = s_links_[i];
+        if (!link.in_use || !link.up) {
+            continue;
+        }
+        TimeSyncPeer* e = tsyncSlot(link.mac, true);
+        if (e == nullptr) {
+            continue;
+        }
+        const uint32_t cadence = e->valid ? TSYNC_PERIOD_MS_ : TSYNC_ACQUIRE_MS_;
+        if (e->last_tx_tick != 0 && now - e->last_tx_tick < pdMS_TO_TICKS(cadence)) {
+            continue;
+        }
+        e->req_id = s_tsync_seq_++;
+        if (s_tsync_seq_ == 0) {
+            s_tsync_seq_ = 1;
+        }
+        e->last_tx_tick = now;
+
+        TimeSyncWire w{};
+        w.origin_ms = tsyncNowMs();
+        e->origin_ms = w.origin_ms;
+        (void)sendPacketRaw(e->mac, 0, espnow::MsgType::TimeSync, e->req_id,
+                            &w, sizeof(w));
+    }
+}
+
+bool espnow::GetPeerTimeSync(const uint8_t mac[6], PeerTimeSync& out) noexcept
+{
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        const TimeSyncPeer& e = s_tsync_[i];
+        if (!e.in_use || !e.valid || std::memcmp(e.mac, mac, 6) != 0) {
+            continue;
+        }
+        out.offset_ms = e.offset_ms;
+        out.rtt_ms = e.last_rtt_ms;
+        out.age_ms = pdTICKS_TO_MS(xTaskGetTickCount() - e.last_accept_tick);
+        return true;
+    }
+    return false;
+}
+
+// ============================================================================
+// CHANNEL AGILITY
+// ============================================================================
+//
+// WIFI_CHANNEL_ is only the first-boot default: when the factory WiFi
+// saturates the current channel, delivery degrades in a way the retransmit
+// engine can mask but not fix. The send callback tallies per-window MAC-layer
+// outcomes; when the failure ratio (or the smoothed RTT to the active unit)
+// crosses the degradation threshold, the protocol announces a hop to the
+// next candidate channel with a ChannelSwitch message, moves after a short
+// countdown, and reverts if no authenticated packet arrives on the new
+// channel. A confirmed hop is persisted in the peer store so both sides
+// rejoin on the working channel after a reboot. All hop state is touched
+// only from the receive task; the callback counters are plain word writes.
+
+static constexpr uint8_t CH_CANDIDATES_[] = {1, 6, 11};  ///< Non-overlapping 2.4 GHz set
+static constexpr uint32_t CH_EVAL_WINDOW_MS_ = 5000;     ///< Delivery stats window
+static constexpr uint32_t CH_MIN_SENDS_ = 20;            ///< Sends before a verdict
+static constexpr uint32_t CH_FAIL_PERCENT_ = 25;         ///< Failure ratio => degraded
+static constexpr uint32_t CH_RTT_LIMIT_MS_ = 250;        ///< Smoothed RTT => degraded
+static constexpr uint8_t CH_ANNOUNCE_COUNT_ = 3;         ///< Hop announcements per peer
+static constexpr uint32_t CH_ANNOUNCE_GAP_MS_ = 40;      ///< Spacing between announcements
+static constexpr uint32_t CH_HOP_SLACK_MS_ = 120;        ///< Countdown past the last announce
+static constexpr uint32_t CH_PROBATION_MS_ = 3000;       ///< Silence on new channel => revert
+static constexpr uint32_t CH_HOP_BACKOFF_MS_ = 30000;    ///< Min spacing between hop attempts
+static constexpr uint32_t WARM_VERIFY_DELAY_MS_ = 3000;  ///< Warm-boot NVS check deferral
+
+#pragma pack(push, 1)
+/** @brief ChannelSwitch payload: where to go and how long until the sender hops */
+struct ChannelSwitchPayload {
+    uint8_t channel;    ///< Target channel number
+    uint16_t hop_in_ms; ///< Milliseconds until the announcing side switches
+};
+#pragma pack(pop)
+
+enum class ChannelPhase : uint8_t {
+    Idle,       ///< Monitoring delivery stats on the current channel
+    Announcing, ///< Locally initiated hop: announcing, then counting down
+    Armed,      ///< Remote-initiated hop: counting down to the switch
+    Probation,  ///< Hopped; waiting for proof of life on the new channel
+};
+
+static volatile uint32_t s_ch_send_ok_ = 0;         ///< Window MAC-layer successes (send cb)
+static volatile uint32_t s_ch_send_fail_ = 0;       ///< Window MAC-layer failures (send cb)
+static ChannelPhase s_ch_phase_ = ChannelPhase::Idle;
+static uint8_t s_ch_target_ = 0;                    ///< Channel being hopped to
+static uint8_t s_ch_prev_ = 0;                      ///< Channel to revert to
+static uint8_t s_ch_announces_left_ = 0;            ///< Announcements still to send
+static uint8_t s_ch_announce_id_ = 0;               ///< Header id shared by the announcements
+static TickType_t s_ch_window_tick_ = 0;            ///< Current stats window start
+static TickType_t s_ch_phase_tick_ = 0;             ///< Last phase action timestamp
+static TickType_t s_ch_hop_tick_ = 0;               ///< When the switch happens
+static TickType_t s_ch_last_hop_tick_ = 0;          ///< Backoff anchor
+static bool s_ch_probation_rx_ = false;             ///< Authenticated RX since the hop
+
+static bool s_warm_verify_pending_ = false;         ///< RTC-cached channel awaits NVS check
+static TickType_t s_warm_verify_tick_ = 0;          ///< First service pass timestamp
+
+/** @brief True if @p ch is one of the channels we are willing to operate on. */
+static bool channelIsCandidate(uint8_t ch)
+{
+    for (uint8_t c : CH_CANDIDATES_) {
+        if (c == ch) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Retune the radio and every registered ESP-NOW peer to @p ch
+ * @details Broadcast peer included; ESP-NOW delivers nothing to a peer whose
+ *          stored channel disagrees with the radio.
+ */
+static void applyChannel(uint8_t ch)
+{
+    const esp_err_t err = esp_wifi_set_channel(ch, WIFI_SECOND_CHAN_NONE);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG_, "esp_wifi_set_channel(%u) failed: %s", ch, esp_err_to_name(err));
+        return;
+    }
+    esp_now_peer_info_t peer{};
+    for (esp_err_t it = esp_now_fetch_peer(true, &peer); it == ESP_OK;
+         it = esp_now_fetch_peer(false, &peer)) {
+        peer.channel = ch;
+        (void)esp_now_mod_peer(&peer);
+    }
+    s_channel_ = ch;
+    s_ch_send_ok_ = 0;
+    s_ch_send_fail_ = 0;
+    s_ch_window_tick_ = xTaskGetTickCount();
+}
+
+/** @brief Authenticated packet arrived; confirms a hop while on probation. */
+static void channelNoteAuthRx()
+{
+    if (s_ch_phase_ == ChannelPhase::Probation) {
+        s_ch_probation_rx_ = true;
+    }
+}
+
+/**
+ * @brief Inbound ChannelSwitch from an approved peer: arm the hop
+ * @details The paired unit runs the same degradation logic; whichever side
+ *          sees the problem first initiates. Repeated announcements share a
+ *          header id, so the receive window has already collapsed them to
+ *          one delivery.
+ */
+static void channelHandleSwitch(const uint8_t* payload, uint8_t len)
+{
+    if (len < sizeof(ChannelSwitchPayload)) {
+        return;
+    }
+    ChannelSwitchPayload p{};
+    std::memcpy(&p, payload, sizeof(p));
+    if (!channelIsCandidate(p.channel) || p.channel == s_channel_ ||
+        s_ch_phase_ != ChannelPhase::Idle) {
+        return;
+    }
+    s_ch_target_ = p.channel;
+    s_ch_prev_ = s_channel_;
+    s_ch_hop_tick_ = xTaskGetTickCount() + pdMS_TO_TICKS(p.hop_in_ms);
+    s_ch_phase_ = ChannelPhase::Armed;
+    ESP_LOGI(TAG_, "Peer requested hop to channel %u in %u ms", p.channel, p.hop_in_ms);
+}
+
+/**
+ * @brief Deferred verification of the warm-boot channel cache
+ * @details A warm boot tunes to the RTC-cached channel without the NVS read
+ *          on the boot path. This runs once from the receive task a few
+ *          seconds in: the cache was stamped at the same sites that persist
+ *          the channel, so a mismatch means the NVS copy is stale (a hop
+ *          confirmed after the last commit landed) and is healed by
+ *          re-persisting the live value. The radio is never retuned here.
+ */
+static void serviceWarmVerify()
+{
+    if (!s_warm_verify_pending_) {
+        return;
+    }
+    const TickType_t now = xTaskGetTickCount();
+    if (s_warm_verify_tick_ == 0) {
+        s_warm_verify_tick_ = now;
+        return;
+    }
+    if (now - s_warm_verify_tick_ < pdMS_TO_TICKS(WARM_VERIFY_DELAY_MS_)) {
+        return;
+    }
+    s_warm_verify_pending_ = false;
+    uint8_t saved_ch = 0;
+    if (!PeerStore::LoadChannel(saved_ch) || saved_ch != s_channel_) {
+        ESP_LOGI(TAG_, "Cached channel %u not persisted (NVS has %u); healing",
+                 s_channel_, saved_ch);
+        PeerStore::SaveChannel(s_channel_);
+    }
+}
+
+// Coexistence governor hooks (defined in the section below): a fresh
+// congestion survey upgrades the blind next-in-list hop to a pick of the
+// least congested candidate, and degradation opportunistically queues a
+// survey for the next quiet window.
+static bool coexPickHopTarget(uint8_t current, uint8_t& out);
+static void coexQueueSurvey();
+
+/**
+ * @brief Periodic channel-quality evaluation and hop state machine
+ * @details Runs from the receive task every <=20 ms alongside the retransmit
+ *          engine and supervisor.
+ */
+static void serviceChannelAgility()
+{
+    const TickType_t now = xTaskGetTickCount();
+
+    switch (s_ch_phase_) {
+        case ChannelPhase::Idle: {
+            if (now - s_ch_window_tick_ < pdMS_TO_TICKS(CH_EVAL_WINDOW_MS_)) {
+                return;
+            }
+            const uint32_t ok = s_ch_send_ok_;
+            const uint32_t fail = s_ch_send_fail_;
+            s_ch_send_ok_ = 0;
+            s_ch_send_fail_ = 0;
+            s_ch_window_tick_ = now;
+            const uint32_t total = ok + fail;
+            if (total < CH_MIN_SENDS_) {
+                return;
+            }
+            bool degraded = fail * 100 >= total * CH_FAIL_PERCENT_;
+            if (!degraded) {
+                uint8_t mac[6];
+                uint32_t rtt_ms = 0;
+                degraded = espnow::GetTargetDeviceMac(mac) &&
+                           espnow::GetPeerRttMs(mac, rtt_ms) && rtt_ms > CH_RTT_LIMIT_MS_;
+            }
+            if (!degraded ||
+                (s_ch_last_hop_tick_ != 0 &&
+                 now - s_ch_last_hop_tick_ < pdMS_TO_TICKS(CH_HOP_BACKOFF_MS_))) {
+                return;
+            }
+            // Survey-informed target when a fresh congestion survey exists;
+            // blind next-in-list otherwise (and queue a survey so the next
+            // hop from this mess is informed).
+            uint8_t target = 0;
+            if (!coexPickHopTarget(s_channel_, target)) {
+                size_t idx = 0;
+                for (size_t i = 0; i < sizeof(CH_CANDIDATES_); ++i) {
+                    if (CH_CANDIDATES_[i] == s_channel_) {
+                        idx = i;
+                        break;
+                    }
+                }
+                target = CH_CANDIDATES_[(idx + 1) % sizeof(CH_CANDIDATES_)];
+                coexQueueSurvey();
+            }
+            s_ch_target_ = target;
+            s_ch_prev_ = s_channel_;
+            s_ch_announces_left_ = CH_ANNOUNCE_COUNT_;
+            s_ch_announce_id_ = s_next_msg_id_++;
+            s_ch_hop_tick_ = now + pdMS_TO_TICKS(CH_ANNOUNCE_COUNT_ * CH_ANNOUNCE_GAP_MS_ +
+                                                 CH_HOP_SLACK_MS_);
+            // Make the first announcement go out on this pass.
+            s_ch_phase_tick_ = now - pdMS_TO_TICKS(CH_ANNOUNCE_GAP_MS_);
+            s_ch_phase_ = ChannelPhase::Announcing;
+            ESP_LOGW(TAG_, "Channel %u degraded (%lu/%lu sends failed), hopping to %u",
+                     s_channel_, (unsigned long)fail, (unsigned long)total, s_ch_target_);
+            return;
+        }
+        case ChannelPhase::Announcing: {
+            if (s_ch_announces_left_ > 0 &&
+                now - s_ch_phase_tick_ >= pdMS_TO_TICKS(CH_ANNOUNCE_GAP_MS_)) {
+                ChannelSwitchPayload p{};
+                p.channel = s_ch_target_;
+                const TickType_t left =
+                    (s_ch_hop_tick_ > now) ? (s_ch_hop_tick_ - now) : 0;
+                p.hop_in_ms = (uint16_t)pdTICKS_TO_MS(left);
+                uint8_t macs[MAX_APPROVED_PEERS][6];
+                const size_t n = PeerStore::GetPeersOfType(
+                    s_security_, DeviceType::FatigueTester, macs, MAX_APPROVED_PEERS);
+                for (size_t i = 0; i < n; ++i) {
+                    (void)sendPacketRaw(macs[i], 0, espnow::MsgType::ChannelSwitch,
+                                        s_ch_announce_id_, &p, sizeof(p));
+                }
+                --s_ch_announces_left_;
+                s_ch_phase_tick_ = now;
+            }
+            if (s_ch_announces_left_ == 0 && now >= s_ch_hop_tick_) {
+                applyChannel(s_ch_target_);
+                s_ch_last_hop_tick_ = now;
+                s_ch_probation_rx_ = false;
+                s_ch_phase_tick_ = now;
+                s_ch_phase_ = ChannelPhase::Probation;
+            }
+            return;
+        }
+        case ChannelPhase::Armed: {
+            if (now >= s_ch_hop_tick_) {
+                applyChannel(s_ch_target_);
+                s_ch_last_hop_tick_ = now;
+                s_ch_probation_rx_ = false;
+                s_ch_phase_tick_ = now;
+                s_ch_phase_ = ChannelPhase::Probation;
+            }
+            return;
+        }
+        case ChannelPhase::Probation: {
+            if (s_ch_probation_rx_) {
+                PeerStore::SaveChannel(s_channel_);
+                fast_boot::NoteChannel(s_channel_);
+                ESP_LOGI(TAG_, "Channel %u confirmed, persisted", s_channel_);
+                s_ch_phase_ = ChannelPhase::Idle;
+                return;
+            }
+            if (now - s_ch_phase_tick_ >= pdMS_TO_TICKS(CH_PROBATION_MS_)) {
+                ESP_LOGW(TAG_, "No traffic on channel %u, reverting to %u",
+                         s_channel_, s_ch_prev_);
+                applyChannel(s_ch_prev_);
+                s_ch_last_hop_tick_ = now;
+                s_ch_phase_ = ChannelPhase::Idle;
+            }
+            return;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// PHY RATE PROFILE (long-range fallback)
+// ---------------------------------------------------------------------------
+//
+// At the far cells the stock 1 Mbps ESP-NOW rate runs out of link budget
+// before the retransmit engine runs out of tricks. The PHY's long-range
+// mode buys several dB of sensitivity at 250 kbps, but only another
+// Espressif part can decode it and it costs 4x the airtime — so it is
+// selected per peer, never globally. The governor watches the receive-side
+// link quality (the peer's frames to us are a fair proxy for path loss in
+// both directions): past the engage thresholds the peer's TX rate config
+// is switched to LR and proven with probe pings — an echo means the peer's
+// firmware listens on the LR rate and the profile sticks; silence means
+// older firmware (or a truly dead path), so the config reverts and LR is
+// held off for that peer. Once the link is strong again the peer falls
+// back to the standard rate, keeping the LR airtime tax at the edge only.
+// Our own protocol mask always includes LR (set at init), which adds
+// reception of LR frames without affecting standard traffic. All state is
+// touched only from the receive task, read lock-free like s_peer_qual_.
+
+enum class PhyProfile : uint8_t {
+    Standard,   ///< Stock ESP-NOW rate (1 Mbps 11b)
+    LrProbe,    ///< Switched to LR, waiting for an echo to prove it
+    LongRange,  ///< LR proven and active
+};
+
+/// Per-peer PHY rate state
+struct PeerPhy {
+    bool in_use;
+    uint8_t mac[6];
+    PhyProfile profile;
+    uint8_t probe_id;         ///< Ping id the LR probe is waiting on
+    uint8_t probes_sent;      ///< Probes sent in the current attempt
+    TickType_t probe_tick;    ///< Last probe send
+    TickType_t changed_tick;  ///< Last profile change (dwell timer)
+    TickType_t holdoff_tick;  ///< Start of the hold-off after a failed probe
+    bool holdoff;             ///< A probe attempt failed recently
+};
+
+static PeerPhy s_peer_phy_[MAX_APPROVED_PEERS];
+static TickType_t s_phy_eval_tick_ = 0;
+
+static constexpr int32_t PHY_LR_ENGAGE_RSSI_ = -78;   ///< Engage LR at/below this RSSI (dBm)
+static constexpr uint8_t PHY_LR_ENGAGE_LOSS_ = 25;    ///< ...or at/above this loss (%)
+static constexpr int32_t PHY_LR_RELEASE_RSSI_ = -70;  ///< Release at/above this RSSI (dBm)
+static constexpr uint8_t PHY_LR_RELEASE_LOSS_ = 5;    ///< ...with loss at/below this (%)
+static constexpr uint32_t PHY_EVAL_MS_ = 5000;        ///< Threshold evaluation cadence
+static constexpr uint32_t PHY_MIN_DWELL_MS_ = 10000;  ///< Min time in a profile (no flapping)
+static constexpr uint32_t PHY_PROBE_GAP_MS_ = 200;    ///< LR probe ping cadence
+static constexpr uint8_t PHY_PROBE_LIMIT_ = 3;        ///< Unanswered LR probes => revert
+static constexpr uint32_t PHY_HOLDOFF_MS_ = 120000;   ///< Retry gap after a failed attempt
+
+/**
+ * @brief Point the peer's TX rate config at the LR or the stock rate
+ */
+static void applyPeerPhyRate(const uint8_t mac[6], bool lr)
+{
+    esp_now_rate_config_t cfg{};
+    if (lr) {
+        cfg.phymode = WIFI_PHY_MODE_LR;
+        cfg.rate = WIFI_PHY_RATE_LORA_250K;
+    } else {
+        // Stock ESP-NOW default: 1 Mbps 11b, long preamble.
+        cfg.phymode = WIFI_PHY_MODE_11B;
+        cfg.rate = WIFI_PHY_RATE_1M_L;
+    }
+    const esp_err_t err = esp_now_set_peer_rate_config(mac, &cfg);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG_, "Peer rate config (%s) failed: %s",
+                 lr ? "LR" : "std", esp_err_to_name(err));
+    }
+}
+
+/**
+ * @brief Find (or claim) the PHY slot for a peer
+ */
+static PeerPhy* phySlotFor(const uint8_t mac[6])
+{
+    PeerPhy* slot = nullptr;
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        if (s_peer_phy_[i].in_use && std::memcmp(s_peer_phy_[i].mac, mac, 6) == 0) {
+            return &s_peer_phy_[i];
+        }
+        if (slot == nullptr && !s_peer_phy_[i].in_use) {
+            slot = &s_peer_phy_[i];
+        }
+    }
+    if (slot != nullptr) {
+        *slot = PeerPhy{};
+        slot->in_use = true;
+        std::memcpy(slot->mac, mac, 6);
+    }
+    return slot;
+}
+
+/**
+ * @brief Echo arrived - if it answers an LR probe, the LR profile is proven
+ */
+static void phyNoteEcho(const uint8_t mac[6], uint8_t echo_id)
+{
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        PeerPhy& e = s_peer_phy_[i];
+        if (e.in_use && e.profile == PhyProfile::LrProbe && e.probe_id == echo_id &&
+            std::memcmp(e.mac, mac, 6) == 0) {
+            e.profile = PhyProfile::LongRange;
+            e.changed_tick = xTaskGetTickCount();
+            ESP_LOGI(TAG_, "LR rate engaged for %02X:%02X:%02X:%02X:%02X:%02X",
+                     mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Rate governor pass: drive probes, evaluate thresholds
+ * @details Runs from the receive task. Probe follow-up runs at ping
+ *          cadence; the threshold evaluation is gated to PHY_EVAL_MS_.
+ */
+static void servicePhyProfile()
+{
+    const TickType_t now = xTaskGetTickCount();
+
+    // Probe follow-up: resend until answered or the limit reverts us.
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        PeerPhy& e = s_peer_phy_[i];
+        if (!e.in_use || e.profile != PhyProfile::LrProbe) {
+            continue;
+        }
+        if (now - e.probe_tick < pdMS_TO_TICKS(PHY_PROBE_GAP_MS_)) {
+            continue;
+        }
+        if (e.probes_sent >= PHY_PROBE_LIMIT_) {
+            // No echo at the LR rate: peer firmware predates LR support
+            // (or the path is beyond even LR). Back to the stock rate,
+            // and do not retry for a while.
+            applyPeerPhyRate(e.mac, false);
+            e.profile = PhyProfile::Standard;
+            e.changed_tick = now;
+            e.holdoff = true;
+            e.holdoff_tick = now;
+            ESP_LOGW(TAG_, "LR probe unanswered, peer stays at standard rate");
+            continue;
+        }
+        e.probe_id = s_ping_seq_++;
+        if (s_ping_seq_ == 0) {
+            s_ping_seq_ = 1;
+        }
+        e.probe_tick = now;
+        ++e.probes_sent;
+        (void)sendPacketRaw(e.mac, 0, espnow::MsgType::Ping, e.probe_id, nullptr, 0);
+    }
+
+    if (s_phy_eval_tick_ != 0 && now - s_phy_eval_tick_ < pdMS_TO_TICKS(PHY_EVAL_MS_)) {
+        return;
+    }
+    s_phy_eval_tick_ = now;
+
+    // Drop slots for peers the supervisor no longer tracks (unpaired).
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        PeerPhy& e = s_peer_phy_[i];
+        if (!e.in_use) {
+            continue;
+        }
+        bool tracked = false;
+        for (size_t j = 0; j < MAX_APPROVED_PEERS; ++j) {
+            if (s_links_[j].in_use && std::memcmp(s_links_[j].mac, e.mac, 6) == 0) {
+                tracked = true;
+                break;
+            }
+        }
+        if (!tracked) {
+            e = PeerPhy{};
+        }
+    }
+
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        const SupervisedLink& link = s_links_[i];
+        if (!link.in_use || !link.up) {
+            continue;
+        }
+        PeerPhy* e = phySlotFor(link.mac);
+        if (e == nullptr) {
+            continue;
+        }
+        if (e->holdoff && now - e->holdoff_tick >= pdMS_TO_TICKS(PHY_HOLDOFF_MS_)) {
+            e->holdoff = false;
+        }
+        if (now - e->changed_tick < pdMS_TO_TICKS(PHY_MIN_DWELL_MS_)) {
+            continue;
+        }
+        const PeerLinkQual* q = nullptr;
+        for (size_t j = 0; j < MAX_APPROVED_PEERS; ++j) {
+            if (s_peer_qual_[j].valid && std::memcmp(s_peer_qual_[j].mac, link.mac, 6) == 0) {
+                q = &s_peer_qual_[j];
+                break;
+            }
+        }
+        if (q == nullptr) {
+            continue;
+        }
+        if (e->profile == PhyProfile::Standard && !e->holdoff &&
+            (q->rssi_ewma <= PHY_LR_ENGAGE_RSSI_ || q->loss_pct >= PHY_LR_ENGAGE_LOSS_)) {
+            applyPeerPhyRate(link.mac, true);
+            e->profile = PhyProfile::LrProbe;
+            e->probes_sent = 0;
+            // Backdate so the probe loop fires on the next service pass.
+            e->probe_tick = now - pdMS_TO_TICKS(PHY_PROBE_GAP_MS_);
+            e->changed_tick = now;
+            ESP_LOGI(TAG_, "Link at the edge (%d dBm, %u%% loss), probing LR rate",
+                     static_cast<int>(q->rssi_ewma), static_cast<unsigned>(q->loss_pct));
+        } else if (e->profile == PhyProfile::LongRange &&
+                   q->rssi_ewma >= PHY_LR_RELEASE_RSSI_ &&
+                   q->loss_pct <= PHY_LR_RELEASE_LOSS_) {
+            applyPeerPhyRate(link.mac, false);
+            e->profile = PhyProfile::Standard;
+            e->changed_tick = now;
+            ESP_LOGI(TAG_, "Link strong again (%d dBm), back to standard rate",
+                     static_cast<int>(q->rssi_ewma));
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// WIFI COEXISTENCE GOVERNOR
+// ---------------------------------------------------------------------------
+// Station-mode WiFi work (channel surveys now; NTP and AP-based features
+// later) takes the radio off-channel, and a naive full scan stalls ESP-NOW
+// for hundreds of milliseconds — unacceptable while a test is running. All
+// such work funnels through this governor: requests only queue, the service
+// pass performs at most one bounded single-channel slice per quiet window
+// (no running test, nothing tracked in flight, no OTA transfer, channel
+// agility idle), and after every slice the radio is retuned to s_channel_
+// unconditionally, so ESP-NOW deterministically returns to the channel its
+// peers are on. The survey result feeds channel agility's hop-target
+// choice. All state is touched only from the receive task except the
+// s_coex_pending_ request flag and the UI's run-state latch, which are
+// single-word writes.
+
+static constexpr uint32_t COEX_DWELL_MS_ = 40;           ///< Passive dwell per slice
+static constexpr uint32_t COEX_GAP_MS_ = 250;            ///< Quiet spacing between slices
+static constexpr uint32_t COEX_SURVEY_FRESH_MS_ = 300000;  ///< Hop decisions trust this long
+static constexpr size_t COEX_CHANNELS_ = sizeof(CH_CANDIDATES_);
+static_assert(espnow::SURVEY_CHANNELS == sizeof(CH_CANDIDATES_),
+              "Survey slots must mirror the agility candidate list");
+
+static volatile bool s_coex_pending_ = false;   ///< Survey requested (any task)
+static volatile bool s_test_running_ = false;   ///< UI-reported run state
+static bool s_coex_scanning_ = false;           ///< Slices in progress
+static size_t s_coex_idx_ = 0;                  ///< Next candidate to dwell on
+static TickType_t s_coex_slice_tick_ = 0;       ///< Last slice end
+static espnow::ChannelSurvey s_coex_survey_{};  ///< Last completed survey
+static TickType_t s_coex_survey_tick_ = 0;      ///< When it completed
+
+/** @brief Queue a survey for the next quiet window (idempotent). */
+static void coexQueueSurvey()
+{
+    s_coex_pending_ = true;
+}
+
+/**
+ * @brief True while the link can tolerate a bounded off-channel dwell
+ */
+static bool coexLinkQuiet()
+{
+    if (s_test_running_ || s_ch_phase_ != ChannelPhase::Idle ||
+        s_ota_state_ != espnow::OtaState::Idle) {
+        return false;
+    }
+    // Any tracked packet still waiting for its ack outranks a scan slice.
+    if (s_inflight_mutex_ != nullptr) {
+        bool busy = false;
+        xSemaphoreTake(s_inflight_mutex_, portMAX_DELAY);
+        for (size_t i = 0; i < INFLIGHT_SIZE_; ++i) {
+            if (s_inflight_[i].valid) {
+                busy = true;
+                break;
+            }
+        }
+        xSemaphoreGive(s_inflight_mutex_);
+        if (busy) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief One bounded passive dwell on a single candidate channel
+ * @details Blocking, but for COEX_DWELL_MS_ plus scan overhead — one late
+ *          receive-task pass, not hundreds of milliseconds. The AP list is
+ *          drained (and freed) immediately; only the count and the
+ *          strongest RSSI are kept.
+ * @return false if the scan could not start (survey is abandoned)
+ */
+static bool coexScanSlice(size_t idx)
+{
+    wifi_scan_config_t cfg{};
+    cfg.channel = CH_CANDIDATES_[idx];
+    cfg.scan_type = WIFI_SCAN_TYPE_PASSIVE;
+    cfg.scan_time.passive = COEX_DWELL_MS_;
+    cfg.show_hidden = true;
+    if (esp_wifi_scan_start(&cfg, true) != ESP_OK) {
+        return false;
+    }
+
+    uint16_t total = 0;
+    (void)esp_wifi_scan_get_ap_num(&total);
+    wifi_ap_record_t records[8];
+    uint16_t fetched = (total < 8) ? total : 8;
+    int8_t best = -128;
+    if (fetched > 0 && esp_wifi_scan_get_ap_records(&fetched, records) == ESP_OK) {
+        for (uint16_t i = 0; i < fetched; ++i) {
+            if (records[i].rssi > best) {
+                best = static_cast<int8_t>(records[i].rssi);
+            }
+        }
+    }
+    (void)esp_wifi_clear_ap_list();
+
+    s_coex_survey_.channels[idx] = CH_CANDIDATES_[idx];
+    s_coex_survey_.ap_count[idx] = (total > 255) ? 255 : static_cast<uint8_t>(total);
+    s_coex_survey_.best_rssi[idx] = best;
+    return true;
+}
+
+/**
+ * @brief Coexistence service pass: at most one scan slice per quiet window
+ * @details Runs from the receive task after channel agility. The channel
+ *          restore happens after every slice, not just the last, so an
+ *          abandoned survey can never leave the radio off-channel.
+ */
+static void serviceCoex()
+{
+    if (!s_coex_pending_ && !s_coex_scanning_) {
+        return;
+    }
+    const TickType_t now = xTaskGetTickCount();
+    if (now - s_coex_slice_tick_ < pdMS_TO_TICKS(COEX_GAP_MS_)) {
+        return;
+    }
+    if (!coexLinkQuiet()) {
+        return;
+    }
+
+    if (!s_coex_scanning_) {
+        s_coex_pending_ = false;
+        s_coex_scanning_ = true;
+        s_coex_idx_ = 0;
+        s_coex_survey_.valid = false;
+    }
+
+    const bool ok = coexScanSlice(s_coex_idx_);
+    applyChannel(s_channel_);  // Deterministic return to the working channel
+    s_coex_slice_tick_ = xTaskGetTickCount();
+
+    if (!ok) {
+        ESP_LOGW(TAG_, "Coex: scan slice on channel %u failed, survey abandoned",
+                 CH_CANDIDATES_[s_coex_idx_]);
+        s_coex_scanning_ = false;
+        return;
+    }
+    if (++s_coex_idx_ >= COEX_CHANNELS_) {
+        s_coex_scanning_ = false;
+        s_coex_survey_.valid = true;
+        s_coex_survey_tick_ = xTaskGetTickCount();
+        ESP_LOGI(TAG_, "Coex: survey done ch%u=%u ch%u=%u ch%u=%u APs",
+                 s_coex_survey_.channels[0], s_coex_survey_.ap_count[0],
+                 s_coex_survey_.channels[1], s_coex_survey_.ap_count[1],
+                 s_coex_survey_.channels[2], s_coex_survey_.ap_count[2]);
+    }
+}
+
+/**
+ * @brief Survey-informed hop target: least congested candidate != current
+ * @return false when no fresh survey exists (caller falls back and queues one)
+ */
+static bool coexPickHopTarget(uint8_t current, uint8_t& out)
+{
+    if (!s_coex_survey_.valid ||
+        xTaskGetTickCount() - s_coex_survey_tick_ > pdMS_TO_TICKS(COEX_SURVEY_FRESH_MS_)) {
+        return false;
+    }
+    bool found = false;
+    uint8_t best_count = 255;
+    for (size_t i = 0; i < COEX_CHANNELS_; ++i) {
+        if (s_coex_survey_.channels[i] == current) {
+            continue;
+        }
+        if (!found || s_coex_survey_.ap_count[i] < best_count) {
+            found = true;
+            best_count = s_coex_survey_.ap_count[i];
+            out = s_coex_survey_.channels[i];
+        }
+    }
+    return found;
+}
+
+bool espnow::RequestChannelSurvey() noexcept
+{
+    if (s_coex_scanning_) {
+        return false;
+    }
+    coexQueueSurvey();
+    return true;
+}
+
+bool espnow::GetChannelSurvey(ChannelSurvey& out) noexcept
+{
+    // Single writer (receive task); a read racing the final slice sees
+    // valid=false. Age is computed here so the copy stays tear-benign.
+    out = s_coex_survey_;
+    out.age_ms = out.valid
+        ? static_cast<uint32_t>(pdTICKS_TO_MS(xTaskGetTickCount() - s_coex_survey_tick_))
+        : 0;
+    return out.valid;
+}
+
+void espnow::NoteTestRunning(bool running) noexcept
+{
+    s_test_running_ = running;
+}
+
+/**
+ * @brief Send ESP-NOW packet to a specific peer MAC
+ * @details Command and ConfigSet packets are additionally tracked for
+ *          retransmission until the matching ack arrives.
+ * @param dst_mac Destination MAC address (6 bytes)
+ * @param device_id Device identifier
+ * @param type Message type
+ * @param payload Payload data (may be nullptr)
+ * @param payload_len Payload length
+ * @return true if send successful, false otherwise
+ */
+static bool sendPacketToMac(const uint8_t dst_mac[6], uint8_t device_id, espnow::MsgType type,
+                            const void* payload, uint8_t payload_len)
+{
+    const uint8_t msg_id = s_next_msg_id_++;
+    if (!sendPacketRaw(dst_mac, device_id, type, msg_id, payload, payload_len)) {
+        return false;
+    }
+    if (type == espnow::MsgType::Command || type == espnow::MsgType::ConfigSet ||
+        type == espnow::MsgType::ConfigDelta) {
+        trackInflight(dst_mac, device_id, type, msg_id, payload, payload_len);
+        // Black box: commands carry their id in byte 0, config packets log
+        // their length.
+        const uint16_t detail = (type == espnow::MsgType::Command && payload_len > 0)
+                                    ? static_cast<const uint8_t*>(payload)[0]
+                                    : payload_len;
+        blackbox::Note(blackbox::Kind::TxCmd, static_cast<uint8_t>(type), detail);
+    }
+    return true;
+}
+
+/**
+ * @brief Send ESP-NOW packet to target device (first FatigueTester peer)
+ * @param device_id Device identifier
+ * @param type Message type
+ * @param payload Payload data (may be nullptr)
+ * @param payload_len Payload length
+ * @return true if send successful, false if no target configured
+ */
+static bool sendPacketToTarget(uint8_t device_id, espnow::MsgType type,
+                               const void* payload, uint8_t payload_len)
+{
+    uint8_t target_mac[6];
+    if (!espnow::GetTargetDeviceMac(target_mac)) {
+        ESP_LOGW(TAG_, "No target device configured");
+        return false;
+    }
+    return sendPacketToMac(target_mac, device_id, type, payload, payload_len);
+}
+
+bool espnow::Init(QueueHandle_t event_queue) noexcept
+{
+    s_proto_event_queue_ = event_queue;
+    s_qs_proto_ = queue_stats::SlotFor(event_queue);
+    s_raw_recv_queue_ = xQueueCreate(RX_POOL_SIZE_, sizeof(RawMsg*));
+    s_qs_rawrx_ = queue_stats::Register(s_raw_recv_queue_, "rawrx", RX_POOL_SIZE_);
+    s_rx_free_queue_ = xQueueCreate(RX_POOL_SIZE_, sizeof(RawMsg*));
+    for (size_t i = 0; i < RX_POOL_SIZE_; ++i) {
+        RawMsg* buf = &s_rx_pool_[i];
+        xQueueSend(s_rx_free_queue_, &buf, 0);
+    }
+    s_inflight_mutex_ = xSemaphoreCreateMutex();
+
+    // Initialize peer store with pre-configured MAC (backward compatibility)
+    PeerStore::Init(s_security_, TEST_UNIT_MAC_, DeviceType::FatigueTester, "Pre-configured");
+
+    esp_err_t err = esp_netif_init();
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+        ESP_LOGE(TAG_, "esp_netif_init failed: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    err = esp_event_loop_create_default();
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+        ESP_LOGE(TAG_, "esp_event_loop_create_default failed: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
+    err = esp_wifi_init(&cfg);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG_, "esp_wifi_init failed: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    err = esp_wifi_set_storage(WIFI_STORAGE_RAM);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG_, "esp_wifi_set_storage failed: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    err = esp_wifi_set_mode(WIFI_MODE_STA);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG_, "esp_wifi_set_mode failed: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    err = esp_wifi_start();
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG_, "esp_wifi_start failed: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    // Include LR in our protocol mask so frames a peer sends at the
+    // long-range rate are receivable; standard traffic is unaffected.
+    // Non-fatal - without it the per-peer LR profile just never engages.
+    err = esp_wifi_set_protocol(WIFI_IF_STA,
+                                WIFI_PROTOCOL_11B | WIFI_PROTOCOL_11G |
+                                WIFI_PROTOCOL_11N | WIFI_PROTOCOL_LR);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG_, "esp_wifi_set_protocol(+LR) failed: %s", esp_err_to_name(err));
+    }
+
+    // Start on the channel a previous session confirmed as working. A warm
+    // boot takes it from the RTC token without touching NVS; the stored
+    // copy is verified later from the receive task (serviceWarmVerify).
+    // First boot (or an implausible value either way) falls back to the
+    // default.
+    const uint8_t cached_ch = fast_boot::CachedChannel();
+    if (cached_ch != 0 && channelIsCandidate(cached_ch)) {
+        s_channel_ = cached_ch;
+        s_warm_verify_pending_ = true;
+        if (cached_ch != WIFI_CHANNEL_) {
+            ESP_LOGI(TAG_, "Using cached channel %u (NVS verify deferred)", cached_ch);
+        }
+    } else {
+        uint8_t saved_ch = 0;
+        if (PeerStore::LoadChannel(saved_ch) && channelIsCandidate(saved_ch)) {
+            s_channel_ = saved_ch;
+            if (saved_ch != WIFI_CHANNEL_) {
+                ESP_LOGI(TAG_, "Using persisted channel %u", saved_ch);
+            }
+        }
+    }
+    err = esp_wifi_set_channel(s_channel_, WIFI_SECOND_CHAN_NONE);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG_, "esp_wifi_set_channel failed: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    uint8_t mac_addr[6];
+    esp_wifi_get_mac(WIFI_IF_STA, mac_addr);
+    ESP_LOGI(TAG_, "Remote Controller MAC (STA): %02X:%02X:%02X:%02X:%02X:%02X",
+             mac_addr[0], mac_addr[1], mac_addr[2], mac_addr[3], mac_addr[4], mac_addr[5]);
+
+    err = esp_now_init();
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG_, "esp_now_init failed: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    // Connectionless power save: when the UI's power governor light-sleeps
+    // the cores, the radio still opens a receive window every interval so
+    // keepalives and acks arrive during the nap. Window/interval trade RX
+    // latency (worst case one interval) against modem-on time.
+    (void)esp_now_set_wake_window(50);
+    (void)esp_wifi_connectionless_module_set_wake_interval(200);
+
+    err = esp_now_register_recv_cb(espnowRecvCb);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG_, "esp_now_register_recv_cb failed: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    err = esp_now_register_send_cb(espnowSendCb);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG_, "esp_now_register_send_cb failed: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    // Add broadcast peer for pairing discovery
+    esp_now_peer_info_t broadcast_peer{};
+    std::memcpy(broadcast_peer.peer_addr, BROADCAST_MAC, 6);
+    broadcast_peer.channel = s_channel_;
+    broadcast_peer.ifidx = WIFI_IF_STA;
+    broadcast_peer.encrypt = false;
+    esp_now_add_peer(&broadcast_peer);
+
+    // Add pre-configured peer (backward compatibility)
+    if (!IsZeroMac(TEST_UNIT_MAC_)) {
+        tryAddEspNowPeer(TEST_UNIT_MAC_);
+        ESP_LOGI(TAG_, "Pre-configured test unit: %02X:%02X:%02X:%02X:%02X:%02X",
+                 TEST_UNIT_MAC_[0], TEST_UNIT_MAC_[1], TEST_UNIT_MAC_[2],
+                 TEST_UNIT_MAC_[3], TEST_UNIT_MAC_[4], TEST_UNIT_MAC_[5]);
+    }
+
+    // Add any previously paired peers. The ESP-NOW registrations are lost
+    // on every reset and always redone; the per-peer log lines only repeat
+    // what the last session already printed, so a warm boot collapses them
+    // to a count.
+    size_t restored = 0;
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        const auto& peer = s_security_.approved_peers[i];
+        if (peer.valid && !IsZeroMac(peer.mac)) {
+            tryAddEspNowPeer(peer.mac);
+            ++restored;
+            if (!fast_boot::IsWarm()) {
+                ESP_LOGI(TAG_, "Restored paired peer: %02X:%02X:%02X:%02X:%02X:%02X (%s)",
+                         peer.mac[0], peer.mac[1], peer.mac[2],
+                         peer.mac[3], peer.mac[4], peer.mac[5], peer.name);
+            }
+        }
+    }
+    if (fast_boot::IsWarm() && restored > 0) {
+        ESP_LOGI(TAG_, "Restored %u paired peers", static_cast<unsigned>(restored));
+    }
+
+    // Discovery broadcast rides the periodic scheduler; the immediate first
+    // token keeps the old "broadcast on bring-up" behavior.
+    (void)RegisterPeriodicJob("discovery", DISCOVERY_PERIOD_MS_, DISCOVERY_JITTER_MS_, 1,
+                              discoveryJob, nullptr);
+
+    xTaskCreate(recvTask, "espnow_recv", 4096, nullptr, 5, nullptr);
+
+    // TX scheduler: stage frames for the sender task so airtime is paced by
+    // send-callback completion. On any creation failure the direct-send
+    // path in sendPacketRaw keeps working unpaced.
+    s_tx_mutex_ = xSemaphoreCreateMutex();
+    s_tx_pending_ = xSemaphoreCreateCounting(TX_POOL_SIZE_, 0);
+    s_tx_done_ = xSemaphoreCreateBinary();
+    if (s_tx_mutex_ != nullptr && s_tx_pending_ != nullptr && s_tx_done_ != nullptr) {
+        if (xTaskCreate(txTask, "espnow_tx", 3072, nullptr, 5, &s_tx_task_) != pdPASS) {
+            s_tx_task_ = nullptr;
+        }
+    }
+    if (s_tx_task_ == nullptr) {
+        ESP_LOGW(TAG_, "TX scheduler unavailable; sending direct");
+    }
+
+    // Debug builds: log the HMAC path timings once, before the pairing
+    // worker exists (the persistent contexts are keyed here, single-task).
+#if !defined(NDEBUG)
+    BenchmarkPairingHmac();
+#endif
+
+    // Pairing crypto runs on its own lower-priority worker so HMAC
+    // operations never stall telemetry processing on the receive task. If
+    // the worker cannot be created, pairing falls back to inline handling.
+    s_pairing_work_queue_ = xQueueCreate(PAIRING_WORK_DEPTH_, sizeof(RawMsg*));
+    if (s_pairing_work_queue_ != nullptr &&
+        xTaskCreate(pairingWorkTask, "espnow_pair", 4096, nullptr, 3, nullptr) != pdPASS) {
+        vQueueDelete(s_pairing_work_queue_);
+        s_pairing_work_queue_ = nullptr;
+    }
+    if (s_pairing_work_queue_ == nullptr) {
+        ESP_LOGW(TAG_, "Pairing worker unavailable; crypto stays on recv task");
+    } else {
+        s_qs_pairing_ = queue_stats::Register(s_pairing_work_queue_, "pair", PAIRING_WORK_DEPTH_);
+    }
+
+    ESP_LOGI(TAG_, "ESP-NOW initialized (protocol v%u)", PROTOCOL_VERSION_);
+    ESP_LOGI(TAG_, "Approved peers: %zu", PeerStore::GetPeerCount(s_security_));
+
+    // Radio operational on a plausible channel: arm the warm-boot token so
+    // the next warm reset takes the fast path.
+    fast_boot::NoteChannel(s_channel_);
+    return true;
+}
+
+/**
+ * @brief Background radio bring-up task for InitAsync
+ * @param arg Protocol event queue handle
+ */
+static void initTask(void* arg)
+{
+    QueueHandle_t queue = static_cast<QueueHandle_t>(arg);
+    const bool ok = espnow::Init(queue);
+    if (queue != nullptr) {
+        espnow::ProtoEvent evt{};
+        evt.type = espnow::MsgType::RadioReady;
+        evt.sequence_id = ok ? 1 : 0;
+        xQueueSend(queue, &evt, 0);
+    }
+    vTaskDelete(nullptr);
+}
+
+bool espnow::InitAsync(QueueHandle_t event_queue) noexcept
+{
+    if (xTaskCreate(initTask, "espnow_init", 4096, event_queue, 4, nullptr) != pdPASS) {
+        ESP_LOGE(TAG_, "Failed to start radio init task; initializing inline");
+        return Init(event_queue);
+    }
+    return true;
+}
+
+bool espnow::SendDeviceDiscovery() noexcept
+{
+    return sendPacketTo(BROADCAST_MAC, 0, MsgType::DeviceDiscovery, nullptr, 0);
+}
+
+bool espnow::SendConfigRequest(uint8_t device_id) noexcept
+{
+    // The single payload byte advertises the highest protocol version we can
+    // decode; units that understand it switch StatusUpdate to the v2 delta
+    // format, older units ignore the payload and keep sending the fixed
+    // layout. The periodic poll refreshes the capability every second.
+    const uint8_t caps = PROTOCOL_VERSION_V2_;
+    return sendPacketToTarget(device_id, MsgType::ConfigRequest, &caps, sizeof(caps));
+}
+
+bool espnow::SendConfigSet(uint8_t device_id, const void* config_data, size_t config_len) noexcept
+{
+    if (!leaseAllowsWrite()) {
+        return false;
+    }
+    if (config_len > MAX_PAYLOAD_SIZE_) {
+        ESP_LOGE(TAG_, "Config data too large: %zu", config_len);
+        return false;
+    }
+    return sendPacketToTarget(device_id, MsgType::ConfigSet, config_data, static_cast<uint8_t>(config_len));
+}
+
+bool espnow::SendCommand(uint8_t device_id, uint8_t command_id, const void* payload, size_t payload_len) noexcept
+{
+    if (!leaseAllowsWrite()) {
+        return false;
+    }
+    uint8_t cmd_buf[espnow::MAX_PAYLOAD_SIZE_];
+    cmd_buf[0] = command_id;
+
+    size_t total_payload = 1;
+    if (payload != nullptr && payload_len > 0) {
+        if (1 + payload_len > MAX_PAYLOAD_SIZE_) {
+            ESP_LOGE(TAG_, "Command payload too large: %zu", payload_len);
+            return false;
+        }
+        std::memcpy(cmd_buf + 1, payload, payload_len);
+        total_payload = 1 + payload_len;
+    }
+
+    return sendPacketToTarget(device_id, MsgType::Command, cmd_buf, static_cast<uint8_t>(total_payload));
+}
+
+bool espnow::SendConfigRequestTo(const uint8_t mac[6], uint8_t device_id) noexcept
+{
+    const uint8_t caps = PROTOCOL_VERSION_V2_;  // See SendConfigRequest()
+    return sendPacketToMac(mac, device_id, MsgType::ConfigRequest, &caps, sizeof(caps));
+}
+
+bool espnow::SendConfigSetTo(const uint8_t mac[6], uint8_t device_id,
+                             const void* config_data, size_t config_len) noexcept
+{
+    if (!leaseAllowsWrite()) {
+        return false;
+    }
+    if (config_len > MAX_PAYLOAD_SIZE_) {
+        ESP_LOGE(TAG_, "Config data too large: %zu", config_len);
+        return false;
+    }
+    return sendPacketToMac(mac, device_id, MsgType::ConfigSet, config_data,
+                           static_cast<uint8_t>(config_len));
+}
+
+bool espnow::SendConfigDeltaTo(const uint8_t mac[6], uint8_t device_id,
+                               const void* delta_data, size_t delta_len) noexcept
+{
+    if (!leaseAllowsWrite()) {
+        return false;
+    }
+    if (delta_len > MAX_PAYLOAD_SIZE_) {
+        ESP_LOGE(TAG_, "Config delta too large: %zu", delta_len);
+        return false;
+    }
+    return sendPacketToMac(mac, device_id, MsgType::ConfigDelta, delta_data,
+                           static_cast<uint8_t>(delta_len));
+}
+
+bool espnow::SendConfigDelta(uint8_t device_id, const void* delta_data, size_t delta_len) noexcept
+{
+    if (!leaseAllowsWrite()) {
+        return false;
+    }
+    if (delta_len > MAX_PAYLOAD_SIZE_) {
+        ESP_LOGE(TAG_, "Config delta too large: %zu", delta_len);
+        return false;
+    }
+    return sendPacketToTarget(device_id, MsgType::ConfigDelta, delta_data,
+                              static_cast<uint8_t>(delta_len));
+}
+
+bool espnow::SendCommandTo(const uint8_t mac[6], uint8_t device_id, uint8_t command_id,
+                           const void* payload, size_t payload_len) noexcept
+{
+    if (!leaseAllowsWrite()) {
+        return false;
+    }
+    uint8_t cmd_buf[espnow::MAX_PAYLOAD_SIZE_];
+    cmd_buf[0] = command_id;
+
+    size_t total_payload = 1;
+    if (payload != nullptr && payload_len > 0) {
+        if (1 + payload_len > MAX_PAYLOAD_SIZE_) {
+            ESP_LOGE(TAG_, "Command payload too large: %zu", payload_len);
+            return false;
+        }
+        std::memcpy(cmd_buf + 1, payload, payload_len);
+        total_payload = 1 + payload_len;
+    }
+
+    return sendPacketToMac(mac, device_id, MsgType::Command, cmd_buf,
+                           static_cast<uint8_t>(total_payload));
+}
+
+bool espnow::SendCriticalCommandTo(const uint8_t mac[6], uint8_t device_id,
+                                   uint8_t command_id) noexcept
+{
+    if (!leaseAllowsWrite()) {
+        return false;
+    }
+    const uint8_t msg_id = s_next_msg_id_++;
+    const uint8_t cmd_buf[1] = { command_id };
+    const bool sent = sendPacketRaw(mac, device_id, MsgType::Command, msg_id,
+                                    cmd_buf, sizeof(cmd_buf));
+    if (sent) {
+        // First attempt rides the normal tracked path for fast exponential
+        // retries; the journal below is the long tail behind it.
+        trackInflight(mac, device_id, MsgType::Command, msg_id, cmd_buf, sizeof(cmd_buf));
+        blackbox::Note(blackbox::Kind::TxCmd, static_cast<uint8_t>(MsgType::Command), command_id);
+    }
+
+    if (s_inflight_mutex_ != nullptr) {
+        xSemaphoreTake(s_inflight_mutex_, portMAX_DELAY);
+        CommandJournalEntry* slot = nullptr;
+        for (auto& e : s_cmd_journal_) {
+            // Supersede: one pending critical command per peer.
+            if (e.valid && std::memcmp(e.dst_mac, mac, 6) == 0) {
+                slot = &e;
+                break;
+            }
+        }
+        if (slot == nullptr) {
+            for (auto& e : s_cmd_journal_) {
+                if (!e.valid) {
+                    slot = &e;
+                    break;
+                }
+            }
+        }
+        if (slot == nullptr) {
+            for (auto& e : s_cmd_journal_) {
+                if (slot == nullptr || e.journal_seq < slot->journal_seq) {
+                    slot = &e;
+                }
+            }
+        }
+        slot->valid = true;
+        std::memcpy(slot->dst_mac, mac, 6);
+        slot->device_id = device_id;
+        slot->command_id = command_id;
+        slot->last_msg_id = msg_id;
+        slot->journal_seq = ++s_cmd_journal_seq_;
+        // Even a failed immediate send is journaled; the replay service
+        // carries it once the radio comes back.
+        slot->next_replay_tick = xTaskGetTickCount() + pdMS_TO_TICKS(CMD_JOURNAL_REPLAY_MS_);
+        xSemaphoreGive(s_inflight_mutex_);
+    }
+    return sent;
+}
+
+bool espnow::CriticalCommandPending(const uint8_t mac[6], uint8_t* command_id_out) noexcept
+{
+    if (s_inflight_mutex_ == nullptr) {
+        return false;
+    }
+    bool pending = false;
+    xSemaphoreTake(s_inflight_mutex_, portMAX_DELAY);
+    for (const auto& e : s_cmd_journal_) {
+        if (e.valid && std::memcmp(e.dst_mac, mac, 6) == 0) {
+            if (command_id_out != nullptr) {
+                *command_id_out = e.command_id;
+            }
+            pending = true;
+            break;
+        }
+    }
+    xSemaphoreGive(s_inflight_mutex_);
+    return pending;
+}
+
+// ============================================================================
+// PAIRING
+// ============================================================================
+
+bool espnow::StartPairing() noexcept
+{
+    if (s_pairing_state_ != PairingState::Idle) {
+        ESP_LOGW(TAG_, "Pairing already in progress");
+        return false;
+    }
+
+    GenerateChallenge(s_my_challenge_);
+
+    PairingRequestPayload req{};
+    esp_wifi_get_mac(WIFI_IF_STA, req.requester_mac);
+    req.device_type = static_cast<uint8_t>(DeviceType::RemoteController);
+    req.expected_peer_type = static_cast<uint8_t>(DeviceType::FatigueTester);
+    std::memcpy(req.challenge, s_my_challenge_, CHALLENGE_SIZE);
+    req.protocol_version = PROTOCOL_VERSION_;
+
+    if (!sendPacketTo(BROADCAST_MAC, 0, MsgType::PairingRequest, &req, sizeof(req))) {
+        ESP_LOGE(TAG_, "Failed to send pairing request");
+        return false;
+    }
+
+    s_pairing_state_ = PairingState::WaitingForResponse;
+    s_pairing_timeout_tick_ = xTaskGetTickCount() + pdMS_TO_TICKS(PAIRING_RESPONSE_TIMEOUT_MS);
+    return true;
+}
+
+void espnow::CancelPairing() noexcept
+{
+    if (s_pairing_state_ != PairingState::Idle) {
+        s_pairing_state_ = PairingState::Idle;
+    }
+}
+
+espnow::PairingState espnow::GetPairingState() noexcept
+{
+    if (s_pairing_state_ == PairingState::WaitingForResponse) {
+        if (xTaskGetTickCount() > s_pairing_timeout_tick_) {
+            ESP_LOGW(TAG_, "Pairing timed out");
+            s_pairing_state_ = PairingState::Failed;
+        }
+    }
+    return s_pairing_state_;
+}
+
+SecuritySettings& espnow::GetSecuritySettings() noexcept
+{
+    return s_security_;
+}
+
+bool espnow::IsPeerApproved(const uint8_t mac[6]) noexcept
+{
+    return PeerStore::IsPeerApproved(s_security_, mac);
+}
+
+bool espnow::AddApprovedPeer(const uint8_t mac[6], DeviceType type, const char* name) noexcept
+{
+    const bool result = PeerStore::AddPeer(s_security_, mac, type, name);
+    if (result) {
+        tryAddEspNowPeer(mac);
+    }
+    return result;
+}
+
+bool espnow::RemoveApprovedPeer(const uint8_t mac[6]) noexcept
+{
+    return PeerStore::RemovePeer(s_security_, mac);
+}
+
+size_t espnow::GetApprovedPeerCount() noexcept
+{
+    return PeerStore::GetPeerCount(s_security_);
+}
+
+bool espnow::GetTargetDeviceMac(uint8_t mac_out[6]) noexcept
+{
+    return PeerStore::GetFirstPeerOfType(s_security_, DeviceType::FatigueTester, mac_out);
+}
+
+size_t espnow::GetFatigueTesterMacs(uint8_t (*macs_out)[6], size_t max_out) noexcept
+{
+    return PeerStore::GetPeersOfType(s_security_, DeviceType::FatigueTester, macs_out, max_out);
+}
+
+void espnow::GetLinkStats(LinkStats& out) noexcept
+{
+    if (s_inflight_mutex_ != nullptr) {
+        xSemaphoreTake(s_inflight_mutex_, portMAX_DELAY);
+    }
+    out = s_link_stats_;
+    if (s_inflight_mutex_ != nullptr) {
+        xSemaphoreGive(s_inflight_mutex_);
+    }
+}
+
+void espnow::ResetLinkStats() noexcept
+{
+    if (s_inflight_mutex_ != nullptr) {
+        xSemaphoreTake(s_inflight_mutex_, portMAX_DELAY);
+    }
+    s_link_stats_ = {};
+    if (s_inflight_mutex_ != nullptr) {
+        xSemaphoreGive(s_inflight_mutex_);
+    }
+}
+
+uint8_t espnow::GetCurrentChannel() noexcept
+{
+    return s_channel_;
+}
+
+bool espnow::GetPeerLinkQuality(const uint8_t mac[6], espnow::PeerLinkQuality& out) noexcept
+{
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        if (s_peer_qual_[i].valid && std::memcmp(s_peer_qual_[i].mac, mac, 6) == 0) {
+            out.rssi_dbm = static_cast<int8_t>(s_peer_qual_[i].rssi_ewma);
+            out.loss_pct = s_peer_qual_[i].loss_pct;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool espnow::GetPeerLongRange(const uint8_t mac[6]) noexcept
+{
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        if (s_peer_phy_[i].in_use && std::memcmp(s_peer_phy_[i].mac, mac, 6) == 0) {
+            return s_peer_phy_[i].profile == PhyProfile::LongRange;
+        }
+    }
+    return false;
+}
+
+bool espnow::GetPeerRttMs(const uint8_t mac[6], uint32_t& rtt_ms_out) noexcept
+{
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        if (s_peer_rtt_[i].valid && std::memcmp(s_peer_rtt_[i].mac, mac, 6) == 0) {
+            rtt_ms_out = s_peer_rtt_[i].srtt_ms;
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t espnow::GetPresence(espnow::PresenceEntry* out, size_t max_out) noexcept
+{
+    const TickType_t now = xTaskGetTickCount();
+    size_t n = 0;
+    for (size_t i = 0; i < MAX_APPROVED_PEERS && n < max_out; ++i) {
+        const PeerPresence& e = s_presence_[i];
+        if (!e.valid) {
+            continue;
+        }
+        std::memcpy(out[n].mac, e.mac, 6);
+        out[n].device_id = e.device_id;
+        std::memcpy(out[n].name, e.name, sizeof(out[n].name));
+        out[n].age_ms = pdTICKS_TO_MS(now - e.last_seen_tick);
+        ++n;
+    }
+    return n;
+}
+
+uint8_t espnow::LookupPeerIndex(const uint8_t mac[6]) noexcept
+{
+    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
+        if (s_presence_[i].valid && std::memcmp(s_presence_[i].mac, mac, 6) == 0) {
+            return static_cast<uint8_t>(i);
+        }
+    }
+    return espnow::PEER_INDEX_NONE;
+}
+
+bool espnow::GetPeerByIndex(uint8_t index, espnow::PresenceEntry& out) noexcept
+{
+    if (index >= MAX_APPROVED_PEERS || !s_presence_[index].valid) {
+        return false;
+    }
+    const PeerPresence& e = s_presence_[index];
+    std::memcpy(out.mac, e.mac, 6);
+    out.device_id = e.device_id;
+    std::memcpy(out.name, e.name, sizeof(out.name));
+    out.age_ms = pdTICKS_TO_MS(xTaskGetTickCount() - e.last_seen_tick);
+    return true;
+}
+
+const char* espnow::PeerLabel(uint8_t index) noexcept
+{
+    if (index >= MAX_APPROVED_PEERS || !s_presence_[index].valid) {
+        return "";
+    }
+    return s_presence_[index].label;
+}
+
+static bool handlePairingResponse(RawMsg& msg, const espnow::EspNowHeader& hdr, const uint8_t* payload)
+{
+    if (s_pairing_state_ != espnow::PairingState::WaitingForResponse) {
+        return false;
+    }
+
+    if (hdr.len < sizeof(PairingResponsePayload)) {
+        s_pairing_state_ = espnow::PairingState::Failed;
+        return false;
+    }
+
+    PairingResponsePayload resp;
+    std::memcpy(&resp, payload, sizeof(resp));
+
+    if (resp.device_type != static_cast<uint8_t>(DeviceType::FatigueTester)) {
+        return false;
+    }
+
+    if (!VerifyPairingHmac(s_my_challenge_, CHALLENGE_SIZE, resp.hmac_response)) {
+        ESP_LOGE(TAG_, "HMAC verification FAILED - unauthorized device!");
+        s_pairing_state_ = espnow::PairingState::Failed;
+        return false;
+    }
+
+    // Add as ESP-NOW peer for sending confirm
+    tryAddEspNowPeer(resp.responder_mac);
+
+    uint8_t my_hmac[HMAC_SIZE];
+    ComputePairingHmac(resp.challenge, CHALLENGE_SIZE, my_hmac);
+
+    PairingConfirmPayload confirm{};
+    esp_wifi_get_mac(WIFI_IF_STA, confirm.confirmer_mac);
+    std::memcpy(confirm.hmac_response, my_hmac, HMAC_SIZE);
+    confirm.success = 1;
+
+    if (!sendPacketTo(resp.responder_mac, 0, espnow::MsgType::PairingConfirm, &confirm, sizeof(confirm))) {
+        s_pairing_state_ = espnow::PairingState::Failed;
+        return false;
+    }
+
+    const bool added = PeerStore::AddPeer(s_security_, resp.responder_mac,
+                                         DeviceType::FatigueTester, resp.device_name);
+    if (!added) {
+        s_pairing_state_ = espnow::PairingState::Failed;
+        return false;
+    }
+
+    s_pairing_state_ = espnow::PairingState::Complete;
+
+    // Notify application layer (optional). The device name is viewed in
+    // place inside the pooled buffer, so ownership moves with the event.
+    if (s_proto_event_queue_) {
+        espnow::ProtoEvent evt{};
+        evt.type = espnow::MsgType::PairingResponse;
+        evt.device_id = resp.device_type;
+        std::memcpy(evt.src_mac, resp.responder_mac, 6);
+        evt.payload = payload + offsetof(PairingResponsePayload, device_name);
+        evt.payload_len = sizeof(resp.device_name);
+        evt.buffer = &msg;
+        if (queueProtoEvent(evt)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void handlePairingReject(const uint8_t* src_mac, const espnow::EspNowHeader& hdr)
+{
+    (void)src_mac;
+    if (s_pairing_state_ != espnow::PairingState::WaitingForResponse) {
+        return;
+    }
+    if (hdr.len < sizeof(PairingRejectPayload)) {
+        return;
+    }
+    // Intentionally don't fail immediately; other devices may respond.
+}
+
+static void espnowSendCb(const wifi_tx_info_t* info, esp_now_send_status_t status)
+{
+    // Per-channel delivery tally for the channel-agility window. Runs in the
+    // WiFi task; word-sized increments, read-and-reset on the receive task.
+    if (status == ESP_NOW_SEND_SUCCESS) {
+        s_ch_send_ok_ = s_ch_send_ok_ + 1;
+    } else {
+        s_ch_send_fail_ = s_ch_send_fail_ + 1;
+    }
+    // Per-peer outcome for the reliability engine (broadcast frames have no
+    // single peer to attribute to, so they stay out of the streaks).
+    if (info != nullptr && std::memcmp(info->des_addr, BROADCAST_MAC, 6) != 0) {
+        txStatusNote(info->des_addr, status == ESP_NOW_SEND_SUCCESS);
+    }
+    // Completion gate for the TX scheduler: the sender task holds the next
+    // frame until this fires (success or failure, the airtime is spent
+    // either way). Runs in the WiFi task, so a plain give is fine.
+    if (s_tx_done_ != nullptr) {
+        (void)xSemaphoreGive(s_tx_done_);
+    }
+    ESP_LOGD(TAG_, "ESP-NOW send status=%s", status == ESP_NOW_SEND_SUCCESS ? "OK" : "FAIL");
+}
+
+static void espnowRecvCb(const esp_now_recv_info_t* info, const uint8_t* data, int len)
+{
+    if (len < 8 || len > static_cast<int>(sizeof(espnow::EspNowPacket))) {
+        ESP_LOGW(TAG_, "RX callback: invalid length %d", len);
+        return;
+    }
+
+    // Grab a free pooled buffer; if the pool is exhausted the consumer is
+    // already behind, so dropping the frame here is the cheapest response.
+    RawMsg* buf = nullptr;
+    BaseType_t hpw = pdFALSE;
+    if (xQueueReceiveFromISR(s_rx_free_queue_, &buf, &hpw) != pdTRUE) {
+        return;
+    }
+
+    buf->len = len;
+    buf->refs.store(1, std::memory_order_relaxed);
+    // Fold the CRC into the copy we have to make anyway: the payload
+    // length sits at a fixed header offset, so the checksummed prefix is
+    // known before parsing. Frames whose claimed length overruns what was
+    // received are copied as-is and rejected by handlePacket's length
+    // check before the CRC matters.
+    const size_t crc_data_len =
+        sizeof(espnow::EspNowHeader) + data[offsetof(espnow::EspNowHeader, len)];
+    if (crc_data_len + sizeof(uint16_t) <= static_cast<size_t>(len)) {
+        espnow::Crc16Stream crc_stream;
+        crc_stream.updateCopy(buf->data, data, crc_data_len);
+        std::memcpy(buf->data + crc_data_len, data + crc_data_len, len - crc_data_len);
+        buf->crc_calc = crc_stream.finish();
+        buf->crc_known = true;
+    } else {
+        std::memcpy(buf->data, data, len);
+        buf->crc_known = false;
+    }
+    std::memcpy(buf->src_mac, info->src_addr, 6);
+    buf->rssi = (info->rx_ctrl != nullptr) ? static_cast<int8_t>(info->rx_ctrl->rssi) : 0;
+
+    if (xQueueSendFromISR(s_raw_recv_queue_, &buf, &hpw) != pdTRUE) {
+        // Frame dropped whole; previously invisible, now counted.
+        queue_stats::NoteDrop(s_qs_rawrx_);
+        xQueueSendFromISR(s_rx_free_queue_, &buf, &hpw);
+    }
+    if (hpw == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+bool espnow::InjectRawFrame(const uint8_t src_mac[6], const uint8_t* data, size_t len) noexcept
+{
+    // Test/fuzz entry: mirrors espnowRecvCb byte for byte (same pooled
+    // buffer, same fold-into-copy CRC) but runs in task context, so a
+    // harness can hammer the receive path without a radio. Frames land on
+    // the same queue the callback uses and hit every validation stage in
+    // handlePacket; nothing downstream can tell them apart.
+    if (src_mac == nullptr || data == nullptr || len < 8 ||
+        len > sizeof(espnow::EspNowPacket) ||
+        s_rx_free_queue_ == nullptr || s_raw_recv_queue_ == nullptr) {
+        return false;
+    }
+
+    RawMsg* buf = nullptr;
+    if (xQueueReceive(s_rx_free_queue_, &buf, 0) != pdTRUE) {
+        return false;
+    }
+
+    buf->len = static_cast<int>(len);
+    buf->refs.store(1, std::memory_order_relaxed);
+    const size_t crc_data_len =
+        sizeof(espnow::EspNowHeader) + data[offsetof(espnow::EspNowHeader, len)];
+    if (crc_data_len + sizeof(uint16_t) <= len) {
+        espnow::Crc16Stream crc_stream;
+        crc_stream.updateCopy(buf->data, data, crc_data_len);
+        std::memcpy(buf->data + crc_data_len, data + crc_data_len, len - crc_data_len);
+        buf->crc_calc = crc_stream.finish();
+        buf->crc_known = true;
+    } else {
+        std::memcpy(buf->data, data, len);
+        buf->crc_known = false;
+    }
+    std::memcpy(buf->src_mac, src_mac, 6);
+    buf->rssi = 0;
+
+    if (xQueueSend(s_raw_recv_queue_, &buf, 0) != pdTRUE) {
+        queue_stats::NoteDrop(s_qs_rawrx_);
+        (void)xQueueSend(s_rx_free_queue_, &buf, 0);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Validate and dispatch a received packet (parsed in place)
+ * @param msg Pooled receive buffer holding the raw frame
+ * @return true if buffer ownership was transferred to the application
+ *         event queue (released later via ReleaseEvent), false if the
+ *         caller should return the buffer to the pool
+ */
+// ---------------------------------------------------------------------------
+// Ingress rate / overload protection
+// ---------------------------------------------------------------------------
+// Per-type packet counters over a 1 s window, bumped for every frame that
+// passes validation in handlePacket. When the total rate crosses
+// STORM_ON_PPS_ the storm latch engages and queueProtoEvent starts
+// coalescing same-peer StatusUpdates to the newest sample; the latch
+// releases below STORM_OFF_PPS_ so the indicator cannot flicker at the
+// threshold. All writes happen on the receive task; the UI reads the
+// published last-window counts and the latched flag, both word-sized or
+// smaller, without a lock.
+
+static constexpr uint32_t RATE_WINDOW_MS_ = 1000;
+static constexpr uint32_t STORM_ON_PPS_ = 80;   // latch threshold, pkt/s
+static constexpr uint32_t STORM_OFF_PPS_ = 40;  // release threshold, pkt/s
+static constexpr size_t RATE_TYPE_SLOTS_ = 34;  // covers the wire MsgType range
+static uint16_t s_rate_count_[RATE_TYPE_SLOTS_]{};          // accumulating window
+static volatile uint16_t s_rate_last_[RATE_TYPE_SLOTS_]{};  // last completed window
+static uint32_t s_rate_window_start_ms_ = 0;
+static volatile bool s_storm_active_ = false;
+
+/**
+ * @brief Roll the rate window and re-evaluate the storm latch
+ * @details Also driven from the receive task's idle loop, so the latch
+ *          releases even when the storm ends in total silence.
+ */
+static void serviceIngressRate()
+{
+    const uint32_t now_ms = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+    if (s_rate_window_start_ms_ == 0) {
+        s_rate_window_start_ms_ = now_ms;
+        return;
+    }
+    if ((now_ms - s_rate_window_start_ms_) < RATE_WINDOW_MS_) {
+        return;
+    }
+    s_rate_window_start_ms_ = now_ms;
+
+    uint32_t total = 0;
+    for (size_t i = 0; i < RATE_TYPE_SLOTS_; ++i) {
+        total += s_rate_count_[i];
+        s_rate_last_[i] = s_rate_count_[i];
+        s_rate_count_[i] = 0;
+    }
+    if (!s_storm_active_ && total >= STORM_ON_PPS_) {
+        s_storm_active_ = true;
+        ESP_LOGW(TAG_, "Ingress storm: %u pkt/s, shedding telemetry", (unsigned)total);
+    } else if (s_storm_active_ && total <= STORM_OFF_PPS_) {
+        s_storm_active_ = false;
+        ESP_LOGI(TAG_, "Ingress storm cleared (%u pkt/s)", (unsigned)total);
+    }
+}
+
+/**
+ * @brief Count one validated ingress frame
+ * @param type Wire message type (raw header byte)
+ */
+static void rateNoteRx(uint8_t type)
+{
+    serviceIngressRate();
+    if (type < RATE_TYPE_SLOTS_) {
+        ++s_rate_count_[type];
+    }
+}
+
+bool espnow::StormActive() noexcept
+{
+    return s_storm_active_;
+}
+
+uint32_t espnow::GetIngressRate(espnow::MsgType type) noexcept
+{
+    const auto idx = static_cast<size_t>(type);
+    return (idx < RATE_TYPE_SLOTS_) ? s_rate_last_[idx] : 0;
+}
+
+// Per-stage rejection tallies for handlePacket. Same publication story as
+// the rate window: word-sized counters written on the receive task (plus
+// NoteBadPayload from consumers), read lock-free as a best-effort snapshot.
+static espnow::RxRejectStats s_rx_rejects_{};
+
+void espnow::GetRxRejectStats(RxRejectStats& out) noexcept
+{
+    out = s_rx_rejects_;
+}
+
+void espnow::NoteBadPayload() noexcept
+{
+    ++s_rx_rejects_.bad_payload;
+}
+
+/**
+ * @brief True for telemetry events that may be dropped under pressure
+ * @details Status traffic is idempotent (the newest sample supersedes any
+ *          queued older one), so it is the only class the queue policy is
+ *          allowed to discard.
+ */
+static bool isTelemetryEvent(espnow::MsgType type)
+{
+    return specForType_(static_cast<uint8_t>(type)).qos == MsgQos::Telemetry;
+}
+
+/**
+ * @brief True for events that must never be starved by telemetry
+ */
+static bool isPriorityEvent(espnow::MsgType type)
+{
+    return specForType_(static_cast<uint8_t>(type)).qos == MsgQos::Priority;
+}
+
+/**
+ * @brief Class-aware enqueue onto the application event queue
+ * @details Policy when the queue is full:
+ *          - the oldest queued telemetry event is evicted first, so a burst
+ *            of StatusUpdates can never push out a CommandAck (and a newer
+ *            status supersedes the oldest queued one);
+ *          - if nothing is evictable, priority events (acks, errors, bounds
+ *            results) still land by dropping the oldest event outright;
+ *          - other events are simply rejected.
+ *          Eviction rotates the queue once, which preserves the relative
+ *          order of the surviving events. Runs in the receive task (single
+ *          producer); the consumer only ever dequeues.
+ * @param evt Event to enqueue (buffer ownership transfers on success)
+ * @return true if the event was queued, false otherwise
+ */
+static bool queueProtoEvent(espnow::ProtoEvent& evt)
+{
+    if (s_proto_event_queue_ == nullptr) {
+        return false;
+    }
+
+    // Fan-out to subscriber taps first: each delivery is the same slim
+    // descriptor with its own reference on the pooled buffer, so the
+    // primary path below stays free to shed or drop its copy without
+    // affecting observers. A full tap just misses the event - taps must
+    // never add backpressure to the path that keeps STOP live.
+    for (size_t i = 0; i < s_event_sub_count_; ++i) {
+        espnow::ProtoEvent copy = evt;
+        if (copy.buffer != nullptr) {
+            retainRxBuffer(static_cast<RawMsg*>(copy.buffer));
+        }
+        if (xQueueSend(s_event_subs_[i], &copy, 0) != pdTRUE) {
+            espnow::ReleaseEvent(copy);
+        }
+    }
+
+    // Storm shedding: while the ingress latch is set, an incoming
+    // StatusUpdate supersedes every queued one from the same sender before
+    // it can contribute to queue pressure. Status is idempotent, so the
+    // consumer only ever loses samples it would have skipped anyway.
+    if (s_storm_active_ && evt.type == espnow::MsgType::StatusUpdate) {
+        espnow::ProtoEvent queued{};
+        const UBaseType_t waiting = uxQueueMessagesWaiting(s_proto_event_queue_);
+        for (UBaseType_t i = 0; i < waiting; ++i) {
+            if (xQueueReceive(s_proto_event_queue_, &queued, 0) != pdTRUE) {
+                break;
+            }
+            if (queued.type == espnow::MsgType::StatusUpdate &&
+                std::memcmp(queued.src_mac, evt.src_mac, 6) == 0) {
+                espnow::ReleaseEvent(queued);
+                if (s_inflight_mutex_ != nullptr) {
+                    xSemaphoreTake(s_inflight_mutex_, portMAX_DELAY);
+                }
+                ++s_link_stats_.rx_shed;
+                if (s_inflight_mutex_ != nullptr) {
+                    xSemaphoreGive(s_inflight_mutex_);
+                }
+            } else {
+                (void)xQueueSend(s_proto_event_queue_, &queued, 0);
+            }
+        }
+    }
+
+    if (xQueueSend(s_proto_event_queue_, &evt, 0) == pdTRUE) {
+        return true;
+    }
+
+    espnow::ProtoEvent victim{};
+    bool freed = false;
+    const UBaseType_t waiting = uxQueueMessagesWaiting(s_proto_event_queue_);
+    for (UBaseType_t i = 0; i < waiting; ++i) {
+        if (xQueueReceive(s_proto_event_queue_, &victim, 0) != pdTRUE) {
+            break;
+        }
+        if (!freed && isTelemetryEvent(victim.type)) {
+            espnow::ReleaseEvent(victim);
+            freed = true;
+        } else {
+            (void)xQueueSend(s_proto_event_queue_, &victim, 0);
+        }
+    }
+    if (!freed) {
+        if (!isPriorityEvent(evt.type)) {
+            queue_stats::NoteDrop(s_qs_proto_);
+            return false;
+        }
+        if (xQueueReceive(s_proto_event_queue_, &victim, 0) == pdTRUE) {
+            espnow::ReleaseEvent(victim);
+        }
+    }
+    if (xQueueSend(s_proto_event_queue_, &evt, 0) == pdTRUE) {
+        return true;
+    }
+    queue_stats::NoteDrop(s_qs_proto_);
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+// Receive sequence window
+// ---------------------------------------------------------------------------
+// hdr.id increments per sender, so a retransmitted frame carries the same id
+// as the attempt that (apparently) failed. Track the newest id seen per
+// (peer, type): an exact repeat is a duplicate and is dropped before it can
+// double-drive the ack matcher or the UI state machines; an id slightly
+// behind the newest is a delivery the air reordered and passes through,
+// counted. A large backwards jump means the sender rebooted and re-anchors
+// the window. Runs only on the receive task, so the table needs no lock.
+
+struct RxSeqEntry {
+    uint8_t mac[6];
+    uint8_t type;
+    bool valid;
+    uint8_t last_id;
+};
+static RxSeqEntry s_rx_seq_[24]{};
+static size_t s_rx_seq_evict_ = 0;
+static constexpr uint8_t RX_REORDER_WINDOW_ = 8;
+
+static bool rxSeqAccept(const uint8_t* mac, uint8_t type, uint8_t id)
+{
+    RxSeqEntry* e = nullptr;
+    for (auto& slot : s_rx_seq_) {
+        if (slot.valid && slot.type == type && std::memcmp(slot.mac, mac, 6) == 0) {
+            e = &slot;
+            break;
+        }
+    }
+    if (e == nullptr) {
+        for (auto& slot : s_rx_seq_) {
+            if (!slot.valid) {
+                e = &slot;
+                break;
+            }
+        }
+        if (e == nullptr) {
+            // Table full (many peers x types): recycle round-robin. Losing a
+            // window only costs one missed duplicate, never a dropped packet.
+            e = &s_rx_seq_[s_rx_seq_evict_++ % (sizeof(s_rx_seq_) / sizeof(s_rx_seq_[0]))];
+        }
+        std::memcpy(e->mac, mac, 6);
+        e->type = type;
+        e->valid = true;
+        e->last_id = id;
+        return true;
+    }
+
+    const uint8_t ahead = static_cast<uint8_t>(id - e->last_id);
+    if (ahead == 0) {
+        if (s_inflight_mutex_ != nullptr) {
+            xSemaphoreTake(s_inflight_mutex_, portMAX_DELAY);
+        }
+        ++s_link_stats_.rx_duplicates;
+        if (s_inflight_mutex_ != nullptr) {
+            xSemaphoreGive(s_inflight_mutex_);
+        }
+        return false;
+    }
+    if (ahead > static_cast<uint8_t>(256 - RX_REORDER_WINDOW_)) {
+        // Behind the newest but inside the window: reordered, deliver it and
+        // keep the newer id as the anchor.
+        if (s_inflight_mutex_ != nullptr) {
+            xSemaphoreTake(s_inflight_mutex_, portMAX_DELAY);
+        }
+        ++s_link_stats_.rx_reordered;
+        if (s_inflight_mutex_ != nullptr) {
+            xSemaphoreGive(s_inflight_mutex_);
+        }
+        return true;
+    }
+    e->last_id = id;
+    return true;
+}
+
+// ============================================================================
+// MULTI-REMOTE ARBITRATION (active-controller lease)
+// ============================================================================
+//
+// Two remotes paired to the same unit both used to send commands; the unit
+// obeyed whichever arrived last, including a START from a drawer-stowed
+// spare. The lease below makes exactly one remote the command source: the
+// first remote to send a command claims the lease and beacons a
+// ControllerLease broadcast every LEASE_PERIOD_MS_; a remote hearing
+// someone else's beacon goes Passive — it keeps consuming telemetry but
+// refuses command/config writes locally (see leaseAllowsWrite), so the
+// duplicate traffic and its retries never reach the air. Claims are
+// authenticated with the shared pairing secret, the same HMAC identity
+// pairing rests on, so an unpaired device cannot claim or clear the lease.
+// Simultaneous claims resolve by MAC compare (lower wins); an explicit
+// takeover (RequestControl) always wins; a lease idle for
+// LEASE_IDLE_RELEASE_MS_ is released so the day-shift spare needs no
+// manual handover. Replaying a captured beacon only re-asserts a holder
+// that already existed — worst case it extends passivity by one TTL — so
+// the beacon carries no replay counter. State is written on the receive
+// task and on whichever task sends commands; role and holder are
+// single-word/ordered writes and torn reads are benign diagnostics.
+
+static constexpr uint32_t LEASE_PERIOD_MS_ = 2000;        ///< Beacon interval while Active
+static constexpr uint32_t LEASE_TTL_MS_ = 7000;           ///< Holder silence before Passive -> Solo
+static constexpr uint32_t LEASE_IDLE_RELEASE_MS_ = 300000;  ///< Write-idle Active -> release
+static constexpr uint8_t LEASE_FLAG_TAKEOVER_ = 0x01;     ///< Deliberate operator takeover
+static constexpr uint8_t LEASE_FLAG_RELEASE_ = 0x02;      ///< Holder is giving the lease up
+
+#pragma pack(push, 1)
+struct ControllerLeasePayload {
+    uint8_t holder_mac[6];        ///< Claimant MAC
+    uint8_t flags;                ///< LEASE_FLAG_*
+    uint32_t seq;                 ///< Per-boot beacon counter (diagnostics)
+    uint8_t hmac[HMAC_SIZE];      ///< Over all preceding fields, pairing secret
+};
+#pragma pack(pop)
+
+static espnow::ControllerRole s_ctrl_role_ = espnow::ControllerRole::Solo;
+static uint8_t s_ctrl_holder_[6] = {};           ///< Valid while Passive
+static TickType_t s_ctrl_holder_tick_ = 0;       ///< Last beacon from the holder
+static TickType_t s_ctrl_beacon_tick_ = 0;       ///< Our last beacon
+static TickType_t s_ctrl_write_tick_ = 0;        ///< Last gated write we let through
+static uint32_t s_ctrl_seq_ = 0;
+
+/**
+ * @brief HMAC over the lease fields with the shared pairing secret
+ * @details Uses a local md-layer context rather than the persistent keyed
+ *          contexts in espnow_security.hpp: those are single-caller
+ *          (pairing worker), while lease signing runs on whichever task
+ *          sends commands and verification runs on the receive task. One
+ *          key schedule per beacon at this rate is noise.
+ */
+static void leaseHmac(const ControllerLeasePayload& p, uint8_t out[HMAC_SIZE])
+{
+    uint8_t full[32];
+    mbedtls_md_context_t ctx;
+    mbedtls_md_init(&ctx);
+    mbedtls_md_setup(&ctx, mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), 1);
+    mbedtls_md_hmac_starts(&ctx, PAIRING_SECRET, sizeof(PAIRING_SECRET));
+    mbedtls_md_hmac_update(&ctx, reinterpret_cast<const uint8_t*>(&p),
+                           offsetof(ControllerLeasePayload, hmac));
+    mbedtls_md_hmac_finish(&ctx, full);
+    mbedtls_md_free(&ctx);
+    std::memcpy(out, full, HMAC_SIZE);
+}
+
+/** @brief Sign and broadcast one lease beacon with @p flags */
+static bool leaseSendBeacon(uint8_t flags)
+{
+    ControllerLeasePayload p{};
+    esp_wifi_get_mac(WIFI_IF_STA, p.holder_mac);
+    p.flags = flags;
+    p.seq = ++s_ctrl_seq_;
+    leaseHmac(p, p.hmac);
+    s_ctrl_beacon_tick_ = xTaskGetTickCount();
+    return sendPacketTo(BROADCAST_MAC, 0, espnow::MsgType::ControllerLease,
+                        &p, sizeof(p));
+}
+
+/**
+ * @brief Consume a ControllerLease frame (runs before the peer gate)
+ * @details Authenticated by payload HMAC instead of peer approval: the
+ *          other remote shares the pairing secret but is typically not in
+ *          this remote's approved-peer table.
+ */
+static void leaseHandleFrame(const uint8_t* payload, uint8_t len)
+{
+    if (len < sizeof(ControllerLeasePayload)) {
+        return;
+    }
+    ControllerLeasePayload p{};
+    std::memcpy(&p, payload, sizeof(p));
+    uint8_t expect[HMAC_SIZE];
+    leaseHmac(p, expect);
+    uint8_t diff = 0;
+    for (size_t i = 0; i < HMAC_SIZE; ++i) {
+        diff |= static_cast<uint8_t>(expect[i] ^ p.hmac[i]);
+    }
+    if (diff != 0) {
+        return;
+    }
 
-    // Add pre-configured peer (backward compatibility)
-    if (!IsZeroMac(TEST_UNIT_MAC_)) {
-        tryAddEspNowPeer(TEST_UNIT_MAC_);
-        ESP_LOGI(TAG_, "Pre-configured test unit: %02X:%02X:%02X:%02X:%02X:%02X",
-                 TEST_UNIT_MAC_[0], TEST_UNIT_MAC_[1], TEST_UNIT_MAC_[2],
-                 TEST_UNIT_MAC_[3], TEST_UNIT_MAC_[4], TEST_UNIT_MAC_[5]);
+    uint8_t own[6];
+    esp_wifi_get_mac(WIFI_IF_STA, own);
+    if (MacEquals(p.holder_mac, own)) {
+        return;  // Our own broadcast looped back
     }
 
-    // Add any previously paired peers
-    for (size_t i = 0; i < MAX_APPROVED_PEERS; ++i) {
-        const auto& peer = s_security_.approved_peers[i];
-        if (peer.valid && !IsZeroMac(peer.mac)) {
-            tryAddEspNowPeer(peer.mac);
-            ESP_LOGI(TAG_, "Restored paired peer: %02X:%02X:%02X:%02X:%02X:%02X (%s)",
-                     peer.mac[0], peer.mac[1], peer.mac[2],
-                     peer.mac[3], peer.mac[4], peer.mac[5], peer.name);
+    if ((p.flags & LEASE_FLAG_RELEASE_) != 0) {
+        if (s_ctrl_role_ == espnow::ControllerRole::Passive &&
+            MacEquals(p.holder_mac, s_ctrl_holder_)) {
+            s_ctrl_role_ = espnow::ControllerRole::Solo;
+            ESP_LOGI(TAG_, "Lease: holder released, back to solo");
         }
+        return;
     }
 
-    xTaskCreate(recvTask, "espnow_recv", 4096, nullptr, 5, nullptr);
-    ESP_LOGI(TAG_, "ESP-NOW initialized (protocol v%u)", PROTOCOL_VERSION_);
-    ESP_LOGI(TAG_, "Approved peers: %zu", PeerStore::GetPeerCount(s_security_));
+    if (s_ctrl_role_ == espnow::ControllerRole::Active) {
+        // Conflict: a deliberate takeover always wins; simultaneous
+        // organic claims resolve by MAC compare so both sides reach the
+        // same verdict without another round trip.
+        const bool yield = (p.flags & LEASE_FLAG_TAKEOVER_) != 0 ||
+                           std::memcmp(p.holder_mac, own, 6) < 0;
+        if (!yield) {
+            return;  // We keep the lease; they will hear our beacon and yield
+        }
+        ESP_LOGW(TAG_, "Lease: yielding to %02X:%02X:%02X:%02X:%02X:%02X%s",
+                 p.holder_mac[0], p.holder_mac[1], p.holder_mac[2],
+                 p.holder_mac[3], p.holder_mac[4], p.holder_mac[5],
+                 (p.flags & LEASE_FLAG_TAKEOVER_) != 0 ? " (takeover)" : "");
+    } else if (s_ctrl_role_ == espnow::ControllerRole::Solo) {
+        ESP_LOGI(TAG_, "Lease: %02X:%02X:%02X:%02X:%02X:%02X is controlling; monitor-only",
+                 p.holder_mac[0], p.holder_mac[1], p.holder_mac[2],
+                 p.holder_mac[3], p.holder_mac[4], p.holder_mac[5]);
+    }
+    std::memcpy(s_ctrl_holder_, p.holder_mac, 6);
+    s_ctrl_holder_tick_ = xTaskGetTickCount();
+    s_ctrl_role_ = espnow::ControllerRole::Passive;
+}
+
+/**
+ * @brief Gate for command/config writes; claims the lease on first use
+ * @details Solo promotes to Active (claim beacon goes out with the write);
+ *          Passive refuses and the caller's send returns false, exactly as
+ *          if the radio send failed — no new error path for consumers.
+ */
+static bool leaseAllowsWrite()
+{
+    if (s_ctrl_role_ == espnow::ControllerRole::Passive) {
+        ESP_LOGW(TAG_, "Lease: write refused (monitor-only; holder %02X:%02X)",
+                 s_ctrl_holder_[4], s_ctrl_holder_[5]);
+        return false;
+    }
+    s_ctrl_write_tick_ = xTaskGetTickCount();
+    if (s_ctrl_role_ == espnow::ControllerRole::Solo) {
+        s_ctrl_role_ = espnow::ControllerRole::Active;
+        (void)leaseSendBeacon(0);
+        ESP_LOGI(TAG_, "Lease: claimed (first command)");
+    }
     return true;
 }
 
-bool espnow::SendDeviceDiscovery() noexcept
+/**
+ * @brief Periodic lease upkeep from the receive task
+ */
+static void serviceLease()
 {
-    return sendPacketTo(BROADCAST_MAC, 0, MsgType::DeviceDiscovery, nullptr, 0);
+    const TickType_t now = xTaskGetTickCount();
+    switch (s_ctrl_role_) {
+        case espnow::ControllerRole::Active:
+            if (now - s_ctrl_write_tick_ > pdMS_TO_TICKS(LEASE_IDLE_RELEASE_MS_)) {
+                (void)leaseSendBeacon(LEASE_FLAG_RELEASE_);
+                s_ctrl_role_ = espnow::ControllerRole::Solo;
+                ESP_LOGI(TAG_, "Lease: released after idle");
+            } else if (now - s_ctrl_beacon_tick_ > pdMS_TO_TICKS(LEASE_PERIOD_MS_)) {
+                (void)leaseSendBeacon(0);
+            }
+            break;
+        case espnow::ControllerRole::Passive:
+            if (now - s_ctrl_holder_tick_ > pdMS_TO_TICKS(LEASE_TTL_MS_)) {
+                s_ctrl_role_ = espnow::ControllerRole::Solo;
+                ESP_LOGI(TAG_, "Lease: holder silent, back to solo");
+            }
+            break;
+        case espnow::ControllerRole::Solo:
+        default:
+            break;
+    }
 }
 
-bool espnow::SendConfigRequest(uint8_t device_id) noexcept
+espnow::ControllerRole espnow::GetControllerRole() noexcept
 {
-    return sendPacketToTarget(device_id, MsgType::ConfigRequest, nullptr, 0);
+    return s_ctrl_role_;
 }
 
-bool espnow::SendConfigSet(uint8_t device_id, const void* config_data, size_t config_len) noexcept
+bool espnow::GetControllerHolder(uint8_t mac_out[6]) noexcept
 {
-    if (config_len > MAX_PAYLOAD_SIZE_) {
-        ESP_LOGE(TAG_, "Config data too large: %zu", config_len);
+    if (s_ctrl_role_ != espnow::ControllerRole::Passive) {
         return false;
     }
-    return sendPacketToTarget(device_id, MsgType::ConfigSet, config_data, static_cast<uint8_t>(config_len));
+    std::memcpy(mac_out, s_ctrl_holder_, 6);
+    return true;
 }
 
-bool espnow::SendCommand(uint8_t device_id, uint8_t command_id, const void* payload, size_t payload_len) noexcept
+bool espnow::RequestControl() noexcept
 {
-    uint8_t cmd_buf[espnow::MAX_PAYLOAD_SIZE_];
-    cmd_buf[0] = command_id;
-
-    size_t total_payload = 1;
-    if (payload != nullptr && payload_len > 0) {
-        if (1 + payload_len > MAX_PAYLOAD_SIZE_) {
-            ESP_LOGE(TAG_, "Command payload too large: %zu", payload_len);
-            return false;
-        }
-        std::memcpy(cmd_buf + 1, payload, payload_len);
-        total_payload = 1 + payload_len;
-    }
-
-    return sendPacketToTarget(device_id, MsgType::Command, cmd_buf, static_cast<uint8_t>(total_payload));
+    s_ctrl_role_ = espnow::ControllerRole::Active;
+    s_ctrl_write_tick_ = xTaskGetTickCount();
+    const bool sent = leaseSendBeacon(LEASE_FLAG_TAKEOVER_);
+    ESP_LOGI(TAG_, "Lease: takeover %s", sent ? "broadcast" : "broadcast failed");
+    return sent;
 }
 
 // ============================================================================
-// PAIRING
+// ALLOWLIST REPLICATION
 // ============================================================================
+//
+// Provisioning a spare remote used to mean re-running the physical pairing
+// dance once per unit. ShareAllowlist broadcasts this remote's whole
+// approved-peer table in one frame; a receiving remote merges it by MAC
+// with newest-wins on the pairing timestamp (PeerStore::MergePeer) and
+// persists the result, so a spare is fleet-ready after one transfer.
+// Like the controller lease, the frame is authenticated by a payload HMAC
+// over the shared pairing secret rather than the approved-peer table (the
+// other remote is typically not in ours) and runs before the peer gate.
+// Transfers only happen on an explicit operator action on the sending
+// side; received tables never re-broadcast, so a stale spare cannot
+// resurrect peers fleet-wide.
 
-bool espnow::StartPairing() noexcept
-{
-    if (s_pairing_state_ != PairingState::Idle) {
-        ESP_LOGW(TAG_, "Pairing already in progress");
-        return false;
-    }
+#pragma pack(push, 1)
+/** @brief One replicated peer entry (ApprovedPeer minus the valid flag) */
+struct AllowlistEntryWire {
+    uint8_t mac[6];                  ///< Peer MAC address
+    uint8_t device_type;             ///< DeviceType
+    char name[MAX_DEVICE_NAME_LEN];  ///< Device name (NUL-terminated)
+    uint32_t paired_timestamp;       ///< Pairing time (epoch seconds)
+};
 
-    GenerateChallenge(s_my_challenge_);
+struct AllowlistSyncPayload {
+    uint8_t sender_mac[6];                              ///< Sending remote
+    uint8_t count;                                      ///< Valid entries
+    AllowlistEntryWire entries[MAX_APPROVED_PEERS];     ///< Table snapshot
+    uint8_t hmac[HMAC_SIZE];  ///< Over all preceding fields, pairing secret
+};
+#pragma pack(pop)
 
-    PairingRequestPayload req{};
-    esp_wifi_get_mac(WIFI_IF_STA, req.requester_mac);
-    req.device_type = static_cast<uint8_t>(DeviceType::RemoteController);
-    req.expected_peer_type = static_cast<uint8_t>(DeviceType::FatigueTester);
-    std::memcpy(req.challenge, s_my_challenge_, CHALLENGE_SIZE);
-    req.protocol_version = PROTOCOL_VERSION_;
+/**
+ * @brief HMAC over the transfer fields with the shared pairing secret
+ * @details md-layer context for the same reason as leaseHmac: signing runs
+ *          on whichever task the operator's action lands on, verification
+ *          on the receive task, and transfers are rare.
+ */
+static void allowlistHmac(const AllowlistSyncPayload& p, uint8_t out[HMAC_SIZE])
+{
+    uint8_t full[32];
+    mbedtls_md_context_t ctx;
+    mbedtls_md_init(&ctx);
+    mbedtls_md_setup(&ctx, mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), 1);
+    mbedtls_md_hmac_starts(&ctx, PAIRING_SECRET, sizeof(PAIRING_SECRET));
+    mbedtls_md_hmac_update(&ctx, reinterpret_cast<const uint8_t*>(&p),
+                           offsetof(AllowlistSyncPayload, hmac));
+    mbedtls_md_hmac_finish(&ctx, full);
+    mbedtls_md_free(&ctx);
+    std::memcpy(out, full, HMAC_SIZE);
+}
 
-    if (!sendPacketTo(BROADCAST_MAC, 0, MsgType::PairingRequest, &req, sizeof(req))) {
-        ESP_LOGE(TAG_, "Failed to send pairing request");
+bool espnow::ShareAllowlist() noexcept
+{
+    AllowlistSyncPayload p{};
+    esp_wifi_get_mac(WIFI_IF_STA, p.sender_mac);
+    for (const auto& peer : s_security_.approved_peers) {
+        if (!peer.valid) {
+            continue;
+        }
+        AllowlistEntryWire& e = p.entries[p.count++];
+        std::memcpy(e.mac, peer.mac, 6);
+        e.device_type = peer.device_type;
+        std::memcpy(e.name, peer.name, sizeof(e.name));
+        e.paired_timestamp = peer.paired_timestamp;
+    }
+    if (p.count == 0) {
+        ESP_LOGW(TAG_, "Allowlist: nothing to share");
         return false;
     }
-
-    s_pairing_state_ = PairingState::WaitingForResponse;
-    s_pairing_timeout_tick_ = xTaskGetTickCount() + pdMS_TO_TICKS(PAIRING_RESPONSE_TIMEOUT_MS);
-    return true;
+    allowlistHmac(p, p.hmac);
+    const bool sent = sendPacketTo(BROADCAST_MAC, 0, espnow::MsgType::AllowlistSync,
+                                   &p, sizeof(p));
+    ESP_LOGI(TAG_, "Allowlist: %u peer%s %s", static_cast<unsigned>(p.count),
+             p.count == 1 ? "" : "s", sent ? "broadcast" : "broadcast failed");
+    return sent;
 }
 
-void espnow::CancelPairing() noexcept
+/**
+ * @brief Consume an AllowlistSync frame (runs before the peer gate)
+ */
+static void allowlistHandleFrame(const uint8_t* payload, uint8_t len)
 {
-    if (s_pairing_state_ != PairingState::Idle) {
-        s_pairing_state_ = PairingState::Idle;
+    if (len < sizeof(AllowlistSyncPayload)) {
+        return;
+    }
+    AllowlistSyncPayload p{};
+    std::memcpy(&p, payload, sizeof(p));
+    uint8_t expect[HMAC_SIZE];
+    allowlistHmac(p, expect);
+    uint8_t diff = 0;
+    for (size_t i = 0; i < HMAC_SIZE; ++i) {
+        diff |= static_cast<uint8_t>(expect[i] ^ p.hmac[i]);
+    }
+    if (diff != 0) {
+        return;
     }
-}
 
-espnow::PairingState espnow::GetPairingState() noexcept
-{
-    if (s_pairing_state_ == PairingState::WaitingForResponse) {
-        if (xTaskGetTickCount() > s_pairing_timeout_tick_) {
-            ESP_LOGW(TAG_, "Pairing timed out");
-            s_pairing_state_ = PairingState::Failed;
+    uint8_t own[6];
+    esp_wifi_get_mac(WIFI_IF_STA, own);
+    if (MacEquals(p.sender_mac, own)) {
+        return;  // Our own broadcast looped back
+    }
+
+    uint8_t changed = 0;
+    const uint8_t count = p.count <= MAX_APPROVED_PEERS
+                              ? p.count
+                              : static_cast<uint8_t>(MAX_APPROVED_PEERS);
+    for (uint8_t i = 0; i < count; ++i) {
+        const AllowlistEntryWire& e = p.entries[i];
+        if (MacEquals(e.mac, own)) {
+            continue;  // Never allowlist ourselves
+        }
+        ApprovedPeer in{};
+        std::memcpy(in.mac, e.mac, 6);
+        in.device_type = e.device_type;
+        std::memcpy(in.name, e.name, sizeof(in.name));
+        in.paired_timestamp = e.paired_timestamp;
+        if (PeerStore::MergePeer(s_security_, in)) {
+            tryAddEspNowPeer(in.mac);
+            ++changed;
         }
     }
-    return s_pairing_state_;
+    ESP_LOGI(TAG_, "Allowlist: received %u entr%s from %02X:%02X, merged %u",
+             static_cast<unsigned>(count), count == 1 ? "y" : "ies",
+             p.sender_mac[4], p.sender_mac[5], static_cast<unsigned>(changed));
+
+    // Tell the application either way - "already in sync" is feedback too,
+    // since the transfer only happens on an operator action.
+    espnow::ProtoEvent evt{};
+    evt.type = espnow::MsgType::AllowlistUpdate;
+    evt.device_id = changed;
+    std::memcpy(evt.src_mac, p.sender_mac, 6);
+    (void)queueProtoEvent(evt);
 }
 
-SecuritySettings& espnow::GetSecuritySettings() noexcept
+// --- Message registry handlers: uniform thunks over the section-local
+// handlers, so every row dispatches through one signature. ---
+
+/// PairingResponse: hand the frame to the crypto worker; the receive task
+/// moves on to the next telemetry packet immediately. Falls back to inline
+/// handling when no worker exists.
+static bool msgPairingResponse_(RawMsg& msg, const espnow::EspNowHeader& hdr,
+                                const uint8_t* payload)
 {
-    return s_security_;
+    if (s_pairing_work_queue_ != nullptr) {
+        RawMsg* work = &msg;
+        if (xQueueSend(s_pairing_work_queue_, &work, 0) == pdTRUE) {
+            return true;
+        }
+        queue_stats::NoteDrop(s_qs_pairing_);
+        return false;
+    }
+    return handlePairingResponse(msg, hdr, payload);
 }
 
-bool espnow::IsPeerApproved(const uint8_t mac[6]) noexcept
+static bool msgPairingReject_(RawMsg& msg, const espnow::EspNowHeader& hdr,
+                              const uint8_t* payload)
 {
-    return PeerStore::IsPeerApproved(s_security_, mac);
+    (void)payload;
+    handlePairingReject(msg.src_mac, hdr);
+    return false;
 }
 
-bool espnow::AddApprovedPeer(const uint8_t mac[6], DeviceType type, const char* name) noexcept
+/// Remote-to-remote: authenticated by its payload HMAC, not by the
+/// approved-peer table (the other remote is usually not in ours).
+static bool msgControllerLease_(RawMsg& msg, const espnow::EspNowHeader& hdr,
+                                const uint8_t* payload)
 {
-    const bool result = PeerStore::AddPeer(s_security_, mac, type, name);
-    if (result) {
-        tryAddEspNowPeer(mac);
-    }
-    return result;
+    (void)msg;
+    leaseHandleFrame(payload, hdr.len);
+    return false;
 }
 
-bool espnow::RemoveApprovedPeer(const uint8_t mac[6]) noexcept
+/// Remote-to-remote, same authentication story as the lease.
+static bool msgAllowlistSync_(RawMsg& msg, const espnow::EspNowHeader& hdr,
+                              const uint8_t* payload)
 {
-    return PeerStore::RemovePeer(s_security_, mac);
+    (void)msg;
+    allowlistHandleFrame(payload, hdr.len);
+    return false;
 }
 
-size_t espnow::GetApprovedPeerCount() noexcept
+/// Supervisor probes never reach the application layer.
+static bool msgPing_(RawMsg& msg, const espnow::EspNowHeader& hdr,
+                     const uint8_t* payload)
 {
-    return PeerStore::GetPeerCount(s_security_);
+    (void)payload;
+    (void)sendPacketRaw(msg.src_mac, hdr.device_id, espnow::MsgType::Echo,
+                        hdr.id, nullptr, 0);
+    return false;
 }
 
-bool espnow::GetTargetDeviceMac(uint8_t mac_out[6]) noexcept
+static bool msgEcho_(RawMsg& msg, const espnow::EspNowHeader& hdr,
+                     const uint8_t* payload)
 {
-    return PeerStore::GetFirstPeerOfType(s_security_, DeviceType::FatigueTester, mac_out);
+    (void)payload;
+    supervisorNoteEcho(msg.src_mac, hdr.id);
+    phyNoteEcho(msg.src_mac, hdr.id);
+    return false;
 }
 
-static void handlePairingResponse(const uint8_t* src_mac, const espnow::EspNowPacket& pkt)
+/// Clock sync stays outside the receive window: requests are answered in
+/// place (stamps must be taken at receive time, not after a queue hop)
+/// and replies are matched by id against our own probe.
+static bool msgTimeSync_(RawMsg& msg, const espnow::EspNowHeader& hdr,
+                         const uint8_t* payload)
 {
-    if (s_pairing_state_ != espnow::PairingState::WaitingForResponse) {
-        return;
-    }
-
-    if (pkt.hdr.len < sizeof(PairingResponsePayload)) {
-        s_pairing_state_ = espnow::PairingState::Failed;
-        return;
+    TimeSyncWire w;
+    std::memcpy(&w, payload, sizeof(w));
+    if ((w.flags & 0x01) != 0) {
+        tsyncHandleReply(msg.src_mac, hdr.id, payload, hdr.len);
+    } else {
+        w.flags = 0x01;
+        w.peer_rx_ms = tsyncNowMs();
+        w.peer_tx_ms = tsyncNowMs();
+        (void)sendPacketRaw(msg.src_mac, hdr.device_id, espnow::MsgType::TimeSync,
+                            hdr.id, &w, sizeof(w));
     }
+    return false;
+}
 
-    PairingResponsePayload resp;
-    std::memcpy(&resp, pkt.payload, sizeof(resp));
+/// Channel hops are negotiated entirely inside the protocol layer.
+static bool msgChannelSwitch_(RawMsg& msg, const espnow::EspNowHeader& hdr,
+                              const uint8_t* payload)
+{
+    (void)msg;
+    channelHandleSwitch(payload, hdr.len);
+    return false;
+}
 
-    if (resp.device_type != static_cast<uint8_t>(DeviceType::FatigueTester)) {
-        return;
-    }
+/// Firmware transfer is consumed here too; the UI only ever sees the
+/// progress snapshot (GetOtaProgress).
+static bool msgOtaBegin_(RawMsg& msg, const espnow::EspNowHeader& hdr,
+                         const uint8_t* payload)
+{
+    otaHandleBegin(payload, hdr.len, msg.src_mac, hdr.device_id);
+    return false;
+}
 
-    if (!VerifyPairingHmac(s_my_challenge_, CHALLENGE_SIZE, resp.hmac_response)) {
-        ESP_LOGE(TAG_, "HMAC verification FAILED - unauthorized device!");
-        s_pairing_state_ = espnow::PairingState::Failed;
-        return;
-    }
+static bool msgOtaChunk_(RawMsg& msg, const espnow::EspNowHeader& hdr,
+                         const uint8_t* payload)
+{
+    (void)msg;
+    otaHandleChunk(payload, hdr.len);
+    return false;
+}
 
-    // Add as ESP-NOW peer for sending confirm
-    tryAddEspNowPeer(resp.responder_mac);
+/// Bulk transfer streams are protocol plumbing; applications see only the
+/// registered sink and progress callbacks.
+static bool msgTransferBegin_(RawMsg& msg, const espnow::EspNowHeader& hdr,
+                              const uint8_t* payload)
+{
+    txfrHandleBegin(msg.src_mac, hdr.device_id, payload);
+    return false;
+}
 
-    uint8_t my_hmac[HMAC_SIZE];
-    ComputePairingHmac(resp.challenge, CHALLENGE_SIZE, my_hmac);
+static bool msgTransferChunk_(RawMsg& msg, const espnow::EspNowHeader& hdr,
+                              const uint8_t* payload)
+{
+    txfrHandleChunk(msg.src_mac, payload, hdr.len);
+    return false;
+}
 
-    PairingConfirmPayload confirm{};
-    esp_wifi_get_mac(WIFI_IF_STA, confirm.confirmer_mac);
-    std::memcpy(confirm.hmac_response, my_hmac, HMAC_SIZE);
-    confirm.success = 1;
+static bool msgTransferAck_(RawMsg& msg, const espnow::EspNowHeader& hdr,
+                            const uint8_t* payload)
+{
+    (void)hdr;
+    txfrHandleAck(msg.src_mac, payload);
+    return false;
+}
 
-    if (!sendPacketTo(resp.responder_mac, 0, espnow::MsgType::PairingConfirm, &confirm, sizeof(confirm))) {
-        s_pairing_state_ = espnow::PairingState::Failed;
-        return;
-    }
+/// Table slots: indexed by the raw MsgType value (TransferAck = 42 is
+/// the highest id, wire or internal).
+static constexpr size_t MSG_SPEC_SLOTS_ = 43;
 
-    const bool added = PeerStore::AddPeer(s_security_, resp.responder_mac,
-                                         DeviceType::FatigueTester, resp.device_name);
-    if (!added) {
-        s_pairing_state_ = espnow::PairingState::Failed;
-        return;
-    }
+static constexpr std::array<MsgSpec, MSG_SPEC_SLOTS_> buildMsgSpecs_()
+{
+    std::array<MsgSpec, MSG_SPEC_SLOTS_> t{};
+    auto row = [&t](espnow::MsgType ty, uint8_t min_len, uint8_t max_len,
+                    MsgStage stage, MsgQos qos, MsgHandler fn) {
+        t[static_cast<size_t>(ty)] = MsgSpec{min_len, max_len, stage, qos, fn};
+    };
+    constexpr uint8_t M = espnow::MAX_PAYLOAD_SIZE_;
 
-    s_pairing_state_ = espnow::PairingState::Complete;
+    // Protocol-consumed traffic, in pipeline order. PairingResponse keeps
+    // min_len 0: a runt response must still fail the pairing state machine
+    // (handler's check), not vanish into the bad_payload counter.
+    row(espnow::MsgType::PairingResponse, 0, M,
+        MsgStage::PreAuth, MsgQos::Priority, msgPairingResponse_);
+    row(espnow::MsgType::PairingReject, sizeof(PairingRejectPayload), M,
+        MsgStage::PreAuth, MsgQos::Normal, msgPairingReject_);
+    row(espnow::MsgType::ControllerLease, sizeof(ControllerLeasePayload), M,
+        MsgStage::PreAuth, MsgQos::Normal, msgControllerLease_);
+    row(espnow::MsgType::AllowlistSync, sizeof(AllowlistSyncPayload), M,
+        MsgStage::PreAuth, MsgQos::Normal, msgAllowlistSync_);
+    row(espnow::MsgType::Ping, 0, 0,
+        MsgStage::PostAuth, MsgQos::Normal, msgPing_);
+    row(espnow::MsgType::Echo, 0, 0,
+        MsgStage::PostAuth, MsgQos::Normal, msgEcho_);
+    row(espnow::MsgType::TimeSync, sizeof(TimeSyncWire), M,
+        MsgStage::PostAuth, MsgQos::Normal, msgTimeSync_);
+    row(espnow::MsgType::ChannelSwitch, sizeof(ChannelSwitchPayload), M,
+        MsgStage::PostSeq, MsgQos::Normal, msgChannelSwitch_);
+    row(espnow::MsgType::OtaBegin, sizeof(OtaBeginPayload), M,
+        MsgStage::PostSeq, MsgQos::Normal, msgOtaBegin_);
+    row(espnow::MsgType::OtaChunk, sizeof(uint16_t), M,
+        MsgStage::PostSeq, MsgQos::Normal, msgOtaChunk_);
+    row(espnow::MsgType::TransferBegin, sizeof(TransferBeginPayload), M,
+        MsgStage::PostSeq, MsgQos::Normal, msgTransferBegin_);
+    // Chunk floor is the 3-byte frame header; a data-free chunk is legal.
+    row(espnow::MsgType::TransferChunk, 3, M,
+        MsgStage::PostSeq, MsgQos::Normal, msgTransferChunk_);
+    row(espnow::MsgType::TransferAck, sizeof(TransferAckPayload), M,
+        MsgStage::PostSeq, MsgQos::Normal, msgTransferAck_);
 
-    // Notify application layer (optional)
-    if (s_proto_event_queue_) {
-        espnow::ProtoEvent evt{};
-        evt.type = espnow::MsgType::PairingResponse;
-        evt.device_id = resp.device_type;
-        std::memcpy(evt.src_mac, resp.responder_mac, 6);
-        std::memcpy(evt.payload, resp.device_name, sizeof(resp.device_name));
-        evt.payload_len = sizeof(resp.device_name);
-        xQueueSend(s_proto_event_queue_, &evt, 0);
-    }
+    // Application-bound traffic that carries a queue-policy class. Types
+    // not listed anywhere default to App / Normal with open bounds, so an
+    // unknown id still surfaces as an event (forward compatibility).
+    row(espnow::MsgType::StatusUpdate, 0, M,
+        MsgStage::App, MsgQos::Telemetry, nullptr);
+    row(espnow::MsgType::StatusBatch, 0, M,
+        MsgStage::App, MsgQos::Telemetry, nullptr);
+    row(espnow::MsgType::BoundsProgress, 0, M,
+        MsgStage::App, MsgQos::Telemetry, nullptr);
+    row(espnow::MsgType::CommandAck, 0, M,
+        MsgStage::App, MsgQos::Priority, nullptr);
+    row(espnow::MsgType::ConfigAck, 0, M,
+        MsgStage::App, MsgQos::Priority, nullptr);
+    row(espnow::MsgType::Error, 0, M,
+        MsgStage::App, MsgQos::Priority, nullptr);
+    row(espnow::MsgType::BoundsResult, 0, M,
+        MsgStage::App, MsgQos::Priority, nullptr);
+    row(espnow::MsgType::LinkUp, 0, M,
+        MsgStage::App, MsgQos::Priority, nullptr);
+    row(espnow::MsgType::LinkDown, 0, M,
+        MsgStage::App, MsgQos::Priority, nullptr);
+    return t;
 }
+static constexpr auto s_msg_specs_ = buildMsgSpecs_();
 
-static void handlePairingReject(const uint8_t* src_mac, const espnow::EspNowPacket& pkt)
+// Wire-compatibility pins: an edit that changes an on-air layout must
+// surface here, at compile time, not in the field.
+static_assert(sizeof(TimeSyncWire) == 13, "TimeSync wire layout changed");
+static_assert(sizeof(ChannelSwitchPayload) == 3, "ChannelSwitch wire layout changed");
+static_assert(sizeof(OtaBeginPayload) == 8, "OtaBegin wire layout changed");
+static_assert(sizeof(ControllerLeasePayload) == 11 + HMAC_SIZE,
+              "ControllerLease wire layout changed");
+static_assert(sizeof(AllowlistSyncPayload) <= espnow::MAX_PAYLOAD_SIZE_,
+              "allowlist snapshot no longer fits one frame");
+static_assert(sizeof(TransferBeginPayload) == 10, "TransferBegin wire layout changed");
+static_assert(sizeof(TransferAckPayload) == 8, "TransferAck wire layout changed");
+
+/// Registry self-check: non-App rows need a handler, App rows must not
+/// have one, and bounds must be ordered.
+static constexpr bool msgSpecsValid_()
 {
-    (void)src_mac;
-    if (s_pairing_state_ != espnow::PairingState::WaitingForResponse) {
-        return;
-    }
-    if (pkt.hdr.len < sizeof(PairingRejectPayload)) {
-        return;
+    for (const MsgSpec& s : s_msg_specs_) {
+        if ((s.stage != MsgStage::App) != (s.handler != nullptr)) {
+            return false;
+        }
+        if (s.min_len > s.max_len) {
+            return false;
+        }
     }
-    // Intentionally don't fail immediately; other devices may respond.
+    return true;
 }
+static_assert(msgSpecsValid_(), "message registry row is inconsistent");
 
-static void espnowSendCb(const wifi_tx_info_t* info, esp_now_send_status_t status)
+static const MsgSpec& specForType_(uint8_t type)
 {
-    (void)info;
-    ESP_LOGD(TAG_, "ESP-NOW send status=%s", status == ESP_NOW_SEND_SUCCESS ? "OK" : "FAIL");
+    static constexpr MsgSpec kDefaultSpec_{};
+    return (type < MSG_SPEC_SLOTS_) ? s_msg_specs_[type] : kDefaultSpec_;
 }
 
-static void espnowRecvCb(const esp_now_recv_info_t* info, const uint8_t* data, int len)
+static bool handlePacket(RawMsg& msg)
 {
-    if (len < 8 || len > static_cast<int>(sizeof(espnow::EspNowPacket))) {
-        ESP_LOGW(TAG_, "RX callback: invalid length %d", len);
-        return;
-    }
-
-    RawMsg msg{};
-    msg.len = len;
-    std::memcpy(msg.data, data, len);
-    std::memcpy(msg.src_mac, info->src_addr, 6);
-
-    BaseType_t hpw = pdFALSE;
-    xQueueSendFromISR(s_raw_recv_queue_, &msg, &hpw);
-    if (hpw == pdTRUE) {
-        portYIELD_FROM_ISR();
-    }
-}
+    TRACE_SCOPE("handlePacket");
+    // Every received frame opens its own causality chain on this core.
+    trace::SetCorrelation(trace::NextCorrelation());
+    const uint8_t* data = msg.data;
+    const int len = msg.len;
 
-static void handlePacket(const RawMsg& msg, const uint8_t* data, int len)
-{
     if (len < static_cast<int>(sizeof(espnow::EspNowHeader) + sizeof(uint16_t))) {
-        return;
+        ++s_rx_rejects_.runt;
+        return false;
     }
 
     espnow::EspNowHeader hdr{};
     std::memcpy(&hdr, data, sizeof(hdr));
     if (hdr.sync != espnow::SYNC_BYTE_) {
-        return;
+        ++s_rx_rejects_.bad_sync;
+        return false;
     }
-    if (hdr.version != espnow::PROTOCOL_VERSION_) {
-        return;
+    if (hdr.version != espnow::PROTOCOL_VERSION_ &&
+        hdr.version != espnow::PROTOCOL_VERSION_V2_) {
+        ++s_rx_rejects_.bad_version;
+        return false;
     }
     if (hdr.len > espnow::MAX_PAYLOAD_SIZE_) {
-        return;
+        ++s_rx_rejects_.bad_length;
+        return false;
     }
 
     const size_t expected_len = sizeof(espnow::EspNowHeader) + hdr.len + sizeof(uint16_t);
     if (len < static_cast<int>(expected_len)) {
-        return;
+        ++s_rx_rejects_.bad_length;
+        return false;
     }
 
+    // The receive callback accumulates the CRC during its copy (over the
+    // same header-derived range), so the usual case is a straight compare.
     const size_t crc_data_len = sizeof(espnow::EspNowHeader) + hdr.len;
-    const uint16_t calc_crc = espnow::crc16_ccitt(data, crc_data_len);
+    const uint16_t calc_crc =
+        msg.crc_known ? msg.crc_calc : espnow::crc16_ccitt(data, crc_data_len);
     uint16_t recv_crc = 0;
     std::memcpy(&recv_crc, data + crc_data_len, sizeof(uint16_t));
     if (calc_crc != recv_crc) {
-        return;
+        ++s_rx_rejects_.bad_crc;
+        return false;
     }
 
-    espnow::EspNowPacket pkt{};
-    std::memcpy(&pkt.hdr, data, sizeof(hdr));
-    if (hdr.len > 0) {
-        std::memcpy(pkt.payload, data + sizeof(hdr), hdr.len);
-    }
+    // Every validated frame feeds the ingress rate window, before the
+    // security gate: a flood is a flood whether or not it authenticates.
+    rateNoteRx(hdr.type);
 
+    const uint8_t* payload = data + sizeof(espnow::EspNowHeader);
     const auto type = static_cast<espnow::MsgType>(hdr.type);
 
-    if (type == espnow::MsgType::PairingResponse) {
-        handlePairingResponse(msg.src_mac, pkt);
-        return;
+    // Registry gate: payload bounds come from the message's table row, so
+    // a structurally short (or over-long, for header-only probes) frame is
+    // rejected once here instead of per handler.
+    const MsgSpec& spec = specForType_(hdr.type);
+    if (hdr.len < spec.min_len || hdr.len > spec.max_len) {
+        ++s_rx_rejects_.bad_payload;
+        return false;
     }
-    if (type == espnow::MsgType::PairingReject) {
-        handlePairingReject(msg.src_mac, pkt);
-        return;
+
+    // Pairing and remote-to-remote traffic authenticates itself (state
+    // machine or payload HMAC), not via the approved-peer table.
+    if (spec.stage == MsgStage::PreAuth) {
+        return spec.handler(msg, hdr, payload);
     }
 
     // SECURITY GATE: all other messages must come from approved peers
     if (!PeerStore::IsPeerApproved(s_security_, msg.src_mac)) {
-        return;
+        ++s_rx_rejects_.unapproved;
+        return false;
+    }
+
+    // Any authenticated packet proves the link is alive. Presence tracking
+    // also interns the sender's identity; the resulting index rides on the
+    // event so consumers route by one byte instead of a MAC compare.
+    supervisorNoteRx(msg.src_mac);
+    channelNoteAuthRx();
+    linkQualNoteRx(msg.src_mac, hdr.id, msg.rssi);
+    const uint8_t peer_index = presenceNoteRx(msg.src_mac, hdr.device_id);
+
+    // Supervisor probes and clock sync stay outside the receive window
+    // (the supervisor matches probe ids itself; sync stamps must be taken
+    // at receive time, not after a queue hop).
+    if (spec.stage == MsgStage::PostAuth) {
+        return spec.handler(msg, hdr, payload);
+    }
+
+    // Receive window: drop retransmitted repeats here, before a duplicate
+    // ack can fall through the exact-id match and retire the wrong in-flight
+    // packet via the oldest-of-type fallback.
+    if (!rxSeqAccept(msg.src_mac, hdr.type, hdr.id)) {
+        return false;
+    }
+
+    // Channel hops and firmware transfer are consumed inside the protocol
+    // layer, but only after duplicate suppression.
+    if (spec.stage == MsgStage::PostSeq) {
+        return spec.handler(msg, hdr, payload);
+    }
+
+    // Retire any in-flight packet this ack covers before notifying the app.
+    if (type == espnow::MsgType::CommandAck || type == espnow::MsgType::ConfigAck) {
+        ackInflight(type, hdr.id, msg.src_mac);
+        if (type == espnow::MsgType::CommandAck) {
+            journalNoteAck(hdr.id, msg.src_mac);
+        }
+    }
+
+    // Fleet presence: capture the advertised name before the event is
+    // handed up (the UI reads it back out of the presence table).
+    if (type == espnow::MsgType::DeviceInfo) {
+        presenceNoteInfo(msg.src_mac, payload, hdr.len);
+    }
+
+    // Black box: record non-telemetry traffic (telemetry would churn the
+    // small ring without adding reconstruction value).
+    if (!isTelemetryEvent(type)) {
+        blackbox::Note(blackbox::Kind::RxMsg, static_cast<uint8_t>(type), hdr.len);
     }
 
     espnow::ProtoEvent evt{};
     evt.type = type;
     evt.device_id = hdr.device_id;
     evt.sequence_id = hdr.id;
+    evt.version = hdr.version;
+    evt.payload = payload;
     evt.payload_len = hdr.len;
     std::memcpy(evt.src_mac, msg.src_mac, 6);
-    if (hdr.len > 0) {
-        std::memcpy(evt.payload, pkt.payload, hdr.len);
+    evt.peer_index = peer_index;
+    evt.buffer = &msg;
+    return queueProtoEvent(evt);
+}
+
+void espnow::ReleaseEvent(ProtoEvent& evt) noexcept
+{
+    if (evt.buffer != nullptr) {
+        releaseRxBuffer(static_cast<RawMsg*>(evt.buffer));
+        evt.buffer = nullptr;
     }
+    evt.payload = nullptr;
+    evt.payload_len = 0;
+}
 
-    if (s_proto_event_queue_) {
-        xQueueSend(s_proto_event_queue_, &evt, 0);
+bool espnow::AddEventSubscriber(QueueHandle_t queue) noexcept
+{
+    if (queue == nullptr || s_event_sub_count_ >= MAX_EVENT_SUBS_) {
+        return false;
     }
+    s_event_subs_[s_event_sub_count_++] = queue;
+    return true;
 }
 
 /**
- * @brief Receive task - processes packets from ISR queue
+ * @brief Receive task - processes pooled buffers from ISR queue
+ * @details Wakes at least every 20 ms to drive the retransmit engine even
+ *          when no packets arrive.
  * @param arg Task argument (unused)
  */
 static void recvTask(void* arg)
 {
     (void)arg;
-    RawMsg msg{};
+    // Health budgets: one drain pass (packet + periodic services) should
+    // stay under 10ms; the loop itself must come around well inside the
+    // 20ms queue wait plus one slow drain.
+    health::Register(health::Task::ProtoRecv, 10, 200);
+    RawMsg* msg = nullptr;
+    while (true) {
+        health::CheckIn(health::Task::ProtoRecv);
+        const bool got = xQueueReceive(s_raw_recv_queue_, &msg, pdMS_TO_TICKS(20)) == pdTRUE;
+        const int64_t work_t0_us = esp_timer_get_time();
+        if (got) {
+            if (!handlePacket(*msg)) {
+                releaseRxBuffer(msg);
+            }
+        }
+        serviceTxStatus();
+        serviceRetransmits();
+        serviceCommandJournal();
+        serviceOta();
+        serviceTransfer();
+        serviceSupervisor();
+        serviceTimeSync();
+        servicePhyProfile();
+        serviceChannelAgility();
+        serviceWarmVerify();
+        serviceCoex();
+        serviceLease();
+        servicePeriodicJobs();
+        serviceIngressRate();
+        health::ReportWork(health::Task::ProtoRecv,
+                           static_cast<uint32_t>((esp_timer_get_time() - work_t0_us) / 1000));
+    }
+}
+
+/**
+ * @brief Pairing crypto worker - runs HMAC verification off the receive task
+ * @details Frames arrive pre-validated (sync, CRC, length); the header is
+ *          re-read from the pooled buffer. Owns every mbedtls operation in
+ *          this translation unit, so the reused HMAC context in
+ *          espnow_security.hpp only ever sees one caller.
+ * @param arg Task argument (unused)
+ */
+static void pairingWorkTask(void* arg)
+{
+    (void)arg;
+    RawMsg* msg = nullptr;
     while (true) {
-        if (xQueueReceive(s_raw_recv_queue_, &msg, portMAX_DELAY) == pdTRUE) {
-            handlePacket(msg, msg.data, msg.len);
+        if (xQueueReceive(s_pairing_work_queue_, &msg, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        espnow::EspNowHeader hdr{};
+        std::memcpy(&hdr, msg->data, sizeof(hdr));
+        const uint8_t* payload = msg->data + sizeof(espnow::EspNowHeader);
+        if (!handlePairingResponse(*msg, hdr, payload)) {
+            releaseRxBuffer(msg);
         }
     }
 }
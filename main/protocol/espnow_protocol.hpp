@@ -21,9 +21,10 @@ namespace espnow {
 
 static constexpr uint8_t SYNC_BYTE_ = 0xAA;           ///< Packet sync byte
 static constexpr uint8_t PROTOCOL_VERSION_ = 1;        ///< Protocol version number
+static constexpr uint8_t PROTOCOL_VERSION_V2_ = 2;     ///< v2: delta-encoded StatusUpdate
 static constexpr uint8_t MAX_PAYLOAD_SIZE_ = 200;     ///< Maximum payload size in bytes
 static constexpr uint16_t CRC16_POLYNOMIAL_ = 0x1021; ///< CRC16 polynomial (CCITT)
-static constexpr uint8_t WIFI_CHANNEL_ = 1;            ///< WiFi channel for ESP-NOW
+static constexpr uint8_t WIFI_CHANNEL_ = 1;            ///< Default WiFi channel (channel agility may hop off it)
 
 /**
  * @brief ESP-NOW message types
@@ -44,6 +45,12 @@ enum class MsgType : uint8_t {
 
     // Fatigue-test extensions
     BoundsResult = 13,     ///< Bounds finding result
+    StatusBatch = 14,      ///< Batched status samples (high-rate telemetry)
+    Ping = 15,             ///< Link supervisor probe (header only)
+    Echo = 16,             ///< Probe reply, same id as the Ping
+    BoundsProgress = 17,   ///< Live bounds-search progress (few Hz)
+    ConfigDelta = 18,      ///< Incremental config sync (field-mask diff)
+    ChannelSwitch = 19,    ///< Channel hop announcement (handled in protocol layer)
 
     // Security / Pairing messages (20-29 range)
     PairingRequest = 20,    ///< Pairing request
@@ -51,6 +58,35 @@ enum class MsgType : uint8_t {
     PairingConfirm = 22,    ///< Pairing confirmation
     PairingReject = 23,     ///< Pairing rejection
     Unpair = 24,           ///< Unpair device
+
+    // Firmware update (25-27): consumed in the protocol layer, never
+    // surfaced to the application (see GetOtaProgress for UI state).
+    OtaBegin = 25,         ///< Start/resume an image transfer (sender -> unit)
+    OtaChunk = 26,         ///< One image chunk, full 200-byte payload
+    OtaStatus = 27,        ///< Receiver ack: next needed chunk + window credit
+
+    // Multi-remote coordination: consumed in the protocol layer (see
+    // GetControllerRole for the application-visible state).
+    ControllerLease = 28,  ///< Remote-to-remote active-controller beacon
+    TimeSync = 29,         ///< Clock offset exchange (handled in protocol layer)
+
+    // Internal events (30-38 range, never on the wire)
+    RadioReady = 30,       ///< Posted once async radio bring-up finishes
+    LinkUp = 31,           ///< Supervised peer became reachable (src_mac set)
+    LinkDown = 32,         ///< Supervised peer stopped answering probes
+    BadgeScan = 33,        ///< Operator badge scanned (posted by rfid_badge)
+    TimeSyncUpdate = 34,   ///< Peer clock offset established or stepped (src_mac set)
+    AllowlistUpdate = 35,  ///< Replicated peer entries merged (src_mac set, device_id = count)
+
+    // Fleet provisioning: remote-to-remote, HMAC-authenticated like
+    // ControllerLease and consumed in the protocol layer.
+    AllowlistSync = 39,    ///< Approved-peer table transfer (see ShareAllowlist)
+
+    // Bulk transfer (40-42): generic chunked payloads above the 200-byte
+    // packet limit, consumed in the protocol layer (see StartTransfer).
+    TransferBegin = 40,    ///< Stream announcement: kind, length, chunking, CRC
+    TransferChunk = 41,    ///< One chunk: stream id + index + data
+    TransferAck = 42,      ///< Receiver window state: base + selective bitmap
 };
 
 /**
@@ -86,18 +122,54 @@ struct EspNowPacket {
 };
 #pragma pack(pop)
 
+/// Sentinel peer index: the sender has no interned identity (see ProtoEvent).
+inline constexpr uint8_t PEER_INDEX_NONE = 0xFF;
+
 /**
  * @brief Protocol event for application layer
+ * @details Zero-copy: @p payload points into a pooled receive buffer owned
+ *          by the protocol layer. The consumer must call ReleaseEvent()
+ *          once it is done with the payload; until then the buffer is not
+ *          reused. The event itself is pointer-sized-cheap to queue.
  */
 struct ProtoEvent {
     MsgType type;                          ///< Message type
     uint8_t device_id;                     ///< Source device ID
     uint8_t sequence_id;                   ///< Message sequence ID
-    uint8_t payload[MAX_PAYLOAD_SIZE_];    ///< Event payload
+    uint8_t version;                       ///< Wire protocol version of the packet
+    const uint8_t* payload;                ///< Payload view into pooled RX buffer
     size_t payload_len;                    ///< Payload length
     uint8_t src_mac[6];                    ///< Source MAC address
+    uint8_t peer_index = PEER_INDEX_NONE;  ///< Interned sender identity (see LookupPeerIndex)
+    void* buffer;                          ///< Pool release handle (internal)
 };
 
+/**
+ * @brief Return a consumed event's receive buffer to the pool
+ * @details Must be called exactly once per event dequeued from the protocol
+ *          event queue. Safe to call on an already-released event.
+ * @param evt Event whose buffer should be released
+ */
+void ReleaseEvent(ProtoEvent& evt) noexcept;
+
+/**
+ * @brief Register an additional consumer queue for protocol events
+ * @details Fan-out without copies: every event handed to the primary queue
+ *          is also delivered to each subscriber queue as the same slim
+ *          descriptor, and the pooled receive buffer is reference-counted
+ *          per delivery — adding a consumer costs one descriptor-sized
+ *          queue slot, never a payload copy. Each consumer (primary and
+ *          subscribers alike) must ReleaseEvent() what it dequeues.
+ *          Delivery to a full subscriber queue is skipped rather than
+ *          shed-managed: taps are observers and must not add backpressure
+ *          to the path that keeps the STOP button live. Call during
+ *          startup only (the registry is not locked, matching
+ *          queue_stats::Register).
+ * @param queue Queue of ProtoEvent to receive every event
+ * @return true if registered, false if the subscriber table is full
+ */
+bool AddEventSubscriber(QueueHandle_t queue) noexcept;
+
 /**
  * @brief Initialize ESP-NOW protocol stack
  * @param event_queue FreeRTOS queue for protocol events
@@ -105,6 +177,18 @@ struct ProtoEvent {
  */
 bool Init(QueueHandle_t event_queue) noexcept;
 
+/**
+ * @brief Initialize the ESP-NOW protocol stack in a background task
+ * @details Returns immediately so the display can come up while the radio
+ *          (netif, WiFi, ESP-NOW) is still starting. A MsgType::RadioReady
+ *          event is posted to @p event_queue when bring-up finishes, with
+ *          sequence_id = 1 on success and 0 on failure. Falls back to a
+ *          blocking Init() if the task cannot be created.
+ * @param event_queue FreeRTOS queue for protocol events
+ * @return true if bring-up was started (or completed), false otherwise
+ */
+bool InitAsync(QueueHandle_t event_queue) noexcept;
+
 /**
  * @brief Send device discovery broadcast
  * @return true if send successful, false otherwise
@@ -137,6 +221,85 @@ bool SendConfigSet(uint8_t device_id, const void* config_data, size_t config_len
  */
 bool SendCommand(uint8_t device_id, uint8_t command_id, const void* payload, size_t payload_len) noexcept;
 
+/**
+ * @brief Send configuration request to a specific peer
+ * @param mac Target peer MAC address (6 bytes)
+ * @param device_id Target device ID
+ * @return true if send successful, false otherwise
+ */
+bool SendConfigRequestTo(const uint8_t mac[6], uint8_t device_id) noexcept;
+
+/**
+ * @brief Send configuration set command to a specific peer
+ * @param mac Target peer MAC address (6 bytes)
+ * @param device_id Target device ID
+ * @param config_data Configuration data buffer
+ * @param config_len Configuration data length
+ * @return true if send successful, false otherwise
+ */
+bool SendConfigSetTo(const uint8_t mac[6], uint8_t device_id,
+                     const void* config_data, size_t config_len) noexcept;
+
+/**
+ * @brief Send an incremental config delta to a specific peer
+ * @details Delivered reliably like ConfigSet (tracked until ConfigAck).
+ *          Payload is a fatigue_proto ConfigDelta built with
+ *          BuildConfigDelta().
+ * @param mac Target peer MAC address (6 bytes)
+ * @param device_id Target device ID
+ * @param delta_data Delta payload buffer
+ * @param delta_len Delta payload length
+ * @return true if send successful, false otherwise
+ */
+bool SendConfigDeltaTo(const uint8_t mac[6], uint8_t device_id,
+                       const void* delta_data, size_t delta_len) noexcept;
+
+/**
+ * @brief Send an incremental config delta to the target device
+ * @param device_id Target device ID
+ * @param delta_data Delta payload buffer
+ * @param delta_len Delta payload length
+ * @return true if send successful, false otherwise
+ */
+bool SendConfigDelta(uint8_t device_id, const void* delta_data, size_t delta_len) noexcept;
+
+/**
+ * @brief Send command to a specific peer
+ * @param mac Target peer MAC address (6 bytes)
+ * @param device_id Target device ID
+ * @param command_id Command identifier
+ * @param payload Command payload (may be nullptr)
+ * @param payload_len Payload length
+ * @return true if send successful, false otherwise
+ */
+bool SendCommandTo(const uint8_t mac[6], uint8_t device_id, uint8_t command_id,
+                   const void* payload, size_t payload_len) noexcept;
+
+/**
+ * @brief Send a command that must eventually be delivered
+ * @details On top of the normal tracked send, the command is journaled in
+ *          RAM and replayed — immediately on link restoration, else every
+ *          second — until a CommandAck retires it. One journal entry per
+ *          peer: a newer critical command supersedes the older one. Meant
+ *          for idempotent, payload-free commands (Stop, Pause) whose loss
+ *          would leave the machine running unobserved.
+ * @param mac Target peer MAC address (6 bytes)
+ * @param device_id Target device ID
+ * @param command_id Command identifier
+ * @return true if the immediate send succeeded (the journal holds the
+ *         command either way)
+ */
+bool SendCriticalCommandTo(const uint8_t mac[6], uint8_t device_id,
+                           uint8_t command_id) noexcept;
+
+/**
+ * @brief True while a journaled critical command awaits delivery to @p mac
+ * @param mac Peer MAC address (6 bytes)
+ * @param command_id_out Receives the pending command id (may be nullptr)
+ * @return true if a journal entry for the peer is still unacked
+ */
+bool CriticalCommandPending(const uint8_t mac[6], uint8_t* command_id_out) noexcept;
+
 // ============================================================================
 // PAIRING / PEER MANAGEMENT
 // ============================================================================
@@ -201,16 +364,509 @@ size_t GetApprovedPeerCount() noexcept;
 bool GetTargetDeviceMac(uint8_t mac_out[6]) noexcept;
 
 /**
- * @brief Compute CRC16-CCITT checksum
- * @param data Data buffer
- * @param len Data length in bytes
- * @return CRC16 checksum value
+ * @brief Enumerate MAC addresses of all approved FatigueTester peers
+ * @param macs_out Output array of MAC addresses (6 bytes each)
+ * @param max_out Capacity of @p macs_out
+ * @return Number of MAC addresses written
  */
-inline uint16_t crc16_ccitt(const uint8_t* data, size_t len) noexcept
+size_t GetFatigueTesterMacs(uint8_t (*macs_out)[6], size_t max_out) noexcept;
+
+/**
+ * @brief Command/ack link statistics (see GetLinkStats)
+ * @details RTT samples come from first-attempt Command/ConfigSet sends and
+ *          their acks (retransmitted packets are excluded, matching the RTT
+ *          estimator). Histogram bucket i covers [2^i, 2^(i+1)) ms; the last
+ *          bucket absorbs everything slower.
+ */
+struct LinkStats {
+    static constexpr size_t HIST_BUCKETS = 10;  ///< 1 ms .. 512+ ms, log2 spaced
+    uint32_t hist[HIST_BUCKETS];  ///< Ack RTT histogram
+    uint32_t tracked_sent;        ///< Command/ConfigSet packets tracked for ack
+    uint32_t acked;               ///< Tracked packets acknowledged
+    uint32_t lost;                ///< Tracked packets dropped after max retries
+    uint32_t retransmits;         ///< Individual retransmit attempts
+    uint32_t rx_duplicates;       ///< Received packets dropped by the sequence window
+    uint32_t rx_reordered;        ///< Received packets delivered behind a newer one
+    uint32_t rx_shed;             ///< StatusUpdates coalesced away during ingress storms
+};
+
+/**
+ * @brief Copy the accumulated link statistics
+ * @param out Destination statistics structure
+ */
+void GetLinkStats(LinkStats& out) noexcept;
+
+/**
+ * @brief Zero the accumulated link statistics
+ */
+void ResetLinkStats() noexcept;
+
+/**
+ * @brief True while ingress overload protection is active
+ * @details Latches when the validated packet rate crosses ~80 pkt/s and
+ *          releases below ~40 pkt/s. While latched, consecutive
+ *          StatusUpdates from one peer are coalesced to the newest sample
+ *          at enqueue (counted in LinkStats::rx_shed), so the remote stays
+ *          controllable no matter how fast a misbehaving unit transmits.
+ */
+bool StormActive() noexcept;
+
+/**
+ * @brief Validated ingress rate for one message type
+ * @param type Message type to query
+ * @return Packets per second over the last completed 1 s window
+ */
+uint32_t GetIngressRate(MsgType type) noexcept;
+
+/**
+ * @brief Malformed-frame rejection counters (see GetRxRejectStats)
+ * @details One counter per validation stage in handlePacket, in the order
+ *          the checks run, so a burst of rejects points at the layer that
+ *          tripped (a channel-sharing neighbor bumps bad_sync, RF
+ *          corruption bumps bad_crc, a replayed frame lands in
+ *          LinkStats::rx_duplicates instead). All fields are written on
+ *          the receive task except bad_payload, which counts both frames
+ *          outside their registry length bounds (checked just before the
+ *          peer gate) and validated payloads consumers fail to parse
+ *          (NoteBadPayload); counters are best-effort word-sized tallies,
+ *          read without a lock.
+ */
+struct RxRejectStats {
+    uint32_t runt;         ///< Frame shorter than header + CRC
+    uint32_t bad_sync;     ///< Sync byte mismatch
+    uint32_t bad_version;  ///< Unknown protocol version
+    uint32_t bad_length;   ///< Claimed payload overruns the cap or the frame
+    uint32_t bad_crc;      ///< CRC16 mismatch
+    uint32_t unapproved;   ///< Valid frame from a peer outside the store
+    uint32_t bad_payload;  ///< Payload outside its registry bounds or failed its parser
+};
+
+/**
+ * @brief Copy the accumulated rejection counters
+ * @param out Destination statistics structure
+ */
+void GetRxRejectStats(RxRejectStats& out) noexcept;
+
+/**
+ * @brief Count one validated frame whose payload failed to parse
+ * @details For consumers that parse payloads off ProtoEvents (the
+ *          protocol layer never sees those verdicts).
+ */
+void NoteBadPayload() noexcept;
+
+/**
+ * @brief Feed a raw frame through the full receive path (test hook)
+ * @details Copies the frame into a pooled RX buffer exactly as the
+ *          ESP-NOW callback would (including the fold-into-copy CRC) and
+ *          queues it to the receive task, so a fuzz harness can push
+ *          mutated frames through every validation stage at high rate
+ *          without radio involvement. Rejections land in RxRejectStats.
+ * @param src_mac Claimed sender MAC (drives the security gate)
+ * @param data Raw frame bytes (header + payload + CRC)
+ * @param len Frame length in bytes
+ * @return true if the frame was queued, false if it was out of range or
+ *         the pool/queue was full
+ */
+bool InjectRawFrame(const uint8_t src_mac[6], const uint8_t* data, size_t len) noexcept;
+
+/**
+ * @brief Callback for a scheduler-run periodic job (receive task context)
+ */
+using PeriodicJobFn = void (*)(void* ctx);
+
+/**
+ * @brief Register a periodic traffic job with the protocol scheduler
+ * @details Replaces hand-rolled `last_xxx_ms_` timing: each job owns a
+ *          one-token bucket refilled every @p period_ms plus a fresh
+ *          uniform jitter draw, so cadences never phase-lock and a stalled
+ *          task earns one deferred send instead of a synchronized burst.
+ *          Jobs with a callback run on the receive task, at most one per
+ *          service pass (highest @p priority first), which spreads the
+ *          recovery traffic after any blocking operation. Jobs registered
+ *          with a null callback are consumer-polled: call PeriodicJobDue
+ *          from the owning task and do the send there — that keeps jobs
+ *          whose payload reads task-private state (the UI's status poll)
+ *          on their own task while the timing still lives here. The first
+ *          token is available immediately. Registered jobs cannot be
+ *          removed; the table is sized for the firmware's static set.
+ * @param name Short job name for the PERF dump table
+ * @param period_ms Token refill period (the steady-state send rate)
+ * @param jitter_ms Uniform jitter added to each refill (0 = none)
+ * @param priority Scheduler preference among runnable callback jobs
+ *        (higher runs first; ignored for polled jobs)
+ * @param fn Job callback, or nullptr for a consumer-polled job
+ * @param ctx Opaque pointer handed to @p fn
+ * @return Job id for PeriodicJobDue, or -1 if the table is full
+ */
+int RegisterPeriodicJob(const char* name, uint32_t period_ms, uint32_t jitter_ms,
+                        uint8_t priority, PeriodicJobFn fn, void* ctx) noexcept;
+
+/**
+ * @brief Claim a polled job's token if its period (plus jitter) has elapsed
+ * @param job Id from RegisterPeriodicJob (negative ids always return false)
+ * @return true exactly once per refill; the send should happen now
+ */
+bool PeriodicJobDue(int job) noexcept;
+
+/**
+ * @brief Dump the periodic job table (name, rate, runs) to the console
+ */
+void DumpPeriodicJobs() noexcept;
+
+/**
+ * @brief Firmware update receiver state (see GetOtaProgress)
+ */
+enum class OtaState : uint8_t {
+    Idle,           ///< No transfer in progress
+    Preparing,      ///< OtaBegin accepted, erasing the inactive partition
+    Receiving,      ///< Chunks streaming in
+    ReadyToReboot,  ///< Image verified and activated; restart imminent
+    Error,          ///< Transfer failed (see OtaProgress::error)
+};
+
+/**
+ * @brief Snapshot of the firmware update receiver (see GetOtaProgress)
+ */
+struct OtaProgress {
+    OtaState state;         ///< Receiver state
+    uint8_t error;          ///< Failure detail when state == Error (0 = none)
+    uint8_t percent;        ///< Chunks flashed, percent of total
+    uint16_t chunks_done;   ///< Chunks written to the inactive partition
+    uint16_t chunks_total;  ///< Chunks in the announced image
+};
+
+/**
+ * @brief Snapshot the firmware update receiver for the UI
+ * @details Chunked image transfer over OtaBegin/OtaChunk/OtaStatus: the
+ *          sender streams the full 200-byte payload per chunk inside the
+ *          credit window the receiver advertises, each chunk covered by the
+ *          packet CRC16, with flash writes to the inactive partition done
+ *          on a background task so the UI stays responsive. A transfer
+ *          interrupted by link loss resumes where it stopped — the periodic
+ *          OtaStatus tells the sender the next chunk still needed. After
+ *          the final chunk the whole image is CRC-checked and activated,
+ *          then the unit restarts on its own.
+ * @param out Receives the progress snapshot
+ */
+void GetOtaProgress(OtaProgress& out) noexcept;
+
+/**
+ * @brief What a bulk transfer carries (rides the TransferBegin announcement)
+ */
+enum class TransferKind : uint8_t {
+    SessionExport = 1,  ///< Session log / run record export
+    AllowlistBulk = 2,  ///< Full allowlist replication beyond one packet
+    LogPull = 3,        ///< Unit-side log pulled to the remote
+};
+
+/**
+ * @brief Sender progress report (called from the protocol receive task)
+ * @param kind What the stream carries
+ * @param done_bytes Bytes the receiver has confirmed
+ * @param total_bytes Stream length
+ * @param finished The receiver verified the stream CRC and delivered it
+ * @param failed The transfer was rejected, timed out or aborted
+ */
+using TransferProgressFn = void (*)(TransferKind kind, uint32_t done_bytes,
+                                    uint32_t total_bytes, bool finished, bool failed);
+
+/**
+ * @brief Completed inbound stream delivery (called from the receive task)
+ * @details The buffer belongs to the protocol layer and is freed on
+ *          return — copy out or consume before returning, and keep the
+ *          work short: the receive task is waiting.
+ */
+using TransferSinkFn = void (*)(TransferKind kind, const uint8_t src_mac[6],
+                                const uint8_t* data, uint32_t len);
+
+/**
+ * @brief Start a chunked outbound transfer to a paired peer
+ * @details Generic bulk layer above the 200-byte packet limit: the stream
+ *          is announced with TransferBegin, then chunks flow inside a
+ *          fixed window with selective retransmit driven by the
+ *          receiver's acks (cumulative base + bitmap), each frame covered
+ *          by the normal packet CRC and paced through the TX scheduler's
+ *          bulk class so commands always cut ahead. One outbound stream
+ *          at a time; the call fails if one is already running.
+ * @param mac Destination peer (must be approved)
+ * @param kind What the payload is (dispatches the receiver's sink)
+ * @param data Stream bytes; MUST stay valid until the progress callback
+ *             reports finished or failed
+ * @param len Stream length in bytes
+ * @param progress Progress callback, may be nullptr
+ * @return true if the stream was accepted for sending
+ */
+bool StartTransfer(const uint8_t mac[6], TransferKind kind, const uint8_t* data,
+                   uint32_t len, TransferProgressFn progress) noexcept;
+
+/** @brief True while an outbound transfer is running (one at a time). */
+bool TransferBusy() noexcept;
+
+/**
+ * @brief Register the consumer for completed inbound transfers
+ * @details One sink for all kinds; unhandled kinds are rejected at the
+ *          TransferBegin handshake, so set the sink before peers send.
+ */
+void SetTransferSink(TransferSinkFn fn) noexcept;
+
+/**
+ * @brief Get the channel ESP-NOW is currently operating on
+ * @details Starts as the persisted channel (or WIFI_CHANNEL_ on first boot)
+ *          and moves when channel agility confirms a hop. Diagnostics only;
+ *          the protocol layer manages hops itself.
+ * @return Active WiFi channel number
+ */
+uint8_t GetCurrentChannel() noexcept;
+
+/// Candidate channels a survey covers (mirrors the agility candidate list)
+static constexpr size_t SURVEY_CHANNELS = 3;
+
+/**
+ * @brief Per-channel congestion survey result (see GetChannelSurvey)
+ */
+struct ChannelSurvey {
+    bool valid;                           ///< A full survey has completed
+    uint32_t age_ms;                      ///< Milliseconds since it completed
+    uint8_t channels[SURVEY_CHANNELS];    ///< Channel number per slot
+    uint8_t ap_count[SURVEY_CHANNELS];    ///< APs heard on that channel (capped at 255)
+    int8_t best_rssi[SURVEY_CHANNELS];    ///< Strongest AP RSSI in dBm (-128 if none)
+};
+
+/**
+ * @brief Queue a WiFi congestion survey of the candidate channels
+ * @details The coexistence governor never scans on demand: the survey is
+ *          sliced into single-channel passive dwells (~40 ms each) that run
+ *          between service passes only while the link is quiet — no test
+ *          running, nothing awaiting an ack, no OTA transfer, channel
+ *          agility idle — and the working channel is restored after every
+ *          slice. Results feed the hop-target choice and are readable via
+ *          GetChannelSurvey. Station-mode features needing off-channel time
+ *          must route through this governor rather than scanning directly.
+ * @return true if the survey was queued, false if one is already running
+ */
+bool RequestChannelSurvey() noexcept;
+
+/**
+ * @brief Copy out the most recent completed channel survey
+ * @param out Receives the survey (out.valid false when none has completed)
+ * @return true if a completed survey exists
+ */
+bool GetChannelSurvey(ChannelSurvey& out) noexcept;
+
+/**
+ * @brief Tell the coexistence governor whether a test run is live
+ * @details Called by the UI on run transitions. While true, off-channel
+ *          work (scan slices) is deferred entirely so command latency is
+ *          never at risk during a test.
+ * @param running true from run start until the run ends
+ */
+void NoteTestRunning(bool running) noexcept;
+
+/**
+ * @brief This remote's role in multi-remote command arbitration
+ * @details Two remotes paired to the same unit used to both send commands,
+ *          and the unit obeyed whichever arrived last. Remotes now announce
+ *          an active-controller lease to each other over the broadcast
+ *          channel, authenticated with the shared pairing secret (the same
+ *          HMAC identity pairing uses), so a claim cannot be forged by an
+ *          unpaired device. The first remote to send a command claims the
+ *          lease and beacons it; a remote hearing someone else's lease goes
+ *          Passive — telemetry keeps flowing, but command and config writes
+ *          are refused locally instead of duplicating traffic on the air.
+ *          Simultaneous claims resolve deterministically (lower MAC wins),
+ *          and a lease idle for several minutes is released so the spare
+ *          remote scenario needs no manual handover.
+ */
+enum class ControllerRole : uint8_t {
+    Solo,     ///< No other claimant heard; commands allowed, no beacons sent
+    Active,   ///< Holding the lease and beaconing it
+    Passive,  ///< Another remote holds the lease; writes are gated
+};
+
+/**
+ * @brief Current arbitration role (see ControllerRole)
+ */
+ControllerRole GetControllerRole() noexcept;
+
+/**
+ * @brief MAC of the remote currently holding the lease
+ * @param mac_out Receives the holder MAC (6 bytes)
+ * @return true when Passive (a holder is known), false otherwise
+ */
+bool GetControllerHolder(uint8_t mac_out[6]) noexcept;
+
+/**
+ * @brief Deliberately take the controller lease from the current holder
+ * @details Broadcasts a takeover claim the holder yields to. For explicit
+ *          operator handover only — passive remotes never take over on
+ *          their own, since an accidental START from a stowed remote is
+ *          exactly what arbitration exists to prevent.
+ * @return true if the claim was broadcast
+ */
+bool RequestControl() noexcept;
+
+/**
+ * @brief Broadcast this remote's approved-peer table to other remotes
+ * @details Fleet provisioning: pairing four units to a spare remote used
+ *          to mean repeating the physical pairing dance four times. A
+ *          remote that already holds the allowlist broadcasts it in one
+ *          HMAC-authenticated AllowlistSync frame; receivers merge by MAC
+ *          with newest-wins on the pairing timestamp and persist the
+ *          result, so provisioning a spare is one button hold. Only the
+ *          operator triggers this — tables never replicate on their own.
+ * @return true if the transfer was broadcast
+ */
+bool ShareAllowlist() noexcept;
+
+/**
+ * @brief Per-peer RF link quality (see GetPeerLinkQuality)
+ */
+struct PeerLinkQuality {
+    int8_t rssi_dbm;   ///< Smoothed receive RSSI in dBm (EWMA, alpha = 1/8)
+    uint8_t loss_pct;  ///< Recent inbound loss estimate, percent
+};
+
+/**
+ * @brief Get receive-side link quality for a peer
+ * @details RSSI is sampled from every authenticated frame at the receive
+ *          callback and smoothed. Loss is estimated from gaps in the
+ *          peer's header id sequence over a rolling window; traffic the
+ *          peer sends elsewhere (broadcasts) consumes ids too, so treat it
+ *          as an indicator, not an exact rate.
+ * @param mac Peer MAC address (6 bytes)
+ * @param out Receives the quality estimates
+ * @return true if at least one frame has been sampled for the peer
+ */
+bool GetPeerLinkQuality(const uint8_t mac[6], PeerLinkQuality& out) noexcept;
+
+/**
+ * @brief True while the peer's TX rate profile is long-range
+ * @details The protocol engages the LR PHY rate per peer when link quality
+ *          degrades past the edge thresholds and the peer proves it can
+ *          hear the rate by answering a probe; a strong link falls back to
+ *          the standard rate. Diagnostic only - selection is automatic.
+ * @param mac Peer MAC address (6 bytes)
+ */
+bool GetPeerLongRange(const uint8_t mac[6]) noexcept;
+
+/**
+ * @brief Get smoothed round-trip time to a peer
+ * @details RTT is sampled from first-attempt Command/ConfigSet sends and
+ *          their acks, smoothed with an EWMA (alpha = 1/8). Retransmitted
+ *          packets are excluded to avoid ack ambiguity.
+ * @param mac Peer MAC address (6 bytes)
+ * @param rtt_ms_out Smoothed RTT in milliseconds
+ * @return true if an RTT estimate exists for the peer, false otherwise
+ */
+bool GetPeerRttMs(const uint8_t mac[6], uint32_t& rtt_ms_out) noexcept;
+
+/**
+ * @brief Clock relation to a peer (see GetPeerTimeSync)
+ */
+struct PeerTimeSync {
+    int32_t offset_ms;   ///< peer_ms - local_ms; peer time = local + offset
+    uint16_t rtt_ms;     ///< Round trip of the last accepted sync sample
+    uint32_t age_ms;     ///< Milliseconds since the last accepted sample
+};
+
+/**
+ * @brief Get the established clock offset to a peer
+ * @details The protocol layer runs a periodic TimeSync exchange against
+ *          every supervised peer: the request carries the local clock, the
+ *          reply adds the peer's receive and transmit stamps, and the
+ *          round trip brackets the offset like a micro-NTP probe. Samples
+ *          whose RTT exceeds the best observed (asymmetric round trips -
+ *          one leg retried at the MAC layer) are discarded, so the offset
+ *          settles to a few milliseconds. A TimeSyncUpdate event is posted
+ *          when the offset is first established or steps visibly; peers
+ *          that never answer simply stay unsynchronized.
+ * @param mac Peer MAC address (6 bytes)
+ * @param out Receives the offset snapshot
+ * @return true if an offset has been established for the peer
+ */
+bool GetPeerTimeSync(const uint8_t mac[6], PeerTimeSync& out) noexcept;
+
+/**
+ * @brief One row of the peer presence table (see GetPresence)
+ */
+struct PresenceEntry {
+    uint8_t mac[6];     ///< Peer MAC address
+    uint8_t device_id;  ///< Device id from the peer's most recent header
+    char name[16];      ///< Advertised name from DeviceInfo, NUL-terminated ("" until heard)
+    uint32_t age_ms;    ///< Milliseconds since the peer was last heard
+};
+
+/**
+ * @brief Snapshot the peer presence table for the Fleet page
+ * @details Every authenticated frame refreshes its sender's row; names are
+ *          filled in from DeviceInfo answers to the periodic low-rate
+ *          discovery broadcast the protocol layer sends on its own
+ *          (roughly every 15 s, jittered). Rows persist for the session,
+ *          so a unit that goes quiet shows a growing age rather than
+ *          vanishing from the list.
+ * @param out Destination array
+ * @param max_out Capacity of @p out
+ * @return Number of entries written
+ */
+size_t GetPresence(PresenceEntry* out, size_t max_out) noexcept;
+
+// ============================================================================
+// PEER IDENTITY CACHE
+// ============================================================================
+// The presence table doubles as an identity intern table: every approved
+// sender is resolved to a stable 1-byte slot index once at packet ingress
+// (ProtoEvent::peer_index), so downstream routing compares a byte instead
+// of six, and display strings are built when an identity changes rather
+// than every time it is logged or drawn.
+
+/**
+ * @brief Resolve a MAC address to its interned peer index
+ * @details Linear scan; intended for slow paths (unit switching, UI setup).
+ *          Hot paths should use the ProtoEvent::peer_index resolved at
+ *          ingress instead.
+ * @param mac Peer MAC address (6 bytes)
+ * @return Slot index, or PEER_INDEX_NONE if the peer has not been heard
+ */
+uint8_t LookupPeerIndex(const uint8_t mac[6]) noexcept;
+
+/**
+ * @brief Copy the presence row behind an interned peer index
+ * @param index Slot index from ProtoEvent::peer_index or LookupPeerIndex()
+ * @param out Destination entry
+ * @return true if the index names a live row, false otherwise
+ */
+bool GetPeerByIndex(uint8_t index, PresenceEntry& out) noexcept;
+
+/**
+ * @brief Display label for an interned peer index
+ * @details Returns a pointer to per-slot storage owned by the protocol
+ *          layer: the advertised name once a DeviceInfo has been heard, the
+ *          formatted MAC address until then. The label is (re)built when the
+ *          identity changes, not per call, so it is safe to pass to logging
+ *          in hot paths. Never nullptr; "" for PEER_INDEX_NONE or a dead row.
+ * @param index Slot index from ProtoEvent::peer_index or LookupPeerIndex()
+ * @return NUL-terminated label string with protocol-layer lifetime
+ */
+const char* PeerLabel(uint8_t index) noexcept;
+
+namespace detail {
+
+/**
+ * @brief 256-entry CRC16-CCITT lookup table, generated at compile time
+ */
+struct Crc16Table {
+    uint16_t entry[256];  ///< Precomputed CRC of each byte value
+};
+
+/**
+ * @brief Generate the CRC16 lookup table (constexpr, zero runtime cost)
+ * @return Fully populated table for CRC16_POLYNOMIAL_
+ */
+constexpr Crc16Table makeCrc16Table() noexcept
 {
-    uint16_t crc = 0xFFFF;
-    for (size_t i = 0; i < len; ++i) {
-        crc ^= (uint16_t)data[i] << 8;
+    Crc16Table table{};
+    for (int i = 0; i < 256; ++i) {
+        uint16_t crc = (uint16_t)(i << 8);
         for (int j = 0; j < 8; ++j) {
             if (crc & 0x8000) {
                 crc = (crc << 1) ^ CRC16_POLYNOMIAL_;
@@ -218,8 +874,103 @@ inline uint16_t crc16_ccitt(const uint8_t* data, size_t len) noexcept
                 crc <<= 1;
             }
         }
+        table.entry[i] = crc;
+    }
+    return table;
+}
+
+inline constexpr Crc16Table kCrc16Table_ = makeCrc16Table();
+
+} // namespace detail
+
+/**
+ * @brief Cumulative CRC computation cost counters
+ * @details Updated on every crc16_ccitt call (two per packet: send + verify)
+ *          so telemetry-rate checksum cost can be read off at runtime.
+ */
+struct CrcStats {
+    uint32_t calls;  ///< Number of crc16_ccitt invocations
+    uint32_t bytes;  ///< Total bytes checksummed
+};
+
+namespace detail {
+inline CrcStats g_crc_stats_{0, 0};  ///< Process-wide CRC cost counters
+} // namespace detail
+
+/**
+ * @brief Get cumulative CRC cost counters
+ * @return Snapshot of calls/bytes since boot
+ */
+inline CrcStats GetCrcStats() noexcept { return detail::g_crc_stats_; }
+
+/**
+ * @brief Compute CRC16-CCITT checksum (table-driven, one lookup per byte)
+ * @param data Data buffer
+ * @param len Data length in bytes
+ * @return CRC16 checksum value
+ */
+inline uint16_t crc16_ccitt(const uint8_t* data, size_t len) noexcept
+{
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; ++i) {
+        crc = (uint16_t)((crc << 8) ^ detail::kCrc16Table_.entry[((crc >> 8) ^ data[i]) & 0xFF]);
     }
+    detail::g_crc_stats_.calls += 1;
+    detail::g_crc_stats_.bytes += (uint32_t)len;
     return crc;
 }
 
+/**
+ * @brief Streaming CRC16-CCITT accumulator
+ * @details Same polynomial and table as crc16_ccitt, but state persists
+ *          across calls so packet assembly and the receive copy can fold
+ *          the checksum into the pass they already make over the bytes
+ *          instead of re-reading the buffer afterwards. finish() folds
+ *          the accumulated byte count into GetCrcStats() exactly once.
+ */
+class Crc16Stream {
+public:
+    /**
+     * @brief Accumulate @p len bytes into the running checksum
+     */
+    void update(const uint8_t* data, size_t len) noexcept {
+        uint16_t crc = crc_;
+        for (size_t i = 0; i < len; ++i) {
+            crc = (uint16_t)((crc << 8) ^ detail::kCrc16Table_.entry[((crc >> 8) ^ data[i]) & 0xFF]);
+        }
+        crc_ = crc;
+        bytes_ += (uint32_t)len;
+    }
+
+    /**
+     * @brief Copy @p len bytes to @p dst while accumulating them
+     * @details The fused copy is the point of this class: one pass serves
+     *          both the buffer move and the checksum.
+     */
+    void updateCopy(uint8_t* dst, const uint8_t* src, size_t len) noexcept {
+        uint16_t crc = crc_;
+        for (size_t i = 0; i < len; ++i) {
+            const uint8_t b = src[i];
+            dst[i] = b;
+            crc = (uint16_t)((crc << 8) ^ detail::kCrc16Table_.entry[((crc >> 8) ^ b) & 0xFF]);
+        }
+        crc_ = crc;
+        bytes_ += (uint32_t)len;
+    }
+
+    /**
+     * @brief Final checksum; records the accumulated cost in GetCrcStats()
+     */
+    uint16_t finish() noexcept {
+        detail::g_crc_stats_.calls += 1;
+        detail::g_crc_stats_.bytes += bytes_;
+        bytes_ = 0;
+        return crc_;
+    }
+
+private:
+    uint16_t crc_ = 0xFFFF;  ///< Running checksum
+    uint32_t bytes_ = 0;     ///< Bytes accumulated since construction/finish
+};
+
 } // namespace espnow
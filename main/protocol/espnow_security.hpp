@@ -13,7 +13,10 @@
 #include <cstring>
 
 #include "esp_random.h"
+#include "esp_timer.h"
+#include "esp_log.h"
 #include "mbedtls/md.h"
+#include "mbedtls/sha256.h"
 
 // ============================================================================
 // PAIRING SECRET CONFIGURATION
@@ -170,7 +173,7 @@ struct ApprovedPeer {
     uint8_t mac[6];                     ///< Peer MAC address
     uint8_t device_type;                 ///< Device type
     char name[MAX_DEVICE_NAME_LEN];      ///< Device name (null-terminated)
-    uint32_t paired_timestamp;           ///< Pairing timestamp (unused, reserved)
+    uint32_t paired_timestamp;           ///< Pairing time (epoch seconds; newest-wins merge key)
     bool valid;                          ///< True if peer entry is valid
 };
 
@@ -183,6 +186,14 @@ struct SecuritySettings {
 
 /**
  * @brief Compute HMAC-SHA256 for pairing challenge
+ * @details Runs directly on mbedtls_sha256 contexts, which ESP-IDF routes
+ *          through the S3 SHA peripheral (CONFIG_MBEDTLS_HARDWARE_SHA), and
+ *          keeps the HMAC key schedule persistent: the ipad and opad key
+ *          blocks are absorbed once into two static contexts that are
+ *          cloned per message, so each call costs only the message blocks
+ *          through the hardware hasher — cheap enough for the planned
+ *          per-message authentication, not just pairing. Not reentrant:
+ *          all callers run on the pairing worker task.
  * @param challenge Challenge bytes
  * @param challenge_len Challenge length
  * @param out Output buffer for HMAC (must be at least HMAC_SIZE bytes)
@@ -190,17 +201,77 @@ struct SecuritySettings {
 inline void ComputePairingHmac(const uint8_t* challenge, size_t challenge_len,
                                uint8_t out[HMAC_SIZE]) noexcept
 {
-    uint8_t full_hmac[32];
+    static mbedtls_sha256_context s_ipad_ctx;
+    static mbedtls_sha256_context s_opad_ctx;
+    static bool s_keyed = false;
+    if (!s_keyed) {
+        uint8_t block[64];
+        std::memset(block, 0x36, sizeof(block));
+        for (size_t i = 0; i < sizeof(PAIRING_SECRET); ++i) {
+            block[i] ^= PAIRING_SECRET[i];
+        }
+        mbedtls_sha256_init(&s_ipad_ctx);
+        mbedtls_sha256_starts(&s_ipad_ctx, 0);
+        mbedtls_sha256_update(&s_ipad_ctx, block, sizeof(block));
+        std::memset(block, 0x5C, sizeof(block));
+        for (size_t i = 0; i < sizeof(PAIRING_SECRET); ++i) {
+            block[i] ^= PAIRING_SECRET[i];
+        }
+        mbedtls_sha256_init(&s_opad_ctx);
+        mbedtls_sha256_starts(&s_opad_ctx, 0);
+        mbedtls_sha256_update(&s_opad_ctx, block, sizeof(block));
+        s_keyed = true;
+    }
+
+    uint8_t digest[32];
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    mbedtls_sha256_clone(&ctx, &s_ipad_ctx);
+    mbedtls_sha256_update(&ctx, challenge, challenge_len);
+    mbedtls_sha256_finish(&ctx, digest);
+    mbedtls_sha256_clone(&ctx, &s_opad_ctx);
+    mbedtls_sha256_update(&ctx, digest, sizeof(digest));
+    mbedtls_sha256_finish(&ctx, digest);
+    mbedtls_sha256_free(&ctx);
+
+    std::memcpy(out, digest, HMAC_SIZE);
+}
 
-    mbedtls_md_context_t ctx;
-    mbedtls_md_init(&ctx);
-    mbedtls_md_setup(&ctx, mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), 1);
-    mbedtls_md_hmac_starts(&ctx, PAIRING_SECRET, sizeof(PAIRING_SECRET));
-    mbedtls_md_hmac_update(&ctx, challenge, challenge_len);
-    mbedtls_md_hmac_finish(&ctx, full_hmac);
-    mbedtls_md_free(&ctx);
+/**
+ * @brief One-shot timing comparison of the HMAC paths
+ * @details Times the generic mbedtls md-layer HMAC (the previous
+ *          implementation) against the persistent keyed-context path above
+ *          over a payload-sized message and logs both. Debug builds call
+ *          this once at protocol init so regressions in the hardware-SHA
+ *          configuration show up in the boot log.
+ */
+inline void BenchmarkPairingHmac() noexcept
+{
+    constexpr int kIters = 64;
+    uint8_t msg[MAX_DEVICE_NAME_LEN + CHALLENGE_SIZE] = {0x5A};
+    uint8_t mac_out[HMAC_SIZE];
+
+    int64_t t0 = esp_timer_get_time();
+    for (int i = 0; i < kIters; ++i) {
+        uint8_t full[32];
+        mbedtls_md_context_t ctx;
+        mbedtls_md_init(&ctx);
+        mbedtls_md_setup(&ctx, mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), 1);
+        mbedtls_md_hmac_starts(&ctx, PAIRING_SECRET, sizeof(PAIRING_SECRET));
+        mbedtls_md_hmac_update(&ctx, msg, sizeof(msg));
+        mbedtls_md_hmac_finish(&ctx, full);
+        mbedtls_md_free(&ctx);
+    }
+    const int64_t sw_us = esp_timer_get_time() - t0;
+
+    t0 = esp_timer_get_time();
+    for (int i = 0; i < kIters; ++i) {
+        ComputePairingHmac(msg, sizeof(msg), mac_out);
+    }
+    const int64_t hw_us = esp_timer_get_time() - t0;
 
-    std::memcpy(out, full_hmac, HMAC_SIZE);
+    ESP_LOGI("hmac", "HMAC bench (%d iters): md-layer %lld us, keyed-sha %lld us",
+             kIters, (long long)sw_us, (long long)hw_us);
 }
 
 /**
@@ -0,0 +1,76 @@
+/**
+ * @file fatigue_errors.hpp
+ * @brief Knowledge base for fatigue test unit error codes.
+ * @details StatusPayload.err_code used to surface as a bare number, and
+ *          decoding one meant radioing whoever had the unit firmware open.
+ *          This table carries the decode on the remote: name, severity and
+ *          the suggested first action for every known code, indexed directly
+ *          by code value so lookup is one bounds check and one array read.
+ *          The strings are literals, so the whole table lives in flash
+ *          (.rodata) and costs no RAM.
+ *
+ *          The code space mirrors the unit firmware's error enum; codes the
+ *          remote does not know (newer unit firmware) fall back to a generic
+ *          entry rather than garbage, so the raw code stays the source of
+ *          truth on screen.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace fatigue_proto {
+
+/**
+ * @brief How bad an error code is, for display emphasis
+ */
+enum class ErrSeverity : uint8_t {
+    Info = 0,    ///< Expected/benign (operator action, self-clearing)
+    Warning,     ///< Test degraded but recoverable without hardware work
+    Fault        ///< Test stopped; likely needs hands on the fixture
+};
+
+/**
+ * @brief One knowledge-base entry for an error code
+ */
+struct ErrorInfo {
+    const char* name;       ///< Short name, uppercase, fits the live page
+    const char* action;     ///< Suggested first action for the operator
+    ErrSeverity severity;   ///< Display emphasis
+};
+
+namespace detail {
+
+/// Indexed by err_code. Entry 0 exists so the table is directly indexable;
+/// callers should not render it (err_code 0 means no error).
+inline constexpr ErrorInfo ERROR_TABLE_[] = {
+    /*  0 */ {"NO ERROR",        "",                              ErrSeverity::Info},
+    /*  1 */ {"STALL DETECTED",  "Check fixture for jam",         ErrSeverity::Fault},
+    /*  2 */ {"DRIVER OVERTEMP", "Let driver cool, check airflow", ErrSeverity::Fault},
+    /*  3 */ {"UNDERVOLTAGE",    "Check supply and wiring",       ErrSeverity::Fault},
+    /*  4 */ {"SHORT / OVERCURRENT", "Check motor wiring",        ErrSeverity::Fault},
+    /*  5 */ {"ENCODER FAULT",   "Check encoder cable",           ErrSeverity::Fault},
+    /*  6 */ {"BOUNDS LOST",     "Re-run bounds finding",         ErrSeverity::Warning},
+    /*  7 */ {"MOTION TIMEOUT",  "Check for obstruction",         ErrSeverity::Fault},
+    /*  8 */ {"CONFIG INVALID",  "Review test settings",          ErrSeverity::Warning},
+    /*  9 */ {"EMERGENCY STOP",  "Clear e-stop, restart test",    ErrSeverity::Info},
+};
+
+inline constexpr ErrorInfo UNKNOWN_ERROR_ = {
+    "UNKNOWN ERROR", "See unit logs", ErrSeverity::Fault};
+
+} // namespace detail
+
+/**
+ * @brief Look up the knowledge-base entry for an error code
+ * @param code StatusPayload.err_code (or Error message code byte)
+ * @return Table entry; a generic fallback for codes past the table
+ */
+constexpr const ErrorInfo& LookupError(uint8_t code) noexcept
+{
+    return (code < sizeof(detail::ERROR_TABLE_) / sizeof(detail::ERROR_TABLE_[0]))
+               ? detail::ERROR_TABLE_[code]
+               : detail::UNKNOWN_ERROR_;
+}
+
+} // namespace fatigue_proto
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 
@@ -37,6 +39,7 @@ enum class CommandId : uint8_t {
     Resume = 3,             ///< Resume paused test
     Stop = 4,               ///< Stop test
     RunBoundsFinding = 5,   ///< Run bounds finding (dedicated command)
+    SetStatusRate = 6,      ///< Set status streaming rate (StatusRatePayload)
 };
 
 /**
@@ -72,6 +75,31 @@ struct StatusPayload {
     uint8_t  bounds_valid;                    ///< 1 = bounds reusable, 0 = invalid, 255 = unknown
 };
 
+/**
+ * @brief Status streaming rate request payload (CommandId::SetStatusRate)
+ * @details hold_ms is an optional extension (length-checked like the
+ *          ConfigPayload extended fields): a nonzero value asks the unit to
+ *          fall back to its previous rate by itself after the hold expires,
+ *          so a burst request cannot leave a unit streaming fast if the
+ *          remote that asked for it goes away. The remote also re-sends the
+ *          baseline rate itself; the field is the belt to that suspender.
+ */
+struct StatusRatePayload {
+    uint16_t sample_interval_ms;              ///< Interval between samples (0 = disable batching)
+    uint16_t hold_ms;                         ///< Optional: revert after this long (0 = persistent)
+};
+
+/**
+ * @brief One sample inside a StatusBatch message (wire format)
+ * @details Timestamps are deltas from the batch base timestamp so each
+ *          sample stays at 7 bytes; see ParseStatusBatch for expansion.
+ */
+struct StatusBatchWireSample {
+    uint16_t dt_ms;                           ///< Offset from batch base timestamp (ms)
+    uint32_t cycle_number;                    ///< Cycle number at sample time
+    uint8_t  state;                           ///< Test state (TestState)
+};
+
 /**
  * @brief Bounds finding result payload
  */
@@ -85,12 +113,73 @@ struct BoundsResultPayload {
     float   global_min_degrees;              ///< Global minimum angle (degrees)
     float   global_max_degrees;              ///< Global maximum angle (degrees)
 };
+
+/**
+ * @brief Bounds-search phase reported in BoundsProgress
+ */
+enum class BoundsSearchPhase : uint8_t {
+    SeekingMin = 0,         ///< Sweeping toward the negative limit
+    SeekingMax = 1,         ///< Sweeping toward the positive limit
+    Centering = 2,          ///< Returning to center after the sweep
+};
+
+/**
+ * @brief Live bounds-search progress payload (few Hz while running)
+ * @details Streamed by the unit during bounds finding so multi-minute
+ *          searches are visibly alive on the remote; the authoritative
+ *          outcome still arrives as BoundsResult. min/max so-far are the
+ *          provisional limits touched up to this sample.
+ */
+struct BoundsProgressPayload {
+    uint8_t phase;                           ///< Search phase (BoundsSearchPhase)
+    uint8_t reserved;                        ///< Reserved field
+    float   current_degrees;                 ///< Current armature angle (degrees from center)
+    float   min_so_far_degrees;              ///< Provisional minimum touched so far
+    float   max_so_far_degrees;              ///< Provisional maximum touched so far
+};
 #pragma pack(pop)
 
 static constexpr size_t CONFIG_BASE_SIZE_ = 17;              ///< Base fields size (17 bytes)
 static constexpr size_t CONFIG_EXTENDED_V1_SIZE_ = 33;      ///< Extended v1 size (33 bytes)
 static constexpr size_t CONFIG_EXTENDED_V2_SIZE_ = 34;      ///< Extended v2 size (34 bytes, + SGT)
 static constexpr size_t CONFIG_EXTENDED_SIZE_ = sizeof(ConfigPayload);  ///< Full extended size
+static constexpr size_t CONFIG_EXTENDED_V3_SIZE_ = CONFIG_EXTENDED_V2_SIZE_ + 2;  ///< + config generation
+
+// Config sync (ConfigDelta): both ends keep a 16-bit config generation that
+// the unit bumps every time it applies a change. ConfigResponse v3 appends
+// the current generation, and ConfigAck echoes the new one, so the remote
+// can tell a reconnect with unchanged config from one that needs a resync.
+// A ConfigDelta carries the generation it was diffed against plus a field
+// mask and only the masked values in declaration order, so a single-field
+// tweak is 6 bytes instead of the 34-byte full payload. A unit whose
+// generation does not match the delta's base ignores it and the remote
+// falls back to a full ConfigSet.
+static constexpr uint16_t CFG_FIELD_CYCLE_AMOUNT_ = 1u << 0;   ///< cycle_amount
+static constexpr uint16_t CFG_FIELD_VMAX_ = 1u << 1;           ///< oscillation_vmax_rpm
+static constexpr uint16_t CFG_FIELD_AMAX_ = 1u << 2;           ///< oscillation_amax_rev_s2
+static constexpr uint16_t CFG_FIELD_DWELL_ = 1u << 3;          ///< dwell_time_ms
+static constexpr uint16_t CFG_FIELD_BOUNDS_METHOD_ = 1u << 4;  ///< bounds_method
+static constexpr uint16_t CFG_FIELD_BOUNDS_VEL_ = 1u << 5;     ///< bounds_search_velocity_rpm
+static constexpr uint16_t CFG_FIELD_SG_MIN_VEL_ = 1u << 6;     ///< stallguard_min_velocity_rpm
+static constexpr uint16_t CFG_FIELD_STALL_FACTOR_ = 1u << 7;   ///< stall_detection_current_factor
+static constexpr uint16_t CFG_FIELD_BOUNDS_ACCEL_ = 1u << 8;   ///< bounds_search_accel_rev_s2
+static constexpr uint16_t CFG_FIELD_SGT_ = 1u << 9;            ///< stallguard_sgt
+
+static constexpr size_t CONFIG_DELTA_HEADER_SIZE_ = 4;  ///< base_generation(2) + field_mask(2)
+
+// StatusBatch wire layout: base_timestamp_ms(4) + count(1), then count samples.
+static constexpr size_t STATUS_BATCH_HEADER_SIZE_ = 5;                    ///< Batch header size
+static constexpr size_t STATUS_BATCH_SAMPLE_SIZE_ = 7;                    ///< Per-sample wire size
+static constexpr size_t STATUS_BATCH_MAX_SAMPLES_ = (200 - STATUS_BATCH_HEADER_SIZE_) / STATUS_BATCH_SAMPLE_SIZE_;  ///< 27 samples per packet
+
+/**
+ * @brief One expanded status sample from a StatusBatch message
+ */
+struct StatusSample {
+    uint32_t timestamp_ms;                    ///< Absolute sender timestamp (ms)
+    uint32_t cycle_number;                    ///< Cycle number at sample time
+    uint8_t  state;                           ///< Test state (TestState)
+};
 
 /**
  * @brief Build configuration payload from settings
@@ -114,6 +203,93 @@ inline ConfigPayload BuildConfigPayload(const Settings& settings) noexcept
     return p;
 }
 
+/**
+ * @brief Build a ConfigDelta payload from two config snapshots
+ * @details Emits base_generation + field mask + only the fields that differ
+ *          between @p from and @p to (see the CFG_FIELD_ constants for the
+ *          wire contract). Returns the header size with an empty mask when
+ *          nothing changed; callers can skip the send in that case.
+ * @param from Config the delta is diffed against (last known unit state)
+ * @param to Desired config
+ * @param base_generation Unit config generation @p from corresponds to
+ * @param out Output buffer
+ * @param cap Capacity of @p out (must hold header + all fields)
+ * @return Bytes written, 0 if @p out is too small
+ */
+inline size_t BuildConfigDelta(const ConfigPayload& from, const ConfigPayload& to,
+                               uint16_t base_generation, uint8_t* out, size_t cap) noexcept
+{
+    if (out == nullptr || cap < CONFIG_DELTA_HEADER_SIZE_ + sizeof(ConfigPayload)) {
+        return 0;
+    }
+
+    uint16_t mask = 0;
+    size_t n = CONFIG_DELTA_HEADER_SIZE_;
+    const auto append = [&](uint16_t bit, const void* a, const void* b, size_t size) {
+        if (std::memcmp(a, b, size) != 0) {
+            mask |= bit;
+            std::memcpy(out + n, b, size);
+            n += size;
+        }
+    };
+
+    append(CFG_FIELD_CYCLE_AMOUNT_, &from.cycle_amount, &to.cycle_amount, 4);
+    append(CFG_FIELD_VMAX_, &from.oscillation_vmax_rpm, &to.oscillation_vmax_rpm, 4);
+    append(CFG_FIELD_AMAX_, &from.oscillation_amax_rev_s2, &to.oscillation_amax_rev_s2, 4);
+    append(CFG_FIELD_DWELL_, &from.dwell_time_ms, &to.dwell_time_ms, 4);
+    append(CFG_FIELD_BOUNDS_METHOD_, &from.bounds_method, &to.bounds_method, 1);
+    append(CFG_FIELD_BOUNDS_VEL_, &from.bounds_search_velocity_rpm, &to.bounds_search_velocity_rpm, 4);
+    append(CFG_FIELD_SG_MIN_VEL_, &from.stallguard_min_velocity_rpm, &to.stallguard_min_velocity_rpm, 4);
+    append(CFG_FIELD_STALL_FACTOR_, &from.stall_detection_current_factor, &to.stall_detection_current_factor, 4);
+    append(CFG_FIELD_BOUNDS_ACCEL_, &from.bounds_search_accel_rev_s2, &to.bounds_search_accel_rev_s2, 4);
+    append(CFG_FIELD_SGT_, &from.stallguard_sgt, &to.stallguard_sgt, 1);
+
+    std::memcpy(out, &base_generation, 2);
+    std::memcpy(out + 2, &mask, 2);
+    return n;
+}
+
+// Aligned parse fast path: the pooled receive buffers skew frames by two
+// bytes so every payload starts on a word boundary (see RawMsg), which lets
+// the hot parsers read naturally aligned fields in place instead of
+// memcpy-ing them out one by one. The mirrors below are deliberately NOT
+// packed: their natural layout matches the wire for the spans they cover
+// (static_asserts keep that honest), so a reinterpret_cast of an aligned
+// payload yields plain word loads. Buffers from elsewhere (tests, builders,
+// retransmit copies) fall back to the copying path on the alignment check.
+
+/** @brief True when @p p can be read as naturally aligned 32-bit words */
+inline bool IsWordAligned(const void* p) noexcept
+{
+    return (reinterpret_cast<uintptr_t>(p) & 3u) == 0;
+}
+
+/** @brief Natural-layout mirror of the legacy StatusUpdate wire format */
+struct StatusWireView {
+    uint32_t cycle_number;
+    uint8_t state;
+    uint8_t err_code;
+    uint8_t bounds_valid;
+};
+static_assert(offsetof(StatusWireView, cycle_number) == 0 &&
+              offsetof(StatusWireView, state) == 4 &&
+              offsetof(StatusWireView, err_code) == 5 &&
+              offsetof(StatusWireView, bounds_valid) == 6,
+              "StatusWireView must match the wire layout");
+
+/** @brief Natural-layout mirror of the ConfigPayload base fields (17 bytes) */
+struct ConfigBaseWireView {
+    uint32_t cycle_amount;
+    float oscillation_vmax_rpm;
+    float oscillation_amax_rev_s2;
+    uint32_t dwell_time_ms;
+    uint8_t bounds_method;
+};
+static_assert(offsetof(ConfigBaseWireView, oscillation_vmax_rpm) == 4 &&
+              offsetof(ConfigBaseWireView, dwell_time_ms) == 12 &&
+              offsetof(ConfigBaseWireView, bounds_method) == 16,
+              "ConfigBaseWireView must match the wire layout");
+
 /**
  * @brief Parse status payload from received data
  * @param payload Payload data buffer
@@ -128,6 +304,15 @@ inline bool ParseStatus(const uint8_t* payload, size_t len, StatusPayload& out)
         return false;
     }
 
+    if (IsWordAligned(payload)) {
+        const auto* v = reinterpret_cast<const StatusWireView*>(payload);
+        out.cycle_number = v->cycle_number;
+        out.state = v->state;
+        out.err_code = v->err_code;
+        out.bounds_valid = (len >= 7) ? v->bounds_valid : 255;
+        return true;
+    }
+
     std::memcpy(&out.cycle_number, payload, 4);
     out.state = payload[4];
     out.err_code = payload[5];
@@ -135,6 +320,141 @@ inline bool ParseStatus(const uint8_t* payload, size_t len, StatusPayload& out)
     return true;
 }
 
+// StatusUpdate v2 (protocol version 2 in EspNowHeader): cycle_number is sent
+// as a varint delta from the previous frame instead of a full 4-byte value,
+// with periodic keyframes carrying the absolute count. err_code/bounds_valid
+// ride along only when they change. Typical delta frames are 3 bytes instead
+// of 7, cutting status airtime that competes with command traffic.
+static constexpr uint8_t STATUS_V2_FLAG_KEYFRAME_ = 0x01;  ///< Cycle value is absolute
+static constexpr uint8_t STATUS_V2_FLAG_ERR_ = 0x02;       ///< err_code byte present
+static constexpr uint8_t STATUS_V2_FLAG_BOUNDS_ = 0x04;    ///< bounds_valid byte present
+
+/**
+ * @brief Decode an unsigned LEB128 varint
+ * @param p Read cursor (advanced past the varint on success)
+ * @param end One past the last readable byte
+ * @param out Decoded value
+ * @return true if a complete varint was decoded, false otherwise
+ */
+inline bool DecodeVarint32(const uint8_t*& p, const uint8_t* end, uint32_t& out) noexcept
+{
+    out = 0;
+    for (int shift = 0; shift < 32 && p < end; shift += 7) {
+        const uint8_t byte = *p++;
+        out |= static_cast<uint32_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Per-sender decode context for delta-encoded StatusUpdate v2
+ * @details Delta frames only make sense against the previous frame, so the
+ *          consumer keeps one decoder per sender and resets it whenever the
+ *          connection drops (the next frame must then be a keyframe).
+ */
+struct StatusDecoder {
+    bool have_keyframe = false;  ///< A v2 keyframe (or legacy frame) was seen
+    StatusPayload last{};        ///< Most recently decoded status
+
+    void Reset() noexcept
+    {
+        have_keyframe = false;
+        last = {};
+    }
+};
+
+/**
+ * @brief Parse a StatusUpdate payload, dispatching on the wire version
+ * @details Version 2 payloads are delta-decoded against @p ctx; anything
+ *          else (or a malformed v2 frame) falls back to the legacy 6/7-byte
+ *          layout. Successful legacy parses seed the decoder so a stream may
+ *          switch to deltas at any point.
+ * @param wire_version Protocol version from the packet header
+ * @param payload Payload data buffer
+ * @param len Payload length
+ * @param ctx Per-sender decode context
+ * @param out Output status payload structure
+ * @return true if parsing successful, false otherwise
+ */
+inline bool ParseStatus(uint8_t wire_version, const uint8_t* payload, size_t len,
+                        StatusDecoder& ctx, StatusPayload& out) noexcept
+{
+    if (wire_version >= 2 && payload != nullptr && len >= 2) {
+        const uint8_t* p = payload;
+        const uint8_t* const end = payload + len;
+        const uint8_t flags = *p++;
+
+        uint32_t value = 0;
+        const bool keyframe = (flags & STATUS_V2_FLAG_KEYFRAME_) != 0;
+        if (DecodeVarint32(p, end, value) && (keyframe || ctx.have_keyframe) && p < end) {
+            out.cycle_number = keyframe ? value : (ctx.last.cycle_number + value);
+            out.state = *p++;
+            out.err_code = (flags & STATUS_V2_FLAG_ERR_) != 0 && p < end
+                               ? *p++
+                               : (keyframe ? 0 : ctx.last.err_code);
+            out.bounds_valid = (flags & STATUS_V2_FLAG_BOUNDS_) != 0 && p < end
+                                   ? *p++
+                                   : (keyframe ? 255 : ctx.last.bounds_valid);
+            ctx.have_keyframe = true;
+            ctx.last = out;
+            return true;
+        }
+        // Fall through: treat as a legacy frame from a unit that stamps v2
+        // headers but still sends the fixed layout.
+    }
+
+    if (!ParseStatus(payload, len, out)) {
+        return false;
+    }
+    ctx.have_keyframe = true;
+    ctx.last = out;
+    return true;
+}
+
+/**
+ * @brief Parse a StatusBatch payload into expanded samples
+ * @details Wire format: base_timestamp_ms(4) + count(1), followed by count
+ *          7-byte samples (dt_ms(2) + cycle_number(4) + state(1)). Sample
+ *          timestamps are expanded to base + dt.
+ * @param payload Payload data buffer
+ * @param len Payload length
+ * @param out Output sample array
+ * @param max_out Capacity of @p out
+ * @param count_out Number of samples written
+ * @return true if parsing successful, false otherwise
+ */
+inline bool ParseStatusBatch(const uint8_t* payload, size_t len,
+                             StatusSample* out, size_t max_out, size_t& count_out) noexcept
+{
+    count_out = 0;
+    if (payload == nullptr || out == nullptr || len < STATUS_BATCH_HEADER_SIZE_) {
+        return false;
+    }
+
+    uint32_t base_ms = 0;
+    std::memcpy(&base_ms, payload, 4);
+    const size_t count = payload[4];
+    if (count == 0 || count > STATUS_BATCH_MAX_SAMPLES_ ||
+        len < STATUS_BATCH_HEADER_SIZE_ + count * STATUS_BATCH_SAMPLE_SIZE_) {
+        return false;
+    }
+
+    const size_t n = (count < max_out) ? count : max_out;
+    const uint8_t* p = payload + STATUS_BATCH_HEADER_SIZE_;
+    for (size_t i = 0; i < n; ++i, p += STATUS_BATCH_SAMPLE_SIZE_) {
+        uint16_t dt_ms = 0;
+        std::memcpy(&dt_ms, p, 2);
+        out[i].timestamp_ms = base_ms + dt_ms;
+        std::memcpy(&out[i].cycle_number, p + 2, 4);
+        out[i].state = p[6];
+    }
+    count_out = n;
+    return true;
+}
+
 /**
  * @brief Parse configuration payload from received data
  * @details Supports backward compatibility with base, extended v1, and extended v2 formats
@@ -149,12 +469,24 @@ inline bool ParseConfig(const uint8_t* payload, size_t len, ConfigPayload& out)
         return false;
     }
 
-    // Base fields (17 bytes): cycle_amount(4) + vmax(4) + amax(4) + dwell_ms(4) + bounds_method(1)
-    std::memcpy(&out.cycle_amount, payload, 4);
-    std::memcpy(&out.oscillation_vmax_rpm, payload + 4, 4);
-    std::memcpy(&out.oscillation_amax_rev_s2, payload + 8, 4);
-    std::memcpy(&out.dwell_time_ms, payload + 12, 4);
-    out.bounds_method = payload[16];
+    // Base fields (17 bytes): cycle_amount(4) + vmax(4) + amax(4) + dwell_ms(4) + bounds_method(1).
+    // All word offsets, so an aligned payload reads them in place; the
+    // extended floats start at offset 17 and are misaligned on the wire no
+    // matter what, so they stay on memcpy below.
+    if (IsWordAligned(payload)) {
+        const auto* v = reinterpret_cast<const ConfigBaseWireView*>(payload);
+        out.cycle_amount = v->cycle_amount;
+        out.oscillation_vmax_rpm = v->oscillation_vmax_rpm;
+        out.oscillation_amax_rev_s2 = v->oscillation_amax_rev_s2;
+        out.dwell_time_ms = v->dwell_time_ms;
+        out.bounds_method = v->bounds_method;
+    } else {
+        std::memcpy(&out.cycle_amount, payload, 4);
+        std::memcpy(&out.oscillation_vmax_rpm, payload + 4, 4);
+        std::memcpy(&out.oscillation_amax_rev_s2, payload + 8, 4);
+        std::memcpy(&out.dwell_time_ms, payload + 12, 4);
+        out.bounds_method = payload[16];
+    }
 
     // Defaults for extended bounds finding config
     out.bounds_search_velocity_rpm = 0.0f;
@@ -177,6 +509,79 @@ inline bool ParseConfig(const uint8_t* payload, size_t len, ConfigPayload& out)
     return true;
 }
 
+/**
+ * @brief Parse the config generation from a ConfigResponse or ConfigAck
+ * @details ConfigResponse v3 appends the generation after the v2 fields;
+ *          ConfigAck carries it first (v2 acks append a config CRC32; see
+ *          ParseConfigAckCrc). Older units send neither, in which case this
+ *          returns false and the remote keeps using the full-resync path.
+ * @param payload Payload data buffer
+ * @param len Payload length
+ * @param gen_out Output config generation
+ * @return true if a generation was present, false otherwise
+ */
+inline bool ParseConfigGeneration(const uint8_t* payload, size_t len, uint16_t& gen_out) noexcept
+{
+    if (payload == nullptr) {
+        return false;
+    }
+    if (len == 2 || len == 6) {  // ConfigAck (v2 appends a config CRC32)
+        std::memcpy(&gen_out, payload, 2);
+        return true;
+    }
+    if (len >= CONFIG_EXTENDED_V3_SIZE_) {  // ConfigResponse v3
+        std::memcpy(&gen_out, payload + CONFIG_EXTENDED_V2_SIZE_, 2);
+        return true;
+    }
+    return false;
+}
+
+// Config verification (ConfigAck v2): the unit appends a CRC32 of its
+// now-active ConfigPayload bytes after the generation, and the remote
+// compares it against the CRC of what it pushed (computed at build time).
+// A match confirms the write in one packet; only a mismatch costs the full
+// 34-byte ConfigResponse re-fetch, which also removes the race where a
+// stale in-flight response used to flag phantom mismatches against a
+// just-sent config. Units that send the 2-byte ack stay on the old path.
+static constexpr size_t CONFIG_ACK_CRC_SIZE_ = 6;  ///< generation(2) + crc32(4)
+
+/**
+ * @brief CRC32 of a config payload's wire bytes
+ * @details CRC-32/IEEE, the same polynomial the settings store uses; the
+ *          struct is packed, so its bytes are the ConfigSet wire image.
+ * @param cfg Config payload
+ * @return CRC32 over all of the payload's bytes
+ */
+inline uint32_t ConfigCrc32(const ConfigPayload& cfg) noexcept
+{
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(&cfg);
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < sizeof(cfg); ++i) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            const uint32_t mask = ~((crc & 1u) - 1u) & 0xEDB88320u;
+            crc = (crc >> 1) ^ mask;
+        }
+    }
+    return ~crc;
+}
+
+/**
+ * @brief Parse the config CRC32 from a ConfigAck, when present
+ * @param payload Payload data buffer
+ * @param len Payload length
+ * @param crc_out Output CRC32 of the unit's active config
+ * @return true if the ack carried a CRC (v2), false otherwise
+ */
+inline bool ParseConfigAckCrc(const uint8_t* payload, size_t len, uint32_t& crc_out) noexcept
+{
+    if (payload == nullptr || len != CONFIG_ACK_CRC_SIZE_) {
+        return false;
+    }
+    std::memcpy(&crc_out, payload + 2, 4);
+    return true;
+}
+
 /**
  * @brief Parse bounds result payload from received data
  * @param payload Payload data buffer
@@ -190,6 +595,37 @@ inline bool ParseBoundsResult(const uint8_t* payload, size_t len, BoundsResultPa
         return false;
     }
     std::memcpy(&out, payload, sizeof(BoundsResultPayload));
+    // A frame can pass the CRC and still carry garbage floats (hostile or
+    // corrupted-at-source); NaN/inf here would poison every later angle
+    // computation, so the whole frame is rejected instead.
+    if (!std::isfinite(out.min_degrees_from_center) ||
+        !std::isfinite(out.max_degrees_from_center) ||
+        !std::isfinite(out.global_min_degrees) ||
+        !std::isfinite(out.global_max_degrees)) {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Parse bounds progress payload from received data
+ * @param payload Payload data buffer
+ * @param len Payload length
+ * @param out Output bounds progress payload structure
+ * @return true if parsing successful, false otherwise
+ */
+inline bool ParseBoundsProgress(const uint8_t* payload, size_t len, BoundsProgressPayload& out) noexcept
+{
+    if (payload == nullptr || len < sizeof(BoundsProgressPayload)) {
+        return false;
+    }
+    std::memcpy(&out, payload, sizeof(BoundsProgressPayload));
+    // Same non-finite rejection as ParseBoundsResult.
+    if (!std::isfinite(out.current_degrees) ||
+        !std::isfinite(out.min_so_far_degrees) ||
+        !std::isfinite(out.max_so_far_degrees)) {
+        return false;
+    }
     return true;
 }
 
@@ -0,0 +1,239 @@
+/**
+ * @file wire_capture.cpp
+ * @brief Field traffic capture implementation.
+ */
+
+#include "wire_capture.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#include "esp_log.h"
+#include "nvs.h"
+
+#include "../flash_gov.hpp"
+
+namespace {
+
+constexpr const char* TAG_ = "wirecap";
+
+constexpr const char* NVS_NAMESPACE_ = "m5dial_wc";
+constexpr const char* NVS_KEY_FRAMES_ = "frames";
+constexpr const char* NVS_KEY_ARMED_ = "armed";
+
+constexpr size_t MAX_FRAMES_ = 16;       ///< Stored novel frames
+constexpr size_t ARENA_BYTES_ = 1024;    ///< Shared payload arena
+constexpr size_t MAX_HASHES_ = 128;      ///< Dedup set (stored + dropped)
+constexpr uint32_t PERSIST_MIN_MS_ = 5000;  ///< Flash write rate limit
+
+/// One captured frame; payload lives in the arena
+struct Frame {
+    uint8_t kind;
+    uint8_t len;
+    uint16_t off;
+};
+
+Frame s_frames_[MAX_FRAMES_];
+uint8_t s_arena_[ARENA_BYTES_];
+size_t s_frame_count_ = 0;
+size_t s_arena_used_ = 0;
+
+uint32_t s_hashes_[MAX_HASHES_];
+size_t s_hash_count_ = 0;
+
+bool s_armed_ = false;
+bool s_dirty_ = false;
+uint32_t s_last_persist_ms_ = 0;
+uint32_t s_dropped_ = 0;  ///< Novel frames that no longer fit
+
+/// Vector-file kind names, indexed by Kind.
+constexpr const char* kKindNames_[] = {
+    "status", "status2", "batch", "config", "confgen", "ackcrc",
+    "bounds", "boundsprog",
+};
+
+/// FNV-1a over the kind byte and the payload.
+uint32_t frameHash_(uint8_t kind, const uint8_t* payload, uint8_t len) noexcept
+{
+    uint32_t h = 2166136261u;
+    h = (h ^ kind) * 16777619u;
+    for (uint8_t i = 0; i < len; ++i) {
+        h = (h ^ payload[i]) * 16777619u;
+    }
+    return h;
+}
+
+bool hashSeen_(uint32_t h) noexcept
+{
+    for (size_t i = 0; i < s_hash_count_; ++i) {
+        if (s_hashes_[i] == h) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Persist the store as one blob: count, then (kind, len, bytes) runs
+ */
+void persist_() noexcept
+{
+    uint8_t blob[1 + MAX_FRAMES_ * 2 + ARENA_BYTES_];
+    size_t n = 0;
+    blob[n++] = static_cast<uint8_t>(s_frame_count_);
+    for (size_t i = 0; i < s_frame_count_; ++i) {
+        blob[n++] = s_frames_[i].kind;
+        blob[n++] = s_frames_[i].len;
+        std::memcpy(blob + n, s_arena_ + s_frames_[i].off, s_frames_[i].len);
+        n += s_frames_[i].len;
+    }
+
+    nvs_handle_t h;
+    if (nvs_open(NVS_NAMESPACE_, NVS_READWRITE, &h) != ESP_OK) {
+        return;
+    }
+    if (nvs_set_blob(h, NVS_KEY_FRAMES_, blob, n) == ESP_OK &&
+        nvs_commit(h) == ESP_OK) {
+        s_dirty_ = false;
+    }
+    nvs_close(h);
+}
+
+void load_() noexcept
+{
+    nvs_handle_t h;
+    if (nvs_open(NVS_NAMESPACE_, NVS_READONLY, &h) != ESP_OK) {
+        return;
+    }
+    uint8_t armed = 0;
+    if (nvs_get_u8(h, NVS_KEY_ARMED_, &armed) == ESP_OK) {
+        s_armed_ = armed != 0;
+    }
+    uint8_t blob[1 + MAX_FRAMES_ * 2 + ARENA_BYTES_];
+    size_t len = sizeof(blob);
+    if (nvs_get_blob(h, NVS_KEY_FRAMES_, blob, &len) == ESP_OK && len >= 1) {
+        const size_t count = blob[0];
+        size_t n = 1;
+        for (size_t i = 0; i < count && i < MAX_FRAMES_; ++i) {
+            if (n + 2 > len || n + 2 + blob[n + 1] > len) {
+                break;  // truncated blob; keep what decoded cleanly
+            }
+            const uint8_t kind = blob[n];
+            const uint8_t flen = blob[n + 1];
+            n += 2;
+            s_frames_[s_frame_count_] = {kind, flen,
+                                         static_cast<uint16_t>(s_arena_used_)};
+            std::memcpy(s_arena_ + s_arena_used_, blob + n, flen);
+            s_arena_used_ += flen;
+            n += flen;
+            if (s_hash_count_ < MAX_HASHES_) {
+                s_hashes_[s_hash_count_++] = frameHash_(kind, blob + n - flen, flen);
+            }
+            ++s_frame_count_;
+        }
+    }
+    nvs_close(h);
+}
+
+} // namespace
+
+void wire_capture::Init() noexcept
+{
+    load_();
+    if (s_armed_ || s_frame_count_ > 0) {
+        ESP_LOGI(TAG_, "capture %s, %u frames stored",
+                 s_armed_ ? "armed" : "disarmed",
+                 static_cast<unsigned>(s_frame_count_));
+    }
+}
+
+void wire_capture::Note(Kind kind, const uint8_t* payload, uint8_t len) noexcept
+{
+    if (!s_armed_ || payload == nullptr || len == 0) {
+        return;
+    }
+    const uint32_t h = frameHash_(static_cast<uint8_t>(kind), payload, len);
+    if (hashSeen_(h)) {
+        return;
+    }
+    if (s_hash_count_ >= MAX_HASHES_ || s_frame_count_ >= MAX_FRAMES_ ||
+        s_arena_used_ + len > ARENA_BYTES_) {
+        ++s_dropped_;
+        return;
+    }
+    s_hashes_[s_hash_count_++] = h;
+    s_frames_[s_frame_count_] = {static_cast<uint8_t>(kind), len,
+                                 static_cast<uint16_t>(s_arena_used_)};
+    std::memcpy(s_arena_ + s_arena_used_, payload, len);
+    s_arena_used_ += len;
+    ++s_frame_count_;
+    s_dirty_ = true;
+}
+
+void wire_capture::Service(uint32_t now_ms) noexcept
+{
+    if (!s_dirty_ || now_ms - s_last_persist_ms_ < PERSIST_MIN_MS_) {
+        return;
+    }
+    if (flash_gov::DeferErase()) {
+        return;  // harvested frames keep fine in RAM; retried next pass
+    }
+    s_last_persist_ms_ = now_ms;
+    persist_();
+    flash_gov::NoteErase();
+}
+
+void wire_capture::SetArmed(bool armed) noexcept
+{
+    if (armed == s_armed_) {
+        return;
+    }
+    s_armed_ = armed;
+    nvs_handle_t h;
+    if (nvs_open(NVS_NAMESPACE_, NVS_READWRITE, &h) == ESP_OK) {
+        (void)nvs_set_u8(h, NVS_KEY_ARMED_, armed ? 1 : 0);
+        (void)nvs_commit(h);
+        nvs_close(h);
+    }
+}
+
+bool wire_capture::Armed() noexcept
+{
+    return s_armed_;
+}
+
+void wire_capture::DumpSerial() noexcept
+{
+    printf("# wirecap: %u frames, %u dropped, %s\n",
+           static_cast<unsigned>(s_frame_count_),
+           static_cast<unsigned>(s_dropped_),
+           s_armed_ ? "armed" : "disarmed");
+    for (size_t i = 0; i < s_frame_count_; ++i) {
+        const Frame& f = s_frames_[i];
+        const char* name = (f.kind < sizeof(kKindNames_) / sizeof(kKindNames_[0]))
+                               ? kKindNames_[f.kind]
+                               : "unknown";
+        // Captured frames were accepted by the running parser; the vector
+        // line pins that verdict for every future parser revision.
+        printf("%s ok ", name);
+        for (uint8_t b = 0; b < f.len; ++b) {
+            printf("%02x", s_arena_[f.off + b]);
+        }
+        printf("\n");
+    }
+}
+
+void wire_capture::Clear() noexcept
+{
+    s_frame_count_ = 0;
+    s_arena_used_ = 0;
+    s_hash_count_ = 0;
+    s_dropped_ = 0;
+    s_dirty_ = false;
+    nvs_handle_t h;
+    if (nvs_open(NVS_NAMESPACE_, NVS_READWRITE, &h) == ESP_OK) {
+        (void)nvs_erase_key(h, NVS_KEY_FRAMES_);
+        (void)nvs_commit(h);
+        nvs_close(h);
+    }
+}
@@ -0,0 +1,72 @@
+/**
+ * @file wire_capture.hpp
+ * @brief Field traffic capture for the wire-compatibility conformance suite.
+ * @details The fielded fatigue units do not update on our schedule, so every
+ *          parser change is ultimately judged against the frames they really
+ *          send. When armed (console: `wirecap on`), frames that parse
+ *          successfully are hash-deduplicated and the novel ones appended to
+ *          an NVS-backed store; `wirecap dump` prints them as ready-to-paste
+ *          vector lines for host_tests/vectors/, where conformance_check
+ *          replays them against the host-built parsers on every change. The
+ *          store survives reboots so a capture campaign can span a full
+ *          shift; disarmed (the default), Note() is a single branch.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace wire_capture {
+
+/**
+ * @brief Parser family a captured frame belongs to
+ * @details Names match the vector-file kinds consumed by conformance_check.
+ */
+enum class Kind : uint8_t {
+    Status,      ///< Legacy StatusUpdate (ParseStatus v1 path)
+    StatusV2,    ///< Delta-encoded StatusUpdate (wire version >= 2)
+    Batch,       ///< StatusBatch
+    Config,      ///< ConfigResponse payload (ParseConfig)
+    ConfGen,     ///< Config generation carrier (ParseConfigGeneration)
+    AckCrc,      ///< ConfigAck with CRC (ParseConfigAckCrc)
+    Bounds,      ///< BoundsResult
+    BoundsProg,  ///< BoundsProgress
+};
+
+/**
+ * @brief Load the persisted capture store and armed flag
+ * @details Call once at boot, after NVS is up.
+ */
+void Init() noexcept;
+
+/**
+ * @brief Record one successfully parsed frame (UI task only)
+ * @details Disarmed this is a single branch. Novel frames (FNV-1a over kind
+ *          and bytes) are appended to the RAM store and persisted by the
+ *          next Service() pass; duplicates and frames that no longer fit
+ *          are counted but dropped.
+ * @param kind Parser family the frame was accepted by
+ * @param payload Frame payload bytes
+ * @param len Payload length
+ */
+void Note(Kind kind, const uint8_t* payload, uint8_t len) noexcept;
+
+/**
+ * @brief Persist newly captured frames (rate-limited, UI task only)
+ * @param now_ms Current time in milliseconds
+ */
+void Service(uint32_t now_ms) noexcept;
+
+/// Arm or disarm capture; the flag persists across reboots.
+void SetArmed(bool armed) noexcept;
+
+/// Current armed state.
+bool Armed() noexcept;
+
+/// Print the store as conformance vector lines (console shell).
+void DumpSerial() noexcept;
+
+/// Drop every captured frame and the persisted copy.
+void Clear() noexcept;
+
+} // namespace wire_capture
@@ -0,0 +1,383 @@
+/**
+ * @file provisioning.cpp
+ * @brief Serial provisioning implementation.
+ * @details Frame format (before COBS):
+ *
+ *              0: 'P'            magic
+ *              1: 'V'
+ *              2: version        wire version (bump when struct layouts move)
+ *              3: command
+ *              4: body...
+ *          len-2: CRC16-CCITT    over bytes [0, len-2), little-endian
+ *
+ *          Export/import bodies carry explicit section lengths ahead of the
+ *          raw Settings and SecuritySettings images, so a host talking to
+ *          firmware with different struct sizes gets a clean size-mismatch
+ *          status instead of silently corrupted configuration. Frames are
+ *          0x00 delimited on the wire (COBS guarantees no interior zeros);
+ *          anything between delimiters that fails to decode or checksum is
+ *          dropped, which is what makes sharing the console with log
+ *          output safe.
+ */
+
+#include "provisioning.hpp"
+
+#include "console_shell.hpp"
+#include "input_trace.hpp"
+#include "settings.hpp"
+#include "telemetry_bridge.hpp"
+#include "protocol/espnow_peer_store.hpp"
+#include "protocol/espnow_protocol.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "esp_log.h"
+#include "esp_system.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+namespace {
+
+const char* TAG_ = "provision";
+
+constexpr uint8_t PROTO_VERSION_ = 1;
+
+// Commands (host -> device below 0x80, device -> host above).
+constexpr uint8_t CMD_EXPORT_REQ_ = 0x01;
+constexpr uint8_t CMD_IMPORT_ = 0x02;
+constexpr uint8_t CMD_ITRACE_REQ_ = 0x03;   ///< Export the input trace ring
+constexpr uint8_t CMD_ITRACE_LOAD_ = 0x04;  ///< Load a recorded stream chunk
+constexpr uint8_t CMD_ITRACE_RUN_ = 0x05;   ///< Replay the loaded/recorded ring
+constexpr uint8_t CMD_BRIDGE_ = 0x06;       ///< Arm/disarm the telemetry bridge
+constexpr uint8_t CMD_EXPORT_DATA_ = 0x81;
+constexpr uint8_t CMD_STATUS_ = 0x82;
+constexpr uint8_t CMD_ITRACE_DATA_ = 0x83;  ///< One chunk of trace events
+
+// Status codes carried by CMD_STATUS_.
+constexpr uint8_t ST_OK_ = 0;
+constexpr uint8_t ST_BAD_VERSION_ = 1;
+constexpr uint8_t ST_SIZE_MISMATCH_ = 2;
+constexpr uint8_t ST_MALFORMED_ = 3;
+
+constexpr size_t HEADER_LEN_ = 4;
+constexpr size_t CRC_LEN_ = 2;
+constexpr size_t BODY_MAX_ =
+    2 * sizeof(uint16_t) + sizeof(Settings) + sizeof(SecuritySettings);
+constexpr size_t PAYLOAD_MAX_ = HEADER_LEN_ + BODY_MAX_ + CRC_LEN_;
+// COBS adds one byte per 254; round generously.
+constexpr size_t WIRE_MAX_ = PAYLOAD_MAX_ + PAYLOAD_MAX_ / 254 + 2;
+
+constexpr uint32_t POLL_IDLE_MS_ = 100;
+constexpr uint32_t TASK_STACK_ = 4096;
+constexpr UBaseType_t TASK_PRIO_ = 2;
+
+// Static working buffers: frames are far too large for a 4 KB task stack
+// once SecuritySettings is in the body, and only this task touches them.
+uint8_t s_wire_[WIRE_MAX_];
+uint8_t s_payload_[PAYLOAD_MAX_];
+uint8_t s_tx_payload_[PAYLOAD_MAX_];
+uint8_t s_tx_wire_[WIRE_MAX_];
+
+/** @brief COBS-encode @p len bytes; returns the encoded length. */
+size_t cobsEncode(const uint8_t* src, size_t len, uint8_t* dst) noexcept
+{
+    size_t out = 1;
+    size_t code_pos = 0;
+    uint8_t code = 1;
+    for (size_t i = 0; i < len; ++i) {
+        if (src[i] == 0) {
+            dst[code_pos] = code;
+            code_pos = out++;
+            code = 1;
+        } else {
+            dst[out++] = src[i];
+            if (++code == 0xFF) {
+                dst[code_pos] = code;
+                code_pos = out++;
+                code = 1;
+            }
+        }
+    }
+    dst[code_pos] = code;
+    return out;
+}
+
+/** @brief COBS-decode @p len bytes; returns the decoded length, 0 on error. */
+size_t cobsDecode(const uint8_t* src, size_t len, uint8_t* dst) noexcept
+{
+    size_t out = 0;
+    size_t i = 0;
+    while (i < len) {
+        const uint8_t code = src[i++];
+        if (code == 0 || i + code - 1 > len) {
+            return 0;
+        }
+        for (uint8_t j = 1; j < code; ++j) {
+            dst[out++] = src[i++];
+        }
+        if (code != 0xFF && i < len) {
+            dst[out++] = 0;
+        }
+    }
+    return out;
+}
+
+/** @brief Frame, checksum, COBS-encode and emit one message on stdout. */
+void sendFrame(uint8_t cmd, const uint8_t* body, size_t body_len) noexcept
+{
+    s_tx_payload_[0] = 'P';
+    s_tx_payload_[1] = 'V';
+    s_tx_payload_[2] = PROTO_VERSION_;
+    s_tx_payload_[3] = cmd;
+    if (body_len > 0) {
+        memcpy(s_tx_payload_ + HEADER_LEN_, body, body_len);
+    }
+    const size_t crc_at = HEADER_LEN_ + body_len;
+    const uint16_t crc = espnow::crc16_ccitt(s_tx_payload_, crc_at);
+    memcpy(s_tx_payload_ + crc_at, &crc, sizeof(crc));
+
+    const size_t wire_len = cobsEncode(s_tx_payload_, crc_at + CRC_LEN_, s_tx_wire_);
+    putchar(0);
+    fwrite(s_tx_wire_, 1, wire_len, stdout);
+    putchar(0);
+    fflush(stdout);
+}
+
+void sendStatus(uint8_t code) noexcept
+{
+    sendFrame(CMD_STATUS_, &code, 1);
+}
+
+void handleExport() noexcept
+{
+    uint8_t body[BODY_MAX_];
+    const uint16_t slen = sizeof(Settings);
+    const uint16_t qlen = sizeof(SecuritySettings);
+    memcpy(body, &slen, 2);
+    memcpy(body + 2, &qlen, 2);
+
+    // Persisted sections for the parameters, live copy for the peer table
+    // (it carries any pairing done this session).
+    const Settings settings = SettingsStore::Load();
+    memcpy(body + 4, &settings, sizeof(settings));
+    memcpy(body + 4 + sizeof(settings), &espnow::GetSecuritySettings(),
+           sizeof(SecuritySettings));
+
+    sendFrame(CMD_EXPORT_DATA_, body, 4 + slen + qlen);
+    ESP_LOGI(TAG_, "Configuration exported (%u + %u bytes)",
+             static_cast<unsigned>(slen), static_cast<unsigned>(qlen));
+}
+
+void handleImport(const uint8_t* body, size_t body_len) noexcept
+{
+    if (body_len < 4) {
+        sendStatus(ST_MALFORMED_);
+        return;
+    }
+    uint16_t slen = 0;
+    uint16_t qlen = 0;
+    memcpy(&slen, body, 2);
+    memcpy(&qlen, body + 2, 2);
+    if (slen != sizeof(Settings) || qlen != sizeof(SecuritySettings) ||
+        body_len != 4u + slen + qlen) {
+        ESP_LOGW(TAG_, "Import size mismatch (%u/%u vs %u/%u)",
+                 static_cast<unsigned>(slen), static_cast<unsigned>(qlen),
+                 static_cast<unsigned>(sizeof(Settings)),
+                 static_cast<unsigned>(sizeof(SecuritySettings)));
+        sendStatus(ST_SIZE_MISMATCH_);
+        return;
+    }
+
+    Settings settings{};
+    SecuritySettings sec{};
+    memcpy(&settings, body + 4, sizeof(settings));
+    memcpy(&sec, body + 4 + sizeof(settings), sizeof(sec));
+
+    // Commit through the existing writer paths so these saves serialize
+    // with anything the UI has in flight, then flush synchronously - the
+    // reboot below must not outrun the NVS commit.
+    SettingsStore::SaveAsync(settings);
+    SettingsStore::Flush();
+    PeerStore::SaveAsync(sec);
+    PeerStore::Flush();
+
+    sendStatus(ST_OK_);
+    ESP_LOGI(TAG_, "Configuration imported; rebooting to apply");
+    fflush(stdout);
+    vTaskDelay(pdMS_TO_TICKS(250));
+    esp_restart();
+}
+
+// Input trace export/replay. Chunked: the full ring is an order of
+// magnitude larger than a settings frame, so events travel in bursts of
+// ITRACE_CHUNK_ with a running offset; a chunk with count 0 is the end
+// marker. Load goes the other way with the same chunking (offset 0
+// clears the ring first), and run takes a single speed byte.
+constexpr size_t ITRACE_CHUNK_ = 20;
+
+void handleItraceExport() noexcept
+{
+    static input_trace::Event events[input_trace::CAPACITY];
+    const size_t total = input_trace::Snapshot(events, input_trace::CAPACITY);
+
+    uint8_t body[2 + 1 + ITRACE_CHUNK_ * sizeof(input_trace::Event)];
+    for (size_t off = 0; off < total; off += ITRACE_CHUNK_) {
+        const size_t n = ((total - off) < ITRACE_CHUNK_) ? (total - off) : ITRACE_CHUNK_;
+        const uint16_t off16 = static_cast<uint16_t>(off);
+        memcpy(body, &off16, 2);
+        body[2] = static_cast<uint8_t>(n);
+        memcpy(body + 3, events + off, n * sizeof(input_trace::Event));
+        sendFrame(CMD_ITRACE_DATA_, body, 3 + n * sizeof(input_trace::Event));
+    }
+    const uint16_t end16 = static_cast<uint16_t>(total);
+    memcpy(body, &end16, 2);
+    body[2] = 0;
+    sendFrame(CMD_ITRACE_DATA_, body, 3);
+    ESP_LOGI(TAG_, "Input trace exported (%u events)", static_cast<unsigned>(total));
+}
+
+void handleItraceLoad(const uint8_t* body, size_t body_len) noexcept
+{
+    if (body_len < 3) {
+        sendStatus(ST_MALFORMED_);
+        return;
+    }
+    uint16_t off = 0;
+    memcpy(&off, body, 2);
+    const size_t n = body[2];
+    if (body_len != 3 + n * sizeof(input_trace::Event) || n > ITRACE_CHUNK_) {
+        sendStatus(ST_MALFORMED_);
+        return;
+    }
+    if (off == 0) {
+        input_trace::LoadBegin();
+    }
+    input_trace::Event events[ITRACE_CHUNK_];
+    memcpy(events, body + 3, n * sizeof(input_trace::Event));
+    sendStatus(input_trace::LoadAppend(events, n) ? ST_OK_ : ST_SIZE_MISMATCH_);
+}
+
+void handleItraceRun(const uint8_t* body, size_t body_len) noexcept
+{
+    const uint8_t speed = (body_len >= 1) ? body[0] : 1;
+    sendStatus(input_trace::StartReplay(speed) ? ST_OK_ : ST_MALFORMED_);
+}
+
+void handlePayload(const uint8_t* payload, size_t len) noexcept
+{
+    if (len < HEADER_LEN_ + CRC_LEN_ || payload[0] != 'P' || payload[1] != 'V') {
+        return;  // Console noise between delimiters; not ours
+    }
+    uint16_t crc_rx = 0;
+    memcpy(&crc_rx, payload + len - CRC_LEN_, sizeof(crc_rx));
+    if (espnow::crc16_ccitt(payload, len - CRC_LEN_) != crc_rx) {
+        ESP_LOGW(TAG_, "Frame CRC mismatch");
+        return;
+    }
+    if (payload[2] != PROTO_VERSION_) {
+        sendStatus(ST_BAD_VERSION_);
+        return;
+    }
+
+    const uint8_t* body = payload + HEADER_LEN_;
+    const size_t body_len = len - HEADER_LEN_ - CRC_LEN_;
+    switch (payload[3]) {
+        case CMD_EXPORT_REQ_:
+            handleExport();
+            break;
+        case CMD_IMPORT_:
+            handleImport(body, body_len);
+            break;
+        case CMD_ITRACE_REQ_:
+            handleItraceExport();
+            break;
+        case CMD_ITRACE_LOAD_:
+            handleItraceLoad(body, body_len);
+            break;
+        case CMD_ITRACE_RUN_:
+            handleItraceRun(body, body_len);
+            break;
+        case CMD_BRIDGE_:
+            // Body is one byte: nonzero arms the telemetry stream. The
+            // bridge emits on its own task; this listener only flips it.
+            if (body_len >= 1) {
+                telemetry_bridge::SetActive(body[0] != 0);
+                sendStatus(ST_OK_);
+            } else {
+                sendStatus(ST_MALFORMED_);
+            }
+            break;
+        default:
+            sendStatus(ST_MALFORMED_);
+            break;
+    }
+}
+
+/**
+ * @brief Listener task: route console bytes to frames or the shell
+ * @details stdin is non-blocking; with no traffic the task wakes every
+ *          POLL_IDLE_MS_, reads nothing, and sleeps again. A 0x00 byte
+ *          opens a COBS frame and the next 0x00 closes it (host tools
+ *          bracket every frame, matching sendFrame); everything typed
+ *          outside a frame is plain text and feeds the diagnostics shell,
+ *          whose handlers run on this same low-priority task.
+ */
+void provisioningTask(void* arg) noexcept
+{
+    (void)arg;
+    size_t fill = 0;
+    bool in_frame = false;
+    while (true) {
+        uint8_t byte = 0;
+        const ssize_t n = read(STDIN_FILENO, &byte, 1);
+        if (n != 1) {
+            vTaskDelay(pdMS_TO_TICKS(POLL_IDLE_MS_));
+            continue;
+        }
+        if (byte == 0) {
+            if (in_frame && fill > 0) {
+                const size_t decoded = cobsDecode(s_wire_, fill, s_payload_);
+                if (decoded > 0) {
+                    handlePayload(s_payload_, decoded);
+                }
+                in_frame = false;  // Closed; the next frame opens with its own 0x00
+            } else {
+                in_frame = true;
+            }
+            fill = 0;
+            continue;
+        }
+        if (in_frame) {
+            if (fill < sizeof(s_wire_)) {
+                s_wire_[fill++] = byte;
+            } else {
+                in_frame = false;  // Oversized garbage; resync on the next delimiter
+                fill = 0;
+            }
+            continue;
+        }
+        console_shell::FeedByte(byte);
+    }
+}
+
+} // namespace
+
+void provisioning::Init() noexcept
+{
+    // Non-blocking console reads; the VFS console supports O_NONBLOCK on
+    // both the UART and USB-Serial-JTAG backends.
+    const int flags = fcntl(STDIN_FILENO, F_GETFL, 0);
+    if (flags >= 0) {
+        (void)fcntl(STDIN_FILENO, F_SETFL, flags | O_NONBLOCK);
+    }
+
+    if (xTaskCreate(provisioningTask, "provision", TASK_STACK_, nullptr,
+                    TASK_PRIO_, nullptr) != pdPASS) {
+        ESP_LOGW(TAG_, "Task create failed; serial provisioning unavailable");
+        return;
+    }
+    ESP_LOGI(TAG_, "Serial provisioning listening");
+}
@@ -0,0 +1,29 @@
+/**
+ * @file provisioning.hpp
+ * @brief Serial provisioning: settings export/import over USB CDC.
+ * @details Cloning a configured remote onto a fresh one used to mean
+ *          thumbing every value through the dial editor. This module speaks
+ *          a small binary protocol on the USB console instead: 0x00
+ *          delimited COBS frames carrying Settings plus SecuritySettings
+ *          with a CRC16-CCITT trailer, driven by scripts/provision.py on
+ *          the host. Export snapshots the persisted + live configuration;
+ *          import commits through the existing NVS writer paths and
+ *          reboots so the new configuration is what boots up. The listener
+ *          is a low-priority task polling stdin a few times a second -
+ *          idle cost is noise, and log output interleaves harmlessly
+ *          because the host only trusts frames that COBS-decode and pass
+ *          the CRC.
+ */
+
+#pragma once
+
+namespace provisioning {
+
+/**
+ * @brief Start the serial provisioning listener task
+ * @details Call once after NVS is up. Failure to start only costs the
+ *          provisioning feature; the firmware runs on regardless.
+ */
+void Init() noexcept;
+
+} // namespace provisioning
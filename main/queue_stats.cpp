@@ -0,0 +1,126 @@
+/**
+ * @file queue_stats.cpp
+ * @brief FreeRTOS queue observability implementation.
+ */
+
+#include "queue_stats.hpp"
+
+#include <cstdio>
+
+#include "esp_timer.h"
+
+namespace {
+
+/// Between depth samples. Coarse on purpose: the high-water mark wants
+/// sustained pressure, not every transient burst, and uxQueueMessagesWaiting
+/// takes a critical section per queue.
+constexpr uint32_t SAMPLE_PERIOD_MS_ = 1000;
+
+struct Slot {
+    QueueHandle_t queue;
+    const char* name;
+    uint16_t capacity;
+    uint16_t high_water;
+    uint32_t drops;
+};
+
+// Registrations happen once each during startup from task context; after
+// that the array is append-only and reads race only against counter
+// increments, which are single-word. No lock needed.
+Slot s_slots_[queue_stats::MAX_QUEUES]{};
+size_t s_count_ = 0;
+uint32_t s_last_sample_ms_ = 0;
+
+}  // namespace
+
+int8_t queue_stats::Register(QueueHandle_t queue, const char* name, uint16_t capacity) noexcept
+{
+    if (queue == nullptr || s_count_ >= MAX_QUEUES) {
+        return -1;
+    }
+    Slot& s = s_slots_[s_count_];
+    s.queue = queue;
+    s.name = name;
+    s.capacity = capacity;
+    s.high_water = 0;
+    s.drops = 0;
+    return static_cast<int8_t>(s_count_++);
+}
+
+void queue_stats::NoteDrop(int8_t slot) noexcept
+{
+    if (slot >= 0 && static_cast<size_t>(slot) < s_count_) {
+        ++s_slots_[slot].drops;
+    }
+}
+
+int8_t queue_stats::SlotFor(QueueHandle_t queue) noexcept
+{
+    for (size_t i = 0; i < s_count_; ++i) {
+        if (s_slots_[i].queue == queue) {
+            return static_cast<int8_t>(i);
+        }
+    }
+    return -1;
+}
+
+void queue_stats::Sample() noexcept
+{
+    const uint32_t now_ms = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+    if (s_last_sample_ms_ != 0 && (now_ms - s_last_sample_ms_) < SAMPLE_PERIOD_MS_) {
+        return;
+    }
+    s_last_sample_ms_ = now_ms;
+    for (size_t i = 0; i < s_count_; ++i) {
+        const UBaseType_t depth = uxQueueMessagesWaiting(s_slots_[i].queue);
+        if (depth > s_slots_[i].high_water) {
+            s_slots_[i].high_water = static_cast<uint16_t>(depth);
+        }
+    }
+}
+
+size_t queue_stats::Count() noexcept
+{
+    return s_count_;
+}
+
+bool queue_stats::Get(size_t index, Stats& out) noexcept
+{
+    if (index >= s_count_) {
+        return false;
+    }
+    const Slot& s = s_slots_[index];
+    out.name = s.name;
+    out.capacity = s.capacity;
+    out.high_water = s.high_water;
+    out.drops = s.drops;
+    return true;
+}
+
+uint32_t queue_stats::TotalDrops() noexcept
+{
+    uint32_t total = 0;
+    for (size_t i = 0; i < s_count_; ++i) {
+        total += s_slots_[i].drops;
+    }
+    return total;
+}
+
+void queue_stats::Reset() noexcept
+{
+    for (size_t i = 0; i < s_count_; ++i) {
+        s_slots_[i].high_water = 0;
+        s_slots_[i].drops = 0;
+    }
+}
+
+void queue_stats::DumpSerial() noexcept
+{
+    printf("queue_stats: %u queues\r\n", static_cast<unsigned>(s_count_));
+    printf("name,capacity,high_water,drops\r\n");
+    for (size_t i = 0; i < s_count_; ++i) {
+        const Slot& s = s_slots_[i];
+        printf("%s,%u,%u,%lu\r\n", s.name, static_cast<unsigned>(s.capacity),
+               static_cast<unsigned>(s.high_water), static_cast<unsigned long>(s.drops));
+    }
+}
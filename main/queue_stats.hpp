@@ -0,0 +1,94 @@
+/**
+ * @file queue_stats.hpp
+ * @brief FreeRTOS queue observability: depth high-water marks and drops.
+ * @details Queue depths in this firmware are folklore - 10 proto events,
+ *          10 raw receive buffers, 8 beeps - and an overflow is silent:
+ *          the send just fails and the message is gone. Each interesting
+ *          queue registers here at creation; a periodic sample records
+ *          the deepest occupancy ever seen and the owning module counts
+ *          every failed send. With the numbers in hand, oversized queues
+ *          can be shrunk (RAM back) and ones that actually drop under
+ *          load grown, with evidence instead of guesses. Surfaced as a
+ *          drop total on the diagnostics page and a full table in the
+ *          PERF serial dump.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+namespace queue_stats {
+
+/// Registry capacity; registration past this is refused (and harmless).
+constexpr size_t MAX_QUEUES = 10;
+
+/**
+ * @brief Counters for one registered queue (see Get)
+ */
+struct Stats {
+    const char* name;     ///< Short label given at registration
+    uint16_t capacity;    ///< Queue length it was created with
+    uint16_t high_water;  ///< Deepest sampled occupancy
+    uint32_t drops;       ///< Failed sends counted by the owner
+};
+
+/**
+ * @brief Register a queue for depth sampling
+ * @details Call once right after xQueueCreate, from task context. The
+ *          name must be a string literal (stored by pointer).
+ * @param queue Queue handle
+ * @param name Short label for dumps ("proto", "rawrx", ...)
+ * @param capacity Length the queue was created with
+ * @return Registry slot for NoteDrop, or -1 when full / queue null
+ */
+int8_t Register(QueueHandle_t queue, const char* name, uint16_t capacity) noexcept;
+
+/**
+ * @brief Count one failed send on a registered queue
+ * @details A plain counter increment: safe from ISRs and any task. A
+ *          slot of -1 (registration failed) is ignored.
+ */
+void NoteDrop(int8_t slot) noexcept;
+
+/**
+ * @brief Registry slot for an already-registered handle, or -1
+ * @details For owners that receive the queue from elsewhere (the proto
+ *          event queue is created in main and handed to the protocol
+ *          layer). Linear scan; cache the result.
+ */
+int8_t SlotFor(QueueHandle_t queue) noexcept;
+
+/**
+ * @brief Sample current depths into the high-water marks
+ * @details Self-throttled to once a second; call from any periodic task
+ *          loop (the UI housekeeping tick does).
+ */
+void Sample() noexcept;
+
+/// Number of registered queues
+size_t Count() noexcept;
+
+/**
+ * @brief Read one registered queue's counters
+ * @return true if @p index is a registered slot
+ */
+bool Get(size_t index, Stats& out) noexcept;
+
+/// Sum of drops across all registered queues
+uint32_t TotalDrops() noexcept;
+
+/**
+ * @brief Clear high-water marks and drop counters (registrations stay)
+ */
+void Reset() noexcept;
+
+/**
+ * @brief Print the registry as a table on the serial console
+ */
+void DumpSerial() noexcept;
+
+}  // namespace queue_stats
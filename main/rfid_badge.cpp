@@ -0,0 +1,381 @@
+/**
+ * @file rfid_badge.cpp
+ * @brief Operator badge reader implementation.
+ * @details Talks to the M5Dial's WS1850S (MFRC522 register compatible) over
+ *          the internal I2C bus via M5Unified. The stock M5Dial component
+ *          ships an Arduino-style polling driver for this chip; this module
+ *          replaces it with an event-driven one: every transceive arms the
+ *          chip's 25 ms timeout timer and the task sleeps until the IRQ
+ *          line fires (when routed) or the timeout lapses, so there is no
+ *          busy-wait anywhere. ISO 14443A is implemented only as far as
+ *          badge attribution needs: REQA, anticollision cascade levels 1-2,
+ *          and the SELECT needed to climb a cascade.
+ */
+
+#include "rfid_badge.hpp"
+
+#include "config.hpp"
+#include "protocol/espnow_protocol.hpp"
+
+#include <cstring>
+
+#include "M5Unified.h"
+#include "driver/gpio.h"
+#include "esp_log.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+namespace {
+
+const char* TAG_ = "rfid";
+
+constexpr uint8_t I2C_ADDR_ = 0x28;       ///< WS1850S fixed address
+constexpr uint32_t I2C_FREQ_ = 400000;
+
+// MFRC522 register map (datasheet section 9; I2C uses raw addresses).
+constexpr uint8_t REG_COMMAND_ = 0x01;
+constexpr uint8_t REG_COM_IEN_ = 0x02;
+constexpr uint8_t REG_COM_IRQ_ = 0x04;
+constexpr uint8_t REG_ERROR_ = 0x06;
+constexpr uint8_t REG_FIFO_DATA_ = 0x09;
+constexpr uint8_t REG_FIFO_LEVEL_ = 0x0A;
+constexpr uint8_t REG_CONTROL_ = 0x0C;
+constexpr uint8_t REG_BIT_FRAMING_ = 0x0D;
+constexpr uint8_t REG_COLL_ = 0x0E;
+constexpr uint8_t REG_MODE_ = 0x11;
+constexpr uint8_t REG_TX_MODE_ = 0x12;
+constexpr uint8_t REG_RX_MODE_ = 0x13;
+constexpr uint8_t REG_TX_CONTROL_ = 0x14;
+constexpr uint8_t REG_TX_ASK_ = 0x15;
+constexpr uint8_t REG_TMODE_ = 0x2A;
+constexpr uint8_t REG_TPRESCALER_ = 0x2B;
+constexpr uint8_t REG_TRELOAD_H_ = 0x2C;
+constexpr uint8_t REG_TRELOAD_L_ = 0x2D;
+constexpr uint8_t REG_VERSION_ = 0x37;
+
+constexpr uint8_t CMD_IDLE_ = 0x00;
+constexpr uint8_t CMD_TRANSCEIVE_ = 0x0C;
+constexpr uint8_t CMD_SOFT_RESET_ = 0x0F;
+
+constexpr uint8_t PICC_REQA_ = 0x26;      ///< 7-bit short frame
+constexpr uint8_t PICC_SEL_CL1_ = 0x93;
+constexpr uint8_t PICC_SEL_CL2_ = 0x95;
+constexpr uint8_t PICC_CASCADE_TAG_ = 0x88;
+
+constexpr uint32_t SCAN_PERIOD_MS_ = 250;   ///< Idle REQA cadence
+constexpr uint32_t REARM_HOLD_MS_ = 2000;   ///< Same badge held = one event
+constexpr uint32_t TASK_STACK_ = 3072;
+constexpr UBaseType_t TASK_PRIO_ = 2;       ///< Below render (4) and radio (5)
+
+QueueHandle_t s_event_queue_ = nullptr;
+SemaphoreHandle_t s_irq_sem_ = nullptr;     ///< Given by the IRQ pin ISR
+bool s_irq_wired_ = false;
+
+SemaphoreHandle_t s_badge_mutex_ = nullptr;
+uint8_t s_badge_uid_[rfid::MAX_UID_LEN] = {};
+uint8_t s_badge_len_ = 0;
+
+uint8_t rdReg(uint8_t reg) noexcept
+{
+    return m5::In_I2C.readRegister8(I2C_ADDR_, reg, I2C_FREQ_);
+}
+
+void wrReg(uint8_t reg, uint8_t val) noexcept
+{
+    (void)m5::In_I2C.writeRegister8(I2C_ADDR_, reg, val, I2C_FREQ_);
+}
+
+void setRegBits(uint8_t reg, uint8_t mask) noexcept
+{
+    wrReg(reg, rdReg(reg) | mask);
+}
+
+void IRAM_ATTR irqIsr(void* arg) noexcept
+{
+    (void)arg;
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(s_irq_sem_, &woken);
+    if (woken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+/**
+ * @brief Block until the chip raises an interrupt or its timer lapses
+ * @details With the IRQ line wired this is a true event wait; without it
+ *          the task sleeps one tick per check, which at the 25 ms chip
+ *          timeout costs at most a few wakeups - never a spin.
+ */
+bool waitIrq(uint8_t wait_mask) noexcept
+{
+    const TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(40);
+    while (true) {
+        const uint8_t irq = rdReg(REG_COM_IRQ_);
+        if (irq & wait_mask) {
+            return true;
+        }
+        if (irq & 0x01) {
+            return false;  // TimerIRq: 25 ms RF timeout, no card answered
+        }
+        if (xTaskGetTickCount() >= deadline) {
+            return false;  // I2C glitch safety net
+        }
+        if (s_irq_wired_) {
+            (void)xSemaphoreTake(s_irq_sem_, pdMS_TO_TICKS(10));
+        } else {
+            vTaskDelay(1);
+        }
+    }
+}
+
+/**
+ * @brief One transceive: frame out over the RF field, response into @p rx
+ * @param tx Frame bytes
+ * @param tx_len Frame length
+ * @param tx_last_bits Bits of the final byte to send (0 = all 8; REQA is 7)
+ * @param rx Response buffer
+ * @param rx_len In: capacity, out: bytes received
+ * @return true on a clean exchange (no timeout, no protocol/collision error)
+ */
+bool transceive(const uint8_t* tx, size_t tx_len, uint8_t tx_last_bits,
+                uint8_t* rx, size_t& rx_len) noexcept
+{
+    wrReg(REG_COMMAND_, CMD_IDLE_);
+    wrReg(REG_COM_IRQ_, 0x7F);              // Clear all interrupt flags
+    wrReg(REG_FIFO_LEVEL_, 0x80);           // Flush FIFO
+    for (size_t i = 0; i < tx_len; ++i) {
+        wrReg(REG_FIFO_DATA_, tx[i]);
+    }
+    wrReg(REG_COMMAND_, CMD_TRANSCEIVE_);
+    wrReg(REG_BIT_FRAMING_, static_cast<uint8_t>(0x80 | (tx_last_bits & 0x07)));
+
+    // RxIRq (0x20) or IdleIRq (0x10) ends the exchange.
+    const bool ok = waitIrq(0x30);
+    wrReg(REG_BIT_FRAMING_, 0x00);
+    if (!ok) {
+        return false;
+    }
+    if (rdReg(REG_ERROR_) & 0x13) {         // BufferOvfl | ParityErr | ProtocolErr
+        return false;
+    }
+
+    size_t n = rdReg(REG_FIFO_LEVEL_);
+    if (n > rx_len) {
+        n = rx_len;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        rx[i] = rdReg(REG_FIFO_DATA_);
+    }
+    rx_len = n;
+    return true;
+}
+
+/** @brief Is a card in the field? (REQA short frame, 7 bits.) */
+bool requestA() noexcept
+{
+    uint8_t atqa[2];
+    size_t n = sizeof(atqa);
+    const uint8_t reqa = PICC_REQA_;
+    return transceive(&reqa, 1, 7, atqa, n) && n == 2;
+}
+
+/** @brief Anticollision for one cascade level: 5 bytes (uid x4 + BCC). */
+bool anticollision(uint8_t sel, uint8_t out[5]) noexcept
+{
+    const uint8_t frame[2] = { sel, 0x20 };
+    size_t n = 5;
+    if (!transceive(frame, 2, 0, out, n) || n != 5) {
+        return false;
+    }
+    return (out[0] ^ out[1] ^ out[2] ^ out[3]) == out[4];  // BCC check
+}
+
+/**
+ * @brief SELECT a fully-known cascade level so the next level answers
+ * @details SELECT frames carry CRC_A, so the chip's CRC generators are
+ *          switched on for this exchange only; everything else in the
+ *          anticollision phase runs CRC-less per ISO 14443-3.
+ */
+bool selectLevel(uint8_t sel, const uint8_t uid_bcc[5], uint8_t& sak_out) noexcept
+{
+    uint8_t frame[7] = { sel, 0x70, uid_bcc[0], uid_bcc[1], uid_bcc[2], uid_bcc[3], uid_bcc[4] };
+    uint8_t rx[3];
+    size_t n = sizeof(rx);
+    wrReg(REG_TX_MODE_, 0x80);
+    wrReg(REG_RX_MODE_, 0x80);
+    const bool ok = transceive(frame, sizeof(frame), 0, rx, n) && n >= 1;
+    wrReg(REG_TX_MODE_, 0x00);
+    wrReg(REG_RX_MODE_, 0x00);
+    if (ok) {
+        sak_out = rx[0];
+    }
+    return ok;
+}
+
+/**
+ * @brief Read the UID of the card currently answering REQA
+ * @param uid_out Receives 4 or 7 UID bytes
+ * @param len_out Receives the UID length
+ */
+bool readUid(uint8_t uid_out[rfid::MAX_UID_LEN], uint8_t& len_out) noexcept
+{
+    uint8_t cl1[5];
+    if (!anticollision(PICC_SEL_CL1_, cl1)) {
+        return false;
+    }
+    if (cl1[0] != PICC_CASCADE_TAG_) {
+        memcpy(uid_out, cl1, 4);
+        len_out = 4;
+        return true;
+    }
+    // Double-size UID: finish level 1, then level 2 carries bytes 3..6.
+    uint8_t sak = 0;
+    if (!selectLevel(PICC_SEL_CL1_, cl1, sak) || !(sak & 0x04)) {
+        return false;
+    }
+    uint8_t cl2[5];
+    if (!anticollision(PICC_SEL_CL2_, cl2)) {
+        return false;
+    }
+    memcpy(uid_out, cl1 + 1, 3);
+    memcpy(uid_out + 3, cl2, 4);
+    len_out = 7;
+    return true;
+}
+
+/** @brief Post a BadgeScan event; UID travels via GetCurrentBadge(). */
+void postBadgeEvent(const uint8_t* uid, uint8_t len) noexcept
+{
+    if (s_event_queue_ == nullptr) {
+        return;
+    }
+    espnow::ProtoEvent evt{};
+    evt.type = espnow::MsgType::BadgeScan;
+    evt.sequence_id = len;
+    memcpy(evt.src_mac, uid, len < 6 ? len : 6);
+    (void)xQueueSend(s_event_queue_, &evt, 0);
+}
+
+/**
+ * @brief Badge task: one REQA poll per period, event wait in between
+ * @details A badge left sitting on the reader re-answers every poll;
+ *          REARM_HOLD_MS_ collapses that into a single scan event until
+ *          the badge leaves the field for a couple of periods.
+ */
+void badgeTask(void* arg) noexcept
+{
+    (void)arg;
+    uint8_t last_uid[rfid::MAX_UID_LEN] = {};
+    uint8_t last_len = 0;
+    TickType_t last_seen_tick = 0;
+
+    while (true) {
+        vTaskDelay(pdMS_TO_TICKS(SCAN_PERIOD_MS_));
+
+        if (!requestA()) {
+            continue;
+        }
+        uint8_t uid[rfid::MAX_UID_LEN] = {};
+        uint8_t len = 0;
+        if (!readUid(uid, len)) {
+            continue;
+        }
+
+        const TickType_t now = xTaskGetTickCount();
+        const bool same = (len == last_len) && memcmp(uid, last_uid, len) == 0;
+        if (same && now - last_seen_tick < pdMS_TO_TICKS(REARM_HOLD_MS_)) {
+            last_seen_tick = now;
+            continue;
+        }
+        memcpy(last_uid, uid, sizeof(last_uid));
+        last_len = len;
+        last_seen_tick = now;
+
+        xSemaphoreTake(s_badge_mutex_, portMAX_DELAY);
+        memcpy(s_badge_uid_, uid, sizeof(s_badge_uid_));
+        s_badge_len_ = len;
+        xSemaphoreGive(s_badge_mutex_);
+
+        ESP_LOGI(TAG_, "Badge %02X%02X%02X%02X (%u bytes)",
+                 uid[0], uid[1], uid[2], uid[3], static_cast<unsigned>(len));
+        postBadgeEvent(uid, len);
+    }
+}
+
+} // namespace
+
+bool rfid::Init(QueueHandle_t event_queue) noexcept
+{
+    // Probe: the version register reads 0x00/0xFF when nothing answers.
+    const uint8_t version = rdReg(REG_VERSION_);
+    if (version == 0x00 || version == 0xFF) {
+        ESP_LOGW(TAG_, "No reader on I2C 0x%02X; badge attribution disabled", I2C_ADDR_);
+        return false;
+    }
+
+    s_badge_mutex_ = xSemaphoreCreateMutex();
+    s_irq_sem_ = xSemaphoreCreateBinary();
+    if (s_badge_mutex_ == nullptr || s_irq_sem_ == nullptr) {
+        ESP_LOGW(TAG_, "Init failed; badge attribution disabled");
+        return false;
+    }
+    s_event_queue_ = event_queue;
+
+    // Reset and configure: 25 ms timeout timer auto-started on transmit,
+    // 100% ASK, CRC preset 0x6363 (ISO 14443A), antenna on.
+    wrReg(REG_COMMAND_, CMD_SOFT_RESET_);
+    vTaskDelay(pdMS_TO_TICKS(50));
+    wrReg(REG_TMODE_, 0x80);
+    wrReg(REG_TPRESCALER_, 0xA9);
+    wrReg(REG_TRELOAD_H_, 0x03);
+    wrReg(REG_TRELOAD_L_, 0xE8);
+    wrReg(REG_TX_ASK_, 0x40);
+    wrReg(REG_MODE_, 0x3D);
+    setRegBits(REG_TX_CONTROL_, 0x03);
+
+    // IRQ line: active low, asserted on receive/idle/timer. The stock Dial
+    // does not route it (DIAL_RFID_IRQ_PIN_ = NC) and the task falls back
+    // to tick-granularity sleeps against the chip's timeout timer.
+    const gpio_num_t irq_pin = DIAL_RFID_IRQ_PIN_;
+    if (irq_pin != GPIO_NUM_NC) {
+        gpio_config_t io{};
+        io.pin_bit_mask = 1ULL << static_cast<uint32_t>(irq_pin);
+        io.mode = GPIO_MODE_INPUT;
+        io.pull_up_en = GPIO_PULLUP_ENABLE;
+        io.intr_type = GPIO_INTR_NEGEDGE;
+        if (gpio_config(&io) == ESP_OK) {
+            const esp_err_t isr_err = gpio_install_isr_service(0);
+            if (isr_err == ESP_OK || isr_err == ESP_ERR_INVALID_STATE) {
+                s_irq_wired_ =
+                    gpio_isr_handler_add(irq_pin, irqIsr, nullptr) == ESP_OK;
+            }
+        }
+        if (s_irq_wired_) {
+            wrReg(REG_COM_IEN_, 0xB1);  // IRqInv | RxIEn | IdleIEn | TimerIEn
+        } else {
+            ESP_LOGW(TAG_, "IRQ pin setup failed; using timer waits");
+        }
+    }
+
+    if (xTaskCreate(badgeTask, "rfid_badge", TASK_STACK_, nullptr,
+                    TASK_PRIO_, nullptr) != pdPASS) {
+        ESP_LOGW(TAG_, "Task create failed; badge attribution disabled");
+        return false;
+    }
+    ESP_LOGI(TAG_, "Reader up (version 0x%02X, irq %s)",
+             version, s_irq_wired_ ? "wired" : "timer");
+    return true;
+}
+
+bool rfid::GetCurrentBadge(uint8_t uid_out[MAX_UID_LEN], uint8_t& len_out) noexcept
+{
+    if (s_badge_mutex_ == nullptr) {
+        len_out = 0;
+        return false;
+    }
+    xSemaphoreTake(s_badge_mutex_, portMAX_DELAY);
+    memcpy(uid_out, s_badge_uid_, MAX_UID_LEN);
+    len_out = s_badge_len_;
+    xSemaphoreGive(s_badge_mutex_);
+    return len_out != 0;
+}
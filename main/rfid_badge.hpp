@@ -0,0 +1,48 @@
+/**
+ * @file rfid_badge.hpp
+ * @brief Operator badge reader (WS1850S / MFRC522-compatible, internal I2C).
+ * @details Lets operators badge in before starting a test so run records
+ *          carry who ran them. The reader is driven from its own low
+ *          priority task: the task kicks one REQA poll every few hundred
+ *          milliseconds and then blocks - on the reader's IRQ line where
+ *          the hardware routes it (DIAL_RFID_IRQ_PIN_), or on the chip's
+ *          internal timeout timer otherwise - so neither the UI loop nor
+ *          the render task ever busy-waits on the RF field. A scanned UID
+ *          is published as a BadgeScan event on the protocol event queue
+ *          (internal event, never on the wire) and retained for
+ *          GetCurrentBadge() so run_db records can be tagged at run end.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+namespace rfid {
+
+/// Longest UID retained (single + double size ISO 14443A; triple-size
+/// 10-byte UIDs are rare on badges and truncated to their first 7 bytes).
+constexpr size_t MAX_UID_LEN = 7;
+
+/**
+ * @brief Probe the reader and start the badge task
+ * @details Safe to call once after M5.begin() (needs the internal I2C bus).
+ *          If no reader answers on the bus the module logs a warning and
+ *          degrades to a no-op - badge attribution simply stays empty.
+ * @param event_queue Protocol event queue BadgeScan events are posted to
+ * @return true if the reader was found and the task started
+ */
+bool Init(QueueHandle_t event_queue) noexcept;
+
+/**
+ * @brief Copy the most recently scanned badge UID
+ * @param uid_out Receives up to MAX_UID_LEN UID bytes
+ * @param len_out Receives the UID length (0 if no badge scanned yet)
+ * @return true if a badge has been scanned this session
+ */
+bool GetCurrentBadge(uint8_t uid_out[MAX_UID_LEN], uint8_t& len_out) noexcept;
+
+} // namespace rfid
@@ -0,0 +1,273 @@
+/**
+ * @file run_db.cpp
+ * @brief Flash-backed test run database implementation.
+ */
+
+#include "run_db.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "flash_gov.hpp"
+
+namespace {
+
+const char* TAG_ = "run_db";
+
+// ============================================================================
+// ON-FLASH LAYOUT
+// ============================================================================
+//
+// Same shape as the session log: 4 KB sectors, slot 0 is a header with a
+// monotonic sequence number, the remaining slots hold fixed 40-byte
+// records appended oldest-first. Sectors are consumed circularly. The
+// magic doubles as a layout version: sectors written before badge
+// attribution widened the record ("RDB") fail the check and recycle as
+// unwritten space rather than being misparsed. Unlike the
+// session log there is no staging page or writer task - runs end a few
+// times per day, so the caller eats the occasional program (and, once per
+// 127 runs, a sector erase) directly.
+
+constexpr size_t SECTOR_SIZE_ = 4096;
+constexpr size_t RECORD_SIZE_ = sizeof(run_db::RunRecord);
+constexpr size_t RECORDS_PER_SECTOR_ = SECTOR_SIZE_ / RECORD_SIZE_ - 1;  // slot 0 = header
+constexpr size_t MAX_SECTORS_ = 16;      ///< Bookkeeping cap (64 KB partition)
+constexpr uint32_t SECTOR_MAGIC_ = 0x32424452;   // "RDB2"
+constexpr uint32_t ERASED_WORD_ = 0xFFFFFFFFu;
+
+struct SectorHeader {
+    uint32_t magic;
+    uint32_t seq;          ///< Monotonic; newest sector has the largest value
+    uint8_t reserved[RECORD_SIZE_ - 8];
+};
+static_assert(sizeof(SectorHeader) == RECORD_SIZE_, "header fills one slot");
+
+const esp_partition_t* s_part_ = nullptr;
+size_t s_sector_count_total_ = 0;        ///< Usable sectors in the partition
+SemaphoreHandle_t s_mutex_ = nullptr;    ///< Guards the bookkeeping
+
+uint32_t s_next_seq_ = 1;                ///< Run number for the next record
+size_t s_cur_sector_ = 0;                ///< Sector records are appended into
+size_t s_cur_used_ = RECORDS_PER_SECTOR_;  ///< Records in it (full = open a new one)
+uint32_t s_sector_seq_[MAX_SECTORS_] = {};   ///< 0 = sector invalid/erased
+uint8_t s_sector_used_[MAX_SECTORS_] = {};   ///< Valid records in the sector
+size_t s_flash_total_ = 0;               ///< Sum of s_sector_used_
+
+/** @brief First unused record slot in @p sector (binary search over seq words). */
+uint8_t scanSectorUsed(size_t sector) noexcept
+{
+    size_t lo = 0;                     // slots [0, lo) are known used
+    size_t hi = RECORDS_PER_SECTOR_;   // slots [hi, end) are known erased
+    while (lo < hi) {
+        const size_t mid = (lo + hi) / 2;
+        uint32_t seq = ERASED_WORD_;
+        (void)esp_partition_read(s_part_,
+                                 sector * SECTOR_SIZE_ + (1 + mid) * RECORD_SIZE_,
+                                 &seq, sizeof(seq));
+        if (seq == ERASED_WORD_) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return static_cast<uint8_t>(lo);
+}
+
+/**
+ * @brief Erase the next circular sector and stamp its header
+ * @details Drops the sector from the bookkeeping first so a concurrent
+ *          reader never sees the recycled sector as valid history.
+ */
+bool openNextSector() noexcept
+{
+    const size_t sector = (s_cur_used_ >= RECORDS_PER_SECTOR_ && s_sector_seq_[s_cur_sector_] != 0)
+        ? (s_cur_sector_ + 1) % s_sector_count_total_
+        : s_cur_sector_;
+
+    s_flash_total_ -= s_sector_used_[sector];
+    s_sector_seq_[sector] = 0;
+    s_sector_used_[sector] = 0;
+
+    SectorHeader hdr;
+    memset(&hdr, 0xFF, sizeof(hdr));
+    hdr.magic = SECTOR_MAGIC_;
+    hdr.seq = s_next_seq_;
+
+    esp_err_t err = esp_partition_erase_range(s_part_, sector * SECTOR_SIZE_, SECTOR_SIZE_);
+    flash_gov::NoteErase();  // not deferrable; stamped for the pacing only
+    if (err == ESP_OK) {
+        err = esp_partition_write(s_part_, sector * SECTOR_SIZE_, &hdr, sizeof(hdr));
+    }
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG_, "Sector %u open failed: %s",
+                 static_cast<unsigned>(sector), esp_err_to_name(err));
+        return false;
+    }
+
+    s_cur_sector_ = sector;
+    s_cur_used_ = 0;
+    s_sector_seq_[sector] = hdr.seq;
+    return true;
+}
+
+} // namespace
+
+void run_db::Init() noexcept
+{
+    s_part_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                       ESP_PARTITION_SUBTYPE_ANY, "rundb");
+    if (s_part_ == nullptr) {
+        ESP_LOGW(TAG_, "No rundb partition; run history disabled");
+        return;
+    }
+    s_sector_count_total_ = s_part_->size / SECTOR_SIZE_;
+    if (s_sector_count_total_ > MAX_SECTORS_) {
+        s_sector_count_total_ = MAX_SECTORS_;
+    }
+    s_mutex_ = xSemaphoreCreateMutex();
+    if (s_mutex_ == nullptr || s_sector_count_total_ == 0) {
+        ESP_LOGW(TAG_, "Init failed; run history disabled");
+        s_part_ = nullptr;
+        return;
+    }
+
+    // Scan sector headers to find where the previous session left off.
+    uint32_t max_seq = 0;
+    size_t max_sector = 0;
+    for (size_t i = 0; i < s_sector_count_total_; ++i) {
+        SectorHeader hdr{};
+        if (esp_partition_read(s_part_, i * SECTOR_SIZE_, &hdr,
+                               sizeof(hdr.magic) + sizeof(hdr.seq)) != ESP_OK) {
+            continue;
+        }
+        if (hdr.magic != SECTOR_MAGIC_ || hdr.seq == 0) {
+            continue;
+        }
+        s_sector_seq_[i] = hdr.seq;
+        s_sector_used_[i] = scanSectorUsed(i);
+        s_flash_total_ += s_sector_used_[i];
+        if (hdr.seq > max_seq) {
+            max_seq = hdr.seq;
+            max_sector = i;
+        }
+    }
+    if (max_seq != 0) {
+        s_cur_sector_ = max_sector;
+        s_cur_used_ = s_sector_used_[max_sector];
+        // Highest stored run number wins; the header seq is the number of
+        // the sector's first record.
+        s_next_seq_ = max_seq + s_cur_used_;
+        if (s_next_seq_ <= max_seq) {
+            s_next_seq_ = max_seq + 1;
+        }
+    }
+
+    ESP_LOGI(TAG_, "%u sectors, %u runs on record",
+             static_cast<unsigned>(s_sector_count_total_),
+             static_cast<unsigned>(s_flash_total_));
+}
+
+bool run_db::Append(RunRecord& rec) noexcept
+{
+    if (s_part_ == nullptr) {
+        return false;
+    }
+    xSemaphoreTake(s_mutex_, portMAX_DELAY);
+
+    if (s_cur_used_ >= RECORDS_PER_SECTOR_ || s_sector_seq_[s_cur_sector_] == 0) {
+        if (!openNextSector()) {
+            xSemaphoreGive(s_mutex_);
+            return false;
+        }
+    }
+
+    rec.seq = s_next_seq_;
+    const size_t offset =
+        s_cur_sector_ * SECTOR_SIZE_ + (1 + s_cur_used_) * RECORD_SIZE_;
+    const esp_err_t err = esp_partition_write(s_part_, offset, &rec, sizeof(rec));
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG_, "Record write failed: %s", esp_err_to_name(err));
+        xSemaphoreGive(s_mutex_);
+        return false;
+    }
+
+    ++s_next_seq_;
+    ++s_cur_used_;
+    s_sector_used_[s_cur_sector_] = static_cast<uint8_t>(s_cur_used_);
+    ++s_flash_total_;
+    xSemaphoreGive(s_mutex_);
+    return true;
+}
+
+size_t run_db::Count() noexcept
+{
+    if (s_part_ == nullptr) {
+        return 0;
+    }
+    xSemaphoreTake(s_mutex_, portMAX_DELAY);
+    const size_t n = s_flash_total_;
+    xSemaphoreGive(s_mutex_);
+    return n;
+}
+
+bool run_db::ReadBack(size_t index_back, RunRecord& out) noexcept
+{
+    if (s_part_ == nullptr) {
+        return false;
+    }
+    xSemaphoreTake(s_mutex_, portMAX_DELAY);
+
+    // Newest first: walk sectors backwards from the one being filled. The
+    // loop is bounded by the sector count, so lookups stay flat no matter
+    // how many runs are stored; the record itself is one direct read.
+    size_t idx = index_back;
+    size_t sector = (s_cur_sector_ + 1) % s_sector_count_total_;
+    for (size_t i = 0; i < s_sector_count_total_; ++i) {
+        sector = (sector + s_sector_count_total_ - 1) % s_sector_count_total_;
+        if (s_sector_seq_[sector] == 0) {
+            break;  // reached unwritten space; nothing older exists
+        }
+        const size_t used = s_sector_used_[sector];
+        if (idx < used) {
+            const size_t offset =
+                sector * SECTOR_SIZE_ + (1 + used - 1 - idx) * RECORD_SIZE_;
+            xSemaphoreGive(s_mutex_);  // flash read needs no bookkeeping
+            return esp_partition_read(s_part_, offset, &out, sizeof(out)) == ESP_OK;
+        }
+        idx -= used;
+    }
+    xSemaphoreGive(s_mutex_);
+    return false;
+}
+
+void run_db::DumpSerial() noexcept
+{
+    const size_t n = Count();
+    printf("run_db: %u records\r\n", static_cast<unsigned>(n));
+    printf("run,unit,start_s,duration_s,cycles,target,state,err,vmax_rpm,dwell_ms,bounds,badge\r\n");
+    for (size_t i = 0; i < n; ++i) {
+        RunRecord r{};
+        if (!ReadBack(i, r)) {
+            break;
+        }
+        char badge[2 * sizeof(r.badge_uid) + 1] = "-";
+        if (r.badge_len > 0 && r.badge_len <= sizeof(r.badge_uid)) {
+            for (unsigned b = 0; b < r.badge_len; ++b) {
+                snprintf(badge + 2 * b, 3, "%02X", r.badge_uid[b]);
+            }
+        }
+        printf("%" PRIu32 ",%02X%02X,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32
+               ",%u,%u,%.1f,%u,%u,%s\r\n",
+               r.seq, r.mac4, r.mac5, r.start_ms / 1000U, r.duration_ms / 1000U,
+               r.cycles_done, r.cycle_target,
+               static_cast<unsigned>(r.state), static_cast<unsigned>(r.err_code),
+               static_cast<double>(r.vmax_rpm), static_cast<unsigned>(r.dwell_ms),
+               static_cast<unsigned>(r.bounds_method), badge);
+    }
+}
@@ -0,0 +1,80 @@
+/**
+ * @file run_db.hpp
+ * @brief Flash-backed test run database (dedicated partition).
+ * @details Each completed fatigue test appends one fixed 40-byte record to
+ *          the "rundb" data partition, so run outcomes survive reboots and
+ *          the History page can answer "what did this unit run last week"
+ *          without spreadsheet archaeology. Records are written at run end
+ *          (a handful per day), so commits happen synchronously on the
+ *          caller; sector recycling follows the session_log circular
+ *          layout. ReadBack() resolves an index through the in-RAM sector
+ *          bookkeeping, so access cost is bounded by the sector count (16),
+ *          not by how many runs are stored.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace run_db {
+
+/**
+ * @brief One persisted run record (40-byte flash format)
+ * @details The layout is part of the on-flash format; seq is assigned by
+ *          Append and doubles as the erased-slot marker.
+ */
+struct RunRecord {
+    uint32_t seq;          ///< Monotonic run number (assigned by Append)
+    uint32_t start_ms;     ///< Uptime when the run entered Running
+    uint32_t duration_ms;  ///< Running + Paused wall time
+    uint32_t cycles_done;  ///< Final cycle number reported
+    uint32_t cycle_target; ///< Configured target (0 = infinite)
+    float    vmax_rpm;     ///< Oscillation velocity the run used
+    uint16_t dwell_ms;     ///< Endpoint dwell (clamped to 16 bit)
+    uint8_t  mac4;         ///< Unit MAC suffix (bytes 4..5)
+    uint8_t  mac5;
+    uint8_t  state;        ///< Final fatigue_proto::TestState
+    uint8_t  err_code;     ///< Error code at run end (0 = clean)
+    uint8_t  bounds_method; ///< 0 = stallguard, 1 = encoder
+    uint8_t  badge_len;    ///< Operator badge UID length (0 = unattributed)
+    uint8_t  badge_uid[7]; ///< Operator badge UID at run start (rfid_badge)
+    uint8_t  reserved;
+};
+static_assert(sizeof(RunRecord) == 40, "record layout is part of the format");
+
+/**
+ * @brief Locate the rundb partition and scan existing records
+ * @details Safe to call once at boot before any Append. If the partition is
+ *          missing the module degrades to a no-op (Count() returns 0).
+ */
+void Init() noexcept;
+
+/**
+ * @brief Persist one finished run
+ * @param rec Record to store; seq is overwritten with the next run number
+ * @return true if the record reached flash
+ */
+bool Append(RunRecord& rec) noexcept;
+
+/**
+ * @brief Total runs stored, newest first
+ */
+size_t Count() noexcept;
+
+/**
+ * @brief Read the n-th run back from the newest
+ * @param index_back 0 = most recent run, Count()-1 = oldest retained
+ * @param out Receives the record
+ * @return true if the record exists and was read
+ */
+bool ReadBack(size_t index_back, RunRecord& out) noexcept;
+
+/**
+ * @brief Dump every stored run to the serial console as CSV
+ * @details Newest first; header line plus one line per record, so the
+ *          output pastes straight into a spreadsheet.
+ */
+void DumpSerial() noexcept;
+
+} // namespace run_db
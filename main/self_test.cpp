@@ -0,0 +1,193 @@
+/**
+ * @file self_test.cpp
+ * @brief Power-on self-test implementation
+ */
+
+#include "self_test.hpp"
+
+#include <cstdio>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "driver/gpio.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "M5Unified.h"
+
+#include "config.hpp"
+#include "storage_maint.hpp"
+#include "ui/display_tuner.hpp"
+
+namespace self_test {
+
+static const char* TAG_ = "post";
+
+// Verdicts: written once each by the POST task, read by the UI task.
+// Byte-sized stores are atomic on this target, so no lock is needed.
+static uint8_t s_verdict_[static_cast<size_t>(Check::Count)] = {};
+static bool s_done_ = false;
+
+static constexpr const char* NAMES_[static_cast<size_t>(Check::Count)] = {
+    "encoder", "touch", "display", "speaker", "nvs"};
+
+static void setVerdict_(Check c, bool pass) noexcept
+{
+    s_verdict_[static_cast<size_t>(c)] =
+        static_cast<uint8_t>(pass ? Verdict::Pass : Verdict::Fail);
+    if (pass) {
+        ESP_LOGI(TAG_, "%s: pass", CheckName(c));
+    } else {
+        ESP_LOGW(TAG_, "%s: FAIL", CheckName(c));
+    }
+}
+
+/**
+ * @brief Encoder A/B line sanity
+ * @details With the board's pull-ups both quadrature lines idle high at a
+ *          detent, so a broken trace or a line shorted to ground reads
+ *          constant low. Sample both lines across ~80 ms and fail any
+ *          line that never reads high. A stuck-high line looks identical
+ *          to rest without rotation, so it is not detectable here; the
+ *          encoder driver's gesture statistics catch that case in use.
+ */
+static bool checkEncoder_() noexcept
+{
+    bool a_high = false;
+    bool b_high = false;
+    for (int i = 0; i < 16; ++i) {
+        a_high = a_high || gpio_get_level(DIAL_ENCODER_PIN_A_) != 0;
+        b_high = b_high || gpio_get_level(DIAL_ENCODER_PIN_B_) != 0;
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+    if (!a_high || !b_high) {
+        ESP_LOGW(TAG_, "encoder line stuck low (A=%d B=%d)",
+                 a_high ? 1 : 0, b_high ? 1 : 0);
+    }
+    return a_high && b_high;
+}
+
+/**
+ * @brief Touch controller presence
+ * @details The FT3267 answered its ID probe inside M5.begin() if the
+ *          driver is enabled; re-reading the ID from here would put a
+ *          second prober on the internal I2C bus alongside the touch
+ *          polling and the peripheral bring-up task, so the probe result
+ *          is consumed instead of repeated.
+ */
+static bool checkTouch_() noexcept
+{
+    return M5.Touch.isEnabled();
+}
+
+/**
+ * @brief Panel read-back verdict from the display tuner
+ * @details The tuner already wrote and read back pattern strips on the
+ *          boot path, before the render task owned the bus; this consumes
+ *          that verdict rather than contending for the SPI bus mid-boot.
+ */
+static bool checkDisplay_() noexcept
+{
+    return ui::display_tuner::ReadbackOk();
+}
+
+/**
+ * @brief Speaker amp bring-up
+ * @details The NS4168 amp has no sense line, so coil impedance cannot be
+ *          measured; allocating its I2S channel is the strongest check
+ *          available without making noise. Normally the channel only
+ *          comes up on the first tone, so this also moves that cost off
+ *          the first real beep.
+ */
+static bool checkSpeaker_() noexcept
+{
+    return M5.Speaker.isEnabled() && M5.Speaker.begin();
+}
+
+/**
+ * @brief NVS integrity via the storage module's boot check
+ * @details storage_maint::Init already measured utilization and a probe
+ *          read right after nvs_flash_init; a partition whose statistics
+ *          are unreadable reports zero capacity here.
+ */
+static bool checkNvs_() noexcept
+{
+    storage_maint::Health h{};
+    storage_maint::GetHealth(h);
+    return h.total_entries > 0 && h.used_entries <= h.total_entries;
+}
+
+static void runChecks_() noexcept
+{
+    const int64_t t0_us = esp_timer_get_time();
+    setVerdict_(Check::Encoder, checkEncoder_());
+    setVerdict_(Check::Touch, checkTouch_());
+    setVerdict_(Check::Display, checkDisplay_());
+    setVerdict_(Check::Speaker, checkSpeaker_());
+    setVerdict_(Check::Nvs, checkNvs_());
+    s_done_ = true;
+    ESP_LOGI(TAG_, "done in %u ms, fail mask 0x%02x",
+             static_cast<unsigned>((esp_timer_get_time() - t0_us) / 1000),
+             static_cast<unsigned>(FailMask()));
+}
+
+static void postTask_(void* arg)
+{
+    (void)arg;
+    runChecks_();
+    vTaskDelete(nullptr);
+}
+
+void Start() noexcept
+{
+    if (xTaskCreate(postTask_, "post", 3072, nullptr, 2, nullptr) != pdPASS) {
+        ESP_LOGW(TAG_, "task creation failed; running inline");
+        runChecks_();
+    }
+}
+
+Verdict Result(Check c) noexcept
+{
+    if (c >= Check::Count) {
+        return Verdict::Pending;
+    }
+    return static_cast<Verdict>(s_verdict_[static_cast<size_t>(c)]);
+}
+
+bool Done() noexcept
+{
+    return s_done_;
+}
+
+uint8_t FailMask() noexcept
+{
+    uint8_t mask = 0;
+    for (size_t i = 0; i < static_cast<size_t>(Check::Count); ++i) {
+        if (s_verdict_[i] == static_cast<uint8_t>(Verdict::Fail)) {
+            mask |= static_cast<uint8_t>(1U << i);
+        }
+    }
+    return mask;
+}
+
+const char* CheckName(Check c) noexcept
+{
+    if (c >= Check::Count) {
+        return "?";
+    }
+    return NAMES_[static_cast<size_t>(c)];
+}
+
+void DumpSerial() noexcept
+{
+    printf("POST: %s\r\n", s_done_ ? "complete" : "in flight");
+    for (size_t i = 0; i < static_cast<size_t>(Check::Count); ++i) {
+        const auto v = static_cast<Verdict>(s_verdict_[i]);
+        printf("  %-8s %s\r\n", NAMES_[i],
+               v == Verdict::Pass ? "pass"
+                                  : (v == Verdict::Fail ? "FAIL" : "pending"));
+    }
+}
+
+} // namespace self_test
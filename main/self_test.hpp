@@ -0,0 +1,80 @@
+/**
+ * @file self_test.hpp
+ * @brief Power-on self-test: concurrent hardware checks behind the splash.
+ * @details Units come back from cells with flaky encoders or dead speaker
+ *          amps that are only discovered mid-shift. This module runs a
+ *          small battery of hardware checks on a background task during
+ *          the boot animation window, so they add zero serialized boot
+ *          time: encoder A/B line sanity (a broken or shorted quadrature
+ *          line reads constant low across a sample window), touch
+ *          controller presence (the FT3267 answered its probe during
+ *          M5.begin), display read-back (the panel tuner's pattern
+ *          verdict from this boot), speaker amp bring-up (the I2S channel
+ *          allocates), and NVS integrity (the storage module's boot
+ *          probe). Every verdict is logged; failures are flagged on the
+ *          diagnostics page and the full table rides the PERF serial
+ *          dump. All checks are advisory - a failure never blocks boot.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace self_test {
+
+/**
+ * @brief Individual checks, in run order
+ */
+enum class Check : uint8_t {
+    Encoder = 0,  ///< Quadrature A/B line sanity
+    Touch,        ///< Touch controller probed at M5.begin
+    Display,      ///< Panel pattern read-back (display tuner verdict)
+    Speaker,      ///< Speaker amp I2S channel bring-up
+    Nvs,          ///< NVS partition statistics and boot probe
+    Count
+};
+
+/**
+ * @brief Per-check outcome
+ */
+enum class Verdict : uint8_t {
+    Pending = 0,  ///< Not yet run (or suite still in flight)
+    Pass,
+    Fail
+};
+
+/**
+ * @brief Launch the self-test task
+ * @details Call once from app_main after M5.begin() and the display
+ *          tuner; the task runs the checks concurrently with the radio
+ *          bring-up and boot animation, then deletes itself. Inline
+ *          fallback runs the checks synchronously if task creation fails.
+ */
+void Start() noexcept;
+
+/**
+ * @brief Verdict for one check
+ */
+Verdict Result(Check c) noexcept;
+
+/**
+ * @brief true once every check has a verdict
+ */
+bool Done() noexcept;
+
+/**
+ * @brief Bitmask of failed checks (bit index = Check value); 0 = healthy
+ */
+uint8_t FailMask() noexcept;
+
+/**
+ * @brief Short name for a check (serial dump and logs)
+ */
+const char* CheckName(Check c) noexcept;
+
+/**
+ * @brief Print the verdict table to the serial console
+ */
+void DumpSerial() noexcept;
+
+} // namespace self_test
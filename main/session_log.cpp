@@ -0,0 +1,360 @@
+/**
+ * @file session_log.cpp
+ * @brief Flash-backed session log implementation.
+ */
+
+#include "session_log.hpp"
+
+#include <cstring>
+
+#include "flash_gov.hpp"
+
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_system.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+namespace {
+
+const char* TAG_ = "session_log";
+
+// ============================================================================
+// ON-FLASH LAYOUT
+// ============================================================================
+//
+// The partition is divided into 4 KB sectors. Slot 0 of each sector is a
+// header carrying a monotonically increasing sequence number; slots 1..62
+// are fixed 64-byte records appended oldest-first. Sectors are consumed
+// circularly, so walking backwards from the most recently written sector
+// visits history newest-first without any index structure.
+
+constexpr size_t SECTOR_SIZE_ = 4096;
+constexpr size_t RECORD_SIZE_ = 64;
+constexpr size_t RECORDS_PER_SECTOR_ = SECTOR_SIZE_ / RECORD_SIZE_ - 1;  // slot 0 = header
+constexpr size_t MAX_SECTORS_ = 256;     ///< Bookkeeping cap (1 MB of log)
+constexpr uint32_t SECTOR_MAGIC_ = 0x474F4C53;  // "SLOG"
+constexpr uint32_t ERASED_WORD_ = 0xFFFFFFFFu;
+
+struct SectorHeader {
+    uint32_t magic;
+    uint32_t seq;          ///< Monotonic; newest sector has the largest value
+    uint8_t reserved[RECORD_SIZE_ - 8];
+};
+static_assert(sizeof(SectorHeader) == RECORD_SIZE_, "header fills one slot");
+
+struct Record {
+    uint32_t ms;           ///< ERASED_WORD_ marks an unused slot
+    char text[session_log::MAX_TEXT];
+};
+static_assert(sizeof(Record) == RECORD_SIZE_, "record layout is part of the format");
+
+// ============================================================================
+// STATE
+// ============================================================================
+
+constexpr uint32_t WRITER_TASK_STACK_ = 3072;   ///< Writer stack size
+constexpr UBaseType_t WRITER_TASK_PRIO_ = 1;    ///< Just above idle
+
+const esp_partition_t* s_part_ = nullptr;
+size_t s_sector_count_total_ = 0;        ///< Usable sectors in the partition
+SemaphoreHandle_t s_mutex_ = nullptr;    ///< Guards staging + bookkeeping
+QueueHandle_t s_write_queue_ = nullptr;  ///< Full pages handed to the writer
+
+// Double-buffered staging: Append fills one page while the writer commits
+// the other, so a log burst never blocks on an ongoing erase.
+uint8_t* s_page_[2] = {nullptr, nullptr};
+uint8_t s_fill_idx_ = 0;                 ///< Page currently being filled
+bool s_page_busy_[2] = {false, false};   ///< Page is owned by the writer
+size_t s_staged_ = 0;                    ///< Records in the fill page
+
+uint32_t s_next_seq_ = 1;                ///< Sequence for the next sector
+size_t s_next_sector_ = 0;               ///< Sector the next page lands in
+uint32_t s_sector_seq_[MAX_SECTORS_] = {};   ///< 0 = sector invalid/erased
+uint8_t s_sector_used_[MAX_SECTORS_] = {};   ///< Valid records in the sector
+size_t s_flash_total_ = 0;               ///< Sum of s_sector_used_
+
+/** @brief Records staged in @p page (fill page only; committed pages are full). */
+inline Record* pageRecords(uint8_t* page) noexcept
+{
+    return reinterpret_cast<Record*>(page + RECORD_SIZE_);
+}
+
+/**
+ * @brief Erase the target sector and write @p len bytes of the page
+ * @details Drops the sector from the bookkeeping first so a reader never
+ *          sees a half-written sector as valid history.
+ */
+void commitPage(uint8_t* page, size_t sector, size_t len, uint32_t seq,
+                uint8_t used) noexcept
+{
+    esp_err_t err = esp_partition_erase_range(s_part_, sector * SECTOR_SIZE_, SECTOR_SIZE_);
+    flash_gov::NoteErase();
+    if (err == ESP_OK) {
+        err = esp_partition_write(s_part_, sector * SECTOR_SIZE_, page, len);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG_, "Sector %u commit failed: %s",
+                 static_cast<unsigned>(sector), esp_err_to_name(err));
+        return;
+    }
+
+    xSemaphoreTake(s_mutex_, portMAX_DELAY);
+    s_flash_total_ += used;
+    s_sector_seq_[sector] = seq;
+    s_sector_used_[sector] = used;
+    xSemaphoreGive(s_mutex_);
+}
+
+/**
+ * @brief Low-priority writer: commits full staging pages as they arrive
+ * @details All flash latency (erase + program, tens of milliseconds) lives
+ *          here; the UI path only ever memcpy's into the staging page.
+ */
+void sessionLogWriterTask(void* /*arg*/)
+{
+    while (true) {
+        uint8_t page_idx = 0;
+        if (xQueueReceive(s_write_queue_, &page_idx, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        uint8_t* page = s_page_[page_idx];
+        const SectorHeader* hdr = reinterpret_cast<const SectorHeader*>(page);
+
+        // Governor: hold the erase while the operator is watching a running
+        // test (bounded inside DeferErase); the double-buffered staging
+        // absorbs the log traffic meanwhile.
+        while (flash_gov::DeferErase()) {
+            vTaskDelay(pdMS_TO_TICKS(50));
+        }
+
+        xSemaphoreTake(s_mutex_, portMAX_DELAY);
+        const size_t sector = s_next_sector_;
+        s_next_sector_ = (s_next_sector_ + 1) % s_sector_count_total_;
+        s_flash_total_ -= s_sector_used_[sector];  // sector is being recycled
+        s_sector_seq_[sector] = 0;
+        s_sector_used_[sector] = 0;
+        xSemaphoreGive(s_mutex_);
+
+        commitPage(page, sector, SECTOR_SIZE_, hdr->seq, RECORDS_PER_SECTOR_);
+
+        xSemaphoreTake(s_mutex_, portMAX_DELAY);
+        s_page_busy_[page_idx] = false;
+        xSemaphoreGive(s_mutex_);
+    }
+}
+
+/** @brief Shutdown hook: persist whatever is still staged in RAM. */
+void sessionLogShutdownFlush(void)
+{
+    session_log::Flush();
+}
+
+/** @brief First unused record slot in @p sector (binary search over ms words). */
+uint8_t scanSectorUsed(size_t sector) noexcept
+{
+    size_t lo = 0;                     // slots [0, lo) are known used
+    size_t hi = RECORDS_PER_SECTOR_;   // slots [hi, end) are known erased
+    while (lo < hi) {
+        const size_t mid = (lo + hi) / 2;
+        uint32_t ms = ERASED_WORD_;
+        (void)esp_partition_read(s_part_,
+                                 sector * SECTOR_SIZE_ + (1 + mid) * RECORD_SIZE_,
+                                 &ms, sizeof(ms));
+        if (ms == ERASED_WORD_) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return static_cast<uint8_t>(lo);
+}
+
+} // namespace
+
+void session_log::Init() noexcept
+{
+    s_part_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                       ESP_PARTITION_SUBTYPE_ANY, "sessionlog");
+    if (s_part_ == nullptr) {
+        ESP_LOGW(TAG_, "No sessionlog partition; flash history disabled");
+        return;
+    }
+    s_sector_count_total_ = s_part_->size / SECTOR_SIZE_;
+    if (s_sector_count_total_ > MAX_SECTORS_) {
+        s_sector_count_total_ = MAX_SECTORS_;
+    }
+
+    s_page_[0] = static_cast<uint8_t*>(malloc(SECTOR_SIZE_));
+    s_page_[1] = static_cast<uint8_t*>(malloc(SECTOR_SIZE_));
+    s_mutex_ = xSemaphoreCreateMutex();
+    s_write_queue_ = xQueueCreate(2, sizeof(uint8_t));
+    if (s_page_[0] == nullptr || s_page_[1] == nullptr ||
+        s_mutex_ == nullptr || s_write_queue_ == nullptr ||
+        xTaskCreate(sessionLogWriterTask, "slog_wr", WRITER_TASK_STACK_, nullptr,
+                    WRITER_TASK_PRIO_, nullptr) != pdPASS) {
+        ESP_LOGW(TAG_, "Writer unavailable; flash history disabled");
+        s_part_ = nullptr;
+        return;
+    }
+
+    // Scan sector headers to find where the previous session left off.
+    uint32_t max_seq = 0;
+    size_t max_sector = 0;
+    for (size_t i = 0; i < s_sector_count_total_; ++i) {
+        SectorHeader hdr{};
+        if (esp_partition_read(s_part_, i * SECTOR_SIZE_, &hdr,
+                               sizeof(hdr.magic) + sizeof(hdr.seq)) != ESP_OK) {
+            continue;
+        }
+        if (hdr.magic != SECTOR_MAGIC_ || hdr.seq == 0) {
+            continue;
+        }
+        s_sector_seq_[i] = hdr.seq;
+        s_sector_used_[i] = scanSectorUsed(i);
+        s_flash_total_ += s_sector_used_[i];
+        if (hdr.seq > max_seq) {
+            max_seq = hdr.seq;
+            max_sector = i;
+        }
+    }
+    if (max_seq != 0) {
+        s_next_seq_ = max_seq + 1;
+        s_next_sector_ = (max_sector + 1) % s_sector_count_total_;
+    }
+
+    (void)esp_register_shutdown_handler(&sessionLogShutdownFlush);
+    ESP_LOGI(TAG_, "%u sectors, %u lines of history",
+             static_cast<unsigned>(s_sector_count_total_),
+             static_cast<unsigned>(s_flash_total_));
+}
+
+void session_log::Append(uint32_t ms, const char* text) noexcept
+{
+    if (s_part_ == nullptr || text == nullptr) {
+        return;
+    }
+    xSemaphoreTake(s_mutex_, portMAX_DELAY);
+
+    uint8_t* page = s_page_[s_fill_idx_];
+    if (s_staged_ == 0) {
+        SectorHeader* hdr = reinterpret_cast<SectorHeader*>(page);
+        memset(hdr, 0xFF, sizeof(*hdr));
+        hdr->magic = SECTOR_MAGIC_;
+        hdr->seq = s_next_seq_++;
+    }
+    Record& rec = pageRecords(page)[s_staged_];
+    rec.ms = (ms == ERASED_WORD_) ? ERASED_WORD_ - 1 : ms;
+    strlcpy(rec.text, text, sizeof(rec.text));
+    ++s_staged_;
+
+    if (s_staged_ >= RECORDS_PER_SECTOR_) {
+        const uint8_t other = s_fill_idx_ ^ 1;
+        if (!s_page_busy_[other]) {
+            s_page_busy_[s_fill_idx_] = true;
+            const uint8_t full_idx = s_fill_idx_;
+            s_fill_idx_ = other;
+            s_staged_ = 0;
+            (void)xQueueSend(s_write_queue_, &full_idx, 0);
+        } else {
+            // Writer two pages behind (flash stall): wrap the fill page and
+            // sacrifice its oldest records rather than block the caller.
+            s_staged_ = 0;
+        }
+    }
+    xSemaphoreGive(s_mutex_);
+}
+
+size_t session_log::Count() noexcept
+{
+    if (s_part_ == nullptr) {
+        return 0;
+    }
+    xSemaphoreTake(s_mutex_, portMAX_DELAY);
+    size_t n = s_flash_total_ + s_staged_;
+    if (s_page_busy_[s_fill_idx_ ^ 1]) {
+        n += RECORDS_PER_SECTOR_;  // full page in flight to the writer
+    }
+    xSemaphoreGive(s_mutex_);
+    return n;
+}
+
+bool session_log::ReadBack(size_t index_back, uint32_t& ms_out,
+                           char* text_out, size_t text_size) noexcept
+{
+    if (s_part_ == nullptr || text_out == nullptr || text_size == 0) {
+        return false;
+    }
+    xSemaphoreTake(s_mutex_, portMAX_DELAY);
+
+    // Newest first: the fill page, then a full page the writer still holds,
+    // then flash sectors walking backwards from the last written one.
+    size_t idx = index_back;
+    for (int pass = 0; pass < 2; ++pass) {
+        const uint8_t page_idx = (pass == 0) ? s_fill_idx_ : (s_fill_idx_ ^ 1);
+        const size_t avail = (pass == 0)
+            ? s_staged_
+            : (s_page_busy_[page_idx] ? RECORDS_PER_SECTOR_ : 0);
+        if (idx < avail) {
+            const Record& rec = pageRecords(s_page_[page_idx])[avail - 1 - idx];
+            ms_out = rec.ms;
+            strlcpy(text_out, rec.text, text_size);
+            xSemaphoreGive(s_mutex_);
+            return true;
+        }
+        idx -= avail;
+    }
+
+    size_t sector = s_next_sector_;
+    for (size_t i = 0; i < s_sector_count_total_; ++i) {
+        sector = (sector + s_sector_count_total_ - 1) % s_sector_count_total_;
+        if (s_sector_seq_[sector] == 0) {
+            break;  // reached unwritten space; nothing older exists
+        }
+        const size_t used = s_sector_used_[sector];
+        if (idx < used) {
+            const size_t offset =
+                sector * SECTOR_SIZE_ + (1 + used - 1 - idx) * RECORD_SIZE_;
+            xSemaphoreGive(s_mutex_);  // flash read does not touch staging
+            Record rec{};
+            if (esp_partition_read(s_part_, offset, &rec, sizeof(rec)) != ESP_OK) {
+                return false;
+            }
+            ms_out = rec.ms;
+            rec.text[sizeof(rec.text) - 1] = '\0';
+            strlcpy(text_out, rec.text, text_size);
+            return true;
+        }
+        idx -= used;
+    }
+    xSemaphoreGive(s_mutex_);
+    return false;
+}
+
+void session_log::Flush() noexcept
+{
+    if (s_part_ == nullptr) {
+        return;
+    }
+    xSemaphoreTake(s_mutex_, portMAX_DELAY);
+    const size_t staged = s_staged_;
+    if (staged == 0) {
+        xSemaphoreGive(s_mutex_);
+        return;
+    }
+    uint8_t* page = s_page_[s_fill_idx_];
+    const SectorHeader* hdr = reinterpret_cast<const SectorHeader*>(page);
+    const uint32_t seq = hdr->seq;
+    const size_t sector = s_next_sector_;
+    s_next_sector_ = (s_next_sector_ + 1) % s_sector_count_total_;
+    s_flash_total_ -= s_sector_used_[sector];
+    s_sector_seq_[sector] = 0;
+    s_sector_used_[sector] = 0;
+    s_staged_ = 0;
+    xSemaphoreGive(s_mutex_);
+
+    commitPage(page, sector, (1 + staged) * RECORD_SIZE_, seq,
+               static_cast<uint8_t>(staged));
+}
@@ -0,0 +1,59 @@
+/**
+ * @file session_log.hpp
+ * @brief Flash-backed session log (dedicated partition, streaming writer).
+ * @details Appends formatted log lines into a RAM staging page; a
+ *          low-priority writer task commits full 4 KB pages to the
+ *          "sessionlog" data partition (circular, wear-levelled by design -
+ *          each sector is erased once per wrap). History survives reboots,
+ *          so overnight faults keep their evidence. The Terminal page reads
+ *          back through Count()/ReadBack() to scroll into flash history.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace session_log {
+
+/// Longest stored line, including the NUL terminator.
+static constexpr size_t MAX_TEXT = 60;
+
+/**
+ * @brief Locate the sessionlog partition, scan existing history, start the writer
+ * @details Safe to call once at boot before any Append. If the partition is
+ *          missing the module degrades to a no-op (Count() returns 0).
+ */
+void Init() noexcept;
+
+/**
+ * @brief Append one log line (cheap: a bounded copy into the staging page)
+ * @param ms Uptime timestamp of the line (milliseconds)
+ * @param text NUL-terminated line; truncated to MAX_TEXT-1 characters
+ */
+void Append(uint32_t ms, const char* text) noexcept;
+
+/**
+ * @brief Total lines available (staged + persisted), newest first
+ */
+size_t Count() noexcept;
+
+/**
+ * @brief Read the n-th line back from the newest
+ * @param index_back 0 = newest line, Count()-1 = oldest
+ * @param ms_out Receives the line's timestamp
+ * @param text_out Output buffer for the line text
+ * @param text_size Capacity of @p text_out
+ * @return true if the line exists and was read
+ */
+bool ReadBack(size_t index_back, uint32_t& ms_out,
+              char* text_out, size_t text_size) noexcept;
+
+/**
+ * @brief Commit the partially filled staging page to flash
+ * @details Registered as a shutdown handler; also callable before an
+ *          intentional deep sleep or restart.
+ */
+void Flush() noexcept;
+
+} // namespace session_log
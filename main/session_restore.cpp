@@ -0,0 +1,103 @@
+/**
+ * @file session_restore.cpp
+ * @brief Session-state checkpoint implementation.
+ */
+
+#include "session_restore.hpp"
+
+#include <cstring>
+
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_system.h"
+
+namespace {
+
+constexpr const char* TAG_ = "restore";
+
+constexpr uint32_t CKPT_MAGIC_ = 0x54525253;  // "SRRT"
+
+/**
+ * @brief The RTC-resident checkpoint
+ * @details One fixed slot, overwritten in place. Every field is written
+ *          individually by the UI task, so a reset can at worst tear
+ *          *between* fields (e.g. a page noted before its matching status
+ *          landed) — never inside one. That staleness is acceptable: the
+ *          restore path reconciles with a ConfigRequest anyway, so the
+ *          checkpoint only has to be right about which unit and which view
+ *          the operator was on.
+ */
+struct RtcCheckpoint {
+    uint32_t magic;
+    session_restore::Snapshot snap;
+};
+
+RTC_NOINIT_ATTR RtcCheckpoint s_ckpt_;
+
+session_restore::Snapshot s_prev_;  ///< Captured at Init from the RTC copy
+bool s_have_prev_ = false;
+bool s_armed_ = false;
+
+} // namespace
+
+void session_restore::Init() noexcept
+{
+    const esp_reset_reason_t reason = esp_reset_reason();
+
+    // Same gate as the black box: power-on leaves RTC RAM undefined, any
+    // warm reset preserved it and a valid magic means the previous session
+    // checkpointed something worth restoring.
+    if (reason != ESP_RST_POWERON && reason != ESP_RST_UNKNOWN &&
+        s_ckpt_.magic == CKPT_MAGIC_) {
+        s_prev_ = s_ckpt_.snap;
+        s_have_prev_ = true;
+        ESP_LOGI(TAG_, "checkpoint preserved: page=%u state=%u cycle=%lu",
+                 static_cast<unsigned>(s_prev_.page),
+                 static_cast<unsigned>(s_prev_.test_state),
+                 static_cast<unsigned long>(s_prev_.cycle));
+    }
+
+    std::memset(&s_ckpt_, 0, sizeof(s_ckpt_));
+    s_ckpt_.magic = CKPT_MAGIC_;
+    s_armed_ = true;
+}
+
+bool session_restore::TakeRestore(Snapshot& out) noexcept
+{
+    if (!s_have_prev_) {
+        return false;
+    }
+    out = s_prev_;
+    s_have_prev_ = false;
+    return true;
+}
+
+void session_restore::NotePage(uint8_t page) noexcept
+{
+    if (s_armed_) {
+        s_ckpt_.snap.page = page;
+    }
+}
+
+void session_restore::NoteActiveUnit(const uint8_t mac[6]) noexcept
+{
+    if (s_armed_) {
+        std::memcpy(s_ckpt_.snap.unit_mac, mac, 6);
+    }
+}
+
+void session_restore::NoteStatus(uint8_t state, uint8_t err_code, uint32_t cycle) noexcept
+{
+    if (s_armed_) {
+        s_ckpt_.snap.test_state = state;
+        s_ckpt_.snap.err_code = err_code;
+        s_ckpt_.snap.cycle = cycle;
+    }
+}
+
+void session_restore::NotePendingCommand(uint8_t command_id) noexcept
+{
+    if (s_armed_) {
+        s_ckpt_.snap.pending_cmd = command_id;
+    }
+}
@@ -0,0 +1,63 @@
+/**
+ * @file session_restore.hpp
+ * @brief Session-state checkpoint in RTC RAM for instant crash recovery.
+ * @details Checkpoints the operator-visible session — current page, active
+ *          unit, last-known machine status and any journaled command still
+ *          pending delivery — into RTC noinit RAM on change. The writes are
+ *          plain word stores (no flash, no lock; the UI task is the only
+ *          writer), so checkpointing costs nothing on the tick path. After
+ *          a watchdog reset or panic mid-test the UI takes the snapshot at
+ *          boot and jumps straight back to the live view on the same unit,
+ *          reconciling actual machine state with one ConfigRequest instead
+ *          of making the operator renavigate while the machine keeps
+ *          cycling. Like the black box, the checkpoint survives warm resets
+ *          only — power loss leaves RTC RAM undefined and the magic check
+ *          rejects it.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace session_restore {
+
+/**
+ * @brief Previous session's checkpoint, as captured at boot
+ */
+struct Snapshot {
+    uint8_t page;         ///< ui::Page the operator was on
+    uint8_t unit_mac[6];  ///< Active unit's MAC (all-zero = none selected)
+    uint8_t test_state;   ///< Last-known fatigue_proto::TestState
+    uint8_t err_code;     ///< Last-known machine error code
+    uint32_t cycle;       ///< Last-known cycle count
+    uint8_t pending_cmd;  ///< Journaled command awaiting delivery (0 = none)
+};
+
+/**
+ * @brief Validate the checkpoint, capture the previous session, re-arm
+ * @details Call once at boot, after blackbox::Init(). A valid checkpoint
+ *          from a warm reset is held for TakeRestore(); the RTC copy is
+ *          then cleared for this session.
+ */
+void Init() noexcept;
+
+/**
+ * @brief Claim the previous session's snapshot (one-shot)
+ * @param out Filled with the snapshot when available
+ * @return true if a warm reset preserved a valid checkpoint
+ */
+bool TakeRestore(Snapshot& out) noexcept;
+
+/// Checkpoint the current UI page (UI task only).
+void NotePage(uint8_t page) noexcept;
+
+/// Checkpoint the active unit's MAC (UI task only).
+void NoteActiveUnit(const uint8_t mac[6]) noexcept;
+
+/// Checkpoint the active unit's last-known status (UI task only).
+void NoteStatus(uint8_t state, uint8_t err_code, uint32_t cycle) noexcept;
+
+/// Checkpoint a journaled command pending delivery; 0 clears (UI task only).
+void NotePendingCommand(uint8_t command_id) noexcept;
+
+} // namespace session_restore
@@ -6,15 +6,23 @@
 #include "settings.hpp"
 
 #include "esp_log.h"
+#include "esp_system.h"
 #include "nvs.h"
 #include "nvs_flash.h"
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+#include <cstdio>
 #include <cstring>
 
 static const char* TAG_ = "settings";
 
-static constexpr const char* NVS_NAMESPACE_ = "m5dial_rc";  ///< NVS namespace for settings
-static constexpr const char* NVS_KEY_BLOB_ = "settings";    ///< NVS key for settings blob
+static constexpr const char* NVS_NAMESPACE_ = "m5dial_rc";    ///< NVS namespace for settings
+static constexpr const char* NVS_KEY_BLOB_ = "settings";      ///< Legacy whole-blob key (pre-sectioning)
+static constexpr const char* NVS_KEY_TEST_UNIT_ = "test_unit";///< TestUnitSettings section key
+static constexpr const char* NVS_KEY_UI_ = "ui";              ///< UiSettings section key
 
 /**
  * @brief Compute CRC32-IEEE checksum
@@ -37,14 +45,71 @@ static uint32_t crc32_ieee(const uint8_t* data, size_t len) noexcept
 
 #pragma pack(push, 1)
 /**
- * @brief Settings blob with CRC32 for integrity checking
+ * @brief Legacy settings blob with CRC32 (whole Settings in one key)
+ * @details Kept for reading pre-sectioning images; the first sectioned
+ *          Save migrates the data and erases this key.
  */
 struct SettingsBlob {
     Settings settings;  ///< Settings data
     uint32_t crc32;     ///< CRC32 checksum of settings
 };
+
+/**
+ * @brief One persisted section: payload plus its own CRC32
+ */
+template <typename T>
+struct SectionBlob {
+    T payload;       ///< Section data
+    uint32_t crc32;  ///< CRC32 checksum of payload
+};
 #pragma pack(pop)
 
+/**
+ * @brief Read and validate one section blob
+ * @param handle Open NVS handle
+ * @param key Section key
+ * @param out Receives the payload on success; untouched otherwise
+ * @return true if the section existed, had the right size and a valid CRC
+ */
+template <typename T>
+static bool loadSection(nvs_handle_t handle, const char* key, T& out) noexcept
+{
+    SectionBlob<T> blob{};
+    size_t required = sizeof(blob);
+    if (nvs_get_blob(handle, key, &blob, &required) != ESP_OK || required != sizeof(blob)) {
+        return false;
+    }
+    const uint32_t calc =
+        crc32_ieee(reinterpret_cast<const uint8_t*>(&blob.payload), sizeof(blob.payload));
+    if (calc != blob.crc32) {
+        ESP_LOGW(TAG_, "section '%s' CRC mismatch; using defaults", key);
+        return false;
+    }
+    out = blob.payload;
+    return true;
+}
+
+/**
+ * @brief Stage one section blob (CRC appended) into the open transaction
+ * @details nvs_set_blob only stages; nothing reaches flash until the
+ *          caller's single nvs_commit.
+ */
+template <typename T>
+static bool writeSection(nvs_handle_t handle, const char* key, const T& payload) noexcept
+{
+    SectionBlob<T> blob{};
+    blob.payload = payload;
+    blob.crc32 = crc32_ieee(reinterpret_cast<const uint8_t*>(&blob.payload), sizeof(blob.payload));
+    return nvs_set_blob(handle, key, &blob, sizeof(blob)) == ESP_OK;
+}
+
+// Last image known to be committed. Save diffs new snapshots against it so
+// an untouched section is never rewritten (a brightness tweak no longer
+// costs a test-unit blob rewrite). Seeded by Load; afterwards only the
+// single settings writer path updates it, so no lock is needed.
+static Settings s_last_saved_{};
+static bool s_last_saved_valid_ = false;
+
 bool SettingsStore::Init() noexcept
 {
     esp_err_t err = nvs_flash_init();
@@ -61,33 +126,57 @@ bool SettingsStore::Init() noexcept
 
 Settings SettingsStore::Load() noexcept
 {
-    Settings defaults{};
+    Settings out{};
 
     nvs_handle_t handle;
     if (nvs_open(NVS_NAMESPACE_, NVS_READONLY, &handle) != ESP_OK) {
-        return defaults;
+        return out;
     }
 
-    SettingsBlob blob{};
-    size_t required = sizeof(blob);
-    esp_err_t err = nvs_get_blob(handle, NVS_KEY_BLOB_, &blob, &required);
-    nvs_close(handle);
-
-    if (err != ESP_OK || required != sizeof(blob)) {
-        return defaults;
-    }
+    const bool have_test_unit = loadSection(handle, NVS_KEY_TEST_UNIT_, out.test_unit);
+    const bool have_ui = loadSection(handle, NVS_KEY_UI_, out.ui);
 
-    const uint32_t calc = crc32_ieee(reinterpret_cast<const uint8_t*>(&blob.settings), sizeof(blob.settings));
-    if (calc != blob.crc32) {
-        ESP_LOGW(TAG_, "settings CRC mismatch; using defaults");
-        return defaults;
+    if (!have_test_unit && !have_ui) {
+        // Pre-sectioning image: read the legacy whole blob. The first Save
+        // rewrites it as sections and retires the old key.
+        SettingsBlob blob{};
+        size_t required = sizeof(blob);
+        if (nvs_get_blob(handle, NVS_KEY_BLOB_, &blob, &required) == ESP_OK &&
+            required == sizeof(blob)) {
+            const uint32_t calc = crc32_ieee(reinterpret_cast<const uint8_t*>(&blob.settings),
+                                             sizeof(blob.settings));
+            if (calc == blob.crc32) {
+                out = blob.settings;
+            } else {
+                ESP_LOGW(TAG_, "settings CRC mismatch; using defaults");
+            }
+        }
+        nvs_close(handle);
+        // Leave the diff baseline invalid so the first Save writes every
+        // section (completing the migration).
+        return out;
     }
+    nvs_close(handle);
 
-    return blob.settings;
+    s_last_saved_ = out;
+    s_last_saved_valid_ = true;
+    return out;
 }
 
 bool SettingsStore::Save(const Settings& settings) noexcept
 {
+    // Dirty-section transaction: only sections that differ from the last
+    // committed image are staged, and everything staged rides one commit.
+    const bool test_unit_dirty =
+        !s_last_saved_valid_ ||
+        std::memcmp(&settings.test_unit, &s_last_saved_.test_unit, sizeof(settings.test_unit)) != 0;
+    const bool ui_dirty =
+        !s_last_saved_valid_ ||
+        std::memcmp(&settings.ui, &s_last_saved_.ui, sizeof(settings.ui)) != 0;
+    if (!test_unit_dirty && !ui_dirty) {
+        return true;  // Nothing changed since the last commit.
+    }
+
     nvs_handle_t handle;
     esp_err_t err = nvs_open(NVS_NAMESPACE_, NVS_READWRITE, &handle);
     if (err != ESP_OK) {
@@ -95,19 +184,365 @@ bool SettingsStore::Save(const Settings& settings) noexcept
         return false;
     }
 
-    SettingsBlob blob{};
-    blob.settings = settings;
-    blob.crc32 = crc32_ieee(reinterpret_cast<const uint8_t*>(&blob.settings), sizeof(blob.settings));
-
-    err = nvs_set_blob(handle, NVS_KEY_BLOB_, &blob, sizeof(blob));
-    if (err == ESP_OK) {
+    bool ok = true;
+    if (test_unit_dirty) {
+        ok = writeSection(handle, NVS_KEY_TEST_UNIT_, settings.test_unit) && ok;
+    }
+    if (ui_dirty) {
+        ok = writeSection(handle, NVS_KEY_UI_, settings.ui) && ok;
+    }
+    if (!s_last_saved_valid_) {
+        // First sectioned save over a legacy image: retire the old key.
+        // ESP_ERR_NVS_NOT_FOUND (fresh device) is fine.
+        (void)nvs_erase_key(handle, NVS_KEY_BLOB_);
+    }
+    if (ok) {
         err = nvs_commit(handle);
     }
     nvs_close(handle);
 
-    if (err != ESP_OK) {
+    if (!ok || err != ESP_OK) {
         ESP_LOGE(TAG_, "Save failed: %s", esp_err_to_name(err));
         return false;
     }
+    s_last_saved_ = settings;
+    s_last_saved_valid_ = true;
+    return true;
+}
+
+// ============================================================================
+// ASYNC PERSISTENCE
+// ============================================================================
+
+static constexpr uint32_t SAVE_DEBOUNCE_MS_ = 500;      ///< Coalescing window
+static constexpr uint32_t WRITER_TASK_STACK_ = 3072;    ///< Writer stack size
+static constexpr UBaseType_t WRITER_TASK_PRIO_ = 1;     ///< Just above idle
+
+static QueueHandle_t s_save_queue_ = nullptr;  ///< Depth 1; newest snapshot wins
+static Settings s_pending_{};                  ///< Snapshot the writer is holding
+static volatile bool s_pending_dirty_ = false; ///< Snapshot not yet committed
+
+/**
+ * @brief Low-priority writer task: debounce, coalesce, commit
+ * @details Blocks until a snapshot arrives, then keeps absorbing newer
+ *          snapshots until the debounce window passes without one, and
+ *          commits only the final state. A burst of UI saves thus costs a
+ *          single flash commit.
+ */
+static void settingsWriterTask(void* /*arg*/)
+{
+    while (true) {
+        if (xQueueReceive(s_save_queue_, &s_pending_, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        s_pending_dirty_ = true;
+        while (xQueueReceive(s_save_queue_, &s_pending_, pdMS_TO_TICKS(SAVE_DEBOUNCE_MS_)) == pdTRUE) {
+        }
+        if (SettingsStore::Save(s_pending_)) {
+            s_pending_dirty_ = false;
+        }
+    }
+}
+
+/** @brief Shutdown hook: commit whatever the writer has not flushed yet. */
+static void settingsShutdownFlush(void)
+{
+    SettingsStore::Flush();
+}
+
+void SettingsStore::SaveAsync(const Settings& settings) noexcept
+{
+    if (s_save_queue_ == nullptr) {
+        s_save_queue_ = xQueueCreate(1, sizeof(Settings));
+        if (s_save_queue_ == nullptr ||
+            xTaskCreate(settingsWriterTask, "settings_wr", WRITER_TASK_STACK_, nullptr,
+                        WRITER_TASK_PRIO_, nullptr) != pdPASS) {
+            ESP_LOGW(TAG_, "Async writer unavailable; saving synchronously");
+            if (s_save_queue_ != nullptr) {
+                vQueueDelete(s_save_queue_);
+                s_save_queue_ = nullptr;
+            }
+            (void)Save(settings);
+            return;
+        }
+        (void)esp_register_shutdown_handler(&settingsShutdownFlush);
+    }
+    (void)xQueueOverwrite(s_save_queue_, &settings);
+}
+
+void SettingsStore::Flush() noexcept
+{
+    if (s_save_queue_ != nullptr) {
+        if (xQueueReceive(s_save_queue_, &s_pending_, 0) == pdTRUE) {
+            s_pending_dirty_ = true;
+        }
+    }
+    if (s_pending_dirty_) {
+        if (Save(s_pending_)) {
+            s_pending_dirty_ = false;
+        }
+    }
+}
+
+// ============================================================================
+// NAMED PROFILES
+// ============================================================================
+
+static constexpr const char* NVS_KEY_PROFILE_PEERS_ = "prof_peers";  ///< Peer->slot map key
+
+/** @brief One peer->profile association */
+#pragma pack(push, 1)
+struct ProfilePeerEntry {
+    uint8_t mac[6];  ///< Peer MAC
+    int8_t slot;     ///< Profile slot last applied to it
+    uint8_t used;    ///< Entry holds data
+};
+
+/** @brief Persisted peer->profile map (one section) */
+struct ProfilePeerMap {
+    ProfilePeerEntry entries[8];
+};
+#pragma pack(pop)
+
+// RAM cache of the peer map; loaded on first use, rewritten only when an
+// association actually changes. All callers run on the UI task.
+static ProfilePeerMap s_peer_map_{};
+static bool s_peer_map_loaded_ = false;
+static uint8_t s_peer_map_evict_ = 0;  ///< Round-robin victim when full
+
+/** @brief Build the NVS key for a profile slot ("prof0".."prof3") */
+static void profileKey(uint8_t slot, char* out, size_t cap) noexcept
+{
+    snprintf(out, cap, "prof%u", static_cast<unsigned>(slot));
+}
+
+/** @brief Load the peer map section into the RAM cache (idempotent) */
+static void ensurePeerMapLoaded() noexcept
+{
+    if (s_peer_map_loaded_) {
+        return;
+    }
+    s_peer_map_loaded_ = true;  // missing section just leaves the zeroed map
+    nvs_handle_t handle;
+    if (nvs_open(NVS_NAMESPACE_, NVS_READONLY, &handle) != ESP_OK) {
+        return;
+    }
+    (void)loadSection(handle, NVS_KEY_PROFILE_PEERS_, s_peer_map_);
+    nvs_close(handle);
+}
+
+bool SettingsStore::LoadProfile(uint8_t slot, SettingsProfile& out) noexcept
+{
+    if (slot >= kProfileSlots) {
+        return false;
+    }
+    nvs_handle_t handle;
+    if (nvs_open(NVS_NAMESPACE_, NVS_READONLY, &handle) != ESP_OK) {
+        return false;
+    }
+    char key[8];
+    profileKey(slot, key, sizeof(key));
+    const bool ok = loadSection(handle, key, out);
+    nvs_close(handle);
+    return ok;
+}
+
+bool SettingsStore::SaveProfile(uint8_t slot, const SettingsProfile& profile) noexcept
+{
+    if (slot >= kProfileSlots) {
+        return false;
+    }
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(NVS_NAMESPACE_, NVS_READWRITE, &handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG_, "nvs_open failed: %s", esp_err_to_name(err));
+        return false;
+    }
+    char key[8];
+    profileKey(slot, key, sizeof(key));
+    bool ok = writeSection(handle, key, profile);
+    if (ok) {
+        err = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    if (!ok || err != ESP_OK) {
+        ESP_LOGE(TAG_, "profile save failed: %s", esp_err_to_name(err));
+        return false;
+    }
     return true;
 }
+
+int8_t SettingsStore::ProfileForPeer(const uint8_t mac[6]) noexcept
+{
+    ensurePeerMapLoaded();
+    for (const auto& e : s_peer_map_.entries) {
+        if (e.used != 0 && std::memcmp(e.mac, mac, 6) == 0) {
+            return e.slot;
+        }
+    }
+    return -1;
+}
+
+void SettingsStore::NoteProfileForPeer(const uint8_t mac[6], uint8_t slot) noexcept
+{
+    ensurePeerMapLoaded();
+
+    ProfilePeerEntry* target = nullptr;
+    for (auto& e : s_peer_map_.entries) {
+        if (e.used != 0 && std::memcmp(e.mac, mac, 6) == 0) {
+            if (e.slot == static_cast<int8_t>(slot)) {
+                return;  // Unchanged: skip the flash write.
+            }
+            target = &e;
+            break;
+        }
+    }
+    if (target == nullptr) {
+        for (auto& e : s_peer_map_.entries) {
+            if (e.used == 0) {
+                target = &e;
+                break;
+            }
+        }
+    }
+    if (target == nullptr) {
+        // Map full: evict round-robin. Eight entries outlast any realistic
+        // fleet, so this is a safety valve, not a policy.
+        target = &s_peer_map_.entries[s_peer_map_evict_];
+        s_peer_map_evict_ =
+            static_cast<uint8_t>((s_peer_map_evict_ + 1) %
+                                 (sizeof(s_peer_map_.entries) / sizeof(s_peer_map_.entries[0])));
+    }
+    std::memcpy(target->mac, mac, 6);
+    target->slot = static_cast<int8_t>(slot);
+    target->used = 1;
+
+    nvs_handle_t handle;
+    if (nvs_open(NVS_NAMESPACE_, NVS_READWRITE, &handle) != ESP_OK) {
+        return;
+    }
+    if (writeSection(handle, NVS_KEY_PROFILE_PEERS_, s_peer_map_)) {
+        (void)nvs_commit(handle);
+    }
+    nvs_close(handle);
+}
+
+// ============================================================================
+// PER-PEER BOUNDS CACHE
+// ============================================================================
+
+static constexpr const char* NVS_KEY_BOUNDS_PEERS_ = "bnd_peers";  ///< Peer->bounds map key
+
+/** @brief One peer->bounds association */
+#pragma pack(push, 1)
+struct BoundsPeerEntry {
+    uint8_t mac[6];      ///< Peer MAC
+    PeerBounds bounds;   ///< Last result heard from it
+    uint8_t used;        ///< Entry holds data
+};
+
+/** @brief Persisted peer->bounds map (one section) */
+struct BoundsPeerMap {
+    BoundsPeerEntry entries[8];
+};
+#pragma pack(pop)
+
+// RAM cache of the bounds map; same lifecycle as the profile peer map
+// above (loaded on first use, rewritten only on change, UI task only).
+static BoundsPeerMap s_bounds_map_{};
+static bool s_bounds_map_loaded_ = false;
+static uint8_t s_bounds_map_evict_ = 0;  ///< Round-robin victim when full
+
+/** @brief Load the bounds map section into the RAM cache (idempotent) */
+static void ensureBoundsMapLoaded() noexcept
+{
+    if (s_bounds_map_loaded_) {
+        return;
+    }
+    s_bounds_map_loaded_ = true;  // missing section just leaves the zeroed map
+    nvs_handle_t handle;
+    if (nvs_open(NVS_NAMESPACE_, NVS_READONLY, &handle) != ESP_OK) {
+        return;
+    }
+    (void)loadSection(handle, NVS_KEY_BOUNDS_PEERS_, s_bounds_map_);
+    nvs_close(handle);
+}
+
+/** @brief Commit the RAM bounds map back to its NVS section */
+static void saveBoundsMap() noexcept
+{
+    nvs_handle_t handle;
+    if (nvs_open(NVS_NAMESPACE_, NVS_READWRITE, &handle) != ESP_OK) {
+        return;
+    }
+    if (writeSection(handle, NVS_KEY_BOUNDS_PEERS_, s_bounds_map_)) {
+        (void)nvs_commit(handle);
+    }
+    nvs_close(handle);
+}
+
+bool SettingsStore::BoundsForPeer(const uint8_t mac[6], PeerBounds& out) noexcept
+{
+    ensureBoundsMapLoaded();
+    for (const auto& e : s_bounds_map_.entries) {
+        if (e.used != 0 && std::memcmp(e.mac, mac, 6) == 0) {
+            out = e.bounds;
+            return true;
+        }
+    }
+    return false;
+}
+
+void SettingsStore::NoteBoundsForPeer(const uint8_t mac[6], const PeerBounds& bounds) noexcept
+{
+    ensureBoundsMapLoaded();
+
+    // Field-wise compare: PeerBounds carries tail padding, so memcmp of the
+    // whole struct would see stack garbage.
+    const auto same = [](const PeerBounds& a, const PeerBounds& b) noexcept {
+        return a.min_deg == b.min_deg && a.max_deg == b.max_deg &&
+               a.global_min_deg == b.global_min_deg && a.global_max_deg == b.global_max_deg &&
+               a.bounded == b.bounded;
+    };
+
+    BoundsPeerEntry* target = nullptr;
+    for (auto& e : s_bounds_map_.entries) {
+        if (e.used != 0 && std::memcmp(e.mac, mac, 6) == 0) {
+            if (same(e.bounds, bounds)) {
+                return;  // Unchanged: skip the flash write.
+            }
+            target = &e;
+            break;
+        }
+    }
+    if (target == nullptr) {
+        for (auto& e : s_bounds_map_.entries) {
+            if (e.used == 0) {
+                target = &e;
+                break;
+            }
+        }
+    }
+    if (target == nullptr) {
+        target = &s_bounds_map_.entries[s_bounds_map_evict_];
+        s_bounds_map_evict_ =
+            static_cast<uint8_t>((s_bounds_map_evict_ + 1) %
+                                 (sizeof(s_bounds_map_.entries) / sizeof(s_bounds_map_.entries[0])));
+    }
+    std::memcpy(target->mac, mac, 6);
+    target->bounds = bounds;
+    target->used = 1;
+    saveBoundsMap();
+}
+
+void SettingsStore::ClearBoundsForPeer(const uint8_t mac[6]) noexcept
+{
+    ensureBoundsMapLoaded();
+    for (auto& e : s_bounds_map_.entries) {
+        if (e.used != 0 && std::memcmp(e.mac, mac, 6) == 0) {
+            e = BoundsPeerEntry{};
+            saveBoundsMap();
+            return;
+        }
+    }
+}
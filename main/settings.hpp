@@ -1,7 +1,9 @@
 /**
  * @file settings.hpp
  * @brief Persistent settings (NVS + CRC32).
- * @details Provides settings structures and NVS-based storage with CRC32 validation.
+ * @details Provides settings structures and NVS-based storage. Each settings
+ *          section (test_unit, ui) persists under its own key with its own
+ *          CRC32; saves rewrite only the sections that changed.
  */
 
 #pragma once
@@ -36,6 +38,34 @@ struct UiSettings {
     uint8_t brightness = 128;                         ///< Display brightness (0-255, default 50%)
 };
 
+/**
+ * @brief Named snapshot of the test-unit parameters (one fixture setup)
+ * @details Each fixture type has its own known-good TestUnitSettings;
+ *          profiles let operators recall them instead of re-keying at
+ *          every changeover. UI settings stay out on purpose - they
+ *          belong to the remote, not the fixture.
+ */
+struct SettingsProfile {
+    char name[16] = {0};          ///< Display name (NUL-terminated)
+    TestUnitSettings test_unit;   ///< The snapshot itself
+};
+
+/**
+ * @brief Last bounds-finding result known for one fixture
+ * @details Cached so the Bounds page can show a unit's previous limits
+ *          immediately instead of forcing a search just to see them. The
+ *          unit remains the authority: entries are dropped the moment it
+ *          reports its own bounds invalid (motor power cycled, fixture
+ *          changed).
+ */
+struct PeerBounds {
+    float min_deg = 0.0f;         ///< Min limit (degrees from center)
+    float max_deg = 0.0f;         ///< Max limit (degrees from center)
+    float global_min_deg = 0.0f;  ///< Absolute min encoder angle (degrees)
+    float global_max_deg = 0.0f;  ///< Absolute max encoder angle (degrees)
+    uint8_t bounded = 0;          ///< 1 = real limits found, 0 = default range
+};
+
 /**
  * @brief Complete application settings
  */
@@ -58,14 +88,99 @@ public:
     
     /**
      * @brief Load settings from NVS
+     * @details Reads each section independently (a corrupt section falls
+     *          back to defaults alone); a pre-sectioning whole-blob image
+     *          is read transparently and migrated on the next Save.
      * @return Loaded settings, or default settings if load fails or CRC mismatch
      */
     static Settings Load() noexcept;
-    
+
     /**
-     * @brief Save settings to NVS with CRC32
+     * @brief Save settings to NVS with per-section CRC32
+     * @details Diffs against the last committed image and stages only the
+     *          dirty sections into a single commit, so a brightness tweak
+     *          no longer rewrites the test-unit parameters. Synchronous:
+     *          the NVS commit can stall tens of milliseconds on a flash
+     *          erase. UI paths should use SaveAsync() instead.
      * @param settings Settings to save
-     * @return true if save successful, false otherwise
+     * @return true if save successful (or nothing changed), false otherwise
      */
     static bool Save(const Settings& settings) noexcept;
+
+    /**
+     * @brief Queue settings for persistence on the background writer task
+     * @details Hands a snapshot to a low-priority writer so the caller never
+     *          blocks on flash. Saves arriving within the debounce window
+     *          coalesce into a single commit; only the newest snapshot is
+     *          written. The writer is created lazily on first use and a
+     *          shutdown handler flushes any pending snapshot. Falls back to
+     *          a synchronous Save() if the writer cannot be created.
+     * @param settings Settings to save
+     */
+    static void SaveAsync(const Settings& settings) noexcept;
+
+    /**
+     * @brief Synchronously commit any snapshot still pending in the writer
+     * @details Registered as a shutdown handler; safe to call at any time.
+     */
+    static void Flush() noexcept;
+
+    // ------------------------------------------------------------------
+    // Named profiles: per-fixture TestUnitSettings snapshots, each slot a
+    // CRC-guarded section of its own, plus a small per-peer map
+    // remembering which profile was last applied to which unit so a unit
+    // switch can offer the right one.
+    // ------------------------------------------------------------------
+
+    static constexpr uint8_t kProfileSlots = 4;  ///< Persisted profile slots
+
+    /**
+     * @brief Read one profile slot
+     * @param slot Slot index [0, kProfileSlots)
+     * @param out Receives the profile on success; untouched otherwise
+     * @return true if the slot held a valid (CRC-checked) profile
+     */
+    static bool LoadProfile(uint8_t slot, SettingsProfile& out) noexcept;
+
+    /**
+     * @brief Write one profile slot (synchronous commit; click-driven, rare)
+     */
+    static bool SaveProfile(uint8_t slot, const SettingsProfile& profile) noexcept;
+
+    /**
+     * @brief Profile slot last applied to this peer, or -1 if none known
+     */
+    static int8_t ProfileForPeer(const uint8_t mac[6]) noexcept;
+
+    /**
+     * @brief Remember @p slot as the profile last applied to @p mac
+     * @details No-op (and no flash write) when the mapping is unchanged.
+     */
+    static void NoteProfileForPeer(const uint8_t mac[6], uint8_t slot) noexcept;
+
+    // ------------------------------------------------------------------
+    // Per-peer bounds cache: the last bounds-finding result heard from
+    // each unit, so the previous limits survive a remote reboot. Same
+    // small fixed map as the profile associations.
+    // ------------------------------------------------------------------
+
+    /**
+     * @brief Last bounds result cached for this peer
+     * @param mac Peer MAC
+     * @param out Receives the cached result on success; untouched otherwise
+     * @return true if a cached result exists for @p mac
+     */
+    static bool BoundsForPeer(const uint8_t mac[6], PeerBounds& out) noexcept;
+
+    /**
+     * @brief Cache @p bounds as the last result heard from @p mac
+     * @details No-op (and no flash write) when the cached values match.
+     */
+    static void NoteBoundsForPeer(const uint8_t mac[6], const PeerBounds& bounds) noexcept;
+
+    /**
+     * @brief Drop the cached result for @p mac (unit reported bounds invalid)
+     * @details No-op (and no flash write) when no entry exists.
+     */
+    static void ClearBoundsForPeer(const uint8_t mac[6]) noexcept;
 };
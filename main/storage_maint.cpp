@@ -0,0 +1,347 @@
+/**
+ * @file storage_maint.cpp
+ * @brief Implementation of NVS health monitoring and boot-time compaction
+ */
+
+#include "storage_maint.hpp"
+
+#include "fast_boot.hpp"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "nvs.h"
+#include "nvs_flash.h"
+
+#include <cstring>
+
+static const char* TAG_ = "storage";
+
+namespace {
+
+constexpr const char* NVS_NAMESPACE_ = "m5dial_sm";  ///< Our own bookkeeping
+constexpr const char* NVS_KEY_REQ_ = "req";          ///< Compaction requested flag
+constexpr const char* NVS_KEY_COUNT_ = "count";      ///< Lifetime compaction count
+
+constexpr uint32_t SERVICE_PERIOD_MS_ = 60000;  ///< Runtime re-check cadence
+constexpr uint32_t PROBE_SLOW_US_ = 3000;       ///< Probe latency considered degraded
+
+// Snapshot budget for compaction. Our four namespaces hold a few dozen
+// small entries; a partition that does not fit here is not ours to wipe.
+constexpr size_t SNAP_MAX_ENTRIES_ = 64;
+constexpr size_t SNAP_ARENA_BYTES_ = 8192;
+
+/// One live entry captured before the erase
+struct SnapEntry {
+    char ns[NVS_NS_NAME_MAX_SIZE];    ///< Namespace name
+    char key[NVS_KEY_NAME_MAX_SIZE];  ///< Key name
+    nvs_type_t type;                  ///< Value type
+    size_t len;                       ///< Value length in the arena
+    size_t off;                       ///< Value offset in the arena
+};
+
+storage_maint::Health s_health_{};
+uint32_t s_last_service_ms_ = 0;
+
+/**
+ * @brief Refresh entry utilization from the in-RAM NVS statistics
+ */
+void refreshStats_() noexcept
+{
+    nvs_stats_t stats{};
+    if (nvs_get_stats(nullptr, &stats) == ESP_OK) {
+        s_health_.used_entries = static_cast<uint16_t>(stats.used_entries);
+        s_health_.total_entries = static_cast<uint16_t>(stats.total_entries);
+    }
+}
+
+/**
+ * @brief Degradation rule shared by the boot check and the runtime check
+ * @details Either the partition is nearly full of live entries (lookups
+ *          scan them all) or the boot probe read came back slow.
+ */
+bool degraded_() noexcept
+{
+    const uint32_t used = s_health_.used_entries;
+    const uint32_t total = s_health_.total_entries;
+    if (total > 0 && used * 8 >= total * 7) {
+        return true;
+    }
+    return s_health_.probe_us > PROBE_SLOW_US_;
+}
+
+/**
+ * @brief Time a representative boot read (settings test-unit section)
+ * @return Latency in microseconds, 0 if the key does not exist yet
+ */
+uint32_t probeRead_() noexcept
+{
+    uint8_t buf[128];
+    size_t len = sizeof(buf);
+    const int64_t t0 = esp_timer_get_time();
+    nvs_handle_t handle;
+    if (nvs_open("m5dial_rc", NVS_READONLY, &handle) != ESP_OK) {
+        return 0;  // fresh device; nothing to measure
+    }
+    const esp_err_t err = nvs_get_blob(handle, "test_unit", buf, &len);
+    nvs_close(handle);
+    if (err != ESP_OK && err != ESP_ERR_NVS_INVALID_LENGTH) {
+        return 0;
+    }
+    return static_cast<uint32_t>(esp_timer_get_time() - t0);
+}
+
+/**
+ * @brief Read one value of any supported type into the arena
+ */
+bool snapValue_(nvs_handle_t h, SnapEntry& e, uint8_t* arena, size_t& arena_used) noexcept
+{
+    size_t len = 0;
+    uint8_t* dst = arena + arena_used;
+    const size_t room = SNAP_ARENA_BYTES_ - arena_used;
+    esp_err_t err = ESP_FAIL;
+    switch (e.type) {
+        case NVS_TYPE_U8:
+        case NVS_TYPE_I8:
+            len = 1;
+            if (len > room) return false;
+            err = nvs_get_u8(h, e.key, dst);
+            break;
+        case NVS_TYPE_U16:
+        case NVS_TYPE_I16:
+            len = 2;
+            if (len > room) return false;
+            err = nvs_get_u16(h, e.key, reinterpret_cast<uint16_t*>(dst));
+            break;
+        case NVS_TYPE_U32:
+        case NVS_TYPE_I32:
+            len = 4;
+            if (len > room) return false;
+            err = nvs_get_u32(h, e.key, reinterpret_cast<uint32_t*>(dst));
+            break;
+        case NVS_TYPE_U64:
+        case NVS_TYPE_I64:
+            len = 8;
+            if (len > room) return false;
+            err = nvs_get_u64(h, e.key, reinterpret_cast<uint64_t*>(dst));
+            break;
+        case NVS_TYPE_STR:
+            err = nvs_get_str(h, e.key, nullptr, &len);
+            if (err != ESP_OK || len > room) return false;
+            err = nvs_get_str(h, e.key, reinterpret_cast<char*>(dst), &len);
+            break;
+        case NVS_TYPE_BLOB:
+            err = nvs_get_blob(h, e.key, nullptr, &len);
+            if (err != ESP_OK || len > room) return false;
+            err = nvs_get_blob(h, e.key, dst, &len);
+            break;
+        default:
+            return false;
+    }
+    if (err != ESP_OK) {
+        return false;
+    }
+    e.len = len;
+    e.off = arena_used;
+    arena_used += len;
+    return true;
+}
+
+/**
+ * @brief Write one snapshotted value back after the erase
+ */
+bool restoreValue_(nvs_handle_t h, const SnapEntry& e, const uint8_t* arena) noexcept
+{
+    const uint8_t* src = arena + e.off;
+    switch (e.type) {
+        case NVS_TYPE_U8:
+        case NVS_TYPE_I8:
+            return nvs_set_u8(h, e.key, *src) == ESP_OK;
+        case NVS_TYPE_U16:
+        case NVS_TYPE_I16: {
+            uint16_t v;
+            std::memcpy(&v, src, sizeof(v));
+            return nvs_set_u16(h, e.key, v) == ESP_OK;
+        }
+        case NVS_TYPE_U32:
+        case NVS_TYPE_I32: {
+            uint32_t v;
+            std::memcpy(&v, src, sizeof(v));
+            return nvs_set_u32(h, e.key, v) == ESP_OK;
+        }
+        case NVS_TYPE_U64:
+        case NVS_TYPE_I64: {
+            uint64_t v;
+            std::memcpy(&v, src, sizeof(v));
+            return nvs_set_u64(h, e.key, v) == ESP_OK;
+        }
+        case NVS_TYPE_STR:
+            return nvs_set_str(h, e.key, reinterpret_cast<const char*>(src)) == ESP_OK;
+        case NVS_TYPE_BLOB:
+            return nvs_set_blob(h, e.key, src, e.len) == ESP_OK;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Snapshot every live entry, erase the partition, rewrite
+ * @details Nothing is erased until the snapshot is complete, so an abort
+ *          (too many entries, unreadable value) leaves the partition
+ *          untouched. Power loss between erase and rewrite loses the
+ *          snapshot — the same exposure as the factory NVS recovery path
+ *          in app_main, and the reason this runs only when degradation
+ *          was actually detected.
+ */
+bool compact_() noexcept
+{
+    static SnapEntry entries[SNAP_MAX_ENTRIES_];
+    static uint8_t arena[SNAP_ARENA_BYTES_];
+    size_t count = 0;
+    size_t arena_used = 0;
+
+    nvs_iterator_t it = nullptr;
+    esp_err_t err = nvs_entry_find(NVS_DEFAULT_PART_NAME, nullptr, NVS_TYPE_ANY, &it);
+    while (err == ESP_OK) {
+        nvs_entry_info_t info{};
+        nvs_entry_info(it, &info);
+        if (count >= SNAP_MAX_ENTRIES_) {
+            ESP_LOGW(TAG_, "Compaction aborted: more than %u entries",
+                     static_cast<unsigned>(SNAP_MAX_ENTRIES_));
+            nvs_release_iterator(it);
+            return false;
+        }
+        SnapEntry& e = entries[count];
+        std::memcpy(e.ns, info.namespace_name, sizeof(e.ns));
+        std::memcpy(e.key, info.key, sizeof(e.key));
+        e.type = info.type;
+        nvs_handle_t h;
+        if (nvs_open(e.ns, NVS_READONLY, &h) != ESP_OK) {
+            nvs_release_iterator(it);
+            return false;
+        }
+        const bool ok = snapValue_(h, e, arena, arena_used);
+        nvs_close(h);
+        if (!ok) {
+            ESP_LOGW(TAG_, "Compaction aborted: cannot snapshot %s/%s", e.ns, e.key);
+            nvs_release_iterator(it);
+            return false;
+        }
+        ++count;
+        err = nvs_entry_next(&it);
+    }
+    nvs_release_iterator(it);
+
+    ESP_LOGI(TAG_, "Compacting NVS: %u entries, %u bytes",
+             static_cast<unsigned>(count), static_cast<unsigned>(arena_used));
+
+    if (nvs_flash_deinit() != ESP_OK || nvs_flash_erase() != ESP_OK ||
+        nvs_flash_init() != ESP_OK) {
+        // Leave recovery to the standard no-free-pages path in app_main.
+        ESP_LOGE(TAG_, "Compaction erase/reinit failed");
+        return false;
+    }
+
+    size_t restored = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const SnapEntry& e = entries[i];
+        if (std::strcmp(e.ns, NVS_NAMESPACE_) == 0 &&
+            std::strcmp(e.key, NVS_KEY_REQ_) == 0) {
+            continue;  // the request flag is consumed by the compaction
+        }
+        nvs_handle_t h;
+        if (nvs_open(e.ns, NVS_READWRITE, &h) != ESP_OK) {
+            continue;
+        }
+        if (restoreValue_(h, e, arena)) {
+            ++restored;
+        }
+        (void)nvs_commit(h);
+        nvs_close(h);
+    }
+    ESP_LOGI(TAG_, "Compaction done: %u/%u entries restored",
+             static_cast<unsigned>(restored), static_cast<unsigned>(count));
+    return true;
+}
+
+/**
+ * @brief Persist the compaction request for the next boot (one commit)
+ */
+void scheduleCompaction_() noexcept
+{
+    nvs_handle_t h;
+    if (nvs_open(NVS_NAMESPACE_, NVS_READWRITE, &h) != ESP_OK) {
+        return;
+    }
+    if (nvs_set_u8(h, NVS_KEY_REQ_, 1) == ESP_OK && nvs_commit(h) == ESP_OK) {
+        s_health_.compaction_pending = true;
+        ESP_LOGW(TAG_, "NVS degraded (%u/%u entries, probe %luus); compaction at next boot",
+                 static_cast<unsigned>(s_health_.used_entries),
+                 static_cast<unsigned>(s_health_.total_entries),
+                 static_cast<unsigned long>(s_health_.probe_us));
+    }
+    nvs_close(h);
+}
+
+} // namespace
+
+void storage_maint::Init() noexcept
+{
+    // Consume a request the previous session persisted.
+    uint8_t req = 0;
+    uint32_t compactions = 0;
+    nvs_handle_t h;
+    if (nvs_open(NVS_NAMESPACE_, NVS_READONLY, &h) == ESP_OK) {
+        (void)nvs_get_u8(h, NVS_KEY_REQ_, &req);
+        (void)nvs_get_u32(h, NVS_KEY_COUNT_, &compactions);
+        nvs_close(h);
+    }
+    if (req != 0) {
+        if (compact_()) {
+            ++compactions;
+            if (nvs_open(NVS_NAMESPACE_, NVS_READWRITE, &h) == ESP_OK) {
+                (void)nvs_set_u32(h, NVS_KEY_COUNT_, compactions);
+                (void)nvs_commit(h);
+                nvs_close(h);
+            }
+        } else if (nvs_open(NVS_NAMESPACE_, NVS_READWRITE, &h) == ESP_OK) {
+            // Clear the flag so a hopeless request does not retry forever.
+            (void)nvs_erase_key(h, NVS_KEY_REQ_);
+            (void)nvs_commit(h);
+            nvs_close(h);
+        }
+    }
+    s_health_.compactions = compactions;
+    s_health_.compaction_pending = false;
+
+    // The timed probe exists to catch slow lookups accreting across long
+    // deployments; a warm reset seconds after the last check learns nothing
+    // from it, so the fast path skips straight to the (in-RAM) stats. The
+    // runtime re-check in Service() picks degradation up within a minute.
+    s_health_.probe_us = fast_boot::IsWarm() ? 0 : probeRead_();
+    refreshStats_();
+    ESP_LOGI(TAG_, "NVS health: %u/%u entries, probe %luus, %lu compactions",
+             static_cast<unsigned>(s_health_.used_entries),
+             static_cast<unsigned>(s_health_.total_entries),
+             static_cast<unsigned long>(s_health_.probe_us),
+             static_cast<unsigned long>(s_health_.compactions));
+}
+
+void storage_maint::Service(uint32_t now_ms) noexcept
+{
+    if (now_ms - s_last_service_ms_ < SERVICE_PERIOD_MS_) {
+        return;
+    }
+    s_last_service_ms_ = now_ms;
+    if (s_health_.compaction_pending) {
+        return;  // already scheduled
+    }
+    refreshStats_();
+    if (degraded_()) {
+        scheduleCompaction_();
+    }
+}
+
+void storage_maint::GetHealth(Health& out) noexcept
+{
+    out = s_health_;
+}
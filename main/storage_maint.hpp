@@ -0,0 +1,67 @@
+/**
+ * @file storage_maint.hpp
+ * @brief NVS health monitoring and boot-time compaction.
+ * @details NVS lookups scan live entries, so reads get slower as the
+ *          partition fills with our write traffic (settings sections,
+ *          lifecycle batches, peer records, panel tuner results). This
+ *          module keeps boot reads flat over the device's life: Init
+ *          measures entry utilization and a timed probe read right after
+ *          nvs_flash_init, logs the health line, and — when the previous
+ *          session flagged degradation — compacts the partition by
+ *          snapshotting every live entry to RAM, erasing, and rewriting.
+ *          Compaction runs only at boot, before any other task owns an
+ *          NVS handle, so no coordination with the settings writer or
+ *          lifecycle commits is needed. Service does the cheap runtime
+ *          part: it re-checks the in-RAM statistics on a minute cadence
+ *          and persists the compaction request for the next boot.
+ *
+ *          The per-subsystem loads stay with their owners (each already
+ *          reads its namespace once through a single handle); what ages
+ *          is the lookup cost underneath them, and that is what the
+ *          compaction resets.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace storage_maint {
+
+/**
+ * @brief Health snapshot from the last Init/Service check (see GetHealth)
+ */
+struct Health {
+    uint16_t used_entries;   ///< Live NVS entries
+    uint16_t total_entries;  ///< Partition capacity in entries
+    uint32_t probe_us;       ///< Boot probe read latency (0 until measured)
+    bool compaction_pending; ///< A compaction is scheduled for next boot
+    uint32_t compactions;    ///< Compactions performed over the device's life
+};
+
+/**
+ * @brief Boot check and (if flagged) compaction
+ * @details Call once at boot, immediately after nvs_flash_init() and
+ *          before any other subsystem opens NVS. Runs the compaction the
+ *          previous session requested, then measures utilization and the
+ *          probe read and logs the health line. Compaction is abandoned
+ *          (and the flag cleared) if the snapshot would not fit its RAM
+ *          budget; nothing is erased before the snapshot is complete.
+ */
+void Init() noexcept;
+
+/**
+ * @brief Periodic health re-check; schedules compaction when degraded
+ * @details Call from a housekeeping path (any cadence up to ~1 min is
+ *          fine); self-throttled to a minute. Reads only the in-RAM NVS
+ *          statistics — no flash traffic — except the single commit that
+ *          persists a newly raised compaction request.
+ * @param now_ms Current uptime in milliseconds
+ */
+void Service(uint32_t now_ms) noexcept;
+
+/**
+ * @brief Copy out the latest health snapshot
+ */
+void GetHealth(Health& out) noexcept;
+
+} // namespace storage_maint
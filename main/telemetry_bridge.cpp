@@ -0,0 +1,251 @@
+/**
+ * @file telemetry_bridge.cpp
+ * @brief USB-serial fleet telemetry bridge implementation.
+ * @details Record frame format (before COBS):
+ *
+ *              0: 'T'            magic
+ *              1: 'B'
+ *              2: version        wire version (bump when bodies move)
+ *              3: record type
+ *              4: body...
+ *          len-2: CRC16-CCITT    over bytes [0, len-2), little-endian
+ *
+ *          Publishers run on the UI task; the drain task is the only
+ *          consumer, so the ring is single-producer single-consumer with
+ *          word-sized head/tail indices and no lock. Link statistics are
+ *          not published - the drain task samples them itself once a
+ *          second while armed, which keeps that cost entirely off the UI.
+ */
+
+#include "telemetry_bridge.hpp"
+
+#include "protocol/espnow_protocol.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+namespace {
+
+const char* TAG_ = "telem_bridge";
+
+constexpr uint8_t PROTO_VERSION_ = 1;
+
+// Record types (device -> host only; the host talks through provisioning).
+constexpr uint8_t REC_HELLO_ = 0x01;   ///< Stream armed: uptime epoch + version
+constexpr uint8_t REC_STATUS_ = 0x02;  ///< One unit status sample
+constexpr uint8_t REC_RUN_ = 0x03;     ///< One finished run record
+constexpr uint8_t REC_LINK_ = 0x04;    ///< 1 Hz link statistics sample
+
+// Ring of fixed slots. RunRecord (40 bytes) is the largest body; 64 slots
+// buffer several seconds of a four-unit status burst against a host that
+// is momentarily busy.
+constexpr size_t SLOT_BODY_MAX_ = 44;
+constexpr size_t RING_SLOTS_ = 64;
+
+struct Slot {
+    uint8_t type;
+    uint8_t len;
+    uint8_t body[SLOT_BODY_MAX_];
+};
+
+Slot s_ring_[RING_SLOTS_];
+volatile uint32_t s_head_ = 0;  ///< Next slot to write (UI task)
+volatile uint32_t s_tail_ = 0;  ///< Next slot to drain (bridge task)
+volatile bool s_active_ = false;
+volatile bool s_hello_pending_ = false;  ///< Drain task owes the collector a hello
+uint32_t s_dropped_ = 0;        ///< Records lost to a full ring (UI task)
+
+constexpr size_t HEADER_LEN_ = 4;
+constexpr size_t CRC_LEN_ = 2;
+constexpr size_t PAYLOAD_MAX_ = HEADER_LEN_ + SLOT_BODY_MAX_ + CRC_LEN_;
+constexpr size_t WIRE_MAX_ = PAYLOAD_MAX_ + PAYLOAD_MAX_ / 254 + 2;
+
+constexpr uint32_t POLL_ARMED_MS_ = 50;
+constexpr uint32_t POLL_IDLE_MS_ = 250;
+constexpr uint32_t LINK_PERIOD_MS_ = 1000;
+constexpr size_t DRAIN_BURST_ = 8;  ///< Frames per wake, bounds stdout time
+constexpr uint32_t TASK_STACK_ = 4096;
+constexpr UBaseType_t TASK_PRIO_ = 2;
+
+// Drain-task-only working buffers (frames do not fit a shared stack).
+uint8_t s_tx_payload_[PAYLOAD_MAX_];
+uint8_t s_tx_wire_[WIRE_MAX_];
+
+/** @brief COBS-encode @p len bytes; returns the encoded length. */
+size_t cobsEncode(const uint8_t* src, size_t len, uint8_t* dst) noexcept
+{
+    size_t out = 1;
+    size_t code_pos = 0;
+    uint8_t code = 1;
+    for (size_t i = 0; i < len; ++i) {
+        if (src[i] == 0) {
+            dst[code_pos] = code;
+            code_pos = out++;
+            code = 1;
+        } else {
+            dst[out++] = src[i];
+            if (++code == 0xFF) {
+                dst[code_pos] = code;
+                code_pos = out++;
+                code = 1;
+            }
+        }
+    }
+    dst[code_pos] = code;
+    return out;
+}
+
+/** @brief Frame, checksum, COBS-encode and emit one record on stdout. */
+void sendFrame(uint8_t type, const uint8_t* body, size_t body_len) noexcept
+{
+    s_tx_payload_[0] = 'T';
+    s_tx_payload_[1] = 'B';
+    s_tx_payload_[2] = PROTO_VERSION_;
+    s_tx_payload_[3] = type;
+    if (body_len > 0) {
+        memcpy(s_tx_payload_ + HEADER_LEN_, body, body_len);
+    }
+    const size_t crc_at = HEADER_LEN_ + body_len;
+    const uint16_t crc = espnow::crc16_ccitt(s_tx_payload_, crc_at);
+    memcpy(s_tx_payload_ + crc_at, &crc, sizeof(crc));
+
+    const size_t wire_len = cobsEncode(s_tx_payload_, crc_at + CRC_LEN_, s_tx_wire_);
+    putchar(0);
+    fwrite(s_tx_wire_, 1, wire_len, stdout);
+    putchar(0);
+}
+
+/** @brief Producer-side slot write; drops (and counts) when the ring is full. */
+void publish(uint8_t type, const void* body, size_t len) noexcept
+{
+    if (!s_active_ || len > SLOT_BODY_MAX_) {
+        return;
+    }
+    const uint32_t head = s_head_;
+    if (head - s_tail_ >= RING_SLOTS_) {
+        ++s_dropped_;
+        return;
+    }
+    Slot& slot = s_ring_[head % RING_SLOTS_];
+    slot.type = type;
+    slot.len = static_cast<uint8_t>(len);
+    memcpy(slot.body, body, len);
+    s_head_ = head + 1;
+}
+
+/** @brief 1 Hz link sample, taken on the drain task itself. */
+void sendLinkSample(uint32_t now_ms) noexcept
+{
+    espnow::LinkStats stats{};
+    espnow::GetLinkStats(stats);
+    uint8_t body[4 + 6 * 4 + 1 + 4];
+    size_t at = 0;
+    memcpy(body + at, &now_ms, 4); at += 4;
+    memcpy(body + at, &stats.tracked_sent, 4); at += 4;
+    memcpy(body + at, &stats.acked, 4); at += 4;
+    memcpy(body + at, &stats.lost, 4); at += 4;
+    memcpy(body + at, &stats.retransmits, 4); at += 4;
+    memcpy(body + at, &stats.rx_duplicates, 4); at += 4;
+    memcpy(body + at, &stats.rx_shed, 4); at += 4;
+    body[at++] = espnow::GetCurrentChannel();
+    memcpy(body + at, &s_dropped_, 4); at += 4;
+    sendFrame(REC_LINK_, body, at);
+}
+
+void bridgeTask(void* arg) noexcept
+{
+    (void)arg;
+    uint32_t last_link_ms = 0;
+    while (true) {
+        if (!s_active_) {
+            // Disarmed: discard whatever the ring holds so a stale burst
+            // does not greet the next collector session.
+            s_tail_ = s_head_;
+            vTaskDelay(pdMS_TO_TICKS(POLL_IDLE_MS_));
+            continue;
+        }
+
+        const uint32_t now_ms = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+        bool wrote = false;
+        if (s_hello_pending_) {
+            // Hello carries the device's uptime so the collector can map
+            // the millisecond timestamps in every later record to wall
+            // time. Emitted here rather than from SetActive so the ring
+            // keeps its single producer (the UI task).
+            s_hello_pending_ = false;
+            uint8_t body[4 + 1];
+            memcpy(body, &now_ms, 4);
+            body[4] = PROTO_VERSION_;
+            sendFrame(REC_HELLO_, body, sizeof(body));
+            wrote = true;
+        }
+        size_t burst = 0;
+        while (s_tail_ != s_head_ && burst < DRAIN_BURST_) {
+            const Slot& slot = s_ring_[s_tail_ % RING_SLOTS_];
+            sendFrame(slot.type, slot.body, slot.len);
+            s_tail_ = s_tail_ + 1;
+            ++burst;
+        }
+        wrote = wrote || burst > 0;
+        if ((now_ms - last_link_ms) >= LINK_PERIOD_MS_) {
+            last_link_ms = now_ms;
+            sendLinkSample(now_ms);
+            wrote = true;
+        }
+        if (wrote) {
+            fflush(stdout);
+        }
+        vTaskDelay(pdMS_TO_TICKS(POLL_ARMED_MS_));
+    }
+}
+
+} // namespace
+
+void telemetry_bridge::Init() noexcept
+{
+    if (xTaskCreate(bridgeTask, "telem_bridge", TASK_STACK_, nullptr,
+                    TASK_PRIO_, nullptr) != pdPASS) {
+        ESP_LOGW(TAG_, "Task create failed; telemetry bridge unavailable");
+        return;
+    }
+    ESP_LOGI(TAG_, "Telemetry bridge ready (armed via provisioning)");
+}
+
+void telemetry_bridge::SetActive(bool on) noexcept
+{
+    if (on && !s_active_) {
+        s_hello_pending_ = true;
+        s_active_ = true;
+        ESP_LOGI(TAG_, "Stream armed");
+    } else if (!on && s_active_) {
+        s_active_ = false;
+        ESP_LOGI(TAG_, "Stream disarmed");
+    }
+}
+
+bool telemetry_bridge::Active() noexcept
+{
+    return s_active_;
+}
+
+void telemetry_bridge::PublishStatus(uint32_t ms, const uint8_t mac[6], uint32_t cycle,
+                                     uint8_t state, uint8_t err_code) noexcept
+{
+    uint8_t body[4 + 6 + 4 + 1 + 1];
+    memcpy(body, &ms, 4);
+    memcpy(body + 4, mac, 6);
+    memcpy(body + 10, &cycle, 4);
+    body[14] = state;
+    body[15] = err_code;
+    publish(REC_STATUS_, body, sizeof(body));
+}
+
+void telemetry_bridge::PublishRun(const run_db::RunRecord& rec) noexcept
+{
+    publish(REC_RUN_, &rec, sizeof(rec));
+}
@@ -0,0 +1,63 @@
+/**
+ * @file telemetry_bridge.hpp
+ * @brief USB-serial fleet telemetry bridge (framed binary stream on stdout).
+ * @details A mounted dial already aggregates every unit's status traffic;
+ *          this module forwards it to a USB-connected host so plant-level
+ *          dashboards need no extra hardware and never touch the fatigue
+ *          units. Publishers copy slim records into a RAM ring (a bounded
+ *          memcpy, dropped when full - the UI never blocks on the host);
+ *          a low-priority drain task COBS-frames them onto stdout with the
+ *          same 0x00-delimited CRC16 format the provisioning listener
+ *          speaks, so the two streams share the console safely. The host
+ *          arms and disarms the stream through a provisioning command;
+ *          while disarmed every Publish call is one branch.
+ *          scripts/telemetry_collect.py is the matching collector (per-unit
+ *          CSV or SQLite).
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "run_db.hpp"
+
+namespace telemetry_bridge {
+
+/**
+ * @brief Start the drain task (idle until the host arms the stream)
+ * @details Call once at boot, after stdout exists. Failure to start only
+ *          costs the bridge feature; the firmware runs on regardless.
+ */
+void Init() noexcept;
+
+/**
+ * @brief Arm or disarm the stream (driven by the provisioning listener)
+ * @details Arming emits a hello frame so the collector can timestamp the
+ *          device's uptime epoch; disarming drains nothing further and
+ *          discards whatever the ring still holds.
+ */
+void SetActive(bool on) noexcept;
+
+/**
+ * @brief True while a host collector has the stream armed
+ */
+bool Active() noexcept;
+
+/**
+ * @brief Publish one unit status sample
+ * @param ms Uptime timestamp of the sample (milliseconds)
+ * @param mac Reporting unit's MAC address
+ * @param cycle Reported cycle number
+ * @param state Reported fatigue_proto::TestState
+ * @param err_code Reported error code (0 = none)
+ */
+void PublishStatus(uint32_t ms, const uint8_t mac[6], uint32_t cycle,
+                   uint8_t state, uint8_t err_code) noexcept;
+
+/**
+ * @brief Publish one finished run record (mirrors the run_db append)
+ * @param rec Record as persisted, seq already assigned
+ */
+void PublishRun(const run_db::RunRecord& rec) noexcept;
+
+} // namespace telemetry_bridge
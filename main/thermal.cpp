@@ -0,0 +1,81 @@
+/**
+ * @file thermal.cpp
+ * @brief Internal temperature sensor sampling and derate hysteresis.
+ */
+
+#include "thermal.hpp"
+
+#include "driver/temperature_sensor.h"
+#include "esp_log.h"
+
+namespace {
+
+const char* TAG_ = "thermal";
+
+constexpr uint32_t SAMPLE_PERIOD_MS_ = 10000;  ///< Die temperature moves slowly
+
+temperature_sensor_handle_t s_sensor_ = nullptr;
+uint32_t s_last_sample_ms_ = 0;
+float s_celsius_ = 0.0f;
+float s_peak_ = 0.0f;
+bool s_valid_ = false;
+bool s_hot_ = false;
+
+} // namespace
+
+void thermal::Init() noexcept
+{
+    // Range covers a cold hall through a hot cell with the sensor's best
+    // accuracy band; clipping above it only saturates the reading.
+    temperature_sensor_config_t cfg = TEMPERATURE_SENSOR_CONFIG_DEFAULT(-10, 80);
+    esp_err_t err = temperature_sensor_install(&cfg, &s_sensor_);
+    if (err == ESP_OK) {
+        err = temperature_sensor_enable(s_sensor_);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG_, "Sensor unavailable: %s", esp_err_to_name(err));
+        s_sensor_ = nullptr;
+    }
+}
+
+bool thermal::Service(uint32_t now_ms) noexcept
+{
+    if (s_sensor_ == nullptr) {
+        return false;
+    }
+    if (s_last_sample_ms_ != 0 && (now_ms - s_last_sample_ms_) < SAMPLE_PERIOD_MS_) {
+        return false;
+    }
+    s_last_sample_ms_ = now_ms;
+
+    float c = 0.0f;
+    if (temperature_sensor_get_celsius(s_sensor_, &c) != ESP_OK) {
+        return false;
+    }
+    s_celsius_ = c;
+    if (!s_valid_ || c > s_peak_) {
+        s_peak_ = c;
+    }
+    s_valid_ = true;
+
+    const bool was_hot = s_hot_;
+    if (!s_hot_ && c >= DERATE_ENGAGE_C) {
+        s_hot_ = true;
+    } else if (s_hot_ && c <= DERATE_RELEASE_C) {
+        s_hot_ = false;
+    }
+    return s_hot_ != was_hot;
+}
+
+void thermal::GetStats(Stats& out) noexcept
+{
+    out.celsius = s_celsius_;
+    out.peak_celsius = s_peak_;
+    out.valid = s_valid_;
+    out.hot = s_hot_;
+}
+
+bool thermal::DerateRecommended() noexcept
+{
+    return s_hot_;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file thermal.hpp
+ * @brief Die temperature telemetry and the display derate verdict.
+ * @details Units in hot cells run the S3 well above bench temperature,
+ *          where an aggressively proven SPI write clock (display_tuner)
+ *          can start glitching - and nothing today even records how hot
+ *          a device gets. This module samples the S3's internal
+ *          temperature sensor on a slow cadence and publishes two
+ *          things: the telemetry itself (current and peak, for the
+ *          diagnostics page and the session log) and a derate verdict
+ *          with hysteresis that the render task consumes to step the
+ *          panel write clock down while hot and restore the proven
+ *          level once cool. Sampling runs from the UI tick; the clock
+ *          change itself is applied only by the task that owns the SPI
+ *          bus, between frames.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace thermal {
+
+/// Telemetry snapshot (see GetStats)
+struct Stats {
+    float celsius;       ///< Latest sample (degrees C)
+    float peak_celsius;  ///< Highest sample this session
+    bool valid;          ///< Sensor present and at least one sample taken
+    bool hot;            ///< Above the derate threshold (hysteresis applied)
+};
+
+/// Derate engages at/above this die temperature...
+constexpr float DERATE_ENGAGE_C = 65.0f;
+/// ...and releases once back below this (hysteresis band)
+constexpr float DERATE_RELEASE_C = 55.0f;
+/// Write clock ceiling while hot (one proven-ladder step of margin)
+constexpr uint32_t DERATE_CLOCK_HZ = 40000000U;
+
+/**
+ * @brief Install and enable the internal temperature sensor
+ * @details Call once at boot; failure is logged and leaves the module
+ *          inert (no telemetry, never a derate verdict).
+ */
+void Init() noexcept;
+
+/**
+ * @brief Periodic sample; self-throttled to a slow cadence
+ * @param now_ms Current uptime in milliseconds
+ * @return true when the hot/cool verdict changed with this sample (the
+ *         caller logs the transition; this module only owns the state)
+ */
+bool Service(uint32_t now_ms) noexcept;
+
+/**
+ * @brief Copy out the latest telemetry
+ */
+void GetStats(Stats& out) noexcept;
+
+/**
+ * @brief True while the display clock should be held at DERATE_CLOCK_HZ
+ */
+bool DerateRecommended() noexcept;
+
+} // namespace thermal
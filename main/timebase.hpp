@@ -0,0 +1,126 @@
+/**
+ * @file timebase.hpp
+ * @brief One clock for the whole firmware: ISR-safe high-resolution
+ *        timestamps plus the shared protocol epoch.
+ * @details Timing code had started to diverge per feature — some sites
+ *          divide esp_timer_get_time(), some read the cycle counter and
+ *          keep their own ticks-per-us conversion. This header names the
+ *          two legitimate sources once and documents their contracts:
+ *
+ *          - NowUs()/NowNs()/NowMs32(): the systimer-backed esp_timer
+ *            clock. 64-bit, monotonic, shared by both cores, safe from
+ *            ISRs. This is THE timestamp for anything that crosses a
+ *            task, core or packet boundary. (The cycle counter is NOT
+ *            used here on purpose: CCOUNT is per-core on the S3, so a
+ *            cycle-derived wall clock would disagree between the Tick
+ *            task and the render loop.)
+ *
+ *          - CycleStamp()/CyclesToUs()/CyclesToNs(): the CPU cycle
+ *            counter, for sub-microsecond INTERVALS only. Both stamps
+ *            must come from the same core, and a 32-bit stamp wraps in
+ *            ~17.9 s at 240 MHz — subtract first (unsigned wrap-safe),
+ *            then convert.
+ *
+ *          Overflow discipline for 32-bit millisecond stamps is the
+ *          same everywhere: NowMs32() wraps after ~49.7 days, so compare
+ *          deadlines as `static_cast<int32_t>(now - deadline) > 0`,
+ *          never with raw <.
+ *
+ *          The shared epoch maps local time onto the machine's clock:
+ *          the protocol layer's TimeSync exchange feeds the established
+ *          offset in through NoteSharedOffset(), and SharedNowMs()
+ *          returns machine time for log anchors and session records.
+ *          Until the first lock the epoch is simply not valid.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+
+namespace timebase {
+
+/** @brief Microseconds since boot (64-bit, monotonic, ISR-safe, both cores). */
+inline int64_t NowUs() noexcept
+{
+    return esp_timer_get_time();
+}
+
+/**
+ * @brief Nanoseconds since boot, on the same clock as NowUs()
+ * @details Granularity is the esp_timer microsecond — callers get a
+ *          consistent nanosecond axis, not picosecond resolution. Use
+ *          CycleStamp() when an interval genuinely needs sub-us grain.
+ */
+inline int64_t NowNs() noexcept
+{
+    return esp_timer_get_time() * 1000;
+}
+
+/** @brief Milliseconds since boot, truncated to 32 bits (wraps ~49.7 days). */
+inline uint32_t NowMs32() noexcept
+{
+    return static_cast<uint32_t>(esp_timer_get_time() / 1000);
+}
+
+/**
+ * @brief Raw cycle-counter stamp for short same-core intervals
+ * @details Per-core and wrapping (~17.9 s at 240 MHz): only the
+ *          difference of two stamps taken on one core means anything.
+ */
+inline uint32_t CycleStamp() noexcept
+{
+    return esp_cpu_get_cycle_count();
+}
+
+/** @brief Convert an accumulated cycle count to microseconds. */
+inline uint64_t CyclesToUs(uint64_t cycles) noexcept
+{
+    return cycles / esp_rom_get_cpu_ticks_per_us();
+}
+
+/** @brief Convert a short cycle interval to nanoseconds (sub-us grain). */
+inline uint64_t CyclesToNs(uint32_t cycles) noexcept
+{
+    return (static_cast<uint64_t>(cycles) * 1000U) / esp_rom_get_cpu_ticks_per_us();
+}
+
+namespace detail {
+// Written by the protocol layer's time sync, read from anywhere
+// (including the render core), hence the relaxed atomics.
+inline std::atomic<int32_t> s_shared_offset_ms{0};
+inline std::atomic<bool> s_shared_valid{false};
+}  // namespace detail
+
+/**
+ * @brief Feed the established machine-clock offset (protocol layer only)
+ * @param offset_ms peer_ms - local_ms, as published by the TimeSync filter
+ */
+inline void NoteSharedOffset(int32_t offset_ms) noexcept
+{
+    detail::s_shared_offset_ms.store(offset_ms, std::memory_order_relaxed);
+    detail::s_shared_valid.store(true, std::memory_order_relaxed);
+}
+
+/** @brief True once a TimeSync lock has mapped us onto the machine clock. */
+inline bool SharedValid() noexcept
+{
+    return detail::s_shared_valid.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Current time on the shared protocol epoch (machine clock)
+ * @details Falls back to the local clock until SharedValid(); callers
+ *          that must distinguish should check first.
+ */
+inline uint32_t SharedNowMs() noexcept
+{
+    return NowMs32() +
+           static_cast<uint32_t>(detail::s_shared_offset_ms.load(std::memory_order_relaxed));
+}
+
+}  // namespace timebase
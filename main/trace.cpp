@@ -0,0 +1,144 @@
+/**
+ * @file trace.cpp
+ * @brief Scoped trace event ring implementation (compiled only when enabled).
+ */
+
+#include "trace.hpp"
+
+#if TRACE_ENABLED
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+#include "esp_log.h"
+
+#include "timebase.hpp"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+namespace {
+
+constexpr const char* TAG_ = "trace";
+
+constexpr size_t RING_DEPTH_ = 512;     ///< Entries (power of two, 6 KB)
+constexpr size_t REGISTRY_MAX_ = 64;    ///< Distinct scope names
+
+static_assert((RING_DEPTH_ & (RING_DEPTH_ - 1)) == 0,
+              "RING_DEPTH_ must be a power of two");
+
+/**
+ * @brief One trace record (12 bytes)
+ */
+struct Entry {
+    uint32_t ts_us;     ///< esp_timer time, truncated (tool unwraps 71 min)
+    uint16_t id;        ///< Scope id from the registry
+    uint16_t corr;      ///< Ambient correlation id (0 = none)
+    uint8_t phase;      ///< 'B', 'E' or 'i'
+    uint8_t core;       ///< Core that recorded the event
+};
+static_assert(sizeof(Entry) == 12, "Entry must stay 12 bytes");
+
+Entry s_ring_[RING_DEPTH_];
+
+/**
+ * @brief Total records written; the slot is head % RING_DEPTH_
+ * @details Claimed with an atomic fetch-add so writers on both cores never
+ *          contend on a lock. A reader racing the single in-flight claim can
+ *          see one torn record per writer; the converter drops records whose
+ *          id is out of registry range, which covers that window.
+ */
+uint32_t s_head_ = 0;
+
+// Ambient correlation, one per core: the pipelines that matter are
+// core-pinned (UI tick and the receive task against the render task), so
+// a per-core slot follows each logical flow without task-local storage.
+uint16_t s_corr_[2] = {0, 0};
+uint32_t s_next_corr_ = 0;
+
+const char* s_names_[REGISTRY_MAX_];
+uint16_t s_name_count_ = 0;
+portMUX_TYPE s_registry_lock_ = portMUX_INITIALIZER_UNLOCKED;
+
+} // namespace
+
+uint16_t trace::RegisterScope(const char* name) noexcept
+{
+    taskENTER_CRITICAL(&s_registry_lock_);
+    // Re-registering the same literal (e.g. a template instantiated twice)
+    // reuses the existing id so the timeline groups them as one track.
+    for (uint16_t i = 0; i < s_name_count_; ++i) {
+        if (s_names_[i] == name || std::strcmp(s_names_[i], name) == 0) {
+            taskEXIT_CRITICAL(&s_registry_lock_);
+            return static_cast<uint16_t>(i + 1);
+        }
+    }
+    if (s_name_count_ >= REGISTRY_MAX_) {
+        taskEXIT_CRITICAL(&s_registry_lock_);
+        ESP_EARLY_LOGW(TAG_, "registry full, dropping scope '%s'", name);
+        return 0;
+    }
+    s_names_[s_name_count_] = name;
+    const uint16_t id = static_cast<uint16_t>(++s_name_count_);
+    taskEXIT_CRITICAL(&s_registry_lock_);
+    return id;
+}
+
+void trace::Note(uint16_t id, char phase) noexcept
+{
+    if (id == 0) {
+        return;
+    }
+    const uint32_t slot = __atomic_fetch_add(&s_head_, 1, __ATOMIC_RELAXED);
+    Entry& e = s_ring_[slot % RING_DEPTH_];
+    e.ts_us = static_cast<uint32_t>(timebase::NowUs());
+    e.id = id;
+    e.corr = s_corr_[xPortGetCoreID()];
+    e.phase = static_cast<uint8_t>(phase);
+    e.core = static_cast<uint8_t>(xPortGetCoreID());
+}
+
+uint16_t trace::NextCorrelation() noexcept
+{
+    // Fold the running counter into 1..65535; 0 stays "no correlation".
+    const uint32_t v = __atomic_fetch_add(&s_next_corr_, 1, __ATOMIC_RELAXED);
+    return static_cast<uint16_t>((v % 0xFFFF) + 1);
+}
+
+void trace::SetCorrelation(uint16_t corr) noexcept
+{
+    s_corr_[xPortGetCoreID()] = corr;
+}
+
+uint16_t trace::Correlation() noexcept
+{
+    return s_corr_[xPortGetCoreID()];
+}
+
+void trace::Dump() noexcept
+{
+    const uint32_t head = __atomic_load_n(&s_head_, __ATOMIC_RELAXED);
+    const uint32_t count =
+        (head < RING_DEPTH_) ? head : static_cast<uint32_t>(RING_DEPTH_);
+
+    // Raw printf, not ESP_LOG: the converter wants unprefixed lines and the
+    // dump only runs from the diagnostics page, never on a hot path.
+    printf("TRACE-BEGIN\n");
+    for (uint16_t i = 0; i < s_name_count_; ++i) {
+        printf("N %u %s\n", static_cast<unsigned>(i + 1), s_names_[i]);
+    }
+    // Oldest first.
+    for (uint32_t i = 0; i < count; ++i) {
+        const Entry& e = s_ring_[(head - count + i) % RING_DEPTH_];
+        if (e.id == 0 || e.id > s_name_count_) {
+            continue;  // unclaimed slot or record torn by a concurrent writer
+        }
+        printf("E %c %u %u %" PRIu32 " %u\n", static_cast<char>(e.phase),
+               static_cast<unsigned>(e.id), static_cast<unsigned>(e.core),
+               e.ts_us, static_cast<unsigned>(e.corr));
+    }
+    printf("TRACE-END\n");
+}
+
+#endif  // TRACE_ENABLED
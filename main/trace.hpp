@@ -0,0 +1,126 @@
+/**
+ * @file trace.hpp
+ * @brief Compile-time-optional scoped trace events (lock-free ring).
+ * @details Causality instrumentation beyond the frame profiler: scoped
+ *          macros write (id, phase, timestamp) records into a lock-free
+ *          ring shared by both cores, so a dump shows which proto event
+ *          triggered which redraw and where a 100 ms hitch went. Disabled
+ *          builds (the default) compile every macro to nothing — no ring,
+ *          no registry, no cycles on any hot path.
+ *
+ *          Enable with -DTRACE_ENABLED=1 (or a target_compile_definitions
+ *          entry in main/CMakeLists.txt), instrument with:
+ *
+ *              TRACE_SCOPE("renderFrame");   // duration of this block
+ *              TRACE_INSTANT("vsync");       // single point in time
+ *
+ *          trace::Dump() prints the ring between TRACE-BEGIN/END markers
+ *          on the console; scripts/trace_to_chrome.py converts a captured
+ *          log into Chrome trace JSON (chrome://tracing, Perfetto).
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 0
+#endif
+
+namespace trace {
+
+#if TRACE_ENABLED
+
+/**
+ * @brief Register a scope name once, returning its compact id
+ * @details Called from a function-local static initializer, so the
+ *          registry lookup happens once per call site, not per event.
+ * @param name Scope name (must be a string literal or otherwise immortal)
+ * @return Compact id recorded in the ring (0 if the registry is full)
+ */
+uint16_t RegisterScope(const char* name) noexcept;
+
+/**
+ * @brief Record one event (lock-free, safe from both cores)
+ * @param id Scope id from RegisterScope()
+ * @param phase 'B' begin, 'E' end, 'i' instant (Chrome trace phases)
+ */
+void Note(uint16_t id, char phase) noexcept;
+
+/**
+ * @brief Allocate a fresh correlation id (never 0)
+ * @details Correlation ids turn timestamps into causality chains: the
+ *          code that originates a logical event (an encoder detent, a
+ *          received packet) allocates an id and makes it the core's
+ *          ambient correlation; every record written while it is ambient
+ *          carries it, and a pipeline that hands work to another task
+ *          re-arms the id there (see UiController::frame_corr_). The
+ *          converter then draws one annotated chain per id instead of
+ *          leaving the reader to line up timestamps across tracks.
+ */
+uint16_t NextCorrelation() noexcept;
+
+/**
+ * @brief Set the calling core's ambient correlation id (0 = none)
+ */
+void SetCorrelation(uint16_t corr) noexcept;
+
+/**
+ * @brief The calling core's ambient correlation id
+ */
+uint16_t Correlation() noexcept;
+
+/**
+ * @brief Print the ring and the name registry between TRACE-BEGIN/END
+ * @details Oldest-first; wraps are expected and the tool tolerates the
+ *          one record a concurrent writer may be mid-claim on.
+ */
+void Dump() noexcept;
+
+/**
+ * @brief RAII scope: records 'B' on entry and 'E' on destruction
+ */
+class Scoped {
+public:
+    explicit Scoped(uint16_t id) noexcept : id_(id) { Note(id_, 'B'); }
+    ~Scoped() noexcept { Note(id_, 'E'); }
+    Scoped(const Scoped&) = delete;
+    Scoped& operator=(const Scoped&) = delete;
+
+private:
+    uint16_t id_;
+};
+
+#else  // !TRACE_ENABLED
+
+inline void Dump() noexcept {}
+inline uint16_t NextCorrelation() noexcept { return 0; }
+inline void SetCorrelation(uint16_t) noexcept {}
+inline uint16_t Correlation() noexcept { return 0; }
+
+#endif  // TRACE_ENABLED
+
+}  // namespace trace
+
+#if TRACE_ENABLED
+#define TRACE_CONCAT2_(a, b) a##b
+#define TRACE_CONCAT_(a, b) TRACE_CONCAT2_(a, b)
+#define TRACE_SCOPE(name)                                                        \
+    static const uint16_t TRACE_CONCAT_(trace_id_, __LINE__) =                   \
+        ::trace::RegisterScope(name);                                            \
+    ::trace::Scoped TRACE_CONCAT_(trace_scope_, __LINE__)(                       \
+        TRACE_CONCAT_(trace_id_, __LINE__))
+#define TRACE_INSTANT(name)                                                      \
+    do {                                                                         \
+        static const uint16_t TRACE_CONCAT_(trace_id_, __LINE__) =               \
+            ::trace::RegisterScope(name);                                        \
+        ::trace::Note(TRACE_CONCAT_(trace_id_, __LINE__), 'i');                  \
+    } while (0)
+#else
+#define TRACE_SCOPE(name) \
+    do {                  \
+    } while (0)
+#define TRACE_INSTANT(name) \
+    do {                    \
+    } while (0)
+#endif
@@ -3,13 +3,17 @@
  * @brief Auto-generated circular icons for M5Dial launcher UI
  * @details Contains 42x42 pixel icons with colored circular backgrounds.
  *          High-quality rendering with 4x4 multi-sample anti-aliasing.
- *          Generated by tools/generate_circular_icons.py
+ *          Stored palettized + run-length encoded (see icon_codec.hpp);
+ *          generated by tools/generate_circular_icons.py piped through
+ *          tools/compress_icons.py
  */
 
 #pragma once
 
 #include <cstdint>
 
+#include "icon_codec.hpp"
+
 namespace ui::assets {
 
 /**
@@ -31,826 +35,653 @@ struct CircularIconColors {
     static constexpr uint16_t mint = 0x04A2;
     static constexpr uint16_t cyan = 0x008C;
     static constexpr uint16_t gray = 0x5D7B;
+    static constexpr uint16_t purple = 0xB37F;
 };
 
 static constexpr int kCircularIcon_settings_W = 42;
 static constexpr int kCircularIcon_settings_H = 42;
 static constexpr uint16_t kCircularIcon_settings_Color = 0x0000;
-static const uint16_t kCircularIcon_settings[1764] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821, 0x28E5, 0x620A,
-  0x9330, 0xB3D4, 0xCC57, 0xD498, 0xDC98, 0xD498, 0xCC57, 0xB3D4, 0x9330, 0x620A, 0x28E5, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1882, 0x620A, 0xB3D4, 0xE4D9, 0xF53B, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xF53B, 0xE4D9, 0xB3D4, 0x620A, 0x1882, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062, 0x622B, 0xCC36,
-  0xF53B, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xF53B, 0xCC36, 0x622B, 0x1062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3926, 0xB3D4, 0xF53B, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xF53B, 0xB3D4, 0x3926, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x620A,
-  0xDCB8, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD9C, 0xFE5D, 0xF67D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFE7D, 0xFE5D, 0xFD9C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xDCB8, 0x620A, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821, 0x728D, 0xECFA, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xF5FC, 0xFF5E,
-  0xFFBE, 0xFF7E, 0xFDBC, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFDBC, 0xFF7E, 0xFFBE, 0xFF5E, 0xFDFC, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xECFA, 0x728D, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x728D, 0xED1A, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFDDC, 0xFF7E, 0xFFBE, 0xFFBE, 0xFE3D, 0xFD5C, 0xFD7C, 0xFD9C,
-  0xFD9C, 0xFD9C, 0xFD7C, 0xFD5C, 0xFE3D, 0xFFBE, 0xFFBE, 0xFF7E, 0xFDDC, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xED1A, 0x728D,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x620A, 0xECFA, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFE9D, 0xFFBE, 0xFFBE, 0xFEDD, 0xFE9D, 0xFF3E, 0xFF7E, 0xFF7E, 0xFF7E, 0xFF3E, 0xFE9D, 0xFEDD, 0xFFBE,
-  0xFFBE, 0xFE9D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xECFA, 0x620A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3926, 0xDCB8, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFDDC, 0xFF7E, 0xFFBE,
-  0xFF7E, 0xFF1E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF1E, 0xFF7E, 0xFFBE, 0xFF7E, 0xFDDC, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xDCB8, 0x3926, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062, 0xB3D4, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFE5D, 0xFF5E, 0xFEBD, 0xFFBE, 0xFFBE, 0xFEDD, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE,
-  0xFFBE, 0xFEDD, 0xFFBE, 0xFFBE, 0xFEBD, 0xFF5E, 0xFE5D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xB3D4,
-  0x1062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x622B, 0xF53B, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD7C, 0xFE9D,
-  0xFFBE, 0xFFBE, 0xFF1E, 0xFF5E, 0xFFBE, 0xFEFD, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFEFD, 0xFFBE, 0xFF5E, 0xFF1E, 0xFFBE,
-  0xFFBE, 0xFE9D, 0xFD7C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xF53B, 0x622B, 0x0000, 0x0000, 0x0000, 0x0000, 0x1882,
-  0xCC36, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFE9D, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFEDD, 0xFFBE, 0xFF5E,
-  0xFF7E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF7E, 0xFF5E, 0xFFBE, 0xFEDD, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFE9D, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xCC36, 0x1882, 0x0000, 0x0000, 0x0000, 0x620A, 0xF53B, 0xFD5C, 0xFD5C, 0xFDFC, 0xFDDC, 0xFD5C,
-  0xFD5C, 0xFE5D, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF5E, 0xFF3E, 0xFF5E, 0xFE5D, 0xFE7D, 0xFE5D, 0xFE7D, 0xFE5D, 0xFF5E,
-  0xFF3E, 0xFF5E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFE5D, 0xFD5C, 0xFD5C, 0xFDDC, 0xF5FC, 0xFD5C, 0xFD5C, 0xF53B, 0x620A,
-  0x0000, 0x0000, 0x0821, 0xB3D4, 0xFD5C, 0xFD5C, 0xFD9C, 0xFF5E, 0xFF7E, 0xFE9D, 0xFDDC, 0xFF5E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE,
-  0xFFBE, 0xFF7E, 0xFE1C, 0xFD9C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD9C, 0xFE1C, 0xFF7E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE,
-  0xFFBE, 0xFF5E, 0xFDDC, 0xFE9D, 0xFF7E, 0xFF5E, 0xFD9C, 0xFD5C, 0xFD5C, 0xB3D4, 0x0821, 0x0000, 0x28E5, 0xE4D9, 0xFD5C, 0xFD5C,
-  0xFE5D, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF7E, 0xFEBD, 0xFF1E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF5E, 0xFDFC, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFDFC, 0xFF5E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF1E, 0xFEBD, 0xFF7E, 0xFFBE, 0xFFBE, 0xFFBE,
-  0xFE5D, 0xFD5C, 0xFD5C, 0xE4D9, 0x28E5, 0x0000, 0x620A, 0xF53B, 0xFD5C, 0xFD5C, 0xFE7D, 0xFF7E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE,
-  0xFF5E, 0xFEDD, 0xFF5E, 0xFF7E, 0xFDFC, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFDFC, 0xFF7E, 0xFF5E, 0xFEDD, 0xFF5E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF7E, 0xFE7D, 0xFD5C, 0xFD5C, 0xF53B, 0x620A, 0x0000,
-  0x9330, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xF5BC, 0xFE3D, 0xFEDD, 0xFF7E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF3E, 0xFE1C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFDDC, 0xFE7D, 0xFE7D, 0xFE7D, 0xFDDC, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFE1C, 0xFF3E, 0xFFBE, 0xFFBE, 0xFFBE,
-  0xFF7E, 0xFEDD, 0xFE3D, 0xFDBC, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0x9330, 0x0000, 0xB3D4, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFE9D, 0xFF1E, 0xFEDD, 0xFEFD, 0xFF5E, 0xFF5E, 0xFD9C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFE7D, 0xFE3D, 0xFD7C, 0xFD5C, 0xFD7C,
-  0xF63D, 0xFE7D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD9C, 0xFF5E, 0xFF5E, 0xFEFD, 0xFEDD, 0xFF1E, 0xFE9D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xB3D4, 0x0821, 0xCC57, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD7C, 0xFF3E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF7E,
-  0xFE5D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFDDC, 0xFE3D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFE3D, 0xFDDC, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFE5D, 0xFF7E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF3E, 0xFD7C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xCC57, 0x1062, 0xD498, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD9C, 0xFF7E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFE7D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFE7D, 0xFD7C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD7C, 0xFE7D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFE7D, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF7E,
-  0xFD9C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xD498, 0x1883, 0xDC98, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD9C, 0xFF7E,
-  0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFE5D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFE7D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFE7D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFE5D, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF7E, 0xFD9C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xDC98, 0x18A3, 0xD498, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD9C, 0xFF7E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFE7D, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFE7D, 0xFD7C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD7C, 0xFE7D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFE7D, 0xFFBE,
-  0xFFBE, 0xFFBE, 0xFFBE, 0xFF7E, 0xFD9C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xD498, 0x1883, 0xCC57, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD7C, 0xFF3E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF7E, 0xFE5D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFDDC, 0xFE3D, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFE3D, 0xFDDC, 0xFD5C, 0xFD5C, 0xFD5C, 0xFE5D, 0xFF7E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF3E, 0xFD7C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xCC57, 0x1062, 0xB3D4, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFE9D, 0xFF1E, 0xFEDD,
-  0xFEFD, 0xFF5E, 0xFF5E, 0xFD9C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFE7D, 0xFE3D, 0xFD7C, 0xFD5C, 0xFD7C, 0xFE3D, 0xFE7D, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD9C, 0xFF5E, 0xFF5E, 0xFEFD, 0xFEDD, 0xFF1E, 0xFE9D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xB3D4, 0x0821,
-  0x9330, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xF5BC, 0xFE3D, 0xFEDD, 0xFF7E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF3E, 0xFE1C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFDDC, 0xFE7D, 0xFE7D, 0xFE7D, 0xFDDC, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFE1C, 0xFF3E, 0xFFBE, 0xFFBE, 0xFFBE,
-  0xFF7E, 0xFEDD, 0xFE3D, 0xFDBC, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0x9330, 0x0000, 0x620A, 0xF53B, 0xFD5C, 0xFD5C, 0xFE7D, 0xFF7E,
-  0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF5E, 0xFEDD, 0xFF5E, 0xFF7E, 0xFDFC, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFDFC, 0xFF7E, 0xFF5E, 0xFEDD, 0xFF5E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF7E, 0xFE7D, 0xFD5C,
-  0xFD5C, 0xF53B, 0x620A, 0x0000, 0x28E5, 0xE4D9, 0xFD5C, 0xFD5C, 0xFE5D, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF7E, 0xFEBD, 0xFF1E, 0xFFBE,
-  0xFFBE, 0xFFBE, 0xFF5E, 0xFDFC, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFDFC, 0xFF5E, 0xFFBE,
-  0xFFBE, 0xFFBE, 0xFF1E, 0xFEBD, 0xFF7E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFE5D, 0xFD5C, 0xFD5C, 0xE4D9, 0x28E5, 0x0000, 0x0821, 0xB3D4,
-  0xFD5C, 0xFD5C, 0xFD9C, 0xFF5E, 0xFF7E, 0xFE9D, 0xFDDC, 0xFF5E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF7E, 0xFE1C, 0xFD9C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD9C, 0xFE1C, 0xFF7E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF5E, 0xFDDC, 0xFE9D,
-  0xFF7E, 0xFF5E, 0xFD9C, 0xFD5C, 0xFD5C, 0xB3D4, 0x0821, 0x0000, 0x0000, 0x620A, 0xF53B, 0xFD5C, 0xFD5C, 0xFDFC, 0xFDDC, 0xFD5C,
-  0xFD5C, 0xFE5D, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF5E, 0xFF3E, 0xFF5E, 0xFE5D, 0xFE7D, 0xFE5D, 0xFE7D, 0xFE5D, 0xFF5E,
-  0xFF3E, 0xFF5E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFE5D, 0xFD5C, 0xFD5C, 0xF5DC, 0xF5FC, 0xFD5C, 0xFD5C, 0xF53B, 0x620A,
-  0x0000, 0x0000, 0x0000, 0x1882, 0xCC36, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFE9D, 0xFFBE, 0xFFBE, 0xFFBE,
-  0xFFBE, 0xFEDD, 0xFFBE, 0xFF5E, 0xFF7E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF7E, 0xFF5E, 0xFFBE, 0xFEDD, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE,
-  0xFE9D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xCC36, 0x1882, 0x0000, 0x0000, 0x0000, 0x0000, 0x622B, 0xF53B,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD7C, 0xFE9D, 0xFFBE, 0xFFBE, 0xFF1E, 0xFF5E, 0xFFBE, 0xFEFD, 0xFFBE, 0xFFBE,
-  0xFFBE, 0xFFBE, 0xFFBE, 0xFEFD, 0xFFBE, 0xFF5E, 0xFF1E, 0xFFBE, 0xFFBE, 0xFE9D, 0xFD7C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xF53B, 0x622B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062, 0xB3D4, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFE5D, 0xFF5E, 0xFEBD, 0xFFBE, 0xFFBE, 0xFEDD, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFEDD, 0xFFBE, 0xFFBE,
-  0xFEBD, 0xFF5E, 0xFE5D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xB3D4, 0x1062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3926, 0xDCB8, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFDDC, 0xFF7E, 0xFFBE,
-  0xFF7E, 0xFF1E, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFF1E, 0xFF7E, 0xFFBE, 0xFF7E, 0xFDDC, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xDCB8, 0x3926, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x620A, 0xECFA,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFE9D, 0xFFBE, 0xFFBE, 0xFEDD, 0xFE9D, 0xFF3E, 0xFF7E, 0xFF7E, 0xFF7E,
-  0xFF3E, 0xFE9D, 0xFEDD, 0xFFBE, 0xFFBE, 0xFE9D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xECFA, 0x620A, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x728D, 0xED1A, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFDDC, 0xFF7E, 0xFFBE, 0xFFBE, 0xFE3D, 0xFD5C, 0xFD7C, 0xFD9C, 0xFD9C, 0xFD9C, 0xFD7C, 0xFD5C, 0xFE3D, 0xFFBE, 0xFFBE, 0xFF7E,
-  0xFDDC, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xED1A, 0x728D, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0821, 0x728D, 0xECFA, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xF5FC, 0xFF5E, 0xFFBE, 0xFF7E, 0xFDBC, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFDBC, 0xFF7E, 0xFFBE, 0xFF5E, 0xFDFC, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xECFA,
-  0x728D, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x620A,
-  0xDCB8, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD9C, 0xFE5D, 0xFE7D, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFE7D, 0xFE5D, 0xFD9C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xDCB8, 0x620A, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3926, 0xB3D4, 0xF53B, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xF53B, 0xB3D4, 0x3926, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062, 0x622B, 0xCC36, 0xF53B, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C,
-  0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xF53B, 0xCC36, 0x622B, 0x1062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1882, 0x620A, 0xB3D4, 0xE4D9, 0xF53B, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xFD5C, 0xF53B,
-  0xE4D9, 0xB3D4, 0x620A, 0x1882, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821, 0x28E5, 0x620A,
-  0x9330, 0xB3D4, 0xCC57, 0xD498, 0xDC98, 0xD498, 0xCC57, 0xB3D4, 0x9330, 0x620A, 0x28E5, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821, 0x1062, 0x1883, 0x18A3, 0x1883,
-  0x1062, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000,
+static constexpr uint16_t kCircularIcon_settings_Palette[47] = {
+  0x0000, 0x0821, 0x28E5, 0x620A, 0x9330, 0xB3D4, 0xCC57, 0xD498, 0xDC98, 0x1882, 0xE4D9, 0xF53B, 0xFD5C, 0x1062, 0x622B, 0xCC36,
+  0x3926, 0x0020, 0xDCB8, 0xFD9C, 0xFE5D, 0xF67D, 0xFE7D, 0x728D, 0xECFA, 0xF5FC, 0xFF5E, 0xFFBE, 0xFF7E, 0xFDBC, 0xFDFC, 0xED1A,
+  0xFDDC, 0xFE3D, 0xFD7C, 0xFE9D, 0xFEDD, 0xFF3E, 0xFF1E, 0xFEBD, 0xFEFD, 0xFE1C, 0xF5BC, 0xF63D, 0x1883, 0x18A3, 0xF5DC
+};
+static constexpr uint8_t kCircularIcon_settings_Rle[1638] = {
+  13, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5, 1, 6, 1, 7,
+  1, 8, 1, 7, 1, 6, 1, 5, 1, 4, 1, 3, 1, 2, 1, 1,
+  25, 0, 1, 9, 1, 3, 1, 5, 1, 10, 1, 11, 9, 12, 1, 11,
+  1, 10, 1, 5, 1, 3, 1, 9, 21, 0, 1, 13, 1, 14, 1, 15,
+  1, 11, 15, 12, 1, 11, 1, 15, 1, 14, 1, 13, 18, 0, 1, 16,
+  1, 5, 1, 11, 19, 12, 1, 11, 1, 5, 1, 16, 15, 0, 1, 17,
+  1, 3, 1, 18, 4, 12, 1, 19, 1, 20, 1, 21, 9, 12, 1, 22,
+  1, 20, 1, 19, 4, 12, 1, 18, 1, 3, 1, 17, 12, 0, 1, 1,
+  1, 23, 1, 24, 4, 12, 1, 25, 1, 26, 1, 27, 1, 28, 1, 29,
+  7, 12, 1, 29, 1, 28, 1, 27, 1, 26, 1, 30, 4, 12, 1, 24,
+  1, 23, 1, 1, 10, 0, 1, 17, 1, 23, 1, 31, 5, 12, 1, 32,
+  1, 28, 2, 27, 1, 33, 1, 12, 1, 34, 3, 19, 1, 34, 1, 12,
+  1, 33, 2, 27, 1, 28, 1, 32, 5, 12, 1, 31, 1, 23, 1, 17,
+  9, 0, 1, 3, 1, 24, 7, 12, 1, 35, 2, 27, 1, 36, 1, 35,
+  1, 37, 3, 28, 1, 37, 1, 35, 1, 36, 2, 27, 1, 35, 7, 12,
+  1, 24, 1, 3, 8, 0, 1, 16, 1, 18, 8, 12, 1, 32, 1, 28,
+  1, 27, 1, 28, 1, 38, 5, 27, 1, 38, 1, 28, 1, 27, 1, 28,
+  1, 32, 8, 12, 1, 18, 1, 16, 6, 0, 1, 13, 1, 5, 8, 12,
+  1, 20, 1, 26, 1, 39, 2, 27, 1, 36, 5, 27, 1, 36, 2, 27,
+  1, 39, 1, 26, 1, 20, 8, 12, 1, 5, 1, 13, 5, 0, 1, 14,
+  1, 11, 6, 12, 1, 34, 1, 35, 2, 27, 1, 38, 1, 26, 1, 27,
+  1, 40, 5, 27, 1, 40, 1, 27, 1, 26, 1, 38, 2, 27, 1, 35,
+  1, 34, 6, 12, 1, 11, 1, 14, 4, 0, 1, 9, 1, 15, 7, 12,
+  1, 35, 4, 27, 1, 36, 1, 27, 1, 26, 1, 28, 3, 27, 1, 28,
+  1, 26, 1, 27, 1, 36, 4, 27, 1, 35, 7, 12, 1, 15, 1, 9,
+  3, 0, 1, 3, 1, 11, 2, 12, 1, 30, 1, 32, 2, 12, 1, 20,
+  5, 27, 1, 26, 1, 37, 1, 26, 1, 20, 1, 22, 1, 20, 1, 22,
+  1, 20, 1, 26, 1, 37, 1, 26, 5, 27, 1, 20, 2, 12, 1, 32,
+  1, 25, 2, 12, 1, 11, 1, 3, 2, 0, 1, 1, 1, 5, 2, 12,
+  1, 19, 1, 26, 1, 28, 1, 35, 1, 32, 1, 26, 5, 27, 1, 28,
+  1, 41, 1, 19, 5, 12, 1, 19, 1, 41, 1, 28, 5, 27, 1, 26,
+  1, 32, 1, 35, 1, 28, 1, 26, 1, 19, 2, 12, 1, 5, 1, 1,
+  1, 0, 1, 2, 1, 10, 2, 12, 1, 20, 3, 27, 1, 28, 1, 39,
+  1, 38, 3, 27, 1, 26, 1, 30, 9, 12, 1, 30, 1, 26, 3, 27,
+  1, 38, 1, 39, 1, 28, 3, 27, 1, 20, 2, 12, 1, 10, 1, 2,
+  1, 0, 1, 3, 1, 11, 2, 12, 1, 22, 1, 28, 4, 27, 1, 26,
+  1, 36, 1, 26, 1, 28, 1, 30, 11, 12, 1, 30, 1, 28, 1, 26,
+  1, 36, 1, 26, 4, 27, 1, 28, 1, 22, 2, 12, 1, 11, 1, 3,
+  1, 0, 1, 4, 4, 12, 1, 42, 1, 33, 1, 36, 1, 28, 3, 27,
+  1, 37, 1, 41, 4, 12, 1, 32, 3, 22, 1, 32, 4, 12, 1, 41,
+  1, 37, 3, 27, 1, 28, 1, 36, 1, 33, 1, 29, 4, 12, 1, 4,
+  1, 0, 1, 5, 6, 12, 1, 35, 1, 38, 1, 36, 1, 40, 2, 26,
+  1, 19, 3, 12, 1, 22, 1, 33, 1, 34, 1, 12, 1, 34, 1, 43,
+  1, 22, 3, 12, 1, 19, 2, 26, 1, 40, 1, 36, 1, 38, 1, 35,
+  6, 12, 1, 5, 1, 1, 1, 6, 5, 12, 1, 34, 1, 37, 3, 27,
+  1, 28, 1, 20, 3, 12, 1, 32, 1, 33, 5, 12, 1, 33, 1, 32,
+  3, 12, 1, 20, 1, 28, 3, 27, 1, 37, 1, 34, 5, 12, 1, 6,
+  1, 13, 1, 7, 5, 12, 1, 19, 1, 28, 4, 27, 1, 22, 3, 12,
+  1, 22, 1, 34, 5, 12, 1, 34, 1, 22, 3, 12, 1, 22, 4, 27,
+  1, 28, 1, 19, 5, 12, 1, 7, 1, 44, 1, 8, 5, 12, 1, 19,
+  1, 28, 4, 27, 1, 20, 3, 12, 1, 22, 7, 12, 1, 22, 3, 12,
+  1, 20, 4, 27, 1, 28, 1, 19, 5, 12, 1, 8, 1, 45, 1, 7,
+  5, 12, 1, 19, 1, 28, 4, 27, 1, 22, 3, 12, 1, 22, 1, 34,
+  5, 12, 1, 34, 1, 22, 3, 12, 1, 22, 4, 27, 1, 28, 1, 19,
+  5, 12, 1, 7, 1, 44, 1, 6, 5, 12, 1, 34, 1, 37, 3, 27,
+  1, 28, 1, 20, 3, 12, 1, 32, 1, 33, 5, 12, 1, 33, 1, 32,
+  3, 12, 1, 20, 1, 28, 3, 27, 1, 37, 1, 34, 5, 12, 1, 6,
+  1, 13, 1, 5, 6, 12, 1, 35, 1, 38, 1, 36, 1, 40, 2, 26,
+  1, 19, 3, 12, 1, 22, 1, 33, 1, 34, 1, 12, 1, 34, 1, 33,
+  1, 22, 3, 12, 1, 19, 2, 26, 1, 40, 1, 36, 1, 38, 1, 35,
+  6, 12, 1, 5, 1, 1, 1, 4, 4, 12, 1, 42, 1, 33, 1, 36,
+  1, 28, 3, 27, 1, 37, 1, 41, 4, 12, 1, 32, 3, 22, 1, 32,
+  4, 12, 1, 41, 1, 37, 3, 27, 1, 28, 1, 36, 1, 33, 1, 29,
+  4, 12, 1, 4, 1, 0, 1, 3, 1, 11, 2, 12, 1, 22, 1, 28,
+  4, 27, 1, 26, 1, 36, 1, 26, 1, 28, 1, 30, 11, 12, 1, 30,
+  1, 28, 1, 26, 1, 36, 1, 26, 4, 27, 1, 28, 1, 22, 2, 12,
+  1, 11, 1, 3, 1, 0, 1, 2, 1, 10, 2, 12, 1, 20, 3, 27,
+  1, 28, 1, 39, 1, 38, 3, 27, 1, 26, 1, 30, 9, 12, 1, 30,
+  1, 26, 3, 27, 1, 38, 1, 39, 1, 28, 3, 27, 1, 20, 2, 12,
+  1, 10, 1, 2, 1, 0, 1, 1, 1, 5, 2, 12, 1, 19, 1, 26,
+  1, 28, 1, 35, 1, 32, 1, 26, 5, 27, 1, 28, 1, 41, 1, 19,
+  5, 12, 1, 19, 1, 41, 1, 28, 5, 27, 1, 26, 1, 32, 1, 35,
+  1, 28, 1, 26, 1, 19, 2, 12, 1, 5, 1, 1, 2, 0, 1, 3,
+  1, 11, 2, 12, 1, 30, 1, 32, 2, 12, 1, 20, 5, 27, 1, 26,
+  1, 37, 1, 26, 1, 20, 1, 22, 1, 20, 1, 22, 1, 20, 1, 26,
+  1, 37, 1, 26, 5, 27, 1, 20, 2, 12, 1, 46, 1, 25, 2, 12,
+  1, 11, 1, 3, 3, 0, 1, 9, 1, 15, 7, 12, 1, 35, 4, 27,
+  1, 36, 1, 27, 1, 26, 1, 28, 3, 27, 1, 28, 1, 26, 1, 27,
+  1, 36, 4, 27, 1, 35, 7, 12, 1, 15, 1, 9, 4, 0, 1, 14,
+  1, 11, 6, 12, 1, 34, 1, 35, 2, 27, 1, 38, 1, 26, 1, 27,
+  1, 40, 5, 27, 1, 40, 1, 27, 1, 26, 1, 38, 2, 27, 1, 35,
+  1, 34, 6, 12, 1, 11, 1, 14, 5, 0, 1, 13, 1, 5, 8, 12,
+  1, 20, 1, 26, 1, 39, 2, 27, 1, 36, 5, 27, 1, 36, 2, 27,
+  1, 39, 1, 26, 1, 20, 8, 12, 1, 5, 1, 13, 6, 0, 1, 16,
+  1, 18, 8, 12, 1, 32, 1, 28, 1, 27, 1, 28, 1, 38, 5, 27,
+  1, 38, 1, 28, 1, 27, 1, 28, 1, 32, 8, 12, 1, 18, 1, 16,
+  8, 0, 1, 3, 1, 24, 7, 12, 1, 35, 2, 27, 1, 36, 1, 35,
+  1, 37, 3, 28, 1, 37, 1, 35, 1, 36, 2, 27, 1, 35, 7, 12,
+  1, 24, 1, 3, 9, 0, 1, 17, 1, 23, 1, 31, 5, 12, 1, 32,
+  1, 28, 2, 27, 1, 33, 1, 12, 1, 34, 3, 19, 1, 34, 1, 12,
+  1, 33, 2, 27, 1, 28, 1, 32, 5, 12, 1, 31, 1, 23, 1, 17,
+  10, 0, 1, 1, 1, 23, 1, 24, 4, 12, 1, 25, 1, 26, 1, 27,
+  1, 28, 1, 29, 7, 12, 1, 29, 1, 28, 1, 27, 1, 26, 1, 30,
+  4, 12, 1, 24, 1, 23, 1, 1, 12, 0, 1, 17, 1, 3, 1, 18,
+  4, 12, 1, 19, 1, 20, 1, 22, 9, 12, 1, 22, 1, 20, 1, 19,
+  4, 12, 1, 18, 1, 3, 1, 17, 15, 0, 1, 16, 1, 5, 1, 11,
+  19, 12, 1, 11, 1, 5, 1, 16, 18, 0, 1, 13, 1, 14, 1, 15,
+  1, 11, 15, 12, 1, 11, 1, 15, 1, 14, 1, 13, 21, 0, 1, 9,
+  1, 3, 1, 5, 1, 10, 1, 11, 9, 12, 1, 11, 1, 10, 1, 5,
+  1, 3, 1, 9, 25, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5,
+  1, 6, 1, 7, 1, 8, 1, 7, 1, 6, 1, 5, 1, 4, 1, 3,
+  1, 2, 1, 1, 31, 0, 1, 1, 1, 13, 1, 44, 1, 45, 1, 44,
+  1, 13, 1, 1, 18, 0
 };
+static constexpr CompressedIcon kCircularIcon_settings{42, 42, kCircularIcon_settings_Palette, 47, kCircularIcon_settings_Rle, 1638};
 
 static constexpr int kCircularIcon_bounds_W = 42;
 static constexpr int kCircularIcon_bounds_H = 42;
 static constexpr uint16_t kCircularIcon_bounds_Color = 0x0000;
-static const uint16_t kCircularIcon_bounds[1764] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x0965, 0x1ACB,
-  0x2C71, 0x3D76, 0x4618, 0x4659, 0x467A, 0x4659, 0x4618, 0x3D76, 0x2C71, 0x1ACB, 0x0965, 0x0041, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08C3, 0x1AEB, 0x3D55, 0x4EBB, 0x4F5D, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x4F5D, 0x4EBB, 0x3D55, 0x1AEB, 0x08C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0082, 0x230C, 0x45F8,
-  0x4F3D, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x4F3D, 0x45F8, 0x230C, 0x0082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11A6, 0x3D55, 0x4F3D, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x4F3D, 0x3D55, 0x11A6, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1AEB,
-  0x469A, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x469A, 0x1AEB, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x238E, 0x4EFC, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x4EFC, 0x238E, 0x0041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x238E, 0x4F1C, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x5F7E, 0x677E,
-  0x677E, 0x677E, 0x5F7E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x4F1C, 0x238E,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1AEB, 0x4EFC, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x6F7E, 0x8F9E, 0xB7BE, 0xC7BE, 0xC7BE, 0xC7BE, 0xC7BE, 0xC7BE, 0xB7BE, 0x8F9E, 0x6F7E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x4EFC, 0x1AEB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x11A6, 0x469A, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x6F7E, 0xAFBE, 0xC7BE,
-  0xB7BE, 0x8F9E, 0x777E, 0x677E, 0x677E, 0x677E, 0x777E, 0x8F9E, 0xB7BE, 0xC7BE, 0xAFBE, 0x6F7E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x469A, 0x11A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0082, 0x3D55, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x8F9E, 0xC7BE, 0xA79E, 0x6F7E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x6F7E, 0xA79E, 0xC7BE, 0x8F9E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x3D55,
-  0x0082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x230C, 0x4F3D, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x5F7E, 0xA79E,
-  0xC7BE, 0x777E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x777E, 0x979E, 0x777E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x777E,
-  0xC7BE, 0xA79E, 0x5F7E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x4F3D, 0x230C, 0x0000, 0x0000, 0x0000, 0x0000, 0x08C3,
-  0x45F8, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0xA79E, 0xBFBE, 0x677E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x979E, 0xD7DE, 0x979E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x677E, 0xBFBE, 0xA79E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x45F8, 0x08C3, 0x0000, 0x0000, 0x0000, 0x1AEB, 0x4F3D, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x8F9E, 0xC7BE, 0x677E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x677E, 0xC7BE, 0x8F9E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x4F3D, 0x1AEB,
-  0x0000, 0x0000, 0x0041, 0x3D55, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x6F7E, 0xC7BE, 0x777E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x777E, 0xC7BE, 0x6F7E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x3D55, 0x0041, 0x0000, 0x0965, 0x4EBB, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0xAFBE, 0xA79E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x5F7E, 0x777E,
-  0x7F9E, 0x777E, 0x5F7E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0xA79E, 0xAFBE, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x4EBB, 0x0965, 0x0000, 0x1ACB, 0x4F5D, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x6F7E, 0xC7BE, 0x6F7E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x979E, 0xB7BE, 0x9F9E, 0x8F9E, 0x9F9E, 0xB7BE, 0x979E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x6F7E, 0xC7BE, 0x6F7E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x4F5D, 0x1ACB, 0x0000,
-  0x2C71, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x8F9E, 0xB7BE, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0xAFBE, 0x8F9E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x8F9E, 0xAFBE, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0xB7BE, 0x8F9E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x2C71, 0x0000, 0x3D76, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0xB7BE, 0x8F9E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x979E, 0x8F9E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x8F9E, 0x979E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x8F9E, 0xB7BE, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x3D76, 0x0041, 0x4618, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x5F7E, 0xC7BE, 0x777E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x5F7E, 0xB7BE, 0x577E, 0x577E, 0x5F7E, 0x7F9E, 0x979E, 0x7F9E, 0x5F7E, 0x577E, 0x577E, 0xB7BE, 0x5F7E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x777E, 0xC7BE, 0x5F7E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x4618, 0x0082, 0x4659, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x677E, 0xC7BE, 0x677E, 0x577E, 0x777E, 0x979E, 0x577E, 0x577E, 0x777E, 0x9F9E, 0x577E, 0x577E,
-  0x7F9E, 0xAFBE, 0xBFBE, 0xAFBE, 0x7F9E, 0x577E, 0x577E, 0x9F9E, 0x777E, 0x577E, 0x577E, 0x979E, 0x777E, 0x577E, 0x677E, 0xC7BE,
-  0x677E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x4659, 0x08C3, 0x467A, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x677E, 0xC7BE,
-  0x677E, 0x577E, 0x979E, 0xD7DE, 0x577E, 0x577E, 0x7F9E, 0x8F9E, 0x577E, 0x577E, 0x979E, 0xBFBE, 0xDFDE, 0xBFBE, 0x979E, 0x577E,
-  0x577E, 0x8F9E, 0x7F9E, 0x577E, 0x577E, 0xD7DE, 0x979E, 0x577E, 0x677E, 0xC7BE, 0x677E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x467A, 0x08E3, 0x4659, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x677E, 0xC7BE, 0x677E, 0x577E, 0x777E, 0x979E, 0x577E, 0x577E,
-  0x777E, 0x9F9E, 0x577E, 0x577E, 0x7F9E, 0xAFBE, 0xBFBE, 0xAFBE, 0x7F9E, 0x577E, 0x577E, 0x9F9E, 0x777E, 0x577E, 0x577E, 0x979E,
-  0x777E, 0x577E, 0x677E, 0xC7BE, 0x677E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x4659, 0x08C3, 0x4618, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x5F7E, 0xC7BE, 0x777E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x5F7E, 0xB7BE, 0x577E, 0x577E, 0x5F7E, 0x7F9E,
-  0x979E, 0x7F9E, 0x5F7E, 0x577E, 0x577E, 0xB7BE, 0x5F7E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x777E, 0xC7BE, 0x5F7E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x4618, 0x0082, 0x3D76, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0xB7BE, 0x8F9E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x979E, 0x8F9E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x8F9E, 0x979E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x8F9E, 0xB7BE, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x3D76, 0x0041,
-  0x2C71, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x8F9E, 0xB7BE, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0xAFBE, 0x8F9E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x8F9E, 0xAFBE, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0xB7BE, 0x8F9E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x2C71, 0x0000, 0x1ACB, 0x4F5D, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x6F7E, 0xC7BE, 0x6F7E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x979E, 0xB7BE, 0x9F9E, 0x8F9E, 0x9F9E,
-  0xB7BE, 0x979E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x6F7E, 0xC7BE, 0x6F7E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x4F5D, 0x1ACB, 0x0000, 0x0965, 0x4EBB, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0xAFBE, 0xA79E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x5F7E, 0x777E, 0x7F9E, 0x777E, 0x5F7E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0xA79E, 0xAFBE, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x4EBB, 0x0965, 0x0000, 0x0041, 0x3D55,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x6F7E, 0xC7BE, 0x777E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x777E, 0xC7BE, 0x6F7E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x3D55, 0x0041, 0x0000, 0x0000, 0x1AEB, 0x4F3D, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x8F9E, 0xC7BE, 0x677E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x677E, 0xC7BE, 0x8F9E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x4F3D, 0x1AEB,
-  0x0000, 0x0000, 0x0000, 0x08C3, 0x45F8, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0xA79E, 0xBFBE, 0x677E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x979E, 0xD7DE, 0x979E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x677E, 0xBFBE,
-  0xA79E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x45F8, 0x08C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x230C, 0x4F3D,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x5F7E, 0xA79E, 0xC7BE, 0x777E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x777E,
-  0x979E, 0x777E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x777E, 0xC7BE, 0xA79E, 0x5F7E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x4F3D, 0x230C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0082, 0x3D55, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x8F9E, 0xC7BE, 0xA79E, 0x6F7E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x6F7E,
-  0xA79E, 0xC7BE, 0x8F9E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x3D55, 0x0082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x11A6, 0x469A, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x6F7E, 0xAFBE, 0xC7BE,
-  0xB7BE, 0x8F9E, 0x777E, 0x677E, 0x677E, 0x677E, 0x777E, 0x8F9E, 0xB7BE, 0xC7BE, 0xAFBE, 0x6F7E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x469A, 0x11A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1AEB, 0x4EFC,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x6F7E, 0x8F9E, 0xB7BE, 0xC7BE, 0xC7BE, 0xC7BE, 0xC7BE,
-  0xC7BE, 0xB7BE, 0x8F9E, 0x6F7E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x4EFC, 0x1AEB, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x238E, 0x4F1C, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x5F7E, 0x677E, 0x677E, 0x677E, 0x5F7E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x4F1C, 0x238E, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0041, 0x238E, 0x4EFC, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x4EFC,
-  0x238E, 0x0041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1AEB,
-  0x469A, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x469A, 0x1AEB, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11A6, 0x3D55, 0x4F3D, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x4F3D, 0x3D55, 0x11A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0082, 0x230C, 0x45F8, 0x4F3D, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E,
-  0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x4F3D, 0x45F8, 0x230C, 0x0082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x08C3, 0x1AEB, 0x3D55, 0x4EBB, 0x4F5D, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x577E, 0x4F5D,
-  0x4EBB, 0x3D55, 0x1AEB, 0x08C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x0965, 0x1ACB,
-  0x2C71, 0x3D76, 0x4618, 0x4659, 0x467A, 0x4659, 0x4618, 0x3D76, 0x2C71, 0x1ACB, 0x0965, 0x0041, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x0082, 0x08C3, 0x08E3, 0x08C3,
-  0x0082, 0x0041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000,
+static constexpr uint16_t kCircularIcon_bounds_Palette[41] = {
+  0x0000, 0x0041, 0x0965, 0x1ACB, 0x2C71, 0x3D76, 0x4618, 0x4659, 0x467A, 0x08C3, 0x1AEB, 0x3D55, 0x4EBB, 0x4F5D, 0x577E, 0x0082,
+  0x230C, 0x45F8, 0x4F3D, 0x11A6, 0x0020, 0x469A, 0x238E, 0x4EFC, 0x4F1C, 0x5F7E, 0x677E, 0x6F7E, 0x8F9E, 0xB7BE, 0xC7BE, 0xAFBE,
+  0x777E, 0xA79E, 0x979E, 0xBFBE, 0xD7DE, 0x7F9E, 0x9F9E, 0xDFDE, 0x08E3
+};
+static constexpr uint8_t kCircularIcon_bounds_Rle[1342] = {
+  13, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5, 1, 6, 1, 7,
+  1, 8, 1, 7, 1, 6, 1, 5, 1, 4, 1, 3, 1, 2, 1, 1,
+  25, 0, 1, 9, 1, 10, 1, 11, 1, 12, 1, 13, 9, 14, 1, 13,
+  1, 12, 1, 11, 1, 10, 1, 9, 21, 0, 1, 15, 1, 16, 1, 17,
+  1, 18, 15, 14, 1, 18, 1, 17, 1, 16, 1, 15, 18, 0, 1, 19,
+  1, 11, 1, 18, 19, 14, 1, 18, 1, 11, 1, 19, 15, 0, 1, 20,
+  1, 10, 1, 21, 23, 14, 1, 21, 1, 10, 1, 20, 12, 0, 1, 1,
+  1, 22, 1, 23, 25, 14, 1, 23, 1, 22, 1, 1, 10, 0, 1, 20,
+  1, 22, 1, 24, 11, 14, 1, 25, 3, 26, 1, 25, 11, 14, 1, 24,
+  1, 22, 1, 20, 9, 0, 1, 10, 1, 23, 9, 14, 1, 27, 1, 28,
+  1, 29, 5, 30, 1, 29, 1, 28, 1, 27, 9, 14, 1, 23, 1, 10,
+  8, 0, 1, 19, 1, 21, 8, 14, 1, 27, 1, 31, 1, 30, 1, 29,
+  1, 28, 1, 32, 3, 26, 1, 32, 1, 28, 1, 29, 1, 30, 1, 31,
+  1, 27, 8, 14, 1, 21, 1, 19, 6, 0, 1, 15, 1, 11, 8, 14,
+  1, 28, 1, 30, 1, 33, 1, 27, 9, 14, 1, 27, 1, 33, 1, 30,
+  1, 28, 8, 14, 1, 11, 1, 15, 5, 0, 1, 16, 1, 18, 6, 14,
+  1, 25, 1, 33, 1, 30, 1, 32, 5, 14, 1, 32, 1, 34, 1, 32,
+  5, 14, 1, 32, 1, 30, 1, 33, 1, 25, 6, 14, 1, 18, 1, 16,
+  4, 0, 1, 9, 1, 17, 7, 14, 1, 33, 1, 35, 1, 26, 6, 14,
+  1, 34, 1, 36, 1, 34, 6, 14, 1, 26, 1, 35, 1, 33, 7, 14,
+  1, 17, 1, 9, 3, 0, 1, 10, 1, 18, 6, 14, 1, 28, 1, 30,
+  1, 26, 17, 14, 1, 26, 1, 30, 1, 28, 6, 14, 1, 18, 1, 10,
+  2, 0, 1, 1, 1, 11, 6, 14, 1, 27, 1, 30, 1, 32, 19, 14,
+  1, 32, 1, 30, 1, 27, 6, 14, 1, 11, 1, 1, 1, 0, 1, 2,
+  1, 12, 6, 14, 1, 31, 1, 33, 8, 14, 1, 25, 1, 32, 1, 37,
+  1, 32, 1, 25, 8, 14, 1, 33, 1, 31, 6, 14, 1, 12, 1, 2,
+  1, 0, 1, 3, 1, 13, 5, 14, 1, 27, 1, 30, 1, 27, 7, 14,
+  1, 34, 1, 29, 1, 38, 1, 28, 1, 38, 1, 29, 1, 34, 7, 14,
+  1, 27, 1, 30, 1, 27, 5, 14, 1, 13, 1, 3, 1, 0, 1, 4,
+  6, 14, 1, 28, 1, 29, 7, 14, 1, 31, 1, 28, 5, 14, 1, 28,
+  1, 31, 7, 14, 1, 29, 1, 28, 6, 14, 1, 4, 1, 0, 1, 5,
+  6, 14, 1, 29, 1, 28, 6, 14, 1, 34, 1, 28, 7, 14, 1, 28,
+  1, 34, 6, 14, 1, 28, 1, 29, 6, 14, 1, 5, 1, 1, 1, 6,
+  5, 14, 1, 25, 1, 30, 1, 32, 5, 14, 1, 25, 1, 29, 2, 14,
+  1, 25, 1, 37, 1, 34, 1, 37, 1, 25, 2, 14, 1, 29, 1, 25,
+  5, 14, 1, 32, 1, 30, 1, 25, 5, 14, 1, 6, 1, 15, 1, 7,
+  5, 14, 1, 26, 1, 30, 1, 26, 1, 14, 1, 32, 1, 34, 2, 14,
+  1, 32, 1, 38, 2, 14, 1, 37, 1, 31, 1, 35, 1, 31, 1, 37,
+  2, 14, 1, 38, 1, 32, 2, 14, 1, 34, 1, 32, 1, 14, 1, 26,
+  1, 30, 1, 26, 5, 14, 1, 7, 1, 9, 1, 8, 5, 14, 1, 26,
+  1, 30, 1, 26, 1, 14, 1, 34, 1, 36, 2, 14, 1, 37, 1, 28,
+  2, 14, 1, 34, 1, 35, 1, 39, 1, 35, 1, 34, 2, 14, 1, 28,
+  1, 37, 2, 14, 1, 36, 1, 34, 1, 14, 1, 26, 1, 30, 1, 26,
+  5, 14, 1, 8, 1, 40, 1, 7, 5, 14, 1, 26, 1, 30, 1, 26,
+  1, 14, 1, 32, 1, 34, 2, 14, 1, 32, 1, 38, 2, 14, 1, 37,
+  1, 31, 1, 35, 1, 31, 1, 37, 2, 14, 1, 38, 1, 32, 2, 14,
+  1, 34, 1, 32, 1, 14, 1, 26, 1, 30, 1, 26, 5, 14, 1, 7,
+  1, 9, 1, 6, 5, 14, 1, 25, 1, 30, 1, 32, 5, 14, 1, 25,
+  1, 29, 2, 14, 1, 25, 1, 37, 1, 34, 1, 37, 1, 25, 2, 14,
+  1, 29, 1, 25, 5, 14, 1, 32, 1, 30, 1, 25, 5, 14, 1, 6,
+  1, 15, 1, 5, 6, 14, 1, 29, 1, 28, 6, 14, 1, 34, 1, 28,
+  7, 14, 1, 28, 1, 34, 6, 14, 1, 28, 1, 29, 6, 14, 1, 5,
+  1, 1, 1, 4, 6, 14, 1, 28, 1, 29, 7, 14, 1, 31, 1, 28,
+  5, 14, 1, 28, 1, 31, 7, 14, 1, 29, 1, 28, 6, 14, 1, 4,
+  1, 0, 1, 3, 1, 13, 5, 14, 1, 27, 1, 30, 1, 27, 7, 14,
+  1, 34, 1, 29, 1, 38, 1, 28, 1, 38, 1, 29, 1, 34, 7, 14,
+  1, 27, 1, 30, 1, 27, 5, 14, 1, 13, 1, 3, 1, 0, 1, 2,
+  1, 12, 6, 14, 1, 31, 1, 33, 8, 14, 1, 25, 1, 32, 1, 37,
+  1, 32, 1, 25, 8, 14, 1, 33, 1, 31, 6, 14, 1, 12, 1, 2,
+  1, 0, 1, 1, 1, 11, 6, 14, 1, 27, 1, 30, 1, 32, 19, 14,
+  1, 32, 1, 30, 1, 27, 6, 14, 1, 11, 1, 1, 2, 0, 1, 10,
+  1, 18, 6, 14, 1, 28, 1, 30, 1, 26, 17, 14, 1, 26, 1, 30,
+  1, 28, 6, 14, 1, 18, 1, 10, 3, 0, 1, 9, 1, 17, 7, 14,
+  1, 33, 1, 35, 1, 26, 6, 14, 1, 34, 1, 36, 1, 34, 6, 14,
+  1, 26, 1, 35, 1, 33, 7, 14, 1, 17, 1, 9, 4, 0, 1, 16,
+  1, 18, 6, 14, 1, 25, 1, 33, 1, 30, 1, 32, 5, 14, 1, 32,
+  1, 34, 1, 32, 5, 14, 1, 32, 1, 30, 1, 33, 1, 25, 6, 14,
+  1, 18, 1, 16, 5, 0, 1, 15, 1, 11, 8, 14, 1, 28, 1, 30,
+  1, 33, 1, 27, 9, 14, 1, 27, 1, 33, 1, 30, 1, 28, 8, 14,
+  1, 11, 1, 15, 6, 0, 1, 19, 1, 21, 8, 14, 1, 27, 1, 31,
+  1, 30, 1, 29, 1, 28, 1, 32, 3, 26, 1, 32, 1, 28, 1, 29,
+  1, 30, 1, 31, 1, 27, 8, 14, 1, 21, 1, 19, 8, 0, 1, 10,
+  1, 23, 9, 14, 1, 27, 1, 28, 1, 29, 5, 30, 1, 29, 1, 28,
+  1, 27, 9, 14, 1, 23, 1, 10, 9, 0, 1, 20, 1, 22, 1, 24,
+  11, 14, 1, 25, 3, 26, 1, 25, 11, 14, 1, 24, 1, 22, 1, 20,
+  10, 0, 1, 1, 1, 22, 1, 23, 25, 14, 1, 23, 1, 22, 1, 1,
+  12, 0, 1, 20, 1, 10, 1, 21, 23, 14, 1, 21, 1, 10, 1, 20,
+  15, 0, 1, 19, 1, 11, 1, 18, 19, 14, 1, 18, 1, 11, 1, 19,
+  18, 0, 1, 15, 1, 16, 1, 17, 1, 18, 15, 14, 1, 18, 1, 17,
+  1, 16, 1, 15, 21, 0, 1, 9, 1, 10, 1, 11, 1, 12, 1, 13,
+  9, 14, 1, 13, 1, 12, 1, 11, 1, 10, 1, 9, 25, 0, 1, 1,
+  1, 2, 1, 3, 1, 4, 1, 5, 1, 6, 1, 7, 1, 8, 1, 7,
+  1, 6, 1, 5, 1, 4, 1, 3, 1, 2, 1, 1, 31, 0, 1, 1,
+  1, 15, 1, 9, 1, 40, 1, 9, 1, 15, 1, 1, 18, 0
 };
+static constexpr CompressedIcon kCircularIcon_bounds{42, 42, kCircularIcon_bounds_Palette, 41, kCircularIcon_bounds_Rle, 1342};
 
 static constexpr int kCircularIcon_live_W = 42;
 static constexpr int kCircularIcon_live_H = 42;
 static constexpr uint16_t kCircularIcon_live_Color = 0x0000;
-static const uint16_t kCircularIcon_live[1764] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x00A1, 0x0163,
-  0x0225, 0x02A6, 0x02E7, 0x0307, 0x0327, 0x0307, 0x02E7, 0x02A6, 0x0225, 0x0163, 0x00A1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0163, 0x0286, 0x0348, 0x0388, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x0388, 0x0348, 0x0286, 0x0163, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0163, 0x02E7,
-  0x0388, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x0388, 0x02E7, 0x0163, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00C2, 0x0286, 0x0388, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0388, 0x0286, 0x00C2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0163,
-  0x0327, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0327, 0x0163, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x01A4, 0x0368, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x0368, 0x01A4, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x01A4, 0x0368, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0368, 0x01A4,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0163, 0x0368, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0368, 0x0163, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x00C2, 0x0327, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0327, 0x00C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0286, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0286,
-  0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0163, 0x0388, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0388, 0x0163, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060,
-  0x02E7, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x02E7, 0x0060, 0x0000, 0x0000, 0x0000, 0x0163, 0x0388, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0388, 0x0163,
-  0x0000, 0x0000, 0x0020, 0x0286, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x13EA, 0x242C, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0286, 0x0020, 0x0000, 0x00A1, 0x0348, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x242B, 0xD73B, 0x8E15, 0x242C, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x0348, 0x00A1, 0x0000, 0x0163, 0x0388, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x242B, 0xDF7C, 0xEFBD, 0xDF7C, 0x8E15, 0x242C, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0388, 0x0163, 0x0000,
-  0x0225, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x242B,
-  0xDF7C, 0xEFBD, 0xEFBD, 0xEFBD, 0xDF7C, 0x8E15, 0x242C, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0225, 0x0000, 0x02A6, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x242B, 0xDF7C, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD,
-  0xDF7C, 0x8E15, 0x242C, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x02A6, 0x0020, 0x02E7, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x242B, 0xDF7C, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xDF7C, 0x8E15, 0x242C, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x02E7, 0x0040, 0x0307, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x242B, 0xDF7C, 0xEFBD,
-  0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xDF7C, 0x8E15, 0x242C, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0307, 0x0061, 0x0327, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x242B, 0xDF7C, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD,
-  0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xD73B, 0x4CCF, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x0327, 0x0061, 0x0307, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x242B, 0xDF7C, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xDF7C, 0x8E15, 0x242C, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0307, 0x0061, 0x02E7, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x242B, 0xDF7C, 0xEFBD, 0xEFBD, 0xEFBD,
-  0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xDF7C, 0x8E15, 0x242C, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x02E7, 0x0040, 0x02A6, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x242B, 0xDF7C, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xEFBD, 0xDF7C, 0x8E15, 0x242C, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x02A6, 0x0020,
-  0x0225, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x242B,
-  0xDF7C, 0xEFBD, 0xEFBD, 0xEFBD, 0xDF7C, 0x8E15, 0x242C, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0225, 0x0000, 0x0163, 0x0388, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x242B, 0xDF7C, 0xEFBD, 0xDF7C, 0x8E15, 0x242C, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x0388, 0x0163, 0x0000, 0x00A1, 0x0348, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x242B, 0xD73B, 0x8E15, 0x242C, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0348, 0x00A1, 0x0000, 0x0020, 0x0286,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x13EA, 0x242C, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0286, 0x0020, 0x0000, 0x0000, 0x0163, 0x0388, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0388, 0x0163,
-  0x0000, 0x0000, 0x0000, 0x0060, 0x02E7, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x02E7, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0163, 0x0388,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x0388, 0x0163, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0286, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0286, 0x0040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x00C2, 0x0327, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0327, 0x00C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0163, 0x0368,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0368, 0x0163, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01A4, 0x0368, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0368, 0x01A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x01A4, 0x0368, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0368,
-  0x01A4, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0163,
-  0x0327, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0327, 0x0163, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00C2, 0x0286, 0x0388, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x0388, 0x0286, 0x00C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0163, 0x02E7, 0x0388, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
-  0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0388, 0x02E7, 0x0163, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0060, 0x0163, 0x0286, 0x0348, 0x0388, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x0388,
-  0x0348, 0x0286, 0x0163, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x00A1, 0x0163,
-  0x0225, 0x02A6, 0x02E7, 0x0307, 0x0327, 0x0307, 0x02E7, 0x02A6, 0x0225, 0x0163, 0x00A1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0040, 0x0061, 0x0061, 0x0061,
-  0x0040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000,
+static constexpr uint16_t kCircularIcon_live_Palette[27] = {
+  0x0000, 0x0020, 0x00A1, 0x0163, 0x0225, 0x02A6, 0x02E7, 0x0307, 0x0327, 0x0060, 0x0286, 0x0348, 0x0388, 0x03A9, 0x0040, 0x00C2,
+  0x01A4, 0x0368, 0x13EA, 0x242C, 0x242B, 0xD73B, 0x8E15, 0xDF7C, 0xEFBD, 0x0061, 0x4CCF
 };
+static constexpr uint8_t kCircularIcon_live_Rle[750] = {
+  13, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5, 1, 6, 1, 7,
+  1, 8, 1, 7, 1, 6, 1, 5, 1, 4, 1, 3, 1, 2, 1, 1,
+  25, 0, 1, 9, 1, 3, 1, 10, 1, 11, 1, 12, 9, 13, 1, 12,
+  1, 11, 1, 10, 1, 3, 1, 9, 21, 0, 1, 14, 1, 3, 1, 6,
+  1, 12, 15, 13, 1, 12, 1, 6, 1, 3, 1, 14, 18, 0, 1, 15,
+  1, 10, 1, 12, 19, 13, 1, 12, 1, 10, 1, 15, 16, 0, 1, 3,
+  1, 8, 23, 13, 1, 8, 1, 3, 13, 0, 1, 1, 1, 16, 1, 17,
+  25, 13, 1, 17, 1, 16, 1, 1, 11, 0, 1, 16, 1, 17, 27, 13,
+  1, 17, 1, 16, 10, 0, 1, 3, 1, 17, 29, 13, 1, 17, 1, 3,
+  8, 0, 1, 15, 1, 8, 31, 13, 1, 8, 1, 15, 6, 0, 1, 14,
+  1, 10, 33, 13, 1, 10, 1, 14, 5, 0, 1, 3, 1, 12, 33, 13,
+  1, 12, 1, 3, 4, 0, 1, 9, 1, 6, 35, 13, 1, 6, 1, 9,
+  3, 0, 1, 3, 1, 12, 35, 13, 1, 12, 1, 3, 2, 0, 1, 1,
+  1, 10, 13, 13, 1, 18, 1, 19, 22, 13, 1, 10, 1, 1, 1, 0,
+  1, 2, 1, 11, 13, 13, 1, 20, 1, 21, 1, 22, 1, 19, 20, 13,
+  1, 11, 1, 2, 1, 0, 1, 3, 1, 12, 13, 13, 1, 20, 1, 23,
+  1, 24, 1, 23, 1, 22, 1, 19, 18, 13, 1, 12, 1, 3, 1, 0,
+  1, 4, 14, 13, 1, 20, 1, 23, 3, 24, 1, 23, 1, 22, 1, 19,
+  17, 13, 1, 4, 1, 0, 1, 5, 14, 13, 1, 20, 1, 23, 5, 24,
+  1, 23, 1, 22, 1, 19, 15, 13, 1, 5, 1, 1, 1, 6, 14, 13,
+  1, 20, 1, 23, 7, 24, 1, 23, 1, 22, 1, 19, 13, 13, 1, 6,
+  1, 14, 1, 7, 14, 13, 1, 20, 1, 23, 9, 24, 1, 23, 1, 22,
+  1, 19, 11, 13, 1, 7, 1, 25, 1, 8, 14, 13, 1, 20, 1, 23,
+  11, 24, 1, 21, 1, 26, 10, 13, 1, 8, 1, 25, 1, 7, 14, 13,
+  1, 20, 1, 23, 9, 24, 1, 23, 1, 22, 1, 19, 11, 13, 1, 7,
+  1, 25, 1, 6, 14, 13, 1, 20, 1, 23, 7, 24, 1, 23, 1, 22,
+  1, 19, 13, 13, 1, 6, 1, 14, 1, 5, 14, 13, 1, 20, 1, 23,
+  5, 24, 1, 23, 1, 22, 1, 19, 15, 13, 1, 5, 1, 1, 1, 4,
+  14, 13, 1, 20, 1, 23, 3, 24, 1, 23, 1, 22, 1, 19, 17, 13,
+  1, 4, 1, 0, 1, 3, 1, 12, 13, 13, 1, 20, 1, 23, 1, 24,
+  1, 23, 1, 22, 1, 19, 18, 13, 1, 12, 1, 3, 1, 0, 1, 2,
+  1, 11, 13, 13, 1, 20, 1, 21, 1, 22, 1, 19, 20, 13, 1, 11,
+  1, 2, 1, 0, 1, 1, 1, 10, 13, 13, 1, 18, 1, 19, 22, 13,
+  1, 10, 1, 1, 2, 0, 1, 3, 1, 12, 35, 13, 1, 12, 1, 3,
+  3, 0, 1, 9, 1, 6, 35, 13, 1, 6, 1, 9, 4, 0, 1, 3,
+  1, 12, 33, 13, 1, 12, 1, 3, 5, 0, 1, 14, 1, 10, 33, 13,
+  1, 10, 1, 14, 6, 0, 1, 15, 1, 8, 31, 13, 1, 8, 1, 15,
+  8, 0, 1, 3, 1, 17, 29, 13, 1, 17, 1, 3, 10, 0, 1, 16,
+  1, 17, 27, 13, 1, 17, 1, 16, 11, 0, 1, 1, 1, 16, 1, 17,
+  25, 13, 1, 17, 1, 16, 1, 1, 13, 0, 1, 3, 1, 8, 23, 13,
+  1, 8, 1, 3, 16, 0, 1, 15, 1, 10, 1, 12, 19, 13, 1, 12,
+  1, 10, 1, 15, 18, 0, 1, 14, 1, 3, 1, 6, 1, 12, 15, 13,
+  1, 12, 1, 6, 1, 3, 1, 14, 21, 0, 1, 9, 1, 3, 1, 10,
+  1, 11, 1, 12, 9, 13, 1, 12, 1, 11, 1, 10, 1, 3, 1, 9,
+  25, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5, 1, 6, 1, 7,
+  1, 8, 1, 7, 1, 6, 1, 5, 1, 4, 1, 3, 1, 2, 1, 1,
+  31, 0, 1, 1, 1, 14, 3, 25, 1, 14, 1, 1, 18, 0
+};
+static constexpr CompressedIcon kCircularIcon_live{42, 42, kCircularIcon_live_Palette, 27, kCircularIcon_live_Rle, 750};
 
 static constexpr int kCircularIcon_terminal_W = 42;
 static constexpr int kCircularIcon_terminal_H = 42;
 static constexpr uint16_t kCircularIcon_terminal_Color = 0x0000;
-static const uint16_t kCircularIcon_terminal[1764] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0900,
-  0x0980, 0x11E0, 0x1220, 0x1240, 0x1240, 0x1240, 0x1220, 0x11E0, 0x0980, 0x0900, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0900, 0x11E0, 0x1260, 0x1280, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1280, 0x1260, 0x11E0, 0x0900, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0900, 0x1200,
-  0x1280, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1280, 0x1200, 0x0900, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x11E0, 0x1280, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1280, 0x11E0, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0900,
-  0x1240, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1240, 0x0900, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0940, 0x1260, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1260, 0x0940, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0940, 0x1280, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1280, 0x0940,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0900, 0x1260, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1260, 0x0900, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0080, 0x1240, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1240, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x11E0, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x11E0,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0900, 0x1280, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1280, 0x0900, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040,
-  0x1200, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1200, 0x0040, 0x0000, 0x0000, 0x0000, 0x0900, 0x1280, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1280, 0x0900,
-  0x0000, 0x0000, 0x0000, 0x11E0, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x3324, 0x8D50, 0xCED8, 0x8D50, 0x3324, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x11E0, 0x0000, 0x0000, 0x0060, 0x1260, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x3324, 0x8D50, 0xCED8,
-  0x8D50, 0x3324, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1260, 0x0060, 0x0000, 0x0900, 0x1280, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x3324, 0x8D50, 0xCED8, 0x8D50, 0x3324, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1280, 0x0900, 0x0000,
-  0x0980, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x3324,
-  0x8D50, 0xCED8, 0x8D50, 0x3324, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x0980, 0x0000, 0x11E0, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x3324, 0x8D50, 0xCED8, 0x8D50, 0x3324, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x11E0, 0x0000, 0x1220, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x3324, 0x8D50, 0xCED8, 0x8D50, 0x3324, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1220, 0x0020, 0x1240, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x22C2, 0x74AC, 0xCED8, 0x9DD3, 0x43A6, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1240, 0x0040, 0x1240, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x3324, 0x8D50, 0xCED8, 0x8D50, 0x3324, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1240, 0x0040, 0x1240, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x3324, 0x8D50, 0xCED8, 0x8D50, 0x3324, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1240, 0x0040, 0x1220, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x3324, 0x8D50, 0xCED8, 0x8D50, 0x3324,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1220, 0x0020, 0x11E0, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x3324, 0x8D50, 0xCED8, 0x8D50, 0x3324, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x11E0, 0x0000,
-  0x0980, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x3324, 0x8D50, 0xCED8, 0x8D50, 0x3344, 0x22E2, 0x22E2, 0x22E2, 0x22E2, 0x22E2, 0x22E2, 0x22E2, 0x22E2, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x0980, 0x0000, 0x0900, 0x1280, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x3324, 0x8D50, 0xCED8, 0x8D50,
-  0x7D0E, 0x7D0E, 0x7D0E, 0x7D0E, 0x7D0E, 0x7D0E, 0x7D0E, 0x7D0E, 0x3B86, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1280, 0x0900, 0x0000, 0x0060, 0x1260, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x5C2A, 0xCED9, 0xCED9, 0xCED9, 0xCED9, 0xCED9, 0xCED9,
-  0xCED9, 0xCED9, 0x5C2A, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1260, 0x0060, 0x0000, 0x0000, 0x11E0,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x3B86, 0x7D0E, 0x7D0E, 0x7D0E, 0x7D0E, 0x7D0E, 0x7D0E, 0x7D0E, 0x7D0E, 0x3B86, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x11E0, 0x0000, 0x0000, 0x0000, 0x0900, 0x1280, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x22E2, 0x22E2,
-  0x22E2, 0x22E2, 0x22E2, 0x22E2, 0x22E2, 0x22E2, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1280, 0x0900,
-  0x0000, 0x0000, 0x0000, 0x0040, 0x1200, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1200, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0900, 0x1280,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1280, 0x0900, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x11E0, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x11E0, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0080, 0x1240, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1240, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0900, 0x1260,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1260, 0x0900, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0940, 0x1280, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1280, 0x0940, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0940, 0x1260, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1260,
-  0x0940, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0900,
-  0x1240, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1240, 0x0900, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x11E0, 0x1280, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1280, 0x11E0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0900, 0x1200, 0x1280, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1,
-  0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1280, 0x1200, 0x0900, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0040, 0x0900, 0x11E0, 0x1260, 0x1280, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1AA1, 0x1280,
-  0x1260, 0x11E0, 0x0900, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0900,
-  0x0980, 0x11E0, 0x1220, 0x1240, 0x1240, 0x1240, 0x1220, 0x11E0, 0x0980, 0x0900, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0040, 0x0040, 0x0040,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000,
+static constexpr uint16_t kCircularIcon_terminal_Palette[28] = {
+  0x0000, 0x0060, 0x0900, 0x0980, 0x11E0, 0x1220, 0x1240, 0x0040, 0x1260, 0x1280, 0x1AA1, 0x0020, 0x1200, 0x0080, 0x0940, 0x3324,
+  0x8D50, 0xCED8, 0x22C2, 0x74AC, 0x9DD3, 0x43A6, 0x3344, 0x22E2, 0x7D0E, 0x3B86, 0x5C2A, 0xCED9
+};
+static constexpr uint8_t kCircularIcon_terminal_Rle[710] = {
+  14, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5, 3, 6, 1, 5,
+  1, 4, 1, 3, 1, 2, 1, 1, 26, 0, 1, 7, 1, 2, 1, 4,
+  1, 8, 1, 9, 9, 10, 1, 9, 1, 8, 1, 4, 1, 2, 1, 7,
+  21, 0, 1, 11, 1, 2, 1, 12, 1, 9, 15, 10, 1, 9, 1, 12,
+  1, 2, 1, 11, 18, 0, 1, 13, 1, 4, 1, 9, 19, 10, 1, 9,
+  1, 4, 1, 13, 16, 0, 1, 2, 1, 6, 23, 10, 1, 6, 1, 2,
+  14, 0, 1, 14, 1, 8, 25, 10, 1, 8, 1, 14, 12, 0, 1, 14,
+  1, 9, 27, 10, 1, 9, 1, 14, 10, 0, 1, 2, 1, 8, 29, 10,
+  1, 8, 1, 2, 8, 0, 1, 13, 1, 6, 31, 10, 1, 6, 1, 13,
+  6, 0, 1, 11, 1, 4, 33, 10, 1, 4, 1, 11, 5, 0, 1, 2,
+  1, 9, 33, 10, 1, 9, 1, 2, 4, 0, 1, 7, 1, 12, 35, 10,
+  1, 12, 1, 7, 3, 0, 1, 2, 1, 9, 35, 10, 1, 9, 1, 2,
+  3, 0, 1, 4, 16, 10, 1, 15, 1, 16, 1, 17, 1, 16, 1, 15,
+  16, 10, 1, 4, 2, 0, 1, 1, 1, 8, 15, 10, 1, 15, 1, 16,
+  1, 17, 1, 16, 1, 15, 17, 10, 1, 8, 1, 1, 1, 0, 1, 2,
+  1, 9, 14, 10, 1, 15, 1, 16, 1, 17, 1, 16, 1, 15, 18, 10,
+  1, 9, 1, 2, 1, 0, 1, 3, 14, 10, 1, 15, 1, 16, 1, 17,
+  1, 16, 1, 15, 20, 10, 1, 3, 1, 0, 1, 4, 13, 10, 1, 15,
+  1, 16, 1, 17, 1, 16, 1, 15, 21, 10, 1, 4, 1, 0, 1, 5,
+  12, 10, 1, 15, 1, 16, 1, 17, 1, 16, 1, 15, 22, 10, 1, 5,
+  1, 11, 1, 6, 11, 10, 1, 18, 1, 19, 1, 17, 1, 20, 1, 21,
+  23, 10, 1, 6, 1, 7, 1, 6, 12, 10, 1, 15, 1, 16, 1, 17,
+  1, 16, 1, 15, 22, 10, 1, 6, 1, 7, 1, 6, 13, 10, 1, 15,
+  1, 16, 1, 17, 1, 16, 1, 15, 21, 10, 1, 6, 1, 7, 1, 5,
+  14, 10, 1, 15, 1, 16, 1, 17, 1, 16, 1, 15, 20, 10, 1, 5,
+  1, 11, 1, 4, 15, 10, 1, 15, 1, 16, 1, 17, 1, 16, 1, 15,
+  19, 10, 1, 4, 1, 0, 1, 3, 16, 10, 1, 15, 1, 16, 1, 17,
+  1, 16, 1, 22, 8, 23, 10, 10, 1, 3, 1, 0, 1, 2, 1, 9,
+  16, 10, 1, 15, 1, 16, 1, 17, 1, 16, 8, 24, 1, 25, 8, 10,
+  1, 9, 1, 2, 1, 0, 1, 1, 1, 8, 19, 10, 1, 26, 8, 27,
+  1, 26, 8, 10, 1, 8, 1, 1, 2, 0, 1, 4, 19, 10, 1, 25,
+  8, 24, 1, 25, 8, 10, 1, 4, 3, 0, 1, 2, 1, 9, 19, 10,
+  8, 23, 8, 10, 1, 9, 1, 2, 3, 0, 1, 7, 1, 12, 35, 10,
+  1, 12, 1, 7, 4, 0, 1, 2, 1, 9, 33, 10, 1, 9, 1, 2,
+  5, 0, 1, 11, 1, 4, 33, 10, 1, 4, 1, 11, 6, 0, 1, 13,
+  1, 6, 31, 10, 1, 6, 1, 13, 8, 0, 1, 2, 1, 8, 29, 10,
+  1, 8, 1, 2, 10, 0, 1, 14, 1, 9, 27, 10, 1, 9, 1, 14,
+  12, 0, 1, 14, 1, 8, 25, 10, 1, 8, 1, 14, 14, 0, 1, 2,
+  1, 6, 23, 10, 1, 6, 1, 2, 16, 0, 1, 13, 1, 4, 1, 9,
+  19, 10, 1, 9, 1, 4, 1, 13, 18, 0, 1, 11, 1, 2, 1, 12,
+  1, 9, 15, 10, 1, 9, 1, 12, 1, 2, 1, 11, 21, 0, 1, 7,
+  1, 2, 1, 4, 1, 8, 1, 9, 9, 10, 1, 9, 1, 8, 1, 4,
+  1, 2, 1, 7, 26, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5,
+  3, 6, 1, 5, 1, 4, 1, 3, 1, 2, 1, 1, 33, 0, 1, 11,
+  3, 7, 1, 11, 19, 0
 };
+static constexpr CompressedIcon kCircularIcon_terminal{42, 42, kCircularIcon_terminal_Palette, 28, kCircularIcon_terminal_Rle, 710};
 
 static constexpr int kCircularIcon_brightness_W = 42;
 static constexpr int kCircularIcon_brightness_H = 42;
 static constexpr uint16_t kCircularIcon_brightness_Color = 0x0000;
-static const uint16_t kCircularIcon_brightness[1764] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x28A0, 0x5941,
-  0x8A02, 0xAA82, 0xBAE3, 0xC303, 0xCB03, 0xC303, 0xBAE3, 0xAA82, 0x8A02, 0x5941, 0x28A0, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1840, 0x5941, 0xA282, 0xD323, 0xE363, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xE363, 0xD323, 0xA282, 0x5941, 0x1840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x5961, 0xBAC3,
-  0xE363, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xE363, 0xBAC3, 0x5961, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x30C0, 0xA282, 0xE363, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xE363, 0xA282, 0x30C0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5941,
-  0xCB03, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xCB03, 0x5941, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x69A1, 0xDB43, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xDB43, 0x69A1, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x69A1, 0xDB43, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xDB43, 0x69A1,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5941, 0xDB43, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEC07, 0xED0D, 0xEC07, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xDB43, 0x5941, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x30C0, 0xCB03, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEC8A, 0xF6B7, 0xEC8A, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xCB03, 0x30C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xA282, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEC8A, 0xF697, 0xEC8A,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xA282,
-  0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5961, 0xE363, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBC5,
-  0xEBC6, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEC69, 0xF696, 0xEC69, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEBC6, 0xEBC5, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xE363, 0x5961, 0x0000, 0x0000, 0x0000, 0x0000, 0x1840,
-  0xBAC3, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBC5, 0xF5F2, 0xED4E, 0xEBE6, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEC48, 0xF676, 0xEC48, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBE6, 0xED4E, 0xF5F2, 0xEBC5, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xBAC3, 0x1840, 0x0000, 0x0000, 0x0000, 0x5941, 0xE363, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEBC6, 0xED4E, 0xF6B7, 0xED2E, 0xEBC5, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBC6, 0xECED, 0xEBC6, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEBC5, 0xED2E, 0xF6B7, 0xED4E, 0xEBC6, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xE363, 0x5941,
-  0x0000, 0x0000, 0x0820, 0xA282, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBE6, 0xED2E, 0xF6B7,
-  0xED0D, 0xEBA4, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBA4, 0xED0D, 0xF6B7, 0xED2E, 0xEBE6,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xA282, 0x0820, 0x0000, 0x28A0, 0xD323, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBC5, 0xED0D, 0xF634, 0xEBE6, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBE6, 0xF634, 0xED0D, 0xEBC5, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xD323, 0x28A0, 0x0000, 0x5941, 0xE363, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEBA4, 0xEBE6, 0xEB84, 0xEB84, 0xEB84, 0xEC28, 0xED0D, 0xED90, 0xED0D, 0xEC28, 0xEB84, 0xEB84, 0xEB84,
-  0xEBE6, 0xEBA4, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xE363, 0x5941, 0x0000,
-  0x8A02, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEBA5, 0xED90, 0xF73A, 0xF79C, 0xF79D, 0xF79C, 0xF73A, 0xED90, 0xEBA5, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0x8A02, 0x0000, 0xAA82, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xED90, 0xF77C, 0xF79D, 0xF79D, 0xF79D, 0xF79D,
-  0xF79D, 0xF77C, 0xED90, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xAA82, 0x0820, 0xBAE3, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEC28, 0xF73A, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF73A, 0xEC28, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xBAE3, 0x1040, 0xC303, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEC07, 0xEC8A, 0xEC8A, 0xEC69, 0xEC48, 0xEBC6, 0xEB84, 0xEB84, 0xED0D, 0xF79C, 0xF79D,
-  0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79C, 0xED0D, 0xEB84, 0xEB84, 0xEBC6, 0xEC48, 0xEC69, 0xEC8A, 0xEC8A, 0xEC07,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xC303, 0x1860, 0xCB03, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xED0D,
-  0xF6B7, 0xF697, 0xF696, 0xF676, 0xECED, 0xEB84, 0xEB84, 0xED90, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D,
-  0xF79D, 0xED90, 0xEB84, 0xEB84, 0xECED, 0xF676, 0xF696, 0xF697, 0xF6B7, 0xED0D, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xCB03, 0x1860, 0xC303, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEC07, 0xEC8A, 0xEC8A, 0xEC69, 0xEC48, 0xEBC6, 0xEB84,
-  0xEB84, 0xED0D, 0xF79C, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79C, 0xED0D, 0xEB84, 0xEB84, 0xEBC6, 0xEC48,
-  0xEC69, 0xEC8A, 0xEC8A, 0xEC07, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xC303, 0x1860, 0xBAE3, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEC28, 0xF73A, 0xF79D, 0xF79D, 0xF79D,
-  0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF73A, 0xEC28, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xBAE3, 0x1040, 0xAA82, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xED90, 0xF77C, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF77C, 0xED90, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xAA82, 0x0820,
-  0x8A02, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEBA5, 0xED90, 0xF73A, 0xF79C, 0xF79D, 0xF79C, 0xF73A, 0xED90, 0xEBA5, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0x8A02, 0x0000, 0x5941, 0xE363, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBA4, 0xEBE6, 0xEB84, 0xEB84, 0xEB84, 0xEC28, 0xED0D, 0xED90, 0xED0D,
-  0xEC28, 0xEB84, 0xEB84, 0xEB84, 0xEBE6, 0xEBA4, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xE363, 0x5941, 0x0000, 0x28A0, 0xD323, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEBC5, 0xED0D, 0xF634, 0xEBE6, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBE6, 0xF634, 0xED0D,
-  0xEBC5, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xD323, 0x28A0, 0x0000, 0x0820, 0xA282,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBE6, 0xED2E, 0xF6B7, 0xED0D, 0xEBA4, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBA4, 0xED0D, 0xF6B7, 0xED2E, 0xEBE6, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xA282, 0x0820, 0x0000, 0x0000, 0x5941, 0xE363, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEBC6, 0xED4E, 0xF6B7, 0xED2E, 0xEBC5, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBC6, 0xECED, 0xEBC6, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEBC5, 0xED2E, 0xF6B7, 0xED4E, 0xEBC6, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xE363, 0x5941,
-  0x0000, 0x0000, 0x0000, 0x1840, 0xBAC3, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBC5, 0xF5F2, 0xED4E, 0xEBE6,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEC48, 0xF676, 0xEC48, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBE6, 0xED4E, 0xF5F2,
-  0xEBC5, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xBAC3, 0x1840, 0x0000, 0x0000, 0x0000, 0x0000, 0x5961, 0xE363,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBC5, 0xEBC6, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEC69,
-  0xF696, 0xEC69, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEBC6, 0xEBC5, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xE363, 0x5961, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xA282, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEC8A, 0xF697, 0xEC8A, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xA282, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x30C0, 0xCB03, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEC8A, 0xF6B7, 0xEC8A, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xCB03, 0x30C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5941, 0xDB43,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEC07, 0xED0D, 0xEC07,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xDB43, 0x5941, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x69A1, 0xDB43, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xDB43, 0x69A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x69A1, 0xDB43, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xDB43,
-  0x69A1, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5941,
-  0xCB03, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xCB03, 0x5941, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x30C0, 0xA282, 0xE363, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xE363, 0xA282, 0x30C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x5961, 0xBAC3, 0xE363, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84,
-  0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xE363, 0xBAC3, 0x5961, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1840, 0x5941, 0xA282, 0xD323, 0xE363, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xEB84, 0xE363,
-  0xD323, 0xA282, 0x5941, 0x1840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x28A0, 0x5941,
-  0x8A02, 0xAA82, 0xBAE3, 0xC303, 0xCB03, 0xC303, 0xBAE3, 0xAA82, 0x8A02, 0x5941, 0x28A0, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1860, 0x1860, 0x1860,
-  0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000,
+static constexpr uint16_t kCircularIcon_brightness_Palette[46] = {
+  0x0000, 0x0820, 0x28A0, 0x5941, 0x8A02, 0xAA82, 0xBAE3, 0xC303, 0xCB03, 0x1840, 0xA282, 0xD323, 0xE363, 0xEB84, 0x1040, 0x5961,
+  0xBAC3, 0x30C0, 0x69A1, 0xDB43, 0xEC07, 0xED0D, 0xEC8A, 0xF6B7, 0xF697, 0xEBC5, 0xEBC6, 0xEC69, 0xF696, 0xF5F2, 0xED4E, 0xEBE6,
+  0xEC48, 0xF676, 0xED2E, 0xECED, 0xEBA4, 0xF634, 0xEC28, 0xED90, 0xEBA5, 0xF73A, 0xF79C, 0xF79D, 0xF77C, 0x1860
+};
+static constexpr uint8_t kCircularIcon_brightness_Rle[1106] = {
+  13, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5, 1, 6, 1, 7,
+  1, 8, 1, 7, 1, 6, 1, 5, 1, 4, 1, 3, 1, 2, 1, 1,
+  25, 0, 1, 9, 1, 3, 1, 10, 1, 11, 1, 12, 9, 13, 1, 12,
+  1, 11, 1, 10, 1, 3, 1, 9, 21, 0, 1, 14, 1, 15, 1, 16,
+  1, 12, 15, 13, 1, 12, 1, 16, 1, 15, 1, 14, 18, 0, 1, 17,
+  1, 10, 1, 12, 19, 13, 1, 12, 1, 10, 1, 17, 16, 0, 1, 3,
+  1, 8, 23, 13, 1, 8, 1, 3, 13, 0, 1, 1, 1, 18, 1, 19,
+  25, 13, 1, 19, 1, 18, 1, 1, 11, 0, 1, 18, 1, 19, 27, 13,
+  1, 19, 1, 18, 10, 0, 1, 3, 1, 19, 13, 13, 1, 20, 1, 21,
+  1, 20, 13, 13, 1, 19, 1, 3, 8, 0, 1, 17, 1, 8, 14, 13,
+  1, 22, 1, 23, 1, 22, 14, 13, 1, 8, 1, 17, 6, 0, 1, 14,
+  1, 10, 15, 13, 1, 22, 1, 24, 1, 22, 15, 13, 1, 10, 1, 14,
+  5, 0, 1, 15, 1, 12, 7, 13, 1, 25, 1, 26, 6, 13, 1, 27,
+  1, 28, 1, 27, 6, 13, 1, 26, 1, 25, 7, 13, 1, 12, 1, 15,
+  4, 0, 1, 9, 1, 16, 7, 13, 1, 25, 1, 29, 1, 30, 1, 31,
+  5, 13, 1, 32, 1, 33, 1, 32, 5, 13, 1, 31, 1, 30, 1, 29,
+  1, 25, 7, 13, 1, 16, 1, 9, 3, 0, 1, 3, 1, 12, 7, 13,
+  1, 26, 1, 30, 1, 23, 1, 34, 1, 25, 4, 13, 1, 26, 1, 35,
+  1, 26, 4, 13, 1, 25, 1, 34, 1, 23, 1, 30, 1, 26, 7, 13,
+  1, 12, 1, 3, 2, 0, 1, 1, 1, 10, 9, 13, 1, 31, 1, 34,
+  1, 23, 1, 21, 1, 36, 9, 13, 1, 36, 1, 21, 1, 23, 1, 34,
+  1, 31, 9, 13, 1, 10, 1, 1, 1, 0, 1, 2, 1, 11, 10, 13,
+  1, 25, 1, 21, 1, 37, 1, 31, 9, 13, 1, 31, 1, 37, 1, 21,
+  1, 25, 10, 13, 1, 11, 1, 2, 1, 0, 1, 3, 1, 12, 11, 13,
+  1, 36, 1, 31, 3, 13, 1, 38, 1, 21, 1, 39, 1, 21, 1, 38,
+  3, 13, 1, 31, 1, 36, 11, 13, 1, 12, 1, 3, 1, 0, 1, 4,
+  15, 13, 1, 40, 1, 39, 1, 41, 1, 42, 1, 43, 1, 42, 1, 41,
+  1, 39, 1, 40, 15, 13, 1, 4, 1, 0, 1, 5, 15, 13, 1, 39,
+  1, 44, 5, 43, 1, 44, 1, 39, 15, 13, 1, 5, 1, 1, 1, 6,
+  14, 13, 1, 38, 1, 41, 7, 43, 1, 41, 1, 38, 14, 13, 1, 6,
+  1, 14, 1, 7, 6, 13, 1, 20, 2, 22, 1, 27, 1, 32, 1, 26,
+  2, 13, 1, 21, 1, 42, 7, 43, 1, 42, 1, 21, 2, 13, 1, 26,
+  1, 32, 1, 27, 2, 22, 1, 20, 6, 13, 1, 7, 1, 45, 1, 8,
+  6, 13, 1, 21, 1, 23, 1, 24, 1, 28, 1, 33, 1, 35, 2, 13,
+  1, 39, 9, 43, 1, 39, 2, 13, 1, 35, 1, 33, 1, 28, 1, 24,
+  1, 23, 1, 21, 6, 13, 1, 8, 1, 45, 1, 7, 6, 13, 1, 20,
+  2, 22, 1, 27, 1, 32, 1, 26, 2, 13, 1, 21, 1, 42, 7, 43,
+  1, 42, 1, 21, 2, 13, 1, 26, 1, 32, 1, 27, 2, 22, 1, 20,
+  6, 13, 1, 7, 1, 45, 1, 6, 14, 13, 1, 38, 1, 41, 7, 43,
+  1, 41, 1, 38, 14, 13, 1, 6, 1, 14, 1, 5, 15, 13, 1, 39,
+  1, 44, 5, 43, 1, 44, 1, 39, 15, 13, 1, 5, 1, 1, 1, 4,
+  15, 13, 1, 40, 1, 39, 1, 41, 1, 42, 1, 43, 1, 42, 1, 41,
+  1, 39, 1, 40, 15, 13, 1, 4, 1, 0, 1, 3, 1, 12, 11, 13,
+  1, 36, 1, 31, 3, 13, 1, 38, 1, 21, 1, 39, 1, 21, 1, 38,
+  3, 13, 1, 31, 1, 36, 11, 13, 1, 12, 1, 3, 1, 0, 1, 2,
+  1, 11, 10, 13, 1, 25, 1, 21, 1, 37, 1, 31, 9, 13, 1, 31,
+  1, 37, 1, 21, 1, 25, 10, 13, 1, 11, 1, 2, 1, 0, 1, 1,
+  1, 10, 9, 13, 1, 31, 1, 34, 1, 23, 1, 21, 1, 36, 9, 13,
+  1, 36, 1, 21, 1, 23, 1, 34, 1, 31, 9, 13, 1, 10, 1, 1,
+  2, 0, 1, 3, 1, 12, 7, 13, 1, 26, 1, 30, 1, 23, 1, 34,
+  1, 25, 4, 13, 1, 26, 1, 35, 1, 26, 4, 13, 1, 25, 1, 34,
+  1, 23, 1, 30, 1, 26, 7, 13, 1, 12, 1, 3, 3, 0, 1, 9,
+  1, 16, 7, 13, 1, 25, 1, 29, 1, 30, 1, 31, 5, 13, 1, 32,
+  1, 33, 1, 32, 5, 13, 1, 31, 1, 30, 1, 29, 1, 25, 7, 13,
+  1, 16, 1, 9, 4, 0, 1, 15, 1, 12, 7, 13, 1, 25, 1, 26,
+  6, 13, 1, 27, 1, 28, 1, 27, 6, 13, 1, 26, 1, 25, 7, 13,
+  1, 12, 1, 15, 5, 0, 1, 14, 1, 10, 15, 13, 1, 22, 1, 24,
+  1, 22, 15, 13, 1, 10, 1, 14, 6, 0, 1, 17, 1, 8, 14, 13,
+  1, 22, 1, 23, 1, 22, 14, 13, 1, 8, 1, 17, 8, 0, 1, 3,
+  1, 19, 13, 13, 1, 20, 1, 21, 1, 20, 13, 13, 1, 19, 1, 3,
+  10, 0, 1, 18, 1, 19, 27, 13, 1, 19, 1, 18, 11, 0, 1, 1,
+  1, 18, 1, 19, 25, 13, 1, 19, 1, 18, 1, 1, 13, 0, 1, 3,
+  1, 8, 23, 13, 1, 8, 1, 3, 16, 0, 1, 17, 1, 10, 1, 12,
+  19, 13, 1, 12, 1, 10, 1, 17, 18, 0, 1, 14, 1, 15, 1, 16,
+  1, 12, 15, 13, 1, 12, 1, 16, 1, 15, 1, 14, 21, 0, 1, 9,
+  1, 3, 1, 10, 1, 11, 1, 12, 9, 13, 1, 12, 1, 11, 1, 10,
+  1, 3, 1, 9, 25, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5,
+  1, 6, 1, 7, 1, 8, 1, 7, 1, 6, 1, 5, 1, 4, 1, 3,
+  1, 2, 1, 1, 31, 0, 1, 1, 1, 14, 3, 45, 1, 14, 1, 1,
+  18, 0
 };
+static constexpr CompressedIcon kCircularIcon_brightness{42, 42, kCircularIcon_brightness_Palette, 46, kCircularIcon_brightness_Rle, 1106};
 
 static constexpr int kCircularIcon_wifi_W = 42;
 static constexpr int kCircularIcon_wifi_H = 42;
 static constexpr uint16_t kCircularIcon_wifi_Color = 0x0000;
-static const uint16_t kCircularIcon_wifi[1764] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x00C0, 0x01C0,
-  0x02C1, 0x0361, 0x03C1, 0x03E1, 0x0401, 0x03E1, 0x03C1, 0x0361, 0x02C1, 0x01C0, 0x00C0, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x01C0, 0x0341, 0x0421, 0x0481, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x0481, 0x0421, 0x0341, 0x01C0, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x01E0, 0x03A1,
-  0x0481, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x0481, 0x03A1, 0x01E0, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0341, 0x0481, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0481, 0x0341, 0x0100, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x01C0,
-  0x0401, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0401, 0x01C0, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0220, 0x0441, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x0441, 0x0220, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0220, 0x0461, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0461, 0x0220,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C0, 0x0441, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0441, 0x01C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0100, 0x0401, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x14C4, 0x1D05, 0x2D26, 0x2D27, 0x2D26, 0x1D05, 0x14C4, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0401, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0341, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x1D05, 0x4DAB, 0x8651, 0xA6D5, 0xB6F6, 0xB6F7, 0xB6F7, 0xB6F7,
-  0xB6F6, 0xA6D5, 0x8651, 0x4DAB, 0x1D05, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0341,
-  0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01E0, 0x0481, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x2526, 0x760F, 0xAEF6, 0xB6F6, 0x8E72, 0x65ED, 0x4589, 0x3548, 0x2D47, 0x3548, 0x4589, 0x65ED, 0x8E72, 0xB6F6, 0xAEF6, 0x760F,
-  0x2526, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0481, 0x01E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060,
-  0x03A1, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0CC3, 0x5DCC, 0xAEF6, 0xA6D5, 0x5DCC, 0x2506, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x2506, 0x5DCC, 0xA6D5, 0xAEF6, 0x5DCC, 0x0CC3, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x03A1, 0x0060, 0x0000, 0x0000, 0x0000, 0x01C0, 0x0481, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x1CE5, 0x8651, 0xB717, 0x6DEE, 0x1CE5, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x1CE5, 0x6DEE, 0xB717, 0x8651, 0x1CE5, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0481, 0x01C0,
-  0x0000, 0x0000, 0x0020, 0x0341, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x1D05, 0x9693, 0xAED5, 0x3D69, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x1CE4, 0x3D69, 0x65ED, 0x7E50, 0x8651, 0x7E50, 0x65ED, 0x3D69, 0x1CE4, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x3D69,
-  0xAED5, 0x9693, 0x1D05, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0341, 0x0020, 0x0000, 0x00C0, 0x0421, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x14E4, 0x8E72, 0xA6D5, 0x2D27, 0x04A2, 0x04A2, 0x04A2, 0x2505, 0x6E0E, 0xAED6, 0xB717, 0xA6D5, 0x8E92,
-  0x8671, 0x8E92, 0xA6D5, 0xB717, 0xAED6, 0x6E0E, 0x2505, 0x04A2, 0x04A2, 0x04A2, 0x2D27, 0xA6D5, 0x8E72, 0x14E4, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x0421, 0x00C0, 0x0000, 0x01C0, 0x0481, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x760F, 0xB6F6, 0x3548,
-  0x04A2, 0x04A2, 0x04A2, 0x4DAB, 0xAED6, 0xAED5, 0x65ED, 0x2D26, 0x14C3, 0x04A2, 0x04A2, 0x04A2, 0x14C3, 0x2D26, 0x65ED, 0xAED5,
-  0xAED6, 0x4DAB, 0x04A2, 0x04A2, 0x04A2, 0x3548, 0xB6F6, 0x760F, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0481, 0x01C0, 0x0000,
-  0x02C1, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x3547, 0xAED5, 0x4DAB, 0x04A2, 0x04A2, 0x0CA3, 0x65ED, 0xBF17, 0x762F, 0x1D05,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x1D05, 0x762F, 0xBF17, 0x65ED, 0x0CA3, 0x04A2, 0x04A2,
-  0x4DAB, 0xAED5, 0x3547, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x02C1, 0x0000, 0x0361, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x4D8A, 0x5DCC, 0x0CA3, 0x04A2, 0x04A2, 0x5DCC, 0xBF17, 0x5DCC, 0x0CA2, 0x04A2, 0x04A2, 0x04A2, 0x14C4, 0x2506, 0x2D27, 0x2506,
-  0x14C4, 0x04A2, 0x04A2, 0x04A2, 0x0CA2, 0x5DCC, 0xBF17, 0x5DCC, 0x04A2, 0x04A2, 0x0CA3, 0x5DCC, 0x4D8A, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x0361, 0x0020, 0x03C1, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x2526, 0x14C4, 0x04A2, 0x04A2, 0x3548, 0xB6F7,
-  0x65ED, 0x04A2, 0x04A2, 0x04A2, 0x1D05, 0x65EE, 0xA6D5, 0xB6F7, 0xB6F7, 0xB6F7, 0xA6D5, 0x65EE, 0x1D05, 0x04A2, 0x04A2, 0x04A2,
-  0x65ED, 0xB6F7, 0x3548, 0x04A2, 0x04A2, 0x14C4, 0x2526, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x03C1, 0x0040, 0x03E1, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x55AB, 0x6E0E, 0x0CC3, 0x04A2, 0x04A2, 0x3D48, 0xA6D5, 0xAEF6,
-  0x6E0E, 0x3D69, 0x3547, 0x3D69, 0x6E0E, 0xAEF6, 0xA6D5, 0x3D48, 0x04A2, 0x04A2, 0x0CC3, 0x6E0E, 0x55AB, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x03E1, 0x0080, 0x0401, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x1D05, 0x14E4, 0x04A2, 0x04A2, 0x2D27, 0xAED6, 0x8E72, 0x2506, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x2506,
-  0x8E72, 0xAED6, 0x2D27, 0x04A2, 0x04A2, 0x14E4, 0x1D05, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x0401, 0x0080, 0x03E1, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x5DCD, 0x8E72, 0x1CE4, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x1CE4, 0x8E72, 0x5DCD, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x03E1, 0x0080, 0x03C1, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x14C4, 0x14E4, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x0CA3, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x14E4, 0x14C4, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x03C1, 0x0040, 0x0361, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x2506, 0x8671, 0xAED5, 0x8671, 0x2506, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0361, 0x0020,
-  0x02C1, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x14E4, 0xAED5, 0xE79C, 0xE79C, 0xE79C, 0xAED5, 0x14E4, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x02C1, 0x0000, 0x01C0, 0x0481, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x3D69, 0xDF9B, 0xE79C, 0xE79C, 0xE79C,
-  0xDF9B, 0x3D69, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x0481, 0x01C0, 0x0000, 0x00C0, 0x0421, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x3D69, 0xDF9B, 0xE79C, 0xE79C, 0xE79C, 0xDF9B, 0x3D69, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0421, 0x00C0, 0x0000, 0x0020, 0x0341,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x14E4,
-  0xAED5, 0xE79C, 0xE79C, 0xE79C, 0xAED5, 0x14E4, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0341, 0x0020, 0x0000, 0x0000, 0x01C0, 0x0481, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x2506, 0x8671, 0xAED5, 0x8671, 0x2506, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0481, 0x01C0,
-  0x0000, 0x0000, 0x0000, 0x0060, 0x03A1, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0CA3, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x03A1, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x01E0, 0x0481,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x0481, 0x01E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0341, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0341, 0x0040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0100, 0x0401, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0401, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C0, 0x0441,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0441, 0x01C0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0220, 0x0461, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0461, 0x0220, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0220, 0x0441, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0441,
-  0x0220, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x01C0,
-  0x0401, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0401, 0x01C0, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0341, 0x0481, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x0481, 0x0341, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x01E0, 0x03A1, 0x0481, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2,
-  0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0481, 0x03A1, 0x01E0, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0060, 0x01C0, 0x0341, 0x0421, 0x0481, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x0481,
-  0x0421, 0x0341, 0x01C0, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x00C0, 0x01C0,
-  0x02C1, 0x0361, 0x03C1, 0x03E1, 0x0401, 0x03E1, 0x03C1, 0x0361, 0x02C1, 0x01C0, 0x00C0, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0040, 0x0080, 0x0080, 0x0080,
-  0x0040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000,
+static constexpr uint16_t kCircularIcon_wifi_Palette[69] = {
+  0x0000, 0x0020, 0x00C0, 0x01C0, 0x02C1, 0x0361, 0x03C1, 0x03E1, 0x0401, 0x0060, 0x0341, 0x0421, 0x0481, 0x04A2, 0x0040, 0x01E0,
+  0x03A1, 0x0100, 0x0220, 0x0441, 0x0461, 0x14C4, 0x1D05, 0x2D26, 0x2D27, 0x4DAB, 0x8651, 0xA6D5, 0xB6F6, 0xB6F7, 0x2526, 0x760F,
+  0xAEF6, 0x8E72, 0x65ED, 0x4589, 0x3548, 0x2D47, 0x0CC3, 0x5DCC, 0x2506, 0x1CE5, 0xB717, 0x6DEE, 0x9693, 0xAED5, 0x3D69, 0x1CE4,
+  0x7E50, 0x14E4, 0x2505, 0x6E0E, 0xAED6, 0x8E92, 0x8671, 0x14C3, 0x3547, 0x0CA3, 0xBF17, 0x762F, 0x4D8A, 0x0CA2, 0x65EE, 0x55AB,
+  0x3D48, 0x0080, 0x5DCD, 0xE79C, 0xDF9B
 };
+static constexpr uint8_t kCircularIcon_wifi_Rle[1154] = {
+  13, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5, 1, 6, 1, 7,
+  1, 8, 1, 7, 1, 6, 1, 5, 1, 4, 1, 3, 1, 2, 1, 1,
+  25, 0, 1, 9, 1, 3, 1, 10, 1, 11, 1, 12, 9, 13, 1, 12,
+  1, 11, 1, 10, 1, 3, 1, 9, 21, 0, 1, 14, 1, 15, 1, 16,
+  1, 12, 15, 13, 1, 12, 1, 16, 1, 15, 1, 14, 18, 0, 1, 17,
+  1, 10, 1, 12, 19, 13, 1, 12, 1, 10, 1, 17, 15, 0, 1, 1,
+  1, 3, 1, 8, 23, 13, 1, 8, 1, 3, 1, 1, 12, 0, 1, 1,
+  1, 18, 1, 19, 25, 13, 1, 19, 1, 18, 1, 1, 10, 0, 1, 1,
+  1, 18, 1, 20, 27, 13, 1, 20, 1, 18, 1, 1, 9, 0, 1, 3,
+  1, 19, 29, 13, 1, 19, 1, 3, 8, 0, 1, 17, 1, 8, 12, 13,
+  1, 21, 1, 22, 1, 23, 1, 24, 1, 23, 1, 22, 1, 21, 12, 13,
+  1, 8, 1, 17, 6, 0, 1, 14, 1, 10, 10, 13, 1, 22, 1, 25,
+  1, 26, 1, 27, 1, 28, 3, 29, 1, 28, 1, 27, 1, 26, 1, 25,
+  1, 22, 10, 13, 1, 10, 1, 14, 5, 0, 1, 15, 1, 12, 8, 13,
+  1, 30, 1, 31, 1, 32, 1, 28, 1, 33, 1, 34, 1, 35, 1, 36,
+  1, 37, 1, 36, 1, 35, 1, 34, 1, 33, 1, 28, 1, 32, 1, 31,
+  1, 30, 8, 13, 1, 12, 1, 15, 4, 0, 1, 9, 1, 16, 7, 13,
+  1, 38, 1, 39, 1, 32, 1, 27, 1, 39, 1, 40, 9, 13, 1, 40,
+  1, 39, 1, 27, 1, 32, 1, 39, 1, 38, 7, 13, 1, 16, 1, 9,
+  3, 0, 1, 3, 1, 12, 6, 13, 1, 41, 1, 26, 1, 42, 1, 43,
+  1, 41, 13, 13, 1, 41, 1, 43, 1, 42, 1, 26, 1, 41, 6, 13,
+  1, 12, 1, 3, 2, 0, 1, 1, 1, 10, 6, 13, 1, 22, 1, 44,
+  1, 45, 1, 46, 4, 13, 1, 47, 1, 46, 1, 34, 1, 48, 1, 26,
+  1, 48, 1, 34, 1, 46, 1, 47, 4, 13, 1, 46, 1, 45, 1, 44,
+  1, 22, 6, 13, 1, 10, 1, 1, 1, 0, 1, 2, 1, 11, 5, 13,
+  1, 49, 1, 33, 1, 27, 1, 24, 3, 13, 1, 50, 1, 51, 1, 52,
+  1, 42, 1, 27, 1, 53, 1, 54, 1, 53, 1, 27, 1, 42, 1, 52,
+  1, 51, 1, 50, 3, 13, 1, 24, 1, 27, 1, 33, 1, 49, 5, 13,
+  1, 11, 1, 2, 1, 0, 1, 3, 1, 12, 5, 13, 1, 31, 1, 28,
+  1, 36, 3, 13, 1, 25, 1, 52, 1, 45, 1, 34, 1, 23, 1, 55,
+  3, 13, 1, 55, 1, 23, 1, 34, 1, 45, 1, 52, 1, 25, 3, 13,
+  1, 36, 1, 28, 1, 31, 5, 13, 1, 12, 1, 3, 1, 0, 1, 4,
+  5, 13, 1, 56, 1, 45, 1, 25, 2, 13, 1, 57, 1, 34, 1, 58,
+  1, 59, 1, 22, 9, 13, 1, 22, 1, 59, 1, 58, 1, 34, 1, 57,
+  2, 13, 1, 25, 1, 45, 1, 56, 5, 13, 1, 4, 1, 0, 1, 5,
+  5, 13, 1, 60, 1, 39, 1, 57, 2, 13, 1, 39, 1, 58, 1, 39,
+  1, 61, 3, 13, 1, 21, 1, 40, 1, 24, 1, 40, 1, 21, 3, 13,
+  1, 61, 1, 39, 1, 58, 1, 39, 2, 13, 1, 57, 1, 39, 1, 60,
+  5, 13, 1, 5, 1, 1, 1, 6, 5, 13, 1, 30, 1, 21, 2, 13,
+  1, 36, 1, 29, 1, 34, 3, 13, 1, 22, 1, 62, 1, 27, 3, 29,
+  1, 27, 1, 62, 1, 22, 3, 13, 1, 34, 1, 29, 1, 36, 2, 13,
+  1, 21, 1, 30, 5, 13, 1, 6, 1, 14, 1, 7, 9, 13, 1, 63,
+  1, 51, 1, 38, 2, 13, 1, 64, 1, 27, 1, 32, 1, 51, 1, 46,
+  1, 56, 1, 46, 1, 51, 1, 32, 1, 27, 1, 64, 2, 13, 1, 38,
+  1, 51, 1, 63, 9, 13, 1, 7, 1, 65, 1, 8, 9, 13, 1, 22,
+  1, 49, 2, 13, 1, 24, 1, 52, 1, 33, 1, 40, 5, 13, 1, 40,
+  1, 33, 1, 52, 1, 24, 2, 13, 1, 49, 1, 22, 9, 13, 1, 8,
+  1, 65, 1, 7, 13, 13, 1, 66, 1, 33, 1, 47, 7, 13, 1, 47,
+  1, 33, 1, 66, 13, 13, 1, 7, 1, 65, 1, 6, 13, 13, 1, 21,
+  1, 49, 4, 13, 1, 57, 4, 13, 1, 49, 1, 21, 13, 13, 1, 6,
+  1, 14, 1, 5, 17, 13, 1, 40, 1, 54, 1, 45, 1, 54, 1, 40,
+  17, 13, 1, 5, 1, 1, 1, 4, 16, 13, 1, 49, 1, 45, 3, 67,
+  1, 45, 1, 49, 16, 13, 1, 4, 1, 0, 1, 3, 1, 12, 15, 13,
+  1, 46, 1, 68, 3, 67, 1, 68, 1, 46, 15, 13, 1, 12, 1, 3,
+  1, 0, 1, 2, 1, 11, 15, 13, 1, 46, 1, 68, 3, 67, 1, 68,
+  1, 46, 15, 13, 1, 11, 1, 2, 1, 0, 1, 1, 1, 10, 15, 13,
+  1, 49, 1, 45, 3, 67, 1, 45, 1, 49, 15, 13, 1, 10, 1, 1,
+  2, 0, 1, 3, 1, 12, 15, 13, 1, 40, 1, 54, 1, 45, 1, 54,
+  1, 40, 15, 13, 1, 12, 1, 3, 3, 0, 1, 9, 1, 16, 17, 13,
+  1, 57, 17, 13, 1, 16, 1, 9, 4, 0, 1, 15, 1, 12, 33, 13,
+  1, 12, 1, 15, 5, 0, 1, 14, 1, 10, 33, 13, 1, 10, 1, 14,
+  6, 0, 1, 17, 1, 8, 31, 13, 1, 8, 1, 17, 8, 0, 1, 3,
+  1, 19, 29, 13, 1, 19, 1, 3, 9, 0, 1, 1, 1, 18, 1, 20,
+  27, 13, 1, 20, 1, 18, 1, 1, 10, 0, 1, 1, 1, 18, 1, 19,
+  25, 13, 1, 19, 1, 18, 1, 1, 12, 0, 1, 1, 1, 3, 1, 8,
+  23, 13, 1, 8, 1, 3, 1, 1, 15, 0, 1, 17, 1, 10, 1, 12,
+  19, 13, 1, 12, 1, 10, 1, 17, 18, 0, 1, 14, 1, 15, 1, 16,
+  1, 12, 15, 13, 1, 12, 1, 16, 1, 15, 1, 14, 21, 0, 1, 9,
+  1, 3, 1, 10, 1, 11, 1, 12, 9, 13, 1, 12, 1, 11, 1, 10,
+  1, 3, 1, 9, 25, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5,
+  1, 6, 1, 7, 1, 8, 1, 7, 1, 6, 1, 5, 1, 4, 1, 3,
+  1, 2, 1, 1, 31, 0, 1, 1, 1, 14, 3, 65, 1, 14, 1, 1,
+  18, 0
+};
+static constexpr CompressedIcon kCircularIcon_wifi{42, 42, kCircularIcon_wifi_Palette, 69, kCircularIcon_wifi_Rle, 1154};
 
 static constexpr int kCircularIcon_more_W = 42;
 static constexpr int kCircularIcon_more_H = 42;
 static constexpr uint16_t kCircularIcon_more_Color = 0x0000;
-static const uint16_t kCircularIcon_more[1764] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x1105, 0x220A,
-  0x3330, 0x43F3, 0x4C76, 0x4CB7, 0x4CB7, 0x4CB7, 0x4C76, 0x43F3, 0x3330, 0x220A, 0x1105, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0882, 0x220A, 0x3BF3, 0x54F8, 0x555A, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x555A, 0x54F8, 0x3BF3, 0x220A, 0x0882, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0061, 0x222B, 0x4455,
-  0x555A, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x555A, 0x4455, 0x222B, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1146, 0x3BD3, 0x555A, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x555A, 0x3BD3, 0x1146, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x220A,
-  0x4CB7, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x4CB7, 0x220A, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x2A8D, 0x5519, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5519, 0x2A8D, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x2A8D, 0x5539, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5539, 0x2A8D,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x220A, 0x5519, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5519, 0x220A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1146, 0x4CB7, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x4CB7, 0x1146, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0061, 0x3BD3, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x3BD3,
-  0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x222B, 0x555A, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x555A, 0x222B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0882,
-  0x4455, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x4455, 0x0882, 0x0000, 0x0000, 0x0000, 0x220A, 0x555A, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x555A, 0x220A,
-  0x0000, 0x0000, 0x0021, 0x3BF3, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x3BF3, 0x0021, 0x0000, 0x1105, 0x54F8, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x54F8, 0x1105, 0x0000, 0x220A, 0x555A, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x555A, 0x220A, 0x0000,
-  0x3330, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x3330, 0x0000, 0x43F3, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x75DB, 0xA69C, 0xBEFD, 0xA69C, 0x75DB, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x75DB, 0xA69C, 0xBEFD, 0xA69C,
-  0x75DB, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x75DB, 0xA69C, 0xBEFD, 0xA69C, 0x75DB, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x43F3, 0x0021, 0x4C76, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x75DB, 0xCF3D, 0xEFBE, 0xEFBE, 0xEFBE,
-  0xCF3D, 0x75DB, 0x5D7B, 0x5D7B, 0x5D7B, 0x75DB, 0xCF3D, 0xEFBE, 0xEFBE, 0xEFBE, 0xCF3D, 0x75DB, 0x5D7B, 0x5D7B, 0x5D7B, 0x75DB,
-  0xCF3D, 0xEFBE, 0xEFBE, 0xEFBE, 0xCF3D, 0x75DB, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x4C76, 0x0062, 0x4CB7, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0xA69C, 0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xA69C, 0x5D7B, 0x5D7B, 0x5D7B, 0xA69C,
-  0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xA69C, 0x5D7B, 0x5D7B, 0x5D7B, 0xA69C, 0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xA69C,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x4CB7, 0x0883, 0x4CB7, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0xBEFD,
-  0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xBEFD, 0x5D7B, 0x5D7B, 0x5D7B, 0xBEFD, 0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xBEFD,
-  0x5D7B, 0x5D7B, 0x5D7B, 0xBEFD, 0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xBEFD, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x4CB7, 0x08A3, 0x4CB7, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0xA69C, 0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xA69C,
-  0x5D7B, 0x5D7B, 0x5D7B, 0xA69C, 0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xA69C, 0x5D7B, 0x5D7B, 0x5D7B, 0xA69C, 0xEFBE, 0xEFBE,
-  0xEFBE, 0xEFBE, 0xEFBE, 0xA69C, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x4CB7, 0x0883, 0x4C76, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x75DB, 0xCF3D, 0xEFBE, 0xEFBE, 0xEFBE, 0xCF3D, 0x75DB, 0x5D7B, 0x5D7B, 0x5D7B, 0x75DB, 0xCF3D, 0xEFBE,
-  0xEFBE, 0xEFBE, 0xCF3D, 0x75DB, 0x5D7B, 0x5D7B, 0x5D7B, 0x75DB, 0xCF3D, 0xEFBE, 0xEFBE, 0xEFBE, 0xCF3D, 0x75DB, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x4C76, 0x0062, 0x43F3, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x75DB, 0xA69C,
-  0xBEFD, 0xA69C, 0x75DB, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x75DB, 0xA69C, 0xBEFD, 0xA69C, 0x75DB, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x75DB, 0xA69C, 0xBEFD, 0xA69C, 0x75DB, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x43F3, 0x0021,
-  0x3330, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x3330, 0x0000, 0x220A, 0x555A, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x555A, 0x220A, 0x0000, 0x1105, 0x54F8, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x54F8, 0x1105, 0x0000, 0x0021, 0x3BF3,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x3BF3, 0x0021, 0x0000, 0x0000, 0x220A, 0x555A, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x555A, 0x220A,
-  0x0000, 0x0000, 0x0000, 0x0882, 0x4455, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x4455, 0x0882, 0x0000, 0x0000, 0x0000, 0x0000, 0x222B, 0x555A,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x555A, 0x222B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0061, 0x3BD3, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x3BD3, 0x0061, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1146, 0x4CB7, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x4CB7, 0x1146, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x220A, 0x5519,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5519, 0x220A, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2A8D, 0x5539, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5539, 0x2A8D, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x2A8D, 0x5519, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5519,
-  0x2A8D, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x220A,
-  0x4CB7, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x4CB7, 0x220A, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1146, 0x3BD3, 0x555A, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x555A, 0x3BD3, 0x1146, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0061, 0x222B, 0x4455, 0x555A, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B,
-  0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x555A, 0x4455, 0x222B, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0882, 0x220A, 0x3BF3, 0x54F8, 0x555A, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x5D7B, 0x555A,
-  0x54F8, 0x3BF3, 0x220A, 0x0882, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x1105, 0x220A,
-  0x3330, 0x43F3, 0x4C76, 0x4CB7, 0x4CB7, 0x4CB7, 0x4C76, 0x43F3, 0x3330, 0x220A, 0x1105, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0062, 0x0883, 0x08A3, 0x0883,
-  0x0062, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000,
+static constexpr uint16_t kCircularIcon_more_Palette[30] = {
+  0x0000, 0x0021, 0x1105, 0x220A, 0x3330, 0x43F3, 0x4C76, 0x4CB7, 0x0882, 0x3BF3, 0x54F8, 0x555A, 0x5D7B, 0x0061, 0x222B, 0x4455,
+  0x1146, 0x3BD3, 0x0020, 0x2A8D, 0x5519, 0x5539, 0x75DB, 0xA69C, 0xBEFD, 0xCF3D, 0xEFBE, 0x0062, 0x0883, 0x08A3
+};
+static constexpr uint8_t kCircularIcon_more_Rle[794] = {
+  13, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5, 1, 6, 3, 7,
+  1, 6, 1, 5, 1, 4, 1, 3, 1, 2, 1, 1, 25, 0, 1, 8,
+  1, 3, 1, 9, 1, 10, 1, 11, 9, 12, 1, 11, 1, 10, 1, 9,
+  1, 3, 1, 8, 21, 0, 1, 13, 1, 14, 1, 15, 1, 11, 15, 12,
+  1, 11, 1, 15, 1, 14, 1, 13, 18, 0, 1, 16, 1, 17, 1, 11,
+  19, 12, 1, 11, 1, 17, 1, 16, 15, 0, 1, 18, 1, 3, 1, 7,
+  23, 12, 1, 7, 1, 3, 1, 18, 12, 0, 1, 1, 1, 19, 1, 20,
+  25, 12, 1, 20, 1, 19, 1, 1, 10, 0, 1, 18, 1, 19, 1, 21,
+  27, 12, 1, 21, 1, 19, 1, 18, 9, 0, 1, 3, 1, 20, 29, 12,
+  1, 20, 1, 3, 8, 0, 1, 16, 1, 7, 31, 12, 1, 7, 1, 16,
+  6, 0, 1, 13, 1, 17, 33, 12, 1, 17, 1, 13, 5, 0, 1, 14,
+  1, 11, 33, 12, 1, 11, 1, 14, 4, 0, 1, 8, 1, 15, 35, 12,
+  1, 15, 1, 8, 3, 0, 1, 3, 1, 11, 35, 12, 1, 11, 1, 3,
+  2, 0, 1, 1, 1, 9, 37, 12, 1, 9, 1, 1, 1, 0, 1, 2,
+  1, 10, 37, 12, 1, 10, 1, 2, 1, 0, 1, 3, 1, 11, 37, 12,
+  1, 11, 1, 3, 1, 0, 1, 4, 39, 12, 1, 4, 1, 0, 1, 5,
+  7, 12, 1, 22, 1, 23, 1, 24, 1, 23, 1, 22, 5, 12, 1, 22,
+  1, 23, 1, 24, 1, 23, 1, 22, 5, 12, 1, 22, 1, 23, 1, 24,
+  1, 23, 1, 22, 7, 12, 1, 5, 1, 1, 1, 6, 6, 12, 1, 22,
+  1, 25, 3, 26, 1, 25, 1, 22, 3, 12, 1, 22, 1, 25, 3, 26,
+  1, 25, 1, 22, 3, 12, 1, 22, 1, 25, 3, 26, 1, 25, 1, 22,
+  6, 12, 1, 6, 1, 27, 1, 7, 6, 12, 1, 23, 5, 26, 1, 23,
+  3, 12, 1, 23, 5, 26, 1, 23, 3, 12, 1, 23, 5, 26, 1, 23,
+  6, 12, 1, 7, 1, 28, 1, 7, 6, 12, 1, 24, 5, 26, 1, 24,
+  3, 12, 1, 24, 5, 26, 1, 24, 3, 12, 1, 24, 5, 26, 1, 24,
+  6, 12, 1, 7, 1, 29, 1, 7, 6, 12, 1, 23, 5, 26, 1, 23,
+  3, 12, 1, 23, 5, 26, 1, 23, 3, 12, 1, 23, 5, 26, 1, 23,
+  6, 12, 1, 7, 1, 28, 1, 6, 6, 12, 1, 22, 1, 25, 3, 26,
+  1, 25, 1, 22, 3, 12, 1, 22, 1, 25, 3, 26, 1, 25, 1, 22,
+  3, 12, 1, 22, 1, 25, 3, 26, 1, 25, 1, 22, 6, 12, 1, 6,
+  1, 27, 1, 5, 7, 12, 1, 22, 1, 23, 1, 24, 1, 23, 1, 22,
+  5, 12, 1, 22, 1, 23, 1, 24, 1, 23, 1, 22, 5, 12, 1, 22,
+  1, 23, 1, 24, 1, 23, 1, 22, 7, 12, 1, 5, 1, 1, 1, 4,
+  39, 12, 1, 4, 1, 0, 1, 3, 1, 11, 37, 12, 1, 11, 1, 3,
+  1, 0, 1, 2, 1, 10, 37, 12, 1, 10, 1, 2, 1, 0, 1, 1,
+  1, 9, 37, 12, 1, 9, 1, 1, 2, 0, 1, 3, 1, 11, 35, 12,
+  1, 11, 1, 3, 3, 0, 1, 8, 1, 15, 35, 12, 1, 15, 1, 8,
+  4, 0, 1, 14, 1, 11, 33, 12, 1, 11, 1, 14, 5, 0, 1, 13,
+  1, 17, 33, 12, 1, 17, 1, 13, 6, 0, 1, 16, 1, 7, 31, 12,
+  1, 7, 1, 16, 8, 0, 1, 3, 1, 20, 29, 12, 1, 20, 1, 3,
+  9, 0, 1, 18, 1, 19, 1, 21, 27, 12, 1, 21, 1, 19, 1, 18,
+  10, 0, 1, 1, 1, 19, 1, 20, 25, 12, 1, 20, 1, 19, 1, 1,
+  12, 0, 1, 18, 1, 3, 1, 7, 23, 12, 1, 7, 1, 3, 1, 18,
+  15, 0, 1, 16, 1, 17, 1, 11, 19, 12, 1, 11, 1, 17, 1, 16,
+  18, 0, 1, 13, 1, 14, 1, 15, 1, 11, 15, 12, 1, 11, 1, 15,
+  1, 14, 1, 13, 21, 0, 1, 8, 1, 3, 1, 9, 1, 10, 1, 11,
+  9, 12, 1, 11, 1, 10, 1, 9, 1, 3, 1, 8, 25, 0, 1, 1,
+  1, 2, 1, 3, 1, 4, 1, 5, 1, 6, 3, 7, 1, 6, 1, 5,
+  1, 4, 1, 3, 1, 2, 1, 1, 31, 0, 1, 1, 1, 27, 1, 28,
+  1, 29, 1, 28, 1, 27, 1, 1, 18, 0
+};
+static constexpr CompressedIcon kCircularIcon_more{42, 42, kCircularIcon_more_Palette, 30, kCircularIcon_more_Rle, 794};
+
+static constexpr int kCircularIcon_history_W = 42;
+static constexpr int kCircularIcon_history_H = 42;
+static constexpr uint16_t kCircularIcon_history_Color = 0x0000;
+static constexpr uint16_t kCircularIcon_history_Palette[49] = {
+  0x0000, 0x0002, 0x0024, 0x0047, 0x0048, 0x0069, 0x006A, 0x0001, 0x006B, 0x008C, 0x0025, 0x112D, 0x3A50, 0x6373, 0x8455, 0x8C96,
+  0x218E, 0x7415, 0xBE1A, 0xDF1C, 0xE75D, 0x08CC, 0x5B33, 0xC65A, 0xCEBB, 0xADB9, 0x94F7, 0x8CB6, 0x08ED, 0x7C55, 0xBE3A, 0x6B94,
+  0x21AF, 0x00AC, 0x29AF, 0xE73D, 0xDF3D, 0x196E, 0x29CF, 0x73F4, 0x29EF, 0xCE9B, 0x9D37, 0x216E, 0x5B12, 0x194E, 0xCE7B, 0xB5B9,
+  0x94D7
+};
+static constexpr uint8_t kCircularIcon_history_Rle[1202] = {
+  14, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5, 3, 6, 1, 5,
+  1, 4, 1, 3, 1, 2, 1, 1, 26, 0, 1, 7, 1, 2, 1, 4,
+  1, 6, 1, 8, 9, 9, 1, 8, 1, 6, 1, 4, 1, 2, 1, 7,
+  22, 0, 1, 2, 1, 5, 1, 8, 15, 9, 1, 8, 1, 5, 1, 2,
+  19, 0, 1, 1, 1, 4, 1, 8, 19, 9, 1, 8, 1, 4, 1, 1,
+  16, 0, 1, 2, 1, 6, 23, 9, 1, 6, 1, 2, 14, 0, 1, 10,
+  1, 8, 25, 9, 1, 8, 1, 10, 12, 0, 1, 10, 1, 8, 27, 9,
+  1, 8, 1, 10, 10, 0, 1, 2, 1, 8, 29, 9, 1, 8, 1, 2,
+  8, 0, 1, 1, 1, 6, 11, 9, 1, 11, 1, 12, 1, 13, 1, 14,
+  1, 15, 1, 14, 1, 13, 1, 12, 1, 11, 11, 9, 1, 6, 1, 1,
+  7, 0, 1, 4, 10, 9, 1, 16, 1, 17, 1, 18, 1, 19, 5, 20,
+  1, 19, 1, 18, 1, 17, 1, 16, 10, 9, 1, 4, 6, 0, 1, 2,
+  1, 8, 8, 9, 1, 21, 1, 22, 1, 23, 2, 20, 1, 24, 1, 25,
+  1, 26, 1, 27, 1, 26, 1, 25, 1, 24, 2, 20, 1, 23, 1, 22,
+  1, 21, 8, 9, 1, 8, 1, 2, 4, 0, 1, 7, 1, 5, 8, 9,
+  1, 28, 1, 29, 1, 19, 1, 20, 1, 30, 1, 31, 1, 32, 1, 21,
+  1, 33, 1, 34, 1, 33, 1, 21, 1, 32, 1, 31, 1, 30, 1, 20,
+  1, 19, 1, 29, 1, 28, 8, 9, 1, 5, 1, 7, 3, 0, 1, 2,
+  1, 8, 7, 9, 1, 21, 1, 29, 1, 35, 1, 36, 1, 15, 1, 37,
+  3, 9, 1, 38, 1, 30, 1, 38, 3, 9, 1, 37, 1, 15, 1, 36,
+  1, 35, 1, 29, 1, 21, 7, 9, 1, 8, 1, 2, 3, 0, 1, 4,
+  8, 9, 1, 22, 1, 19, 1, 36, 1, 39, 1, 21, 4, 9, 1, 40,
+  1, 41, 1, 40, 4, 9, 1, 21, 1, 39, 1, 36, 1, 19, 1, 22,
+  8, 9, 1, 4, 2, 0, 1, 1, 1, 6, 7, 9, 1, 16, 1, 23,
+  1, 20, 1, 15, 1, 21, 5, 9, 1, 40, 1, 41, 1, 40, 5, 9,
+  1, 21, 1, 15, 1, 20, 1, 23, 1, 16, 7, 9, 1, 6, 1, 1,
+  1, 0, 1, 2, 1, 8, 7, 9, 1, 17, 1, 20, 1, 30, 1, 37,
+  6, 9, 1, 40, 1, 41, 1, 40, 6, 9, 1, 37, 1, 30, 1, 20,
+  1, 17, 7, 9, 1, 8, 1, 2, 1, 0, 1, 3, 7, 9, 1, 11,
+  1, 18, 1, 20, 1, 31, 3, 9, 1, 21, 3, 9, 1, 40, 1, 41,
+  1, 40, 7, 9, 1, 31, 1, 20, 1, 18, 1, 11, 7, 9, 1, 3,
+  1, 0, 1, 4, 7, 9, 1, 12, 1, 19, 1, 24, 1, 32, 2, 9,
+  1, 28, 1, 42, 1, 29, 1, 43, 1, 9, 1, 40, 1, 41, 1, 40,
+  7, 9, 1, 32, 1, 24, 1, 19, 1, 12, 7, 9, 1, 4, 1, 0,
+  1, 5, 7, 9, 1, 13, 1, 20, 1, 25, 1, 21, 2, 9, 1, 33,
+  1, 44, 1, 18, 1, 30, 1, 13, 1, 12, 1, 41, 1, 40, 7, 9,
+  1, 21, 1, 25, 1, 20, 1, 13, 7, 9, 1, 5, 1, 0, 1, 6,
+  7, 9, 1, 14, 1, 20, 1, 26, 5, 9, 1, 45, 1, 17, 1, 46,
+  1, 47, 1, 41, 1, 40, 8, 9, 1, 26, 1, 20, 1, 14, 7, 9,
+  1, 6, 1, 7, 1, 6, 7, 9, 1, 15, 1, 20, 1, 27, 7, 9,
+  1, 40, 1, 48, 1, 46, 1, 38, 8, 9, 1, 27, 1, 20, 1, 15,
+  7, 9, 1, 6, 1, 7, 1, 6, 7, 9, 1, 14, 1, 20, 1, 26,
+  8, 9, 1, 21, 1, 34, 1, 33, 8, 9, 1, 26, 1, 20, 1, 14,
+  7, 9, 1, 6, 1, 7, 1, 5, 7, 9, 1, 13, 1, 20, 1, 25,
+  1, 21, 17, 9, 1, 21, 1, 25, 1, 20, 1, 13, 7, 9, 1, 5,
+  1, 0, 1, 4, 7, 9, 1, 12, 1, 19, 1, 24, 1, 32, 17, 9,
+  1, 32, 1, 24, 1, 19, 1, 12, 7, 9, 1, 4, 1, 0, 1, 3,
+  7, 9, 1, 11, 1, 18, 1, 20, 1, 31, 17, 9, 1, 31, 1, 20,
+  1, 18, 1, 11, 7, 9, 1, 3, 1, 0, 1, 2, 1, 8, 7, 9,
+  1, 17, 1, 20, 1, 30, 1, 37, 15, 9, 1, 37, 1, 30, 1, 20,
+  1, 17, 7, 9, 1, 8, 1, 2, 1, 0, 1, 1, 1, 6, 7, 9,
+  1, 16, 1, 23, 1, 20, 1, 15, 1, 21, 13, 9, 1, 21, 1, 15,
+  1, 20, 1, 23, 1, 16, 7, 9, 1, 6, 1, 1, 2, 0, 1, 4,
+  8, 9, 1, 22, 1, 19, 1, 36, 1, 39, 1, 21, 11, 9, 1, 21,
+  1, 39, 1, 36, 1, 19, 1, 22, 8, 9, 1, 4, 3, 0, 1, 2,
+  1, 8, 7, 9, 1, 21, 1, 29, 1, 35, 1, 36, 1, 15, 1, 37,
+  9, 9, 1, 37, 1, 15, 1, 36, 1, 35, 1, 29, 1, 21, 7, 9,
+  1, 8, 1, 2, 3, 0, 1, 7, 1, 5, 8, 9, 1, 28, 1, 29,
+  1, 19, 1, 20, 1, 30, 1, 31, 1, 32, 1, 21, 3, 9, 1, 21,
+  1, 32, 1, 31, 1, 30, 1, 20, 1, 19, 1, 29, 1, 28, 8, 9,
+  1, 5, 1, 7, 4, 0, 1, 2, 1, 8, 8, 9, 1, 21, 1, 22,
+  1, 23, 2, 20, 1, 24, 1, 25, 1, 26, 1, 27, 1, 26, 1, 25,
+  1, 24, 2, 20, 1, 23, 1, 22, 1, 21, 8, 9, 1, 8, 1, 2,
+  6, 0, 1, 4, 10, 9, 1, 16, 1, 17, 1, 18, 1, 19, 5, 20,
+  1, 19, 1, 18, 1, 17, 1, 16, 10, 9, 1, 4, 7, 0, 1, 1,
+  1, 6, 11, 9, 1, 11, 1, 12, 1, 13, 1, 14, 1, 15, 1, 14,
+  1, 13, 1, 12, 1, 11, 11, 9, 1, 6, 1, 1, 8, 0, 1, 2,
+  1, 8, 29, 9, 1, 8, 1, 2, 10, 0, 1, 10, 1, 8, 27, 9,
+  1, 8, 1, 10, 12, 0, 1, 10, 1, 8, 25, 9, 1, 8, 1, 10,
+  14, 0, 1, 2, 1, 6, 23, 9, 1, 6, 1, 2, 16, 0, 1, 1,
+  1, 4, 1, 8, 19, 9, 1, 8, 1, 4, 1, 1, 19, 0, 1, 2,
+  1, 5, 1, 8, 15, 9, 1, 8, 1, 5, 1, 2, 22, 0, 1, 7,
+  1, 2, 1, 4, 1, 6, 1, 8, 9, 9, 1, 8, 1, 6, 1, 4,
+  1, 2, 1, 7, 26, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5,
+  3, 6, 1, 5, 1, 4, 1, 3, 1, 2, 1, 1, 34, 0, 3, 7,
+  20, 0
 };
+static constexpr CompressedIcon kCircularIcon_history{42, 42, kCircularIcon_history_Palette, 49, kCircularIcon_history_Rle, 1202};
+
 
 } // namespace ui::assets
 
@@ -0,0 +1,97 @@
+/**
+ * @file icon_codec.hpp
+ * @brief Palettized RLE icon format and decoder for UI assets
+ * @details Icons are stored as a per-icon RGB565 palette (<= 256 entries)
+ *          plus a run-length encoded stream of (run_length, palette_index)
+ *          byte pairs, generated by tools/compress_icons.py from the raw
+ *          output of the icon generators. This shrinks the flash footprint
+ *          several-fold versus raw 16-bit arrays, and the decoder skips
+ *          transparent runs entirely instead of testing every pixel.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ui::assets {
+
+/**
+ * @brief A palettized, run-length encoded icon
+ */
+struct CompressedIcon {
+    int16_t w;                ///< Icon width in pixels
+    int16_t h;                ///< Icon height in pixels
+    const uint16_t* palette;  ///< RGB565 palette (palette_len entries)
+    uint16_t palette_len;     ///< Number of palette entries
+    const uint8_t* rle;       ///< (run_length, palette_index) byte pairs
+    size_t rle_len;           ///< RLE stream length in bytes (even)
+};
+
+/**
+ * @brief Expand a compressed icon directly into a canvas
+ * @details Decodes run-by-run: transparent runs advance the cursor without
+ *          touching the canvas, opaque runs become horizontal fill spans
+ *          (split at row boundaries). No intermediate pixel buffer is used.
+ *          When the icon rectangle lies fully on the canvas, spans go
+ *          through writeFillRectPreclipped inside a single startWrite
+ *          transaction, skipping per-span clip tests and write setup; the
+ *          cursor is tracked incrementally so no span pays a div/mod.
+ * @param canvas Target sprite/canvas (LGFX drawing surface)
+ * @param x Left edge of the icon on the canvas
+ * @param y Top edge of the icon on the canvas
+ * @param icon Compressed icon to draw
+ * @param transparent RGB565 color treated as transparent
+ */
+template <typename Canvas>
+inline void drawCompressedIcon(Canvas& canvas, int16_t x, int16_t y,
+                               const CompressedIcon& icon, uint16_t transparent) noexcept
+{
+    const int total = static_cast<int>(icon.w) * static_cast<int>(icon.h);
+    const bool preclipped = x >= 0 && y >= 0 &&
+                            x + icon.w <= canvas.width() &&
+                            y + icon.h <= canvas.height();
+
+    int px = 0;
+    int row = 0;
+    int col = 0;
+    canvas.startWrite();
+    for (size_t i = 0; i + 1 < icon.rle_len && px < total; i += 2) {
+        int run = icon.rle[i];
+        const uint16_t color = icon.palette[icon.rle[i + 1]];
+        if (color == transparent) {
+            px += run;
+            col += run;
+            while (col >= icon.w) {
+                col -= icon.w;
+                ++row;
+            }
+            continue;
+        }
+        if (preclipped) {
+            canvas.setColor(color);
+        }
+        while (run > 0 && px < total) {
+            int span = icon.w - col;
+            if (span > run) {
+                span = run;
+            }
+            if (preclipped) {
+                canvas.writeFillRectPreclipped(x + col, y + row, span, 1);
+            } else {
+                canvas.fillRect(static_cast<int16_t>(x + col), static_cast<int16_t>(y + row),
+                                span, 1, color);
+            }
+            px += span;
+            run -= span;
+            col += span;
+            if (col == icon.w) {
+                col = 0;
+                ++row;
+            }
+        }
+    }
+    canvas.endWrite();
+}
+
+} // namespace ui::assets
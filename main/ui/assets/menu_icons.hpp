@@ -3,13 +3,17 @@
  * @brief Auto-generated menu icons
  * @details Icons are RGB565 format with anti-aliasing and gradient effects.
  *          Chroma-key transparent background for compositing.
- *          Generated by tools/generate_menu_icons.py
+ *          Stored palettized + run-length encoded (see icon_codec.hpp);
+ *          generated by tools/generate_menu_icons.py piped through
+ *          tools/compress_icons.py
  */
 
 #pragma once
 
 #include <cstdint>
 
+#include "icon_codec.hpp"
+
 namespace ui::assets {
 
 /**
@@ -19,1738 +23,592 @@ static constexpr uint16_t kTransparent565 = 0x0000;
 
 static constexpr int kIcon_home_W = 64;
 static constexpr int kIcon_home_H = 64;
-static const uint16_t kIcon_home[4096] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0883, 0x21ab, 0x3ab1,
-  0x4b96, 0x543a, 0x5cbd, 0x64fe, 0x651f, 0x64fe, 0x5cbd, 0x543a, 0x4b96, 0x3ab1, 0x21ab, 0x0883,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a4, 0x326f,
-  0x53f9, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f,
-  0x651f, 0x651f, 0x651f, 0x651f, 0x53f9, 0x326f, 0x10a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1968, 0x4375, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f,
-  0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x4375,
-  0x1968, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1907, 0x4b96, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x4bb7, 0x3290,
-  0x21aa, 0x10e6, 0x0863, 0x0021, 0x0000, 0x0021, 0x0863, 0x10e6, 0x21aa, 0x3290, 0x4bb7, 0x651f,
-  0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x4b96, 0x1907, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ab1, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x4376,
-  0x21cb, 0x0021, 0x0000, 0x0000, 0x2124, 0x4a49, 0x630c, 0x738e, 0x7bcf, 0x738e, 0x630c, 0x4a49,
-  0x2124, 0x0000, 0x0000, 0x0021, 0x21cb, 0x4376, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x3ab1,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1106, 0x53f9, 0x651f, 0x651f, 0x651f,
-  0x651f, 0x3af2, 0x10c5, 0x0000, 0x18a3, 0x630c, 0xa535, 0xdf1c, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xdf1c, 0xa535, 0x630c, 0x18a3, 0x0000, 0x10c5, 0x3af2,
-  0x651f, 0x651f, 0x651f, 0x651f, 0x53f9, 0x1106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21ab, 0x64fe,
-  0x651f, 0x651f, 0x651f, 0x4376, 0x10e6, 0x0000, 0x39c7, 0x9cf3, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xd69a, 0xad55, 0x8c72, 0x7bf0, 0x7bcf, 0x7bf0, 0x8c72, 0xad55, 0xd69a, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0x9cf3, 0x39c7, 0x0000, 0x10e6, 0x4376, 0x651f, 0x651f, 0x651f, 0x64fe, 0x21ab, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2a0d, 0x651f, 0x651f, 0x651f, 0x651f, 0x2a0d, 0x0000, 0x2945, 0xa514, 0xef7e, 0xef7e,
-  0xef7e, 0xa534, 0x5acb, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0x5acb, 0xa534, 0xef7e, 0xef7e, 0xef7e, 0xa514, 0x2945, 0x0000, 0x2a0d, 0x651f,
-  0x651f, 0x651f, 0x651f, 0x2a0d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2a0d, 0x651f, 0x651f, 0x651f, 0x543a, 0x1106, 0x0000, 0x738e,
-  0xef7e, 0xef7e, 0xe75d, 0x7bf0, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x7bf0, 0xe75d, 0xef7e,
-  0xef7e, 0x738e, 0x0000, 0x1106, 0x543a, 0x651f, 0x651f, 0x651f, 0x2a0d, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21ab, 0x651f, 0x651f, 0x651f, 0x4bd7,
-  0x0863, 0x1082, 0xa535, 0xef7e, 0xef7e, 0x8c72, 0x18a3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18a3, 0x8c72, 0xef7e, 0xef7e, 0xa535, 0x1082, 0x0863, 0x4bd7, 0x651f, 0x651f,
-  0x651f, 0x21ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1106, 0x64fe,
-  0x651f, 0x651f, 0x4bd7, 0x0021, 0x2124, 0xc639, 0xef7e, 0xd6bb, 0x4a49, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a49, 0xd6bb, 0xef7e, 0xc639,
-  0x2124, 0x0021, 0x4bd7, 0x651f, 0x651f, 0x64fe, 0x1106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x53f9, 0x651f, 0x651f, 0x543a, 0x0863, 0x2124, 0xce9a, 0xef7e, 0xb5b7, 0x18e3,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0xb5b7, 0xef7e, 0xce9a, 0x2124, 0x0863, 0x543a, 0x651f, 0x651f, 0x53f9, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ab1, 0x651f, 0x651f, 0x651f, 0x1106, 0x1082, 0xc639,
-  0xef7e, 0xad55, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xad55, 0xef7e, 0xc639, 0x1082, 0x1106,
-  0x651f, 0x651f, 0x651f, 0x3ab1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1907, 0x651f, 0x651f, 0x651f,
-  0x2a0d, 0x0000, 0xa535, 0xef7e, 0xb5b7, 0x0020, 0x0000, 0x4208, 0x7bcf, 0x4208, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x4208, 0x7bcf, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b6e,
-  0xd6bb, 0xdf1c, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefc, 0xdefb, 0xdefb, 0xdefb, 0xc618, 0x4228,
-  0xb5b7, 0xef7e, 0xa535, 0x0000, 0x2a0d, 0x651f, 0x651f, 0x651f, 0x1907, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4b96, 0x651f, 0x651f, 0x4376, 0x0000, 0x738e, 0xef7e, 0xd6bb, 0x18e3, 0x0000, 0x4208, 0xef7e,
-  0xef7e, 0xef7e, 0x4208, 0x0000, 0x0000, 0x0000, 0x4208, 0xef7e, 0xef7e, 0xef7e, 0x4208, 0x0000,
-  0x0000, 0x0000, 0x6b6e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x52aa, 0xd6bb, 0xef7e, 0x738e, 0x0000, 0x4376, 0x651f, 0x651f,
-  0x4b96, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1968, 0x651f, 0x651f, 0x651f, 0x10e6, 0x2945, 0xef7e, 0xef7e, 0x4a49,
-  0x0000, 0x0000, 0xbdf8, 0xef7e, 0xef7e, 0xef7e, 0xbdf8, 0x0000, 0x0000, 0x0000, 0xbdf8, 0xef7e,
-  0xef7e, 0xef7e, 0xbdf8, 0x0000, 0x0000, 0x0000, 0xd6bb, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x7bcf, 0x4a49, 0xef7e, 0xef7e,
-  0x2945, 0x10e6, 0x651f, 0x651f, 0x651f, 0x1968, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4375, 0x651f, 0x651f, 0x3af2, 0x0000,
-  0xa514, 0xef7e, 0x8c72, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdefc, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0x4208, 0x0000, 0x8c72, 0xef7e, 0xa514, 0x0000, 0x3af2, 0x651f, 0x651f, 0x4375, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a4, 0x651f,
-  0x651f, 0x651f, 0x10c5, 0x39c7, 0xef7e, 0xe75d, 0x18a3, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xef7d, 0xdefb, 0xdefb, 0xdefb, 0xdefc, 0xdefb,
-  0xdefb, 0xdefb, 0xc618, 0x4208, 0x0000, 0x0000, 0x18a3, 0xe75d, 0xef7e, 0x39c7, 0x10c5, 0x651f,
-  0x651f, 0x651f, 0x10a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x326f, 0x651f, 0x651f, 0x4376, 0x0000, 0x9cf3, 0xef7e, 0x7bf0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bf0,
-  0xef7e, 0x9cf3, 0x0000, 0x4376, 0x651f, 0x651f, 0x326f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x53f9, 0x651f, 0x651f, 0x21cb, 0x18a3, 0xef7e,
-  0xef7e, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0xef7e, 0xef7e, 0x18a3, 0x21cb, 0x651f, 0x651f, 0x53f9, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0883, 0x651f, 0x651f,
-  0x651f, 0x0021, 0x630c, 0xef7e, 0xa534, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa534, 0xef7e, 0x630c, 0x0021,
-  0x651f, 0x651f, 0x651f, 0x0883, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x21ab, 0x651f, 0x651f, 0x4bb7, 0x0000, 0xa535, 0xef7e, 0x5acb, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5acb, 0xef7e, 0xa535, 0x0000, 0x4bb7, 0x651f, 0x651f, 0x21ab, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ab1, 0x651f, 0x651f, 0x3290, 0x0000, 0xdf1c, 0xef7e,
-  0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0xef7e, 0xdf1c, 0x0000, 0x3290, 0x651f, 0x651f, 0x3ab1,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b96, 0x651f, 0x651f,
-  0x21aa, 0x2124, 0xef7e, 0xd69a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xef7d, 0xdefc, 0xdefc, 0xdefc, 0xdefc, 0xc618,
-  0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd69a, 0xef7e, 0x2124,
-  0x21aa, 0x651f, 0x651f, 0x4b96, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x543a, 0x651f, 0x651f, 0x10e6, 0x4a49, 0xef7e, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdf1c, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xad55, 0xef7e, 0x4a49, 0x10e6, 0x651f, 0x651f, 0x543a, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5cbd, 0x651f, 0x651f, 0x0863, 0x630c, 0xef7e, 0x8c72,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xef7d, 0xdefc,
-  0xdefb, 0xdefb, 0xef7d, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xe73d, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x7bcf, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8c72, 0xef7e, 0x630c, 0x0863, 0x651f, 0x651f, 0x5cbd,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x64fe, 0x651f, 0x651f,
-  0x0021, 0x738e, 0xef7e, 0x7bf0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdf1c, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xdf1c, 0x0000,
-  0x0000, 0x0000, 0xdf1c, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bf0, 0xef7e, 0x738e,
-  0x0021, 0x651f, 0x651f, 0x64fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x651f, 0x651f, 0x651f, 0x0000, 0x7bcf, 0xef7e, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xe73d, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xe73d, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xef7d, 0xdefc,
-  0xdefc, 0xdefc, 0xdefc, 0xc618, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x7bcf, 0xef7e, 0x7bcf, 0x0000, 0x651f, 0x651f, 0x651f, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x64fe, 0x651f, 0x651f, 0x0021, 0x738e, 0xef7e, 0x7bf0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdf1c, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xdf1c, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bf0, 0xef7e, 0x738e, 0x0021, 0x651f, 0x651f, 0x64fe,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5cbd, 0x651f, 0x651f,
-  0x0863, 0x630c, 0xef7e, 0x8c72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdefb, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xdefc, 0xdefb, 0xdefb, 0xef7d, 0xef7e, 0xef7e, 0xef7e, 0xdefb, 0x0000,
-  0x0000, 0x0000, 0xdefb, 0xef7e, 0xef7e, 0xef7e, 0xdefb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8c72, 0xef7e, 0x630c,
-  0x0863, 0x651f, 0x651f, 0x5cbd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x543a, 0x651f, 0x651f, 0x10e6, 0x4a49, 0xef7e, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xad55, 0xef7e, 0x4a49, 0x10e6, 0x651f, 0x651f, 0x543a, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b96, 0x651f, 0x651f, 0x21aa, 0x2124, 0xef7e, 0xd69a,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdefb, 0xef7e, 0xef7e, 0xef7e, 0xdefb, 0x0000,
-  0x0000, 0x0000, 0xdefb, 0xef7e, 0xef7e, 0xef7e, 0xdefb, 0x0000, 0x0000, 0x0000, 0xdefb, 0xef7e,
-  0xef7e, 0xef7e, 0xdefb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd69a, 0xef7e, 0x2124, 0x21aa, 0x651f, 0x651f, 0x4b96,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ab1, 0x651f, 0x651f,
-  0x3290, 0x0000, 0xdf1c, 0xef7e, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0xef7e, 0xdf1c, 0x0000,
-  0x3290, 0x651f, 0x651f, 0x3ab1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x21ab, 0x651f, 0x651f, 0x4bb7, 0x0000, 0xa535, 0xef7e, 0x5acb, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5acb, 0xef7e, 0xa535, 0x0000, 0x4bb7, 0x651f, 0x651f, 0x21ab, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0883, 0x651f, 0x651f, 0x651f, 0x0021, 0x630c, 0xef7e,
-  0xa534, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xa534, 0xef7e, 0x630c, 0x0021, 0x651f, 0x651f, 0x651f, 0x0883,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x53f9, 0x651f,
-  0x651f, 0x21cb, 0x18a3, 0xef7e, 0xef7e, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0xef7e, 0xef7e, 0x18a3, 0x21cb,
-  0x651f, 0x651f, 0x53f9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x326f, 0x651f, 0x651f, 0x4376, 0x0000, 0x9cf3, 0xef7e, 0x7bf0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bf0,
-  0xef7e, 0x9cf3, 0x0000, 0x4376, 0x651f, 0x651f, 0x326f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a4, 0x651f, 0x651f, 0x651f, 0x10c5, 0x39c7,
-  0xef7e, 0xe75d, 0x18a3, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18a3, 0xe75d, 0xef7e, 0x39c7, 0x10c5, 0x651f, 0x651f, 0x651f, 0x10a4, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4375,
-  0x651f, 0x651f, 0x3af2, 0x0000, 0xa514, 0xef7e, 0x8c72, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000,
-  0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8c72, 0xef7e, 0xa514, 0x0000, 0x3af2, 0x651f,
-  0x651f, 0x4375, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1968, 0x651f, 0x651f, 0x651f, 0x10e6, 0x2945, 0xef7e, 0xef7e, 0x4a49,
-  0x0000, 0x0000, 0xbdf8, 0xef7e, 0xef7e, 0xef7e, 0xbdf8, 0x0000, 0x0000, 0x0000, 0xbdf8, 0xef7e,
-  0xef7e, 0xef7e, 0xbdf8, 0x0000, 0x0000, 0x0000, 0xbdf8, 0xef7e, 0xef7e, 0xef7e, 0xbdf8, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a49, 0xef7e, 0xef7e,
-  0x2945, 0x10e6, 0x651f, 0x651f, 0x651f, 0x1968, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b96, 0x651f, 0x651f, 0x4376,
-  0x0000, 0x738e, 0xef7e, 0xd6bb, 0x18e3, 0x0000, 0x4208, 0xef7e, 0xef7e, 0xef7e, 0x4208, 0x0000,
-  0x0000, 0x0000, 0x4208, 0xef7e, 0xef7e, 0xef7e, 0x4208, 0x0000, 0x0000, 0x0000, 0x4208, 0xef7e,
-  0xef7e, 0xef7e, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18e3, 0xd6bb, 0xef7e, 0x738e, 0x0000, 0x4376, 0x651f, 0x651f, 0x4b96, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1907, 0x651f, 0x651f, 0x651f, 0x2a0d, 0x0000, 0xa535, 0xef7e, 0xb5b7, 0x0020, 0x0000, 0x4208,
-  0x7bcf, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0x7bcf, 0x4208, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x4208, 0x7bcf, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0xb5b7, 0xef7e, 0xa535, 0x0000, 0x2a0d, 0x651f, 0x651f, 0x651f,
-  0x1907, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ab1, 0x651f, 0x651f, 0x651f, 0x1106, 0x1082, 0xc639,
-  0xef7e, 0xad55, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xad55, 0xef7e, 0xc639, 0x1082, 0x1106,
-  0x651f, 0x651f, 0x651f, 0x3ab1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x53f9, 0x651f,
-  0x651f, 0x543a, 0x0863, 0x2124, 0xce9a, 0xef7e, 0xb5b7, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0xb5b7, 0xef7e,
-  0xce9a, 0x2124, 0x0863, 0x543a, 0x651f, 0x651f, 0x53f9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1106, 0x64fe, 0x651f, 0x651f, 0x4bd7, 0x0021, 0x2124, 0xc639, 0xef7e, 0xd6bb,
-  0x4a49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4a49, 0xd6bb, 0xef7e, 0xc639, 0x2124, 0x0021, 0x4bd7, 0x651f, 0x651f, 0x64fe, 0x1106, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21ab, 0x651f, 0x651f, 0x651f, 0x4bd7,
-  0x0863, 0x1082, 0xa535, 0xef7e, 0xef7e, 0x8c72, 0x18a3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18a3, 0x8c72, 0xef7e, 0xef7e, 0xa535, 0x1082, 0x0863, 0x4bd7, 0x651f, 0x651f,
-  0x651f, 0x21ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2a0d, 0x651f, 0x651f, 0x651f, 0x543a, 0x1106, 0x0000, 0x738e, 0xef7e, 0xef7e, 0xe75d, 0x7bf0,
-  0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x7bf0, 0xe75d, 0xef7e, 0xef7e, 0x738e, 0x0000, 0x1106,
-  0x543a, 0x651f, 0x651f, 0x651f, 0x2a0d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2a0d, 0x651f, 0x651f, 0x651f, 0x651f, 0x2a0d, 0x0000,
-  0x2945, 0xa514, 0xef7e, 0xef7e, 0xef7e, 0xa534, 0x5acb, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x5acb, 0xa534, 0xef7e, 0xef7e, 0xef7e, 0xa514,
-  0x2945, 0x0000, 0x2a0d, 0x651f, 0x651f, 0x651f, 0x651f, 0x2a0d, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21ab, 0x64fe,
-  0x651f, 0x651f, 0x651f, 0x4376, 0x10e6, 0x0000, 0x39c7, 0x9cf3, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xd69a, 0xad55, 0x8c72, 0x7bf0, 0x7bcf, 0x7bf0, 0x8c72, 0xad55, 0xd69a, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0x9cf3, 0x39c7, 0x0000, 0x10e6, 0x4376, 0x651f, 0x651f, 0x651f, 0x64fe, 0x21ab, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1106, 0x53f9, 0x651f, 0x651f, 0x651f, 0x651f, 0x3af2, 0x10c5, 0x0000,
-  0x18a3, 0x630c, 0xa535, 0xdf1c, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xdf1c, 0xa535, 0x630c, 0x18a3, 0x0000, 0x10c5, 0x3af2, 0x651f, 0x651f, 0x651f, 0x651f,
-  0x53f9, 0x1106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ab1, 0x651f, 0x651f,
-  0x651f, 0x651f, 0x651f, 0x4376, 0x21cb, 0x0021, 0x0000, 0x0000, 0x2124, 0x4a49, 0x630c, 0x738e,
-  0x7bcf, 0x738e, 0x630c, 0x4a49, 0x2124, 0x0000, 0x0000, 0x0021, 0x21cb, 0x4376, 0x651f, 0x651f,
-  0x651f, 0x651f, 0x651f, 0x3ab1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1907, 0x4b96, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x4bb7, 0x3290,
-  0x21aa, 0x10e6, 0x0863, 0x0021, 0x0000, 0x0021, 0x0863, 0x10e6, 0x21aa, 0x3290, 0x4bb7, 0x651f,
-  0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x4b96, 0x1907, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1968, 0x4375, 0x651f, 0x651f,
-  0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f,
-  0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x4375, 0x1968, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a4, 0x326f, 0x53f9, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f,
-  0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x651f, 0x53f9, 0x326f, 0x10a4, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0883, 0x21ab, 0x3ab1,
-  0x4b96, 0x543a, 0x5cbd, 0x64fe, 0x651f, 0x64fe, 0x5cbd, 0x543a, 0x4b96, 0x3ab1, 0x21ab, 0x0883,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000,
+static constexpr uint16_t kIcon_home_Palette[66] = {
+  0x0000, 0x0883, 0x21AB, 0x3AB1, 0x4B96, 0x543A, 0x5CBD, 0x64FE, 0x651F, 0x10A4, 0x326F, 0x53F9, 0x1968, 0x4375, 0x1907, 0x4BB7,
+  0x3290, 0x21AA, 0x10E6, 0x0863, 0x0021, 0x4376, 0x21CB, 0x2124, 0x4A49, 0x630C, 0x738E, 0x7BCF, 0x1106, 0x3AF2, 0x10C5, 0x18A3,
+  0xA535, 0xDF1C, 0xEF7E, 0x39C7, 0x9CF3, 0xD69A, 0xAD55, 0x8C72, 0x7BF0, 0x2A0D, 0x2945, 0xA514, 0xA534, 0x5ACB, 0x18E3, 0xE75D,
+  0x4BD7, 0x1082, 0xC639, 0xD6BB, 0xCE9A, 0xB5B7, 0x0020, 0x4208, 0x6B6E, 0xDEFB, 0xDEFC, 0xC618, 0x4228, 0x52AA, 0xBDF8, 0xDEDB,
+  0xEF7D, 0xE73D
+};
+static constexpr uint8_t kIcon_home_Rle[2566] = {
+  255, 0, 90, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5, 1, 6,
+  1, 7, 1, 8, 1, 7, 1, 6, 1, 5, 1, 4, 1, 3, 1, 2,
+  1, 1, 46, 0, 1, 9, 1, 10, 1, 11, 15, 8, 1, 11, 1, 10,
+  1, 9, 41, 0, 1, 12, 1, 13, 21, 8, 1, 13, 1, 12, 37, 0,
+  1, 14, 1, 4, 6, 8, 1, 15, 1, 16, 1, 17, 1, 18, 1, 19,
+  1, 20, 1, 0, 1, 20, 1, 19, 1, 18, 1, 17, 1, 16, 1, 15,
+  6, 8, 1, 4, 1, 14, 34, 0, 1, 3, 5, 8, 1, 21, 1, 22,
+  1, 20, 2, 0, 1, 23, 1, 24, 1, 25, 1, 26, 1, 27, 1, 26,
+  1, 25, 1, 24, 1, 23, 2, 0, 1, 20, 1, 22, 1, 21, 5, 8,
+  1, 3, 31, 0, 1, 28, 1, 11, 4, 8, 1, 29, 1, 30, 1, 0,
+  1, 31, 1, 25, 1, 32, 1, 33, 9, 34, 1, 33, 1, 32, 1, 25,
+  1, 31, 1, 0, 1, 30, 1, 29, 4, 8, 1, 11, 1, 28, 28, 0,
+  1, 2, 1, 7, 3, 8, 1, 21, 1, 18, 1, 0, 1, 35, 1, 36,
+  4, 34, 1, 37, 1, 38, 1, 39, 1, 40, 1, 27, 1, 40, 1, 39,
+  1, 38, 1, 37, 4, 34, 1, 36, 1, 35, 1, 0, 1, 18, 1, 21,
+  3, 8, 1, 7, 1, 2, 26, 0, 1, 41, 4, 8, 1, 41, 1, 0,
+  1, 42, 1, 43, 3, 34, 1, 44, 1, 45, 1, 46, 9, 0, 1, 46,
+  1, 45, 1, 44, 3, 34, 1, 43, 1, 42, 1, 0, 1, 41, 4, 8,
+  1, 41, 24, 0, 1, 41, 3, 8, 1, 5, 1, 28, 1, 0, 1, 26,
+  2, 34, 1, 47, 1, 40, 1, 46, 15, 0, 1, 46, 1, 40, 1, 47,
+  2, 34, 1, 26, 1, 0, 1, 28, 1, 5, 3, 8, 1, 41, 22, 0,
+  1, 2, 3, 8, 1, 48, 1, 19, 1, 49, 1, 32, 2, 34, 1, 39,
+  1, 31, 19, 0, 1, 31, 1, 39, 2, 34, 1, 32, 1, 49, 1, 19,
+  1, 48, 3, 8, 1, 2, 20, 0, 1, 28, 1, 7, 2, 8, 1, 48,
+  1, 20, 1, 23, 1, 50, 1, 34, 1, 51, 1, 24, 23, 0, 1, 24,
+  1, 51, 1, 34, 1, 50, 1, 23, 1, 20, 1, 48, 2, 8, 1, 7,
+  1, 28, 19, 0, 1, 11, 2, 8, 1, 5, 1, 19, 1, 23, 1, 52,
+  1, 34, 1, 53, 1, 46, 25, 0, 1, 46, 1, 53, 1, 34, 1, 52,
+  1, 23, 1, 19, 1, 5, 2, 8, 1, 11, 18, 0, 1, 3, 3, 8,
+  1, 28, 1, 49, 1, 50, 1, 34, 1, 38, 1, 54, 27, 0, 1, 54,
+  1, 38, 1, 34, 1, 50, 1, 49, 1, 28, 3, 8, 1, 3, 16, 0,
+  1, 14, 3, 8, 1, 41, 1, 0, 1, 32, 1, 34, 1, 53, 1, 54,
+  1, 0, 1, 55, 1, 27, 1, 55, 5, 0, 1, 55, 1, 27, 1, 55,
+  5, 0, 1, 56, 1, 51, 1, 33, 4, 57, 1, 58, 3, 57, 1, 59,
+  1, 60, 1, 53, 1, 34, 1, 32, 1, 0, 1, 41, 3, 8, 1, 14,
+  15, 0, 1, 4, 2, 8, 1, 21, 1, 0, 1, 26, 1, 34, 1, 51,
+  1, 46, 1, 0, 1, 55, 3, 34, 1, 55, 3, 0, 1, 55, 3, 34,
+  1, 55, 3, 0, 1, 56, 13, 34, 1, 61, 1, 51, 1, 34, 1, 26,
+  1, 0, 1, 21, 2, 8, 1, 4, 14, 0, 1, 12, 3, 8, 1, 18,
+  1, 42, 2, 34, 1, 24, 2, 0, 1, 62, 3, 34, 1, 62, 3, 0,
+  1, 62, 3, 34, 1, 62, 3, 0, 1, 51, 13, 34, 1, 27, 1, 24,
+  2, 34, 1, 42, 1, 18, 3, 8, 1, 12, 13, 0, 1, 13, 2, 8,
+  1, 29, 1, 0, 1, 43, 1, 34, 1, 39, 3, 0, 1, 63, 3, 34,
+  1, 63, 3, 0, 1, 63, 3, 34, 1, 63, 3, 0, 1, 58, 13, 34,
+  1, 55, 1, 0, 1, 39, 1, 34, 1, 43, 1, 0, 1, 29, 2, 8,
+  1, 13, 12, 0, 1, 9, 3, 8, 1, 30, 1, 35, 1, 34, 1, 47,
+  1, 31, 3, 0, 1, 63, 3, 34, 1, 63, 3, 0, 1, 63, 3, 34,
+  1, 63, 3, 0, 1, 63, 3, 34, 1, 64, 3, 57, 1, 58, 3, 57,
+  1, 59, 1, 55, 2, 0, 1, 31, 1, 47, 1, 34, 1, 35, 1, 30,
+  3, 8, 1, 9, 11, 0, 1, 10, 2, 8, 1, 21, 1, 0, 1, 36,
+  1, 34, 1, 40, 4, 0, 1, 63, 3, 34, 1, 63, 3, 0, 1, 63,
+  3, 34, 1, 63, 3, 0, 1, 63, 3, 34, 1, 63, 12, 0, 1, 40,
+  1, 34, 1, 36, 1, 0, 1, 21, 2, 8, 1, 10, 11, 0, 1, 11,
+  2, 8, 1, 22, 1, 31, 2, 34, 1, 46, 4, 0, 1, 63, 3, 34,
+  1, 63, 3, 0, 1, 63, 3, 34, 1, 63, 3, 0, 1, 63, 3, 34,
+  1, 63, 12, 0, 1, 46, 2, 34, 1, 31, 1, 22, 2, 8, 1, 11,
+  10, 0, 1, 1, 3, 8, 1, 20, 1, 25, 1, 34, 1, 44, 5, 0,
+  1, 63, 3, 34, 1, 63, 3, 0, 1, 63, 3, 34, 1, 63, 3, 0,
+  1, 63, 3, 34, 1, 63, 13, 0, 1, 44, 1, 34, 1, 25, 1, 20,
+  3, 8, 1, 1, 9, 0, 1, 2, 2, 8, 1, 15, 1, 0, 1, 32,
+  1, 34, 1, 45, 5, 0, 1, 63, 3, 34, 1, 63, 3, 0, 1, 63,
+  3, 34, 1, 63, 3, 0, 1, 63, 3, 34, 1, 63, 13, 0, 1, 45,
+  1, 34, 1, 32, 1, 0, 1, 15, 2, 8, 1, 2, 9, 0, 1, 3,
+  2, 8, 1, 16, 1, 0, 1, 33, 1, 34, 1, 46, 5, 0, 1, 63,
+  3, 34, 1, 63, 3, 0, 1, 63, 3, 34, 1, 63, 3, 0, 1, 63,
+  3, 34, 1, 63, 13, 0, 1, 46, 1, 34, 1, 33, 1, 0, 1, 16,
+  2, 8, 1, 3, 9, 0, 1, 4, 2, 8, 1, 17, 1, 23, 1, 34,
+  1, 37, 6, 0, 1, 63, 3, 34, 1, 63, 3, 0, 1, 63, 3, 34,
+  1, 63, 3, 0, 1, 63, 3, 34, 1, 64, 4, 58, 1, 59, 1, 55,
+  8, 0, 1, 37, 1, 34, 1, 23, 1, 17, 2, 8, 1, 4, 9, 0,
+  1, 5, 2, 8, 1, 18, 1, 24, 1, 34, 1, 38, 6, 0, 1, 63,
+  3, 34, 1, 63, 3, 0, 1, 63, 3, 34, 1, 63, 3, 0, 1, 33,
+  10, 34, 1, 55, 7, 0, 1, 38, 1, 34, 1, 24, 1, 18, 2, 8,
+  1, 5, 9, 0, 1, 6, 2, 8, 1, 19, 1, 25, 1, 34, 1, 39,
+  6, 0, 1, 63, 3, 34, 1, 64, 1, 58, 2, 57, 1, 64, 3, 34,
+  1, 63, 3, 0, 1, 65, 10, 34, 1, 27, 7, 0, 1, 39, 1, 34,
+  1, 25, 1, 19, 2, 8, 1, 6, 9, 0, 1, 7, 2, 8, 1, 20,
+  1, 26, 1, 34, 1, 40, 6, 0, 1, 33, 11, 34, 1, 33, 3, 0,
+  1, 33, 10, 34, 1, 55, 7, 0, 1, 40, 1, 34, 1, 26, 1, 20,
+  2, 8, 1, 7, 9, 0, 3, 8, 1, 0, 1, 27, 1, 34, 1, 27,
+  6, 0, 1, 65, 11, 34, 1, 65, 3, 0, 1, 63, 3, 34, 1, 64,
+  4, 58, 1, 59, 1, 55, 8, 0, 1, 27, 1, 34, 1, 27, 1, 0,
+  3, 8, 9, 0, 1, 7, 2, 8, 1, 20, 1, 26, 1, 34, 1, 40,
+  6, 0, 1, 33, 11, 34, 1, 33, 3, 0, 1, 63, 3, 34, 1, 63,
+  14, 0, 1, 40, 1, 34, 1, 26, 1, 20, 2, 8, 1, 7, 9, 0,
+  1, 6, 2, 8, 1, 19, 1, 25, 1, 34, 1, 39, 6, 0, 1, 57,
+  4, 34, 1, 58, 2, 57, 1, 64, 3, 34, 1, 57, 3, 0, 1, 57,
+  3, 34, 1, 57, 14, 0, 1, 39, 1, 34, 1, 25, 1, 19, 2, 8,
+  1, 6, 9, 0, 1, 5, 2, 8, 1, 18, 1, 24, 1, 34, 1, 38,
+  6, 0, 1, 63, 3, 34, 1, 63, 3, 0, 1, 63, 3, 34, 1, 63,
+  3, 0, 1, 63, 3, 34, 1, 63, 14, 0, 1, 38, 1, 34, 1, 24,
+  1, 18, 2, 8, 1, 5, 9, 0, 1, 4, 2, 8, 1, 17, 1, 23,
+  1, 34, 1, 37, 6, 0, 1, 57, 3, 34, 1, 57, 3, 0, 1, 57,
+  3, 34, 1, 57, 3, 0, 1, 57, 3, 34, 1, 57, 14, 0, 1, 37,
+  1, 34, 1, 23, 1, 17, 2, 8, 1, 4, 9, 0, 1, 3, 2, 8,
+  1, 16, 1, 0, 1, 33, 1, 34, 1, 46, 5, 0, 1, 63, 3, 34,
+  1, 63, 3, 0, 1, 63, 3, 34, 1, 63, 3, 0, 1, 63, 3, 34,
+  1, 63, 13, 0, 1, 46, 1, 34, 1, 33, 1, 0, 1, 16, 2, 8,
+  1, 3, 9, 0, 1, 2, 2, 8, 1, 15, 1, 0, 1, 32, 1, 34,
+  1, 45, 5, 0, 1, 63, 3, 34, 1, 63, 3, 0, 1, 63, 3, 34,
+  1, 63, 3, 0, 1, 63, 3, 34, 1, 63, 13, 0, 1, 45, 1, 34,
+  1, 32, 1, 0, 1, 15, 2, 8, 1, 2, 9, 0, 1, 1, 3, 8,
+  1, 20, 1, 25, 1, 34, 1, 44, 5, 0, 1, 63, 3, 34, 1, 63,
+  3, 0, 1, 63, 3, 34, 1, 63, 3, 0, 1, 63, 3, 34, 1, 63,
+  13, 0, 1, 44, 1, 34, 1, 25, 1, 20, 3, 8, 1, 1, 10, 0,
+  1, 11, 2, 8, 1, 22, 1, 31, 2, 34, 1, 46, 4, 0, 1, 63,
+  3, 34, 1, 63, 3, 0, 1, 63, 3, 34, 1, 63, 3, 0, 1, 63,
+  3, 34, 1, 63, 12, 0, 1, 46, 2, 34, 1, 31, 1, 22, 2, 8,
+  1, 11, 11, 0, 1, 10, 2, 8, 1, 21, 1, 0, 1, 36, 1, 34,
+  1, 40, 4, 0, 1, 63, 3, 34, 1, 63, 3, 0, 1, 63, 3, 34,
+  1, 63, 3, 0, 1, 63, 3, 34, 1, 63, 12, 0, 1, 40, 1, 34,
+  1, 36, 1, 0, 1, 21, 2, 8, 1, 10, 11, 0, 1, 9, 3, 8,
+  1, 30, 1, 35, 1, 34, 1, 47, 1, 31, 3, 0, 1, 63, 3, 34,
+  1, 63, 3, 0, 1, 63, 3, 34, 1, 63, 3, 0, 1, 63, 3, 34,
+  1, 63, 11, 0, 1, 31, 1, 47, 1, 34, 1, 35, 1, 30, 3, 8,
+  1, 9, 12, 0, 1, 13, 2, 8, 1, 29, 1, 0, 1, 43, 1, 34,
+  1, 39, 3, 0, 1, 63, 3, 34, 1, 63, 3, 0, 1, 63, 3, 34,
+  1, 63, 3, 0, 1, 63, 3, 34, 1, 63, 11, 0, 1, 39, 1, 34,
+  1, 43, 1, 0, 1, 29, 2, 8, 1, 13, 13, 0, 1, 12, 3, 8,
+  1, 18, 1, 42, 2, 34, 1, 24, 2, 0, 1, 62, 3, 34, 1, 62,
+  3, 0, 1, 62, 3, 34, 1, 62, 3, 0, 1, 62, 3, 34, 1, 62,
+  10, 0, 1, 24, 2, 34, 1, 42, 1, 18, 3, 8, 1, 12, 14, 0,
+  1, 4, 2, 8, 1, 21, 1, 0, 1, 26, 1, 34, 1, 51, 1, 46,
+  1, 0, 1, 55, 3, 34, 1, 55, 3, 0, 1, 55, 3, 34, 1, 55,
+  3, 0, 1, 55, 3, 34, 1, 55, 9, 0, 1, 46, 1, 51, 1, 34,
+  1, 26, 1, 0, 1, 21, 2, 8, 1, 4, 15, 0, 1, 14, 3, 8,
+  1, 41, 1, 0, 1, 32, 1, 34, 1, 53, 1, 54, 1, 0, 1, 55,
+  1, 27, 1, 55, 5, 0, 1, 55, 1, 27, 1, 55, 5, 0, 1, 55,
+  1, 27, 1, 55, 9, 0, 1, 54, 1, 53, 1, 34, 1, 32, 1, 0,
+  1, 41, 3, 8, 1, 14, 16, 0, 1, 3, 3, 8, 1, 28, 1, 49,
+  1, 50, 1, 34, 1, 38, 1, 54, 27, 0, 1, 54, 1, 38, 1, 34,
+  1, 50, 1, 49, 1, 28, 3, 8, 1, 3, 18, 0, 1, 11, 2, 8,
+  1, 5, 1, 19, 1, 23, 1, 52, 1, 34, 1, 53, 1, 46, 25, 0,
+  1, 46, 1, 53, 1, 34, 1, 52, 1, 23, 1, 19, 1, 5, 2, 8,
+  1, 11, 19, 0, 1, 28, 1, 7, 2, 8, 1, 48, 1, 20, 1, 23,
+  1, 50, 1, 34, 1, 51, 1, 24, 23, 0, 1, 24, 1, 51, 1, 34,
+  1, 50, 1, 23, 1, 20, 1, 48, 2, 8, 1, 7, 1, 28, 20, 0,
+  1, 2, 3, 8, 1, 48, 1, 19, 1, 49, 1, 32, 2, 34, 1, 39,
+  1, 31, 19, 0, 1, 31, 1, 39, 2, 34, 1, 32, 1, 49, 1, 19,
+  1, 48, 3, 8, 1, 2, 22, 0, 1, 41, 3, 8, 1, 5, 1, 28,
+  1, 0, 1, 26, 2, 34, 1, 47, 1, 40, 1, 46, 15, 0, 1, 46,
+  1, 40, 1, 47, 2, 34, 1, 26, 1, 0, 1, 28, 1, 5, 3, 8,
+  1, 41, 24, 0, 1, 41, 4, 8, 1, 41, 1, 0, 1, 42, 1, 43,
+  3, 34, 1, 44, 1, 45, 1, 46, 9, 0, 1, 46, 1, 45, 1, 44,
+  3, 34, 1, 43, 1, 42, 1, 0, 1, 41, 4, 8, 1, 41, 26, 0,
+  1, 2, 1, 7, 3, 8, 1, 21, 1, 18, 1, 0, 1, 35, 1, 36,
+  4, 34, 1, 37, 1, 38, 1, 39, 1, 40, 1, 27, 1, 40, 1, 39,
+  1, 38, 1, 37, 4, 34, 1, 36, 1, 35, 1, 0, 1, 18, 1, 21,
+  3, 8, 1, 7, 1, 2, 28, 0, 1, 28, 1, 11, 4, 8, 1, 29,
+  1, 30, 1, 0, 1, 31, 1, 25, 1, 32, 1, 33, 9, 34, 1, 33,
+  1, 32, 1, 25, 1, 31, 1, 0, 1, 30, 1, 29, 4, 8, 1, 11,
+  1, 28, 31, 0, 1, 3, 5, 8, 1, 21, 1, 22, 1, 20, 2, 0,
+  1, 23, 1, 24, 1, 25, 1, 26, 1, 27, 1, 26, 1, 25, 1, 24,
+  1, 23, 2, 0, 1, 20, 1, 22, 1, 21, 5, 8, 1, 3, 34, 0,
+  1, 14, 1, 4, 6, 8, 1, 15, 1, 16, 1, 17, 1, 18, 1, 19,
+  1, 20, 1, 0, 1, 20, 1, 19, 1, 18, 1, 17, 1, 16, 1, 15,
+  6, 8, 1, 4, 1, 14, 37, 0, 1, 12, 1, 13, 21, 8, 1, 13,
+  1, 12, 41, 0, 1, 9, 1, 10, 1, 11, 15, 8, 1, 11, 1, 10,
+  1, 9, 46, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5, 1, 6,
+  1, 7, 1, 8, 1, 7, 1, 6, 1, 5, 1, 4, 1, 3, 1, 2,
+  1, 1, 255, 0, 25, 0
 };
+static constexpr CompressedIcon kIcon_home{64, 64, kIcon_home_Palette, 66, kIcon_home_Rle, 2566};
 
 static constexpr int kIcon_settings_W = 64;
 static constexpr int kIcon_settings_H = 64;
-static const uint16_t kIcon_settings[4096] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x632c,
-  0x7bcf, 0x632c, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c3, 0x9d14, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x9d14, 0x18c3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0xce59, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xce59, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9d14, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x9d14, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x2945, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2124, 0x6b6e, 0xc659, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xc659, 0x6b6e, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x528a, 0xad76, 0xef7e, 0xe75e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe75e, 0xef7e, 0xad76, 0x528a, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062, 0x7bf0, 0xce7a,
-  0xef7e, 0xef7e, 0xc659, 0x73ae, 0x4a69, 0xbdf8, 0xef7e, 0xe75e, 0xe75e, 0xe75e, 0xe75e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe75e, 0xe75e,
-  0xe75e, 0xe75e, 0xef7e, 0xbdf8, 0x4a69, 0x73ae, 0xc659, 0xef7e, 0xef7e, 0xce7a, 0x7bf0, 0x1062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x31a6, 0xd69a, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe75e, 0xe75e, 0xe75e,
-  0xdf3e, 0xdf3e, 0xdf3e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xdf3e, 0xdf3e, 0xdf3e, 0xe75e, 0xe75e, 0xe75e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xd69a, 0x31a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1062, 0xd69a, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xdf3e, 0xdf3e, 0xdf1e, 0xdf1e, 0xd71e, 0xe75e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe75e, 0xd71e, 0xdf1e, 0xdf1e, 0xdf3e, 0xdf3e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xd69a, 0x1062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bf0, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe75e, 0xd71e, 0xd71e, 0xd6fe, 0xd6fe, 0xd6fe,
-  0xe77e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe77e, 0xd6fe, 0xd6fe, 0xd6fe,
-  0xd71e, 0xd71e, 0xe75e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0x7bf0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce7a,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe75e, 0xd6fe,
-  0xcefe, 0xcefe, 0xcede, 0xcede, 0xcede, 0xdf3e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xdf3e,
-  0xcede, 0xcede, 0xcede, 0xcefe, 0xcefe, 0xd6fe, 0xe75e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xce7a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xcefe, 0xcede, 0xc6de, 0xc6be, 0xc6be, 0xc6be, 0xc6be, 0xcede, 0xd6fe,
-  0xd71e, 0xd6fe, 0xcede, 0xc6be, 0xc6be, 0xc6be, 0xc6be, 0xc6de, 0xcede, 0xcefe, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0841, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xcede, 0xc6be, 0xc6be, 0xc6be, 0xbe9e,
-  0xbe9e, 0xbe9e, 0xbe9e, 0xbe9e, 0xbe9e, 0xbe9e, 0xbe9e, 0xbe9e, 0xbe9e, 0xbe9e, 0xc6be, 0xc6be,
-  0xc6be, 0xcede, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc659,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe75e, 0xc6be,
-  0xc6be, 0xbe9e, 0xbe9e, 0xbe9e, 0xb67e, 0xb67e, 0xb67e, 0xb67e, 0xb67e, 0xb67e, 0xb67e, 0xb67e,
-  0xb67e, 0xbe9e, 0xbe9e, 0xbe9e, 0xc6be, 0xc6be, 0xe75e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xc659, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x73ae, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xd6fe, 0xbe9e, 0xbe9e, 0xbe9e, 0xb67e, 0xb67e, 0xb67e, 0xb65e, 0xae5e, 0xae5e,
-  0xae5e, 0xae5e, 0xae5e, 0xb65e, 0xb67e, 0xb67e, 0xb67e, 0xbe9e, 0xbe9e, 0xbe9e, 0xd6fe, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x73ae, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a69, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe73e, 0xbe9e, 0xbe9e, 0xb67e, 0xb67e, 0xb65e, 0xae5e,
-  0xae5e, 0x957a, 0x7434, 0x5b70, 0x532f, 0x5b70, 0x7434, 0x957a, 0xae5e, 0xae5e, 0xb65e, 0xb67e,
-  0xb67e, 0xbe9e, 0xbe9e, 0xe73e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0x4a69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbdf8,
-  0xe75e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe73e, 0xbe9e, 0xbe9e, 0xb67e,
-  0xb67e, 0xae5e, 0xae5e, 0x63b2, 0x2146, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2146, 0x63b2, 0xae5e, 0xae5e, 0xb67e, 0xb67e, 0xbe9e, 0xbe9e, 0xe73e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe75e, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x528a, 0xef7e, 0xe75e, 0xdf3e, 0xe75e, 0xe75e, 0xef7e, 0xef7e, 0xe75e, 0xd6fe,
-  0xbe9e, 0xbe9e, 0xb67e, 0xb65e, 0xae5e, 0x7c75, 0x1905, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1905, 0x7c75, 0xae5e, 0xb65e, 0xb67e, 0xbe9e,
-  0xbe9e, 0xd6fe, 0xe75e, 0xef7e, 0xef7e, 0xe75e, 0xe75e, 0xdf3e, 0xe75e, 0xef7e, 0x528a, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad76, 0xe75e, 0xe75e, 0xdf3e, 0xd71e, 0xd6fe,
-  0xcefe, 0xcede, 0xc6be, 0xbe9e, 0xbe9e, 0xb67e, 0xb65e, 0xae5e, 0x5b70, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5b70, 0xae5e, 0xb65e, 0xb67e, 0xbe9e, 0xbe9e, 0xc6be, 0xcede, 0xcefe, 0xd6fe, 0xd71e, 0xdf3e,
-  0xe75e, 0xe75e, 0xad76, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0xef7e, 0xe75e,
-  0xdf3e, 0xdf1e, 0xd71e, 0xcefe, 0xcede, 0xc6be, 0xc6be, 0xbe9e, 0xb67e, 0xb67e, 0xae5e, 0x5b70,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1948, 0x2a2d, 0x328f, 0x2a2d, 0x1948, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5b70, 0xae5e, 0xb67e, 0xb67e, 0xbe9e, 0xc6be, 0xc6be,
-  0xcede, 0xcefe, 0xd71e, 0xdf1e, 0xdf3e, 0xe75e, 0xef7e, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x6b6e, 0xe75e, 0xe75e, 0xdf3e, 0xdf1e, 0xd6fe, 0xcefe, 0xc6de, 0xc6be, 0xbe9e, 0xbe9e,
-  0xb67e, 0xae5e, 0x7c75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2a2d, 0x5c9b, 0x755f, 0x755f,
-  0x755f, 0x755f, 0x755f, 0x5c9b, 0x2a2d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7c75, 0xae5e,
-  0xb67e, 0xbe9e, 0xbe9e, 0xc6be, 0xc6de, 0xcefe, 0xd6fe, 0xdf1e, 0xdf3e, 0xe75e, 0xe75e, 0x6b6e,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0xc659, 0xef7e, 0xe75e, 0xdf3e, 0xd71e, 0xd6fe, 0xcede,
-  0xc6be, 0xc6be, 0xbe9e, 0xb67e, 0xb65e, 0xae5e, 0x1905, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b75,
-  0x755f, 0x7d7f, 0x859f, 0x8dbf, 0x8dbf, 0x8dbf, 0x859f, 0x7d7f, 0x755f, 0x4b75, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1905, 0xae5e, 0xb65e, 0xb67e, 0xbe9e, 0xc6be, 0xc6be, 0xcede, 0xd6fe, 0xd71e,
-  0xdf3e, 0xe75e, 0xef7e, 0xc659, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x9d14, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xe75e, 0xd6fe, 0xcede, 0xc6be, 0xbe9e, 0xbe9e, 0xb67e, 0xae5e, 0x63b2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x4b75, 0x755f, 0x859f, 0x8ddf, 0x95ff, 0x9e1f, 0x9e1f, 0x9e1f, 0x95ff, 0x8ddf,
-  0x859f, 0x755f, 0x4b75, 0x0000, 0x0000, 0x0000, 0x0000, 0x63b2, 0xae5e, 0xb67e, 0xbe9e, 0xbe9e,
-  0xc6be, 0xcede, 0xd6fe, 0xe75e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x9d14, 0x18c3, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0xce59, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe77e, 0xcede, 0xc6be, 0xbe9e, 0xb67e, 0xb67e,
-  0xae5e, 0x2146, 0x0000, 0x0000, 0x0000, 0x2a2d, 0x755f, 0x859f, 0x95df, 0x9e1f, 0xa61e, 0x6c13,
-  0x5b2f, 0x6c13, 0xa61e, 0x9e1f, 0x95df, 0x859f, 0x755f, 0x2a2d, 0x0000, 0x0000, 0x0000, 0x2146,
-  0xae5e, 0xb67e, 0xb67e, 0xbe9e, 0xc6be, 0xcede, 0xe77e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xce59, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x9d14, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xdf3e,
-  0xc6be, 0xbe9e, 0xb67e, 0xb65e, 0x957a, 0x0000, 0x0000, 0x0000, 0x0000, 0x5c9b, 0x7d7f, 0x8ddf,
-  0x9e1f, 0x7cb7, 0x10a3, 0x0000, 0x0000, 0x0000, 0x10a3, 0x7cb7, 0x9e1f, 0x8ddf, 0x7d7f, 0x5c9b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x957a, 0xb65e, 0xb67e, 0xbe9e, 0xc6be, 0xdf3e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x9d14, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xcede, 0xbe9e, 0xb67e, 0xae5e, 0x7434, 0x0000, 0x0000, 0x0000,
-  0x1948, 0x755f, 0x859f, 0x95ff, 0xa61e, 0x10a3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a3,
-  0xa61e, 0x95ff, 0x859f, 0x755f, 0x1948, 0x0000, 0x0000, 0x0000, 0x7434, 0xae5e, 0xb67e, 0xbe9e,
-  0xcede, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x632c, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xd6fe, 0xbe9e, 0xb67e, 0xae5e,
-  0x5b70, 0x0000, 0x0000, 0x0000, 0x2a2d, 0x755f, 0x8dbf, 0x9e1f, 0x6c13, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x6c13, 0x9e1f, 0x8dbf, 0x755f, 0x2a2d, 0x0000, 0x0000, 0x0000,
-  0x5b70, 0xae5e, 0xb67e, 0xbe9e, 0xd6fe, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x632c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x7bcf, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xd71e, 0xbe9e, 0xb67e, 0xae5e, 0x532f, 0x0000, 0x0000, 0x0000, 0x328f, 0x755f, 0x8dbf, 0x9e1f,
-  0x5b2f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5b2f, 0x9e1f, 0x8dbf, 0x755f,
-  0x328f, 0x0000, 0x0000, 0x0000, 0x532f, 0xae5e, 0xb67e, 0xbe9e, 0xd71e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x7bcf, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x632c, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xd6fe, 0xbe9e, 0xb67e, 0xae5e, 0x5b70, 0x0000, 0x0000, 0x0000,
-  0x2a2d, 0x755f, 0x8dbf, 0x9e1f, 0x6c13, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x6c13, 0x9e1f, 0x8dbf, 0x755f, 0x2a2d, 0x0000, 0x0000, 0x0000, 0x5b70, 0xae5e, 0xb67e, 0xbe9e,
-  0xd6fe, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0x632c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xcede, 0xbe9e, 0xb67e, 0xae5e,
-  0x7434, 0x0000, 0x0000, 0x0000, 0x1948, 0x755f, 0x859f, 0x95ff, 0xa61e, 0x10a3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10a3, 0xa61e, 0x95ff, 0x859f, 0x755f, 0x1948, 0x0000, 0x0000, 0x0000,
-  0x7434, 0xae5e, 0xb67e, 0xbe9e, 0xcede, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x9d14, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xdf3e,
-  0xc6be, 0xbe9e, 0xb67e, 0xb65e, 0x957a, 0x0000, 0x0000, 0x0000, 0x0000, 0x5c9b, 0x7d7f, 0x8ddf,
-  0x9e1f, 0x7cb7, 0x10a3, 0x0000, 0x0000, 0x0000, 0x10a3, 0x7cb7, 0x9e1f, 0x8ddf, 0x7d7f, 0x5c9b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x957a, 0xb65e, 0xb67e, 0xbe9e, 0xc6be, 0xdf3e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x9d14, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0xce59, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xe77e, 0xcede, 0xc6be, 0xbe9e, 0xb67e, 0xb67e, 0xae5e, 0x2146, 0x0000, 0x0000,
-  0x0000, 0x2a2d, 0x755f, 0x859f, 0x95df, 0x9e1f, 0xa61e, 0x6c13, 0x5b2f, 0x6c13, 0xa61e, 0x9e1f,
-  0x95df, 0x859f, 0x755f, 0x2a2d, 0x0000, 0x0000, 0x0000, 0x2146, 0xae5e, 0xb67e, 0xb67e, 0xbe9e,
-  0xc6be, 0xcede, 0xe77e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xce59, 0x18c3,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x9d14,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe75e, 0xd6fe, 0xcede, 0xc6be, 0xbe9e, 0xbe9e, 0xb67e,
-  0xae5e, 0x63b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b75, 0x755f, 0x859f, 0x8ddf, 0x95ff, 0x9e1f,
-  0x9e1f, 0x9e1f, 0x95ff, 0x8ddf, 0x859f, 0x755f, 0x4b75, 0x0000, 0x0000, 0x0000, 0x0000, 0x63b2,
-  0xae5e, 0xb67e, 0xbe9e, 0xbe9e, 0xc6be, 0xcede, 0xd6fe, 0xe75e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0x9d14, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0xc659, 0xef7e, 0xe75e, 0xdf3e, 0xd71e, 0xd6fe, 0xcede,
-  0xc6be, 0xc6be, 0xbe9e, 0xb67e, 0xb65e, 0xae5e, 0x1905, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b75,
-  0x755f, 0x7d7f, 0x859f, 0x8dbf, 0x8dbf, 0x8dbf, 0x859f, 0x7d7f, 0x755f, 0x4b75, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1905, 0xae5e, 0xb65e, 0xb67e, 0xbe9e, 0xc6be, 0xc6be, 0xcede, 0xd6fe, 0xd71e,
-  0xdf3e, 0xe75e, 0xef7e, 0xc659, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b6e, 0xe75e, 0xe75e,
-  0xdf3e, 0xdf1e, 0xd6fe, 0xcefe, 0xc6de, 0xc6be, 0xbe9e, 0xbe9e, 0xb67e, 0xae5e, 0x7c75, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2a2d, 0x5c9b, 0x755f, 0x755f, 0x755f, 0x755f, 0x755f, 0x5c9b,
-  0x2a2d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7c75, 0xae5e, 0xb67e, 0xbe9e, 0xbe9e, 0xc6be,
-  0xc6de, 0xcefe, 0xd6fe, 0xdf1e, 0xdf3e, 0xe75e, 0xe75e, 0x6b6e, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef7e, 0xe75e, 0xdf3e, 0xdf1e, 0xd71e, 0xcefe, 0xcede, 0xc6be, 0xc6be, 0xbe9e,
-  0xb67e, 0xb67e, 0xae5e, 0x5b70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1948, 0x2a2d,
-  0x328f, 0x2a2d, 0x1948, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5b70, 0xae5e, 0xb67e,
-  0xb67e, 0xbe9e, 0xc6be, 0xc6be, 0xcede, 0xcefe, 0xd71e, 0xdf1e, 0xdf3e, 0xe75e, 0xef7e, 0x2124,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad76, 0xe75e, 0xe75e, 0xdf3e, 0xd71e, 0xd6fe,
-  0xcefe, 0xcede, 0xc6be, 0xbe9e, 0xbe9e, 0xb67e, 0xb65e, 0xae5e, 0x5b70, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5b70, 0xae5e, 0xb65e, 0xb67e, 0xbe9e, 0xbe9e, 0xc6be, 0xcede, 0xcefe, 0xd6fe, 0xd71e, 0xdf3e,
-  0xe75e, 0xe75e, 0xad76, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x528a, 0xef7e,
-  0xe75e, 0xdf3e, 0xe75e, 0xe75e, 0xef7e, 0xef7e, 0xe75e, 0xd6fe, 0xbe9e, 0xbe9e, 0xb67e, 0xb65e,
-  0xae5e, 0x7c75, 0x1905, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1905, 0x7c75, 0xae5e, 0xb65e, 0xb67e, 0xbe9e, 0xbe9e, 0xd6fe, 0xe75e, 0xef7e,
-  0xef7e, 0xe75e, 0xe75e, 0xdf3e, 0xe75e, 0xef7e, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xbdf8, 0xe75e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xe73e, 0xbe9e, 0xbe9e, 0xb67e, 0xb67e, 0xae5e, 0xae5e, 0x63b2, 0x2146, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2146, 0x63b2, 0xae5e, 0xae5e, 0xb67e, 0xb67e, 0xbe9e, 0xbe9e,
-  0xe73e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe75e, 0xbdf8, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a69, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe73e, 0xbe9e, 0xbe9e, 0xb67e, 0xb67e, 0xb65e, 0xae5e,
-  0xae5e, 0x957a, 0x7434, 0x5b70, 0x532f, 0x5b70, 0x7434, 0x957a, 0xae5e, 0xae5e, 0xb65e, 0xb67e,
-  0xb67e, 0xbe9e, 0xbe9e, 0xe73e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0x4a69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xd6fe, 0xbe9e,
-  0xbe9e, 0xbe9e, 0xb67e, 0xb67e, 0xb67e, 0xb65e, 0xae5e, 0xae5e, 0xae5e, 0xae5e, 0xae5e, 0xb65e,
-  0xb67e, 0xb67e, 0xb67e, 0xbe9e, 0xbe9e, 0xbe9e, 0xd6fe, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xc659, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xe75e, 0xc6be, 0xc6be, 0xbe9e, 0xbe9e, 0xbe9e, 0xb67e, 0xb67e, 0xb67e, 0xb67e,
-  0xb67e, 0xb67e, 0xb67e, 0xb67e, 0xb67e, 0xbe9e, 0xbe9e, 0xbe9e, 0xc6be, 0xc6be, 0xe75e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xc659, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xcede, 0xc6be, 0xc6be, 0xc6be, 0xbe9e,
-  0xbe9e, 0xbe9e, 0xbe9e, 0xbe9e, 0xbe9e, 0xbe9e, 0xbe9e, 0xbe9e, 0xbe9e, 0xbe9e, 0xc6be, 0xc6be,
-  0xc6be, 0xcede, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xcefe,
-  0xcede, 0xc6de, 0xc6be, 0xc6be, 0xc6be, 0xc6be, 0xcede, 0xd6fe, 0xd71e, 0xd6fe, 0xcede, 0xc6be,
-  0xc6be, 0xc6be, 0xc6be, 0xc6de, 0xcede, 0xcefe, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xce7a, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xe75e, 0xd6fe, 0xcefe, 0xcefe, 0xcede, 0xcede, 0xcede, 0xdf3e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xdf3e, 0xcede, 0xcede, 0xcede, 0xcefe, 0xcefe, 0xd6fe, 0xe75e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xce7a, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bf0, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe75e, 0xd71e, 0xd71e, 0xd6fe, 0xd6fe, 0xd6fe,
-  0xe77e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe77e, 0xd6fe, 0xd6fe, 0xd6fe,
-  0xd71e, 0xd71e, 0xe75e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0x7bf0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062,
-  0xd69a, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xdf3e, 0xdf3e,
-  0xdf1e, 0xdf1e, 0xd71e, 0xe75e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xe75e, 0xd71e, 0xdf1e, 0xdf1e, 0xdf3e, 0xdf3e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xd69a, 0x1062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x31a6, 0xd69a, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xe75e, 0xe75e, 0xe75e, 0xdf3e, 0xdf3e, 0xdf3e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xdf3e, 0xdf3e, 0xdf3e, 0xe75e, 0xe75e, 0xe75e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xd69a, 0x31a6, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062, 0x7bf0, 0xce7a,
-  0xef7e, 0xef7e, 0xc659, 0x73ae, 0x4a69, 0xbdf8, 0xef7e, 0xe75e, 0xe75e, 0xe75e, 0xe75e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe75e, 0xe75e,
-  0xe75e, 0xe75e, 0xef7e, 0xbdf8, 0x4a69, 0x73ae, 0xc659, 0xef7e, 0xef7e, 0xce7a, 0x7bf0, 0x1062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x528a, 0xad76,
-  0xef7e, 0xe75e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xe75e, 0xef7e, 0xad76, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0x6b6e, 0xc659, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xc659, 0x6b6e, 0x2124, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x2945, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x9d14, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0x9d14, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0xce59, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xce59, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c3, 0x9d14, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x9d14, 0x18c3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x632c, 0x7bcf, 0x632c, 0x2945, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000,
+static constexpr uint16_t kIcon_settings_Palette[63] = {
+  0x0000, 0x2945, 0x632C, 0x7BCF, 0x18C3, 0x9D14, 0xEF7E, 0xCE59, 0x2124, 0x6B6E, 0xC659, 0x0841, 0x528A, 0xAD76, 0xE75E, 0x1062,
+  0x7BF0, 0xCE7A, 0x73AE, 0x4A69, 0xBDF8, 0x31A6, 0xD69A, 0xDF3E, 0xDF1E, 0xD71E, 0xD6FE, 0xE77E, 0xCEFE, 0xCEDE, 0xC6DE, 0xC6BE,
+  0xBE9E, 0xB67E, 0xB65E, 0xAE5E, 0xE73E, 0x957A, 0x7434, 0x5B70, 0x532F, 0x63B2, 0x2146, 0x7C75, 0x1905, 0x1948, 0x2A2D, 0x328F,
+  0x5C9B, 0x755F, 0x4B75, 0x7D7F, 0x859F, 0x8DBF, 0x8DDF, 0x95FF, 0x9E1F, 0x95DF, 0xA61E, 0x6C13, 0x5B2F, 0x7CB7, 0x10A3
+};
+static constexpr uint8_t kIcon_settings_Rle[2268] = {
+  255, 0, 31, 0, 1, 1, 1, 2, 1, 3, 1, 2, 1, 1, 57, 0,
+  1, 4, 1, 5, 5, 6, 1, 5, 1, 4, 54, 0, 1, 4, 1, 7,
+  7, 6, 1, 7, 1, 4, 53, 0, 1, 5, 9, 6, 1, 5, 52, 0,
+  1, 1, 11, 6, 1, 1, 49, 0, 1, 8, 1, 9, 1, 10, 11, 6,
+  1, 10, 1, 9, 1, 8, 39, 0, 2, 11, 4, 0, 1, 12, 1, 13,
+  1, 6, 1, 14, 13, 6, 1, 14, 1, 6, 1, 13, 1, 12, 4, 0,
+  2, 11, 28, 0, 1, 15, 1, 16, 1, 17, 2, 6, 1, 10, 1, 18,
+  1, 19, 1, 20, 1, 6, 4, 14, 11, 6, 4, 14, 1, 6, 1, 20,
+  1, 19, 1, 18, 1, 10, 2, 6, 1, 17, 1, 16, 1, 15, 24, 0,
+  1, 21, 1, 22, 7, 6, 3, 14, 3, 23, 11, 6, 3, 23, 3, 14,
+  7, 6, 1, 22, 1, 21, 22, 0, 1, 15, 1, 22, 9, 6, 2, 23,
+  2, 24, 1, 25, 1, 14, 9, 6, 1, 14, 1, 25, 2, 24, 2, 23,
+  9, 6, 1, 22, 1, 15, 21, 0, 1, 16, 10, 6, 1, 14, 2, 25,
+  3, 26, 1, 27, 7, 6, 1, 27, 3, 26, 2, 25, 1, 14, 10, 6,
+  1, 16, 21, 0, 1, 17, 10, 6, 1, 14, 1, 26, 2, 28, 3, 29,
+  1, 23, 5, 6, 1, 23, 3, 29, 2, 28, 1, 26, 1, 14, 10, 6,
+  1, 17, 20, 0, 1, 11, 12, 6, 1, 28, 1, 29, 1, 30, 4, 31,
+  1, 29, 1, 26, 1, 25, 1, 26, 1, 29, 4, 31, 1, 30, 1, 29,
+  1, 28, 12, 6, 1, 11, 19, 0, 1, 11, 12, 6, 1, 29, 3, 31,
+  11, 32, 3, 31, 1, 29, 12, 6, 1, 11, 20, 0, 1, 10, 10, 6,
+  1, 14, 2, 31, 3, 32, 9, 33, 3, 32, 2, 31, 1, 14, 10, 6,
+  1, 10, 21, 0, 1, 18, 10, 6, 1, 26, 3, 32, 3, 33, 1, 34,
+  5, 35, 1, 34, 3, 33, 3, 32, 1, 26, 10, 6, 1, 18, 21, 0,
+  1, 19, 9, 6, 1, 36, 2, 32, 2, 33, 1, 34, 2, 35, 1, 37,
+  1, 38, 1, 39, 1, 40, 1, 39, 1, 38, 1, 37, 2, 35, 1, 34,
+  2, 33, 2, 32, 1, 36, 9, 6, 1, 19, 21, 0, 1, 20, 1, 14,
+  7, 6, 1, 36, 2, 32, 2, 33, 2, 35, 1, 41, 1, 42, 7, 0,
+  1, 42, 1, 41, 2, 35, 2, 33, 2, 32, 1, 36, 7, 6, 1, 14,
+  1, 20, 20, 0, 1, 12, 1, 6, 1, 14, 1, 23, 2, 14, 2, 6,
+  1, 14, 1, 26, 2, 32, 1, 33, 1, 34, 1, 35, 1, 43, 1, 44,
+  11, 0, 1, 44, 1, 43, 1, 35, 1, 34, 1, 33, 2, 32, 1, 26,
+  1, 14, 2, 6, 2, 14, 1, 23, 1, 14, 1, 6, 1, 12, 19, 0,
+  1, 13, 2, 14, 1, 23, 1, 25, 1, 26, 1, 28, 1, 29, 1, 31,
+  2, 32, 1, 33, 1, 34, 1, 35, 1, 39, 15, 0, 1, 39, 1, 35,
+  1, 34, 1, 33, 2, 32, 1, 31, 1, 29, 1, 28, 1, 26, 1, 25,
+  1, 23, 2, 14, 1, 13, 18, 0, 1, 8, 1, 6, 1, 14, 1, 23,
+  1, 24, 1, 25, 1, 28, 1, 29, 2, 31, 1, 32, 2, 33, 1, 35,
+  1, 39, 6, 0, 1, 45, 1, 46, 1, 47, 1, 46, 1, 45, 6, 0,
+  1, 39, 1, 35, 2, 33, 1, 32, 2, 31, 1, 29, 1, 28, 1, 25,
+  1, 24, 1, 23, 1, 14, 1, 6, 1, 8, 17, 0, 1, 9, 2, 14,
+  1, 23, 1, 24, 1, 26, 1, 28, 1, 30, 1, 31, 2, 32, 1, 33,
+  1, 35, 1, 43, 5, 0, 1, 46, 1, 48, 5, 49, 1, 48, 1, 46,
+  5, 0, 1, 43, 1, 35, 1, 33, 2, 32, 1, 31, 1, 30, 1, 28,
+  1, 26, 1, 24, 1, 23, 2, 14, 1, 9, 16, 0, 1, 1, 1, 10,
+  1, 6, 1, 14, 1, 23, 1, 25, 1, 26, 1, 29, 2, 31, 1, 32,
+  1, 33, 1, 34, 1, 35, 1, 44, 4, 0, 1, 50, 1, 49, 1, 51,
+  1, 52, 3, 53, 1, 52, 1, 51, 1, 49, 1, 50, 4, 0, 1, 44,
+  1, 35, 1, 34, 1, 33, 1, 32, 2, 31, 1, 29, 1, 26, 1, 25,
+  1, 23, 1, 14, 1, 6, 1, 10, 1, 1, 13, 0, 1, 4, 1, 5,
+  5, 6, 1, 14, 1, 26, 1, 29, 1, 31, 2, 32, 1, 33, 1, 35,
+  1, 41, 4, 0, 1, 50, 1, 49, 1, 52, 1, 54, 1, 55, 3, 56,
+  1, 55, 1, 54, 1, 52, 1, 49, 1, 50, 4, 0, 1, 41, 1, 35,
+  1, 33, 2, 32, 1, 31, 1, 29, 1, 26, 1, 14, 5, 6, 1, 5,
+  1, 4, 10, 0, 1, 4, 1, 7, 7, 6, 1, 27, 1, 29, 1, 31,
+  1, 32, 2, 33, 1, 35, 1, 42, 3, 0, 1, 46, 1, 49, 1, 52,
+  1, 57, 1, 56, 1, 58, 1, 59, 1, 60, 1, 59, 1, 58, 1, 56,
+  1, 57, 1, 52, 1, 49, 1, 46, 3, 0, 1, 42, 1, 35, 2, 33,
+  1, 32, 1, 31, 1, 29, 1, 27, 7, 6, 1, 7, 1, 4, 9, 0,
+  1, 5, 9, 6, 1, 23, 1, 31, 1, 32, 1, 33, 1, 34, 1, 37,
+  4, 0, 1, 48, 1, 51, 1, 54, 1, 56, 1, 61, 1, 62, 3, 0,
+  1, 62, 1, 61, 1, 56, 1, 54, 1, 51, 1, 48, 4, 0, 1, 37,
+  1, 34, 1, 33, 1, 32, 1, 31, 1, 23, 9, 6, 1, 5, 8, 0,
+  1, 1, 11, 6, 1, 29, 1, 32, 1, 33, 1, 35, 1, 38, 3, 0,
+  1, 45, 1, 49, 1, 52, 1, 55, 1, 58, 1, 62, 5, 0, 1, 62,
+  1, 58, 1, 55, 1, 52, 1, 49, 1, 45, 3, 0, 1, 38, 1, 35,
+  1, 33, 1, 32, 1, 29, 11, 6, 1, 1, 7, 0, 1, 2, 11, 6,
+  1, 26, 1, 32, 1, 33, 1, 35, 1, 39, 3, 0, 1, 46, 1, 49,
+  1, 53, 1, 56, 1, 59, 7, 0, 1, 59, 1, 56, 1, 53, 1, 49,
+  1, 46, 3, 0, 1, 39, 1, 35, 1, 33, 1, 32, 1, 26, 11, 6,
+  1, 2, 7, 0, 1, 3, 11, 6, 1, 25, 1, 32, 1, 33, 1, 35,
+  1, 40, 3, 0, 1, 47, 1, 49, 1, 53, 1, 56, 1, 60, 7, 0,
+  1, 60, 1, 56, 1, 53, 1, 49, 1, 47, 3, 0, 1, 40, 1, 35,
+  1, 33, 1, 32, 1, 25, 11, 6, 1, 3, 7, 0, 1, 2, 11, 6,
+  1, 26, 1, 32, 1, 33, 1, 35, 1, 39, 3, 0, 1, 46, 1, 49,
+  1, 53, 1, 56, 1, 59, 7, 0, 1, 59, 1, 56, 1, 53, 1, 49,
+  1, 46, 3, 0, 1, 39, 1, 35, 1, 33, 1, 32, 1, 26, 11, 6,
+  1, 2, 7, 0, 1, 1, 11, 6, 1, 29, 1, 32, 1, 33, 1, 35,
+  1, 38, 3, 0, 1, 45, 1, 49, 1, 52, 1, 55, 1, 58, 1, 62,
+  5, 0, 1, 62, 1, 58, 1, 55, 1, 52, 1, 49, 1, 45, 3, 0,
+  1, 38, 1, 35, 1, 33, 1, 32, 1, 29, 11, 6, 1, 1, 8, 0,
+  1, 5, 9, 6, 1, 23, 1, 31, 1, 32, 1, 33, 1, 34, 1, 37,
+  4, 0, 1, 48, 1, 51, 1, 54, 1, 56, 1, 61, 1, 62, 3, 0,
+  1, 62, 1, 61, 1, 56, 1, 54, 1, 51, 1, 48, 4, 0, 1, 37,
+  1, 34, 1, 33, 1, 32, 1, 31, 1, 23, 9, 6, 1, 5, 9, 0,
+  1, 4, 1, 7, 7, 6, 1, 27, 1, 29, 1, 31, 1, 32, 2, 33,
+  1, 35, 1, 42, 3, 0, 1, 46, 1, 49, 1, 52, 1, 57, 1, 56,
+  1, 58, 1, 59, 1, 60, 1, 59, 1, 58, 1, 56, 1, 57, 1, 52,
+  1, 49, 1, 46, 3, 0, 1, 42, 1, 35, 2, 33, 1, 32, 1, 31,
+  1, 29, 1, 27, 7, 6, 1, 7, 1, 4, 10, 0, 1, 4, 1, 5,
+  5, 6, 1, 14, 1, 26, 1, 29, 1, 31, 2, 32, 1, 33, 1, 35,
+  1, 41, 4, 0, 1, 50, 1, 49, 1, 52, 1, 54, 1, 55, 3, 56,
+  1, 55, 1, 54, 1, 52, 1, 49, 1, 50, 4, 0, 1, 41, 1, 35,
+  1, 33, 2, 32, 1, 31, 1, 29, 1, 26, 1, 14, 5, 6, 1, 5,
+  1, 4, 13, 0, 1, 1, 1, 10, 1, 6, 1, 14, 1, 23, 1, 25,
+  1, 26, 1, 29, 2, 31, 1, 32, 1, 33, 1, 34, 1, 35, 1, 44,
+  4, 0, 1, 50, 1, 49, 1, 51, 1, 52, 3, 53, 1, 52, 1, 51,
+  1, 49, 1, 50, 4, 0, 1, 44, 1, 35, 1, 34, 1, 33, 1, 32,
+  2, 31, 1, 29, 1, 26, 1, 25, 1, 23, 1, 14, 1, 6, 1, 10,
+  1, 1, 16, 0, 1, 9, 2, 14, 1, 23, 1, 24, 1, 26, 1, 28,
+  1, 30, 1, 31, 2, 32, 1, 33, 1, 35, 1, 43, 5, 0, 1, 46,
+  1, 48, 5, 49, 1, 48, 1, 46, 5, 0, 1, 43, 1, 35, 1, 33,
+  2, 32, 1, 31, 1, 30, 1, 28, 1, 26, 1, 24, 1, 23, 2, 14,
+  1, 9, 17, 0, 1, 8, 1, 6, 1, 14, 1, 23, 1, 24, 1, 25,
+  1, 28, 1, 29, 2, 31, 1, 32, 2, 33, 1, 35, 1, 39, 6, 0,
+  1, 45, 1, 46, 1, 47, 1, 46, 1, 45, 6, 0, 1, 39, 1, 35,
+  2, 33, 1, 32, 2, 31, 1, 29, 1, 28, 1, 25, 1, 24, 1, 23,
+  1, 14, 1, 6, 1, 8, 18, 0, 1, 13, 2, 14, 1, 23, 1, 25,
+  1, 26, 1, 28, 1, 29, 1, 31, 2, 32, 1, 33, 1, 34, 1, 35,
+  1, 39, 15, 0, 1, 39, 1, 35, 1, 34, 1, 33, 2, 32, 1, 31,
+  1, 29, 1, 28, 1, 26, 1, 25, 1, 23, 2, 14, 1, 13, 19, 0,
+  1, 12, 1, 6, 1, 14, 1, 23, 2, 14, 2, 6, 1, 14, 1, 26,
+  2, 32, 1, 33, 1, 34, 1, 35, 1, 43, 1, 44, 11, 0, 1, 44,
+  1, 43, 1, 35, 1, 34, 1, 33, 2, 32, 1, 26, 1, 14, 2, 6,
+  2, 14, 1, 23, 1, 14, 1, 6, 1, 12, 20, 0, 1, 20, 1, 14,
+  7, 6, 1, 36, 2, 32, 2, 33, 2, 35, 1, 41, 1, 42, 7, 0,
+  1, 42, 1, 41, 2, 35, 2, 33, 2, 32, 1, 36, 7, 6, 1, 14,
+  1, 20, 21, 0, 1, 19, 9, 6, 1, 36, 2, 32, 2, 33, 1, 34,
+  2, 35, 1, 37, 1, 38, 1, 39, 1, 40, 1, 39, 1, 38, 1, 37,
+  2, 35, 1, 34, 2, 33, 2, 32, 1, 36, 9, 6, 1, 19, 21, 0,
+  1, 18, 10, 6, 1, 26, 3, 32, 3, 33, 1, 34, 5, 35, 1, 34,
+  3, 33, 3, 32, 1, 26, 10, 6, 1, 18, 21, 0, 1, 10, 10, 6,
+  1, 14, 2, 31, 3, 32, 9, 33, 3, 32, 2, 31, 1, 14, 10, 6,
+  1, 10, 20, 0, 1, 11, 12, 6, 1, 29, 3, 31, 11, 32, 3, 31,
+  1, 29, 12, 6, 1, 11, 19, 0, 1, 11, 12, 6, 1, 28, 1, 29,
+  1, 30, 4, 31, 1, 29, 1, 26, 1, 25, 1, 26, 1, 29, 4, 31,
+  1, 30, 1, 29, 1, 28, 12, 6, 1, 11, 20, 0, 1, 17, 10, 6,
+  1, 14, 1, 26, 2, 28, 3, 29, 1, 23, 5, 6, 1, 23, 3, 29,
+  2, 28, 1, 26, 1, 14, 10, 6, 1, 17, 21, 0, 1, 16, 10, 6,
+  1, 14, 2, 25, 3, 26, 1, 27, 7, 6, 1, 27, 3, 26, 2, 25,
+  1, 14, 10, 6, 1, 16, 21, 0, 1, 15, 1, 22, 9, 6, 2, 23,
+  2, 24, 1, 25, 1, 14, 9, 6, 1, 14, 1, 25, 2, 24, 2, 23,
+  9, 6, 1, 22, 1, 15, 22, 0, 1, 21, 1, 22, 7, 6, 3, 14,
+  3, 23, 11, 6, 3, 23, 3, 14, 7, 6, 1, 22, 1, 21, 24, 0,
+  1, 15, 1, 16, 1, 17, 2, 6, 1, 10, 1, 18, 1, 19, 1, 20,
+  1, 6, 4, 14, 11, 6, 4, 14, 1, 6, 1, 20, 1, 19, 1, 18,
+  1, 10, 2, 6, 1, 17, 1, 16, 1, 15, 28, 0, 2, 11, 4, 0,
+  1, 12, 1, 13, 1, 6, 1, 14, 13, 6, 1, 14, 1, 6, 1, 13,
+  1, 12, 4, 0, 2, 11, 39, 0, 1, 8, 1, 9, 1, 10, 11, 6,
+  1, 10, 1, 9, 1, 8, 49, 0, 1, 1, 11, 6, 1, 1, 52, 0,
+  1, 5, 9, 6, 1, 5, 53, 0, 1, 4, 1, 7, 7, 6, 1, 7,
+  1, 4, 54, 0, 1, 4, 1, 5, 5, 6, 1, 5, 1, 4, 57, 0,
+  1, 1, 1, 2, 1, 3, 1, 2, 1, 1, 221, 0
 };
+static constexpr CompressedIcon kIcon_settings{64, 64, kIcon_settings_Palette, 63, kIcon_settings_Rle, 2268};
 
 static constexpr int kIcon_bounds_W = 64;
 static constexpr int kIcon_bounds_H = 64;
-static const uint16_t kIcon_bounds[4096] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xdedb, 0xef7e, 0xdedb, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xef7e,
-  0xef7e, 0xef7e, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x7bf0, 0xef7e, 0xef7e, 0xef7e, 0x7bf0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bf0, 0xef7e, 0xef7e, 0xef7e, 0x7bf0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4229, 0x7bcf, 0xa514, 0xc618, 0xe73c, 0xef7e,
-  0xef7e, 0xef7e, 0xe73c, 0xc618, 0xa514, 0x7bcf, 0x4229, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5acb, 0xa555, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xa555, 0x5acb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062, 0x7bcf, 0xdedb, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x7bcf, 0x1062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d,
-  0xdf1c, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xbdf8, 0x8431, 0x52ab, 0x3186, 0x8c51, 0xef7e,
-  0xef7e, 0xef7e, 0x8c51, 0x3186, 0x52ab, 0x8431, 0xbdf8, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xdf1c, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3166, 0xb5b7, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xce59, 0x738e, 0x2104, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x8410, 0xef7e, 0xef7e, 0xef7e, 0x8410, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104,
-  0x738e, 0xce59, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xb5b7, 0x3166, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5aeb, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xc639, 0x52ab, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8410, 0xef7e, 0xef7e, 0xef7e, 0x8410, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52ab, 0xc639, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0x5aeb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0x738e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8410, 0xef7e,
-  0xef7e, 0xef7e, 0x8410, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x738e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8410, 0xef7e,
-  0xef7e, 0xef7e, 0xbdf8, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x8410, 0xef7e, 0xef7e, 0xef7e, 0x8410, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0xbdf8, 0xef7e, 0xef7e, 0xef7e, 0x8410, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x7bcf, 0xef7e, 0xef7e, 0xef7e, 0xa514, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x1927, 0x94f5, 0xef7e, 0xef7e, 0xef7e, 0x94f5, 0x1927,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821, 0xa514,
-  0xef7e, 0xef7e, 0xef7e, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5aeb, 0xef7e, 0xef7e, 0xef7e, 0x94b3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x2a0d, 0x4bb7, 0x651f, 0x651f, 0xae5e, 0xef7e,
-  0xef7e, 0xef7e, 0xae5e, 0x651f, 0x651f, 0x4bb7, 0x2a0d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x94b3, 0xef7e, 0xef7e, 0xef7e, 0x5aeb, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3166, 0xef7e, 0xef7e, 0xef7e, 0xa514,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x328f, 0x5cbd, 0x651f, 0x651f,
-  0x651f, 0x53f9, 0x9d79, 0xef7e, 0xef7e, 0xef7e, 0x9d79, 0x53f9, 0x651f, 0x651f, 0x651f, 0x5cbd,
-  0x328f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa514, 0xef7e, 0xef7e,
-  0xef7e, 0x3166, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb5b7,
-  0xef7e, 0xef7e, 0xbdf8, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2189, 0x545b,
-  0x651f, 0x651f, 0x4bb7, 0x21cb, 0x0842, 0x0000, 0x8410, 0xef7e, 0xef7e, 0xef7e, 0x8410, 0x0000,
-  0x0842, 0x21cb, 0x4bb7, 0x651f, 0x651f, 0x545b, 0x2189, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0821, 0xbdf8, 0xef7e, 0xef7e, 0xb5b7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x6b4d, 0xef7e, 0xef7e, 0xef7e, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x326f, 0x651f, 0x651f, 0x4bd8, 0x1948, 0x0000, 0x0000, 0x0000, 0x0000, 0x8410, 0xef7e,
-  0xef7e, 0xef7e, 0x8410, 0x0000, 0x0000, 0x0000, 0x0000, 0x1948, 0x4bd8, 0x651f, 0x651f, 0x326f,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0xef7e, 0xef7e, 0xef7e, 0x6b4d, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062, 0xdf1c, 0xef7e, 0xef7e, 0x738e, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x32b0, 0x651f, 0x651f, 0x328f, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x7bf0, 0xef7e, 0xef7e, 0xef7e, 0x7bf0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x328f, 0x651f, 0x651f, 0x32b0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738e,
-  0xef7e, 0xef7e, 0xdf1c, 0x1062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xef7e, 0xef7e,
-  0xc639, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x326f, 0x651f, 0x651f, 0x21cb, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bf0, 0xef7e, 0xef7e, 0xef7e, 0x7bf0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21cb, 0x651f, 0x651f, 0x326f, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xc639, 0xef7e, 0xef7e, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xdedb, 0xef7e, 0xef7e, 0x52ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2189, 0x651f,
-  0x651f, 0x21cb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xef7e,
-  0xef7e, 0xef7e, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21cb,
-  0x651f, 0x651f, 0x2189, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52ab, 0xef7e, 0xef7e, 0xdedb,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5acb, 0xef7e, 0xef7e, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x545b, 0x651f, 0x328f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0xdedb, 0xef7e, 0xdedb, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x328f, 0x651f, 0x545b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xce59, 0xef7e, 0xef7e, 0x5acb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa555, 0xef7e, 0xef7e, 0x738e,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x328f, 0x651f, 0x4bd8, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4bd8, 0x651f, 0x328f,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738e, 0xef7e, 0xef7e, 0xa555, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841,
-  0xef7e, 0xef7e, 0xef7e, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x5cbd, 0x651f, 0x1948,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1948, 0x651f, 0x5cbd, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xef7e, 0xef7e,
-  0xef7e, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x4229, 0xef7e, 0xef7e, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2a0d, 0x651f, 0x4bb7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4bb7, 0x651f, 0x2a0d, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xbdf8, 0xef7e, 0xef7e, 0x4229, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xef7e, 0xef7e, 0x8431, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4bb7, 0x651f, 0x21cb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0x6124, 0x7965, 0x6124, 0x2041, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21cb, 0x651f,
-  0x4bb7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8431, 0xef7e, 0xef7e, 0x7bcf, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa514,
-  0xef7e, 0xef7e, 0x52ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x651f, 0x651f, 0x0842, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7965, 0xfb0c, 0xfb2c,
-  0xfb2c, 0xfb2c, 0xfb0c, 0x7965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0842, 0x651f, 0x651f, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x52ab, 0xef7e,
-  0xef7e, 0xa514, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xc618, 0xef7e, 0xef7e, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x1927,
-  0x651f, 0x53f9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x7965, 0xfb0c, 0xfb4d, 0xfb8e, 0xfb8e, 0xfb8e, 0xfb4d, 0xfb0c, 0x7965, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x53f9, 0x651f, 0x1927, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0xef7e, 0xef7e, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x630c, 0x7bf0, 0x7bf0, 0xe73c, 0xef7e, 0xef7e, 0x8c51, 0x8410,
-  0x8410, 0x8410, 0x8410, 0x94f5, 0xae5e, 0x9d79, 0x8410, 0x8410, 0x7bf0, 0x7bf0, 0x630c, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x2041, 0xfb0c, 0xfb4d, 0xfbae, 0xfbcf, 0xfbef, 0xfbcf, 0xfbae, 0xfb4d,
-  0xfb0c, 0x2041, 0x0000, 0x0000, 0x0000, 0x0020, 0x630c, 0x7bf0, 0x7bf0, 0x8410, 0x8410, 0x9d79,
-  0xae5e, 0x94f5, 0x8410, 0x8410, 0x8410, 0x8410, 0x8c51, 0xef7e, 0xef7e, 0xe73c, 0x7bf0, 0x7bf0,
-  0x630c, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0020, 0x0000, 0x0000, 0x6124, 0xfb2c, 0xfb8e, 0xfbcf, 0xfc30,
-  0xfc51, 0xfc30, 0xfbcf, 0xfb8e, 0xfb2c, 0x6124, 0x0000, 0x0000, 0x0020, 0xdedb, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x0020, 0x0000, 0x0000, 0x0000, 0x39e7, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x39e7, 0x0000, 0x0000, 0x7965,
-  0xfb2c, 0xfb8e, 0xfbef, 0xfc51, 0xfcb2, 0xfc51, 0xfbef, 0xfb8e, 0xfb2c, 0x7965, 0x0000, 0x0000,
-  0x39e7, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x39e7, 0x0000,
-  0x0000, 0x0000, 0x0020, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xdedb,
-  0x0020, 0x0000, 0x0000, 0x6124, 0xfb2c, 0xfb8e, 0xfbcf, 0xfc30, 0xfc51, 0xfc30, 0xfbcf, 0xfb8e,
-  0xfb2c, 0x6124, 0x0000, 0x0000, 0x0020, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xdedb, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x630c, 0x7bf0, 0x7bf0, 0xe73c,
-  0xef7e, 0xef7e, 0x8c51, 0x8410, 0x8410, 0x8410, 0x8410, 0x94f5, 0xae5e, 0x9d79, 0x8410, 0x8410,
-  0x7bf0, 0x7bf0, 0x630c, 0x0020, 0x0000, 0x0000, 0x0000, 0x2041, 0xfb0c, 0xfb4d, 0xfbae, 0xfbcf,
-  0xfbef, 0xfbcf, 0xfbae, 0xfb4d, 0xfb0c, 0x2041, 0x0000, 0x0000, 0x0000, 0x0020, 0x630c, 0x7bf0,
-  0x7bf0, 0x8410, 0x8410, 0x9d79, 0xae5e, 0x94f5, 0x8410, 0x8410, 0x8410, 0x8410, 0x8c51, 0xef7e,
-  0xef7e, 0xe73c, 0x7bf0, 0x7bf0, 0x630c, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xc618, 0xef7e, 0xef7e, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x1927,
-  0x651f, 0x53f9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x7965, 0xfb0c, 0xfb4d, 0xfb8e, 0xfb8e, 0xfb8e, 0xfb4d, 0xfb0c, 0x7965, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x53f9, 0x651f, 0x1927, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0xef7e, 0xef7e, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa514, 0xef7e, 0xef7e, 0x52ab, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x651f, 0x651f, 0x0842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7965, 0xfb0c, 0xfb2c, 0xfb2c, 0xfb2c, 0xfb0c, 0x7965,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842, 0x651f,
-  0x651f, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x52ab, 0xef7e, 0xef7e, 0xa514, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf,
-  0xef7e, 0xef7e, 0x8431, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4bb7, 0x651f, 0x21cb, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0x6124,
-  0x7965, 0x6124, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x21cb, 0x651f, 0x4bb7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8431, 0xef7e,
-  0xef7e, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x4229, 0xef7e, 0xef7e, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2a0d, 0x651f, 0x4bb7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4bb7, 0x651f, 0x2a0d, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xbdf8, 0xef7e, 0xef7e, 0x4229, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xef7e, 0xef7e, 0xef7e, 0x2104,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x5cbd, 0x651f, 0x1948, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1948, 0x651f, 0x5cbd,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xef7e, 0xef7e, 0xef7e, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xa555, 0xef7e, 0xef7e, 0x738e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x328f, 0x651f, 0x4bd8,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x39e7, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4bd8, 0x651f, 0x328f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738e, 0xef7e, 0xef7e,
-  0xa555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5acb, 0xef7e, 0xef7e, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x545b, 0x651f, 0x328f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0xdedb, 0xef7e, 0xdedb, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x328f, 0x651f, 0x545b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xce59, 0xef7e, 0xef7e, 0x5acb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7e, 0xef7e,
-  0x52ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2189, 0x651f, 0x651f, 0x21cb, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xef7e, 0xef7e, 0xef7e, 0x630c, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21cb, 0x651f, 0x651f, 0x2189, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x52ab, 0xef7e, 0xef7e, 0xdedb, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x7bcf, 0xef7e, 0xef7e, 0xc639, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x326f,
-  0x651f, 0x651f, 0x21cb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bf0, 0xef7e,
-  0xef7e, 0xef7e, 0x7bf0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21cb, 0x651f,
-  0x651f, 0x326f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc639, 0xef7e, 0xef7e, 0x7bcf,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062, 0xdf1c, 0xef7e, 0xef7e, 0x738e, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x32b0, 0x651f, 0x651f, 0x328f, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x7bf0, 0xef7e, 0xef7e, 0xef7e, 0x7bf0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x328f, 0x651f, 0x651f, 0x32b0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738e,
-  0xef7e, 0xef7e, 0xdf1c, 0x1062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xef7e,
-  0xef7e, 0xef7e, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x326f, 0x651f, 0x651f,
-  0x4bd8, 0x1948, 0x0000, 0x0000, 0x0000, 0x0000, 0x8410, 0xef7e, 0xef7e, 0xef7e, 0x8410, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1948, 0x4bd8, 0x651f, 0x651f, 0x326f, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0xef7e, 0xef7e, 0xef7e, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xb5b7, 0xef7e, 0xef7e, 0xbdf8, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2189, 0x545b, 0x651f, 0x651f, 0x4bb7, 0x21cb, 0x0842, 0x0000, 0x8410, 0xef7e,
-  0xef7e, 0xef7e, 0x8410, 0x0000, 0x0842, 0x21cb, 0x4bb7, 0x651f, 0x651f, 0x545b, 0x2189, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821, 0xbdf8, 0xef7e, 0xef7e, 0xb5b7, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3166, 0xef7e, 0xef7e, 0xef7e, 0xa514,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x328f, 0x5cbd, 0x651f, 0x651f,
-  0x651f, 0x53f9, 0x9d79, 0xef7e, 0xef7e, 0xef7e, 0x9d79, 0x53f9, 0x651f, 0x651f, 0x651f, 0x5cbd,
-  0x328f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa514, 0xef7e, 0xef7e,
-  0xef7e, 0x3166, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5aeb, 0xef7e, 0xef7e, 0xef7e, 0x94b3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x2a0d, 0x4bb7, 0x651f, 0x651f, 0xae5e, 0xef7e, 0xef7e, 0xef7e, 0xae5e, 0x651f,
-  0x651f, 0x4bb7, 0x2a0d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x94b3, 0xef7e, 0xef7e, 0xef7e, 0x5aeb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xef7e, 0xef7e, 0xef7e, 0xa514, 0x0821, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x1927, 0x94f5, 0xef7e,
-  0xef7e, 0xef7e, 0x94f5, 0x1927, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0821, 0xa514, 0xef7e, 0xef7e, 0xef7e, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8410, 0xef7e,
-  0xef7e, 0xef7e, 0xbdf8, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x8410, 0xef7e, 0xef7e, 0xef7e, 0x8410, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0xbdf8, 0xef7e, 0xef7e, 0xef7e, 0x8410, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x7bcf, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x738e, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8410, 0xef7e, 0xef7e, 0xef7e, 0x8410, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5aeb, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xc639, 0x52ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8410, 0xef7e,
-  0xef7e, 0xef7e, 0x8410, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52ab, 0xc639,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x5aeb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3166, 0xb5b7, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xce59, 0x738e, 0x2104, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x8410, 0xef7e, 0xef7e, 0xef7e, 0x8410, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104,
-  0x738e, 0xce59, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xb5b7, 0x3166, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xdf1c, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xbdf8, 0x8431, 0x52ab, 0x3186, 0x8c51, 0xef7e, 0xef7e, 0xef7e, 0x8c51, 0x3186,
-  0x52ab, 0x8431, 0xbdf8, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xdf1c, 0x6b4d, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1062, 0x7bcf, 0xdedb, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xdedb, 0x7bcf,
-  0x1062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5acb, 0xa555, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xa555, 0x5acb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0841, 0x4229, 0x7bcf, 0xa514, 0xc618, 0xe73c, 0xef7e, 0xef7e, 0xef7e, 0xe73c, 0xc618,
-  0xa514, 0x7bcf, 0x4229, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bf0, 0xef7e,
-  0xef7e, 0xef7e, 0x7bf0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x7bf0, 0xef7e, 0xef7e, 0xef7e, 0x7bf0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xef7e, 0xef7e, 0xef7e, 0x630c, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xdedb,
-  0xef7e, 0xdedb, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000,
+static constexpr uint16_t kIcon_bounds_Palette[65] = {
+  0x0000, 0x0020, 0x39E7, 0xDEDB, 0xEF7E, 0x630C, 0x7BF0, 0x0841, 0x4229, 0x7BCF, 0xA514, 0xC618, 0xE73C, 0x5ACB, 0xA555, 0x1062,
+  0x6B4D, 0xDF1C, 0xBDF8, 0x8431, 0x52AB, 0x3186, 0x8C51, 0x3166, 0xB5B7, 0xCE59, 0x738E, 0x2104, 0x8410, 0x5AEB, 0xC639, 0x0821,
+  0x0021, 0x1927, 0x94F5, 0x94B3, 0x2A0D, 0x4BB7, 0x651F, 0xAE5E, 0x328F, 0x5CBD, 0x53F9, 0x9D79, 0x2189, 0x545B, 0x21CB, 0x0842,
+  0x326F, 0x4BD8, 0x1948, 0x32B0, 0x2041, 0x6124, 0x7965, 0xFB0C, 0xFB2C, 0xFB4D, 0xFB8E, 0xFBAE, 0xFBCF, 0xFBEF, 0xFC30, 0xFC51,
+  0xFCB2
 };
+static constexpr uint8_t kIcon_bounds_Rle[2066] = {
+  159, 0, 1, 1, 1, 2, 1, 1, 60, 0, 1, 1, 1, 3, 1, 4,
+  1, 3, 1, 1, 59, 0, 1, 5, 3, 4, 1, 5, 59, 0, 1, 6,
+  3, 4, 1, 6, 59, 0, 1, 6, 3, 4, 1, 6, 54, 0, 1, 7,
+  1, 8, 1, 9, 1, 10, 1, 11, 1, 12, 3, 4, 1, 12, 1, 11,
+  1, 10, 1, 9, 1, 8, 1, 7, 47, 0, 1, 13, 1, 14, 15, 4,
+  1, 14, 1, 13, 42, 0, 1, 15, 1, 9, 1, 3, 19, 4, 1, 3,
+  1, 9, 1, 15, 38, 0, 1, 16, 1, 17, 5, 4, 1, 18, 1, 19,
+  1, 20, 1, 21, 1, 22, 3, 4, 1, 22, 1, 21, 1, 20, 1, 19,
+  1, 18, 5, 4, 1, 17, 1, 16, 35, 0, 1, 23, 1, 24, 4, 4,
+  1, 25, 1, 26, 1, 27, 4, 0, 1, 28, 3, 4, 1, 28, 4, 0,
+  1, 27, 1, 26, 1, 25, 4, 4, 1, 24, 1, 23, 32, 0, 1, 29,
+  4, 4, 1, 30, 1, 20, 7, 0, 1, 28, 3, 4, 1, 28, 7, 0,
+  1, 20, 1, 30, 4, 4, 1, 29, 30, 0, 1, 9, 4, 4, 1, 26,
+  9, 0, 1, 28, 3, 4, 1, 28, 9, 0, 1, 26, 4, 4, 1, 9,
+  28, 0, 1, 28, 3, 4, 1, 18, 1, 21, 10, 0, 1, 28, 3, 4,
+  1, 28, 10, 0, 1, 21, 1, 18, 3, 4, 1, 28, 26, 0, 1, 9,
+  3, 4, 1, 10, 1, 31, 9, 0, 1, 32, 1, 33, 1, 34, 3, 4,
+  1, 34, 1, 33, 1, 32, 9, 0, 1, 31, 1, 10, 3, 4, 1, 9,
+  24, 0, 1, 29, 3, 4, 1, 35, 8, 0, 1, 32, 1, 36, 1, 37,
+  2, 38, 1, 39, 3, 4, 1, 39, 2, 38, 1, 37, 1, 36, 1, 32,
+  8, 0, 1, 35, 3, 4, 1, 29, 22, 0, 1, 23, 3, 4, 1, 10,
+  8, 0, 1, 40, 1, 41, 3, 38, 1, 42, 1, 43, 3, 4, 1, 43,
+  1, 42, 3, 38, 1, 41, 1, 40, 8, 0, 1, 10, 3, 4, 1, 23,
+  21, 0, 1, 24, 2, 4, 1, 18, 1, 31, 6, 0, 1, 44, 1, 45,
+  2, 38, 1, 37, 1, 46, 1, 47, 1, 0, 1, 28, 3, 4, 1, 28,
+  1, 0, 1, 47, 1, 46, 1, 37, 2, 38, 1, 45, 1, 44, 6, 0,
+  1, 31, 1, 18, 2, 4, 1, 24, 20, 0, 1, 16, 3, 4, 1, 21,
+  6, 0, 1, 48, 2, 38, 1, 49, 1, 50, 4, 0, 1, 28, 3, 4,
+  1, 28, 4, 0, 1, 50, 1, 49, 2, 38, 1, 48, 6, 0, 1, 21,
+  3, 4, 1, 16, 18, 0, 1, 15, 1, 17, 2, 4, 1, 26, 6, 0,
+  1, 51, 2, 38, 1, 40, 6, 0, 1, 6, 3, 4, 1, 6, 6, 0,
+  1, 40, 2, 38, 1, 51, 6, 0, 1, 26, 2, 4, 1, 17, 1, 15,
+  17, 0, 1, 9, 2, 4, 1, 30, 6, 0, 1, 48, 2, 38, 1, 46,
+  7, 0, 1, 6, 3, 4, 1, 6, 7, 0, 1, 46, 2, 38, 1, 48,
+  6, 0, 1, 30, 2, 4, 1, 9, 17, 0, 1, 3, 2, 4, 1, 20,
+  5, 0, 1, 44, 2, 38, 1, 46, 8, 0, 1, 5, 3, 4, 1, 5,
+  8, 0, 1, 46, 2, 38, 1, 44, 5, 0, 1, 20, 2, 4, 1, 3,
+  16, 0, 1, 13, 2, 4, 1, 25, 6, 0, 1, 45, 1, 38, 1, 40,
+  9, 0, 1, 1, 1, 3, 1, 4, 1, 3, 1, 1, 9, 0, 1, 40,
+  1, 38, 1, 45, 6, 0, 1, 25, 2, 4, 1, 13, 15, 0, 1, 14,
+  2, 4, 1, 26, 5, 0, 1, 40, 1, 38, 1, 49, 11, 0, 1, 1,
+  1, 2, 1, 1, 11, 0, 1, 49, 1, 38, 1, 40, 5, 0, 1, 26,
+  2, 4, 1, 14, 14, 0, 1, 7, 3, 4, 1, 27, 4, 0, 1, 32,
+  1, 41, 1, 38, 1, 50, 25, 0, 1, 50, 1, 38, 1, 41, 1, 32,
+  4, 0, 1, 27, 3, 4, 1, 7, 13, 0, 1, 8, 2, 4, 1, 18,
+  5, 0, 1, 36, 1, 38, 1, 37, 27, 0, 1, 37, 1, 38, 1, 36,
+  5, 0, 1, 18, 2, 4, 1, 8, 13, 0, 1, 9, 2, 4, 1, 19,
+  5, 0, 1, 37, 1, 38, 1, 46, 11, 0, 1, 52, 1, 53, 1, 54,
+  1, 53, 1, 52, 11, 0, 1, 46, 1, 38, 1, 37, 5, 0, 1, 19,
+  2, 4, 1, 9, 13, 0, 1, 10, 2, 4, 1, 20, 4, 0, 1, 32,
+  2, 38, 1, 47, 10, 0, 1, 54, 1, 55, 3, 56, 1, 55, 1, 54,
+  10, 0, 1, 47, 2, 38, 1, 32, 4, 0, 1, 20, 2, 4, 1, 10,
+  13, 0, 1, 11, 2, 4, 1, 21, 4, 0, 1, 33, 1, 38, 1, 42,
+  10, 0, 1, 54, 1, 55, 1, 57, 3, 58, 1, 57, 1, 55, 1, 54,
+  10, 0, 1, 42, 1, 38, 1, 33, 4, 0, 1, 21, 2, 4, 1, 11,
+  9, 0, 1, 1, 1, 5, 2, 6, 1, 12, 2, 4, 1, 22, 4, 28,
+  1, 34, 1, 39, 1, 43, 2, 28, 2, 6, 1, 5, 1, 1, 3, 0,
+  1, 52, 1, 55, 1, 57, 1, 59, 1, 60, 1, 61, 1, 60, 1, 59,
+  1, 57, 1, 55, 1, 52, 3, 0, 1, 1, 1, 5, 2, 6, 2, 28,
+  1, 43, 1, 39, 1, 34, 4, 28, 1, 22, 2, 4, 1, 12, 2, 6,
+  1, 5, 1, 1, 4, 0, 1, 1, 1, 3, 19, 4, 1, 3, 1, 1,
+  2, 0, 1, 53, 1, 56, 1, 58, 1, 60, 1, 62, 1, 63, 1, 62,
+  1, 60, 1, 58, 1, 56, 1, 53, 2, 0, 1, 1, 1, 3, 19, 4,
+  1, 3, 1, 1, 3, 0, 1, 2, 21, 4, 1, 2, 2, 0, 1, 54,
+  1, 56, 1, 58, 1, 61, 1, 63, 1, 64, 1, 63, 1, 61, 1, 58,
+  1, 56, 1, 54, 2, 0, 1, 2, 21, 4, 1, 2, 3, 0, 1, 1,
+  1, 3, 19, 4, 1, 3, 1, 1, 2, 0, 1, 53, 1, 56, 1, 58,
+  1, 60, 1, 62, 1, 63, 1, 62, 1, 60, 1, 58, 1, 56, 1, 53,
+  2, 0, 1, 1, 1, 3, 19, 4, 1, 3, 1, 1, 4, 0, 1, 1,
+  1, 5, 2, 6, 1, 12, 2, 4, 1, 22, 4, 28, 1, 34, 1, 39,
+  1, 43, 2, 28, 2, 6, 1, 5, 1, 1, 3, 0, 1, 52, 1, 55,
+  1, 57, 1, 59, 1, 60, 1, 61, 1, 60, 1, 59, 1, 57, 1, 55,
+  1, 52, 3, 0, 1, 1, 1, 5, 2, 6, 2, 28, 1, 43, 1, 39,
+  1, 34, 4, 28, 1, 22, 2, 4, 1, 12, 2, 6, 1, 5, 1, 1,
+  9, 0, 1, 11, 2, 4, 1, 21, 4, 0, 1, 33, 1, 38, 1, 42,
+  10, 0, 1, 54, 1, 55, 1, 57, 3, 58, 1, 57, 1, 55, 1, 54,
+  10, 0, 1, 42, 1, 38, 1, 33, 4, 0, 1, 21, 2, 4, 1, 11,
+  13, 0, 1, 10, 2, 4, 1, 20, 4, 0, 1, 32, 2, 38, 1, 47,
+  10, 0, 1, 54, 1, 55, 3, 56, 1, 55, 1, 54, 10, 0, 1, 47,
+  2, 38, 1, 32, 4, 0, 1, 20, 2, 4, 1, 10, 13, 0, 1, 9,
+  2, 4, 1, 19, 5, 0, 1, 37, 1, 38, 1, 46, 11, 0, 1, 52,
+  1, 53, 1, 54, 1, 53, 1, 52, 11, 0, 1, 46, 1, 38, 1, 37,
+  5, 0, 1, 19, 2, 4, 1, 9, 13, 0, 1, 8, 2, 4, 1, 18,
+  5, 0, 1, 36, 1, 38, 1, 37, 27, 0, 1, 37, 1, 38, 1, 36,
+  5, 0, 1, 18, 2, 4, 1, 8, 13, 0, 1, 7, 3, 4, 1, 27,
+  4, 0, 1, 32, 1, 41, 1, 38, 1, 50, 25, 0, 1, 50, 1, 38,
+  1, 41, 1, 32, 4, 0, 1, 27, 3, 4, 1, 7, 14, 0, 1, 14,
+  2, 4, 1, 26, 5, 0, 1, 40, 1, 38, 1, 49, 11, 0, 1, 1,
+  1, 2, 1, 1, 11, 0, 1, 49, 1, 38, 1, 40, 5, 0, 1, 26,
+  2, 4, 1, 14, 15, 0, 1, 13, 2, 4, 1, 25, 6, 0, 1, 45,
+  1, 38, 1, 40, 9, 0, 1, 1, 1, 3, 1, 4, 1, 3, 1, 1,
+  9, 0, 1, 40, 1, 38, 1, 45, 6, 0, 1, 25, 2, 4, 1, 13,
+  16, 0, 1, 3, 2, 4, 1, 20, 5, 0, 1, 44, 2, 38, 1, 46,
+  8, 0, 1, 5, 3, 4, 1, 5, 8, 0, 1, 46, 2, 38, 1, 44,
+  5, 0, 1, 20, 2, 4, 1, 3, 17, 0, 1, 9, 2, 4, 1, 30,
+  6, 0, 1, 48, 2, 38, 1, 46, 7, 0, 1, 6, 3, 4, 1, 6,
+  7, 0, 1, 46, 2, 38, 1, 48, 6, 0, 1, 30, 2, 4, 1, 9,
+  17, 0, 1, 15, 1, 17, 2, 4, 1, 26, 6, 0, 1, 51, 2, 38,
+  1, 40, 6, 0, 1, 6, 3, 4, 1, 6, 6, 0, 1, 40, 2, 38,
+  1, 51, 6, 0, 1, 26, 2, 4, 1, 17, 1, 15, 18, 0, 1, 16,
+  3, 4, 1, 21, 6, 0, 1, 48, 2, 38, 1, 49, 1, 50, 4, 0,
+  1, 28, 3, 4, 1, 28, 4, 0, 1, 50, 1, 49, 2, 38, 1, 48,
+  6, 0, 1, 21, 3, 4, 1, 16, 20, 0, 1, 24, 2, 4, 1, 18,
+  1, 31, 6, 0, 1, 44, 1, 45, 2, 38, 1, 37, 1, 46, 1, 47,
+  1, 0, 1, 28, 3, 4, 1, 28, 1, 0, 1, 47, 1, 46, 1, 37,
+  2, 38, 1, 45, 1, 44, 6, 0, 1, 31, 1, 18, 2, 4, 1, 24,
+  21, 0, 1, 23, 3, 4, 1, 10, 8, 0, 1, 40, 1, 41, 3, 38,
+  1, 42, 1, 43, 3, 4, 1, 43, 1, 42, 3, 38, 1, 41, 1, 40,
+  8, 0, 1, 10, 3, 4, 1, 23, 22, 0, 1, 29, 3, 4, 1, 35,
+  8, 0, 1, 32, 1, 36, 1, 37, 2, 38, 1, 39, 3, 4, 1, 39,
+  2, 38, 1, 37, 1, 36, 1, 32, 8, 0, 1, 35, 3, 4, 1, 29,
+  24, 0, 1, 9, 3, 4, 1, 10, 1, 31, 9, 0, 1, 32, 1, 33,
+  1, 34, 3, 4, 1, 34, 1, 33, 1, 32, 9, 0, 1, 31, 1, 10,
+  3, 4, 1, 9, 26, 0, 1, 28, 3, 4, 1, 18, 1, 21, 10, 0,
+  1, 28, 3, 4, 1, 28, 10, 0, 1, 21, 1, 18, 3, 4, 1, 28,
+  28, 0, 1, 9, 4, 4, 1, 26, 9, 0, 1, 28, 3, 4, 1, 28,
+  9, 0, 1, 26, 4, 4, 1, 9, 30, 0, 1, 29, 4, 4, 1, 30,
+  1, 20, 7, 0, 1, 28, 3, 4, 1, 28, 7, 0, 1, 20, 1, 30,
+  4, 4, 1, 29, 32, 0, 1, 23, 1, 24, 4, 4, 1, 25, 1, 26,
+  1, 27, 4, 0, 1, 28, 3, 4, 1, 28, 4, 0, 1, 27, 1, 26,
+  1, 25, 4, 4, 1, 24, 1, 23, 35, 0, 1, 16, 1, 17, 5, 4,
+  1, 18, 1, 19, 1, 20, 1, 21, 1, 22, 3, 4, 1, 22, 1, 21,
+  1, 20, 1, 19, 1, 18, 5, 4, 1, 17, 1, 16, 38, 0, 1, 15,
+  1, 9, 1, 3, 19, 4, 1, 3, 1, 9, 1, 15, 42, 0, 1, 13,
+  1, 14, 15, 4, 1, 14, 1, 13, 47, 0, 1, 7, 1, 8, 1, 9,
+  1, 10, 1, 11, 1, 12, 3, 4, 1, 12, 1, 11, 1, 10, 1, 9,
+  1, 8, 1, 7, 54, 0, 1, 6, 3, 4, 1, 6, 59, 0, 1, 6,
+  3, 4, 1, 6, 59, 0, 1, 5, 3, 4, 1, 5, 59, 0, 1, 1,
+  1, 3, 1, 4, 1, 3, 1, 1, 60, 0, 1, 1, 1, 2, 1, 1,
+  94, 0
+};
+static constexpr CompressedIcon kIcon_bounds{64, 64, kIcon_bounds_Palette, 65, kIcon_bounds_Rle, 2066};
 
 static constexpr int kIcon_live_W = 64;
 static constexpr int kIcon_live_H = 64;
-static const uint16_t kIcon_live[4096] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x7c32, 0xadda, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8cf6, 0xc6be, 0xb65c, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xb61c, 0xbebe, 0xadfb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbe9e, 0xbe9e, 0x8474, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3a09, 0xbe9e, 0xbe9e,
-  0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xa5da, 0xbe9e, 0xae3c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2b67, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbe9e, 0xbe9e, 0x426b, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3cca,
-  0x3cca, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa5ba,
-  0xb67e, 0xb63d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x4e2d, 0x6731, 0x4e2d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c4, 0xb67e, 0xb67e, 0x18e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08a1, 0x6731, 0x6731, 0x6731, 0x6731, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb65e, 0xb67e, 0x9559, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a04, 0x6731,
-  0x6731, 0x6731, 0x6731, 0x6731, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x9559, 0xb67e, 0xb65e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2b67, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x2b67, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x424a, 0xb67e, 0xb65e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3cca, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731,
-  0x6731, 0x6731, 0x3cca, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb65e, 0xb65e, 0x5b70,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4e2d, 0x6731,
-  0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x4e2d, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xae5e, 0xae5e, 0x9559, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x08a1, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731,
-  0x6731, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae3e, 0xae5e, 0xa5fc, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a04, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731,
-  0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae3e, 0xae5e, 0xae1e,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2b67, 0x6731, 0x6731,
-  0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x2b67,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xae3e, 0xae3e, 0xae3e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1a04, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731,
-  0x6731, 0x6731, 0x6731, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae3e, 0xae3e, 0xa63e, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08a1, 0x6731, 0x6731, 0x6731, 0x6731,
-  0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa63e, 0xa63e, 0xa61e,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4e2d, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x4e2d, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xa63e, 0xa63e, 0x9dfd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3cca, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731,
-  0x6731, 0x6731, 0x3cca, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4ace, 0xa63e, 0xa63e, 0x955a, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2b67,
-  0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x2b67, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x957b, 0xa61e, 0xa61e, 0x63b2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1a04, 0x6731, 0x6731, 0x6731, 0x6731, 0x6731, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xa61e, 0xa61e, 0xa61e, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08a1, 0x6731, 0x6731,
-  0x6731, 0x6731, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x31c9, 0x9e1e, 0x9e1e, 0xa61e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x4e2d, 0x6731, 0x4e2d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x95bd, 0x9e1e, 0x9e1e, 0x957b, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3cca, 0x3cca, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10c4, 0x9dfe,
-  0x9dfe, 0x9e1e, 0x29a9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xce7a,
-  0xef5d, 0xdedb, 0x4a49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2b67, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x95dd, 0x9dfe, 0x9dfe, 0x9dfe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xd69a, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xd6bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x63d3, 0x9dfe, 0x9dfe, 0x9dfe, 0x5b72, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0xd69a, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xdf1c, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x95fe, 0x95ff, 0x9dff,
-  0x9dde, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0xd6bb, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x738e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x95de, 0x95df, 0x95ff, 0x95fe, 0x320a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb5f9, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xdefb, 0x18a3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x95be, 0x95df, 0x95df, 0x95df, 0x855b, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10c5, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xdefc, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x95be, 0x95df, 0x95df, 0x95df, 0x95de, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2189, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xe75e, 0x647a, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4af0, 0x8dbe, 0x95df, 0x95df,
-  0x95df, 0x95de, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0xe75e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0x651f, 0x6d1f, 0x6d1f, 0x10c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x857d,
-  0x8dbf, 0x8dbf, 0x8dbf, 0x95df, 0x95de, 0x18e5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5b92,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xd71e, 0x6d1f, 0x6d1f, 0x6d3f, 0x6cfe, 0x1106, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x7d3c, 0x8dbf, 0x8dbf, 0x8dbf, 0x8dbf, 0x8dbf, 0x95be, 0x10c4, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xe73d, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x6d1f, 0x6d1f, 0x6d3f,
-  0x6d3f, 0x6d3f, 0x753f, 0x649b, 0x1927, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a4, 0x6c78, 0x857e, 0x859f, 0x859f, 0x8d9f, 0x8dbf, 0x8dbf, 0x8dbf, 0x8d9e, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xd71e, 0x6d1f, 0x6d3f, 0x6d3f, 0x6d3f, 0x6d3f, 0x753f, 0x755f, 0x755f, 0x755f, 0x755e,
-  0x7d5e, 0x7d5e, 0x7d5e, 0x7d7f, 0x857f, 0x857f, 0x859f, 0x859f, 0x859f, 0x859f, 0x859f, 0x8dbf,
-  0x8dbf, 0x74da, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xe71c, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x6d3f, 0x6d3f, 0x6d3f, 0x6d3f, 0x6d3f, 0x753f,
-  0x755f, 0x755f, 0x755f, 0x755f, 0x7d5f, 0x7d7f, 0x7d7f, 0x7d7f, 0x7d7f, 0x857f, 0x859f, 0x859f,
-  0x859f, 0x859f, 0x859f, 0x859e, 0x18e5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31a7, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xd71e, 0x6d3f,
-  0x6d3f, 0x6d3f, 0x753f, 0x755f, 0x755f, 0x755f, 0x755f, 0x755f, 0x7d5f, 0x7d5f, 0x7d7f, 0x7d7f,
-  0x7d7f, 0x857f, 0x859f, 0x859f, 0x859f, 0x857e, 0x322b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xef7e,
-  0xef7e, 0xef7e, 0xef5d, 0x10a4, 0x649b, 0x753f, 0x755f, 0x755f, 0x755f, 0x755f, 0x755f, 0x7d5f,
-  0x7d5f, 0x7d7f, 0x7d7f, 0x7d7f, 0x7d7f, 0x857f, 0x857e, 0x6c99, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0xef7e, 0xef7e, 0xef7e, 0xe71c, 0x0000, 0x0000, 0x0000, 0x0000, 0x322c,
-  0x5c38, 0x6cfc, 0x753e, 0x755e, 0x755e, 0x753e, 0x74fc, 0x5c17, 0x29ca, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8c72, 0xef7e, 0xe75d, 0x5acb, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000,
+static constexpr uint16_t kIcon_live_Palette[129] = {
+  0x0000, 0x7C32, 0xADDA, 0x8CF6, 0xC6BE, 0xB65C, 0xB61C, 0xBEBE, 0xADFB, 0xBE9E, 0x8474, 0x3A09, 0x1082, 0xA5DA, 0xAE3C, 0x2B67,
+  0x426B, 0x3CCA, 0xA5BA, 0xB67E, 0xB63D, 0x4E2D, 0x6731, 0x18C4, 0x18E4, 0x08A1, 0xB65E, 0x9559, 0x1A04, 0x424A, 0x0821, 0x5B70,
+  0xAE5E, 0xAE3E, 0xA5FC, 0xAE1E, 0xA63E, 0xA61E, 0x9DFD, 0x4ACE, 0x955A, 0x957B, 0x63B2, 0x1083, 0x31C9, 0x9E1E, 0x95BD, 0x10C4,
+  0x9DFE, 0x29A9, 0x0020, 0xCE7A, 0xEF5D, 0xDEDB, 0x4A49, 0x95DD, 0xD69A, 0xEF7E, 0xD6BB, 0x63D3, 0x5B72, 0xDF1C, 0x0862, 0x95FE,
+  0x95FF, 0x9DFF, 0x9DDE, 0x738E, 0x95DE, 0x95DF, 0x320A, 0xB5F9, 0xDEFB, 0x18A3, 0x95BE, 0x855B, 0x10C5, 0xDEFC, 0x18C3, 0x2189,
+  0xE75E, 0x647A, 0x4AF0, 0x8DBE, 0x0021, 0x651F, 0x6D1F, 0x857D, 0x8DBF, 0x18E5, 0x5B92, 0xD71E, 0x6D3F, 0x6CFE, 0x1106, 0x7D3C,
+  0xE73D, 0x753F, 0x649B, 0x1927, 0x10A4, 0x6C78, 0x857E, 0x859F, 0x8D9F, 0x8D9E, 0x3186, 0x755F, 0x755E, 0x7D5E, 0x7D7F, 0x857F,
+  0x74DA, 0xE71C, 0x7D5F, 0x859E, 0x31A7, 0x322B, 0x6C99, 0x322C, 0x5C38, 0x6CFC, 0x753E, 0x74FC, 0x5C17, 0x29CA, 0x8C72, 0xE75D,
+  0x5ACB
+};
+static constexpr uint8_t kIcon_live_Rle[708] = {
+  255, 0, 255, 0, 255, 0, 255, 0, 51, 0, 1, 1, 1, 2, 62, 0,
+  1, 3, 1, 4, 1, 5, 62, 0, 1, 6, 1, 7, 1, 8, 62, 0,
+  2, 9, 1, 10, 61, 0, 1, 11, 2, 9, 1, 12, 61, 0, 1, 13,
+  1, 9, 1, 14, 38, 0, 1, 15, 23, 0, 2, 9, 1, 16, 37, 0,
+  2, 17, 22, 0, 1, 18, 1, 19, 1, 20, 37, 0, 1, 21, 1, 22,
+  1, 21, 21, 0, 1, 23, 2, 19, 1, 24, 35, 0, 1, 25, 4, 22,
+  21, 0, 1, 26, 1, 19, 1, 27, 35, 0, 1, 28, 5, 22, 20, 0,
+  1, 27, 1, 19, 1, 26, 35, 0, 1, 15, 6, 22, 1, 15, 18, 0,
+  1, 29, 1, 19, 1, 26, 1, 30, 34, 0, 1, 17, 7, 22, 1, 17,
+  18, 0, 2, 26, 1, 31, 34, 0, 1, 21, 8, 22, 1, 21, 17, 0,
+  2, 32, 1, 27, 33, 0, 1, 25, 11, 22, 16, 0, 1, 33, 1, 32,
+  1, 34, 33, 0, 1, 28, 12, 22, 15, 0, 1, 33, 1, 32, 1, 35,
+  33, 0, 1, 15, 13, 22, 1, 15, 13, 0, 3, 33, 34, 0, 1, 28,
+  12, 22, 14, 0, 2, 33, 1, 36, 35, 0, 1, 25, 11, 22, 14, 0,
+  2, 36, 1, 37, 37, 0, 1, 21, 8, 22, 1, 21, 14, 0, 2, 36,
+  1, 38, 38, 0, 1, 17, 7, 22, 1, 17, 13, 0, 1, 39, 2, 36,
+  1, 40, 39, 0, 1, 15, 6, 22, 1, 15, 13, 0, 1, 41, 2, 37,
+  1, 42, 40, 0, 1, 28, 5, 22, 14, 0, 3, 37, 1, 43, 41, 0,
+  1, 25, 4, 22, 13, 0, 1, 44, 2, 45, 1, 37, 44, 0, 1, 21,
+  1, 22, 1, 21, 13, 0, 1, 46, 2, 45, 1, 41, 45, 0, 2, 17,
+  12, 0, 1, 47, 2, 48, 1, 45, 1, 49, 31, 0, 1, 50, 1, 51,
+  1, 52, 1, 53, 1, 54, 10, 0, 1, 15, 12, 0, 1, 55, 3, 48,
+  31, 0, 1, 56, 4, 57, 1, 58, 22, 0, 1, 59, 3, 48, 1, 60,
+  28, 0, 1, 50, 1, 56, 6, 57, 1, 61, 21, 0, 1, 62, 1, 63,
+  1, 64, 1, 65, 1, 66, 27, 0, 1, 62, 1, 58, 8, 57, 1, 67,
+  21, 0, 1, 68, 1, 69, 1, 64, 1, 63, 1, 70, 26, 0, 1, 71,
+  8, 57, 1, 72, 1, 73, 21, 0, 1, 74, 3, 69, 1, 75, 26, 0,
+  1, 76, 7, 57, 1, 77, 1, 78, 22, 0, 1, 74, 3, 69, 1, 68,
+  27, 0, 1, 79, 5, 57, 1, 80, 1, 81, 22, 0, 1, 82, 1, 83,
+  3, 69, 1, 68, 28, 0, 1, 84, 1, 80, 4, 57, 1, 85, 2, 86,
+  1, 76, 19, 0, 1, 87, 3, 88, 1, 69, 1, 68, 1, 89, 29, 0,
+  1, 90, 4, 57, 1, 91, 2, 86, 1, 92, 1, 93, 1, 94, 14, 0,
+  1, 84, 1, 95, 5, 88, 1, 74, 1, 47, 31, 0, 1, 96, 4, 57,
+  2, 86, 3, 92, 1, 97, 1, 98, 1, 99, 8, 0, 1, 100, 1, 101,
+  1, 102, 2, 103, 1, 104, 3, 88, 1, 105, 33, 0, 1, 106, 4, 57,
+  1, 91, 1, 86, 4, 92, 1, 97, 3, 107, 1, 108, 3, 109, 1, 110,
+  2, 111, 5, 103, 2, 88, 1, 112, 35, 0, 1, 113, 4, 57, 5, 92,
+  1, 97, 4, 107, 1, 114, 4, 110, 1, 111, 5, 103, 1, 115, 1, 89,
+  36, 0, 1, 116, 4, 57, 1, 91, 3, 92, 1, 97, 5, 107, 2, 114,
+  3, 110, 1, 111, 3, 103, 1, 102, 1, 117, 39, 0, 1, 113, 3, 57,
+  1, 52, 1, 100, 1, 98, 1, 97, 5, 107, 2, 114, 4, 110, 1, 111,
+  1, 102, 1, 118, 1, 84, 41, 0, 1, 106, 3, 57, 1, 113, 4, 0,
+  1, 119, 1, 120, 1, 121, 1, 122, 2, 108, 1, 122, 1, 123, 1, 124,
+  1, 125, 46, 0, 1, 126, 1, 57, 1, 127, 1, 128, 61, 0, 1, 50,
+  255, 0, 108, 0
 };
+static constexpr CompressedIcon kIcon_live{64, 64, kIcon_live_Palette, 129, kIcon_live_Rle, 708};
 
 static constexpr int kIcon_terminal_W = 64;
 static constexpr int kIcon_terminal_H = 64;
-static const uint16_t kIcon_terminal[4096] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x632c,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x7bcf, 0x632c, 0x2945, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c3, 0x9d14, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0x9d14, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0xce59, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xce59, 0x18c3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9d14, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0x9d14, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xeeba, 0xfc0f, 0xfaea, 0xfc0f, 0xeeba, 0xef7e,
-  0xef7e, 0xef7e, 0xef3a, 0xfe4b, 0xfde6, 0xfe4b, 0xef3a, 0xef7e, 0xef7e, 0xef7e, 0xcf5a, 0x568d,
-  0x2e48, 0x568d, 0xcf5a, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x632c, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xfc0f, 0xfaea,
-  0xfaea, 0xfaea, 0xfc0f, 0xef7e, 0xef7e, 0xef7e, 0xfe4b, 0xfde6, 0xfde6, 0xfde6, 0xfe4b, 0xef7e,
-  0xef7e, 0xef7e, 0x568d, 0x2e48, 0x2e48, 0x2e48, 0x568d, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x632c, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xfaea, 0xfaea, 0xfaea, 0xfaea, 0xfaea, 0xef7e, 0xef7e, 0xef7e, 0xfde6, 0xfde6,
-  0xfde6, 0xfde6, 0xfde6, 0xef7e, 0xef7e, 0xef7e, 0x2e48, 0x2e48, 0x2e48, 0x2e48, 0x2e48, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xfc0f, 0xfaea, 0xfaea, 0xfaea, 0xfc0f, 0xef7e,
-  0xef7e, 0xef7e, 0xfe4b, 0xfde6, 0xfde6, 0xfde6, 0xfe4b, 0xef7e, 0xef7e, 0xef7e, 0x568d, 0x2e48,
-  0x2e48, 0x2e48, 0x568d, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x632c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xeeba, 0xfc0f,
-  0xfaea, 0xfc0f, 0xeeba, 0xef7e, 0xef7e, 0xef7e, 0xef3a, 0xfe4b, 0xfde6, 0xfe4b, 0xef3a, 0xef7e,
-  0xef7e, 0xef7e, 0xcf5a, 0x568d, 0x2e48, 0x568d, 0xcf5a, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x2945, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x4313, 0x651f, 0x5c7b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000,
-  0x0000, 0x651f, 0x651f, 0x651f, 0x64ff, 0x0884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x5419, 0x651f, 0x651f, 0x651f, 0x64ff, 0x2a0d, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x543a, 0x651f,
-  0x651f, 0x651f, 0x64ff, 0x4375, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x4375, 0x64ff, 0x651f, 0x651f, 0x651f, 0x545b, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2a0d, 0x64ff, 0x651f, 0x651f,
-  0x651f, 0x5cbd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1107, 0x64ff, 0x651f, 0x651f, 0x651f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2a0d, 0x64ff, 0x651f, 0x651f, 0x651f, 0x5cbd, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4375, 0x64ff, 0x651f, 0x651f, 0x651f,
-  0x545b, 0x0000, 0x0000, 0xa534, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xa534, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x543a, 0x651f,
-  0x651f, 0x651f, 0x64ff, 0x4375, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000,
-  0x0000, 0x5419, 0x651f, 0x651f, 0x651f, 0x64ff, 0x2a0d, 0x0000, 0x0000, 0x0000, 0x0000, 0xa534,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xa534, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x651f, 0x651f, 0x651f, 0x64ff, 0x0884, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x4313, 0x651f, 0x5c7b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x632c, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xef7e, 0xef7e, 0xef7e, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x632c, 0xef7e,
-  0xef7e, 0xef7e, 0x0000, 0x0000, 0x0000, 0x3186, 0x8431, 0x8c72, 0x8c72, 0x8c72, 0x8c72, 0x8c72,
-  0x8c72, 0x8c72, 0x8c72, 0x8c72, 0x8c72, 0x8c72, 0x8c72, 0x8c72, 0x8c72, 0x8c72, 0x8c72, 0x8c72,
-  0x8c72, 0x8c72, 0x8431, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x632c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2945, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xa514, 0x9492, 0x9492,
-  0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492,
-  0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0xa514, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x2945, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9d14, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xce7a, 0x94b2, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492,
-  0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x94b2, 0xce7a,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0x9d14, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3,
-  0xce59, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xce59, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x9d14, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e,
-  0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0xef7e, 0x9d14, 0x18c3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x632c,
-  0x7bcf, 0x630c, 0x5aeb, 0x5aec, 0x5aec, 0x5aec, 0x5aec, 0x5aec, 0x5aec, 0x5aec, 0x5aec, 0x5aec,
-  0x5aec, 0x5aec, 0x5aec, 0x5aec, 0x5aec, 0x5aec, 0x5acb, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x632c, 0x7bcf, 0x632c, 0x2945, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a6a, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c,
-  0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x4a6a,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5acb, 0x5aec,
-  0x5aec, 0x5aec, 0x5aec, 0x5aec, 0x5aec, 0x5aec, 0x5aec, 0x5aec, 0x5aec, 0x5aec, 0x5aec, 0x5aec,
-  0x5aec, 0x5aec, 0x5acb, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x10a2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3186, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7, 0x39e7,
-  0x39e7, 0x39e7, 0x39e7, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7,
-  0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000,
+static constexpr uint16_t kIcon_terminal_Palette[46] = {
+  0x0000, 0x2945, 0x632C, 0xEF7E, 0x7BCF, 0x18C3, 0x9D14, 0xCE59, 0xEEBA, 0xFC0F, 0xFAEA, 0xEF3A, 0xFE4B, 0xFDE6, 0xCF5A, 0x568D,
+  0x2E48, 0x4313, 0x651F, 0x5C7B, 0x64FF, 0x0884, 0x5419, 0x2A0D, 0x543A, 0x4375, 0x545B, 0x5CBD, 0x1107, 0xA534, 0x3186, 0x8431,
+  0x8C72, 0xA514, 0x9492, 0xCE7A, 0x94B2, 0x630C, 0x5AEB, 0x5AEC, 0x5ACB, 0x2104, 0x4A6A, 0x10A2, 0x39C7, 0x39E7
+};
+static constexpr uint8_t kIcon_terminal_Rle[708] = {
+  255, 0, 255, 0, 255, 0, 145, 0, 1, 1, 1, 2, 32, 3, 1, 4,
+  1, 2, 1, 1, 25, 0, 1, 5, 1, 6, 37, 3, 1, 6, 1, 5,
+  22, 0, 1, 5, 1, 7, 39, 3, 1, 7, 1, 5, 21, 0, 1, 6,
+  41, 3, 1, 6, 20, 0, 1, 1, 7, 3, 1, 8, 1, 9, 1, 10,
+  1, 9, 1, 8, 3, 3, 1, 11, 1, 12, 1, 13, 1, 12, 1, 11,
+  3, 3, 1, 14, 1, 15, 1, 16, 1, 15, 1, 14, 15, 3, 1, 1,
+  19, 0, 1, 2, 7, 3, 1, 9, 3, 10, 1, 9, 3, 3, 1, 12,
+  3, 13, 1, 12, 3, 3, 1, 15, 3, 16, 1, 15, 15, 3, 1, 2,
+  19, 0, 8, 3, 5, 10, 3, 3, 5, 13, 3, 3, 5, 16, 15, 3,
+  1, 4, 19, 0, 8, 3, 1, 9, 3, 10, 1, 9, 3, 3, 1, 12,
+  3, 13, 1, 12, 3, 3, 1, 15, 3, 16, 1, 15, 15, 3, 1, 2,
+  19, 0, 8, 3, 1, 8, 1, 9, 1, 10, 1, 9, 1, 8, 3, 3,
+  1, 11, 1, 12, 1, 13, 1, 12, 1, 11, 3, 3, 1, 14, 1, 15,
+  1, 16, 1, 15, 1, 14, 15, 3, 1, 1, 19, 0, 44, 3, 20, 0,
+  4, 3, 36, 0, 4, 3, 20, 0, 4, 3, 36, 0, 4, 3, 20, 0,
+  4, 3, 36, 0, 4, 3, 20, 0, 4, 3, 36, 0, 4, 3, 20, 0,
+  4, 3, 36, 0, 4, 3, 20, 0, 4, 3, 36, 0, 4, 3, 20, 0,
+  4, 3, 36, 0, 4, 3, 20, 0, 4, 3, 3, 0, 1, 17, 1, 18,
+  1, 19, 30, 0, 4, 3, 20, 0, 4, 3, 3, 0, 3, 18, 1, 20,
+  1, 21, 28, 0, 4, 3, 20, 0, 4, 3, 3, 0, 1, 22, 3, 18,
+  1, 20, 1, 23, 27, 0, 4, 3, 20, 0, 4, 3, 4, 0, 1, 24,
+  3, 18, 1, 20, 1, 25, 26, 0, 4, 3, 20, 0, 4, 3, 5, 0,
+  1, 25, 1, 20, 3, 18, 1, 26, 25, 0, 4, 3, 20, 0, 4, 3,
+  6, 0, 1, 23, 1, 20, 3, 18, 1, 27, 24, 0, 4, 3, 20, 0,
+  4, 3, 7, 0, 1, 28, 1, 20, 3, 18, 24, 0, 4, 3, 20, 0,
+  4, 3, 6, 0, 1, 23, 1, 20, 3, 18, 1, 27, 24, 0, 4, 3,
+  20, 0, 4, 3, 5, 0, 1, 25, 1, 20, 3, 18, 1, 26, 2, 0,
+  1, 29, 5, 3, 1, 29, 16, 0, 4, 3, 20, 0, 4, 3, 4, 0,
+  1, 24, 3, 18, 1, 20, 1, 25, 3, 0, 7, 3, 16, 0, 4, 3,
+  20, 0, 4, 3, 3, 0, 1, 22, 3, 18, 1, 20, 1, 23, 4, 0,
+  1, 29, 5, 3, 1, 29, 16, 0, 4, 3, 20, 0, 4, 3, 3, 0,
+  3, 18, 1, 20, 1, 21, 28, 0, 4, 3, 1, 1, 19, 0, 4, 3,
+  3, 0, 1, 17, 1, 18, 1, 19, 30, 0, 4, 3, 1, 2, 19, 0,
+  1, 4, 3, 3, 36, 0, 4, 3, 1, 4, 19, 0, 1, 2, 3, 3,
+  3, 0, 1, 30, 1, 31, 19, 32, 1, 31, 1, 30, 10, 0, 4, 3,
+  1, 2, 19, 0, 1, 1, 6, 3, 1, 33, 21, 34, 1, 33, 14, 3,
+  1, 1, 20, 0, 1, 6, 5, 3, 1, 35, 1, 36, 19, 34, 1, 36,
+  1, 35, 13, 3, 1, 6, 21, 0, 1, 5, 1, 7, 39, 3, 1, 7,
+  1, 5, 22, 0, 1, 5, 1, 6, 37, 3, 1, 6, 1, 5, 25, 0,
+  1, 1, 1, 2, 1, 4, 1, 37, 1, 38, 15, 39, 1, 40, 1, 41,
+  10, 0, 1, 1, 1, 2, 1, 4, 1, 2, 1, 1, 30, 0, 1, 42,
+  17, 37, 1, 42, 45, 0, 1, 41, 1, 40, 15, 39, 1, 40, 1, 41,
+  173, 0, 1, 43, 6, 44, 1, 45, 6, 44, 1, 43, 49, 0, 1, 30,
+  13, 45, 1, 30, 49, 0, 1, 43, 6, 44, 1, 45, 6, 44, 1, 43,
+  255, 0, 161, 0
 };
+static constexpr CompressedIcon kIcon_terminal{64, 64, kIcon_terminal_Palette, 46, kIcon_terminal_Rle, 708};
 
 } // namespace ui::assets
 
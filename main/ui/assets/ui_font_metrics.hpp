@@ -0,0 +1,39 @@
+/**
+ * @file ui_font_metrics.hpp
+ * @brief Auto-generated font metrics for the UI glyph set
+ * @details Per-glyph advances (at text size 1) for every character the
+ *          UI can display, audited from the sources by
+ *          tools/subset_font.py against the vendored GLCD font. An
+ *          advance of 0 marks an unused glyph; measurement falls back
+ *          to the library for those. Regenerate after adding UI text.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace ui::assets {
+
+static constexpr uint8_t kUiFontFirstCode = 0x20;  ///< First covered code
+static constexpr uint8_t kUiFontLastCode = 0x7E;   ///< Last covered code
+static constexpr uint8_t kUiFontHeight = 8;       ///< Glyph height at size 1
+
+/// Advance width at text size 1, indexed by (code - kUiFontFirstCode).
+/// 0 = glyph not in the audited set (caller must fall back).
+static constexpr uint8_t kUiFontAdvance[] = {
+    6, 0, 0, 6, 0, 6, 0, 6, 6, 6, 0, 6, 6, 6, 6, 6,  //  ..#.%.'().+,-./
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,  // 0123456789:;<=>?
+    0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 6, 6, 6, 6, 6,  // .ABCDEFGHI.KLMNO
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 6, 0, 6, 6,  // PQRSTUVWXY..\.^_
+    0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,  // .abcdefghijklmno
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 6, 0, 0,  // pqrstuvwxyz.|..
+};
+
+/// Advance width for one character, 0 when outside the audited set.
+constexpr uint8_t glyphAdvance(uint8_t code) {
+    return (code >= kUiFontFirstCode && code <= kUiFontLastCode)
+               ? kUiFontAdvance[code - kUiFontFirstCode]
+               : 0;
+}
+
+}  // namespace ui::assets
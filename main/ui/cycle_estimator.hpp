@@ -0,0 +1,172 @@
+/**
+ * @file cycle_estimator.hpp
+ * @brief Cycle-rate estimator with ETA bounds and stall detection
+ * @details Fed the same (timestamp, cycle) samples as CycleHistory, but
+ *          instead of retaining them it maintains exponentially weighted
+ *          statistics: a fast rate average for the readout, its variance
+ *          for ETA confidence bounds, and a slow baseline average whose
+ *          divergence from the fast one flags a rate collapse. O(1) per
+ *          sample, a handful of floats of state, no heap allocation.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+namespace ui {
+
+/**
+ * @brief Exponentially weighted cycle-rate statistics for the Live Counter
+ */
+class CycleEstimator {
+public:
+    static constexpr uint32_t kMinSpacingMs = 1000;  ///< Min gap between rate samples
+    static constexpr float kAlphaFast = 0.30f;       ///< Readout average weight
+    static constexpr float kAlphaSlow = 0.05f;       ///< Stall baseline weight
+    static constexpr float kZ90 = 1.645f;            ///< 90% two-sided z score
+    static constexpr float kStallFactor = 0.25f;     ///< Fast/slow ratio that means collapse
+    static constexpr uint32_t kStallFloorMs = 10000; ///< Min no-advance window
+    static constexpr uint32_t kBaselineSamples = 10; ///< Samples before stall checks arm
+
+    /**
+     * @brief Record a status sample
+     * @details Samples closer than kMinSpacingMs to the previous one are
+     *          absorbed (the cycle delta is kept by not advancing the
+     *          anchor). A cycle number going backwards means a new run and
+     *          resets all statistics.
+     * @param t_ms Local timestamp in milliseconds
+     * @param cycle Cycle number reported at @p t_ms
+     */
+    void push(uint32_t t_ms, uint32_t cycle) noexcept {
+        if (have_sample_ && cycle < prev_cycle_) {
+            clear();
+        }
+        if (!have_sample_) {
+            prev_t_ms_ = t_ms;
+            prev_cycle_ = cycle;
+            last_advance_ms_ = t_ms;
+            have_sample_ = true;
+            return;
+        }
+        if (cycle > prev_cycle_) {
+            last_advance_ms_ = t_ms;
+        }
+        const uint32_t dt_ms = t_ms - prev_t_ms_;
+        if (dt_ms < kMinSpacingMs) {
+            return;
+        }
+        const float r = static_cast<float>(cycle - prev_cycle_) * 1000.0f /
+                        static_cast<float>(dt_ms);
+        prev_t_ms_ = t_ms;
+        prev_cycle_ = cycle;
+        if (samples_ == 0) {
+            rate_fast_cps_ = r;
+            rate_slow_cps_ = r;
+            var_ = 0.0f;
+        } else {
+            const float d = r - rate_fast_cps_;
+            rate_fast_cps_ += kAlphaFast * d;
+            var_ = (1.0f - kAlphaFast) * (var_ + kAlphaFast * d * d);
+            rate_slow_cps_ += kAlphaSlow * (r - rate_slow_cps_);
+        }
+        if (samples_ < kBaselineSamples) {
+            ++samples_;
+        }
+    }
+
+    /**
+     * @brief Forget all statistics (new run)
+     */
+    void clear() noexcept {
+        have_sample_ = false;
+        samples_ = 0;
+        rate_fast_cps_ = 0.0f;
+        rate_slow_cps_ = 0.0f;
+        var_ = 0.0f;
+    }
+
+    /**
+     * @brief Whether a positive rate estimate exists
+     */
+    bool hasRate() const noexcept { return samples_ > 0 && rate_fast_cps_ > 0.0f; }
+
+    /**
+     * @brief Smoothed cycle rate in cycles per minute
+     */
+    float ratePerMin() const noexcept { return rate_fast_cps_ * 60.0f; }
+
+    /**
+     * @brief Estimate time to reach the target cycle count
+     * @param cycle Current cycle number
+     * @param target Target cycle count
+     * @param eta_ms_out Receives the point estimate
+     * @param spread_ms_out Receives the 90% half-spread, or 0 when the rate
+     *                      variance makes the slow bound unbounded
+     * @return true if a positive rate exists and the target is ahead
+     */
+    bool eta(uint32_t cycle, uint32_t target, uint32_t& eta_ms_out,
+             uint32_t& spread_ms_out) const noexcept {
+        if (!hasRate() || target <= cycle) {
+            return false;
+        }
+        const float remaining = static_cast<float>(target - cycle);
+        eta_ms_out = clampMs_(remaining * 1000.0f / rate_fast_cps_);
+        const float sd = std::sqrt(var_);
+        const float lo_rate = rate_fast_cps_ - kZ90 * sd;
+        if (lo_rate > 0.0f) {
+            const float hi_ms = remaining * 1000.0f / lo_rate;
+            const float lo_ms = remaining * 1000.0f / (rate_fast_cps_ + kZ90 * sd);
+            spread_ms_out = clampMs_((hi_ms - lo_ms) * 0.5f);
+        } else {
+            spread_ms_out = 0;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Whether the rate has collapsed
+     * @details Two triggers, both armed only after kBaselineSamples: the
+     *          counter has not advanced for three expected cycle periods
+     *          (at least kStallFloorMs), or the fast average fell below
+     *          kStallFactor of the slow baseline (partial collapse that
+     *          still advances occasionally).
+     * @param now_ms Current local time
+     */
+    bool stalled(uint32_t now_ms) const noexcept {
+        if (samples_ < kBaselineSamples || rate_slow_cps_ <= 0.0f) {
+            return false;
+        }
+        const uint32_t period_ms =
+            (rate_fast_cps_ > 0.0f) ? static_cast<uint32_t>(1000.0f / rate_fast_cps_) : kStallFloorMs;
+        const uint32_t window_ms =
+            (3 * period_ms > kStallFloorMs) ? 3 * period_ms : kStallFloorMs;
+        if (now_ms - last_advance_ms_ > window_ms) {
+            return true;
+        }
+        return rate_fast_cps_ < kStallFactor * rate_slow_cps_;
+    }
+
+private:
+    /// Saturate a float millisecond count into uint32_t
+    static uint32_t clampMs_(float ms) noexcept {
+        if (ms < 0.0f) {
+            return 0;
+        }
+        if (ms >= 4294967040.0f) {
+            return 0xFFFFFFFFu;
+        }
+        return static_cast<uint32_t>(ms);
+    }
+
+    bool have_sample_ = false;       ///< An anchor sample exists
+    uint32_t samples_ = 0;           ///< Rate samples folded in (caps at kBaselineSamples)
+    uint32_t prev_t_ms_ = 0;         ///< Anchor timestamp
+    uint32_t prev_cycle_ = 0;        ///< Anchor cycle number
+    uint32_t last_advance_ms_ = 0;   ///< Last time the counter moved forward
+    float rate_fast_cps_ = 0.0f;     ///< Fast EWMA, cycles per second
+    float rate_slow_cps_ = 0.0f;     ///< Slow baseline EWMA, cycles per second
+    float var_ = 0.0f;               ///< EW variance of the fast average
+};
+
+} // namespace ui
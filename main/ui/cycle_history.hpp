@@ -0,0 +1,100 @@
+/**
+ * @file cycle_history.hpp
+ * @brief Fixed-capacity history ring of (timestamp, cycle number) samples
+ * @details Backs the cycle-rate readout and sparkline on the Live Counter
+ *          page. O(1) per recorded sample, no heap allocation; the ring
+ *          self-resets when the cycle counter goes backwards (new run).
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ui {
+
+/**
+ * @brief Ring buffer of cycle-counter samples with derived rate queries
+ */
+class CycleHistory {
+public:
+    /// One recorded sample
+    struct Sample {
+        uint32_t t_ms;    ///< Local timestamp (ms)
+        uint32_t cycle;   ///< Cycle number at that time
+    };
+
+    static constexpr size_t kCapacity = 64;        ///< Max retained samples
+    static constexpr uint32_t kMinSpacingMs = 1000; ///< Min gap between samples
+
+    /**
+     * @brief Record a sample
+     * @details Samples closer than kMinSpacingMs to the newest one are
+     *          dropped so the ring spans minutes, not seconds. A cycle
+     *          number lower than the newest sample means the counter was
+     *          reset, so the history restarts.
+     * @param t_ms Local timestamp in milliseconds
+     * @param cycle Cycle number reported at @p t_ms
+     */
+    void push(uint32_t t_ms, uint32_t cycle) noexcept {
+        if (count_ > 0) {
+            const Sample& newest = at(count_ - 1);
+            if (cycle < newest.cycle) {
+                clear();
+            } else if (t_ms - newest.t_ms < kMinSpacingMs) {
+                return;
+            }
+        }
+        ring_[head_] = Sample{t_ms, cycle};
+        head_ = (head_ + 1) % kCapacity;
+        if (count_ < kCapacity) {
+            ++count_;
+        }
+    }
+
+    /**
+     * @brief Drop all recorded samples
+     */
+    void clear() noexcept {
+        head_ = 0;
+        count_ = 0;
+    }
+
+    /**
+     * @brief Number of retained samples
+     */
+    size_t size() const noexcept { return count_; }
+
+    /**
+     * @brief Get a sample, oldest first
+     * @param i Index in [0, size())
+     */
+    const Sample& at(size_t i) const noexcept {
+        return ring_[(head_ + kCapacity - count_ + i) % kCapacity];
+    }
+
+    /**
+     * @brief Cycle rate over the whole retained window
+     * @return Cycles per minute, or 0 if fewer than two samples
+     */
+    float ratePerMin() const noexcept {
+        if (count_ < 2) {
+            return 0.0f;
+        }
+        const Sample& oldest = at(0);
+        const Sample& newest = at(count_ - 1);
+        const uint32_t dt_ms = newest.t_ms - oldest.t_ms;
+        if (dt_ms == 0) {
+            return 0.0f;
+        }
+        const uint32_t dc = newest.cycle - oldest.cycle;
+        return static_cast<float>(dc) * 60000.0f / static_cast<float>(dt_ms);
+    }
+
+private:
+    Sample ring_[kCapacity] = {}; ///< Sample storage
+    size_t head_ = 0;             ///< Next write position
+    size_t count_ = 0;            ///< Valid samples in the ring
+};
+
+} // namespace ui
@@ -0,0 +1,107 @@
+/**
+ * @file dirty_rect.hpp
+ * @brief Dirty-rectangle tracking for partial canvas redraw/flush
+ * @details Draw helpers register the rectangles they touched; the renderer
+ *          re-renders only the union of dirty rects (via sprite clipping)
+ *          and pushes the covered scanline band instead of the full
+ *          240x240 sprite. Header-only, no heap allocation.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <algorithm>
+
+namespace ui {
+
+/**
+ * @brief Accumulates dirty rectangles into a single union rectangle
+ * @details A single union rect keeps the per-frame bookkeeping O(1) per
+ *          registered rect; on a 240x240 round panel the savings come
+ *          almost entirely from skipping untouched scanlines on the SPI
+ *          flush, so a tighter rect list is not worth the bookkeeping.
+ */
+class DirtyRectTracker {
+public:
+    /**
+     * @brief Construct tracker for a screen of the given size
+     * @param width Screen width in pixels
+     * @param height Screen height in pixels
+     */
+    DirtyRectTracker(int16_t width, int16_t height) noexcept
+        : width_(width), height_(height)
+    {
+    }
+
+    /**
+     * @brief Mark a rectangle as needing redraw
+     * @param x,y Top-left corner (may be off-screen; clipped)
+     * @param w,h Size in pixels
+     */
+    void mark(int16_t x, int16_t y, int16_t w, int16_t h) noexcept {
+        if (w <= 0 || h <= 0) {
+            return;
+        }
+        int16_t x1 = std::max<int16_t>(0, x);
+        int16_t y1 = std::max<int16_t>(0, y);
+        int16_t x2 = std::min<int16_t>(width_, static_cast<int16_t>(x + w));
+        int16_t y2 = std::min<int16_t>(height_, static_cast<int16_t>(y + h));
+        if (x2 <= x1 || y2 <= y1) {
+            return;
+        }
+        if (!has_dirty_) {
+            x1_ = x1; y1_ = y1; x2_ = x2; y2_ = y2;
+            has_dirty_ = true;
+        } else {
+            x1_ = std::min(x1_, x1);
+            y1_ = std::min(y1_, y1);
+            x2_ = std::max(x2_, x2);
+            y2_ = std::max(y2_, y2);
+        }
+    }
+
+    /**
+     * @brief Mark the whole screen dirty (page change, popup open/close)
+     */
+    void markFull() noexcept {
+        x1_ = 0; y1_ = 0; x2_ = width_; y2_ = height_;
+        has_dirty_ = true;
+    }
+
+    /**
+     * @brief Check whether anything is marked dirty
+     */
+    bool hasDirty() const noexcept { return has_dirty_; }
+
+    /**
+     * @brief Check whether the union covers the full screen
+     */
+    bool isFull() const noexcept {
+        return has_dirty_ && x1_ == 0 && y1_ == 0 && x2_ == width_ && y2_ == height_;
+    }
+
+    /// @brief Union rect left edge (valid only when hasDirty())
+    int16_t x() const noexcept { return x1_; }
+    /// @brief Union rect top edge
+    int16_t y() const noexcept { return y1_; }
+    /// @brief Union rect width
+    int16_t w() const noexcept { return static_cast<int16_t>(x2_ - x1_); }
+    /// @brief Union rect height
+    int16_t h() const noexcept { return static_cast<int16_t>(y2_ - y1_); }
+
+    /**
+     * @brief Clear all dirty state (call after a successful flush)
+     */
+    void clear() noexcept { has_dirty_ = false; }
+
+private:
+    int16_t width_;          ///< Screen width
+    int16_t height_;         ///< Screen height
+    bool has_dirty_ = false; ///< True once any rect was marked
+    int16_t x1_ = 0;         ///< Union left (inclusive)
+    int16_t y1_ = 0;         ///< Union top (inclusive)
+    int16_t x2_ = 0;         ///< Union right (exclusive)
+    int16_t y2_ = 0;         ///< Union bottom (exclusive)
+};
+
+} // namespace ui
@@ -0,0 +1,184 @@
+/**
+ * @file display_tuner.hpp
+ * @brief Boot-time SPI write-clock proving for the panel
+ * @details Full-frame push time scales directly with the display bus
+ *          clock, so the panel should run at the fastest write clock the
+ *          individual board actually sustains. The stock M5Dial init in
+ *          M5GFX already requests the 80MHz bus maximum, but a marginal
+ *          panel or flex cable silently corrupts pixels there; this layer
+ *          proves the clock instead of trusting it. At boot it writes a
+ *          pseudo-random pattern, reads it back (the conservative read
+ *          clock is never touched), and steps the write clock down the
+ *          ladder until a level verifies, persisting the proven level so
+ *          later boots start from it. If even the bottom of the ladder
+ *          fails readback, the read path itself is untrustworthy and the
+ *          stock configuration is left alone.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "M5GFX.h"
+#include "esp_log.h"
+#include "nvs.h"
+
+#include "lgfx/v1/platforms/esp32/Bus_SPI.hpp"
+
+namespace ui {
+namespace display_tuner {
+
+static constexpr const char* TAG_ = "disp_tune";
+static constexpr const char* NVS_NAMESPACE_ = "display";
+static constexpr const char* KEY_WRITE_CLK_ = "wclk";
+
+/// Write-clock ladder, fastest first. The SPI divider rounds each request
+/// to what the peripheral can produce; the values only need to be ordered.
+static constexpr uint32_t CLOCK_LADDER_[] = {80000000U, 53000000U, 40000000U, 27000000U};
+static constexpr size_t CLOCK_LADDER_LEN_ = sizeof(CLOCK_LADDER_) / sizeof(CLOCK_LADDER_[0]);
+
+/// Test pattern geometry: a small strip in panel GRAM. (0,0) sits outside
+/// the round bezel, so the probe is invisible even mid-boot.
+static constexpr int32_t PAT_W_ = 16;
+static constexpr int32_t PAT_H_ = 8;
+
+/// Set once any pattern strip reads back exactly this boot; consumed by
+/// the power-on self-test as the display verdict (see self_test.hpp), so
+/// the POST never has to contend for the SPI bus itself.
+inline bool s_readback_ok_ = false;
+
+/**
+ * @brief true if a pattern test passed read-back this boot
+ */
+inline bool ReadbackOk() noexcept
+{
+    return s_readback_ok_;
+}
+
+/**
+ * @brief Write a deterministic pattern at the current clock and read it back
+ * @param display Panel to exercise
+ * @param seed Pattern seed (vary between rounds)
+ * @return true if every pixel read back exactly
+ */
+inline bool verifyPattern(M5GFX& display, uint32_t seed)
+{
+    uint16_t expect[PAT_W_ * PAT_H_];
+    uint16_t got[PAT_W_ * PAT_H_];
+
+    // xorshift32: cheap, deterministic, and toggles every data line.
+    uint32_t x = seed;
+    for (size_t i = 0; i < static_cast<size_t>(PAT_W_ * PAT_H_); ++i) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        expect[i] = static_cast<uint16_t>(x);
+    }
+
+    display.startWrite();
+    display.pushImage(0, 0, PAT_W_, PAT_H_, expect);
+    display.endWrite();
+    std::memset(got, 0, sizeof(got));
+    display.readRect(0, 0, PAT_W_, PAT_H_, got);
+
+    const bool ok = std::memcmp(expect, got, sizeof(expect)) == 0;
+    if (ok) {
+        s_readback_ok_ = true;
+    }
+    return ok;
+}
+
+/**
+ * @brief Apply a write clock to the panel's SPI bus
+ */
+inline void applyWriteClock(M5GFX& display, uint32_t hz)
+{
+    auto* bus = static_cast<lgfx::Bus_SPI*>(display.getPanel()->getBus());
+    auto cfg = bus->config();
+    cfg.freq_write = hz;
+    bus->config(cfg);
+}
+
+/**
+ * @brief Verify a clock level: apply, pattern-test twice, report
+ */
+inline bool proveClock(M5GFX& display, uint32_t hz)
+{
+    applyWriteClock(display, hz);
+    return verifyPattern(display, 0x2545F491U) && verifyPattern(display, 0x9E3779B9U);
+}
+
+/**
+ * @brief Prove the display write clock and persist the result
+ * @details Call once after M5.begin(), before the UI draws. A previously
+ *          proven level is tried first so healthy boards pay one pattern
+ *          test; the full ladder only runs on first boot or after a
+ *          persisted level stops verifying.
+ * @param display The booted panel (bus must be SPI, which M5Dial's is)
+ */
+inline void Run(M5GFX& display)
+{
+    auto* panel = display.getPanel();
+    if (panel == nullptr || panel->getBus() == nullptr ||
+        panel->getBus()->busType() != lgfx::bus_type_t::bus_spi) {
+        return;
+    }
+    const uint32_t stock_hz =
+        static_cast<lgfx::Bus_SPI*>(panel->getBus())->config().freq_write;
+
+    // Sanity-check the read path at the ladder bottom before trusting any
+    // mismatch verdicts: a panel that cannot read back at a conservative
+    // clock would fail every level and strand us at the slowest one.
+    applyWriteClock(display, CLOCK_LADDER_[CLOCK_LADDER_LEN_ - 1]);
+    if (!verifyPattern(display, 0x1B873593U)) {
+        ESP_LOGW(TAG_, "readback unreliable, keeping stock %luMHz",
+                 static_cast<unsigned long>(stock_hz / 1000000U));
+        applyWriteClock(display, stock_hz);
+        display.fillRect(0, 0, PAT_W_, PAT_H_, TFT_BLACK);
+        return;
+    }
+
+    // Previously proven level first.
+    uint32_t persisted = 0;
+    nvs_handle_t handle;
+    if (nvs_open(NVS_NAMESPACE_, NVS_READONLY, &handle) == ESP_OK) {
+        uint32_t value = 0;
+        if (nvs_get_u32(handle, KEY_WRITE_CLK_, &value) == ESP_OK) {
+            persisted = value;
+        }
+        nvs_close(handle);
+    }
+    uint32_t proven = 0;
+    if (persisted != 0 && proveClock(display, persisted)) {
+        proven = persisted;
+    } else {
+        for (size_t i = 0; i < CLOCK_LADDER_LEN_; ++i) {
+            if (proveClock(display, CLOCK_LADDER_[i])) {
+                proven = CLOCK_LADDER_[i];
+                break;
+            }
+        }
+    }
+    display.fillRect(0, 0, PAT_W_, PAT_H_, TFT_BLACK);
+    if (proven == 0) {
+        // Bottom level passed standalone above but the ladder failed twice
+        // over - treat as flaky and fall back to stock.
+        applyWriteClock(display, stock_hz);
+        ESP_LOGW(TAG_, "no level proved stable, stock %luMHz",
+                 static_cast<unsigned long>(stock_hz / 1000000U));
+        return;
+    }
+    applyWriteClock(display, proven);
+    ESP_LOGI(TAG_, "write clock proven at %luMHz%s",
+             static_cast<unsigned long>(proven / 1000000U),
+             (proven == persisted) ? " (persisted)" : "");
+    if (proven != persisted && nvs_open(NVS_NAMESPACE_, NVS_READWRITE, &handle) == ESP_OK) {
+        nvs_set_u32(handle, KEY_WRITE_CLK_, proven);
+        nvs_commit(handle);
+        nvs_close(handle);
+    }
+}
+
+} // namespace display_tuner
+} // namespace ui
@@ -0,0 +1,243 @@
+/**
+ * @file draw_list.hpp
+ * @brief Per-frame retained draw-command list executed in scanline order
+ * @details Draw helpers append compact commands into a fixed arena instead
+ *          of issuing LGFX primitives directly; execute() then replays them
+ *          bucketed by layer and top scanline. The batch runs inside one
+ *          startWrite/endWrite, text state (size/color/datum) is applied
+ *          only when it differs from the previous command, and a command
+ *          whose bounding box misses the active clip rect is rejected
+ *          before LGFX's per-primitive clip walk ever runs. Walking the
+ *          sprite top-to-bottom also keeps the row pointers cache-warm.
+ *
+ *          Layers preserve intentional overdraw (a header painted over
+ *          cards that slid beneath it); within one layer commands must not
+ *          overlap, which is what makes the scanline sort output-neutral.
+ *          Fixed capacity, no heap; on overflow the buffered commands are
+ *          flushed to the canvas and appending continues.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <M5GFX.h>
+
+namespace ui {
+
+/**
+ * @brief Fixed-capacity draw-command arena for one frame
+ */
+class DrawList {
+public:
+    static constexpr size_t kMaxCmds = 96;        ///< Command arena capacity
+    static constexpr size_t kTextPoolBytes = 768; ///< String storage capacity
+
+    /**
+     * @brief Start a new frame batch
+     * @param canvas Target sprite; retained for overflow flushes
+     */
+    void begin(LGFX_Sprite* canvas) noexcept {
+        canvas_ = canvas;
+        count_ = 0;
+        text_used_ = 0;
+    }
+
+    /** @brief Append a filled rectangle */
+    void fillRect(uint8_t layer, int16_t x, int16_t y, int16_t w, int16_t h,
+                  uint16_t color) noexcept {
+        Cmd& c = alloc_(Op::FillRect, layer, x, y, w, h, color);
+        c.r = 0;
+    }
+
+    /** @brief Append a filled rounded rectangle */
+    void fillRoundRect(uint8_t layer, int16_t x, int16_t y, int16_t w, int16_t h,
+                       int16_t r, uint16_t color) noexcept {
+        Cmd& c = alloc_(Op::FillRoundRect, layer, x, y, w, h, color);
+        c.r = r;
+    }
+
+    /** @brief Append a rounded rectangle outline */
+    void drawRoundRect(uint8_t layer, int16_t x, int16_t y, int16_t w, int16_t h,
+                       int16_t r, uint16_t color) noexcept {
+        Cmd& c = alloc_(Op::DrawRoundRect, layer, x, y, w, h, color);
+        c.r = r;
+    }
+
+    /** @brief Append an anti-aliased filled circle (x,y = center) */
+    void fillSmoothCircle(uint8_t layer, int16_t x, int16_t y, int16_t r,
+                          uint16_t color) noexcept {
+        Cmd& c = alloc_(Op::FillSmoothCircle, layer,
+                        static_cast<int16_t>(x - r), static_cast<int16_t>(y - r),
+                        static_cast<int16_t>(2 * r + 1), static_cast<int16_t>(2 * r + 1), color);
+        c.r = r;
+    }
+
+    /**
+     * @brief Append a string
+     * @param datum Text datum applied for this string (top_left and
+     *              middle_left get a tight reject box; anything else is
+     *              drawn unconditionally)
+     */
+    void text(uint8_t layer, const char* s, int16_t x, int16_t y, uint8_t size,
+              uint16_t color, textdatum_t datum = textdatum_t::top_left) noexcept {
+        const size_t len = std::strlen(s) + 1;
+        if (text_used_ + len > kTextPoolBytes) {
+            flush_();
+        }
+        Cmd& c = alloc_(Op::Text, layer, x, y, 0, 0, color);
+        c.size = size;
+        c.datum = static_cast<uint8_t>(datum);
+        c.text_off = static_cast<uint16_t>(text_used_);
+        std::memcpy(&text_pool_[text_used_], s, len);
+        text_used_ += len;
+    }
+
+    /**
+     * @brief Replay the batch, layer-major then top scanline within a layer
+     */
+    void execute() noexcept {
+        if (canvas_ == nullptr) {
+            return;
+        }
+        // Insertion sort of indices by (layer, top y); equal keys keep
+        // append order. Frames hold a few dozen commands, so this beats
+        // anything with allocation or recursion.
+        uint8_t order[kMaxCmds];
+        for (size_t i = 0; i < count_; ++i) {
+            const uint32_t key = sortKey_(cmds_[i]);
+            size_t j = i;
+            while (j > 0 && sortKey_(cmds_[order[j - 1]]) > key) {
+                order[j] = order[j - 1];
+                --j;
+            }
+            order[j] = static_cast<uint8_t>(i);
+        }
+
+        int32_t clip_x = 0;
+        int32_t clip_y = 0;
+        int32_t clip_w = 0;
+        int32_t clip_h = 0;
+        canvas_->getClipRect(&clip_x, &clip_y, &clip_w, &clip_h);
+
+        canvas_->startWrite();
+        int cur_size = -1;
+        int32_t cur_color = -1;
+        int cur_datum = -1;
+        for (size_t i = 0; i < count_; ++i) {
+            const Cmd& c = cmds_[order[i]];
+            int16_t bx = c.x;
+            int16_t by = c.y;
+            int16_t bw = c.w;
+            int16_t bh = c.h;
+            bool reject_known = true;
+            if (c.op == Op::Text) {
+                // Conservative GLCD-cell box (6x8 per glyph, scaled).
+                bw = static_cast<int16_t>(std::strlen(&text_pool_[c.text_off]) * 6 * c.size);
+                bh = static_cast<int16_t>(8 * c.size);
+                if (c.datum == static_cast<uint8_t>(textdatum_t::middle_left)) {
+                    by = static_cast<int16_t>(c.y - bh / 2);
+                } else if (c.datum != static_cast<uint8_t>(textdatum_t::top_left)) {
+                    reject_known = false;
+                }
+            }
+            if (reject_known &&
+                (bx >= clip_x + clip_w || by >= clip_y + clip_h ||
+                 bx + bw <= clip_x || by + bh <= clip_y)) {
+                continue;
+            }
+            switch (c.op) {
+                case Op::FillRect:
+                    canvas_->fillRect(c.x, c.y, c.w, c.h, c.color);
+                    break;
+                case Op::FillRoundRect:
+                    canvas_->fillRoundRect(c.x, c.y, c.w, c.h, c.r, c.color);
+                    break;
+                case Op::DrawRoundRect:
+                    canvas_->drawRoundRect(c.x, c.y, c.w, c.h, c.r, c.color);
+                    break;
+                case Op::FillSmoothCircle:
+                    canvas_->fillSmoothCircle(static_cast<int16_t>(c.x + c.r),
+                                              static_cast<int16_t>(c.y + c.r), c.r, c.color);
+                    break;
+                case Op::Text:
+                    if (cur_size != c.size) {
+                        canvas_->setTextSize(c.size);
+                        cur_size = c.size;
+                    }
+                    if (cur_color != c.color) {
+                        canvas_->setTextColor(c.color);
+                        cur_color = c.color;
+                    }
+                    if (cur_datum != c.datum) {
+                        canvas_->setTextDatum(static_cast<textdatum_t>(c.datum));
+                        cur_datum = c.datum;
+                    }
+                    canvas_->drawString(&text_pool_[c.text_off], c.x, c.y);
+                    break;
+            }
+        }
+        canvas_->endWrite();
+        if (cur_datum >= 0 && cur_datum != static_cast<int>(textdatum_t::top_left)) {
+            canvas_->setTextDatum(textdatum_t::top_left);  // restore default
+        }
+        count_ = 0;
+        text_used_ = 0;
+    }
+
+private:
+    enum class Op : uint8_t { FillRect, FillRoundRect, DrawRoundRect, FillSmoothCircle, Text };
+
+    /// One compact command (20 bytes)
+    struct Cmd {
+        Op op;              ///< Primitive
+        uint8_t layer;      ///< Overdraw layer (low paints first)
+        uint8_t size;       ///< Text size (Text only)
+        uint8_t datum;      ///< Text datum (Text only)
+        int16_t x, y, w, h; ///< Bounding box / geometry
+        int16_t r;          ///< Corner or circle radius
+        uint16_t color;     ///< RGB565
+        uint16_t text_off;  ///< Offset into the string pool (Text only)
+    };
+
+    static uint32_t sortKey_(const Cmd& c) noexcept {
+        // layer major, top scanline minor (y biased into unsigned range).
+        return (static_cast<uint32_t>(c.layer) << 17) |
+               static_cast<uint32_t>(static_cast<int32_t>(c.y) + 0x8000);
+    }
+
+    Cmd& alloc_(Op op, uint8_t layer, int16_t x, int16_t y, int16_t w, int16_t h,
+                uint16_t color) noexcept {
+        if (count_ >= kMaxCmds) {
+            flush_();
+        }
+        Cmd& c = cmds_[count_++];
+        c.op = op;
+        c.layer = layer;
+        c.size = 0;
+        c.datum = 0;
+        c.x = x;
+        c.y = y;
+        c.w = w;
+        c.h = h;
+        c.r = 0;
+        c.color = color;
+        c.text_off = 0;
+        return c;
+    }
+
+    /// Arena full: replay what is buffered and keep appending. Ordering
+    /// across the flush boundary degrades to append order, which is the
+    /// pre-DrawList behavior and always correct.
+    void flush_() noexcept { execute(); }
+
+    LGFX_Sprite* canvas_ = nullptr;   ///< Batch target
+    Cmd cmds_[kMaxCmds] = {};         ///< Command arena
+    size_t count_ = 0;                ///< Commands buffered
+    char text_pool_[kTextPoolBytes] = {}; ///< String storage
+    size_t text_used_ = 0;            ///< Pool bytes used
+};
+
+} // namespace ui
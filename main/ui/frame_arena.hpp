@@ -0,0 +1,96 @@
+/**
+ * @file frame_arena.hpp
+ * @brief Fixed per-frame bump allocator for transient render scratch
+ * @details One block, reset at the top of every renderFrame_ pass: draw
+ *          helpers bump-allocate formatting buffers and short-lived
+ *          temporaries from it instead of sizing stack arrays per call
+ *          site, so the render task's stack stays flat no matter how many
+ *          rows a page formats and nothing in the frame path touches the
+ *          heap next to the 115KB canvas. Exhaustion degrades gracefully
+ *          (alloc returns nullptr, fmt returns ""), and the high-water
+ *          mark is kept so diagnostics can show real usage against the
+ *          capacity.
+ */
+
+#pragma once
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace ui {
+
+/**
+ * @brief Bump allocator backing one frame's transient allocations
+ */
+class FrameArena {
+public:
+    static constexpr size_t kCapacity = 2048;  ///< Scratch block size in bytes
+
+    /**
+     * @brief Start a new frame; all previous allocations become invalid
+     */
+    void reset() noexcept {
+        if (used_ > high_water_) {
+            high_water_ = used_;
+        }
+        used_ = 0;
+    }
+
+    /**
+     * @brief Allocate @p bytes of frame-lifetime scratch
+     * @param bytes Allocation size
+     * @return 4-byte-aligned pointer, or nullptr if the arena is exhausted
+     */
+    void* alloc(size_t bytes) noexcept {
+        const size_t aligned = (bytes + 3U) & ~size_t{3U};
+        if (used_ + aligned > kCapacity) {
+            ++overflows_;
+            return nullptr;
+        }
+        void* p = &block_[used_];
+        used_ += aligned;
+        return p;
+    }
+
+    /**
+     * @brief printf into arena-owned storage
+     * @details The string lives until the next reset(), so a draw helper can
+     *          format once and hand the pointer to later drawing stages. On
+     *          exhaustion returns a static empty string rather than nullptr,
+     *          keeping callers branch-free.
+     * @param cap Buffer size to reserve (formatting truncates to it)
+     * @param fmt printf format
+     * @return Formatted string, or "" if the arena is exhausted
+     */
+    const char* fmt(size_t cap, const char* fmt, ...) noexcept
+        __attribute__((format(printf, 3, 4))) {
+        char* buf = static_cast<char*>(alloc(cap));
+        if (buf == nullptr) {
+            return "";
+        }
+        va_list args;
+        va_start(args, fmt);
+        vsnprintf(buf, cap, fmt, args);
+        va_end(args);
+        return buf;
+    }
+
+    /** @brief Bytes allocated in the current frame */
+    size_t used() const noexcept { return used_; }
+
+    /** @brief Largest bytes any completed frame has allocated */
+    size_t highWater() const noexcept { return high_water_; }
+
+    /** @brief Allocations refused since boot (capacity undersized if > 0) */
+    uint32_t overflows() const noexcept { return overflows_; }
+
+private:
+    alignas(4) uint8_t block_[kCapacity];  ///< Backing storage
+    size_t used_ = 0;                      ///< Bump offset in the current frame
+    size_t high_water_ = 0;                ///< Peak usage across frames
+    uint32_t overflows_ = 0;               ///< Refused allocations since boot
+};
+
+} // namespace ui
@@ -0,0 +1,292 @@
+/**
+ * @file ring_raster.hpp
+ * @brief Integer span rasterizer for the fixed-geometry progress rings
+ * @details LGFX's fillArc computes per-pixel float coverage over the arc's
+ *          bounding box, which makes the ring-heavy frames (LiveCounter
+ *          progress arc, popup hint arc) among the most expensive draws per
+ *          frame. This firmware only ever draws a handful of ring
+ *          geometries, all centered and all over a flat background color,
+ *          so a specialized path wins: per-radius edge tables (built once
+ *          per radius with incremental integer square roots, cached across
+ *          frames) turn each scanline into solid spans emitted as fast
+ *          hlines plus a short run of edge pixels whose antialiasing
+ *          coverage comes from the pixel's squared radial distance - no
+ *          float math and no sqrt anywhere in the raster loop. Angular
+ *          clipping for partial sweeps is two integer cross products per
+ *          candidate pixel, with the same linear-coverage treatment on the
+ *          radial cut lines. Because the background is known, edge pixels
+ *          blend against it directly instead of reading the canvas back.
+ */
+
+#pragma once
+
+#include <M5Unified.h>
+#include <cstdint>
+#include <cmath>
+
+#include "ui_theme.hpp"
+
+namespace ui {
+namespace ring {
+
+namespace detail {
+
+constexpr int16_t MAX_RADIUS_ = 120;   ///< Largest ring radius on a 240px panel
+constexpr size_t TABLE_SLOTS_ = 8;     ///< Cached radii (the UI uses ~6)
+constexpr uint8_t NO_X_ = 0xFF;        ///< Sentinel: no pixel of this class on the line
+
+/**
+ * @brief Per-radius edge table: span limits for every scanline offset
+ * @details full[dy] is the last |x| whose pixel center lies at least half a
+ *          pixel inside radius r (fully covered); edge[dy] is the last |x|
+ *          the radius touches at all. Between the two is the antialiased
+ *          edge band. Built once per radius, reused every frame.
+ */
+struct EdgeTable {
+    int16_t r = -1;
+    uint8_t full[MAX_RADIUS_ + 1];
+    uint8_t edge[MAX_RADIUS_ + 1];
+};
+
+inline EdgeTable s_tables_[TABLE_SLOTS_];
+inline size_t s_table_rr_ = 0;  ///< Round-robin victim if all slots are taken
+
+inline const EdgeTable* tableFor(int16_t r) noexcept
+{
+    if (r <= 0 || r > MAX_RADIUS_) {
+        return nullptr;
+    }
+    EdgeTable* slot = nullptr;
+    for (size_t i = 0; i < TABLE_SLOTS_; ++i) {
+        if (s_tables_[i].r == r) {
+            return &s_tables_[i];
+        }
+        if (slot == nullptr && s_tables_[i].r < 0) {
+            slot = &s_tables_[i];
+        }
+    }
+    if (slot == nullptr) {
+        slot = &s_tables_[s_table_rr_];
+        s_table_rr_ = (s_table_rr_ + 1) % TABLE_SLOTS_;
+    }
+
+    // (r +/- 0.5)^2 = r^2 +/- r + 0.25; with integer pixel-center distances
+    // the quarter never matters, so the thresholds stay integral.
+    const int32_t full_limit = static_cast<int32_t>(r) * r - r;
+    const int32_t edge_limit = static_cast<int32_t>(r) * r + r;
+    int32_t x_full = r;
+    int32_t x_edge = r;
+    for (int32_t dy = 0; dy <= r; ++dy) {
+        const int32_t dy2 = dy * dy;
+        // x limits shrink monotonically with dy: walk them down instead of
+        // recomputing a square root per line.
+        while (x_full >= 0 && x_full * x_full > full_limit - dy2) {
+            --x_full;
+        }
+        while (x_edge >= 0 && x_edge * x_edge > edge_limit - dy2) {
+            --x_edge;
+        }
+        slot->full[dy] = (x_full >= 0) ? static_cast<uint8_t>(x_full) : NO_X_;
+        slot->edge[dy] = (x_edge >= 0) ? static_cast<uint8_t>(x_edge) : NO_X_;
+    }
+    slot->r = r;
+    return slot;
+}
+
+/// Angular clip state for one sweep, precomputed per call.
+struct WedgeClip {
+    bool active;       ///< False for full-circle sweeps (no tests at all)
+    bool wide;         ///< Sweep > 180 deg: union of half-planes, not intersection
+    bool aa_start;     ///< Antialias the start cut (false when extending an arc)
+    int32_t v0x, v0y;  ///< Start-boundary direction, 8.8 fixed point
+    int32_t v1x, v1y;  ///< End-boundary direction, 8.8 fixed point
+};
+
+/**
+ * @brief Coverage of pixel (dx, dy) against the wedge, 0..255
+ * @details Cross products against the boundary rays give signed
+ *          perpendicular distance in 1/256 px; within half a pixel of a cut
+ *          line that maps linearly to coverage, which is exactly the edge
+ *          treatment the solid interior needs to look continuous.
+ */
+inline uint8_t wedgeCoverage(const WedgeClip& w, int32_t dx, int32_t dy) noexcept
+{
+    if (!w.active) {
+        return 255;
+    }
+    const int32_t c0 = w.v0x * dy - w.v0y * dx;
+    const int32_t c1 = dx * w.v1y - dy * w.v1x;
+    const int32_t a0 = !w.aa_start ? (c0 >= 0 ? 255 : 0)
+                                   : (c0 > 127) ? 255 : (c0 < -128 ? 0 : 128 + c0);
+    const int32_t a1 = (c1 > 127) ? 255 : (c1 < -128 ? 0 : 128 + c1);
+    const int32_t a = w.wide ? ((a0 > a1) ? a0 : a1) : ((a0 < a1) ? a0 : a1);
+    return static_cast<uint8_t>(a);
+}
+
+/**
+ * @brief Ring coverage of an edge-band pixel from its squared distance
+ * @param d2 dx*dx + dy*dy
+ * @param r Boundary radius
+ * @param outer true for the outer boundary (coverage falls with distance)
+ */
+inline uint8_t radialCoverage(int32_t d2, int32_t r, bool outer) noexcept
+{
+    // d ~= r + (d^2 - r^2) / 2r near the boundary, so coverage
+    // (r + 0.5 - d, clamped) needs one multiply and one divide per pixel.
+    const int32_t delta = ((d2 - r * r) * 64) / r;
+    const int32_t cov = outer ? (128 - delta) : (128 + delta);
+    return static_cast<uint8_t>(cov < 0 ? 0 : (cov > 255 ? 255 : cov));
+}
+
+} // namespace detail
+
+/**
+ * @brief Fill an annular arc with antialiased edges over a flat background
+ * @details Drop-in for canvas->fillArc on centered rings drawn over a known
+ *          solid color. Angles follow the fillArc convention (degrees, 0 at
+ *          3 o'clock, increasing clockwise); a sweep of >= 360 degrees
+ *          takes a span-only fast path with no per-pixel tests.
+ * @param canvas Target sprite
+ * @param cx,cy Ring center
+ * @param r_out Outer radius (<= 120)
+ * @param r_in Inner radius (0 for a filled disc)
+ * @param a0_deg,a1_deg Sweep start/end, a1 >= a0
+ * @param color Ring color (RGB565)
+ * @param bg Background the edges blend toward (RGB565)
+ * @param aa_start Antialias the start cut. Pass false when extending an
+ *                 already-drawn arc in place: the start then lands on solid
+ *                 ring color, and blending toward @p bg there would paint a
+ *                 dark seam at every extension.
+ */
+inline void fillRingArc(LGFX_Sprite* canvas, int16_t cx, int16_t cy,
+                        int16_t r_out, int16_t r_in,
+                        float a0_deg, float a1_deg,
+                        uint16_t color, uint16_t bg,
+                        bool aa_start = true) noexcept
+{
+    using namespace detail;
+    const EdgeTable* out = tableFor(r_out);
+    if (out == nullptr || a1_deg <= a0_deg) {
+        return;
+    }
+    const EdgeTable* in = (r_in > 0) ? tableFor(r_in) : nullptr;
+
+    WedgeClip w{};
+    w.active = (a1_deg - a0_deg) < 360.0f;
+    w.aa_start = aa_start;
+    if (w.active) {
+        const float rad0 = a0_deg * (3.14159265f / 180.0f);
+        const float rad1 = a1_deg * (3.14159265f / 180.0f);
+        w.wide = (a1_deg - a0_deg) > 180.0f;
+        w.v0x = static_cast<int32_t>(cosf(rad0) * 256.0f);
+        w.v0y = static_cast<int32_t>(sinf(rad0) * 256.0f);
+        w.v1x = static_cast<int32_t>(cosf(rad1) * 256.0f);
+        w.v1y = static_cast<int32_t>(sinf(rad1) * 256.0f);
+    }
+
+    for (int32_t dy = -r_out; dy <= r_out; ++dy) {
+        const int32_t ady = (dy < 0) ? -dy : dy;
+        const uint8_t eo = out->edge[ady];
+        if (eo == NO_X_) {
+            continue;
+        }
+        const int32_t x_edge_out = eo;
+        const int32_t x_full_out = (out->full[ady] == NO_X_) ? -1 : out->full[ady];
+        // Hole limits on this line (the ring excludes d < r_in).
+        const int32_t x_hole = (in != nullptr && ady <= r_in && in->full[ady] != NO_X_)
+                                   ? in->full[ady]
+                                   : -1;
+        const int32_t x_edge_in = (in != nullptr && ady <= r_in && in->edge[ady] != NO_X_)
+                                      ? in->edge[ady]
+                                      : -1;
+        const int16_t y = static_cast<int16_t>(cy + dy);
+        const int32_t dy2 = dy * dy;
+
+        // Solid interior: full ring coverage, wedge test only. Runs of
+        // consecutive inside pixels flush as one hline.
+        const int32_t solid_lo = x_edge_in + 1;
+        const int32_t solid_hi = x_full_out;
+        for (int side = 0; side < 2; ++side) {
+            const int32_t sign = (side == 0) ? 1 : -1;
+            int32_t run_start = 0;
+            bool in_run = false;
+            // x=0 belongs to the positive pass; the mirror starts at 1.
+            const int32_t lo = (side == 1 && solid_lo == 0) ? 1 : solid_lo;
+            for (int32_t x = lo; x <= solid_hi; ++x) {
+                const int32_t dx = sign * x;
+                const uint8_t cov = wedgeCoverage(w, dx, dy);
+                if (cov == 255) {
+                    if (!in_run) {
+                        run_start = x;
+                        in_run = true;
+                    }
+                    continue;
+                }
+                if (in_run) {
+                    const int32_t a = sign * run_start;
+                    const int32_t b = sign * (x - 1);
+                    canvas->drawFastHLine(static_cast<int16_t>(cx + ((a < b) ? a : b)), y,
+                                          static_cast<int16_t>(((a < b) ? b - a : a - b) + 1), color);
+                    in_run = false;
+                }
+                if (cov > 0) {
+                    canvas->drawPixel(static_cast<int16_t>(cx + dx), y,
+                                      theme::blend565(color, bg, cov));
+                }
+            }
+            if (in_run) {
+                const int32_t a = sign * run_start;
+                const int32_t b = sign * solid_hi;
+                canvas->drawFastHLine(static_cast<int16_t>(cx + ((a < b) ? a : b)), y,
+                                      static_cast<int16_t>(((a < b) ? b - a : a - b) + 1), color);
+            }
+        }
+        // Edge bands: radial coverage modulated by the wedge.
+        for (int side = 0; side < 2; ++side) {
+            const int32_t sign = (side == 0) ? 1 : -1;
+            // Outer boundary band.
+            for (int32_t x = x_full_out + 1; x <= x_edge_out; ++x) {
+                if (side == 1 && x == 0) {
+                    continue;  // x=0 already drawn by the positive pass
+                }
+                const int32_t dx = sign * x;
+                uint8_t cov = radialCoverage(x * x + dy2, r_out, true);
+                if (cov == 0) {
+                    continue;
+                }
+                const uint8_t wc = wedgeCoverage(w, dx, dy);
+                if (wc == 0) {
+                    continue;
+                }
+                cov = static_cast<uint8_t>((cov * wc) / 255);
+                if (cov > 0) {
+                    canvas->drawPixel(static_cast<int16_t>(cx + dx), y,
+                                      theme::blend565(color, bg, cov));
+                }
+            }
+            // Inner boundary band.
+            for (int32_t x = x_hole + 1; x <= x_edge_in; ++x) {
+                if (side == 1 && x == 0) {
+                    continue;
+                }
+                const int32_t dx = sign * x;
+                uint8_t cov = radialCoverage(x * x + dy2, r_in, false);
+                if (cov == 0) {
+                    continue;
+                }
+                const uint8_t wc = wedgeCoverage(w, dx, dy);
+                if (wc == 0) {
+                    continue;
+                }
+                cov = static_cast<uint8_t>((cov * wc) / 255);
+                if (cov > 0) {
+                    canvas->drawPixel(static_cast<int16_t>(cx + dx), y,
+                                      theme::blend565(color, bg, cov));
+                }
+            }
+        }
+    }
+}
+
+} // namespace ring
+} // namespace ui
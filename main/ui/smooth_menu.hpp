@@ -20,7 +20,127 @@
 namespace ui {
 
 /**
- * @brief LVGL-style animation easing functions
+ * @brief Q16.16 fixed-point animation math
+ * @details The animation system runs on Q16.16 integers instead of float
+ *          pow/sin: polynomial easing is plain multiplies, trigonometry is a
+ *          quarter-wave lookup table with linear interpolation, and timing
+ *          math is exact integer arithmetic, so evaluation cost and results
+ *          are deterministic on the S3 (which has no fast float pow).
+ *          Angles use 16-bit binary angle measure: 0..65535 = one full turn.
+ */
+namespace fp {
+
+using q16 = int32_t;  ///< Q16.16 fixed-point value
+
+static constexpr q16 kOne = 1 << 16;  ///< 1.0 in Q16.16
+
+/// Convert float to Q16.16
+constexpr q16 fromFloat(float v) {
+    return static_cast<q16>(v * 65536.0f + (v >= 0.0f ? 0.5f : -0.5f));
+}
+
+/// Convert Q16.16 to float
+constexpr float toFloat(q16 v) {
+    return static_cast<float>(v) / 65536.0f;
+}
+
+/// Q16.16 multiply (widened to 64 bit, truncating)
+constexpr q16 mul(q16 a, q16 b) {
+    return static_cast<q16>((static_cast<int64_t>(a) * b) >> 16);
+}
+
+namespace detail {
+
+/// Taylor-series sine for |x| <= pi/2; constexpr so the LUT is built at
+/// compile time (std::sin is not constexpr here).
+constexpr float sinTaylor(float x) {
+    const float x2 = x * x;
+    return x * (1.0f - x2 / 6.0f * (1.0f - x2 / 20.0f * (1.0f - x2 / 42.0f * (1.0f - x2 / 72.0f))));
+}
+
+/// Quarter-wave sine table: kSinLutSize steps over [0, pi/2], Q16.16.
+static constexpr int kSinLutSize = 64;
+
+struct SinTable {
+    q16 entry[kSinLutSize + 1];
+};
+
+constexpr SinTable makeSinTable() {
+    constexpr float kHalfPi = 1.57079632679f;
+    SinTable table{};
+    for (int i = 0; i <= kSinLutSize; ++i) {
+        const float x = kHalfPi * static_cast<float>(i) / static_cast<float>(kSinLutSize);
+        table.entry[i] = fromFloat(sinTaylor(x));
+    }
+    return table;
+}
+
+inline constexpr SinTable kSinLut = makeSinTable();
+
+} // namespace detail
+
+/**
+ * @brief Sine from the quarter-wave LUT
+ * @param angle Binary angle (0..65535 = full turn)
+ * @return sin(angle) in Q16.16
+ */
+constexpr q16 sin(uint16_t angle) {
+    // Fold the full turn onto the first quadrant via symmetry.
+    const uint16_t quadrant = angle >> 14;          // 0..3
+    uint16_t a = angle & 0x3FFF;                    // Position within quadrant
+    if (quadrant & 1) {
+        a = static_cast<uint16_t>(0x4000 - a);
+    }
+    // 14-bit quadrant position -> LUT index + interpolation fraction.
+    const int idx = a >> 8;                         // 0..64
+    const q16 frac = static_cast<q16>(a & 0xFF) << 8;  // Q16 fraction of a step
+    const q16 s0 = detail::kSinLut.entry[idx];
+    const q16 s1 = detail::kSinLut.entry[idx < detail::kSinLutSize ? idx + 1 : detail::kSinLutSize];
+    const q16 s = s0 + mul(s1 - s0, frac);
+    return (quadrant >= 2) ? -s : s;
+}
+
+/**
+ * @brief Cosine from the quarter-wave LUT
+ * @param angle Binary angle (0..65535 = full turn)
+ * @return cos(angle) in Q16.16
+ */
+constexpr q16 cos(uint16_t angle) {
+    return fp::sin(static_cast<uint16_t>(angle + 0x4000));
+}
+
+/**
+ * @brief Overshoot easing in Q16.16 (may exceed 1.0 temporarily)
+ * @param t Progress (0..kOne)
+ */
+constexpr q16 overshoot(q16 t) {
+    constexpr q16 c1 = fromFloat(1.70158f);
+    constexpr q16 c3 = c1 + kOne;
+    const q16 u = t - kOne;
+    const q16 u2 = mul(u, u);
+    return kOne + mul(c3, mul(u2, u)) + mul(c1, u2);
+}
+
+/**
+ * @brief Ease-out cubic in Q16.16
+ * @param t Progress (0..kOne)
+ */
+constexpr q16 easeOutCubic(q16 t) {
+    const q16 u = kOne - t;
+    return kOne - mul(u, mul(u, u));
+}
+
+/**
+ * @brief Linear interpolation in Q16.16
+ */
+constexpr q16 lerp(q16 a, q16 b, q16 t) {
+    return a + mul(b - a, t);
+}
+
+} // namespace fp
+
+/**
+ * @brief LVGL-style animation easing functions (float facade over fp::)
  */
 namespace ease {
 
@@ -30,16 +150,14 @@ namespace ease {
  * @return Eased value (may exceed 1.0 temporarily)
  */
 inline float overshoot(float t) {
-    constexpr float c1 = 1.70158f;
-    constexpr float c3 = c1 + 1.0f;
-    return 1.0f + c3 * std::pow(t - 1.0f, 3.0f) + c1 * std::pow(t - 1.0f, 2.0f);
+    return fp::toFloat(fp::overshoot(fp::fromFloat(t)));
 }
 
 /**
  * @brief Ease-out cubic
  */
 inline float easeOutCubic(float t) {
-    return 1.0f - std::pow(1.0f - t, 3.0f);
+    return fp::toFloat(fp::easeOutCubic(fp::fromFloat(t)));
 }
 
 /**
@@ -53,6 +171,9 @@ inline float lerp(float a, float b, float t) {
 
 /**
  * @brief Animated position value with easing
+ * @details Float-facing API; all internal arithmetic is Q16.16 so repeated
+ *          evaluation per frame (selector X/Y, scroll offsets) costs only
+ *          integer multiplies and the timing math is exact.
  */
 class AnimatedValue {
 public:
@@ -68,8 +189,8 @@ public:
      * @param current_time_ms Current time in milliseconds
      */
     void setTarget(float target, uint32_t duration_ms, uint32_t current_time_ms) {
-        start_value_ = getCurrentValue(current_time_ms);
-        target_value_ = target;
+        start_value_ = current_q16_(current_time_ms);
+        target_value_ = fp::fromFloat(target);
         anim_start_ms_ = current_time_ms;
         anim_duration_ms_ = duration_ms;
     }
@@ -80,8 +201,8 @@ public:
      * @param current_time_ms Current time in milliseconds
      */
     void setImmediate(float value, uint32_t current_time_ms) {
-        start_value_ = value;
-        target_value_ = value;
+        start_value_ = fp::fromFloat(value);
+        target_value_ = start_value_;
         anim_start_ms_ = current_time_ms;
         anim_duration_ms_ = 0;
     }
@@ -92,16 +213,7 @@ public:
      * @return Current interpolated value
      */
     float getCurrentValue(uint32_t current_time_ms) const {
-        if (anim_duration_ms_ == 0) {
-            return target_value_;
-        }
-        const uint32_t elapsed = current_time_ms - anim_start_ms_;
-        if (elapsed >= anim_duration_ms_) {
-            return target_value_;
-        }
-        const float t = static_cast<float>(elapsed) / static_cast<float>(anim_duration_ms_);
-        const float eased_t = ease::overshoot(t);
-        return ease::lerp(start_value_, target_value_, eased_t);
+        return fp::toFloat(current_q16_(current_time_ms));
     }
 
     bool isAnimating(uint32_t current_time_ms) const {
@@ -115,11 +227,25 @@ public:
      * @brief Get target value
      * @return Target value
      */
-    float getTarget() const { return target_value_; }
+    float getTarget() const { return fp::toFloat(target_value_); }
 
 private:
-    float start_value_ = 0.0f;          ///< Animation start value
-    float target_value_ = 0.0f;         ///< Animation target value
+    fp::q16 current_q16_(uint32_t current_time_ms) const {
+        if (anim_duration_ms_ == 0) {
+            return target_value_;
+        }
+        const uint32_t elapsed = current_time_ms - anim_start_ms_;
+        if (elapsed >= anim_duration_ms_) {
+            return target_value_;
+        }
+        // Progress in Q16.16: exact integer division, no float rounding.
+        const fp::q16 t = static_cast<fp::q16>(
+            (static_cast<uint64_t>(elapsed) << 16) / anim_duration_ms_);
+        return fp::lerp(start_value_, target_value_, fp::overshoot(t));
+    }
+
+    fp::q16 start_value_ = 0;           ///< Animation start value (Q16.16)
+    fp::q16 target_value_ = 0;          ///< Animation target value (Q16.16)
     uint32_t anim_start_ms_ = 0;        ///< Animation start time
     uint32_t anim_duration_ms_ = 0;    ///< Animation duration
 };
@@ -186,6 +312,8 @@ public:
      */
     CircularMenuSelector() = default;
 
+    static constexpr int kMaxItems = 12;  ///< Maximum supported menu items
+
     /**
      * @brief Initialize menu selector with configuration
      * @param config Menu configuration
@@ -293,28 +421,28 @@ public:
     int getNumItems() const { return num_items_; }
 
 private:
-    static constexpr int kMaxItems = 12;  ///< Maximum supported menu items
-    static constexpr float kPi = 3.14159265f;  ///< Pi constant
-
     /**
      * @brief Compute icon and selector positions in a circle
      */
     void computePositions_() {
-        // Pre-compute icon and selector positions in a circle
-        // Start from -90 degrees (12 o'clock position) and go clockwise
-        const float start_angle = -kPi / 2.0f;
-        const float angle_step = (2.0f * kPi) / static_cast<float>(num_items_);
-        
+        // Pre-compute icon and selector positions in a circle using the
+        // quarter-wave LUT. Angles are 16-bit binary angle measure; start
+        // from -90 degrees (12 o'clock position) and go clockwise.
+        const uint16_t start_angle = 0xC000;  // -90 degrees
+        const uint16_t angle_step = static_cast<uint16_t>(0x10000u / static_cast<uint32_t>(num_items_));
+
         for (int i = 0; i < num_items_ && i < kMaxItems; ++i) {
-            const float angle = start_angle + static_cast<float>(i) * angle_step;
-            
+            const uint16_t angle = static_cast<uint16_t>(start_angle + static_cast<uint16_t>(i) * angle_step);
+            const float cos_a = fp::toFloat(fp::cos(angle));
+            const float sin_a = fp::toFloat(fp::sin(angle));
+
             // Icon positions (outer ring)
-            icon_positions_[i].x = config_.center_x + config_.icon_radius * std::cos(angle);
-            icon_positions_[i].y = config_.center_y + config_.icon_radius * std::sin(angle);
-            
+            icon_positions_[i].x = config_.center_x + config_.icon_radius * cos_a;
+            icon_positions_[i].y = config_.center_y + config_.icon_radius * sin_a;
+
             // Selector positions (inner ring)
-            selector_positions_[i].x = config_.center_x + config_.selector_radius * std::cos(angle);
-            selector_positions_[i].y = config_.center_y + config_.selector_radius * std::sin(angle);
+            selector_positions_[i].x = config_.center_x + config_.selector_radius * cos_a;
+            selector_positions_[i].y = config_.center_y + config_.selector_radius * sin_a;
         }
     }
 
@@ -0,0 +1,48 @@
+/**
+ * @file sprite_mem.hpp
+ * @brief Memory placement policy for retained UI sprites
+ * @details The shipping M5Dial (StampS3) has no PSRAM, so every cache
+ *          competes with the WiFi stack for internal SRAM. On board
+ *          variants that do carry PSRAM this helper tiers the memory:
+ *          retained sprites that are rendered rarely and blitted within
+ *          the canvas (settings row cards, digit glyphs) move to PSRAM,
+ *          while anything on the per-frame flush path - the main canvas
+ *          and the DMA bounce buffers - stays internal, since the panel
+ *          push needs DMA-capable memory and PSRAM reads would gate the
+ *          SPI transfer. Without PSRAM everything behaves exactly as
+ *          before; callers never branch.
+ */
+
+#pragma once
+
+#include <lgfx/v1/LGFX_Sprite.hpp>
+
+#include "esp_heap_caps.h"
+
+namespace ui {
+namespace sprite_mem {
+
+/**
+ * @brief Whether the running board has any PSRAM at all
+ */
+inline bool PsramAvailable() noexcept
+{
+    static const bool available = heap_caps_get_total_size(MALLOC_CAP_SPIRAM) > 0;
+    return available;
+}
+
+/**
+ * @brief Mark a retained sprite for PSRAM backing where the board has it
+ * @details Call before createSprite(); LGFX only consults the flag at
+ *          allocation time. No-op on PSRAM-less boards.
+ * @param sprite Sprite whose buffer should prefer PSRAM
+ */
+inline void PlaceRetained(LGFX_Sprite& sprite) noexcept
+{
+    if (PsramAvailable()) {
+        sprite.setPsram(true);
+    }
+}
+
+} // namespace sprite_mem
+} // namespace ui
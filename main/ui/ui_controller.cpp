@@ -5,14 +5,48 @@
 #include "esp_timer.h"
 
 #include "../protocol/espnow_protocol.hpp"
+#include "../protocol/fatigue_errors.hpp"
+#include "../protocol/wire_capture.hpp"
+#include "../blackbox.hpp"
+#include "../audit.hpp"
+#include "../config_validation.hpp"
+#include "../fast_boot.hpp"
+#include "../hot_assert.hpp"
+#include "../input_trace.hpp"
+#include "../trace.hpp"
+#include "../flash_gov.hpp"
+#include "../health_monitor.hpp"
+#include "../lifecycle.hpp"
+#include "../queue_stats.hpp"
+#include "../rfid_badge.hpp"
+#include "../run_db.hpp"
+#include "../self_test.hpp"
+#include "../session_log.hpp"
+#include "../session_restore.hpp"
 #include "../settings.hpp"
+#include "../storage_maint.hpp"
+#include "../telemetry_bridge.hpp"
+#include "../thermal.hpp"
+#include "../timebase.hpp"
 #include "../config.hpp"
 
+#include "ui/blend565.hpp"
+#include "ui/display_tuner.hpp"
+#include "ui/ring_raster.hpp"
+#include "ui/sprite_mem.hpp"
 #include "ui/ui_theme.hpp"
 
 #include <algorithm>
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
+#include "esp_system.h"
+#include "esp_sleep.h"
+#include "esp_rom_sys.h"
 #include <inttypes.h>
 #include <cmath>
 
@@ -20,7 +54,10 @@ static const char* TAG_ = "ui";
 
 // Alias for convenience
 namespace th = ui::theme;
-namespace colors = ui::theme::colors;
+// All color reads resolve through the active theme table: one pointer
+// load per lookup, so a runtime th::SetTheme() swap restyles every page
+// on its next frame with no per-draw color math.
+static inline const ui::theme::Theme& thm() noexcept { return ui::theme::active(); }
 
 namespace {
 static const char* const kUnitRevPerS2 = reinterpret_cast<const char*>(u8"rev/s\u00B2");
@@ -47,12 +84,64 @@ static void applyConfigToSettings_(Settings& s, const fatigue_proto::ConfigPaylo
 }
 }
 
+namespace {
+
+// Selection glow, pre-baked. The landing background is black, so "alpha
+// blend over the background" collapses to scaling the theme color by the
+// alpha - no per-pixel blending survives to runtime. Each menu color gets
+// its ring colors computed at compile time; drawing the glow is then just
+// concentric 1px circles in precomputed RGB565, O(glow circumference)
+// integer work.
+constexpr uint8_t kGlowLevels_[] = {148, 110, 78, 52, 30, 14};  ///< alpha/256 per ring, inner to outer
+constexpr int kGlowRings_ = static_cast<int>(sizeof(kGlowLevels_));
+
+constexpr uint16_t glowDim565_(uint16_t c, uint8_t level)
+{
+    const uint16_t r = static_cast<uint16_t>((((c >> 11) & 0x1F) * level) >> 8);
+    const uint16_t g = static_cast<uint16_t>((((c >> 5) & 0x3F) * level) >> 8);
+    const uint16_t b = static_cast<uint16_t>(((c & 0x1F) * level) >> 8);
+    return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+struct GlowRamp {
+    uint16_t ring[kGlowRings_];  ///< Ring colors, innermost first
+};
+
+constexpr GlowRamp makeGlowRamp_(uint16_t color)
+{
+    GlowRamp ramp{};
+    for (int i = 0; i < kGlowRings_; ++i) {
+        ramp.ring[i] = glowDim565_(color, kGlowLevels_[i]);
+    }
+    return ramp;
+}
+
+// Order matches kMenuItems_ below.
+constexpr GlowRamp kMenuGlow_[] = {
+    makeGlowRamp_(ui::assets::CircularIconColors::red),
+    makeGlowRamp_(ui::assets::CircularIconColors::blue),
+    makeGlowRamp_(ui::assets::CircularIconColors::green),
+    makeGlowRamp_(ui::assets::CircularIconColors::teal),
+    makeGlowRamp_(ui::assets::CircularIconColors::orange),
+    makeGlowRamp_(ui::assets::CircularIconColors::cyan),
+    makeGlowRamp_(ui::assets::CircularIconColors::mint),
+    makeGlowRamp_(ui::assets::CircularIconColors::gray),
+    makeGlowRamp_(ui::assets::CircularIconColors::purple),
+};
+
+}  // namespace
+
 // Static menu item definitions matching M5Dial factory demo style
 const ui::UiController::CircularMenuItem ui::UiController::kMenuItems_[MENU_COUNT_] = {
-    {"Settings", nullptr, ui::assets::CircularIconColors::red, ui::assets::kCircularIcon_settings, 42, 42, Page::Settings},
-    {"Find", "Bounds", ui::assets::CircularIconColors::blue, ui::assets::kCircularIcon_bounds, 42, 42, Page::Bounds},
-    {"Live", "Counter", ui::assets::CircularIconColors::green, ui::assets::kCircularIcon_live, 42, 42, Page::LiveCounter},
-    {"Terminal", nullptr, ui::assets::CircularIconColors::teal, ui::assets::kCircularIcon_terminal, 42, 42, Page::Terminal},
+    {"Settings", nullptr, ui::assets::CircularIconColors::red, &ui::assets::kCircularIcon_settings, Page::Settings},
+    {"Find", "Bounds", ui::assets::CircularIconColors::blue, &ui::assets::kCircularIcon_bounds, Page::Bounds},
+    {"Live", "Counter", ui::assets::CircularIconColors::green, &ui::assets::kCircularIcon_live, Page::LiveCounter},
+    {"Terminal", nullptr, ui::assets::CircularIconColors::teal, &ui::assets::kCircularIcon_terminal, Page::Terminal},
+    {"Link", "Stats", ui::assets::CircularIconColors::orange, &ui::assets::kCircularIcon_wifi, Page::Diagnostics},
+    {"History", nullptr, ui::assets::CircularIconColors::cyan, &ui::assets::kCircularIcon_history, Page::History},
+    {"Time", "Line", ui::assets::CircularIconColors::mint, &ui::assets::kCircularIcon_history, Page::Timeline},
+    {"Fleet", nullptr, ui::assets::CircularIconColors::gray, &ui::assets::kCircularIcon_more, Page::Fleet},
+    {"Dash", "Board", ui::assets::CircularIconColors::purple, &ui::assets::kCircularIcon_live, Page::Dashboard},
 };
 
 ui::UiController::UiController(QueueHandle_t proto_events, Settings* settings) noexcept
@@ -64,10 +153,58 @@ ui::UiController::UiController(QueueHandle_t proto_events, Settings* settings) n
 
 void ui::UiController::Init() noexcept
 {
-    // Encoder: rotation on A/B; click handled via M5.BtnA or touch.
+    // Encoder: rotation on A/B. The button GPIO is owned by M5Unified, so
+    // its state is fed into the driver's gesture classifier each tick and
+    // clicks/long presses/chords come back as typed events. 500 ms matches
+    // the M5.BtnA hold threshold this UI was tuned against; the double-click
+    // window stays 0 (disabled) so single clicks keep zero added latency.
     (void)encoder_.begin();
+    encoder_.setGestureTiming(500, 0);
     encoder_pos_ = encoder_.getPosition();
 
+    // Combined event source for the tick loop: proto queue + encoder queue.
+    // Queues must be empty when added to a set; this runs before any traffic
+    // is expected, and on failure Tick() degrades to a fixed short wait.
+    event_set_ = xQueueCreateSet(21);  // proto 10 + encoder 10 + touch IRQ 1
+    if (event_set_ != nullptr) {
+        bool set_ok = true;
+        if (proto_events_ != nullptr) {
+            set_ok = set_ok && (xQueueAddToSet(proto_events_, event_set_) == pdPASS);
+        }
+        if (auto* q = encoder_.getEventQueue(); q != nullptr) {
+            set_ok = set_ok && (xQueueAddToSet(q, event_set_) == pdPASS);
+        }
+        if (!set_ok) {
+            vQueueDelete(event_set_);
+            event_set_ = nullptr;
+            ESP_LOGW(TAG_, "Event set unavailable; tick falls back to fixed wait");
+        }
+    }
+
+    // Touch-down wake: the touch INT line's falling edge joins the event
+    // set through a length-1 queue, so first contact ends the idle wait
+    // immediately. The ISR service is shared with the encoder and badge
+    // reader; on any failure touch falls back to the polled cadence.
+    if (event_set_ != nullptr) {
+        touch_irq_queue_ = xQueueCreate(1, sizeof(uint8_t));
+        if (touch_irq_queue_ != nullptr &&
+            xQueueAddToSet(touch_irq_queue_, event_set_) == pdPASS) {
+            const esp_err_t isr_err = gpio_install_isr_service(0);
+            const bool isr_ok = (isr_err == ESP_OK || isr_err == ESP_ERR_INVALID_STATE) &&
+                gpio_set_intr_type(DIAL_TOUCH_INT_PIN_, GPIO_INTR_NEGEDGE) == ESP_OK &&
+                gpio_isr_handler_add(DIAL_TOUCH_INT_PIN_, touchIrqIsr_, this) == ESP_OK;
+            if (!isr_ok) {
+                ESP_LOGW(TAG_, "Touch IRQ unavailable; touch stays polled");
+                (void)xQueueRemoveFromSet(touch_irq_queue_, event_set_);
+                vQueueDelete(touch_irq_queue_);
+                touch_irq_queue_ = nullptr;
+            }
+        } else if (touch_irq_queue_ != nullptr) {
+            vQueueDelete(touch_irq_queue_);
+            touch_irq_queue_ = nullptr;
+        }
+    }
+
     // Create double-buffering canvas sprite (KEY for flicker-free rendering)
     canvas_ = new LGFX_Sprite(&M5.Display);
     if (canvas_ != nullptr) {
@@ -75,86 +212,970 @@ void ui::UiController::Init() noexcept
         canvas_->createSprite(SCREEN_SIZE_, SCREEN_SIZE_);
     }
 
+    // DMA bounce buffers for the async flush path (see flushFrame_).
+    const size_t bounce_bytes = static_cast<size_t>(SCREEN_SIZE_) * kDmaSliceRows_ * 2;
+    dma_bounce_[0] = static_cast<uint16_t*>(heap_caps_malloc(bounce_bytes, MALLOC_CAP_DMA));
+    dma_bounce_[1] = static_cast<uint16_t*>(heap_caps_malloc(bounce_bytes, MALLOC_CAP_DMA));
+    if (dma_bounce_[0] != nullptr && dma_bounce_[1] != nullptr) {
+        dma_flush_ok_ = true;
+    } else {
+        heap_caps_free(dma_bounce_[0]);
+        heap_caps_free(dma_bounce_[1]);
+        dma_bounce_[0] = dma_bounce_[1] = nullptr;
+        ESP_LOGW(TAG_, "DMA bounce buffers unavailable; using synchronous flush");
+    }
+
     // Start with display dark for boot animation
     M5.Display.setBrightness(0);
     M5.Display.fillScreen(TFT_BLACK);
 
-    // Modern Boot Animation
-    if (canvas_ != nullptr) {
-        // Phase 1: Fade In (0 -> 128)
-        const int kSplashBrightness = 128;
-        const int kFadeInSteps = 32;
-        for (int i = 0; i <= kFadeInSteps; i++) {
-            uint32_t t = static_cast<uint32_t>(esp_timer_get_time() / 1000);
-            float p = (float)i / (float)kFadeInSteps;
-            // Progress 0.0 -> 0.4
-            drawBootScreen_(t, p * 0.4f);
-            int b = (int)(p * kSplashBrightness);
-            M5.Display.setBrightness(b);
-            vTaskDelay(pdMS_TO_TICKS(15));
+    // Boot animation runs incrementally on the render task (see
+    // serviceBootAnimation_) instead of inline here, so radio bring-up,
+    // settings load and peer restore on core 0 overlap the splash instead
+    // of queuing behind it. With no canvas there is nothing to animate,
+    // and a warm reset skips the splash outright — the operator already
+    // watched it once, and the restore path wants the live view back on
+    // screen at checkpoint-recovery speed, not splash speed.
+    if (canvas_ != nullptr && !fast_boot::IsWarm()) {
+        boot_phase_ = BootPhase::FadeIn;
+        boot_phase_ms_ = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+        boot_progress_ = 0.0f;
+    } else {
+        boot_phase_ = BootPhase::Done;
+        dirty_ = true;
+        M5.Display.setBrightness(settings_ != nullptr ? settings_->ui.brightness
+                                                      : kBootBrightness_);
+    }
+
+    // Initialize circular menu
+    initCircularMenu_();
+
+    // Periodic poll cadence: two polled buckets on the protocol scheduler
+    // (active-unit status poll, background round-robin), each with its own
+    // jitter so the fleet's airtime never phase-locks. The timing math
+    // lives in the scheduler; Tick only asks whether a token is due.
+    poll_job_ = espnow::RegisterPeriodicJob("ui_poll", 1000, 150, 0, nullptr, nullptr);
+    fleet_poll_job_ = espnow::RegisterPeriodicJob("fleet_poll", 1000, 250, 0, nullptr, nullptr);
+
+    // Kick off initial config request (used as the remote controller's status
+    // poll). With async radio bring-up this may be a no-op; the RadioReady
+    // event re-polls once the stack is actually up.
+    (void)sendConfigRequestActive_();
+
+    // Warm-reset recovery: if the previous session died with a test still
+    // running, arm a restore that jumps back to the live view as soon as
+    // the checkpointed unit shows up in the peer table (see
+    // attemptSessionRestore_). Completed/idle sessions restart at Landing
+    // as usual - there is nothing to get back to.
+    {
+        session_restore::Snapshot snap{};
+        if (session_restore::TakeRestore(snap)) {
+            const auto st = static_cast<fatigue_proto::TestState>(snap.test_state);
+            if (st == fatigue_proto::TestState::Running ||
+                st == fatigue_proto::TestState::Paused) {
+                restore_pending_ = true;
+                std::memcpy(restore_mac_, snap.unit_mac, 6);
+                restore_cmd_ = snap.pending_cmd;
+                restore_deadline_ms_ =
+                    static_cast<uint32_t>(esp_timer_get_time() / 1000) + kRestoreWindow_ms;
+            }
+        }
+    }
+
+    dirty_ = true;
+
+    // Hold the display write transaction open permanently: the panel owns
+    // its SPI bus on the M5Dial, and an open transaction lets pushImageDMA
+    // return while the transfer is still draining (see flushFrame_).
+    if (dma_flush_ok_) {
+        M5.Display.startWrite();
+    }
+
+    // Rendering runs on its own task pinned to core 1 so protocol/input
+    // handling on core 0 (with the WiFi stack) never waits on a frame.
+    ui_mutex_ = xSemaphoreCreateMutex();
+    if (ui_mutex_ != nullptr) {
+        const BaseType_t ok = xTaskCreatePinnedToCore(
+            renderTaskEntry_, "ui_render", kRenderTaskStack_, this,
+            kRenderTaskPrio_, &render_task_, kRenderTaskCore_);
+        if (ok != pdPASS) {
+            render_task_ = nullptr;
+            ESP_LOGE(TAG_, "Failed to create render task; rendering inline");
+        }
+    } else {
+        ESP_LOGE(TAG_, "Failed to create UI mutex; rendering inline");
+    }
+
+    // Beeper player task: input handlers enqueue, this task talks to the
+    // speaker. Priority sits above the render task so audible feedback does
+    // not queue behind a slow frame.
+    beep_queue_ = xQueueCreate(8, sizeof(int));
+    if (beep_queue_ != nullptr &&
+        xTaskCreate(beepTaskEntry_, "ui_beep", kBeepTaskStack_, beep_queue_,
+                    kBeepTaskPrio_, nullptr) != pdPASS) {
+        vQueueDelete(beep_queue_);
+        beep_queue_ = nullptr;
+        ESP_LOGW(TAG_, "Beeper task unavailable; tones play inline");
+    }
+    if (beep_queue_ != nullptr) {
+        qs_beep_ = queue_stats::Register(beep_queue_, "beep", 8);
+    }
+
+    // Detent clicks originate in the encoder driver task from here on:
+    // the tone enqueues at detent time with the driver task's priority
+    // instead of waiting for the tick to drain the rotation event, so
+    // fast spins stay audibly in step with the dial. Rotation handlers
+    // keep only their semantic beeps (rejects, popups, confirmations).
+    encoder_.setDetentFeedback(&UiController::detentFeedbackEntry_, this);
+
+    // Emergency stop: holding the button past 1 s fires in the driver
+    // task and sends Stop through the critical-command path directly,
+    // from any screen. The 500 ms LONG_PRESS gesture still reaches the
+    // UI first - whatever it opened is harmless next to a stop.
+    encoder_.setEmergencyHold(&UiController::emergencyStopEntry_, this);
+
+    ESP_LOGI(TAG_, "UI initialized");
+}
+
+// ============================================================================
+// FRAME-TIME PROFILER
+// ============================================================================
+
+ui::UiController::PerfProbe::PerfProbe(PerfHelperStats& stats) noexcept
+    : stats_(stats), start_cycles_(timebase::CycleStamp())
+{
+}
+
+ui::UiController::PerfProbe::~PerfProbe() noexcept
+{
+    const uint32_t dt = timebase::CycleStamp() - start_cycles_;
+    stats_.cycles += dt;
+    ++stats_.calls;
+    if (dt > stats_.max_cycles) {
+        stats_.max_cycles = dt;
+    }
+}
+
+const char* ui::UiController::perfHelperName_(PerfHelper h) noexcept
+{
+    switch (h) {
+        case PerfHelper::Landing:     return "landing";
+        case PerfHelper::Settings:    return "settings";
+        case PerfHelper::Bounds:      return "bounds";
+        case PerfHelper::Live:        return "live";
+        case PerfHelper::Terminal:    return "terminal";
+        case PerfHelper::Diagnostics: return "diag";
+        case PerfHelper::History:     return "history";
+        case PerfHelper::Timeline:    return "timeline";
+        case PerfHelper::Fleet:       return "fleet";
+        case PerfHelper::Dashboard:   return "dash";
+        case PerfHelper::Flush:       return "flush";
+        default:                      return "?";
+    }
+}
+
+void ui::UiController::perfRecordFrame_(Page page, uint32_t frame_us) noexcept
+{
+    PerfPageStats& ps = perf_pages_[static_cast<size_t>(page)];
+    ps.sum_us += frame_us;
+    ++ps.frames;
+    if (ps.min_us == 0 || frame_us < ps.min_us) {
+        ps.min_us = frame_us;
+    }
+    if (frame_us > ps.max_us) {
+        ps.max_us = frame_us;
+    }
+    perf_last_us_ = frame_us;
+    if (frame_us > kFrameBudget_us_) {
+        ++perf_deadline_misses_;
+    }
+
+    // A/B harness: every frame of an active pass also lands in that
+    // pass's distribution, whatever page the workload script is on.
+    if (ab_phase_ != 0) {
+        AbPassStats& ab = ab_pass_[ab_phase_ - 1];
+        ++ab.frames;
+        ab.sum_us += frame_us;
+        if (frame_us > ab.max_us) {
+            ab.max_us = frame_us;
+        }
+        size_t bucket = 0;
+        for (uint32_t edge_ms = 1; bucket + 1 < kAbBuckets_ && frame_us >= edge_ms * 1000U;
+             ++bucket, edge_ms *= 2) {
+        }
+        ++ab.hist[bucket];
+    }
+}
+
+void ui::UiController::perfReset_() noexcept
+{
+    for (auto& ps : perf_pages_) {
+        ps = PerfPageStats{};
+    }
+    for (auto& hs : perf_helpers_) {
+        hs = PerfHelperStats{};
+    }
+    for (auto& cs : cache_stats_) {
+        cs = CacheCounters{};
+    }
+    cache_warm_us_ = 0;
+    perf_last_us_ = 0;
+    perf_deadline_misses_ = 0;
+    hud_shown_fps_ = ~0U;  // force a HUD repaint with the cleared count
+    hud_shown_ms_ = ~0U;
+    hud_shown_drops_ = ~0U;
+    ab_pass_[0] = AbPassStats{};
+    ab_pass_[1] = AbPassStats{};
+    ab_have_results_ = false;
+}
+
+/** @brief Dump per-page frame stats and per-helper costs to the serial log. */
+void ui::UiController::perfDump_() const noexcept
+{
+    static const char* TAG = "ui_perf";
+    ESP_LOGI(TAG, "frame stats (16 ms budget):");
+    for (size_t p = 0; p < static_cast<size_t>(Page::Count); ++p) {
+        const PerfPageStats& ps = perf_pages_[p];
+        if (ps.frames == 0) {
+            continue;
         }
+        ESP_LOGI(TAG, "  %-8s %6lu frames  min %5lu  avg %5lu  max %5lu us",
+                 pageName_(static_cast<Page>(p)),
+                 static_cast<unsigned long>(ps.frames),
+                 static_cast<unsigned long>(ps.min_us),
+                 static_cast<unsigned long>(ps.sum_us / ps.frames),
+                 static_cast<unsigned long>(ps.max_us));
+    }
+    ESP_LOGI(TAG, "  deadline misses: %lu",
+             static_cast<unsigned long>(perf_deadline_misses_));
+    ESP_LOGI(TAG, "draw helpers:");
+    for (size_t h = 0; h < static_cast<size_t>(PerfHelper::Count); ++h) {
+        const PerfHelperStats& hs = perf_helpers_[h];
+        if (hs.calls == 0) {
+            continue;
+        }
+        ESP_LOGI(TAG, "  %-8s %6lu calls  avg %5lu  max %5lu us",
+                 perfHelperName_(static_cast<PerfHelper>(h)),
+                 static_cast<unsigned long>(hs.calls),
+                 static_cast<unsigned long>(timebase::CyclesToUs(hs.cycles / hs.calls)),
+                 static_cast<unsigned long>(timebase::CyclesToUs(hs.max_cycles)));
+    }
+    ESP_LOGI(TAG, "caches (%lu us spent warming):",
+             static_cast<unsigned long>(cache_warm_us_));
+    for (size_t c = 0; c < static_cast<size_t>(CacheId::Count); ++c) {
+        const CacheCounters& cs = cache_stats_[c];
+        const uint32_t lookups = cs.hits + cs.misses;
+        if (lookups == 0 && cs.warms == 0 && cs.evicts == 0) {
+            continue;
+        }
+        ESP_LOGI(TAG, "  %-8s %6lu hit %5lu miss (%lu%%)  warm %lu  evict %lu",
+                 cacheName_(static_cast<CacheId>(c)),
+                 static_cast<unsigned long>(cs.hits),
+                 static_cast<unsigned long>(cs.misses),
+                 static_cast<unsigned long>(lookups > 0 ? cs.hits * 100U / lookups : 0),
+                 static_cast<unsigned long>(cs.warms),
+                 static_cast<unsigned long>(cs.evicts));
+    }
+    // Per-reason frame rejection table (the Diagnostics page only shows
+    // the total).
+    {
+        espnow::RxRejectStats rej{};
+        espnow::GetRxRejectStats(rej);
+        ESP_LOGI(TAG, "rx rejects: runt %lu  sync %lu  ver %lu  len %lu  crc %lu"
+                      "  peer %lu  payload %lu",
+                 static_cast<unsigned long>(rej.runt),
+                 static_cast<unsigned long>(rej.bad_sync),
+                 static_cast<unsigned long>(rej.bad_version),
+                 static_cast<unsigned long>(rej.bad_length),
+                 static_cast<unsigned long>(rej.bad_crc),
+                 static_cast<unsigned long>(rej.unapproved),
+                 static_cast<unsigned long>(rej.bad_payload));
+    }
+    // Encoder position integrity (the Diagnostics page only shows the
+    // latched "enc!" flag).
+    ESP_LOGI(TAG, "encoder drift: %lu checks  %lu events  %lu detents corrected",
+             static_cast<unsigned long>(enc_drift_checks_),
+             static_cast<unsigned long>(enc_drift_events_),
+             static_cast<unsigned long>(enc_drift_detents_));
+    ESP_LOGI(TAG, "log formats interned: %u of %u slots",
+             static_cast<unsigned>(log_fmt_count_),
+             static_cast<unsigned>(kLogFmtTable_));
+    // Token-bucket schedule for every periodic sender (rates and runs).
+    espnow::DumpPeriodicJobs();
+    // Queue registry: capacities vs. high-water marks and drop counts.
+    queue_stats::DumpSerial();
+    // Flash governor: how often background erases had to move aside.
+    {
+        flash_gov::Stats fg{};
+        flash_gov::GetStats(fg);
+        ESP_LOGI(TAG, "flash gov: %lu erases  %lu deferrals  max hold %lu ms%s",
+                 static_cast<unsigned long>(fg.erases),
+                 static_cast<unsigned long>(fg.deferrals),
+                 static_cast<unsigned long>(fg.max_defer_ms),
+                 fg.sensitive ? "  (window open)" : "");
+    }
+    // Power-on self-test verdicts (hardware checks behind the splash).
+    self_test::DumpSerial();
+    // No-op unless built with -DTRACE_ENABLED=1.
+    trace::Dump();
+}
+
+/**
+ * @brief Overlay strip: live frame time plus the current page's avg/max
+ * @details Drawn over the top band after the page render; intentionally
+ *          small so the cost of observing stays negligible.
+ */
+void ui::UiController::drawPerfOverlay_() noexcept
+{
+    const PerfPageStats& ps = perf_pages_[static_cast<size_t>(page_)];
+    const uint32_t avg_us = (ps.frames > 0)
+        ? static_cast<uint32_t>(ps.sum_us / ps.frames) : 0;
+
+    canvas_->fillRect(40, 0, 160, 22, TFT_BLACK);
+    canvas_->setTextSize(1);
+    canvas_->setTextColor(perf_last_us_ > 16000 ? thm().accent_red
+                                                : thm().accent_green);
+    char buf[40];
+    snprintf(buf, sizeof(buf), "%lu.%lums  avg %lu.%lu  max %lu.%lu",
+             static_cast<unsigned long>(perf_last_us_ / 1000),
+             static_cast<unsigned long>((perf_last_us_ % 1000) / 100),
+             static_cast<unsigned long>(avg_us / 1000),
+             static_cast<unsigned long>((avg_us % 1000) / 100),
+             static_cast<unsigned long>(ps.max_us / 1000),
+             static_cast<unsigned long>((ps.max_us % 1000) / 100));
+    const int16_t tw = measureText_(buf);
+    canvas_->setCursor(static_cast<int16_t>(120 - tw / 2), 2);
+    canvas_->print(buf);
+
+    // Costliest helper so far, by average.
+    size_t worst = 0;
+    uint64_t worst_avg = 0;
+    for (size_t h = 0; h < static_cast<size_t>(PerfHelper::Count); ++h) {
+        const PerfHelperStats& hs = perf_helpers_[h];
+        if (hs.calls > 0 && hs.cycles / hs.calls > worst_avg) {
+            worst_avg = hs.cycles / hs.calls;
+            worst = h;
+        }
+    }
+    if (worst_avg > 0) {
+        const uint64_t worst_us = timebase::CyclesToUs(worst_avg);
+        snprintf(buf, sizeof(buf), "%s %lu.%lums",
+                 perfHelperName_(static_cast<PerfHelper>(worst)),
+                 static_cast<unsigned long>(worst_us / 1000),
+                 static_cast<unsigned long>(worst_us % 1000 / 100));
+        canvas_->setTextColor(thm().text_muted);
+        const int16_t tw2 = measureText_(buf);
+        canvas_->setCursor(static_cast<int16_t>(120 - tw2 / 2), 12);
+        canvas_->print(buf);
+    }
+}
+
+namespace {
+
+// 3x5 digit bitmaps for the micro HUD (low three bits per row). The text
+// engine's smallest cell is 6x8, which cannot fit two rows in 12 px; these
+// only ever render into the retained HUD sprite, never per frame.
+constexpr uint8_t kHudDigits_[10][5] = {
+    {7, 5, 5, 5, 7}, {2, 6, 2, 2, 7}, {7, 1, 7, 4, 7}, {7, 1, 7, 1, 7},
+    {5, 5, 7, 1, 1}, {7, 4, 7, 1, 7}, {7, 4, 7, 5, 7}, {7, 1, 1, 2, 2},
+    {7, 5, 7, 5, 7}, {7, 5, 7, 1, 7},
+};
 
-        // Phase 2: Hold / Spin
-        const uint32_t kHoldDurationMs = 1200;
-        uint32_t hold_start = static_cast<uint32_t>(esp_timer_get_time() / 1000);
-        while ((static_cast<uint32_t>(esp_timer_get_time() / 1000) - hold_start) < kHoldDurationMs) {
-            uint32_t t = static_cast<uint32_t>(esp_timer_get_time() / 1000);
-            float elapsed = (float)(t - hold_start) / (float)kHoldDurationMs;
-            // Progress 0.4 -> 1.0
-            float p = 0.4f + (elapsed * 0.6f);
-            drawBootScreen_(t, p);
-            vTaskDelay(pdMS_TO_TICKS(20));
+/// Draw @p value right-aligned with its last digit ending at @p x_right.
+void hudDrawNumber_(LGFX_Sprite& s, int16_t x_right, int16_t y, uint32_t value,
+                    uint16_t color) noexcept
+{
+    int16_t x = static_cast<int16_t>(x_right - 3);
+    do {
+        const uint8_t* rows = kHudDigits_[value % 10];
+        for (int16_t ry = 0; ry < 5; ++ry) {
+            for (int16_t rx = 0; rx < 3; ++rx) {
+                if (rows[ry] & (4 >> rx)) {
+                    s.drawPixel(static_cast<int16_t>(x + rx),
+                                static_cast<int16_t>(y + ry), color);
+                }
+            }
         }
+        value /= 10;
+        x = static_cast<int16_t>(x - 4);
+    } while (value != 0 && x >= 0);
+}
 
-        // Phase 3: Fade Out (Option A)
-        const int kFadeOutSteps = 20;
-        for (int i = 0; i <= kFadeOutSteps; i++) {
-            uint32_t t = static_cast<uint32_t>(esp_timer_get_time() / 1000);
-            float p = 1.0f - ((float)i / (float)kFadeOutSteps);
-            int b = (int)(p * kSplashBrightness);
-            drawBootScreen_(t, 1.0f);
-            M5.Display.setBrightness(b);
-            vTaskDelay(pdMS_TO_TICKS(10));
+}  // namespace
+
+/**
+ * @brief Micro HUD: FPS, last-frame cost and deadline misses in 30x12
+ * @details Row one shows the instantaneous FPS (delta between the last two
+ *          rendered frames) and the previous frame's render cost in ms; row
+ *          two counts frames that blew the 16 ms budget since the last
+ *          RESET. The readout sprite is re-rendered only when a displayed
+ *          value changes; every other frame this is three compares and a
+ *          360-pixel blit of identical pixels, which the row digests then
+ *          drop from the flush.
+ */
+void ui::UiController::drawHudOverlay_(uint32_t now_ms) noexcept
+{
+    if (hud_sprite_ == nullptr) {
+        hud_sprite_ = new LGFX_Sprite(canvas_);
+        if (hud_sprite_ == nullptr) {
+            return;
         }
+        hud_sprite_->setColorDepth(8);
+        sprite_mem::PlaceRetained(*hud_sprite_);
+        hud_sprite_->createSprite(kHudW_, kHudH_);
+        hud_shown_fps_ = ~0U;
+    }
+
+    const uint32_t delta_ms = now_ms - hud_prev_frame_ms_;
+    hud_prev_frame_ms_ = now_ms;
+    const uint32_t fps = (delta_ms > 0 && delta_ms < 1000)
+        ? std::min<uint32_t>((1000U + delta_ms / 2) / delta_ms, 99U) : 0;
+    const uint32_t cost_ms = std::min<uint32_t>((perf_last_us_ + 500) / 1000, 999U);
+    const uint32_t drops = std::min<uint32_t>(perf_deadline_misses_, 9999999U);
+
+    hud_repaint_ = (fps != hud_shown_fps_ || cost_ms != hud_shown_ms_ ||
+                    drops != hud_shown_drops_);
+    if (hud_repaint_) {
+        hud_sprite_->fillSprite(TFT_BLACK);
+        const uint16_t row1 = (perf_last_us_ > kFrameBudget_us_)
+            ? thm().accent_red : thm().accent_green;
+        hudDrawNumber_(*hud_sprite_, 8, 0, fps, row1);
+        hudDrawNumber_(*hud_sprite_, kHudW_, 0, cost_ms, row1);
+        hudDrawNumber_(*hud_sprite_, kHudW_, 7, drops,
+                       drops > 0 ? thm().accent_yellow : thm().text_muted);
+        hud_shown_fps_ = fps;
+        hud_shown_ms_ = cost_ms;
+        hud_shown_drops_ = drops;
+    }
+    hud_sprite_->pushSprite(canvas_, kHudX_, kHudY_);
+}
 
-        // Ensure black before switch
-        M5.Display.setBrightness(0);
-        M5.Display.fillScreen(TFT_BLACK);
-        vTaskDelay(pdMS_TO_TICKS(100));
+void ui::UiController::freeHudSprite_() noexcept
+{
+    if (hud_sprite_ != nullptr) {
+        hud_sprite_->deleteSprite();
+        delete hud_sprite_;
+        hud_sprite_ = nullptr;
     }
+}
 
-    if (settings_ != nullptr) {
-        M5.Display.setBrightness(settings_->ui.brightness);
+/**
+ * @brief Overlay ring: standing alert marker at the panel rim
+ * @details A 4 px severity-colored ring at the outer edge, redrawn
+ *          unclipped every frame like the perf overlay. After the full
+ *          frame that first lays it down, the redraw writes identical
+ *          pixels, so row digests stay put and the flush cost is zero.
+ */
+void ui::UiController::drawAlertRing_() noexcept
+{
+    const uint16_t color = (alert_sev_ == AlertSeverity::Critical)
+                               ? thm().accent_red : thm().accent_orange;
+    canvas_->fillArc(CENTER_X_, CENTER_Y_, 119, 115, 0, 360, color);
+}
+
+/**
+ * @brief Overlay: screensaver comet on the panel rim
+ * @details A dim 3 px arc; fillArc takes angles modulo nothing, so a span
+ *          crossing 360 is drawn in two pieces.
+ */
+void ui::UiController::drawSaverArc_() noexcept
+{
+    const uint16_t color = th::dim565(thm().accent_cyan);
+    const int a0 = saver_deg_;
+    const int a1 = saver_deg_ + kSaverArc_deg;
+    if (a1 <= 360) {
+        canvas_->fillArc(CENTER_X_, CENTER_Y_, 119, 116, a0, a1, color);
     } else {
-        M5.Display.setBrightness(128);
+        canvas_->fillArc(CENTER_X_, CENTER_Y_, 119, 116, a0, 360, color);
+        canvas_->fillArc(CENTER_X_, CENTER_Y_, 119, 116, 0, a1 - 360, color);
     }
+}
 
-    // Initialize circular menu
-    initCircularMenu_();
+/**
+ * @brief Overlay strip: firmware update progress
+ * @details Drawn over the bottom band whenever the OTA receiver is active,
+ *          so a transfer stays visible from any page without owning one.
+ */
+void ui::UiController::drawOtaOverlay_() noexcept
+{
+    canvas_->fillRect(50, 198, 140, 30, TFT_BLACK);
+    canvas_->setTextSize(1);
+
+    char buf[28];
+    uint16_t color = thm().accent_orange;
+    switch (ota_state_) {
+        case espnow::OtaState::Preparing:
+            snprintf(buf, sizeof(buf), "FW UPDATE: ERASING");
+            break;
+        case espnow::OtaState::Receiving:
+            snprintf(buf, sizeof(buf), "FW UPDATE %u%%",
+                     static_cast<unsigned>(ota_percent_));
+            break;
+        case espnow::OtaState::ReadyToReboot:
+            color = thm().accent_green;
+            snprintf(buf, sizeof(buf), "FW UPDATE: RESTART");
+            break;
+        default:
+            color = thm().accent_red;
+            snprintf(buf, sizeof(buf), "FW UPDATE FAILED");
+            break;
+    }
+    canvas_->setTextColor(color);
+    const int16_t tw = measureText_(buf);
+    canvas_->setCursor(static_cast<int16_t>(120 - tw / 2), 200);
+    canvas_->print(buf);
+
+    const int16_t bar_x = 70, bar_y = 212, bar_w = 100, bar_h = 6;
+    canvas_->drawRect(bar_x, bar_y, bar_w, bar_h, thm().text_muted);
+    const int16_t fill = static_cast<int16_t>(
+        ((bar_w - 2) * static_cast<int32_t>(ota_percent_)) / 100);
+    if (fill > 0) {
+        canvas_->fillRect(static_cast<int16_t>(bar_x + 1),
+                          static_cast<int16_t>(bar_y + 1), fill,
+                          static_cast<int16_t>(bar_h - 2), color);
+    }
+}
+
+// ============================================================================
+// INPUT-TO-PHOTON LATENCY PROBE
+// ============================================================================
+// Measures the path a detent actually travels: core-0 input pass -> dirty_
+// -> render task wakeup -> frame render -> SPI drain. The stamp is taken
+// when the event is pulled off the encoder queue and the measurement closes
+// after the flush has fully drained, so the number is honest about every
+// queue and pacing delay in between. Only the oldest unconsumed detent is
+// tracked: during a fast spin that is the one the operator is waiting on.
+
+void ui::UiController::latencyNoteInput_() noexcept
+{
+    if (!latency_probe_) {
+        return;
+    }
+    if (latency_input_us_ == 0) {
+        // 0 is the "no stamp" sentinel; the truncated clock lands on it for
+        // one microsecond every ~71 minutes, where nudging by 1 us is noise.
+        uint32_t stamp = static_cast<uint32_t>(esp_timer_get_time());
+        if (stamp == 0) {
+            stamp = 1;
+        }
+        latency_input_us_ = stamp;
+        if (kLatencyProbeGpio_ != GPIO_NUM_NC) {
+            (void)gpio_set_level(kLatencyProbeGpio_, 1);
+        }
+    }
+}
 
-    // Kick off initial config request (used as the remote controller's status poll).
-    (void)espnow::SendConfigRequest(fatigue_proto::DEVICE_ID_FATIGUE_TESTER_);
+void ui::UiController::latencyFrameStart_() noexcept
+{
+    // Snapshot under ui_mutex_ on the render task: inputs stamped after this
+    // point belong to the next frame, not the one about to render.
+    latency_frame_input_us_ = latency_probe_ ? latency_input_us_ : 0;
+}
 
-    dirty_ = true;
-    ESP_LOGI(TAG_, "UI initialized");
+void ui::UiController::latencyFrameFlushed_() noexcept
+{
+    const uint32_t stamp = latency_frame_input_us_;
+    latency_frame_input_us_ = 0;
+    if (stamp == 0) {
+        return;
+    }
+
+    // The DMA tail normally drains while the next frame renders; for the
+    // measurement the drain is part of the answer.
+    M5.Display.waitDMA();
+    if (kLatencyProbeGpio_ != GPIO_NUM_NC) {
+        (void)gpio_set_level(kLatencyProbeGpio_, 0);
+    }
+
+    // Unsigned subtraction stays correct across the 32-bit clock wrap.
+    const uint32_t us = static_cast<uint32_t>(esp_timer_get_time()) - stamp;
+    size_t bucket = 0;
+    for (uint32_t edge_ms = 4; bucket + 1 < kLatencyBuckets_ && us >= edge_ms * 1000U;
+         ++bucket, edge_ms *= 2) {
+    }
+    ++latency_hist_[bucket];
+    ++latency_count_;
+    latency_sum_us_ += us;
+    latency_last_us_ = us;
+    if (us > latency_max_us_) {
+        latency_max_us_ = us;
+    }
+
+    // Consume the stamp; the input pass only writes while it reads zero, so
+    // the slot still holds this measurement's value.
+    latency_input_us_ = 0;
+}
+
+void ui::UiController::latencyReset_() noexcept
+{
+    for (auto& b : latency_hist_) {
+        b = 0;
+    }
+    latency_count_ = 0;
+    latency_sum_us_ = 0;
+    latency_last_us_ = 0;
+    latency_max_us_ = 0;
+    latency_input_us_ = 0;
+    latency_frame_input_us_ = 0;
+}
+
+void ui::UiController::renderTaskEntry_(void* arg) noexcept
+{
+    static_cast<UiController*>(arg)->renderLoop_();
+}
+
+uint32_t ui::UiController::renderPeriodMs_(uint32_t now_ms) const noexcept
+{
+    // Render period: faster when animating, slower when static to reduce flicker
+    uint32_t period_ms = 250;  // Default: slow refresh
+    if (page_ == Page::Landing && menu_selector_.isAnimating(now_ms)) {
+        period_ms = 33;  // ~30fps during menu animation
+    } else if (page_ == Page::Landing && conn_status_ == ConnStatus::Connecting) {
+        period_ms = 500;  // Slow for "Waiting..." animation dots
+    } else if (page_ == Page::Terminal && terminal_overscroll_px_ != 0.0f) {
+        period_ms = 33;  // ~30fps while spring animation decays
+    } else if (inertia_px_s_ != 0.0f) {
+        period_ms = 33;  // ~30fps while a flick coasts
+    } else if (page_ == Page::Bounds && bounds_state_ == BoundsState::Running &&
+               bounds_have_progress_ && (now_ms - bounds_progress_ms_) < kBoundsProgressStale_ms) {
+        // Live-progress search: the gauge follows real angles, so the
+        // BoundsProgress packets drive the frames (each marks its sweep
+        // delta dirty) and no animation window is needed.
+    } else if (page_ == Page::Bounds && (bounds_state_ == BoundsState::Running || bounds_state_ == BoundsState::StartWaitAck || bounds_state_ == BoundsState::StopWaitAck || bounds_state_ == BoundsState::Complete || bounds_result_cached_)) {
+        period_ms = 33;  // Animate bounds UI (incl. cached-result swing)
+    }
+    return period_ms;
+}
+
+void ui::UiController::renderLoop_() noexcept
+{
+    // Frame pacing governor. Animation windows run on a fixed-deadline
+    // schedule (xTaskDelayUntil): a 4 ms frame and a 14 ms frame both land
+    // exactly one period apart instead of period-plus-cost, so the carousel
+    // and spring animations stay even. Outside animation the loop polls
+    // fast only while frames are actually being produced and drops to a
+    // slow idle poll once dirty_ stays false, saving CPU on static pages.
+    TickType_t wake_tick = xTaskGetTickCount();
+    health::Register(health::Task::Render, 50, 500);
+    while (true) {
+        const uint32_t now_ms = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+        health::CheckIn(health::Task::Render);
+
+        // Boot splash owns the display until its state machine finishes;
+        // the pending dirty_ flag then starts normal frames immediately.
+        if (boot_phase_ != BootPhase::Done) {
+            serviceBootAnimation_(now_ms);
+            vTaskDelay(pdMS_TO_TICKS(15));
+            wake_tick = xTaskGetTickCount();
+            continue;
+        }
+
+        bool rendered = false;
+        bool animating = false;
+        bool slide = false;
+        bool slide_back = false;
+        if (xSemaphoreTake(ui_mutex_, pdMS_TO_TICKS(50)) == pdTRUE) {
+            const uint32_t period_ms = renderPeriodMs_(now_ms);
+            animating = (period_ms <= 33);
+
+            // Motion stopped while the quality governor had the canvas at
+            // RGB332: force one more frame so the resting image the user
+            // actually inspects is rendered at full color.
+            if (!animating && anim_low_color_) {
+                anim_low_color_ = false;
+                anim_strain_ = 0;
+                dirty_ = true;
+            }
+
+            bool want_frame = dirty_ || (now_ms - last_render_ms_) > period_ms;
+            // Screen-off sleep: stop producing frames entirely. The wake
+            // transition sets dirty_, so rendering resumes by itself.
+            if (power_state_ == PowerState::Sleeping) {
+                want_frame = false;
+            }
+            // While a prefetch occupies the canvas, skip the periodic
+            // landing refresh as long as its signature says nothing
+            // visible changed; rendering it would only repaint an
+            // identical frame and throw the prefetch away.
+            if (want_frame && !dirty_ && prefetch_valid_ && page_ == Page::Landing &&
+                landingSignature_(now_ms) == landing_sig_) {
+                want_frame = false;
+            }
+            // LiveCounter fingerprint skip: a keepalive StatusUpdate with
+            // an unchanged cycle count marks dirty_ but draws an identical
+            // frame; hash the rendered state and consume the flag instead.
+            if (want_frame && !animating && page_ == Page::LiveCounter && live_fp_valid_) {
+                RenderSnapshot snap;
+                if (readRenderSnapshot_(snap) &&
+                    liveCounterFingerprint_(snap, now_ms) == live_fp_) {
+                    want_frame = false;
+                    dirty_ = false;
+                    last_render_ms_ = now_ms;
+                }
+            }
+
+            if (wake_blit_pending_) {
+                // Panel wake: the canvas still holds the exact frame that
+                // was showing at sleep. Push it unchanged so pixels are
+                // visible one sprite transfer after sleep-out; dirty_
+                // stays set, so the real current frame follows on the
+                // next pass.
+                wake_blit_pending_ = false;
+                flush_full_ = true;
+                rendered = true;
+                shown_page_ = page_;
+            } else if (dirty_ && prefetch_valid_ && page_ == prefetch_page_ &&
+                (now_ms - prefetch_ms_) <= kPrefetchFresh_ms) {
+                // Entering the page that was prefetched: push the sprite
+                // as-is for blit-only perceived latency. dirty_ stays set,
+                // so the real first frame renders on the next pass. (No
+                // slide here - the blit IS the instant entry the prefetch
+                // paid for.)
+                prefetch_valid_ = false;
+                flush_full_ = true;
+                rendered = true;
+                shown_page_ = page_;
+            } else if (want_frame) {
+                const Page frame_page = page_;
+                // Page switch with the outgoing frame still in the canvas:
+                // snapshot it before it is drawn over, and let the flush
+                // slide between the two instead of cutting.
+                if (frame_page != shown_page_ && shown_page_ != Page::Count &&
+                    power_state_ == PowerState::Active) {
+                    slide = transitionStart_();
+                    slide_back = (frame_page == Page::Landing);
+                }
+                latencyFrameStart_();
+                const int64_t t0_us = esp_timer_get_time();
+                renderFrame_(now_ms);
+                const uint32_t frame_us = static_cast<uint32_t>(esp_timer_get_time() - t0_us);
+                perfRecordFrame_(frame_page, frame_us);
+                health::ReportWork(health::Task::Render, frame_us / 1000U);
+                // Animation quality governor: repeated over-budget frames
+                // during an animation burst drop the canvas to RGB332 (the
+                // depth switch itself happens in applyCanvasDepth_ on the
+                // next frame). Once engaged it rides out the whole burst;
+                // the low-color frames being fast is the point, not a
+                // signal to switch back mid-motion.
+                if (animating) {
+                    if (frame_us > kFrameBudget_us_) {
+                        if (anim_strain_ < kAnimStrainEngage_ * 2) {
+                            ++anim_strain_;
+                        }
+                        if (!anim_low_color_ && anim_strain_ >= kAnimStrainEngage_ &&
+                            !abDisabled_(AbSubject::LowColor)) {
+                            anim_low_color_ = true;
+                            dirty_ = true;
+                        }
+                    } else if (!anim_low_color_ && anim_strain_ > 0 &&
+                               frame_us < kFrameBudget_us_ / 2) {
+                        --anim_strain_;
+                    }
+                }
+                last_render_ms_ = now_ms;
+                dirty_ = false;
+                rendered = true;
+                shown_page_ = frame_page;
+                // Fingerprint what was just drawn (from the same snapshot
+                // the frame rendered) so identical follow-ups can skip.
+                if (frame_page == Page::LiveCounter) {
+                    live_fp_ = liveCounterFingerprint_(frame_snapshot_, now_ms);
+                    live_fp_valid_ = true;
+                } else {
+                    live_fp_valid_ = false;
+                }
+            } else if (!animating && power_state_ != PowerState::Sleeping) {
+                // Idle pass: no frame wanted this wake. Prefetch the likely
+                // next page (Landing only), then give the remainder to the
+                // cache scheduler for warming and stale eviction.
+                if (page_ == Page::Landing) {
+                    tryPrefetch_(now_ms);
+                }
+                serviceCacheIdle_(now_ms);
+            }
+            xSemaphoreGive(ui_mutex_);
+        }
+
+        // SPI flush happens with the mutex released; core 0 keeps servicing
+        // input and ESP-NOW events while the panel transfer is in flight.
+        if (rendered) {
+            if (slide && trans_snap_ != nullptr) {
+                playTransition_(slide_back);
+            } else {
+                flushFrame_();
+            }
+            latencyFrameFlushed_();
+        }
+
+        // Screenshot capture streams its next band here, after the flush
+        // and off the mutex: this task is the canvas's only writer, so the
+        // rows it reads are stable for the whole pass.
+        serviceScreenshot_();
+
+        // Thermal derate: step the write clock down while the die is hot,
+        // restore the proven level once cool. Applied here and only here -
+        // this task owns the SPI bus, and waitDisplay() guarantees no DMA
+        // tail is in flight when the bus is reconfigured.
+        {
+            const bool want_derate = thermal::DerateRecommended();
+            if (want_derate != display_derated_) {
+                auto* panel = M5.Display.getPanel();
+                if (panel != nullptr && panel->getBus() != nullptr) {
+                    M5.Display.waitDisplay();
+                    auto* bus = static_cast<lgfx::Bus_SPI*>(panel->getBus());
+                    if (want_derate) {
+                        derate_saved_hz_ = bus->config().freq_write;
+                        ui::display_tuner::applyWriteClock(
+                            M5.Display,
+                            std::min(derate_saved_hz_, thermal::DERATE_CLOCK_HZ));
+                    } else if (derate_saved_hz_ != 0) {
+                        ui::display_tuner::applyWriteClock(M5.Display, derate_saved_hz_);
+                    }
+                    display_derated_ = want_derate;
+                }
+            }
+        }
+
+        const uint32_t pace_ms = animating ? 33U : (rendered ? 10U : 50U);
+        if (xTaskDelayUntil(&wake_tick, pdMS_TO_TICKS(pace_ms)) == pdFALSE) {
+            // Frame overran its deadline: re-anchor instead of bursting
+            // catch-up frames, so one slow frame costs one late frame only.
+            wake_tick = xTaskGetTickCount();
+        }
+    }
+}
+
+void ui::UiController::publishRenderSnapshot_() noexcept
+{
+    // Seqlock write side: bump to odd, copy, bump to even. Single writer
+    // (core 0 Tick), so no CAS is needed.
+    const uint32_t seq = snapshot_seq_.load(std::memory_order_relaxed);
+    snapshot_seq_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    snapshot_.status = last_status_;
+    snapshot_.remote_config = last_remote_config_;
+    snapshot_.conn = conn_status_;
+    snapshot_.have_status = have_status_;
+    snapshot_.bounds_state = bounds_state_;
+    snapshot_.bounds_have_result = bounds_have_result_;
+    snapshot_.bounds_bounded = bounds_bounded_;
+    snapshot_.bounds_min_deg = bounds_min_deg_;
+    snapshot_.bounds_max_deg = bounds_max_deg_;
+    snapshot_.log_generation = log_generation_;
+    snapshot_.display_cycle = live_shown_cycle_;
+    snapshot_.unit_count = static_cast<uint8_t>(unit_count_);
+    snapshot_.active_unit = static_cast<uint8_t>(active_unit_);
+
+    std::atomic_thread_fence(std::memory_order_release);
+    snapshot_seq_.store(seq + 2, std::memory_order_release);
+}
+
+bool ui::UiController::readRenderSnapshot_(RenderSnapshot& out) const noexcept
+{
+    // Seqlock read side: retry while the writer is mid-publish or the
+    // sequence changed underneath the copy. The writer runs at tick rate,
+    // so a couple of attempts always suffice in practice.
+    for (int attempt = 0; attempt < 4; ++attempt) {
+        const uint32_t seq = snapshot_seq_.load(std::memory_order_acquire);
+        if (seq & 1U) {
+            continue;
+        }
+        out = snapshot_;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (snapshot_seq_.load(std::memory_order_relaxed) == seq) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ui::UiController::serviceBootAnimation_(uint32_t now_ms) noexcept
+{
+    const uint32_t in_phase = now_ms - boot_phase_ms_;
+    switch (boot_phase_) {
+        case BootPhase::FadeIn: {
+            const float p = (in_phase >= kBootFadeIn_ms)
+                                ? 1.0f
+                                : static_cast<float>(in_phase) / static_cast<float>(kBootFadeIn_ms);
+            boot_progress_ = p * 0.4f;
+            drawBootScreen_(now_ms, boot_progress_);
+            M5.Display.setBrightness(static_cast<uint8_t>(p * kBootBrightness_));
+            if (in_phase >= kBootFadeIn_ms) {
+                boot_phase_ = BootPhase::Hold;
+                boot_phase_ms_ = now_ms;
+            }
+            return;
+        }
+        case BootPhase::Hold: {
+            // Arc 0.4 -> 1.0: elapsed time earns the first 0.3, radio
+            // readiness the last 0.3, so the bar reports real subsystem
+            // completion rather than a timer. Monotonic by construction.
+            float time_frac = static_cast<float>(in_phase) / static_cast<float>(kBootHoldMin_ms);
+            if (time_frac > 1.0f) {
+                time_frac = 1.0f;
+            }
+            // boot_radio_ready_ is written by core 0's Tick; a plain bool
+            // read one frame stale is harmless here.
+            const float target =
+                0.4f + 0.3f * time_frac + (boot_radio_ready_ ? 0.3f : 0.0f);
+            if (target > boot_progress_) {
+                boot_progress_ = target;
+            }
+            drawBootScreen_(now_ms, boot_progress_);
+            if ((in_phase >= kBootHoldMin_ms && boot_radio_ready_) ||
+                in_phase >= kBootHoldMax_ms) {
+                boot_progress_ = 1.0f;
+                boot_phase_ = BootPhase::FadeOut;
+                boot_phase_ms_ = now_ms;
+            }
+            return;
+        }
+        case BootPhase::FadeOut: {
+            const float p = (in_phase >= kBootFadeOut_ms)
+                                ? 0.0f
+                                : 1.0f - static_cast<float>(in_phase) /
+                                             static_cast<float>(kBootFadeOut_ms);
+            drawBootScreen_(now_ms, 1.0f);
+            M5.Display.setBrightness(static_cast<uint8_t>(p * kBootBrightness_));
+            if (in_phase >= kBootFadeOut_ms) {
+                M5.Display.setBrightness(0);
+                M5.Display.fillScreen(TFT_BLACK);
+                boot_phase_ = BootPhase::Blank;
+                boot_phase_ms_ = now_ms;
+            }
+            return;
+        }
+        case BootPhase::Blank: {
+            if (in_phase >= kBootBlank_ms) {
+                M5.Display.setBrightness(
+                    settings_ != nullptr ? settings_->ui.brightness : kBootBrightness_);
+                dirty_ = true;
+                boot_phase_ = BootPhase::Done;
+            }
+            return;
+        }
+        case BootPhase::Done:
+            return;
+    }
 }
 
 void ui::UiController::drawBootScreen_(uint32_t now_ms, float progress) noexcept
 {
     if (canvas_ == nullptr) return;
     // Background: Deep navy gradient simulation
-    canvas_->fillScreen(0x0005);
+    canvas_->fillScreen(thm().boot_bg);
     // Soft glow bloom behind logo (center)
-    canvas_->fillCircle(CENTER_X_, CENTER_Y_ - 30, 70, 0x000A);
-    canvas_->fillCircle(CENTER_X_, CENTER_Y_ - 30, 50, 0x000F);
+    canvas_->fillCircle(CENTER_X_, CENTER_Y_ - 30, 70, thm().boot_glow_outer);
+    canvas_->fillCircle(CENTER_X_, CENTER_Y_ - 30, 50, thm().boot_glow_inner);
     // Progress ring
     int16_t r = 115;
     // Track background
-    canvas_->drawArc(CENTER_X_, CENTER_Y_, r, r, 0, 360, 0x1084);
+    canvas_->drawArc(CENTER_X_, CENTER_Y_, r, r, 0, 360, thm().boot_ring_track);
     // Active arc (blue/cyan)
     int32_t start_angle = 270;
     int32_t end_angle = 270 + (int32_t)(progress * 360.0f);
-    canvas_->drawArc(CENTER_X_, CENTER_Y_, r, r, start_angle, end_angle, 0x04FF);
+    canvas_->drawArc(CENTER_X_, CENTER_Y_, r, r, start_angle, end_angle, thm().boot_ring_fill);
     // Orbiting dot
     float rad = (float)end_angle * 0.0174532925f;
     int16_t dot_x = CENTER_X_ + (int16_t)(cos(rad) * r);
@@ -179,9 +1200,9 @@ void ui::UiController::drawBootScreen_(uint32_t now_ms, float progress) noexcept
     int16_t pill_x = CENTER_X_ - pill_w/2;
     int16_t pill_y = CENTER_Y_ + 10;
     // Pill bg
-    canvas_->fillRoundRect(pill_x, pill_y, pill_w, pill_h, 13, 0x18E3);
+    canvas_->fillRoundRect(pill_x, pill_y, pill_w, pill_h, 13, thm().pill_bg);
     // Pill border
-    canvas_->drawRoundRect(pill_x, pill_y, pill_w, pill_h, 13, 0x4A69);
+    canvas_->drawRoundRect(pill_x, pill_y, pill_w, pill_h, 13, thm().button_border);
     canvas_->setTextDatum(textdatum_t::middle_center);
     canvas_->setTextColor(TFT_WHITE);
     canvas_->drawString("Fatigue Test Unit", CENTER_X_, pill_y + pill_h/2 + 1);
@@ -190,7 +1211,7 @@ void ui::UiController::drawBootScreen_(uint32_t now_ms, float progress) noexcept
     int pct = (int)(progress * 100.0f);
     if (pct > 100) pct = 100;
     snprintf(buf, sizeof(buf), "Starting... %d%%", pct);
-    canvas_->setTextColor(0x9CD3);
+    canvas_->setTextColor(thm().pill_text);
     canvas_->drawString(buf, CENTER_X_, CENTER_Y_ + 55);
     canvas_->pushSprite(0, 0);
 }
@@ -206,11 +1227,11 @@ void ui::UiController::initCircularMenu_() noexcept
     menu_config_.icon_selected_offset = 3;
     menu_config_.icon_selected_scale = 1.1f;
     menu_config_.selector_dot_radius = 5;
-    menu_config_.selector_color = 0xF3E9;  // Cream/off-white
+    menu_config_.selector_color = thm().menu_selector;
     menu_config_.anim_duration_ms = kMenuAnimDuration_ms;
     menu_config_.center_touch_radius = 50;
-    menu_config_.theme_fg = 0xFA00;
-    menu_config_.theme_bg = 0x0000;
+    menu_config_.theme_fg = thm().menu_accent;
+    menu_config_.theme_bg = thm().bg_primary;
     
     menu_selector_.init(menu_config_, MENU_COUNT_);
     
@@ -222,35 +1243,712 @@ void ui::UiController::Tick() noexcept
 {
     const uint32_t now_ms = static_cast<uint32_t>(esp_timer_get_time() / 1000);
 
-    // Keepalive/status poll: match esp32_remote_controller behavior.
-    // The reference remote uses ConfigRequest as a periodic status/config poll.
-    if ((now_ms - last_poll_ms_) >= 1000U) {
-        (void)espnow::SendConfigRequest(fatigue_proto::DEVICE_ID_FATIGUE_TESTER_);
-        last_poll_ms_ = now_ms;
+    // Health: the main loop blocks on the event set (up to 100ms idle) and
+    // can sit in light sleep, so the turnaround bound is generous; it is
+    // here to catch a wedged loop, not a drowsy one.
+    if (!health_registered_) {
+        health_registered_ = true;
+        health::Register(health::Task::MainLoop, 50, 2000);
     }
+    health::CheckIn(health::Task::MainLoop);
 
-    handleProtoEvents_(now_ms);
-    handleInputs_(now_ms);
-
-    updateBoundsState_(now_ms);
+    // Touch IRQ tokens only exist to end the event wait early; the touch
+    // state itself is read from M5.Touch below. Drain so the set re-arms.
+    if (touch_irq_queue_ != nullptr) {
+        uint8_t token;
+        (void)xQueueReceive(touch_irq_queue_, &token, 0);
+    }
 
-    // Render period: faster when animating, slower when static to reduce flicker
-    uint32_t period_ms = 250;  // Default: slow refresh
-    if (page_ == Page::Landing && menu_selector_.isAnimating(now_ms)) {
-        period_ms = 33;  // ~30fps during menu animation
-    } else if (page_ == Page::Landing && conn_status_ == ConnStatus::Connecting) {
-        period_ms = 500;  // Slow for "Waiting..." animation dots
-    } else if (page_ == Page::Terminal && terminal_overscroll_px_ != 0.0f) {
-        period_ms = 33;  // ~30fps while spring animation decays
-    } else if (page_ == Page::Bounds && (bounds_state_ == BoundsState::Running || bounds_state_ == BoundsState::StartWaitAck || bounds_state_ == BoundsState::StopWaitAck || bounds_state_ == BoundsState::Complete)) {
-        period_ms = 33;  // Animate bounds UI
+    // Black box: record page and connection transitions so a post-reset
+    // dump shows what the operator was doing when the unit died.
+    if (page_ != bb_page_noted_) {
+        bb_page_noted_ = page_;
+        blackbox::Note(blackbox::Kind::Page, static_cast<uint8_t>(page_));
+        session_restore::NotePage(static_cast<uint8_t>(page_));
     }
-    
-    if (dirty_ || (now_ms - last_render_ms_) > period_ms) {
-        draw_(now_ms);
-        last_render_ms_ = now_ms;
-        dirty_ = false;
+    // Checkpoint the active unit on change (same cadence as the page note;
+    // the mac compare is six bytes).
+    {
+        uint8_t sr_mac[6] = {};
+        (void)activeUnitMac_(sr_mac);
+        if (std::memcmp(sr_mac, sr_unit_noted_, 6) != 0) {
+            std::memcpy(sr_unit_noted_, sr_mac, 6);
+            session_restore::NoteActiveUnit(sr_mac);
+        }
     }
+    if (conn_status_ != bb_conn_noted_) {
+        bb_conn_noted_ = conn_status_;
+        blackbox::Note(blackbox::Kind::Conn, static_cast<uint8_t>(conn_status_));
+    }
+
+    // Keepalive/status poll: match esp32_remote_controller behavior.
+    // The reference remote uses ConfigRequest as a periodic status/config poll.
+    // With multiple approved units the active one is polled every pass and
+    // one background unit per pass is polled round-robin, so fleet liveness
+    // stays fresh without multiplying airtime by the peer count. Cadence
+    // comes from the protocol scheduler's jittered bucket (registered in
+    // Init); the housekeeping below rides the same ~1 Hz pass as before.
+    const bool poll_due = (poll_job_ >= 0) ? espnow::PeriodicJobDue(poll_job_)
+                                           : ((now_ms - last_poll_ms_) >= 1000U);
+    if (poll_due) {
+        refreshUnitTable_(now_ms);
+        attemptSessionRestore_(now_ms);
+        (void)sendConfigRequestActive_();
+        // The background poll draws from its own bucket so its phase drifts
+        // independently of the active poll (falls back to every pass if the
+        // job table was full).
+        if (unit_count_ > 1 &&
+            (fleet_poll_job_ < 0 || espnow::PeriodicJobDue(fleet_poll_job_))) {
+            unit_poll_cursor_ = (unit_poll_cursor_ + 1) % unit_count_;
+            if (static_cast<int>(unit_poll_cursor_) == active_unit_) {
+                unit_poll_cursor_ = (unit_poll_cursor_ + 1) % unit_count_;
+            }
+            (void)espnow::SendConfigRequestTo(units_[unit_poll_cursor_].mac,
+                                              fatigue_proto::DEVICE_ID_FATIGUE_TESTER_);
+        }
+        // Feed freshly appended log records to the flash session log and
+        // the serial mirror. Formatting happens here, once per record, off
+        // the logf_ hot path; the flash writes ride session_log's writer
+        // task and the UART writes ride the serial sink's own task.
+        drainLogSinks_();
+        sampleMemTelemetry_(now_ms);
+        queue_stats::Sample();  // self-throttled depth high-water sampling
+        serviceEncoderDrift_(now_ms);
+        serviceTimeline_(now_ms);
+        // Flash governor window: an erase's cache stall is visible exactly
+        // when a running test has the LiveCounter up; a screensaver window
+        // means nobody is watching and the erase backlog may drain freely.
+        flash_gov::NoteUiWindow(
+            have_status_ && page_ == Page::LiveCounter &&
+                static_cast<fatigue_proto::TestState>(last_status_.state) ==
+                    fatigue_proto::TestState::Running,
+            saver_active_);
+
+        // Lifecycle bookkeeping (RTC uptime tick, batched NVS commits);
+        // self-throttled to a minute cadence.
+        lifecycle::Service(now_ms);
+
+        // NVS health re-check (in-RAM stats only); flags a boot-time
+        // compaction when entry utilization degrades read latency.
+        storage_maint::Service(now_ms);
+
+        // Conformance capture: persist newly harvested frames (rate-limited
+        // inside; a no-op branch unless capture is armed and dirty).
+        wire_capture::Service(now_ms);
+
+        // Die temperature sample (10 s cadence inside Service). Only the
+        // hot/cool crossings are logged; the render task picks the derate
+        // verdict up between frames (it owns the SPI bus).
+        if (thermal::Service(now_ms)) {
+            thermal::Stats ts{};
+            thermal::GetStats(ts);
+            logfAt_(ts.hot ? LogLevel::Warn : LogLevel::Info, now_ms,
+                    ts.hot ? "THERMAL: %d C, panel clock derated"
+                           : "THERMAL: cooled to %d C, clock restored",
+                    static_cast<int>(ts.celsius));
+            if (ts.hot) {
+                raiseAlert_(AlertSeverity::Warn, now_ms);
+            }
+        }
+
+        // Multi-remote arbitration crossings: surface monitor-only mode on
+        // the Terminal page the moment another remote takes control, so a
+        // refused START is explicable without a serial cable.
+        {
+            const auto role = espnow::GetControllerRole();
+            if (role != ctrl_role_seen_) {
+                uint8_t holder[6];
+                if (role == espnow::ControllerRole::Passive &&
+                    espnow::GetControllerHolder(holder)) {
+                    logf_(now_ms, "Control: %02X%02X is controlling; monitor-only",
+                          holder[4], holder[5]);
+                } else if (ctrl_role_seen_ == espnow::ControllerRole::Passive) {
+                    logf_(now_ms, "Control: commands enabled again");
+                }
+                ctrl_role_seen_ = role;
+            }
+        }
+
+        // Log link-quality threshold crossings for the active unit. Two
+        // bars of hysteresis-free margin is enough here because the RSSI
+        // feeding signalBars_ is already an EWMA.
+        uint8_t qual_mac[6];
+        espnow::PeerLinkQuality qual;
+        if (conn_status_ == ConnStatus::Connected && activeUnitMac_(qual_mac) &&
+            espnow::GetPeerLinkQuality(qual_mac, qual)) {
+            const bool weak = signalBars_(qual.rssi_dbm) <= 1;
+            if (weak && !rssi_weak_) {
+                logf_(now_ms, "RF: weak signal %d dBm, loss %u%%",
+                      static_cast<int>(qual.rssi_dbm), static_cast<unsigned>(qual.loss_pct));
+            } else if (!weak && rssi_weak_) {
+                logf_(now_ms, "RF: signal recovered (%d dBm)", static_cast<int>(qual.rssi_dbm));
+            }
+            rssi_weak_ = weak;
+        } else {
+            rssi_weak_ = false;
+        }
+
+        last_poll_ms_ = now_ms;
+    }
+
+    // Mutate UI state under the mutex shared with the render task.
+    const bool locked = (ui_mutex_ != nullptr) && (xSemaphoreTake(ui_mutex_, portMAX_DELAY) == pdTRUE);
+
+    // Ingress overload transitions: the protocol layer latches/releases the
+    // storm flag on its own task; mirror it here for the indicator and log.
+    const bool storm = espnow::StormActive();
+    if (storm != rx_storm_) {
+        rx_storm_ = storm;
+        logf_(now_ms, storm ? "RF: ingress storm - shedding telemetry"
+                            : "RF: ingress storm cleared");
+        dirty_ = true;
+    }
+
+    // Critical command journal: mirror the pending state for the active
+    // unit so the pill and log track delivery across link drops.
+    {
+        uint8_t journal_mac[6];
+        uint8_t journal_cmd = 0;
+        const bool pending = activeUnitMac_(journal_mac) &&
+                             espnow::CriticalCommandPending(journal_mac, &journal_cmd);
+        if (pending != critical_pending_) {
+            if (pending) {
+                logf_(now_ms, "CMD: %s pending delivery",
+                      (journal_cmd == static_cast<uint8_t>(fatigue_proto::CommandId::Pause))
+                          ? "PAUSE" : "STOP");
+            } else {
+                logf_(now_ms, "CMD: journaled command delivered");
+            }
+            critical_pending_ = pending;
+            critical_pending_cmd_ = journal_cmd;
+            session_restore::NotePendingCommand(pending ? journal_cmd : 0);
+            dirty_ = true;
+        }
+    }
+
+    // Firmware update receiver: mirror the protocol-layer snapshot so the
+    // overlay animates and state transitions land in the log.
+    {
+        espnow::OtaProgress ota{};
+        espnow::GetOtaProgress(ota);
+        if (ota.state != ota_state_) {
+            switch (ota.state) {
+                case espnow::OtaState::Preparing:
+                    logf_(now_ms, "OTA: update announced, erasing");
+                    break;
+                case espnow::OtaState::Receiving:
+                    logf_(now_ms, "OTA: receiving firmware (%u chunks)",
+                          static_cast<unsigned>(ota.chunks_total));
+                    break;
+                case espnow::OtaState::ReadyToReboot:
+                    logf_(now_ms, "OTA: update verified - restarting");
+                    playBeep_(3);
+                    break;
+                case espnow::OtaState::Error:
+                    logf_(now_ms, "OTA: update failed (err %u)",
+                          static_cast<unsigned>(ota.error));
+                    playBeep_(2);
+                    break;
+                default:
+                    break;
+            }
+            ota_state_ = ota.state;
+            dirty_ = true;
+        }
+        if (ota.percent != ota_percent_) {
+            ota_percent_ = ota.percent;
+            dirty_ = true;
+        }
+    }
+
+    handleProtoEvents_(now_ms);
+    handleInputs_(now_ms);
+    serviceInputReplay_(now_ms);
+    if (ab_phase_ != 0) {
+        serviceAbHarness_(now_ms);
+    }
+
+    updateBoundsState_(now_ms);
+
+    serviceStatusRate_(now_ms);
+
+    // Counter interpolation: advance the displayed value along the estimator
+    // rate and repaint just the digit band when the integer moves. The digit
+    // glyph cache keeps these extra frames cheap.
+    {
+        const uint32_t shown = predictedCycle_(now_ms);
+        if (shown != live_shown_cycle_) {
+            live_shown_cycle_ = shown;
+            if (page_ == Page::LiveCounter && live_popup_mode_ == LivePopupMode::None) {
+                markDirty_(48, 72, 144, 112);
+            }
+        }
+    }
+
+    serviceDashboard_(now_ms);
+    serviceSpeculation_(now_ms);
+
+    servicePowerGovernor_(now_ms);
+    serviceBrightnessRamp_(now_ms);
+    serviceAlertPulse_(now_ms);
+    serviceScreensaver_(now_ms);
+
+    // Emergency-stop catch-up: the Stop already left on the radio from
+    // the encoder driver task; all that is left here is telling the
+    // operator and repainting whatever state the unit reports next.
+    if (estop_fired_.exchange(0, std::memory_order_relaxed) > 0) {
+        logfAt_(LogLevel::Warn, now_ms, "ESTOP: Stop sent (encoder held)");
+        playBeep_(3);
+        dirty_ = true;
+    }
+
+    // Keep the emergency path's target mirror current (lock-free compare,
+    // spinlocked copy only on change).
+    publishEstopTarget_();
+
+    // Publish the versioned snapshot the render task reads tear-free.
+    publishRenderSnapshot_();
+
+    if (locked) {
+        xSemaphoreGive(ui_mutex_);
+    }
+
+    // Fallback path when the render task could not be created.
+    if (render_task_ == nullptr) {
+        if (boot_phase_ != BootPhase::Done) {
+            serviceBootAnimation_(now_ms);
+        } else if (dirty_ || (now_ms - last_render_ms_) > renderPeriodMs_(now_ms)) {
+            draw_(now_ms);
+            last_render_ms_ = now_ms;
+            dirty_ = false;
+        }
+    }
+
+    // Sleeping: swap the event wait for a light-sleep slice. One grace
+    // period after entering the state lets a frame the render task had
+    // already started finish its flush before the cores halt, and the
+    // fade-to-black completes at tick cadence before the first nap.
+    if (power_state_ == PowerState::Sleeping && bright_ramp_ms_ == 0 &&
+        (now_ms - power_state_since_ms_) > 100U) {
+        if (!panel_asleep_) {
+            // Backlight is already dark; sleep-in additionally stops the
+            // panel's own refresh machinery while retaining its frame RAM,
+            // so wake needs no init or redraw-from-scratch. The grace
+            // period above means no frame is mid-flight here.
+            M5.Display.waitDMA();
+            M5.Display.sleep();
+            panel_asleep_ = true;
+        }
+        if (lightSleepWait_()) {
+            // GPIO wake: count it as input immediately so the governor
+            // leaves the sleep state before the decoded event arrives.
+            last_input_ms_ = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+        }
+        return;
+    }
+
+    // Event wait: block until a proto/encoder event arrives or the computed
+    // deadline expires. Idle screens sleep here instead of spinning at 60 Hz;
+    // spurious queue-set wakeups are harmless (handlers drain with 0 timeout).
+    if (event_set_ != nullptr) {
+        (void)xQueueSelectFromSet(event_set_, pdMS_TO_TICKS(computeWaitMs_(now_ms)));
+    } else {
+        vTaskDelay(pdMS_TO_TICKS(kActiveWait_ms));
+    }
+}
+
+void IRAM_ATTR ui::UiController::touchIrqIsr_(void* arg)
+{
+    // Falling edge = contact. Overwrite keeps the ISR O(1) whether or not
+    // the loop has drained the previous token.
+    auto* self = static_cast<UiController*>(arg);
+    const uint8_t token = 1;
+    BaseType_t woken = pdFALSE;
+    (void)xQueueOverwriteFromISR(self->touch_irq_queue_, &token, &woken);
+    if (woken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+uint32_t ui::UiController::computeWaitMs_(uint32_t now_ms) const noexcept
+{
+    // A live drag outranks everything: denser sampling feeds the velocity
+    // estimator and onTouchDrag_ twice as often as the frame rate, and the
+    // touch controller's own scan rate supports it.
+    if (touch_dragging_) {
+        return kDragWait_ms;
+    }
+    // Pending redraw or running animation: keep the loop at frame rate.
+    if (dirty_) {
+        return kActiveWait_ms;
+    }
+    if (page_ == Page::Landing && menu_selector_.isAnimating(now_ms)) {
+        return kActiveWait_ms;
+    }
+    if (page_ == Page::Terminal && terminal_overscroll_px_ != 0.0f) {
+        return kActiveWait_ms;
+    }
+    if (inertia_px_s_ != 0.0f) {
+        return kActiveWait_ms;
+    }
+    // A brightness fade in flight steps once per tick; idle-rate ticks
+    // would turn the 450 ms ramp into four visible jumps.
+    if (bright_ramp_ms_ != 0) {
+        return kActiveWait_ms;
+    }
+    if (page_ == Page::Bounds && bounds_state_ != BoundsState::Idle) {
+        return kActiveWait_ms;
+    }
+    // Touch state is polled by M5.update(): keep a short wait while a touch
+    // is held or was recently seen so taps stay responsive. (Touch-down
+    // from fully idle is covered by the INT-line IRQ ending the wait.)
+    if (M5.Touch.getCount() > 0 || (now_ms - last_input_ms_) < kTouchWindow_ms) {
+        return kActiveWait_ms;
+    }
+    return kIdleWait_ms;
+}
+
+void ui::UiController::servicePowerGovernor_(uint32_t now_ms) noexcept
+{
+    const uint32_t idle_ms = now_ms - last_input_ms_;
+    PowerState want = PowerState::Active;
+    if (idle_ms >= kSleepAfter_ms) {
+        want = PowerState::Sleeping;
+    } else if (idle_ms >= kDimAfter_ms) {
+        want = PowerState::Dimmed;
+    }
+    // Frames still rendering (animations, streaming telemetry) block
+    // sleep — the screen is showing something live — but no longer pin the
+    // governor Active: a run watched from across the bench reads fine at
+    // the watching floor, and the old Active pin is what left a counter
+    // screen at full backlight all night. (A fade already in flight keeps
+    // the wait active on its own; it must not demote the state it is
+    // fading toward.)
+    if (want == PowerState::Sleeping && bright_ramp_ms_ == 0 &&
+        computeWaitMs_(now_ms) == kActiveWait_ms) {
+        want = PowerState::Dimmed;
+    }
+    if (want == power_state_) {
+        // Re-target a standing dim when the context shifts (a run ending,
+        // night arriving): the level is a function of current activity,
+        // not of the moment the state was entered.
+        if (want == PowerState::Dimmed && bright_ramp_ms_ == 0) {
+            const uint8_t target = brightnessTarget_(PowerState::Dimmed);
+            if (target != M5.Display.getBrightness()) {
+                startBrightnessRamp_(target, now_ms);
+            }
+        }
+        return;
+    }
+
+    switch (want) {
+        case PowerState::Active:
+            // RAM survived the nap, so the canvas still holds the last
+            // frame; one full redraw restores the screen. Restore is a
+            // single step — a wake that fades in feels broken.
+            bright_ramp_ms_ = 0;
+            if (panel_asleep_) {
+                // Sleep-out only — no init sequence, no reset timing. The
+                // panel RAM kept the frame that was showing, so it is
+                // visible the moment the backlight returns; the render
+                // task blits the retained canvas and then draws a current
+                // frame on top.
+                M5.Display.wakeup();
+                panel_asleep_ = false;
+                wake_blit_pending_ = true;
+            }
+            M5.Display.setBrightness(pre_dim_brightness_);
+            dirty_ = true;
+            logf_(now_ms, "Power: wake");
+            break;
+        case PowerState::Dimmed:
+            // Capture whatever is currently applied (may be a settings
+            // editor preview) so the wake path restores it exactly.
+            if (power_state_ == PowerState::Active) {
+                pre_dim_brightness_ = M5.Display.getBrightness();
+            }
+            startBrightnessRamp_(brightnessTarget_(PowerState::Dimmed), now_ms);
+            logf_(now_ms, "Power: dim after %lus idle", static_cast<unsigned long>(idle_ms / 1000));
+            break;
+        case PowerState::Sleeping:
+            if (power_state_ == PowerState::Active) {
+                pre_dim_brightness_ = M5.Display.getBrightness();
+            }
+            startBrightnessRamp_(0, now_ms);
+            logf_(now_ms, "Power: light sleep");
+            break;
+    }
+    power_state_ = want;
+    power_state_since_ms_ = now_ms;
+}
+
+// Gamma-2.2 curve, 33 knots: kGamma_[i] ~= 255 * (i/32)^2.2. Fades step
+// linearly in the perceptual (index) domain and map through this table, so
+// a ramp spends as long in the visible low end as in the washed-out top —
+// a linear duty ramp does the opposite and reads as a sudden cut. Knots
+// plus interpolation keep it integer-only; no per-step float math.
+static constexpr uint8_t kGamma_[33] = {
+    0,   0,   1,   1,   3,   4,   6,   9,   12,  16,  20,
+    24,  29,  35,  41,  48,  55,  63,  72,  81,  91,  101,
+    112, 123, 135, 148, 161, 175, 190, 205, 221, 238, 255,
+};
+
+/** @brief Duty → perceptual position in 8.8 fixed point (0..32<<8) */
+static uint32_t perceptualOf_(uint8_t duty) noexcept
+{
+    for (size_t i = 1; i < 33; ++i) {
+        if (duty <= kGamma_[i]) {
+            const uint32_t lo = kGamma_[i - 1];
+            const uint32_t span = kGamma_[i] - lo;
+            const uint32_t frac = (span > 0) ? (((duty - lo) << 8) / span) : 0;
+            return static_cast<uint32_t>((i - 1) << 8) + frac;
+        }
+    }
+    return 32u << 8;
+}
+
+/** @brief Perceptual position (8.8 fixed point) → duty */
+static uint8_t dutyOf_(uint32_t pos) noexcept
+{
+    const uint32_t i = std::min<uint32_t>(pos >> 8, 31);
+    const uint32_t frac = pos - (i << 8);
+    const uint32_t lo = kGamma_[i];
+    return static_cast<uint8_t>(lo + (((kGamma_[i + 1] - lo) * frac) >> 8));
+}
+
+uint8_t ui::UiController::brightnessTarget_(PowerState state) const noexcept
+{
+    switch (state) {
+        case PowerState::Active:
+            return pre_dim_brightness_;
+        case PowerState::Dimmed:
+            // A live run keeps a readable floor; plain idle drops to the
+            // dim floor, lower still once the clock says night. Floors
+            // never raise a user brightness already below them.
+            if (run_active_) {
+                return std::min<uint8_t>(pre_dim_brightness_, kWatchBrightness_);
+            }
+            return std::min<uint8_t>(pre_dim_brightness_,
+                                     nightHours_() ? kNightBrightness_ : kDimBrightness_);
+        case PowerState::Sleeping:
+        default:
+            return 0;
+    }
+}
+
+void ui::UiController::startBrightnessRamp_(uint8_t target, uint32_t now_ms) noexcept
+{
+    const uint8_t current = M5.Display.getBrightness();
+    if (target >= current) {
+        // Upward moves are always instant (input restore, alert).
+        bright_ramp_ms_ = 0;
+        M5.Display.setBrightness(target);
+        return;
+    }
+    bright_from_ = current;
+    bright_to_ = target;
+    bright_ramp_ms_ = (now_ms != 0) ? now_ms : 1;
+}
+
+void ui::UiController::serviceBrightnessRamp_(uint32_t now_ms) noexcept
+{
+    if (bright_ramp_ms_ == 0) {
+        return;
+    }
+    const uint32_t t = now_ms - bright_ramp_ms_;
+    if (t >= kFade_ms) {
+        bright_ramp_ms_ = 0;
+        M5.Display.setBrightness(bright_to_);
+        return;
+    }
+    const uint32_t pa = perceptualOf_(bright_from_);
+    const uint32_t pb = perceptualOf_(bright_to_);
+    const uint32_t pos = pa - ((pa - pb) * t) / kFade_ms;
+    M5.Display.setBrightness(dutyOf_(pos));
+}
+
+bool ui::UiController::nightHours_() noexcept
+{
+    // Only meaningful once the RTC probe has synced the system clock;
+    // before that the epoch sits in 1970 and the check stays off.
+    const time_t now = time(nullptr);
+    struct tm local {};
+    localtime_r(&now, &local);
+    if (local.tm_year + 1900 < 2020) {
+        return false;
+    }
+    return local.tm_hour >= 22 || local.tm_hour < 7;
+}
+
+void ui::UiController::raiseAlert_(AlertSeverity sev, uint32_t now_ms) noexcept
+{
+    if (static_cast<uint8_t>(sev) <= static_cast<uint8_t>(alert_sev_)) {
+        return;  // never downgrade a standing alert
+    }
+    alert_sev_ = sev;
+    alert_since_ms_ = now_ms;
+    alert_pulsing_ = false;  // base re-captured once awake and unramped
+    dirty_ = true;           // one full frame lays the rim ring down
+}
+
+void ui::UiController::clearAlert_() noexcept
+{
+    if (alert_sev_ == AlertSeverity::None) {
+        return;
+    }
+    alert_sev_ = AlertSeverity::None;
+    alert_since_ms_ = 0;
+    if (alert_pulsing_) {
+        alert_pulsing_ = false;
+        M5.Display.setBrightness(alert_base_brightness_);
+    }
+    dirty_ = true;  // erase the rim ring
+}
+
+void ui::UiController::serviceAlertPulse_(uint32_t now_ms) noexcept
+{
+    if (alert_sev_ == AlertSeverity::None) {
+        return;
+    }
+    if (alert_sev_ == AlertSeverity::Warn &&
+        (now_ms - alert_since_ms_) >= kAlertWarnAuto_ms) {
+        clearAlert_();
+        return;
+    }
+    // The pulse owns the backlight only while the display is awake with no
+    // fade in flight. The raise sites count as activity (see noteErrorCode_),
+    // so the governor's wake path gets the panel lit first; the working
+    // level is captured after that, not mid-dim.
+    if (power_state_ != PowerState::Active || bright_ramp_ms_ != 0) {
+        if (alert_pulsing_) {
+            alert_pulsing_ = false;
+            M5.Display.setBrightness(alert_base_brightness_);
+        }
+        return;
+    }
+    if (!alert_pulsing_) {
+        alert_pulsing_ = true;
+        alert_base_brightness_ = M5.Display.getBrightness();
+    }
+    // Triangle wave between the working level and full, stepped in the
+    // perceptual domain so both halves of the breathe read evenly.
+    const uint32_t period = (alert_sev_ == AlertSeverity::Critical)
+                                ? kAlertCritPeriod_ms : kAlertWarnPeriod_ms;
+    const uint32_t t = (now_ms - alert_since_ms_) % period;
+    const uint32_t half = period / 2;
+    const uint32_t pos = (t < half) ? t : (period - t);
+    const uint32_t pa = perceptualOf_(alert_base_brightness_);
+    const uint32_t pb = perceptualOf_(255);
+    M5.Display.setBrightness(dutyOf_(pa + ((pb - pa) * pos) / half));
+}
+
+/**
+ * @brief Bounding box of the rim arc from a0 to a1 degrees
+ * @details Samples both endpoints at the outer radius plus every cardinal
+ *          crossing inside the span (the extreme points of a circular arc),
+ *          then pads by the ring thickness. Angles above 360 are fine —
+ *          the trig is periodic — so a wrapping comet needs no splitting.
+ */
+void ui::UiController::saverArcBBox_(int a0, int a1, int16_t& x, int16_t& y,
+                                     int16_t& w, int16_t& h) noexcept
+{
+    float min_x = SCREEN_SIZE_, min_y = SCREEN_SIZE_, max_x = 0.0f, max_y = 0.0f;
+    const auto take = [&](int deg) noexcept {
+        const float rad = deg * 0.017453293f;
+        const float px = CENTER_X_ + cosf(rad) * 119.0f;
+        const float py = CENTER_Y_ + sinf(rad) * 119.0f;
+        min_x = std::min(min_x, px);
+        min_y = std::min(min_y, py);
+        max_x = std::max(max_x, px);
+        max_y = std::max(max_y, py);
+    };
+    take(a0);
+    take(a1);
+    for (int c = (a0 / 90 + 1) * 90; c < a1; c += 90) {
+        take(c);
+    }
+    const int16_t pad = 6;  // ring thickness + rounding
+    x = static_cast<int16_t>(std::max(0, static_cast<int>(min_x) - pad));
+    y = static_cast<int16_t>(std::max(0, static_cast<int>(min_y) - pad));
+    w = static_cast<int16_t>(std::min<int>(SCREEN_SIZE_ - x,
+                                           static_cast<int>(max_x - min_x) + 2 * pad));
+    h = static_cast<int16_t>(std::min<int>(SCREEN_SIZE_ - y,
+                                           static_cast<int>(max_y - min_y) + 2 * pad));
+}
+
+void ui::UiController::serviceScreensaver_(uint32_t now_ms) noexcept
+{
+    // Runs only from a settled dim: an alert owns the rim (and the
+    // backlight), an OTA overlay means someone is watching a transfer.
+    const bool want = power_state_ == PowerState::Dimmed &&
+                      alert_sev_ == AlertSeverity::None &&
+                      ota_state_ == espnow::OtaState::Idle &&
+                      (now_ms - power_state_since_ms_) >= kSaverAfter_ms;
+    int16_t x = 0, y = 0, w = 0, h = 0;
+    if (!want) {
+        if (saver_active_) {
+            // One partial frame erases the comet (the page repaints the
+            // rect, the overlay no longer draws); a wake's full redraw
+            // would cover it too, but sleep entry would not.
+            saver_active_ = false;
+            saverArcBBox_(saver_deg_, saver_deg_ + kSaverArc_deg, x, y, w, h);
+            markDirty_(x, y, w, h);
+            dirty_ = true;
+        }
+        return;
+    }
+    if (!saver_active_) {
+        saver_active_ = true;
+        saver_step_ms_ = now_ms;
+    } else if (now_ms - saver_step_ms_ < kSaverStep_ms) {
+        return;
+    }
+    saver_step_ms_ = now_ms;
+    // Old span dirtied for the tail erase, new span for the head; with a
+    // 3 degree step the union is barely larger than the comet itself.
+    saverArcBBox_(saver_deg_, saver_deg_ + kSaverArc_deg, x, y, w, h);
+    markDirty_(x, y, w, h);
+    saver_deg_ = static_cast<uint16_t>((saver_deg_ + kSaverStep_deg) % 360);
+    saverArcBBox_(saver_deg_, saver_deg_ + kSaverArc_deg, x, y, w, h);
+    markDirty_(x, y, w, h);
+    dirty_ = true;
+}
+
+bool ui::UiController::lightSleepWait_() noexcept
+{
+    // Drain any flush still on the wire; light sleep gates both cores and
+    // the SPI peripheral, so a transfer must not be mid-flight.
+    M5.Display.waitDMA();
+
+    // The quadrature pins idle at whichever level the detent left them,
+    // so each is armed for the opposite of its current reading; any
+    // movement then wakes. The FT3267 interrupt line is active low.
+    const auto arm = [](gpio_num_t pin) noexcept {
+        if (pin == GPIO_NUM_NC) {
+            return;
+        }
+        (void)gpio_wakeup_enable(pin, gpio_get_level(pin) != 0 ? GPIO_INTR_LOW_LEVEL
+                                                               : GPIO_INTR_HIGH_LEVEL);
+    };
+    arm(DIAL_ENCODER_PIN_A_);
+    arm(DIAL_ENCODER_PIN_B_);
+    arm(DIAL_ENCODER_PIN_SW_);
+    (void)gpio_wakeup_enable(DIAL_TOUCH_INT_PIN_, GPIO_INTR_LOW_LEVEL);
+    (void)esp_sleep_enable_gpio_wakeup();
+    // WiFi RX keeps ESP-NOW alive through the nap (the connectionless
+    // power-save window is configured at radio init); the timer slice
+    // keeps the 1 Hz poll/keepalive cadence roughly intact.
+    (void)esp_sleep_enable_wifi_wakeup();
+    (void)esp_sleep_enable_timer_wakeup(kSleepSlice_us);
+    (void)esp_light_sleep_start();
+
+    // gpio_wakeup_enable switched the touch INT pin to level triggering;
+    // restore the edge type the touch-down ISR is registered for.
+    if (touch_irq_queue_ != nullptr) {
+        (void)gpio_set_intr_type(DIAL_TOUCH_INT_PIN_, GPIO_INTR_NEGEDGE);
+    }
+
+    return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO;
 }
 
 const char* ui::UiController::pageName_(Page p) noexcept
@@ -266,6 +1964,16 @@ const char* ui::UiController::pageName_(Page p) noexcept
             return "Live";
         case Page::Terminal:
             return "Terminal";
+        case Page::Diagnostics:
+            return "Link";
+        case Page::History:
+            return "History";
+        case Page::Timeline:
+            return "Timeline";
+        case Page::Fleet:
+            return "Fleet";
+        case Page::Dashboard:
+            return "Dashboard";
         default:
             return "";
     }
@@ -275,58 +1983,608 @@ void ui::UiController::logf_(uint32_t now_ms, const char* fmt, ...)
 {
     va_list args;
     va_start(args, fmt);
-    LogLine line{};
-    line.ms = now_ms;
-    vsnprintf(line.text, sizeof(line.text), fmt, args);
+    logVa_(LogLevel::Info, now_ms, fmt, args);
+    va_end(args);
+}
+
+void ui::UiController::logfAt_(LogLevel level, uint32_t now_ms, const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    logVa_(level, now_ms, fmt, args);
     va_end(args);
+}
+
+/**
+ * @brief Walk a format string once and record its capture layout
+ * @details Mirrors the re-expansion walk in formatLogRecord_ so both sides
+ *          agree on which argument belongs to which spec. Length modifiers
+ *          are noted (PRIu32 expands to %lu on this target) even though
+ *          long and int share a width here, so the layout stays honest.
+ */
+void ui::UiController::parseLogFmt_(const char* fmt, LogFmtSpec& out) noexcept
+{
+    out.fmt = fmt;
+    out.argc = 0;
+    out.kinds = 0;
+    for (const char* p = fmt; *p != '\0' && out.argc < kLogMaxArgs_; ++p) {
+        if (*p != '%') {
+            continue;
+        }
+        ++p;
+        if (*p == '%' || *p == '\0') {
+            continue;  // literal percent
+        }
+        bool long_mod = false;
+        while (*p != '\0' && strchr("diouxXeEfFgGcsp", *p) == nullptr) {
+            if (*p == 'l' || *p == 'z') {
+                long_mod = true;
+            }
+            ++p;
+        }
+        if (*p == '\0') {
+            break;
+        }
+        LogArgKind kind = long_mod ? LogArgKind::Long : LogArgKind::Int;
+        switch (*p) {
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G':
+                kind = LogArgKind::Float;
+                break;
+            case 's': case 'p':
+                kind = LogArgKind::Ptr;
+                break;
+            default:
+                break;
+        }
+        out.kinds = static_cast<uint16_t>(
+            out.kinds | (static_cast<uint16_t>(kind) << (2 * out.argc)));
+        ++out.argc;
+    }
+}
+
+/**
+ * @brief Look up (or intern) the capture layout for a format literal
+ * @details Open-addressed on the literal's flash address; first use parses
+ *          and inserts, later uses are a probe or two. A full table (more
+ *          distinct formats than kLogFmtTable_) degrades to parse-per-call
+ *          for the overflow formats only.
+ */
+void ui::UiController::logFmtSpecFor_(const char* fmt, LogFmtSpec& out) noexcept
+{
+    size_t slot = (reinterpret_cast<uintptr_t>(fmt) * 2654435761u) &
+                  (kLogFmtTable_ - 1);
+    for (size_t probe = 0; probe < kLogFmtTable_; ++probe) {
+        LogFmtSpec& e = log_fmt_table_[slot];
+        if (e.fmt == fmt) {
+            out = e;
+            return;
+        }
+        if (e.fmt == nullptr) {
+            parseLogFmt_(fmt, out);
+            e = out;
+            ++log_fmt_count_;
+            return;
+        }
+        slot = (slot + 1) & (kLogFmtTable_ - 1);
+    }
+    parseLogFmt_(fmt, out);  // Table full; this format stays uninterned
+}
+
+void ui::UiController::logVa_(LogLevel level, uint32_t now_ms, const char* fmt,
+                              va_list args) noexcept
+{
+    // Capture raw arguments instead of formatting: a handful of va_arg
+    // copies per event instead of a vsnprintf. The text is reconstructed
+    // lazily by formatLogRecord_ for the rows drawTerminal_ displays, and
+    // exactly once by drainLogSinks_ for the flash and serial sinks. The
+    // per-format spec walk is interned (see logFmtSpecFor_), so steady-
+    // state capture is argc va_arg copies off a cached layout.
+    LogRecord rec{};
+    rec.fmt = fmt;
+    rec.ms = now_ms;
+    rec.level = static_cast<uint8_t>(level);
+
+    LogFmtSpec spec;
+    logFmtSpecFor_(fmt, spec);
+    for (uint8_t i = 0; i < spec.argc; ++i) {
+        const auto kind = static_cast<LogArgKind>((spec.kinds >> (2 * i)) & 0x3);
+        uint32_t raw = 0;
+        switch (kind) {
+            case LogArgKind::Float: {
+                const float v = static_cast<float>(va_arg(args, double));
+                memcpy(&raw, &v, sizeof(raw));
+                break;
+            }
+            case LogArgKind::Ptr:
+                raw = static_cast<uint32_t>(
+                    reinterpret_cast<uintptr_t>(va_arg(args, const void*)));
+                break;
+            case LogArgKind::Long:
+                raw = static_cast<uint32_t>(va_arg(args, unsigned long));
+                break;
+            case LogArgKind::Int:
+                raw = static_cast<uint32_t>(va_arg(args, unsigned int));
+                break;
+        }
+        rec.args[rec.argc++] = raw;
+    }
 
-    log_[log_head_] = line;
+    HOT_ASSERT(log_head_ < LOG_CAPACITY_);
+    log_[log_head_] = rec;
     log_head_ = (log_head_ + 1) % LOG_CAPACITY_;
     log_count_ = std::min(LOG_CAPACITY_, log_count_ + 1);
+    ++log_generation_;
     if (page_ == Page::Terminal && scroll_lines_ == 0) {
-        dirty_ = true;
+        // Only the log area and footer change; the header stays put.
+        markDirty_(0, 38, 240, 202);
     }
 }
 
-void ui::UiController::handleProtoEvents_(uint32_t now_ms) noexcept
+void ui::UiController::formatLogRecord_(const LogRecord& rec, char* out, size_t out_size) noexcept
 {
-    espnow::ProtoEvent evt{};
-    while (proto_events_ && xQueueReceive(proto_events_, &evt, 0) == pdTRUE) {
-        if (evt.device_id != fatigue_proto::DEVICE_ID_FATIGUE_TESTER_) {
+    // Re-expand the captured record spec by spec, mirroring the capture walk
+    // in logf_ so both sides agree on which argument belongs to which spec.
+    size_t n = 0;
+    uint8_t arg = 0;
+    const char* p = rec.fmt;
+    while (*p != '\0' && n + 1 < out_size) {
+        if (*p != '%') {
+            out[n++] = *p++;
             continue;
         }
-
-        // Update connection status on any valid message
-        last_rx_ms_ = now_ms;
-        if (conn_status_ != ConnStatus::Connected) {
-            conn_status_ = ConnStatus::Connected;
-            // We just (re)connected; force a resync on the next ConfigResponse so
-            // any offline edits do not linger or get partially overwritten.
-            pending_machine_resync_ = true;
-            // Immediately poll all info on fresh connection
-            (void)espnow::SendConfigRequest(fatigue_proto::DEVICE_ID_FATIGUE_TESTER_);
-            logf_(now_ms, "Connected to fatigue tester - polling config and status");
+        if (p[1] == '%') {
+            out[n++] = '%';
+            p += 2;
+            continue;
         }
 
-        switch (evt.type) {
-            case espnow::MsgType::StatusUpdate: {
-                fatigue_proto::StatusPayload status{};
-                if (fatigue_proto::ParseStatus(evt.payload, evt.payload_len, status)) {
-                    last_status_ = status;
-                    have_status_ = true;
-                    logf_(now_ms, "RX: Status cycle=%" PRIu32 " state=%u err=%u", status.cycle_number,
-                          static_cast<unsigned>(status.state), static_cast<unsigned>(status.err_code));
-
-                    // If motor power has been disabled (or bounds expired), previously found bounds
-                    // must not be shown as valid. Clear cached bounds results so the UI forces a re-find.
-                    if (status.bounds_valid == 0) {
-                        if (bounds_have_result_ || bounds_state_ == BoundsState::Complete) {
-                            boundsResetResult_();
-                            bounds_state_ = BoundsState::Idle;
-                            bounds_state_since_ms_ = now_ms;
-                            logf_(now_ms, "UI: cleared cached bounds (invalidated)");
-                        }
-                    }
+        // Copy the full spec into a scratch buffer for snprintf.
+        char spec[12];
+        size_t s = 0;
+        bool long_mod = false;
+        char conv = '\0';
+        spec[s++] = *p++;
+        while (*p != '\0' && s + 1 < sizeof(spec)) {
+            const char c = *p++;
+            spec[s++] = c;
+            if (c == 'l' || c == 'z') {
+                long_mod = true;
+            }
+            if (strchr("diouxXeEfFgGcsp", c) != nullptr) {
+                conv = c;
+                break;
+            }
+        }
+        spec[s] = '\0';
+        if (conv == '\0' || arg >= rec.argc) {
+            break;  // malformed spec or truncated capture
+        }
+
+        const uint32_t raw = rec.args[arg++];
+        int wrote = 0;
+        switch (conv) {
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': {
+                float v = 0.0f;
+                memcpy(&v, &raw, sizeof(v));
+                wrote = snprintf(out + n, out_size - n, spec, static_cast<double>(v));
+                break;
+            }
+            case 's':
+                wrote = snprintf(out + n, out_size - n, spec,
+                                 reinterpret_cast<const char*>(static_cast<uintptr_t>(raw)));
+                break;
+            case 'p':
+                wrote = snprintf(out + n, out_size - n, spec,
+                                 reinterpret_cast<const void*>(static_cast<uintptr_t>(raw)));
+                break;
+            default:
+                if (long_mod) {
+                    wrote = snprintf(out + n, out_size - n, spec,
+                                     static_cast<unsigned long>(raw));
+                } else {
+                    wrote = snprintf(out + n, out_size - n, spec, raw);
+                }
+                break;
+        }
+        if (wrote < 0) {
+            break;
+        }
+        n += std::min(static_cast<size_t>(wrote), out_size - 1 - n);
+    }
+    out[n] = '\0';
+}
+
+void ui::UiController::serialLogTaskEntry_(void* arg) noexcept
+{
+    // Owns the UART write: a slow console baud stalls this task, never the
+    // tick that produced the line.
+    auto* queue = static_cast<QueueHandle_t>(arg);
+    SerialLogLine line;
+    while (true) {
+        if (xQueueReceive(queue, &line, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        static const char level_ch[] = {'I', 'W', 'E'};
+        printf("[%6lu.%03lu] %c %s\n",
+               static_cast<unsigned long>(line.ms / 1000U),
+               static_cast<unsigned long>(line.ms % 1000U),
+               level_ch[line.level < 3 ? line.level : 0], line.text);
+    }
+}
+
+void ui::UiController::drainLogSinks_() noexcept
+{
+    uint32_t pending = log_generation_ - session_log_drained_gen_;
+    if (pending == 0) {
+        return;
+    }
+    if (pending > log_count_) {
+        pending = static_cast<uint32_t>(log_count_);  // overwritten before drained
+    }
+
+    // Serial mirror bring-up is lazy: no queue or task exists until the
+    // first line actually heads for the UART.
+    if (log_serial_mirror_ && serial_log_queue_ == nullptr) {
+        serial_log_queue_ = xQueueCreate(16, sizeof(SerialLogLine));
+        if (serial_log_queue_ != nullptr &&
+            xTaskCreate(serialLogTaskEntry_, "ui_slog", kSerialLogTaskStack_,
+                        serial_log_queue_, kSerialLogTaskPrio_, nullptr) != pdPASS) {
+            vQueueDelete(serial_log_queue_);
+            serial_log_queue_ = nullptr;
+            log_serial_mirror_ = false;  // No task to drain it; stay ring+flash only.
+        }
+        if (serial_log_queue_ != nullptr) {
+            qs_slog_ = queue_stats::Register(serial_log_queue_, "slog", 16);
+        }
+    }
+
+    // One formatting pass per record, fanned out to every sink whose level
+    // filter passes. The terminal ring needs no pass at all - it formats
+    // lazily from the binary records when rows are actually drawn.
+    char text[96];
+    for (uint32_t back = pending; back > 0; --back) {  // oldest first
+        const size_t newest = (log_head_ + LOG_CAPACITY_ - 1) % LOG_CAPACITY_;
+        const size_t index = (newest + LOG_CAPACITY_ - (back - 1)) % LOG_CAPACITY_;
+        HOT_ASSERT(index < LOG_CAPACITY_);
+        const LogRecord& rec = log_[index];
+        const bool want_flash = rec.level >= static_cast<uint8_t>(log_flash_level_);
+        const bool want_serial = log_serial_mirror_ && serial_log_queue_ != nullptr &&
+                                 rec.level >= static_cast<uint8_t>(log_serial_level_);
+        if (!want_flash && !want_serial) {
+            continue;
+        }
+        formatLogRecord_(rec, text, sizeof(text));
+        if (want_flash) {
+            session_log::Append(rec.ms, text);
+        }
+        if (want_serial) {
+            SerialLogLine line;
+            line.ms = rec.ms;
+            line.level = rec.level;
+            snprintf(line.text, sizeof(line.text), "%s", text);
+            if (xQueueSend(serial_log_queue_, &line, 0) != pdTRUE) {
+                ++serial_log_drops_;  // Console stalled; the ring and flash still have it.
+                queue_stats::NoteDrop(qs_slog_);
+            }
+        }
+    }
+    session_log_drained_gen_ = log_generation_;
+}
+
+/**
+ * @brief Sample heap and per-task stack telemetry, log threshold crossings
+ * @details Runs every kMemSamplePeriod_ms from the housekeeping tick. Heap
+ *          numbers come from heap_caps_get_info; stack headroom is the
+ *          smallest high-water mark across all tasks. Alerts latch so a
+ *          sustained low condition produces one log line, and re-arm once
+ *          the metric recovers with 25% hysteresis.
+ */
+void ui::UiController::sampleMemTelemetry_(uint32_t now_ms) noexcept
+{
+    if (mem_.valid && (now_ms - last_mem_sample_ms_) < kMemSamplePeriod_ms) {
+        return;
+    }
+    last_mem_sample_ms_ = now_ms;
+
+    multi_heap_info_t info{};
+    heap_caps_get_info(&info, MALLOC_CAP_INTERNAL);
+    mem_.heap_free = info.total_free_bytes;
+    mem_.heap_min_free = info.minimum_free_bytes;
+    mem_.heap_largest = info.largest_free_block;
+
+    TaskStatus_t tasks[16];
+    const UBaseType_t n = uxTaskGetSystemState(tasks, 16, nullptr);
+    uint32_t worst_free = 0xFFFFFFFFu;
+    const char* worst_name = "";
+    for (UBaseType_t i = 0; i < n; ++i) {
+        const uint32_t free_bytes =
+            static_cast<uint32_t>(tasks[i].usStackHighWaterMark) * sizeof(StackType_t);
+        if (free_bytes < worst_free) {
+            worst_free = free_bytes;
+            worst_name = tasks[i].pcTaskName;
+        }
+    }
+    if (n > 0) {
+        mem_.worst_stack_free = worst_free;
+        snprintf(mem_.worst_stack_task, sizeof(mem_.worst_stack_task), "%s", worst_name);
+    }
+    mem_.valid = true;
+
+    if (!mem_alert_heap_ && mem_.heap_free < kHeapFreeWarn_bytes) {
+        mem_alert_heap_ = true;
+        logfAt_(LogLevel::Error, now_ms, "ERR: heap low %luk", static_cast<unsigned long>(mem_.heap_free / 1024));
+    } else if (mem_alert_heap_ && mem_.heap_free > kHeapFreeWarn_bytes + kHeapFreeWarn_bytes / 4) {
+        mem_alert_heap_ = false;
+    }
+    if (!mem_alert_frag_ && mem_.heap_largest < kHeapLargestWarn_bytes) {
+        mem_alert_frag_ = true;
+        logfAt_(LogLevel::Error, now_ms, "ERR: heap fragmented, big block %luk",
+              static_cast<unsigned long>(mem_.heap_largest / 1024));
+    } else if (mem_alert_frag_ &&
+               mem_.heap_largest > kHeapLargestWarn_bytes + kHeapLargestWarn_bytes / 4) {
+        mem_alert_frag_ = false;
+    }
+    if (!mem_alert_stack_ && n > 0 && mem_.worst_stack_free < kStackFreeWarn_bytes) {
+        mem_alert_stack_ = true;
+        logfAt_(LogLevel::Error, now_ms, "ERR: stack low %lu", static_cast<unsigned long>(mem_.worst_stack_free));
+    } else if (mem_alert_stack_ &&
+               mem_.worst_stack_free > kStackFreeWarn_bytes + kStackFreeWarn_bytes / 4) {
+        mem_alert_stack_ = false;
+    }
+}
+
+/**
+ * @brief Cross-check the encoder's logical position against the PCNT count
+ * @details Runs every kEncCheckPeriod_ms from the housekeeping tick, and
+ *          only once the input has been idle for kEncIdleForResync_ms —
+ *          mid-spin the hardware counter is legitimately ahead of the
+ *          driver's last poll and would read as drift. When the check
+ *          finds whole detents unaccounted for, the position is resynced
+ *          to hardware truth on the spot (the idle gate means nothing is
+ *          being edited) and the event is logged; the Diagnostics page
+ *          latches an "enc!" flag and the counters ride the PERF dump.
+ */
+void ui::UiController::serviceEncoderDrift_(uint32_t now_ms) noexcept
+{
+    if ((now_ms - last_enc_check_ms_) < kEncCheckPeriod_ms) {
+        return;
+    }
+    if ((now_ms - last_input_ms_) < kEncIdleForResync_ms) {
+        return;  // Retry next housekeeping pass; the period gate stays due
+    }
+    last_enc_check_ms_ = now_ms;
+    ++enc_drift_checks_;
+
+    const int32_t drift = encoder_.checkDrift();
+    if (drift == 0) {
+        return;
+    }
+    ++enc_drift_events_;
+    const int32_t corrected = encoder_.resyncPosition();
+    enc_drift_detents_ += static_cast<uint32_t>(corrected < 0 ? -corrected : corrected);
+    encoder_pos_ = encoder_.getPosition();
+    logfAt_(LogLevel::Warn, now_ms, "Encoder drift: %+ld detents, resynced",
+            static_cast<long>(corrected));
+}
+
+size_t ui::UiController::terminalHistoryCount_() const noexcept
+{
+    // RAM ring plus whatever flash holds beyond it. The newest flash record
+    // duplicates the oldest already-drained RAM line, so only the overhang
+    // counts.
+    const uint32_t undrained = log_generation_ - session_log_drained_gen_;
+    const size_t in_both = (undrained < log_count_) ? (log_count_ - undrained) : 0;
+    const size_t in_flash = session_log::Count();
+    return log_count_ + ((in_flash > in_both) ? (in_flash - in_both) : 0);
+}
+
+void ui::UiController::traceInputCorr_() noexcept
+{
+    // New causality chain: ambient for everything this event touches on
+    // the tick core, remembered for the render task's adoption in
+    // renderFrame_. Compiles to a store of 0 when tracing is off.
+    frame_corr_ = trace::NextCorrelation();
+    trace::SetCorrelation(frame_corr_);
+}
+
+void ui::UiController::handleProtoEvents_(uint32_t now_ms) noexcept
+{
+    TRACE_SCOPE("handleProtoEvents");
+    espnow::ProtoEvent evt{};
+    int budget = kProtoEventBudget_;
+    while (proto_events_ && budget-- > 0 && xQueueReceive(proto_events_, &evt, 0) == pdTRUE) {
+        // Each consumed event starts its own causality chain: whatever it
+        // dirties is this event's redraw, not the previous input's.
+        traceInputCorr_();
+        // Interleave protocol events into the input trace so an exported
+        // recording shows what the link was doing between the inputs.
+        input_trace::Note(input_trace::Kind::Proto,
+                          static_cast<int16_t>(evt.type), 0, now_ms);
+        // Internal readiness event from the async radio bring-up.
+        if (evt.type == espnow::MsgType::RadioReady) {
+            // Either verdict ends the boot screen's wait; a failed radio
+            // should not pin the splash at its hold cap.
+            boot_radio_ready_ = true;
+            if (evt.sequence_id != 0) {
+                logf_(now_ms, "Radio ready - polling config");
+                (void)sendConfigRequestActive_();
+            } else {
+                logfAt_(LogLevel::Error, now_ms, "ERR: radio init failed");
+            }
+            espnow::ReleaseEvent(evt);
+            continue;
+        }
+        // Link supervisor verdicts: these arrive within a few hundred
+        // milliseconds of an RF gap opening or closing, well before the
+        // passive 3 s rx timeout would notice anything.
+        if (evt.type == espnow::MsgType::LinkUp ||
+            evt.type == espnow::MsgType::LinkDown) {
+            const int su = unitIndexForEvent_(evt);
+            const bool up = (evt.type == espnow::MsgType::LinkUp);
+            if (su >= 0) {
+                units_[su].conn = up ? ConnStatus::Connected : ConnStatus::Disconnected;
+                if (!up) {
+                    units_[su].have_status = false;
+                    units_[su].decoder.Reset();
+                }
+            }
+            if (su < 0 || su == active_unit_) {
+                if (up) {
+                    if (conn_status_ != ConnStatus::Connected) {
+                        conn_status_ = ConnStatus::Connected;
+                        pending_machine_resync_ = true;
+                        (void)sendConfigRequestActive_();
+                        // The unit may have rebooted to its default status
+                        // rate; push ours again on the next service pass.
+                        status_rate_sent_ms_ = 0;
+                        logf_(now_ms, "Link restored - resyncing");
+                        dirty_ = true;
+                    }
+                } else if (conn_status_ != ConnStatus::Disconnected) {
+                    conn_status_ = ConnStatus::Disconnected;
+                    status_decoder_.Reset();
+                    logf_(now_ms, "Link lost (probe timeout)");
+                    raiseAlert_(AlertSeverity::Warn, now_ms);
+                    dirty_ = true;
+                }
+            }
+            espnow::ReleaseEvent(evt);
+            continue;
+        }
+        // Operator badge-in: the UID rides in src_mac (first bytes) with
+        // the length in sequence_id; runs recorded from here on carry it.
+        if (evt.type == espnow::MsgType::BadgeScan) {
+            logf_(now_ms, "Operator badge %02X%02X%02X%02X",
+                  evt.src_mac[0], evt.src_mac[1], evt.src_mac[2], evt.src_mac[3]);
+            playBeep_(3);  // Confirm chirp
+            espnow::ReleaseEvent(evt);
+            continue;
+        }
+        // Clock sync verdicts: the logged offset is the anchor that lets
+        // this session log and the unit's be merged onto one timeline, so
+        // it is written on first lock and on every visible step.
+        if (evt.type == espnow::MsgType::TimeSyncUpdate) {
+            espnow::PeerTimeSync ts{};
+            if (espnow::GetPeerTimeSync(evt.src_mac, ts)) {
+                logf_(now_ms, "TSYNC: %s clock %+ld ms (rtt %u)",
+                      espnow::PeerLabel(evt.peer_index),
+                      static_cast<long>(ts.offset_ms),
+                      static_cast<unsigned>(ts.rtt_ms));
+            }
+            espnow::ReleaseEvent(evt);
+            continue;
+        }
+        // Allowlist replication landed: device_id carries how many entries
+        // changed. Merged entries mean new units to show, so the fleet
+        // page refreshes.
+        if (evt.type == espnow::MsgType::AllowlistUpdate) {
+            logf_(now_ms, "Fleet: peers from %02X:%02X (%u merged)",
+                  evt.src_mac[4], evt.src_mac[5],
+                  static_cast<unsigned>(evt.device_id));
+            playBeep_(evt.device_id > 0 ? 3 : 2);
+            dirty_ = true;
+            espnow::ReleaseEvent(evt);
+            continue;
+        }
+        if (evt.device_id != fatigue_proto::DEVICE_ID_FATIGUE_TESTER_) {
+            espnow::ReleaseEvent(evt);
+            continue;
+        }
+
+        // Route by source: a message from a background unit only refreshes
+        // that unit's fleet slot; the active unit flows through the legacy
+        // single-unit path below.
+        const int unit = unitIndexForEvent_(evt);
+        if (unit >= 0 && unit != active_unit_) {
+            UnitState& u = units_[unit];
+            u.last_rx_ms = now_ms;
+            u.conn = ConnStatus::Connected;
+            if (evt.type == espnow::MsgType::StatusUpdate) {
+                fatigue_proto::StatusPayload status{};
+                if (fatigue_proto::ParseStatus(evt.version, evt.payload, evt.payload_len,
+                                               u.decoder, status)) {
+                    u.status = status;
+                    u.have_status = true;
+                    telemetry_bridge::PublishStatus(now_ms, evt.src_mac, status.cycle_number,
+                                                    status.state, status.err_code);
+                } else {
+                    espnow::NoteBadPayload();
+                }
+            }
+            espnow::ReleaseEvent(evt);
+            continue;
+        }
+
+        // Update connection status on any valid message
+        last_rx_ms_ = now_ms;
+        if (unit >= 0) {
+            units_[unit].last_rx_ms = now_ms;
+            units_[unit].conn = ConnStatus::Connected;
+        }
+        if (conn_status_ != ConnStatus::Connected) {
+            conn_status_ = ConnStatus::Connected;
+            timeline_events_ |= kTlEvReconnect_;
+            // We just (re)connected; force a resync on the next ConfigResponse so
+            // any offline edits do not linger or get partially overwritten.
+            pending_machine_resync_ = true;
+            // Immediately poll all info on fresh connection
+            (void)sendConfigRequestActive_();
+            logf_(now_ms, "Connected to fatigue tester - polling config and status");
+        }
+
+        switch (evt.type) {
+            case espnow::MsgType::StatusUpdate: {
+                fatigue_proto::StatusPayload status{};
+                fatigue_proto::StatusDecoder& decoder =
+                    (unit >= 0) ? units_[unit].decoder : status_decoder_;
+                if (fatigue_proto::ParseStatus(evt.version, evt.payload, evt.payload_len,
+                                               decoder, status)) {
+                    wire_capture::Note(evt.version >= 2 ? wire_capture::Kind::StatusV2
+                                                        : wire_capture::Kind::Status,
+                                       evt.payload, evt.payload_len);
+                    const uint8_t prev_state = last_status_.state;
+                    last_status_ = status;
+                    have_status_ = true;
+                    if (unit >= 0) {
+                        units_[unit].status = status;
+                        units_[unit].have_status = true;
+                    }
+                    telemetry_bridge::PublishStatus(now_ms, evt.src_mac, status.cycle_number,
+                                                    status.state, status.err_code);
+                    session_restore::NoteStatus(status.state, status.err_code,
+                                                status.cycle_number);
+                    // The unit reporting the expected state confirms a
+                    // speculative transition even if the ack was lost.
+                    if (spec_.since_ms != 0 && status.state == spec_.expected_state) {
+                        spec_ = {};
+                    }
+                    cycle_history_.push(now_ms, status.cycle_number);
+                    cycle_est_.push(now_ms, status.cycle_number);
+                    live_anchor_ms_ = now_ms;  // re-anchor the interpolated digits
+                    serviceStallAlert_(now_ms);
+                    noteErrorCode_(status.err_code, now_ms);
+                    noteRunTransition_(prev_state, status.state, status, now_ms);
+                    logf_(now_ms, "RX: Status cycle=%" PRIu32 " state=%u err=%u", status.cycle_number,
+                          static_cast<unsigned>(status.state), static_cast<unsigned>(status.err_code));
+
+                    // If motor power has been disabled (or bounds expired), previously found bounds
+                    // must not be shown as valid. Clear cached bounds results so the UI forces a re-find.
+                    if (status.bounds_valid == 0) {
+                        if (bounds_have_result_ || bounds_state_ == BoundsState::Complete) {
+                            boundsResetResult_();
+                            bounds_state_ = BoundsState::Idle;
+                            bounds_state_since_ms_ = now_ms;
+                            logf_(now_ms, "UI: cleared cached bounds (invalidated)");
+                        }
+                        // The persisted copy is stale for the same reason
+                        // (power cycle, fixture change): drop it too, or a
+                        // later session would offer limits the unit itself
+                        // no longer trusts.
+                        uint8_t mac[6];
+                        if (activeUnitMac_(mac)) {
+                            SettingsStore::ClearBoundsForPeer(mac);
+                        }
+                    }
 
                     // If bounds UI is running, allow a state transition on real status.
                     const auto st = static_cast<fatigue_proto::TestState>(status.state);
@@ -341,15 +2599,88 @@ void ui::UiController::handleProtoEvents_(uint32_t now_ms) noexcept
                             dirty_ = true;
                         }
                     }
+
+                    // LiveCounter during a run: when the progress arc hasn't
+                    // visibly moved (sub-degree), only the center digits and
+                    // state pill need repainting. A forward arc move marks
+                    // just the new segment's box and the draw path extends
+                    // the retained arc; regressions and state-color changes
+                    // fall back to a full frame.
+                    if (page_ == Page::LiveCounter && live_popup_mode_ == LivePopupMode::None &&
+                        status.state == prev_state) {
+                        const uint32_t tgt = edit_settings_.test_unit.cycle_amount;
+                        const float prog = (tgt > 0)
+                            ? std::min(1.0f, static_cast<float>(status.cycle_number) / static_cast<float>(tgt))
+                            : 0.0f;
+                        if (live_arc_drawn_progress_ >= 0.0f &&
+                            std::fabs(prog - live_arc_drawn_progress_) < (1.0f / 360.0f)) {
+                            markDirty_(48, 72, 144, 112);
+                        } else if (live_arc_drawn_progress_ >= 0.0f &&
+                                   prog > live_arc_drawn_progress_) {
+                            markDirty_(48, 72, 144, 112);
+                            markArcSegment_(-90.0f + 360.0f * live_arc_drawn_progress_,
+                                            -90.0f + 360.0f * prog);
+                        } else {
+                            dirty_ = true;
+                        }
+                    } else {
+                        dirty_ = true;
+                    }
+                } else {
+                    espnow::NoteBadPayload();
+                }
+                break;
+            }
+            case espnow::MsgType::StatusBatch: {
+                fatigue_proto::StatusSample samples[fatigue_proto::STATUS_BATCH_MAX_SAMPLES_];
+                size_t n = 0;
+                if (fatigue_proto::ParseStatusBatch(evt.payload, evt.payload_len, samples,
+                                                    fatigue_proto::STATUS_BATCH_MAX_SAMPLES_, n) && n > 0) {
+                    wire_capture::Note(wire_capture::Kind::Batch, evt.payload, evt.payload_len);
+                    // Sender timestamps are rebased so the newest sample lands
+                    // at local now_ms, keeping the ring on one clock.
+                    const uint32_t offset = now_ms - samples[n - 1].timestamp_ms;
+                    for (size_t i = 0; i < n; ++i) {
+                        cycle_history_.push(samples[i].timestamp_ms + offset, samples[i].cycle_number);
+                        cycle_est_.push(samples[i].timestamp_ms + offset, samples[i].cycle_number);
+                    }
+                    last_status_.cycle_number = samples[n - 1].cycle_number;
+                    last_status_.state = samples[n - 1].state;
+                    have_status_ = true;
+                    live_anchor_ms_ = now_ms;
+                    serviceStallAlert_(now_ms);
+                    logf_(now_ms, "RX: StatusBatch n=%u cycle=%" PRIu32,
+                          static_cast<unsigned>(n), samples[n - 1].cycle_number);
                     dirty_ = true;
+                } else {
+                    espnow::NoteBadPayload();
                 }
                 break;
             }
             case espnow::MsgType::ConfigResponse: {
                 fatigue_proto::ConfigPayload cfg{};
                 if (fatigue_proto::ParseConfig(evt.payload, evt.payload_len, cfg)) {
+                    wire_capture::Note(wire_capture::Kind::Config, evt.payload, evt.payload_len);
                     last_remote_config_ = cfg;
                     have_remote_config_ = true;
+
+                    // Reconnect convergence: if the unit still reports the
+                    // generation we last synced against, its config has not
+                    // changed and the edit-discarding resync below is
+                    // unnecessary.
+                    uint16_t gen = 0;
+                    const bool has_gen =
+                        fatigue_proto::ParseConfigGeneration(evt.payload, evt.payload_len, gen);
+                    if (pending_machine_resync_ && has_gen && have_remote_config_gen_ &&
+                        gen == remote_config_gen_) {
+                        pending_machine_resync_ = false;
+                        logf_(now_ms, "UI: config gen unchanged, resync skipped");
+                    }
+                    if (has_gen) {
+                        remote_config_gen_ = gen;
+                        have_remote_config_gen_ = true;
+                    }
+
                       logf_(now_ms, "RX: ConfigResponse cycles=%" PRIu32 " VMAX=%.1f AMAX=%.1f dwell=%.2fs",
                           cfg.cycle_amount, cfg.oscillation_vmax_rpm, cfg.oscillation_amax_rev_s2,
                           static_cast<double>(cfg.dwell_time_ms) / 1000.0);
@@ -376,7 +2707,7 @@ void ui::UiController::handleProtoEvents_(uint32_t now_ms) noexcept
                             } else {
                                 applyConfigToSettings_(edit_settings_, cfg);
                             }
-                            original_settings_ = edit_settings_;
+                            resetSettingsBaseline_();
                             settings_dirty_ = false;
                             logf_(now_ms, "UI: resynced settings from machine");
                         }
@@ -390,24 +2721,25 @@ void ui::UiController::handleProtoEvents_(uint32_t now_ms) noexcept
                         const bool safe_to_refresh_list = (!settings_dirty_) && (!settings_value_editor_active_) && (settings_popup_mode_ == SettingsPopupMode::None);
                         if (safe_to_refresh_list) {
                             applyConfigToSettings_(edit_settings_, cfg);
-                            original_settings_ = edit_settings_;
+                            resetSettingsBaseline_();
                         }
                     }
 
                     dirty_ = true;
+                } else {
+                    espnow::NoteBadPayload();
                 }
                 break;
             }
             case espnow::MsgType::CommandAck: {
                 logf_(now_ms, "RX: CommandAck");
 
-                // Live Counter: clear the pending "SENDING..." overlay on any ACK that
-                // arrives while a command is outstanding. CommandAck is not correlated,
+                // Live Counter: confirm an open speculative transition on any ACK
+                // that arrives while one is outstanding. CommandAck is not correlated,
                 // so we use timing heuristics similar to the reference remote.
-                if (pending_command_id_ != 0U) {
-                    if ((now_ms - pending_command_tick_) <= 3000U) {
-                        pending_command_id_ = 0U;
-                        pending_command_tick_ = 0U;
+                if (spec_.since_ms != 0U) {
+                    if ((now_ms - spec_.since_ms) <= 3000U) {
+                        spec_ = {};
                         dirty_ = true;
                     }
                 }
@@ -427,13 +2759,54 @@ void ui::UiController::handleProtoEvents_(uint32_t now_ms) noexcept
                 }
                 break;
             }
+            case espnow::MsgType::ConfigAck: {
+                // Units with config sync echo their new generation in the
+                // ack, re-arming the ConfigDelta diff path.
+                uint16_t gen = 0;
+                if (fatigue_proto::ParseConfigGeneration(evt.payload, evt.payload_len, gen)) {
+                    wire_capture::Note(wire_capture::Kind::ConfGen, evt.payload, evt.payload_len);
+                    remote_config_gen_ = gen;
+                    have_remote_config_gen_ = true;
+                    logf_(now_ms, "RX: ConfigAck gen=%u", static_cast<unsigned>(gen));
+                } else {
+                    logf_(now_ms, "RX: ConfigAck");
+                }
+                // V2 acks also echo the CRC of the unit's active config.
+                // A match against the CRC captured at send time verifies
+                // the push in this one packet; a mismatch means the unit
+                // is running something else, so drop the optimistic
+                // baseline and re-fetch the real state.
+                uint32_t unit_crc = 0;
+                if (cfg_sent_crc_valid_ &&
+                    fatigue_proto::ParseConfigAckCrc(evt.payload, evt.payload_len, unit_crc)) {
+                    wire_capture::Note(wire_capture::Kind::AckCrc, evt.payload, evt.payload_len);
+                    cfg_sent_crc_valid_ = false;
+                    if (unit_crc == cfg_sent_crc_) {
+                        logf_(now_ms, "UI: config verified (crc match)");
+                    } else {
+                        logf_(now_ms, "UI: config CRC mismatch, re-fetching");
+                        have_remote_config_ = false;
+                        have_remote_config_gen_ = false;
+                        (void)sendConfigRequestActive_();
+                    }
+                }
+                // The coalesced quick-settings update is now on the unit;
+                // clear the per-field in-flight badges.
+                if (quick_inflight_mask_ != 0) {
+                    quick_inflight_mask_ = 0;
+                    dirty_ = true;
+                }
+                break;
+            }
             case espnow::MsgType::Error: {
                 // Error payload is (err_code, at_cycle). Only err_code is relevant for bounds UI.
                 uint8_t err_code = 0;
                 if (evt.payload_len >= 1) {
                     err_code = evt.payload[0];
                 }
-                logf_(now_ms, "RX: Error code=%u", static_cast<unsigned>(err_code));
+                logf_(now_ms, "RX: Error code=%u (%s)", static_cast<unsigned>(err_code),
+                      fatigue_proto::LookupError(err_code).name);
+                noteErrorCode_(err_code, now_ms);
                 if (page_ == Page::Bounds) {
                     bounds_state_ = BoundsState::Error;
                     bounds_state_since_ms_ = now_ms;
@@ -442,9 +2815,62 @@ void ui::UiController::handleProtoEvents_(uint32_t now_ms) noexcept
                 }
                 break;
             }
+            case espnow::MsgType::BoundsProgress: {
+                fatigue_proto::BoundsProgressPayload bp{};
+                if (fatigue_proto::ParseBoundsProgress(evt.payload, evt.payload_len, bp)) {
+                    wire_capture::Note(wire_capture::Kind::BoundsProg, evt.payload, evt.payload_len);
+                    bounds_have_progress_ = true;
+                    bounds_progress_phase_ = bp.phase;
+                    bounds_progress_deg_ = bp.current_degrees;
+                    bounds_progress_min_deg_ = bp.min_so_far_degrees;
+                    bounds_progress_max_deg_ = bp.max_so_far_degrees;
+                    bounds_progress_ms_ = now_ms;
+                    // The unit started a search we did not command (or our
+                    // ACK was lost): reflect it rather than showing READY.
+                    if (page_ == Page::Bounds &&
+                        (bounds_state_ == BoundsState::Idle || bounds_state_ == BoundsState::StartWaitAck)) {
+                        bounds_state_ = BoundsState::Running;
+                        bounds_state_since_ms_ = now_ms;
+                    }
+                    // Live progress drops the page out of the 33 ms
+                    // animation window (renderPeriodMs_): the packets
+                    // drive the frames. Mark the rim-gauge deltas plus the
+                    // bands that follow the live angle; a reading past the
+                    // drawn scale moves everything and falls back to a
+                    // full frame, as does the first packet of a stream.
+                    if (page_ == Page::Bounds && bounds_state_ == BoundsState::Running) {
+                        const float reach = std::max(std::fabs(bp.current_degrees),
+                                                     std::max(std::fabs(bp.min_so_far_degrees),
+                                                              std::fabs(bp.max_so_far_degrees)));
+                        if (bounds_gauge_drawn_deg_ > 1e8f || reach > bounds_gauge_scale_) {
+                            dirty_ = true;
+                        } else {
+                            const float a = boundsGaugeAngle_(bp.current_degrees, bounds_gauge_scale_);
+                            markArcSegment_(std::min(a, bounds_gauge_drawn_deg_) - 2.0f,
+                                            std::max(a, bounds_gauge_drawn_deg_) + 2.0f);
+                            const float a_min = boundsGaugeAngle_(bp.min_so_far_degrees, bounds_gauge_scale_);
+                            const float a_max = boundsGaugeAngle_(bp.max_so_far_degrees, bounds_gauge_scale_);
+                            if (a_min < bounds_gauge_drawn_min_) {
+                                markArcSegment_(a_min - 1.0f, bounds_gauge_drawn_min_ + 1.0f);
+                            }
+                            if (a_max > bounds_gauge_drawn_max_) {
+                                markArcSegment_(bounds_gauge_drawn_max_ - 1.0f, a_max + 1.0f);
+                            }
+                            // Armature wedge, linear track band, readout.
+                            markDirty_(th::CENTER_X - 68, th::CENTER_Y - 76, 136, 88);
+                            markDirty_(th::CENTER_X - 78, th::CENTER_Y + 2, 156, 28);
+                            markDirty_(0, 150, 240, 16);
+                        }
+                    }
+                } else {
+                    espnow::NoteBadPayload();
+                }
+                break;
+            }
             case espnow::MsgType::BoundsResult: {
                 fatigue_proto::BoundsResultPayload br{};
                 if (fatigue_proto::ParseBoundsResult(evt.payload, evt.payload_len, br)) {
+                    wire_capture::Note(wire_capture::Kind::Bounds, evt.payload, evt.payload_len);
                     bounds_have_result_ = (br.ok != 0);
                     bounds_bounded_ = (br.bounded != 0);
                     bounds_cancelled_ = (br.cancelled != 0);
@@ -452,6 +2878,21 @@ void ui::UiController::handleProtoEvents_(uint32_t now_ms) noexcept
                     bounds_max_deg_ = br.max_degrees_from_center;
                     bounds_global_min_deg_ = br.global_min_degrees;
                     bounds_global_max_deg_ = br.global_max_degrees;
+                    bounds_result_cached_ = false;
+
+                    // Cache the result per unit so the next session can show
+                    // these limits before any search runs. Cancelled runs
+                    // carry no complete answer and are not worth remembering.
+                    uint8_t mac[6];
+                    if (br.ok != 0 && br.cancelled == 0 && activeUnitMac_(mac)) {
+                        PeerBounds pb{};
+                        pb.min_deg = bounds_min_deg_;
+                        pb.max_deg = bounds_max_deg_;
+                        pb.global_min_deg = bounds_global_min_deg_;
+                        pb.global_max_deg = bounds_global_max_deg_;
+                        pb.bounded = br.bounded;
+                        SettingsStore::NoteBoundsForPeer(mac, pb);
+                    }
 
                     logf_(now_ms, "RX: BoundsResult ok=%u bounded=%u min=%.2f max=%.2f", static_cast<unsigned>(br.ok), static_cast<unsigned>(br.bounded),
                           static_cast<double>(bounds_min_deg_), static_cast<double>(bounds_max_deg_));
@@ -461,6 +2902,8 @@ void ui::UiController::handleProtoEvents_(uint32_t now_ms) noexcept
                         bounds_state_since_ms_ = now_ms;
                         dirty_ = true;
                     }
+                } else {
+                    espnow::NoteBadPayload();
                 }
                 break;
             }
@@ -469,539 +2912,1777 @@ void ui::UiController::handleProtoEvents_(uint32_t now_ms) noexcept
                 logf_(now_ms, "RX: Msg type=%u len=%u", static_cast<unsigned>(evt.type), static_cast<unsigned>(evt.payload_len));
                 break;
         }
+
+        // All payload fields were parsed into locals above; hand the pooled
+        // receive buffer back to the protocol layer.
+        espnow::ReleaseEvent(evt);
+    }
+
+    // Check for connection timeout
+    if (conn_status_ == ConnStatus::Connected && (now_ms - last_rx_ms_) > kConnTimeout_ms) {
+        conn_status_ = ConnStatus::Connecting;
+        // Clear stale status data - don't show old "Idle" or "Running" when disconnected
+        have_status_ = false;
+        have_remote_config_ = false;
+        last_status_ = {};
+        last_remote_config_ = {};
+        cycle_history_.clear();
+        cycle_est_.clear();
+        live_stall_alert_ = false;
+        boundsResetResult_();
+        bounds_state_ = BoundsState::Idle;
+        bounds_state_since_ms_ = now_ms;
+        // Delta decoding can't resume across a gap; require a fresh keyframe.
+        status_decoder_.Reset();
+        if (active_unit_ >= 0 && static_cast<size_t>(active_unit_) < unit_count_) {
+            units_[active_unit_].decoder.Reset();
+        }
+        logf_(now_ms, "Connection timeout - cleared stale status data and reset bounds state");
+        dirty_ = true;
+    }
+
+    // Background units age out silently; their slot just stops reporting.
+    for (size_t i = 0; i < unit_count_; ++i) {
+        if (static_cast<int>(i) == static_cast<int>(active_unit_)) {
+            continue;
+        }
+        UnitState& u = units_[i];
+        if (u.conn == ConnStatus::Connected && (now_ms - u.last_rx_ms) > kConnTimeout_ms) {
+            u.conn = ConnStatus::Disconnected;
+            u.have_status = false;
+            u.decoder.Reset();
+        }
+    }
+}
+
+void ui::UiController::refreshUnitTable_(uint32_t now_ms) noexcept
+{
+    uint8_t macs[kMaxUnits_][6];
+    const size_t n = espnow::GetFatigueTesterMacs(macs, kMaxUnits_);
+
+    // Remember the active unit's MAC so pairing/unpairing in the middle of a
+    // session can't silently retarget commands at a different machine.
+    uint8_t active_mac[6] = {};
+    const bool had_active = activeUnitMac_(active_mac);
+
+    UnitState rebuilt[kMaxUnits_]{};
+    for (size_t i = 0; i < n; ++i) {
+        const int prev = unitIndexForMac_(macs[i]);
+        if (prev >= 0) {
+            rebuilt[i] = units_[prev];
+        } else {
+            std::memcpy(rebuilt[i].mac, macs[i], 6);
+            rebuilt[i].in_use = true;
+        }
+    }
+    for (size_t i = 0; i < kMaxUnits_; ++i) {
+        units_[i] = rebuilt[i];
+    }
+    unit_count_ = n;
+
+    active_unit_ = 0;
+    if (had_active) {
+        for (size_t i = 0; i < n; ++i) {
+            if (std::memcmp(units_[i].mac, active_mac, 6) == 0) {
+                active_unit_ = static_cast<int>(i);
+                break;
+            }
+        }
+    }
+    (void)now_ms;
+}
+
+/**
+ * @brief Complete a pending warm-reset session restore
+ * @details Runs on the housekeeping cadence after refreshUnitTable_. Waits
+ *          for the checkpointed unit to reappear in the peer table (the
+ *          radio comes up asynchronously), then switches to it, jumps to
+ *          LiveCounter and reconciles with one ConfigRequest — the
+ *          checkpointed status may be seconds stale, so nothing is trusted
+ *          beyond which unit and which view the operator was on. Any
+ *          operator input cancels the restore (they already picked a view),
+ *          as does the deadline — a unit that stays gone for
+ *          kRestoreWindow_ms probably died with the remote.
+ */
+void ui::UiController::attemptSessionRestore_(uint32_t now_ms) noexcept
+{
+    if (!restore_pending_) {
+        return;
+    }
+    if (last_input_ms_ != 0 ||
+        static_cast<int32_t>(now_ms - restore_deadline_ms_) > 0) {
+        restore_pending_ = false;
+        return;
+    }
+    const int idx = unitIndexForMac_(restore_mac_);
+    if (idx < 0) {
+        return;  // Peer table not repopulated yet; retry next pass
+    }
+
+    restore_pending_ = false;
+    if (idx != active_unit_) {
+        selectUnit_(idx, now_ms);  // Also sends the reconcile ConfigRequest
+    } else {
+        pending_machine_resync_ = true;
+        (void)sendConfigRequestActive_();
+    }
+    page_ = Page::LiveCounter;
+    logf_(now_ms, "Restored: live view on unit %02X%02X after reset",
+          restore_mac_[4], restore_mac_[5]);
+    if (restore_cmd_ != 0) {
+        logf_(now_ms, "Restored: %s was pending delivery",
+              (restore_cmd_ == static_cast<uint8_t>(fatigue_proto::CommandId::Pause))
+                  ? "PAUSE" : "STOP");
+    }
+    dirty_ = true;
+}
+
+int ui::UiController::unitIndexForMac_(const uint8_t mac[6]) const noexcept
+{
+    for (size_t i = 0; i < unit_count_; ++i) {
+        if (units_[i].in_use && std::memcmp(units_[i].mac, mac, 6) == 0) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+int ui::UiController::unitIndexForEvent_(const espnow::ProtoEvent& evt) noexcept
+{
+    // Fast path for the event pump: match the sender's interned index
+    // (one byte) against the per-unit cache. The MAC scan runs only until
+    // a unit's first event establishes the mapping.
+    if (evt.peer_index != espnow::PEER_INDEX_NONE) {
+        for (size_t i = 0; i < unit_count_; ++i) {
+            if (units_[i].in_use && units_[i].peer_index == evt.peer_index) {
+                return static_cast<int>(i);
+            }
+        }
+    }
+    const int idx = unitIndexForMac_(evt.src_mac);
+    if (idx >= 0 && evt.peer_index != espnow::PEER_INDEX_NONE) {
+        units_[idx].peer_index = evt.peer_index;
+    }
+    return idx;
+}
+
+bool ui::UiController::activeUnitMac_(uint8_t mac_out[6]) const noexcept
+{
+    if (unit_count_ == 0 || active_unit_ < 0 ||
+        static_cast<size_t>(active_unit_) >= unit_count_) {
+        return false;
+    }
+    std::memcpy(mac_out, units_[active_unit_].mac, 6);
+    return true;
+}
+
+void ui::UiController::selectNextUnit_(uint32_t now_ms) noexcept
+{
+    if (unit_count_ < 2) {
+        return;
+    }
+    selectUnit_((active_unit_ + 1) % static_cast<int>(unit_count_), now_ms);
+}
+
+void ui::UiController::selectUnit_(int index, uint32_t now_ms) noexcept
+{
+    if (index == active_unit_ || index < 0 ||
+        static_cast<size_t>(index) >= unit_count_) {
+        return;
+    }
+
+    // Park the mirrored single-unit state back into the outgoing slot.
+    UnitState& prev = units_[active_unit_];
+    prev.conn = conn_status_;
+    prev.last_rx_ms = last_rx_ms_;
+    prev.have_status = have_status_;
+    prev.status = last_status_;
+
+    active_unit_ = index;
+    const UnitState& next = units_[active_unit_];
+    conn_status_ = next.conn;
+    last_rx_ms_ = next.last_rx_ms;
+    have_status_ = next.have_status;
+    last_status_ = next.status;
+
+    // Everything derived from the old unit is stale.
+    have_remote_config_ = false;
+    last_remote_config_ = {};
+    cycle_history_.clear();
+    cycle_est_.clear();
+    live_stall_alert_ = false;
+    boundsResetResult_();
+    bounds_state_ = BoundsState::Idle;
+    bounds_state_since_ms_ = now_ms;
+    if (page_ == Page::Bounds) {
+        boundsOfferCached_(now_ms);  // the new unit may have its own cached limits
+    }
+    pending_machine_resync_ = true;
+
+    (void)sendConfigRequestActive_();
+    // Identity cache: the label (name once heard, MAC until then) is built
+    // by the protocol layer when it changes, not formatted here per log.
+    const char* label = espnow::PeerLabel(espnow::LookupPeerIndex(next.mac));
+    logf_(now_ms, "Switched to unit %d of %u (%s)", active_unit_ + 1,
+          static_cast<unsigned>(unit_count_), (label[0] != '\0') ? label : "?");
+    // Offer the profile last applied to this unit (if it differs from the
+    // current parameters); surfaced on the Settings main level.
+    offerProfileForActive_(now_ms);
+    dirty_ = true;
+}
+
+bool ui::UiController::sendConfigRequestActive_() noexcept
+{
+    uint8_t mac[6];
+    if (activeUnitMac_(mac)) {
+        return espnow::SendConfigRequestTo(mac, fatigue_proto::DEVICE_ID_FATIGUE_TESTER_);
+    }
+    return espnow::SendConfigRequest(fatigue_proto::DEVICE_ID_FATIGUE_TESTER_);
+}
+
+bool ui::UiController::sendConfigSetActive_(const void* config_data, size_t config_len) noexcept
+{
+    uint8_t mac[6];
+    if (activeUnitMac_(mac)) {
+        return espnow::SendConfigSetTo(mac, fatigue_proto::DEVICE_ID_FATIGUE_TESTER_,
+                                       config_data, config_len);
+    }
+    return espnow::SendConfigSet(fatigue_proto::DEVICE_ID_FATIGUE_TESTER_, config_data, config_len);
+}
+
+bool ui::UiController::sendConfigUpdateActive_(const fatigue_proto::ConfigPayload& desired,
+                                               uint32_t now_ms) noexcept
+{
+    // Validation gate: every config push funnels through here, so a payload
+    // that violates the schema never reaches the unit no matter which
+    // editor produced it (see config_validation.hpp).
+    config_check::Violation viols[4];
+    const size_t nv = config_check::Validate(desired, viols, 4);
+    if (nv > 0) {
+        for (size_t i = 0; i < nv && i < 4; ++i) {
+            logf_(now_ms, "CFG: %s %s - send blocked", viols[i].name, viols[i].rule);
+        }
+        playBeep_(2);
+        return false;
+    }
+
+    // Config sync: when the unit's current config and its generation are
+    // both known, diff against them so a single-field tweak travels as a
+    // few-byte ConfigDelta instead of the full payload. Without a baseline
+    // (older unit firmware, or nothing received yet) fall back to a full
+    // ConfigSet. Either way the unit answers with ConfigAck carrying its
+    // new generation.
+    bool sent = false;
+    if (have_remote_config_ && have_remote_config_gen_) {
+        uint8_t delta[fatigue_proto::CONFIG_DELTA_HEADER_SIZE_ + sizeof(fatigue_proto::ConfigPayload)];
+        const size_t n = fatigue_proto::BuildConfigDelta(last_remote_config_, desired,
+                                                         remote_config_gen_, delta, sizeof(delta));
+        if (n == fatigue_proto::CONFIG_DELTA_HEADER_SIZE_) {
+            // Nothing differs from what the unit already runs.
+            return true;
+        }
+        if (n > 0 && n < sizeof(desired)) {
+            uint8_t mac[6];
+            sent = activeUnitMac_(mac)
+                       ? espnow::SendConfigDeltaTo(mac, fatigue_proto::DEVICE_ID_FATIGUE_TESTER_,
+                                                   delta, n)
+                       : espnow::SendConfigDelta(fatigue_proto::DEVICE_ID_FATIGUE_TESTER_,
+                                                 delta, n);
+            if (sent) {
+                logf_(now_ms, "TX: ConfigDelta %uB gen=%u", static_cast<unsigned>(n),
+                      static_cast<unsigned>(remote_config_gen_));
+            }
+        }
+    }
+    if (!sent) {
+        sent = sendConfigSetActive_(&desired, sizeof(desired));
+        if (sent) {
+            logf_(now_ms, "TX: ConfigSet dev=%u", fatigue_proto::DEVICE_ID_FATIGUE_TESTER_);
+        }
+    }
+    if (sent) {
+        // Optimistic baseline: consecutive edits diff against the state
+        // just pushed. The generation is stale until ConfigAck lands, so
+        // drop it; a second edit racing the ack goes as a full ConfigSet
+        // rather than a delta the unit would reject as mis-based.
+        last_remote_config_ = desired;
+        have_remote_config_ = true;
+        have_remote_config_gen_ = false;
+        // Remember what was pushed so a v2 ConfigAck's echoed CRC can
+        // verify the write without a ConfigResponse round trip.
+        cfg_sent_crc_ = fatigue_proto::ConfigCrc32(desired);
+        cfg_sent_crc_valid_ = true;
+    }
+    return sent;
+}
+
+bool ui::UiController::sendCommandActive_(uint8_t command_id, const void* payload,
+                                          size_t payload_len) noexcept
+{
+    // Stop and Pause go through the protocol layer's command journal: if
+    // the link is down when the operator presses them, they replay on
+    // reconnect until acked instead of silently evaporating.
+    const bool critical = payload_len == 0 &&
+        (command_id == static_cast<uint8_t>(fatigue_proto::CommandId::Stop) ||
+         command_id == static_cast<uint8_t>(fatigue_proto::CommandId::Pause));
+
+    uint8_t mac[6];
+    if (activeUnitMac_(mac)) {
+        if (critical) {
+            return espnow::SendCriticalCommandTo(mac, fatigue_proto::DEVICE_ID_FATIGUE_TESTER_,
+                                                 command_id);
+        }
+        return espnow::SendCommandTo(mac, fatigue_proto::DEVICE_ID_FATIGUE_TESTER_,
+                                     command_id, payload, payload_len);
+    }
+    return espnow::SendCommand(fatigue_proto::DEVICE_ID_FATIGUE_TESTER_, command_id,
+                               payload, payload_len);
+}
+
+uint16_t ui::UiController::desiredStatusIntervalMs_(uint32_t now_ms) const noexcept
+{
+    // Burst overrides everything: dense samples around a moment that needs
+    // them (bounds verification, test start).
+    if (status_burst_until_ms_ != 0 &&
+        static_cast<int32_t>(status_burst_until_ms_ - now_ms) > 0) {
+        return 20;  // 50 Hz
+    }
+    switch (page_) {
+        case Page::LiveCounter:
+        case Page::Bounds:
+            return 100;   // Attended telemetry: the operator is watching
+        default:
+            return 1000;  // Trickle: liveness and background state only
+    }
+}
+
+void ui::UiController::serviceStatusRate_(uint32_t now_ms) noexcept
+{
+    // Matching telemetry cost to attention: the unit streams only as fast
+    // as the current page can usefully display. Sends ride the reliable
+    // command path, so a change is pushed once and retransmitted until
+    // acked; there is nothing to do while the desired rate stands.
+    if (conn_status_ != ConnStatus::Connected) {
+        status_rate_sent_ms_ = 0;
+        return;
+    }
+    const uint16_t want = desiredStatusIntervalMs_(now_ms);
+    if (want == status_rate_sent_ms_) {
+        return;
+    }
+    fatigue_proto::StatusRatePayload p{};
+    p.sample_interval_ms = want;
+    // For a burst, let the unit decay by itself too - if we vanish
+    // mid-burst it must not keep streaming at 50 Hz forever.
+    p.hold_ms = (status_burst_until_ms_ != 0 &&
+                 static_cast<int32_t>(status_burst_until_ms_ - now_ms) > 0)
+                    ? static_cast<uint16_t>(status_burst_until_ms_ - now_ms)
+                    : 0;
+    if (sendCommandActive_(static_cast<uint8_t>(fatigue_proto::CommandId::SetStatusRate),
+                           &p, sizeof(p))) {
+        status_rate_sent_ms_ = want;
+        logf_(now_ms, "TX: StatusRate %ums%s", static_cast<unsigned>(want),
+              p.hold_ms != 0 ? " (burst)" : "");
+    }
+}
+
+void ui::UiController::requestStatusBurst_(uint32_t now_ms, uint32_t duration_ms) noexcept
+{
+    status_burst_until_ms_ = now_ms + duration_ms;
+    if (status_burst_until_ms_ == 0) {
+        status_burst_until_ms_ = 1;  // 0 means "no burst"
+    }
+    serviceStatusRate_(now_ms);
+}
+
+void ui::UiController::boundsResetResult_() noexcept
+{
+    bounds_have_result_ = false;
+    bounds_bounded_ = false;
+    bounds_cancelled_ = false;
+    bounds_min_deg_ = 0.0f;
+    bounds_max_deg_ = 0.0f;
+    bounds_global_min_deg_ = 0.0f;
+    bounds_global_max_deg_ = 0.0f;
+    bounds_last_error_code_ = 0;
+    bounds_result_cached_ = false;
+    bounds_have_progress_ = false;
+    bounds_progress_phase_ = 0;
+    bounds_progress_deg_ = 0.0f;
+    bounds_progress_min_deg_ = 0.0f;
+    bounds_progress_max_deg_ = 0.0f;
+    bounds_gauge_drawn_deg_ = 1e9f;
+    bounds_gauge_drawn_min_ = 1e9f;
+    bounds_gauge_drawn_max_ = 1e9f;
+}
+
+void ui::UiController::boundsOfferCached_(uint32_t now_ms) noexcept
+{
+    // Entering the page with nothing to show: surface the last result
+    // persisted for this unit so the operator sees the previous limits
+    // immediately. Purely a display offer - the unit's own bounds state is
+    // untouched, and a fresh Start or an invalidation replaces it.
+    if (bounds_state_ != BoundsState::Idle || bounds_have_result_) {
+        return;
+    }
+    uint8_t mac[6];
+    PeerBounds pb{};
+    if (!activeUnitMac_(mac) || !SettingsStore::BoundsForPeer(mac, pb)) {
+        return;
+    }
+    bounds_have_result_ = true;
+    bounds_bounded_ = (pb.bounded != 0);
+    bounds_cancelled_ = false;
+    bounds_min_deg_ = pb.min_deg;
+    bounds_max_deg_ = pb.max_deg;
+    bounds_global_min_deg_ = pb.global_min_deg;
+    bounds_global_max_deg_ = pb.global_max_deg;
+    bounds_result_cached_ = true;
+    logf_(now_ms, "UI: showing cached bounds min=%.2f max=%.2f",
+          static_cast<double>(bounds_min_deg_), static_cast<double>(bounds_max_deg_));
+}
+
+void ui::UiController::boundsStart_(uint32_t now_ms) noexcept
+{
+    boundsResetResult_();
+
+    (void)sendCommandActive_(static_cast<uint8_t>(fatigue_proto::CommandId::RunBoundsFinding), nullptr, 0);
+    logf_(now_ms, "TX: Command RunBoundsFinding (awaiting ACK)");
+
+    // Bounds verification wants dense samples while the search sweeps.
+    requestStatusBurst_(now_ms, 8000);
+
+    bounds_state_ = BoundsState::StartWaitAck;
+    bounds_state_since_ms_ = now_ms;
+    bounds_ack_deadline_ms_ = now_ms + 1500;
+    dirty_ = true;
+}
+
+void ui::UiController::boundsStop_(uint32_t now_ms) noexcept
+{
+    (void)sendCommandActive_(static_cast<uint8_t>(fatigue_proto::CommandId::Stop), nullptr, 0);
+    logf_(now_ms, "TX: Command Stop (cancel bounds; awaiting ACK)");
+
+    bounds_state_ = BoundsState::StopWaitAck;
+    bounds_state_since_ms_ = now_ms;
+    bounds_ack_deadline_ms_ = now_ms + 1500;
+    dirty_ = true;
+}
+
+void ui::UiController::updateBoundsState_(uint32_t now_ms) noexcept
+{
+    if (page_ != Page::Bounds) {
+        return;
+    }
+
+    // ACK timeouts
+    if ((bounds_state_ == BoundsState::StartWaitAck || bounds_state_ == BoundsState::StopWaitAck) && now_ms >= bounds_ack_deadline_ms_) {
+        bounds_state_ = BoundsState::Error;
+        bounds_state_since_ms_ = now_ms;
+        // 0 => "no-ack" (UI-local meaning)
+        bounds_last_error_code_ = 0;
+        logf_(now_ms, "Bounds: ACK timeout");
+        dirty_ = true;
+    }
+}
+
+void ui::UiController::handleInputs_(uint32_t now_ms) noexcept
+{
+    // Latency classes: discrete events (detents, clicks) are what the
+    // operator feels as dial response, so the encoder queue drains first -
+    // and again after the touch pass, since a detent arriving while the
+    // gesture engine and a page's drag handler run would otherwise wait a
+    // full frame. Continuous input (drag deltas) is coalesced by design:
+    // the touch pass reads the one sample M5.update latched, so a burst
+    // of raw moves collapses to a single net delta per tick.
+
+    // Track input activity for the event-wait timeout computation. Any
+    // input also acknowledges a standing alert.
+    if (M5.Touch.getCount() > 0 || M5.BtnA.isPressed()) {
+        last_input_ms_ = now_ms;
+        clearAlert_();
+    }
+
+    // Feed the M5Unified button into the encoder's gesture classifier; the
+    // driver task owns all press timing (click, long press, chord), so the
+    // tick no longer keeps per-page press bookkeeping.
+    encoder_.feedButtonState(M5.BtnA.isPressed());
+
+    drainEncoderEvents_(now_ms);
+
+    // Staged quick edits auto-send once the operator stops adjusting. Also
+    // runs after the popup closes, covering a flush that failed on exit.
+    if (quick_pending_mask_ != 0 && !quick_settings_editing_ &&
+        (now_ms - quick_pending_since_ms_) >= kQuickFlushQuiesceMs_) {
+        flushQuickSettings_(now_ms);
+    }
+
+    handleTouchInputs_(now_ms);
+
+    // Second discrete drain: anything queued during touch classification
+    // and the drag handler is dispatched this tick instead of waiting out
+    // the frame.
+    drainEncoderEvents_(now_ms);
+
+    serviceTouchInertia_(now_ms);
+}
+
+void ui::UiController::drainEncoderEvents_(uint32_t now_ms) noexcept
+{
+    // Encoder rotation and gesture events.
+    if (auto* q = encoder_.getEventQueue(); q != nullptr) {
+        EC11Encoder::Event evt{};
+        while (xQueueReceive(q, &evt, 0) == pdTRUE) {
+            last_input_ms_ = now_ms;
+            clearAlert_();
+            const bool chord = (evt.type == EC11Encoder::EventType::GESTURE &&
+                                evt.gesture == EC11Encoder::Gesture::PRESS_ROTATE);
+            if (evt.type == EC11Encoder::EventType::ROTATION || chord) {
+                int delta = 0;
+                if (evt.direction == EC11Encoder::Direction::CW) {
+                    delta = 1;
+                } else if (evt.direction == EC11Encoder::Direction::CCW) {
+                    delta = -1;
+                }
+                if (delta != 0) {
+                    latencyNoteInput_();
+                    // Press-and-rotate is the coarse gear in the value
+                    // editors; elsewhere it behaves like plain rotation.
+                    chord_rotate_ = chord;
+                    traceInputCorr_();
+                    input_trace::Note(input_trace::Kind::Rotate,
+                                      static_cast<int16_t>(delta), chord ? 1 : 0,
+                                      now_ms);
+                    onRotate_(delta, now_ms);
+                    chord_rotate_ = false;
+                }
+            } else if (evt.type == EC11Encoder::EventType::GESTURE) {
+                switch (evt.gesture) {
+                    case EC11Encoder::Gesture::SINGLE_CLICK:
+                    // The double-click window is disabled in this firmware
+                    // (see Init()); treat one defensively as a click.
+                    case EC11Encoder::Gesture::DOUBLE_CLICK:
+                        traceInputCorr_();
+                        input_trace::Note(input_trace::Kind::Click, 0, 0, now_ms);
+                        onClick_(now_ms);
+                        break;
+                    case EC11Encoder::Gesture::LONG_PRESS:
+                        traceInputCorr_();
+                        input_trace::Note(input_trace::Kind::LongPress, 0, 0, now_ms);
+                        onLongPress_(now_ms);
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+        encoder_pos_ = encoder_.getPosition();
+    }
+}
+
+void ui::UiController::handleTouchInputs_(uint32_t now_ms) noexcept
+{
+    // Touch input. M5.update() latches the newest sample, so reading the
+    // position once per input pass coalesces every raw move that arrived
+    // in between into a single net delta. The gesture engine filters a
+    // velocity from those deltas and classifies the session centrally;
+    // pages only see the distilled result (tap, long press, swipe, drag),
+    // and releases above the flick threshold keep scrolling with momentum
+    // through serviceTouchInertia_().
+    if (M5.Touch.getCount() > 0) {
+        const auto& t = M5.Touch.getDetail(0);
+
+        if (t.wasPressed()) {
+            touch_start_x_ = t.x;
+            touch_start_y_ = t.y;
+            touch_start_ms_ = now_ms;
+            last_touch_x_ = t.x;
+            last_touch_y_ = t.y;
+            last_touch_move_ms_ = now_ms;
+            swipe_detected_ = false;
+            touch_moved_ = false;
+            long_press_fired_ = false;
+            touch_velocity_px_s_ = 0.0f;
+            // A new touch catches any flick that is still coasting.
+            inertia_px_s_ = 0.0f;
+            inertia_carry_px_ = 0.0f;
+        }
+
+        // Coalesced move handling: one net delta per pass, regardless of
+        // how many raw samples the controller produced since the last one.
+        const int16_t dy = static_cast<int16_t>(t.y - last_touch_y_);
+        if (dy != 0 || t.x != last_touch_x_) {
+            const uint32_t dt_ms = now_ms - last_touch_move_ms_;
+            if (dt_ms > 0) {
+                const float inst_px_s =
+                    static_cast<float>(dy) * 1000.0f / static_cast<float>(dt_ms);
+                touch_velocity_px_s_ += (inst_px_s - touch_velocity_px_s_) * kVelocityAlpha;
+            }
+            last_touch_move_ms_ = now_ms;
+            last_touch_x_ = t.x;
+            last_touch_y_ = t.y;
+
+            const int16_t total_dx = static_cast<int16_t>(t.x - touch_start_x_);
+            const int16_t total_dy = static_cast<int16_t>(t.y - touch_start_y_);
+            if (!touch_moved_) {
+                const int32_t dist2 = static_cast<int32_t>(total_dx) * total_dx +
+                                      static_cast<int32_t>(total_dy) * total_dy;
+                if (dist2 > static_cast<int32_t>(kTapSlop_px) * kTapSlop_px) {
+                    touch_moved_ = true;
+                    touch_dragging_ = true;
+                }
+            }
+            // Swipe gesture: significant total movement in either axis.
+            if (!swipe_detected_ && (std::abs(total_dx) > 50 || std::abs(total_dy) > 50)) {
+                swipe_detected_ = true;
+            }
+            if (touch_dragging_ && dy != 0) {
+                traceInputCorr_();
+                input_trace::Note(input_trace::Kind::TouchDrag, dy, 0, now_ms);
+                onTouchDrag_(dy, now_ms);
+            }
+        } else if (now_ms - last_touch_move_ms_ > 80U) {
+            // Finger resting: bleed the filtered velocity off so a pause
+            // before release does not launch a stale flick.
+            touch_velocity_px_s_ = 0.0f;
+        }
+
+        if (t.wasDragStart() || t.isDragging()) {
+            touch_dragging_ = true;
+        }
+
+        // Central long-press classification: a steady hold inside the tap
+        // slop radius, dispatched once while still pressed.
+        if (!touch_moved_ && !long_press_fired_ &&
+            (now_ms - touch_start_ms_) >= kLongPress_ms) {
+            long_press_fired_ = true;
+            traceInputCorr_();
+            input_trace::Note(input_trace::Kind::TouchLongPress, t.x, t.y, now_ms);
+            onTouchLongPress_(t.x, t.y, now_ms);
+        }
+
+        if (t.wasReleased()) {
+            const int16_t total_dx = static_cast<int16_t>(t.x - touch_start_x_);
+            const int16_t total_dy = static_cast<int16_t>(t.y - touch_start_y_);
+            const uint32_t held_ms = now_ms - touch_start_ms_;
+
+            if (swipe_detected_) {
+                traceInputCorr_();
+                input_trace::Note(input_trace::Kind::Swipe, total_dx, total_dy, now_ms);
+                onSwipe_(total_dx, total_dy, now_ms);
+            } else if (long_press_fired_) {
+                // Already dispatched while the finger was down.
+            } else if (!touch_moved_ && held_ms <= kTapMax_ms) {
+                // Robust click detection: press+release with minimal movement.
+                // More reliable than relying solely on M5Unified's wasClicked(),
+                // which can be missed if the touch jitters slightly.
+                traceInputCorr_();
+                input_trace::Note(input_trace::Kind::TouchClick, t.x, t.y, now_ms);
+                onTouchClick_(t.x, t.y, now_ms);
+            } else if (touch_dragging_ &&
+                       std::fabs(touch_velocity_px_s_) >= kFlickMin_px_s) {
+                // Flick: carry the filtered release velocity into inertia.
+                inertia_px_s_ = std::max(-kFlickMax_px_s,
+                                         std::min(kFlickMax_px_s, touch_velocity_px_s_));
+                inertia_carry_px_ = 0.0f;
+                last_inertia_ms_ = now_ms;
+            }
+
+            // Only clear dragging state on release; clearing on every
+            // `wasDragged()` makes gesture handling sporadic.
+            touch_dragging_ = false;
+        }
+    } else {
+        touch_dragging_ = false;
+    }
+}
+
+void ui::UiController::serviceInputReplay_(uint32_t now_ms) noexcept
+{
+    // Re-inject a recorded input stream through the same dispatchers the
+    // live input pass uses, at the compressed schedule the replay cursor
+    // computes. Recording is suppressed for the duration, so a replay is
+    // repeatable back-to-back from one recording.
+    input_trace::Event evt{};
+    while (input_trace::ReplayNext(now_ms, evt)) {
+        last_input_ms_ = now_ms;
+        switch (static_cast<input_trace::Kind>(evt.kind)) {
+            case input_trace::Kind::Rotate:
+                chord_rotate_ = (evt.b != 0);
+                onRotate_(static_cast<int>(evt.a), now_ms);
+                chord_rotate_ = false;
+                break;
+            case input_trace::Kind::Click:
+                onClick_(now_ms);
+                break;
+            case input_trace::Kind::LongPress:
+                onLongPress_(now_ms);
+                break;
+            case input_trace::Kind::TouchClick:
+                onTouchClick_(evt.a, evt.b, now_ms);
+                break;
+            case input_trace::Kind::TouchDrag:
+                onTouchDrag_(evt.a, now_ms);
+                break;
+            case input_trace::Kind::TouchLongPress:
+                onTouchLongPress_(evt.a, evt.b, now_ms);
+                break;
+            case input_trace::Kind::Swipe:
+                onSwipe_(evt.a, evt.b, now_ms);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+const char* ui::UiController::abSubjectName_(AbSubject s) noexcept
+{
+    switch (s) {
+        case AbSubject::Partial: return "partial";
+        case AbSubject::DiffPush: return "diffpush";
+        case AbSubject::LowColor: return "lowcolor";
+        default: return "?";
+    }
+}
+
+/**
+ * @brief Start an A/B run against the current subject (Diagnostics tap)
+ * @details A tap while a run is in progress aborts it instead.
+ */
+void ui::UiController::abStart_(uint32_t now_ms) noexcept
+{
+    if (ab_phase_ != 0) {
+        ab_phase_ = 0;
+        ab_disabled_mask_ = 0;
+        ab_have_results_ = false;
+        playBeep_(4);
+        logf_(now_ms, "AB: run aborted");
+        dirty_ = true;
+        return;
+    }
+    ab_pass_[0] = AbPassStats{};
+    ab_pass_[1] = AbPassStats{};
+    ab_have_results_ = false;
+    ab_result_subject_ = ab_subject_;
+    ab_disabled_mask_ = 0;
+    ab_phase_ = 1;
+    playBeep_(2);
+    logf_(now_ms, "AB: %s run started", abSubjectName_(ab_subject_));
+    abBeginPass_(now_ms);
+}
+
+/**
+ * @brief Load the workload script and start replaying it for one pass
+ * @details The script is pure navigation and scrolling - a menu lap, a
+ *          tour of the pages whose click goes straight back to the
+ *          landing page (Terminal, Diagnostics, History, Timeline, with
+ *          rotations scrolling/scrubbing inside each), and a terminal
+ *          flick-scroll burst - so nothing in it touches a control that
+ *          would command the machine. Identical timestamps every pass
+ *          make the two distributions comparable. Popup workloads are
+ *          deliberately absent: every popup on this remote acts on the
+ *          unit when dismissed the wrong way.
+ */
+void ui::UiController::abBeginPass_(uint32_t now_ms) noexcept
+{
+    // Deterministic starting state: landing page, first menu slot.
+    page_ = Page::Landing;
+    mru_active_ = false;
+    menu_selector_.setSelectedIndex(0, now_ms, false);
+    dirty_ = true;
+    ab_flush_base_cycles_ = perf_helpers_[static_cast<size_t>(PerfHelper::Flush)].cycles;
+
+    input_trace::LoadBegin();
+    uint32_t t = 0;
+    auto push = [&t](input_trace::Kind k, int16_t a, int16_t b, uint32_t gap_ms) {
+        input_trace::Event ev{};
+        t += gap_ms;
+        ev.t_ms = t;
+        ev.kind = static_cast<uint8_t>(k);
+        ev.a = a;
+        ev.b = b;
+        (void)input_trace::LoadAppend(&ev, 1);
+    };
+
+    // Menu spin: one full lap each way (carousel animation load).
+    for (int i = 0; i < MENU_COUNT_; ++i) {
+        push(input_trace::Kind::Rotate, 1, 0, 90);
+    }
+    for (int i = 0; i < MENU_COUNT_; ++i) {
+        push(input_trace::Kind::Rotate, -1, 0, 90);
+    }
+    // Page tour over menu slots 3..6 (Terminal, Diagnostics, History,
+    // Timeline): enter, six detents inside, click back out.
+    int slot = 0;
+    for (int target = 3; target <= 6; ++target) {
+        while (slot < target) {
+            push(input_trace::Kind::Rotate, 1, 0, 90);
+            ++slot;
+        }
+        push(input_trace::Kind::Click, 0, 0, 400);
+        for (int i = 0; i < 6; ++i) {
+            push(input_trace::Kind::Rotate, 1, 0, 110);
+        }
+        push(input_trace::Kind::Click, 0, 0, 400);
+    }
+    // Terminal flick scroll: drags exercise inertia and the overscroll
+    // spring, the heaviest sustained render load the UI produces.
+    while (slot > 3) {
+        push(input_trace::Kind::Rotate, -1, 0, 90);
+        --slot;
+    }
+    push(input_trace::Kind::Click, 0, 0, 400);
+    for (int i = 0; i < 5; ++i) {
+        push(input_trace::Kind::TouchDrag, -24, 0, 90);
+    }
+    for (int i = 0; i < 5; ++i) {
+        push(input_trace::Kind::TouchDrag, 24, 0, 90);
+    }
+    push(input_trace::Kind::Click, 0, 0, 500);
+
+    if (!input_trace::StartReplay(1)) {
+        ab_phase_ = 0;
+        ab_disabled_mask_ = 0;
+        logfAt_(LogLevel::Warn, now_ms, "AB: replay failed to start");
+        return;
+    }
+    ab_deadline_ms_ = now_ms + 30000U;
+}
+
+/**
+ * @brief Advance the A/B state machine once the current pass's replay ends
+ */
+void ui::UiController::serviceAbHarness_(uint32_t now_ms) noexcept
+{
+    if (input_trace::Replaying()) {
+        if (static_cast<int32_t>(now_ms - ab_deadline_ms_) > 0) {
+            ab_phase_ = 0;
+            ab_disabled_mask_ = 0;
+            logfAt_(LogLevel::Warn, now_ms, "AB: run aborted (replay stalled)");
+            dirty_ = true;
+        }
+        return;
+    }
+
+    // Close the pass: fold the flush probe's delta into the pass record.
+    AbPassStats& p = ab_pass_[ab_phase_ - 1];
+    const uint64_t flush_cycles =
+        perf_helpers_[static_cast<size_t>(PerfHelper::Flush)].cycles - ab_flush_base_cycles_;
+    p.flush_us = timebase::CyclesToUs(flush_cycles);
+
+    if (ab_phase_ == 1) {
+        ab_phase_ = 2;
+        ab_disabled_mask_ =
+            static_cast<uint8_t>(1U << static_cast<uint8_t>(ab_result_subject_));
+        abBeginPass_(now_ms);
+        return;
+    }
+
+    ab_phase_ = 0;
+    ab_disabled_mask_ = 0;
+    ab_have_results_ = true;
+    // Next tap compares the next optimization.
+    ab_subject_ = static_cast<AbSubject>(
+        (static_cast<uint8_t>(ab_result_subject_) + 1) %
+        static_cast<uint8_t>(AbSubject::Count));
+    abDump_();
+    playBeep_(3);
+    logf_(now_ms, "AB: %s done, %lu/%lu frames",
+          abSubjectName_(ab_result_subject_),
+          static_cast<unsigned long>(ab_pass_[0].frames),
+          static_cast<unsigned long>(ab_pass_[1].frames));
+    page_ = Page::Diagnostics;
+    dirty_ = true;
+}
+
+/** @brief Dump both passes' frame-time distributions to the serial log. */
+void ui::UiController::abDump_() const noexcept
+{
+    static const char* TAG = "ui_ab";
+    ESP_LOGI(TAG, "A/B %s (A = as shipped, B = %s off):",
+             abSubjectName_(ab_result_subject_), abSubjectName_(ab_result_subject_));
+    for (int i = 0; i < 2; ++i) {
+        const AbPassStats& p = ab_pass_[i];
+        const uint32_t avg_us =
+            (p.frames > 0) ? static_cast<uint32_t>(p.sum_us / p.frames) : 0;
+        const uint32_t flush_avg_us =
+            (p.frames > 0) ? static_cast<uint32_t>(p.flush_us / p.frames) : 0;
+        ESP_LOGI(TAG, "  %c: %lu frames  render avg %lu max %lu us  flush avg %lu us",
+                 'A' + i, static_cast<unsigned long>(p.frames),
+                 static_cast<unsigned long>(avg_us),
+                 static_cast<unsigned long>(p.max_us),
+                 static_cast<unsigned long>(flush_avg_us));
+        ESP_LOGI(TAG, "     hist(<1..>=64ms) %lu %lu %lu %lu %lu %lu %lu %lu",
+                 static_cast<unsigned long>(p.hist[0]), static_cast<unsigned long>(p.hist[1]),
+                 static_cast<unsigned long>(p.hist[2]), static_cast<unsigned long>(p.hist[3]),
+                 static_cast<unsigned long>(p.hist[4]), static_cast<unsigned long>(p.hist[5]),
+                 static_cast<unsigned long>(p.hist[6]), static_cast<unsigned long>(p.hist[7]));
+    }
+}
+
+void ui::UiController::nextPage_(int delta) noexcept
+{
+    (void)delta;
+    // Page cycling was replaced with a main-menu carousel on the Landing page.
+}
+
+// Input routes, indexed by Page: each dispatcher below is one table load
+// and an indirect call instead of a page compare chain, and a new page is
+// a row here plus its handlers instead of growth in four switch
+// functions. Popup and editor precedence (settings_popup_mode_,
+// live_popup_mode_, quick settings) stays inside the owning page's
+// handler, next to the state it reads. A null slot means the page
+// ignores that input.
+const ui::UiController::InputRoute ui::UiController::kRoutes_[] = {
+    // Landing
+    { &UiController::rotateLanding_, &UiController::clickLanding_,
+      &UiController::longPressLanding_, &UiController::touchLanding_, nullptr },
+    // Settings
+    { &UiController::rotateSettings_, &UiController::clickSettings_,
+      &UiController::longPressSettings_, &UiController::touchSettings_,
+      &UiController::dragSettings_ },
+    // Bounds
+    { &UiController::rotateBounds_, &UiController::clickBounds_, nullptr,
+      &UiController::touchBounds_, nullptr },
+    // LiveCounter
+    { &UiController::rotateLive_, &UiController::clickLive_,
+      &UiController::longPressLive_, &UiController::touchLive_, nullptr },
+    // Terminal
+    { &UiController::rotateTerminal_, &UiController::clickTerminal_, nullptr,
+      &UiController::touchTerminal_, &UiController::dragTerminal_ },
+    // Diagnostics
+    { &UiController::rotateDiagnostics_, &UiController::clickBackToLanding_,
+      &UiController::longPressDiagnostics_, &UiController::touchDiagnostics_, nullptr },
+    // History
+    { &UiController::rotateHistory_, &UiController::clickBackToLanding_, nullptr,
+      &UiController::touchHistory_, nullptr },
+    // Timeline
+    { &UiController::rotateTimeline_, &UiController::clickBackToLanding_, nullptr,
+      &UiController::touchTimeline_, nullptr },
+    // Fleet
+    { nullptr, &UiController::clickBackToLanding_, &UiController::longPressFleet_,
+      nullptr, nullptr },
+    // Dashboard
+    { &UiController::rotateDashboard_, &UiController::clickDashboard_, nullptr,
+      &UiController::touchDashboard_, nullptr },
+};
+void ui::UiController::onRotate_(int delta, uint32_t now_ms) noexcept
+{
+    static_assert(sizeof(kRoutes_) / sizeof(kRoutes_[0]) ==
+                      static_cast<size_t>(Page::Count),
+                  "every page needs a route row");
+    HOT_ASSERT(static_cast<size_t>(page_) < static_cast<size_t>(Page::Count));
+    const InputRoute& route = kRoutes_[static_cast<size_t>(page_)];
+    if (route.rotate != nullptr) {
+        (this->*route.rotate)(delta, now_ms);
+    }
+}
+
+void ui::UiController::rotateLanding_(int delta, uint32_t now_ms) noexcept
+{
+    // MRU overlay open: rotation moves the row highlight, not the carousel.
+    if (mru_active_) {
+        const int count = static_cast<int>(settings_mru_count_);
+        mru_index_ = (mru_index_ + (delta > 0 ? 1 : count - 1)) % count;
+        last_action_ms_ = now_ms;
+        dirty_ = true;
+        return;
+    }
+    // Use circular menu selector with smooth animation
+    if (delta > 0) {
+        menu_selector_.goNext(now_ms);
+    } else {
+        menu_selector_.goPrev(now_ms);
+    }
+    menu_index_ = menu_selector_.getSelectedIndex();
+    last_action_ms_ = now_ms;
+    dirty_ = true;
+}
+
+void ui::UiController::rotateSettings_(int delta, uint32_t now_ms) noexcept
+{
+    if (!in_settings_edit_) {
+        enterSettings_();
+    }
+
+    // Popup has priority.
+    if (settings_popup_mode_ != SettingsPopupMode::None) {
+        handleSettingsPopupInput_(delta, false, now_ms);
+        dirty_ = true;
+        return;
+    }
+
+    // Composite bounds editor has priority over the list.
+    if (bounds_tune_active_) {
+        handleBoundsTuneInput_(delta, false, now_ms);
+        dirty_ = true;
+        return;
+    }
+
+    // Dedicated value editor has priority.
+    if (settings_value_editor_active_) {
+        handleSettingsValueEdit_(delta, now_ms);
+        dirty_ = true;
+        return;
+    }
+
+    // Otherwise rotation moves selection within current category.
+    const int item_count = getSettingsItemCount_();
+    settings_index_ = std::clamp(settings_index_ + delta, 0, item_count - 1);
+
+    // Persist last non-back selection per submenu.
+    if (settings_index_ > 0) {
+        switch (settings_category_) {
+            case SettingsCategory::FatigueTest: settings_last_fatigue_index_ = settings_index_; break;
+            case SettingsCategory::BoundsFinding: settings_last_bounds_index_ = settings_index_; break;
+            case SettingsCategory::UI: settings_last_ui_index_ = settings_index_; break;
+            case SettingsCategory::Main: break;
+            case SettingsCategory::Profiles: break;
+        }
+    }
+    dirty_ = true;
+}
+
+void ui::UiController::rotateBounds_(int delta, uint32_t now_ms) noexcept
+{
+    (void)now_ms;
+    if (delta != 0) {
+        bounds_focus_ = (bounds_focus_ == BoundsFocus::Action) ? BoundsFocus::Back : BoundsFocus::Action;
+        dirty_ = true;
+    }
+}
+
+void ui::UiController::rotateLive_(int delta, uint32_t now_ms) noexcept
+{
+    if (live_popup_mode_ == LivePopupMode::QuickSettings) {
+        handleQuickSettingsInput_(delta, false, now_ms);
+        return;
+    }
+    if (live_popup_mode_ != LivePopupMode::None) {
+        handleLivePopupInput_(delta, false, now_ms);
+        return;
+    }
+    if (delta != 0) {
+        live_focus_ = (live_focus_ == LiveFocus::Actions) ? LiveFocus::Back : LiveFocus::Actions;
+        dirty_ = true;
+    }
+}
+
+void ui::UiController::rotateTerminal_(int delta, uint32_t now_ms) noexcept
+{
+    (void)now_ms;
+    // Always scroll on encoder rotation - no mode toggle needed.
+    // Match the earlier UX:
+    //   CW scrolls UP (newer, toward bottom)
+    //   CCW scrolls DOWN (older, toward top)
+    constexpr int16_t log_top = 38;
+    constexpr int16_t log_bottom = 240 - 28;
+    constexpr int16_t line_h = 14;
+    const int max_lines = (log_bottom - log_top) / line_h;
+    const int max_scroll = std::max(0, static_cast<int>(terminalHistoryCount_()) - max_lines);
+
+    // scroll_lines_ is "lines away from newest".
+    const int desired = scroll_lines_ - (delta * 2);
+    if (desired < 0) {
+        scroll_lines_ = 0;
+        terminal_overscroll_px_ = std::max(terminal_overscroll_px_, 8.0f);
+    } else if (desired > max_scroll) {
+        scroll_lines_ = max_scroll;
+        terminal_overscroll_px_ = std::min(terminal_overscroll_px_, -8.0f);
+    } else {
+        scroll_lines_ = desired;
+    }
+    markDirty_(0, 38, 240, 202);
+}
+
+void ui::UiController::rotateDiagnostics_(int delta, uint32_t now_ms) noexcept
+{
+    (void)delta;
+    // Press+rotate: stream the retained canvas over serial (see
+    // serviceScreenshot_). Plain rotation just repaints.
+    if (chord_rotate_) {
+        int16_t idle = -1;
+        if (shot_row_.compare_exchange_strong(idle, 0)) {
+            logf_(now_ms, "UI: screenshot capture started");
+        }
+        return;
+    }
+    // Each detent repaints the page (histogram included), so the latency
+    // probe can be exercised and read without leaving Diagnostics.
+    dirty_ = true;
+}
+
+void ui::UiController::rotateHistory_(int delta, uint32_t now_ms) noexcept
+{
+    (void)now_ms;
+    // Scroll through the active list (runs or audit records), newest at
+    // the top.
+    constexpr int kVisibleRows = 6;
+    const size_t total =
+        history_show_audit_ ? audit::Count() : run_db::Count();
+    const int max_scroll = std::max(0, static_cast<int>(total) - kVisibleRows);
+    history_scroll_ = std::clamp(history_scroll_ + delta, 0, max_scroll);
+    dirty_ = true;
+}
+
+// Timeline plot geometry, shared by the draw helper and the scrub
+// handlers so the dirty marks line up with the pixels drawn.
+namespace {
+constexpr int16_t kTlPlotX = 20;      // left edge of the plot columns
+constexpr int16_t kTlPlotW = 200;     // one column per retained bucket
+constexpr int16_t kTlRateY = 56;      // rate track top
+constexpr int16_t kTlRateH = 56;      // rate track height
+constexpr int16_t kTlBandY = 120;     // state band top
+constexpr int16_t kTlBandH = 12;      // state band height
+constexpr int16_t kTlMarkY = 136;     // event marker row top
+constexpr int16_t kTlMarkH = 8;       // event marker height
+constexpr int16_t kTlCursorY = 52;    // cursor line top
+constexpr int16_t kTlCursorH = 96;    // cursor line spans all three tracks
+constexpr int16_t kTlReadoutY = 152;  // cursor readout block top
+constexpr int16_t kTlReadoutH = 48;   // cursor readout block height
+}  // namespace
+
+void ui::UiController::rotateTimeline_(int delta, uint32_t now_ms) noexcept
+{
+    (void)now_ms;
+    // Scrub the cursor; clockwise moves deeper into the past, matching
+    // the History page's scroll direction.
+    const size_t total = timelineZoomCount_();
+    const int max_back = (total > 0) ? static_cast<int>(total) - 1 : 0;
+    const int prev = timeline_cursor_;
+    const int prev_window = timeline_window_;
+    timeline_cursor_ = std::clamp(timeline_cursor_ + delta, 0, max_back);
+    if (timeline_cursor_ == prev) {
+        return;
+    }
+    // Pan the 200-column window when the cursor scrubs past its edge so
+    // the coarse rings' extra depth stays reachable.
+    timeline_window_ = std::clamp(timeline_window_,
+                                  timeline_cursor_ - (static_cast<int>(kTlPlotW) - 1),
+                                  timeline_cursor_);
+    timeline_window_ = std::clamp(timeline_window_, 0,
+                                  std::max(0, max_back - (static_cast<int>(kTlPlotW) - 1)));
+    if (timeline_window_ != prev_window) {
+        // Every column shifts; repaint the whole plot and readout.
+        markDirty_(kTlPlotX, kTlCursorY, kTlPlotW, kTlCursorH);
+        markDirty_(0, kTlReadoutY, 240, kTlReadoutH);
+        return;
+    }
+    // Only the two cursor columns and the readout change; the tracks
+    // under the old cursor are repainted by the normal draw path inside
+    // the clipped union, so a detent costs a narrow band, not a frame.
+    const int16_t right = static_cast<int16_t>(kTlPlotX + kTlPlotW - 1);
+    markDirty_(static_cast<int16_t>(right - (prev - timeline_window_)), kTlCursorY, 1,
+               kTlCursorH);
+    markDirty_(static_cast<int16_t>(right - (timeline_cursor_ - timeline_window_)), kTlCursorY,
+               1, kTlCursorH);
+    markDirty_(0, kTlReadoutY, 240, kTlReadoutH);
+}
+
+void ui::UiController::touchTimeline_(int16_t x, int16_t y, uint32_t now_ms) noexcept
+{
+    // Tap on the title cycles through the resolution tiers, keeping the
+    // moment under the cursor fixed by rescaling it to the new bucket
+    // size (same tap affordance as the History page's mode toggle).
+    const Rect title_band{ 84, 8, 120, 30 };
+    if (title_band.contains(x, y)) {
+        const uint32_t old_bucket = timelineZoomBucketMs_();
+        timeline_zoom_ = static_cast<uint8_t>((timeline_zoom_ + 1) % 3);
+        const uint32_t new_bucket = timelineZoomBucketMs_();
+        timeline_cursor_ = static_cast<int>(
+            static_cast<uint64_t>(timeline_cursor_) * old_bucket / new_bucket);
+        timeline_window_ = static_cast<int>(
+            static_cast<uint64_t>(timeline_window_) * old_bucket / new_bucket);
+        const size_t ztotal = timelineZoomCount_();
+        const int zmax = (ztotal > 0) ? static_cast<int>(ztotal) - 1 : 0;
+        timeline_cursor_ = std::clamp(timeline_cursor_, 0, zmax);
+        timeline_window_ = std::clamp(timeline_window_,
+                                      timeline_cursor_ - (static_cast<int>(kTlPlotW) - 1),
+                                      timeline_cursor_);
+        timeline_window_ = std::clamp(timeline_window_, 0,
+                                      std::max(0, zmax - (static_cast<int>(kTlPlotW) - 1)));
+        logf_(now_ms, (timeline_zoom_ == 0)   ? "Timeline zoom: 3s"
+                      : (timeline_zoom_ == 1) ? "Timeline zoom: 30s"
+                                              : "Timeline zoom: 5min");
+        dirty_ = true;
+        return;
+    }
+    // Tap inside the plot jumps the cursor to the tapped column.
+    const size_t total = timelineZoomCount_();
+    if (total == 0 || x < kTlPlotX || x >= kTlPlotX + kTlPlotW ||
+        y < kTlCursorY || y >= kTlMarkY + kTlMarkH) {
+        return;
+    }
+    const int16_t right = static_cast<int16_t>(kTlPlotX + kTlPlotW - 1);
+    const int max_back = static_cast<int>(total) - 1;
+    const int prev = timeline_cursor_;
+    timeline_cursor_ =
+        std::clamp(timeline_window_ + static_cast<int>(right - x), 0, max_back);
+    if (timeline_cursor_ == prev) {
+        return;
+    }
+    markDirty_(static_cast<int16_t>(right - (prev - timeline_window_)), kTlCursorY, 1,
+               kTlCursorH);
+    markDirty_(static_cast<int16_t>(right - (timeline_cursor_ - timeline_window_)), kTlCursorY,
+               1, kTlCursorH);
+    markDirty_(0, kTlReadoutY, 240, kTlReadoutH);
+}
+
+// Dashboard tile geometry, shared by the draw helper, the tap handler
+// and the per-tile dirty marks so they all agree on the pixels.
+namespace {
+constexpr int16_t kDashTileW = 96;
+constexpr int16_t kDashTileH = 72;
+constexpr int16_t kDashColX[2] = {22, 122};
+constexpr int16_t kDashRowY[2] = {46, 122};
+}  // namespace
+
+ui::UiController::Rect ui::UiController::dashTileRect_(size_t i) noexcept
+{
+    return Rect{ kDashColX[i % 2], kDashRowY[i / 2], kDashTileW, kDashTileH };
+}
+
+void ui::UiController::rotateDashboard_(int delta, uint32_t now_ms) noexcept
+{
+    (void)now_ms;
+    if (unit_count_ < 2) {
+        return;
+    }
+    // Move the focus ring; repaint is driven by serviceDashboard_, which
+    // folds the focus flag into each tile's signature and marks only the
+    // two affected tiles.
+    const int n = static_cast<int>(unit_count_);
+    dash_focus_ = ((dash_focus_ + delta) % n + n) % n;
+}
+
+void ui::UiController::clickDashboard_(uint32_t now_ms) noexcept
+{
+    if (unit_count_ == 0) {
+        clickBackToLanding_(now_ms);
+        return;
+    }
+    // Drill into the focused unit's live counter, switching the active
+    // unit first when the focus sits on a background tile.
+    selectUnit_(dash_focus_, now_ms);
+    page_ = Page::LiveCounter;
+    playBeep_(2);
+    logf_(now_ms, "UI: dashboard opens unit %d", dash_focus_ + 1);
+    dirty_ = true;
+}
+
+void ui::UiController::touchDashboard_(int16_t x, int16_t y, uint32_t now_ms) noexcept
+{
+    const Rect back_btn{ 10, 8, 70, 30 };
+    if (back_btn.contains(x, y)) {
+        clickBackToLanding_(now_ms);
+        return;
+    }
+    for (size_t i = 0; i < unit_count_; ++i) {
+        if (!dashTileRect_(i).contains(x, y)) {
+            continue;
+        }
+        // First tap focuses the tile, a tap on the focused tile drills in.
+        if (static_cast<int>(i) == dash_focus_) {
+            clickDashboard_(now_ms);
+        } else {
+            dash_focus_ = static_cast<int>(i);
+            playBeep_(2);
+        }
+        return;
+    }
+}
+
+void ui::UiController::serviceDashboard_(uint32_t now_ms) noexcept
+{
+    (void)now_ms;
+    if (page_ != Page::Dashboard) {
+        return;
     }
-
-    // Check for connection timeout
-    if (conn_status_ == ConnStatus::Connected && (now_ms - last_rx_ms_) > kConnTimeout_ms) {
-        conn_status_ = ConnStatus::Connecting;
-        // Clear stale status data - don't show old "Idle" or "Running" when disconnected
-        have_status_ = false;
-        have_remote_config_ = false;
-        last_status_ = {};
-        last_remote_config_ = {};
-        boundsResetResult_();
-        bounds_state_ = BoundsState::Idle;
-        bounds_state_since_ms_ = now_ms;
-        logf_(now_ms, "Connection timeout - cleared stale status data and reset bounds state");
-        dirty_ = true;
+    // Per-tile dirty tracking: hash the fields each tile renders and mark
+    // only tiles whose hash moved, so one unit's status update costs about
+    // a quarter of the screen instead of a frame.
+    for (size_t i = 0; i < kMaxUnits_; ++i) {
+        const uint32_t sig = dashTileSignature_(i);
+        if (sig == dash_tile_sig_[i]) {
+            continue;
+        }
+        dash_tile_sig_[i] = sig;
+        const Rect r = dashTileRect_(i);
+        markDirty_(r.x, r.y, r.w, r.h);
     }
 }
 
-void ui::UiController::boundsResetResult_() noexcept
+uint32_t ui::UiController::dashTileSignature_(size_t i) const noexcept
 {
-    bounds_have_result_ = false;
-    bounds_bounded_ = false;
-    bounds_cancelled_ = false;
-    bounds_min_deg_ = 0.0f;
-    bounds_max_deg_ = 0.0f;
-    bounds_global_min_deg_ = 0.0f;
-    bounds_global_max_deg_ = 0.0f;
-    bounds_last_error_code_ = 0;
+    // FNV-1a over the displayed fields; the mirrored single-unit state is
+    // the authority for the active slot (see selectUnit_).
+    const bool active = static_cast<int>(i) == active_unit_ && i < unit_count_;
+    const ConnStatus conn = active ? conn_status_ : units_[i].conn;
+    const bool have = active ? have_status_ : units_[i].have_status;
+    const fatigue_proto::StatusPayload& st = active ? last_status_ : units_[i].status;
+
+    uint32_t h = 2166136261u;
+    const auto mix = [&h](uint32_t v) { h = (h ^ v) * 16777619u; };
+    mix(i < unit_count_ ? 1u : 0u);
+    mix(static_cast<uint32_t>(conn));
+    mix(have ? 1u : 0u);
+    if (have) {
+        mix(st.cycle_number);
+        mix(st.state);
+        mix(st.err_code);
+    }
+    if (active && have_remote_config_) {
+        mix(last_remote_config_.cycle_amount);  // drives the progress bar
+    }
+    mix(static_cast<int>(i) == dash_focus_ ? 1u : 0u);
+    mix(active ? 1u : 0u);
+    return h;
 }
 
-void ui::UiController::boundsStart_(uint32_t now_ms) noexcept
+void ui::UiController::onClick_(uint32_t now_ms) noexcept
 {
-    boundsResetResult_();
+    HOT_ASSERT(static_cast<size_t>(page_) < static_cast<size_t>(Page::Count));
+    const InputRoute& route = kRoutes_[static_cast<size_t>(page_)];
+    if (route.click != nullptr) {
+        (this->*route.click)(now_ms);
+    }
+}
 
-    (void)espnow::SendCommand(
-        fatigue_proto::DEVICE_ID_FATIGUE_TESTER_,
-        static_cast<uint8_t>(fatigue_proto::CommandId::RunBoundsFinding),
-        nullptr,
-        0);
-    logf_(now_ms, "TX: Command RunBoundsFinding (awaiting ACK)");
+void ui::UiController::clickLanding_(uint32_t now_ms) noexcept
+{
+    if (mru_active_) {
+        openSettingsMruField_(now_ms);
+        return;
+    }
+    // Enter selected page from circular menu
+    const int idx = menu_selector_.getSelectedIndex();
+    if (idx >= 0 && idx < MENU_COUNT_) {
+        page_ = kMenuItems_[idx].target_page;
+        playBeep_(2);  // Button press beep
+        logf_(now_ms, "UI: enter %s", kMenuItems_[idx].tag_up);
+        if (page_ == Page::Settings) {
+            enterSettings_();
+        }
+        if (page_ == Page::Terminal) {
+            scroll_lines_ = 0;
+            terminal_overscroll_px_ = 0.0f;
+        }
+        if (page_ == Page::History) {
+            history_scroll_ = 0;
+        }
+        if (page_ == Page::Timeline) {
+            timeline_cursor_ = 0;  // scrub starts at "now"
+            timeline_window_ = 0;
+        }
+        if (page_ == Page::Bounds) {
+            boundsOfferCached_(now_ms);
+        }
+        if (page_ == Page::Dashboard) {
+            dash_focus_ = (active_unit_ >= 0 &&
+                           static_cast<size_t>(active_unit_) < unit_count_)
+                              ? active_unit_
+                              : 0;
+        }
+        dirty_ = true;
+    }
+}
 
-    bounds_state_ = BoundsState::StartWaitAck;
-    bounds_state_since_ms_ = now_ms;
-    bounds_ack_deadline_ms_ = now_ms + 1500;
+void ui::UiController::clickTerminal_(uint32_t now_ms) noexcept
+{
+    page_ = Page::Landing;
+    playBeep_(2);
+    logf_(now_ms, "UI: back to landing");
     dirty_ = true;
 }
 
-void ui::UiController::boundsStop_(uint32_t now_ms) noexcept
+void ui::UiController::clickBackToLanding_(uint32_t now_ms) noexcept
 {
-    (void)espnow::SendCommand(
-        fatigue_proto::DEVICE_ID_FATIGUE_TESTER_,
-        static_cast<uint8_t>(fatigue_proto::CommandId::Stop),
-        nullptr,
-        0);
-    logf_(now_ms, "TX: Command Stop (cancel bounds; awaiting ACK)");
-
-    bounds_state_ = BoundsState::StopWaitAck;
-    bounds_state_since_ms_ = now_ms;
-    bounds_ack_deadline_ms_ = now_ms + 1500;
+    (void)now_ms;
+    page_ = Page::Landing;
+    playBeep_(2);
     dirty_ = true;
 }
 
-void ui::UiController::updateBoundsState_(uint32_t now_ms) noexcept
+void ui::UiController::clickSettings_(uint32_t now_ms) noexcept
 {
-    if (page_ != Page::Bounds) {
+    if (!in_settings_edit_) {
+        enterSettings_();
+    }
+
+    // Popup click.
+    if (settings_popup_mode_ != SettingsPopupMode::None) {
+        handleSettingsPopupInput_(0, true, now_ms);
+        dirty_ = true;
         return;
     }
 
-    // ACK timeouts
-    if ((bounds_state_ == BoundsState::StartWaitAck || bounds_state_ == BoundsState::StopWaitAck) && now_ms >= bounds_ack_deadline_ms_) {
-        bounds_state_ = BoundsState::Error;
-        bounds_state_since_ms_ = now_ms;
-        // 0 => "no-ack" (UI-local meaning)
-        bounds_last_error_code_ = 0;
-        logf_(now_ms, "Bounds: ACK timeout");
+    // Composite bounds editor click: focus toggle / apply / cancel.
+    if (bounds_tune_active_) {
+        handleBoundsTuneInput_(0, true, now_ms);
         dirty_ = true;
+        return;
     }
-}
 
-void ui::UiController::handleInputs_(uint32_t now_ms) noexcept
-{
-    // Encoder rotation events.
-    if (auto* q = encoder_.getEventQueue(); q != nullptr) {
-        EC11Encoder::Event evt{};
-        while (xQueueReceive(q, &evt, 0) == pdTRUE) {
-            if (evt.type == EC11Encoder::EventType::ROTATION) {
-                int delta = 0;
-                if (evt.direction == EC11Encoder::Direction::CW) {
-                    delta = 1;
-                } else if (evt.direction == EC11Encoder::Direction::CCW) {
-                    delta = -1;
-                }
-                if (delta != 0) {
-                    onRotate_(delta, now_ms);
-                }
-            }
+    // Value editor click: exit editor and (if changed) confirm keep/discard.
+    if (settings_value_editor_active_) {
+        playBeep_(2);
+        if (settingsEditorHasChange_()) {
+            settings_popup_mode_ = SettingsPopupMode::ValueChangeConfirm;
+            settings_popup_selection_ = 0; // default KEEP
+        } else {
+            settings_value_editor_active_ = false;
+            settings_editor_type_ = SettingsEditorValueType::None;
         }
-        encoder_pos_ = encoder_.getPosition();
+        dirty_ = true;
+        return;
     }
 
-    // Button actions via M5Unified.
-    // In the Settings value editor: long-press cycles step size (for float or U32 editors) instead of finishing.
-    if (page_ == Page::Settings && settings_value_editor_active_) {
-        if ((settings_editor_type_ == SettingsEditorValueType::F32 || settings_editor_type_ == SettingsEditorValueType::U32) && M5.BtnA.wasReleasedAfterHold()) {
-            cycleSettingsEditorStep_();
-            playBeep_(1);
-            dirty_ = true;
-            return;
+    playBeep_(2);
+
+    // Index 0 is always "< Back".
+    if (settings_index_ == 0) {
+        if (settings_category_ == SettingsCategory::Main) {
+            settingsBack_();
+        } else {
+            settings_category_ = SettingsCategory::Main;
+            settings_index_ = settings_return_main_index_;
         }
+        dirty_ = true;
+        return;
     }
-    
-    // Quick Settings: long-press cycles step size when editing (F32 or U32)
-    if (page_ == Page::LiveCounter && live_popup_mode_ == LivePopupMode::QuickSettings) {
-        if (quick_settings_editing_ && (quick_editor_type_ == QuickEditorType::F32 || quick_editor_type_ == QuickEditorType::U32) && M5.BtnA.wasReleasedAfterHold()) {
-            cycleQuickSettingsStep_();
-            playBeep_(1);
-            dirty_ = true;
-            return;
+
+    // Main: enter sub-category.
+    if (settings_category_ == SettingsCategory::Main) {
+        settings_return_main_index_ = settings_index_;
+        switch (settings_index_) {
+            case 1: settings_category_ = SettingsCategory::FatigueTest; break;
+            case 2: settings_category_ = SettingsCategory::BoundsFinding; break;
+            case 3: settings_category_ = SettingsCategory::UI; break;
+            case 4: settings_category_ = SettingsCategory::Profiles; loadProfiles_(); break;
+            default: break;
         }
-    }
-    
-    // LiveCounter: long-press opens Quick Settings (only during Running/Paused)
-    if (page_ == Page::LiveCounter && live_popup_mode_ == LivePopupMode::None) {
-        if (M5.BtnA.wasReleasedAfterHold()) {
-            const bool use_status = (conn_status_ == ConnStatus::Connected && have_status_);
-            const auto test_state = use_status ? static_cast<fatigue_proto::TestState>(last_status_.state) : fatigue_proto::TestState::Idle;
-            
-            if (test_state == fatigue_proto::TestState::Running || test_state == fatigue_proto::TestState::Paused) {
-                // Sync edit_settings_ from machine config before opening Quick Settings
-                if (settings_ != nullptr) {
-                    edit_settings_ = *settings_;
-                }
-                // Open quick settings
-                live_popup_mode_ = LivePopupMode::QuickSettings;
-                quick_settings_index_ = 0;
-                quick_settings_editing_ = false;
-                quick_settings_confirm_popup_ = false;
-                playBeep_(2);
-                dirty_ = true;
-                return;
-            }
+        // Restore last selection inside the submenu (avoid jumping to "< Back").
+        switch (settings_category_) {
+            case SettingsCategory::FatigueTest: settings_index_ = std::max(1, settings_last_fatigue_index_); break;
+            case SettingsCategory::BoundsFinding: settings_index_ = std::max(1, settings_last_bounds_index_); break;
+            case SettingsCategory::UI: settings_index_ = std::max(1, settings_last_ui_index_); break;
+            case SettingsCategory::Profiles:
+                // Land on the slot remembered for the active unit, if any.
+                settings_index_ = (profile_offer_slot_ >= 0) ? profile_offer_slot_ + 1 : 1;
+                break;
+            default: settings_index_ = 1; break;
         }
+        // Clamp to the submenu bounds in case menu size changed.
+        settings_index_ = std::min(settings_index_, getSettingsItemCount_() - 1);
+        dirty_ = true;
+        return;
     }
 
-    if (M5.BtnA.wasClicked()) {
-        onClick_(now_ms);
+    // Bounds "Tune All": stage the whole category in one editor.
+    if (settings_category_ == SettingsCategory::BoundsFinding && settings_index_ == 7) {
+        beginBoundsTuneEditor_();
+        dirty_ = true;
+        return;
     }
 
-    // Touch input with gesture detection
-    if (M5.Touch.getCount() > 0) {
-        const auto& t = M5.Touch.getDetail(0);
-        
-        // Track touch start for swipe detection
-        if (t.wasPressed()) {
-            touch_start_x_ = t.x;
-            touch_start_y_ = t.y;
-            touch_start_ms_ = now_ms;
-            swipe_detected_ = false;
-        }
-        
-        if (t.wasDragStart()) {
-            touch_dragging_ = true;
-            last_touch_x_ = t.x;
-            last_touch_y_ = t.y;
-        }
-        
-        if (touch_dragging_ && t.isDragging()) {
-            const int16_t dy = t.y - last_touch_y_;
-            last_touch_x_ = t.x;
-            last_touch_y_ = t.y;
-            onTouchDrag_(dy, now_ms);
-            
-            // Check for swipe gesture (significant horizontal movement)
-            const int16_t total_dx = t.x - touch_start_x_;
-            const int16_t total_dy = t.y - touch_start_y_;
-            if (!swipe_detected_ && (std::abs(total_dx) > 50 || std::abs(total_dy) > 50)) {
-                swipe_detected_ = true;
-            }
-        }
-        
-        // Handle swipe on release
-        if (t.wasReleased() && swipe_detected_) {
-            const int16_t total_dx = t.x - touch_start_x_;
-            const int16_t total_dy = t.y - touch_start_y_;
-            onSwipe_(total_dx, total_dy, now_ms);
-        }
-
-        // Robust click detection: treat a press+release with minimal movement as a click.
-        // This is more reliable than relying solely on M5Unified's wasClicked(), which can
-        // be missed if the touch jitters slightly.
-        if (t.wasReleased() && !swipe_detected_) {
-            const int16_t dx = t.x - touch_start_x_;
-            const int16_t dy = t.y - touch_start_y_;
-            const int32_t dist2 = static_cast<int32_t>(dx) * dx + static_cast<int32_t>(dy) * dy;
-            const uint32_t held_ms = now_ms - touch_start_ms_;
-
-            if (dist2 <= (12 * 12) && held_ms <= 500U) {
-                onTouchClick_(t.x, t.y, now_ms);
-            }
-        }
-
-        // Only clear dragging state on release; clearing on every `wasDragged()` makes
-        // gesture handling sporadic.
-        if (t.wasReleased()) {
-            touch_dragging_ = false;
+    // Profiles: a saved slot applies on click (one-touch recall); an empty
+    // slot saves the current parameters into it.
+    if (settings_category_ == SettingsCategory::Profiles) {
+        const int slot = settings_index_ - 1;
+        if (profile_used_[slot]) {
+            applyProfileSlot_(slot, now_ms);
+        } else {
+            saveProfileSlot_(slot, now_ms);
         }
-    } else {
-        touch_dragging_ = false;
+        dirty_ = true;
+        return;
     }
+
+    // Sub-categories: always enter dedicated value editor.
+    beginSettingsValueEditor_();
+    dirty_ = true;
 }
 
-void ui::UiController::nextPage_(int delta) noexcept
+void ui::UiController::clickBounds_(uint32_t now_ms) noexcept
 {
-    (void)delta;
-    // Page cycling was replaced with a main-menu carousel on the Landing page.
+    if (bounds_focus_ == BoundsFocus::Back) {
+        page_ = Page::Landing;
+        dirty_ = true;
+        return;
+    }
+
+    // Action button (Start/Stop depending on state)
+    if (bounds_state_ == BoundsState::Idle || bounds_state_ == BoundsState::Complete || bounds_state_ == BoundsState::Error) {
+        boundsStart_(now_ms);
+        return;
+    }
+
+    if (bounds_state_ == BoundsState::Running) {
+        boundsStop_(now_ms);
+        return;
+    }
+
+    // If already waiting for ACK, ignore additional presses.
+    playBeep_(1);
 }
 
-void ui::UiController::onRotate_(int delta, uint32_t now_ms) noexcept
+void ui::UiController::clickLive_(uint32_t now_ms) noexcept
 {
-    (void)now_ms;
+    // Handle QuickSettings popup separately
+    if (live_popup_mode_ == LivePopupMode::QuickSettings) {
+        handleQuickSettingsInput_(0, true, now_ms);
+        return;
+    }
 
-    // Page-specific behavior.
-    if (page_ == Page::Settings) {
-        if (!in_settings_edit_) {
-            enterSettings_();
+    // Encoder navigation: allow selecting Back vs Actions without touch.
+    if (live_popup_mode_ == LivePopupMode::None && live_focus_ == LiveFocus::Back) {
+        // If disconnected, allow direct exit without any popup
+        if (conn_status_ != ConnStatus::Connected) {
+            page_ = Page::Landing;
+            playBeep_(2);
+            dirty_ = true;
+            return;
         }
 
-        // Popup has priority.
-        if (settings_popup_mode_ != SettingsPopupMode::None) {
-            handleSettingsPopupInput_(delta, false, now_ms);
+        const bool use_status = have_status_;
+        const auto test_state = use_status ? static_cast<fatigue_proto::TestState>(last_status_.state) : fatigue_proto::TestState::Idle;
+
+        // Safety: do not exit while running/paused. Instead, open the actions popup.
+        if (test_state == fatigue_proto::TestState::Running) {
+            live_popup_mode_ = LivePopupMode::RunningActions;
+            live_popup_selection_ = 0; // Back
+            playBeep_(2);
             dirty_ = true;
             return;
         }
-
-        // Dedicated value editor has priority.
-        if (settings_value_editor_active_) {
-            handleSettingsValueEdit_(delta);
+        if (test_state == fatigue_proto::TestState::Paused) {
+            live_popup_mode_ = LivePopupMode::PausedActions;
+            live_popup_selection_ = 0; // Back
+            playBeep_(2);
             dirty_ = true;
             return;
         }
 
-        // Otherwise rotation moves selection within current category.
-        const int item_count = getSettingsItemCount_();
-        settings_index_ = std::clamp(settings_index_ + delta, 0, item_count - 1);
-
-        // Persist last non-back selection per submenu.
-        if (settings_index_ > 0) {
-            switch (settings_category_) {
-                case SettingsCategory::FatigueTest: settings_last_fatigue_index_ = settings_index_; break;
-                case SettingsCategory::BoundsFinding: settings_last_bounds_index_ = settings_index_; break;
-                case SettingsCategory::UI: settings_last_ui_index_ = settings_index_; break;
-                case SettingsCategory::Main: break;
-            }
-        }
+        page_ = Page::Landing;
+        playBeep_(2);
         dirty_ = true;
         return;
     }
 
-    if (page_ == Page::Bounds) {
-        if (delta != 0) {
-            bounds_focus_ = (bounds_focus_ == BoundsFocus::Action) ? BoundsFocus::Back : BoundsFocus::Action;
-            dirty_ = true;
-        }
+    // Handle popup if active
+    if (live_popup_mode_ != LivePopupMode::None) {
+        handleLivePopupInput_(0, true, now_ms);
         return;
     }
 
-    if (page_ == Page::Landing) {
-        // Use circular menu selector with smooth animation
-        if (delta > 0) {
-            menu_selector_.goNext(now_ms);
-            playBeep_(1);  // Higher pitch for CW
-        } else {
-            menu_selector_.goPrev(now_ms);
-            playBeep_(0);  // Lower pitch for CCW
-        }
-        menu_index_ = menu_selector_.getSelectedIndex();
-        last_action_ms_ = now_ms;
+    // If disconnected, allow direct exit without showing action popup
+    if (conn_status_ != ConnStatus::Connected) {
+        page_ = Page::Landing;
+        playBeep_(2);
         dirty_ = true;
         return;
     }
 
-    if (page_ == Page::Terminal) {
-        // Always scroll on encoder rotation - no mode toggle needed.
-        // Match the earlier UX:
-        //   CW scrolls UP (newer, toward bottom)
-        //   CCW scrolls DOWN (older, toward top)
-        constexpr int16_t log_top = 38;
-        constexpr int16_t log_bottom = 240 - 28;
-        constexpr int16_t line_h = 14;
-        const int max_lines = (log_bottom - log_top) / line_h;
-        const int max_scroll = std::max(0, static_cast<int>(log_count_) - max_lines);
+    // Show appropriate popup based on current state
+    const auto test_state = have_status_ ? static_cast<fatigue_proto::TestState>(last_status_.state) : fatigue_proto::TestState::Idle;
 
-        // scroll_lines_ is "lines away from newest".
-        const int desired = scroll_lines_ - (delta * 2);
-        if (desired < 0) {
-            scroll_lines_ = 0;
-            terminal_overscroll_px_ = std::max(terminal_overscroll_px_, 8.0f);
-        } else if (desired > max_scroll) {
-            scroll_lines_ = max_scroll;
-            terminal_overscroll_px_ = std::min(terminal_overscroll_px_, -8.0f);
-        } else {
-            scroll_lines_ = desired;
-        }
-        dirty_ = true;
-        return;
+    switch (test_state) {
+        case fatigue_proto::TestState::Idle:
+        case fatigue_proto::TestState::Completed:
+        case fatigue_proto::TestState::Error:
+            live_popup_mode_ = LivePopupMode::StartConfirm;
+            live_popup_selection_ = 1; // Default to START
+            break;
+        case fatigue_proto::TestState::Running:
+            live_popup_mode_ = LivePopupMode::RunningActions;
+            live_popup_selection_ = 1; // Default to PAUSE
+            break;
+        case fatigue_proto::TestState::Paused:
+            live_popup_mode_ = LivePopupMode::PausedActions;
+            live_popup_selection_ = 1; // Default to RESUME
+            break;
     }
+    playBeep_(2);
+    dirty_ = true;
+}
 
-    if (page_ == Page::LiveCounter && live_popup_mode_ == LivePopupMode::QuickSettings) {
-        handleQuickSettingsInput_(delta, false, now_ms);
-        return;
+void ui::UiController::onLongPress_(uint32_t now_ms) noexcept
+{
+    HOT_ASSERT(static_cast<size_t>(page_) < static_cast<size_t>(Page::Count));
+    const InputRoute& route = kRoutes_[static_cast<size_t>(page_)];
+    if (route.long_press != nullptr) {
+        (this->*route.long_press)(now_ms);
     }
+}
 
-    if (page_ == Page::LiveCounter && live_popup_mode_ == LivePopupMode::None) {
-        if (delta != 0) {
-            live_focus_ = (live_focus_ == LiveFocus::Actions) ? LiveFocus::Back : LiveFocus::Actions;
-            dirty_ = true;
-        }
+void ui::UiController::longPressLanding_(uint32_t now_ms) noexcept
+{
+    // Long press on the Settings icon: most-recently-edited fields, one
+    // click from their value editors. A second long press closes.
+    if (mru_active_) {
+        mru_active_ = false;
+        playBeep_(0);
+        dirty_ = true;
+        return;
+    }
+    const int idx = menu_selector_.getSelectedIndex();
+    if (idx < 0 || idx >= MENU_COUNT_ ||
+        kMenuItems_[idx].target_page != Page::Settings) {
         return;
     }
-
-    if (page_ == Page::LiveCounter && live_popup_mode_ != LivePopupMode::None) {
-        handleLivePopupInput_(delta, false, now_ms);
+    if (settings_mru_count_ == 0) {
+        playBeep_(1);  // Nothing edited yet this session
         return;
     }
-
-    // Other pages: rotation is currently reserved for settings editing and terminal scrolling.
+    mru_active_ = true;
+    mru_index_ = 0;
+    playBeep_(2);
+    logf_(now_ms, "UI: recent settings overlay");
+    last_action_ms_ = now_ms;
+    dirty_ = true;
 }
 
-void ui::UiController::onClick_(uint32_t now_ms) noexcept
+void ui::UiController::recordSettingsMru_(const SettingsFieldDesc* field) noexcept
 {
-    if (page_ == Page::Landing) {
-        // Enter selected page from circular menu
-        const int idx = menu_selector_.getSelectedIndex();
-        if (idx >= 0 && idx < MENU_COUNT_) {
-            page_ = kMenuItems_[idx].target_page;
-            playBeep_(2);  // Button press beep
-            logf_(now_ms, "UI: enter %s", kMenuItems_[idx].tag_up);
-            if (page_ == Page::Settings) {
-                enterSettings_();
-            }
-            if (page_ == Page::Terminal) {
-                scroll_lines_ = 0;
-                terminal_overscroll_px_ = 0.0f;
-            }
-            dirty_ = true;
+    const uint8_t idx = static_cast<uint8_t>(field - kSettingsFields_);
+    // Move-to-front; a field already in the ring just gets promoted.
+    uint8_t at = settings_mru_count_;
+    for (uint8_t i = 0; i < settings_mru_count_; ++i) {
+        if (settings_mru_[i] == idx) {
+            at = i;
+            break;
         }
+    }
+    if (at == settings_mru_count_ && settings_mru_count_ < kSettingsMruSize_) {
+        ++settings_mru_count_;
+    }
+    for (uint8_t i = std::min<uint8_t>(at, kSettingsMruSize_ - 1); i > 0; --i) {
+        settings_mru_[i] = settings_mru_[i - 1];
+    }
+    settings_mru_[0] = idx;
+}
+
+void ui::UiController::openSettingsMruField_(uint32_t now_ms) noexcept
+{
+    if (mru_index_ < 0 || mru_index_ >= static_cast<int>(settings_mru_count_)) {
+        mru_active_ = false;
         return;
     }
+    const SettingsFieldDesc& field = kSettingsFields_[settings_mru_[mru_index_]];
+    mru_active_ = false;
+    page_ = Page::Settings;
+    enterSettings_();
+    settings_category_ = field.category;
+    settings_index_ = field.index;
+    // Backing out of the editor lands on the owning submenu with the main
+    // list remembering which item opened it, as if walked to by hand.
+    switch (field.category) {
+        case SettingsCategory::FatigueTest: settings_return_main_index_ = 1; break;
+        case SettingsCategory::BoundsFinding: settings_return_main_index_ = 2; break;
+        case SettingsCategory::UI: settings_return_main_index_ = 3; break;
+        default: break;
+    }
+    beginSettingsValueEditor_();
+    playBeep_(2);
+    logf_(now_ms, "UI: quick edit %s", field.label);
+    last_action_ms_ = now_ms;
+    dirty_ = true;
+}
 
-    // Terminal: button click goes back to landing
-    if (page_ == Page::Terminal) {
-        page_ = Page::Landing;
-        playBeep_(2);
-        logf_(now_ms, "UI: back to landing");
+void ui::UiController::longPressSettings_(uint32_t now_ms) noexcept
+{
+    // Value editor: long-press cycles step size (for float or U32 editors)
+    // instead of finishing the edit.
+    if (settings_value_editor_active_ &&
+        (settings_editor_type_ == SettingsEditorValueType::F32 ||
+         settings_editor_type_ == SettingsEditorValueType::U32)) {
+        cycleSettingsEditorStep_();
+        playBeep_(1);
         dirty_ = true;
         return;
     }
 
-    if (page_ == Page::Settings) {
-        if (!in_settings_edit_) {
-            enterSettings_();
-        }
-
-        // Popup click.
-        if (settings_popup_mode_ != SettingsPopupMode::None) {
-            handleSettingsPopupInput_(0, true, now_ms);
-            dirty_ = true;
-            return;
-        }
-
-        // Value editor click: exit editor and (if changed) confirm keep/discard.
-        if (settings_value_editor_active_) {
-            playBeep_(2);
-            if (settingsEditorHasChange_()) {
-                settings_popup_mode_ = SettingsPopupMode::ValueChangeConfirm;
-                settings_popup_selection_ = 0; // default KEEP
-            } else {
-                settings_value_editor_active_ = false;
-                settings_editor_type_ = SettingsEditorValueType::None;
-            }
-            dirty_ = true;
-            return;
-        }
-
-        playBeep_(2);
-
-        // Index 0 is always "< Back".
-        if (settings_index_ == 0) {
-            if (settings_category_ == SettingsCategory::Main) {
-                settingsBack_();
-            } else {
-                settings_category_ = SettingsCategory::Main;
-                settings_index_ = settings_return_main_index_;
-            }
-            dirty_ = true;
-            return;
-        }
-
-        // Main: enter sub-category.
-        if (settings_category_ == SettingsCategory::Main) {
-            settings_return_main_index_ = settings_index_;
-            switch (settings_index_) {
-                case 1: settings_category_ = SettingsCategory::FatigueTest; break;
-                case 2: settings_category_ = SettingsCategory::BoundsFinding; break;
-                case 3: settings_category_ = SettingsCategory::UI; break;
-                default: break;
-            }
-            // Restore last selection inside the submenu (avoid jumping to "< Back").
-            switch (settings_category_) {
-                case SettingsCategory::FatigueTest: settings_index_ = std::max(1, settings_last_fatigue_index_); break;
-                case SettingsCategory::BoundsFinding: settings_index_ = std::max(1, settings_last_bounds_index_); break;
-                case SettingsCategory::UI: settings_index_ = std::max(1, settings_last_ui_index_); break;
-                default: settings_index_ = 1; break;
-            }
-            // Clamp to the submenu bounds in case menu size changed.
-            settings_index_ = std::min(settings_index_, getSettingsItemCount_() - 1);
-            dirty_ = true;
-            return;
-        }
-
-        // Sub-categories: always enter dedicated value editor.
-        beginSettingsValueEditor_();
+    // Profiles list: long-press overwrites the selected slot with the
+    // current parameters (click on an occupied slot applies instead).
+    if (settings_category_ == SettingsCategory::Profiles && settings_index_ >= 1 &&
+        settings_popup_mode_ == SettingsPopupMode::None && !settings_value_editor_active_) {
+        saveProfileSlot_(settings_index_ - 1, now_ms);
         dirty_ = true;
-        return;
     }
+}
 
-    if (page_ == Page::Bounds) {
-        if (bounds_focus_ == BoundsFocus::Back) {
-            page_ = Page::Landing;
+void ui::UiController::longPressLive_(uint32_t now_ms) noexcept
+{
+    (void)now_ms;
+    // Quick Settings: long-press cycles step size when editing (F32 or U32).
+    if (live_popup_mode_ == LivePopupMode::QuickSettings) {
+        if (quick_settings_editing_ &&
+            (quick_editor_type_ == QuickEditorType::F32 || quick_editor_type_ == QuickEditorType::U32)) {
+            cycleQuickSettingsStep_();
+            playBeep_(1);
             dirty_ = true;
-            return;
-        }
-
-        // Action button (Start/Stop depending on state)
-        if (bounds_state_ == BoundsState::Idle || bounds_state_ == BoundsState::Complete || bounds_state_ == BoundsState::Error) {
-            boundsStart_(now_ms);
-            return;
-        }
-
-        if (bounds_state_ == BoundsState::Running) {
-            boundsStop_(now_ms);
-            return;
         }
-
-        // If already waiting for ACK, ignore additional presses.
-        playBeep_(1);
         return;
     }
 
-    if (page_ == Page::LiveCounter) {
-        // Handle QuickSettings popup separately
-        if (live_popup_mode_ == LivePopupMode::QuickSettings) {
-            handleQuickSettingsInput_(0, true, now_ms);
-            return;
-        }
-        
-        // Encoder navigation: allow selecting Back vs Actions without touch.
-        if (live_popup_mode_ == LivePopupMode::None && live_focus_ == LiveFocus::Back) {
-            // If disconnected, allow direct exit without any popup
-            if (conn_status_ != ConnStatus::Connected) {
-                page_ = Page::Landing;
-                playBeep_(2);
-                dirty_ = true;
-                return;
-            }
-            
-            const bool use_status = have_status_;
-            const auto test_state = use_status ? static_cast<fatigue_proto::TestState>(last_status_.state) : fatigue_proto::TestState::Idle;
+    // Long-press opens Quick Settings (only during Running/Paused).
+    if (live_popup_mode_ == LivePopupMode::None) {
+        const bool use_status = (conn_status_ == ConnStatus::Connected && have_status_);
+        const auto test_state = use_status ? static_cast<fatigue_proto::TestState>(last_status_.state) : fatigue_proto::TestState::Idle;
 
-            // Safety: do not exit while running/paused. Instead, open the actions popup.
-            if (test_state == fatigue_proto::TestState::Running) {
-                live_popup_mode_ = LivePopupMode::RunningActions;
-                live_popup_selection_ = 0; // Back
-                playBeep_(2);
-                dirty_ = true;
-                return;
-            }
-            if (test_state == fatigue_proto::TestState::Paused) {
-                live_popup_mode_ = LivePopupMode::PausedActions;
-                live_popup_selection_ = 0; // Back
-                playBeep_(2);
-                dirty_ = true;
-                return;
+        if (test_state == fatigue_proto::TestState::Running || test_state == fatigue_proto::TestState::Paused) {
+            // Sync edit_settings_ from machine config before opening Quick Settings
+            if (settings_ != nullptr) {
+                edit_settings_ = *settings_;
+                resetSettingsBaseline_();
             }
-
-            page_ = Page::Landing;
+            // Open quick settings
+            live_popup_mode_ = LivePopupMode::QuickSettings;
+            quick_settings_index_ = 0;
+            quick_settings_editing_ = false;
+            quick_settings_confirm_popup_ = false;
             playBeep_(2);
             dirty_ = true;
-            return;
         }
+    }
+}
 
-        // Handle popup if active
-        if (live_popup_mode_ != LivePopupMode::None) {
-            handleLivePopupInput_(0, true, now_ms);
-            return;
-        }
-        
-        // If disconnected, allow direct exit without showing action popup
-        if (conn_status_ != ConnStatus::Connected) {
-            page_ = Page::Landing;
-            playBeep_(2);
-            dirty_ = true;
-            return;
-        }
-        
-        // Show appropriate popup based on current state
-        const auto test_state = have_status_ ? static_cast<fatigue_proto::TestState>(last_status_.state) : fatigue_proto::TestState::Idle;
-        
-        switch (test_state) {
-            case fatigue_proto::TestState::Idle:
-            case fatigue_proto::TestState::Completed:
-            case fatigue_proto::TestState::Error:
-                live_popup_mode_ = LivePopupMode::StartConfirm;
-                live_popup_selection_ = 1; // Default to START
-                break;
-            case fatigue_proto::TestState::Running:
-                live_popup_mode_ = LivePopupMode::RunningActions;
-                live_popup_selection_ = 1; // Default to PAUSE
-                break;
-            case fatigue_proto::TestState::Paused:
-                live_popup_mode_ = LivePopupMode::PausedActions;
-                live_popup_selection_ = 1; // Default to RESUME
-                break;
+void ui::UiController::longPressDiagnostics_(uint32_t now_ms) noexcept
+{
+    // Long-press toggles the input-to-photon latency probe.
+    latency_probe_ = !latency_probe_;
+    if (latency_probe_) {
+        latencyReset_();
+        if (kLatencyProbeGpio_ != GPIO_NUM_NC) {
+            (void)gpio_set_direction(kLatencyProbeGpio_, GPIO_MODE_OUTPUT);
+            (void)gpio_set_level(kLatencyProbeGpio_, 0);
         }
-        playBeep_(2);
-        dirty_ = true;
-        return;
     }
+    playBeep_(2);
+    logf_(now_ms, "UI: latency probe %s", latency_probe_ ? "on" : "off");
+    dirty_ = true;
+}
+
+void ui::UiController::longPressFleet_(uint32_t now_ms) noexcept
+{
+    // Long-press broadcasts this remote's approved-peer table so a spare
+    // remote in earshot is provisioned in one transfer (see
+    // espnow::ShareAllowlist); receivers confirm with AllowlistUpdate.
+    if (espnow::ShareAllowlist()) {
+        playBeep_(3);
+        logf_(now_ms, "Fleet: peer list shared");
+    } else {
+        playBeep_(4);
+        logfAt_(LogLevel::Warn, now_ms, "Fleet: nothing to share");
+    }
+    dirty_ = true;
 }
 
 void ui::UiController::onTouchClick_(int16_t x, int16_t y, uint32_t now_ms) noexcept
 {
-    // Global back button (for non-landing pages).
+    // Global back button (for non-landing pages): shared chrome, handled
+    // before the per-page route.
     if (page_ != Page::Landing && page_ != Page::Bounds) {
         // LiveCounter: place Back inside circular safe area (top corners are clipped).
         const Rect back_btn = (page_ == Page::LiveCounter)
@@ -1019,102 +4700,269 @@ void ui::UiController::onTouchClick_(int16_t x, int16_t y, uint32_t now_ms) noex
         }
     }
 
-    // Landing: tap anywhere near center to enter.
-    if (page_ == Page::Landing) {
-        const int16_t cx = 240 / 2;
-        const int16_t cy = 240 / 2;
-        const int32_t dx = static_cast<int32_t>(x) - cx;
-        const int32_t dy = static_cast<int32_t>(y) - cy;
-        if ((dx * dx + dy * dy) < (90 * 90)) {
-            onClick_(now_ms);
-            return;
-        }
+    HOT_ASSERT(static_cast<size_t>(page_) < static_cast<size_t>(Page::Count));
+    const InputRoute& route = kRoutes_[static_cast<size_t>(page_)];
+    if (route.touch_click != nullptr) {
+        (this->*route.touch_click)(x, y, now_ms);
     }
+}
 
-    if (page_ == Page::Settings) {
-        const int16_t h = 240;
-        const Rect back_btn{ 20, static_cast<int16_t>(h - 55), 95, 38 };
-        const Rect save_btn{ static_cast<int16_t>(240 - 115), static_cast<int16_t>(h - 55), 95, 38 };
-        if (back_btn.contains(x, y)) {
-            settingsBack_();
-            dirty_ = true;
-            return;
-        }
-        if (save_btn.contains(x, y)) {
-            settingsSave_(now_ms);
-            dirty_ = true;
+void ui::UiController::touchLanding_(int16_t x, int16_t y, uint32_t now_ms) noexcept
+{
+    // Any tap dismisses the MRU overlay (rotate + click is its input model).
+    if (mru_active_) {
+        mru_active_ = false;
+        dirty_ = true;
+        return;
+    }
+    // Tap on the connection pill cycles the active unit. Checked before
+    // the center-tap test because the pill sits inside its radius.
+    if (unit_count_ > 1) {
+        const Point2D settings_pos = menu_selector_.getIconPosition(0);
+        const int16_t pill_cy = static_cast<int16_t>(
+            settings_pos.y + menu_config_.icon_bg_radius + 14 + 8);
+        if (std::abs(static_cast<int>(x) - 120) <= 55 &&
+            std::abs(static_cast<int>(y) - pill_cy) <= 14) {
+            selectNextUnit_(now_ms);
             return;
         }
     }
 
-    if (page_ == Page::Bounds) {
-        // Slightly higher to avoid bottom-edge clipping on the round display.
-        const Rect back_btn{ 18, 186, 64, 30 };
-        const Rect action_btn{ 90, 186, 132, 30 };
-        if (action_btn.contains(x, y)) {
-            bounds_focus_ = BoundsFocus::Action;
-            onClick_(now_ms);
-            return;
+    // Tap anywhere near center to enter.
+    const int16_t cx = 240 / 2;
+    const int16_t cy = 240 / 2;
+    const int32_t dx = static_cast<int32_t>(x) - cx;
+    const int32_t dy = static_cast<int32_t>(y) - cy;
+    if ((dx * dx + dy * dy) < (90 * 90)) {
+        onClick_(now_ms);
+    }
+}
+
+void ui::UiController::touchSettings_(int16_t x, int16_t y, uint32_t now_ms) noexcept
+{
+    const int16_t h = 240;
+    const Rect back_btn{ 20, static_cast<int16_t>(h - 55), 95, 38 };
+    const Rect save_btn{ static_cast<int16_t>(240 - 115), static_cast<int16_t>(h - 55), 95, 38 };
+    if (back_btn.contains(x, y)) {
+        settingsBack_();
+        dirty_ = true;
+        return;
+    }
+    if (save_btn.contains(x, y)) {
+        settingsSave_(now_ms);
+        dirty_ = true;
+    }
+}
+
+void ui::UiController::touchBounds_(int16_t x, int16_t y, uint32_t now_ms) noexcept
+{
+    // Slightly higher to avoid bottom-edge clipping on the round display.
+    const Rect back_btn{ 18, 186, 64, 30 };
+    const Rect action_btn{ 90, 186, 132, 30 };
+    if (action_btn.contains(x, y)) {
+        bounds_focus_ = BoundsFocus::Action;
+        onClick_(now_ms);
+        return;
+    }
+    if (back_btn.contains(x, y)) {
+        bounds_focus_ = BoundsFocus::Back;
+        onClick_(now_ms);
+    }
+}
+
+void ui::UiController::touchDiagnostics_(int16_t x, int16_t y, uint32_t now_ms) noexcept
+{
+    // Tapping the title starts (or aborts) a render A/B run; the headline
+    // and histogram show its result until the next RESET.
+    const Rect title_band{ 84, 8, 120, 24 };
+    if (title_band.contains(x, y)) {
+        abStart_(now_ms);
+        return;
+    }
+    const Rect reset_btn{ 44, 196, 72, 30 };
+    const Rect perf_btn{ 124, 196, 72, 30 };
+    if (reset_btn.contains(x, y)) {
+        espnow::ResetLinkStats();
+        perfReset_();
+        latencyReset_();
+        queue_stats::Reset();
+        logf_(now_ms, "UI: link stats reset");
+        dirty_ = true;
+        return;
+    }
+    if (perf_btn.contains(x, y)) {
+        // Cycle the observers: micro HUD first (cheap enough to leave on
+        // for a whole session), full strip second. Each press also dumps
+        // the accumulated stats to the serial log for offline comparison.
+        if (!hud_overlay_ && !perf_overlay_) {
+            hud_overlay_ = true;
+        } else if (hud_overlay_) {
+            hud_overlay_ = false;
+            freeHudSprite_();
+            perf_overlay_ = true;
+        } else {
+            perf_overlay_ = false;
         }
-        if (back_btn.contains(x, y)) {
-            bounds_focus_ = BoundsFocus::Back;
-            onClick_(now_ms);
-            return;
+        perfDump_();
+        logf_(now_ms, "UI: perf view %s",
+              hud_overlay_ ? "hud" : (perf_overlay_ ? "strip" : "off"));
+        dirty_ = true;
+    }
+}
+
+void ui::UiController::touchHistory_(int16_t x, int16_t y, uint32_t now_ms) noexcept
+{
+    // Tap the title band to flip between stored runs and the settings
+    // audit trail; both lists share the scroll and dump affordances.
+    const Rect title_band{ 84, 8, 120, 30 };
+    if (title_band.contains(x, y)) {
+        history_show_audit_ = !history_show_audit_;
+        history_scroll_ = 0;
+        logf_(now_ms, "UI: history shows %s",
+              history_show_audit_ ? "config changes" : "runs");
+        dirty_ = true;
+        return;
+    }
+    const Rect dump_btn{ 84, 196, 72, 30 };
+    if (dump_btn.contains(x, y)) {
+        if (history_show_audit_) {
+            audit::DumpSerial();
+            logf_(now_ms, "UI: audit trail dumped to serial");
+        } else {
+            run_db::DumpSerial();
+            logf_(now_ms, "UI: run history dumped to serial");
         }
+        dirty_ = true;
     }
+}
 
-    if (page_ == Page::LiveCounter) {
-        const Rect btn{ 40, 160, static_cast<int16_t>(240 - 80), 50 };
-        if (btn.contains(x, y)) {
-            onClick_(now_ms);
-            return;
+void ui::UiController::touchLive_(int16_t x, int16_t y, uint32_t now_ms) noexcept
+{
+    const Rect btn{ 40, 160, static_cast<int16_t>(240 - 80), 50 };
+    if (btn.contains(x, y)) {
+        onClick_(now_ms);
+    }
+}
+
+void ui::UiController::touchTerminal_(int16_t x, int16_t y, uint32_t now_ms) noexcept
+{
+    // Tap top bar to toggle encoder scroll mode.
+    const Rect top{ 0, 0, static_cast<int16_t>(240), 50 };
+    if (top.contains(x, y)) {
+        onClick_(now_ms);
+    }
+}
+
+void ui::UiController::onTouchDrag_(int16_t delta_y, uint32_t now_ms) noexcept
+{
+    HOT_ASSERT(static_cast<size_t>(page_) < static_cast<size_t>(Page::Count));
+    const InputRoute& route = kRoutes_[static_cast<size_t>(page_)];
+    if (route.touch_drag != nullptr) {
+        (this->*route.touch_drag)(delta_y, now_ms);
+    }
+}
+
+void ui::UiController::dragTerminal_(int16_t delta_y, uint32_t now_ms) noexcept
+{
+    (void)now_ms;
+    // Drag up (negative delta_y) should scroll up (older logs).
+    const int lines = (-delta_y) / 12;
+    if (lines != 0) {
+        constexpr int16_t log_top = 38;
+        constexpr int16_t log_bottom = 240 - 28;
+        constexpr int16_t line_h = 14;
+        const int max_lines = (log_bottom - log_top) / line_h;
+        const int max_scroll = std::max(0, static_cast<int>(terminalHistoryCount_()) - max_lines);
+
+        const int desired = scroll_lines_ + lines;
+        if (desired < 0) {
+            scroll_lines_ = 0;
+            terminal_overscroll_px_ = std::max(terminal_overscroll_px_, 8.0f);
+        } else if (desired > max_scroll) {
+            scroll_lines_ = max_scroll;
+            terminal_overscroll_px_ = std::min(terminal_overscroll_px_, -8.0f);
+        } else {
+            scroll_lines_ = desired;
         }
+        markDirty_(0, 38, 240, 202);
     }
+}
 
-    if (page_ == Page::Terminal) {
-        // Tap top bar to toggle encoder scroll mode.
-        const Rect top{ 0, 0, static_cast<int16_t>(240), 50 };
-        if (top.contains(x, y)) {
-            onClick_(now_ms);
+void ui::UiController::dragSettings_(int16_t delta_y, uint32_t now_ms) noexcept
+{
+    (void)now_ms;
+    // Scroll settings list
+    settings_scroll_offset_ -= delta_y / 4;
+    settings_scroll_offset_ = std::max(0, std::min(settings_scroll_offset_, 7 * kSettingsItemHeight_));
+    dirty_ = true;
+}
+
+void ui::UiController::serviceTouchInertia_(uint32_t now_ms) noexcept
+{
+    if (inertia_px_s_ == 0.0f) {
+        return;
+    }
+    // Momentum only makes sense on the scrolling pages.
+    if (page_ != Page::Terminal && page_ != Page::Settings) {
+        inertia_px_s_ = 0.0f;
+        return;
+    }
+
+    const uint32_t dt_ms = now_ms - last_inertia_ms_;
+    if (dt_ms == 0) {
+        return;
+    }
+    last_inertia_ms_ = now_ms;
+
+    // Integrate the coasting velocity and feed whole pixels through the
+    // same drag path a finger would use; the fractional remainder carries
+    // over so slow tails do not stall between frames.
+    inertia_carry_px_ += inertia_px_s_ * static_cast<float>(dt_ms) / 1000.0f;
+    const int16_t dy = static_cast<int16_t>(inertia_carry_px_);
+    if (dy != 0) {
+        inertia_carry_px_ -= static_cast<float>(dy);
+        const int before_scroll = scroll_lines_;
+        const int before_settings = settings_scroll_offset_;
+        onTouchDrag_(dy, now_ms);
+        // Hitting either end of the list absorbs the remaining momentum;
+        // on the Terminal page the overscroll spring takes over from here.
+        if (page_ == Page::Terminal && std::abs(dy) >= 12 && scroll_lines_ == before_scroll) {
+            inertia_px_s_ = 0.0f;
+            return;
+        }
+        if (page_ == Page::Settings && std::abs(dy) >= 4 &&
+            settings_scroll_offset_ == before_settings) {
+            inertia_px_s_ = 0.0f;
             return;
         }
     }
+
+    // Friction: exponential-style decay scaled by elapsed time, with a
+    // floor so the tail end snaps to rest instead of creeping.
+    inertia_px_s_ *= std::max(0.0f, 1.0f - static_cast<float>(dt_ms) * kInertiaFriction);
+    if (std::fabs(inertia_px_s_) < 40.0f) {
+        inertia_px_s_ = 0.0f;
+    }
 }
 
-void ui::UiController::onTouchDrag_(int16_t delta_y, uint32_t now_ms) noexcept
+void ui::UiController::onTouchLongPress_(int16_t x, int16_t y, uint32_t now_ms) noexcept
 {
-    (void)now_ms;
-    
+    (void)x;
+    (void)y;
+
+    // Terminal: a held touch jumps back to the live tail of the log — the
+    // deep-scrollback counterpart of dragging all the way down.
     if (page_ == Page::Terminal) {
-        // Drag up (negative delta_y) should scroll up (older logs).
-        const int lines = (-delta_y) / 12;
-        if (lines != 0) {
-            constexpr int16_t log_top = 38;
-            constexpr int16_t log_bottom = 240 - 28;
-            constexpr int16_t line_h = 14;
-            const int max_lines = (log_bottom - log_top) / line_h;
-            const int max_scroll = std::max(0, static_cast<int>(log_count_) - max_lines);
-
-            const int desired = scroll_lines_ + lines;
-            if (desired < 0) {
-                scroll_lines_ = 0;
-                terminal_overscroll_px_ = std::max(terminal_overscroll_px_, 8.0f);
-            } else if (desired > max_scroll) {
-                scroll_lines_ = max_scroll;
-                terminal_overscroll_px_ = std::min(terminal_overscroll_px_, -8.0f);
-            } else {
-                scroll_lines_ = desired;
-            }
-            dirty_ = true;
+        if (scroll_lines_ != 0) {
+            scroll_lines_ = 0;
+            terminal_overscroll_px_ = 0.0f;
+            playBeep_(2);
+            logf_(now_ms, "UI: jump to newest");
+            markDirty_(0, 38, 240, 202);
         }
+        return;
     }
-    
-    if (page_ == Page::Settings) {
-        // Scroll settings list
-        settings_scroll_offset_ -= delta_y / 4;
-        settings_scroll_offset_ = std::max(0, std::min(settings_scroll_offset_, 7 * kSettingsItemHeight_));
-        dirty_ = true;
-    }
+    // Other pages currently have no long-press action.
 }
 
 void ui::UiController::onSwipe_(int16_t dx, int16_t dy, uint32_t now_ms) noexcept
@@ -1162,7 +5010,7 @@ void ui::UiController::enterSettings_() noexcept
         return;
     }
     edit_settings_ = *settings_;
-    original_settings_ = edit_settings_;
+    resetSettingsBaseline_();
     in_settings_edit_ = true;
     settings_dirty_ = false;
     settings_index_ = 0;
@@ -1183,6 +5031,9 @@ void ui::UiController::enterSettings_() noexcept
     settings_editor_index_ = 0;
     settings_editor_type_ = SettingsEditorValueType::None;
 
+    bounds_tune_active_ = false;
+    bounds_tune_editing_ = false;
+
     // Reset animation state so the list starts stable.
     settings_anim_offset_ = 0.0f;
     settings_target_offset_ = 0.0f;
@@ -1191,18 +5042,22 @@ void ui::UiController::enterSettings_() noexcept
 int ui::UiController::getSettingsItemCount_() const noexcept
 {
     switch (settings_category_) {
-        case SettingsCategory::Main: return 4;
+        case SettingsCategory::Main: return 5;
         case SettingsCategory::FatigueTest: return 5;     // Back, Cycles, VMAX, AMAX, Dwell
-        case SettingsCategory::BoundsFinding: return 7;   // Back + 6 items
+        case SettingsCategory::BoundsFinding: return 8;   // Back + 6 items + Tune All
         case SettingsCategory::UI: return 2;              // Back, Brightness
-        default: return 4;
+        case SettingsCategory::Profiles:                  // Back + profile slots
+            return 1 + static_cast<int>(SettingsStore::kProfileSlots);
+        default: return 5;
     }
 }
 
 void ui::UiController::settingsBack_() noexcept
 {
-    // If there are pending changes, confirm before leaving Settings.
-    if (settings_dirty_ && settings_popup_mode_ == SettingsPopupMode::None) {
+    // If there are pending changes, confirm before leaving Settings. The
+    // schema comparison catches values edited away and back again, so no
+    // popup appears when there is no net change to send.
+    if (settings_dirty_ && settingsHaveChanges_() && settings_popup_mode_ == SettingsPopupMode::None) {
         settings_popup_mode_ = SettingsPopupMode::SaveConfirm;
         settings_popup_selection_ = 0; // default SEND
         dirty_ = true;
@@ -1225,6 +5080,8 @@ void ui::UiController::settingsBack_() noexcept
 
     settings_value_editor_active_ = false;
     settings_editor_type_ = SettingsEditorValueType::None;
+    bounds_tune_active_ = false;
+    bounds_tune_editing_ = false;
     page_ = Page::Landing;
 }
 
@@ -1233,9 +5090,23 @@ void ui::UiController::settingsSave_(uint32_t now_ms) noexcept
     if (settings_ == nullptr) {
         return;
     }
+    TRACE_SCOPE("settingsSave");
+    // Audit before the overwrite: *settings_ still holds the values the
+    // save replaces. Recording is table-driven off the delta schema, so a
+    // save costs one compact flash record per changed field.
+    const auto cfg_before = fatigue_proto::BuildConfigPayload(*settings_);
     *settings_ = edit_settings_;
-    (void)SettingsStore::Save(*settings_);
-    logf_(now_ms, "UI: settings saved");
+    resetSettingsBaseline_();
+    SettingsStore::SaveAsync(*settings_);
+    const size_t audited = audit::NoteConfigChange(
+        cfg_before, fatigue_proto::BuildConfigPayload(*settings_), now_ms);
+    playBeep_(3);
+    if (audited > 0) {
+        logf_(now_ms, "UI: settings saved (%u change%s audited)",
+              static_cast<unsigned>(audited), audited == 1 ? "" : "s");
+    } else {
+        logf_(now_ms, "UI: settings saved");
+    }
 
     // Apply brightness setting
     M5.Display.setBrightness(settings_->ui.brightness);
@@ -1243,8 +5114,7 @@ void ui::UiController::settingsSave_(uint32_t now_ms) noexcept
     // Push config to test unit (only meaningful while connected).
     if (conn_status_ == ConnStatus::Connected) {
         const auto payload = fatigue_proto::BuildConfigPayload(*settings_);
-        (void)espnow::SendConfigSet(fatigue_proto::DEVICE_ID_FATIGUE_TESTER_, &payload, sizeof(payload));
-        logf_(now_ms, "TX: ConfigSet dev=%u", fatigue_proto::DEVICE_ID_FATIGUE_TESTER_);
+        (void)sendConfigUpdateActive_(payload, now_ms);
     } else {
         logf_(now_ms, "TX: ConfigSet skipped (not connected)");
     }
@@ -1255,15 +5125,177 @@ void ui::UiController::settingsSave_(uint32_t now_ms) noexcept
     settings_popup_mode_ = SettingsPopupMode::None;
     settings_value_editor_active_ = false;
     settings_editor_type_ = SettingsEditorValueType::None;
+    bounds_tune_active_ = false;
+    bounds_tune_editing_ = false;
     page_ = Page::Landing;
 }
 
+void ui::UiController::loadProfiles_() noexcept
+{
+    if (profiles_loaded_) {
+        return;
+    }
+    for (uint8_t i = 0; i < SettingsStore::kProfileSlots; ++i) {
+        profile_used_[i] = SettingsStore::LoadProfile(i, profiles_[i]);
+    }
+    profiles_loaded_ = true;
+}
+
+void ui::UiController::applyProfileSlot_(int slot, uint32_t now_ms) noexcept
+{
+    edit_settings_.test_unit = profiles_[slot].test_unit;
+    recomputeSettingsDirtyBits_();
+    settings_dirty_ = true;
+    uint8_t mac[6];
+    if (activeUnitMac_(mac)) {
+        SettingsStore::NoteProfileForPeer(mac, static_cast<uint8_t>(slot));
+    }
+    if (profile_offer_slot_ == slot) {
+        profile_offer_slot_ = -1;  // Offer consumed.
+    }
+    logf_(now_ms, "UI: profile '%s' applied", profiles_[slot].name);
+    // Persist and push in one step; the config sync engine diffs against
+    // the unit's known config, so recalling a near-identical profile
+    // travels as a few-byte ConfigDelta.
+    settingsSave_(now_ms);
+}
+
+void ui::UiController::saveProfileSlot_(int slot, uint32_t now_ms) noexcept
+{
+    SettingsProfile p{};
+    // Seed the name from the active unit's label: fixtures pair with
+    // units in practice, and the dial has no keyboard. Bench setups
+    // without a named unit fall back to the slot number.
+    uint8_t mac[6];
+    const bool have_mac = activeUnitMac_(mac);
+    const char* label = have_mac ? espnow::PeerLabel(espnow::LookupPeerIndex(mac)) : "";
+    if (label[0] != '\0') {
+        snprintf(p.name, sizeof(p.name), "%s", label);
+    } else {
+        snprintf(p.name, sizeof(p.name), "Profile %d", slot + 1);
+    }
+    p.test_unit = edit_settings_.test_unit;
+
+    if (!SettingsStore::SaveProfile(static_cast<uint8_t>(slot), p)) {
+        logfAt_(LogLevel::Warn, now_ms, "UI: profile save failed");
+        playBeep_(1);
+        return;
+    }
+    profiles_[slot] = p;
+    profile_used_[slot] = true;
+    if (have_mac) {
+        SettingsStore::NoteProfileForPeer(mac, static_cast<uint8_t>(slot));
+    }
+    playBeep_(3);
+    logf_(now_ms, "UI: profile '%s' saved (slot %d)", p.name, slot + 1);
+}
+
+void ui::UiController::offerProfileForActive_(uint32_t now_ms) noexcept
+{
+    profile_offer_slot_ = -1;
+    uint8_t mac[6];
+    if (!activeUnitMac_(mac)) {
+        return;
+    }
+    const int8_t slot = SettingsStore::ProfileForPeer(mac);
+    if (slot < 0) {
+        return;
+    }
+    loadProfiles_();
+    if (!profile_used_[slot]) {
+        return;  // Association outlived the profile (slot overwritten empty).
+    }
+    // Already running this profile's parameters: nothing to offer.
+    if (settings_ != nullptr &&
+        std::memcmp(&profiles_[slot].test_unit, &settings_->test_unit,
+                    sizeof(TestUnitSettings)) == 0) {
+        return;
+    }
+    profile_offer_slot_ = slot;
+    logf_(now_ms, "Profile '%s' matches this unit - Settings > Profiles",
+          profiles_[slot].name);
+}
+
+void ui::UiController::detentFeedbackEntry_(EC11Encoder::Direction direction,
+                                            void* ctx) noexcept
+{
+    // Encoder-driver-task context: enqueue the tone and return. The beep
+    // task outranks the render task, so the click plays even mid-frame;
+    // without the queue (degraded boot) the detent stays silent rather
+    // than touching the speaker from this task.
+    auto* self = static_cast<UiController*>(ctx);
+    if (self->beep_queue_ != nullptr) {
+        const int type = (direction == EC11Encoder::Direction::CW) ? 1 : 0;
+        (void)xQueueSend(self->beep_queue_, &type, 0);
+    }
+}
+
+void ui::UiController::publishEstopTarget_() noexcept
+{
+    // Mirror the active unit's MAC where the emergency path can read it
+    // without ui_mutex_. Called from Tick whenever unit state may have
+    // changed; the compare keeps the critical section off the common case.
+    uint8_t mac[6] = {};
+    const bool valid = activeUnitMac_(mac);
+    if (valid == estop_target_valid_ &&
+        (!valid || std::memcmp(mac, estop_mac_, 6) == 0)) {
+        return;
+    }
+    taskENTER_CRITICAL(&estop_mux_);
+    std::memcpy(estop_mac_, mac, 6);
+    estop_target_valid_ = valid;
+    taskEXIT_CRITICAL(&estop_mux_);
+}
+
+void ui::UiController::emergencyStopEntry_(void* ctx) noexcept
+{
+    // Encoder-driver-task context. Everything on this path is bounded:
+    // a spinlocked 6-byte copy, then the protocol layer's critical send
+    // (pool staging under short mutexes). The command is journaled, so a
+    // downed link replays it on reconnect; the UI catches up from
+    // estop_fired_ on its next tick.
+    auto* self = static_cast<UiController*>(ctx);
+    uint8_t mac[6];
+    taskENTER_CRITICAL(&self->estop_mux_);
+    const bool valid = self->estop_target_valid_;
+    std::memcpy(mac, self->estop_mac_, 6);
+    taskEXIT_CRITICAL(&self->estop_mux_);
+    if (valid) {
+        (void)espnow::SendCriticalCommandTo(
+            mac, fatigue_proto::DEVICE_ID_FATIGUE_TESTER_,
+            static_cast<uint8_t>(fatigue_proto::CommandId::Stop));
+    } else {
+        // No interned target yet (early boot): fall back to the broadcast
+        // path, same as sendCommandActive_ would.
+        (void)espnow::SendCommand(fatigue_proto::DEVICE_ID_FATIGUE_TESTER_,
+                                  static_cast<uint8_t>(fatigue_proto::CommandId::Stop),
+                                  nullptr, 0);
+    }
+    self->estop_fired_.fetch_add(1, std::memory_order_relaxed);
+}
+
 void ui::UiController::playBeep_(int type) noexcept
+{
+    // Hand the pattern to the player task; the input path never waits on
+    // the speaker. A full queue just drops the beep (feedback for an input
+    // the user is already spamming).
+    if (beep_queue_ != nullptr) {
+        if (xQueueSend(beep_queue_, &type, 0) != pdTRUE) {
+            queue_stats::NoteDrop(qs_beep_);
+        }
+        return;
+    }
+    playBeepPattern_(type, false);
+}
+
+void ui::UiController::playBeepPattern_(int type, bool allow_sleep) noexcept
 {
     // Buzzer feedback matching M5Dial factory demo
     // type 0: CCW rotation (lower pitch)
     // type 1: CW rotation (higher pitch)
     // type 2: Button press
+    // type 3: Confirm (rising two-tone)
+    // type 4: Error (low double buzz)
     switch (type) {
         case 0:  // CCW
             M5.Speaker.tone(6000, 20);
@@ -1274,11 +5306,37 @@ void ui::UiController::playBeep_(int type) noexcept
         case 2:  // Button press
             M5.Speaker.tone(2000, 20);
             break;
+        case 3:  // Confirm: the player task sleeps between steps; the inline
+                 // fallback plays only the first so it never blocks input.
+            M5.Speaker.tone(3000, 40);
+            if (allow_sleep) {
+                vTaskDelay(pdMS_TO_TICKS(50));
+                M5.Speaker.tone(4500, 60);
+            }
+            break;
+        case 4:  // Error
+            M5.Speaker.tone(800, 60);
+            if (allow_sleep) {
+                vTaskDelay(pdMS_TO_TICKS(80));
+                M5.Speaker.tone(800, 90);
+            }
+            break;
         default:
             break;
     }
 }
 
+void ui::UiController::beepTaskEntry_(void* arg) noexcept
+{
+    QueueHandle_t queue = static_cast<QueueHandle_t>(arg);
+    while (true) {
+        int type = 0;
+        if (xQueueReceive(queue, &type, portMAX_DELAY) == pdTRUE) {
+            playBeepPattern_(type, true);
+        }
+    }
+}
+
 bool ui::UiController::settingsEditorHasChange_() const noexcept
 {
     switch (settings_editor_type_) {
@@ -1303,69 +5361,122 @@ void ui::UiController::discardSettingsEditorValue_() noexcept
     }
 }
 
+const ui::UiController::SettingsFieldDesc*
+ui::UiController::findSettingsField_(SettingsCategory category, int index) noexcept
+{
+    for (size_t i = 0; i < kSettingsFieldCount_; ++i) {
+        if (kSettingsFields_[i].category == category &&
+            kSettingsFields_[i].index == static_cast<uint8_t>(index)) {
+            return &kSettingsFields_[i];
+        }
+    }
+    return nullptr;
+}
+
+size_t ui::UiController::settingsFieldSize_(SettingsEditorValueType type) noexcept
+{
+    switch (type) {
+        case SettingsEditorValueType::U32:
+        case SettingsEditorValueType::F32:
+            return 4;
+        case SettingsEditorValueType::Bool:
+        case SettingsEditorValueType::U8:
+        case SettingsEditorValueType::I8:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+bool ui::UiController::settingsHaveChanges_() const noexcept
+{
+    // The dirty mask is maintained at every write (see writeSettingsField_),
+    // so the per-consult struct scan is gone; a value edited away and back
+    // again has cleared its own bit.
+    return settings_dirty_bits_ != 0;
+}
+
+void ui::UiController::writeSettingsField_(const SettingsFieldDesc& field,
+                                           const void* value) noexcept
+{
+    const size_t n = settingsFieldSize_(field.type);
+    uint8_t* slot = reinterpret_cast<uint8_t*>(&edit_settings_) + field.offset;
+    std::memcpy(slot, value, n);
+    const uint8_t* base =
+        reinterpret_cast<const uint8_t*>(&original_settings_) + field.offset;
+    const uint16_t bit = static_cast<uint16_t>(1U << (&field - kSettingsFields_));
+    if (std::memcmp(slot, base, n) != 0) {
+        settings_dirty_bits_ |= bit;
+    } else {
+        settings_dirty_bits_ &= static_cast<uint16_t>(~bit);
+    }
+}
+
+void ui::UiController::resetSettingsBaseline_() noexcept
+{
+    // New comparison snapshot: nothing is dirty against it by definition.
+    original_settings_ = edit_settings_;
+    settings_dirty_bits_ = 0;
+}
+
+void ui::UiController::recomputeSettingsDirtyBits_() noexcept
+{
+    // One schema pass after a bulk write; the per-write path never calls
+    // this.
+    const uint8_t* a = reinterpret_cast<const uint8_t*>(&edit_settings_);
+    const uint8_t* b = reinterpret_cast<const uint8_t*>(&original_settings_);
+    uint16_t bits = 0;
+    for (size_t i = 0; i < kSettingsFieldCount_; ++i) {
+        const SettingsFieldDesc& f = kSettingsFields_[i];
+        if (std::memcmp(a + f.offset, b + f.offset, settingsFieldSize_(f.type)) != 0) {
+            bits |= static_cast<uint16_t>(1U << i);
+        }
+    }
+    settings_dirty_bits_ = bits;
+}
+
 void ui::UiController::applySettingsEditorValue_() noexcept
 {
-    // Apply the editor's "new" value back into edit_settings_ for the active target.
-    switch (settings_editor_category_) {
-        case SettingsCategory::FatigueTest:
-            if (settings_editor_type_ == SettingsEditorValueType::U32) {
-                if (settings_editor_index_ == 1) {
-                    edit_settings_.test_unit.cycle_amount = settings_editor_u32_new_;
-                    settings_dirty_ = true;
-                } else if (settings_editor_index_ == 4) {
-                    // Dwell time (edited in 0.1s increments, stored as ms) - index 4 in new layout
-                    edit_settings_.test_unit.dwell_time_ms = settings_editor_u32_new_ * 100u;
-                    settings_dirty_ = true;
-                }
-            } else if (settings_editor_type_ == SettingsEditorValueType::F32) {
-                if (settings_editor_index_ == 2) {
-                    // VMAX (RPM) - index 2 in new layout
-                    edit_settings_.test_unit.oscillation_vmax_rpm = std::max(5.0f, settings_editor_f32_new_);
-                    settings_dirty_ = true;
-                } else if (settings_editor_index_ == 3) {
-                    // AMAX (rev/s²) - index 3 in new layout
-                    edit_settings_.test_unit.oscillation_amax_rev_s2 = std::max(0.5f, settings_editor_f32_new_);
-                    settings_dirty_ = true;
-                }
-            }
+    // Schema-driven write-back into edit_settings_ with per-field clamping.
+    const SettingsFieldDesc* field =
+        findSettingsField_(settings_editor_category_, settings_editor_index_);
+    if (field == nullptr || field->type != settings_editor_type_) {
+        return;
+    }
+    switch (field->type) {
+        case SettingsEditorValueType::U32: {
+            // Scale back from editing units (dwell edits 0.1 s, stores ms).
+            const uint32_t div = std::max<uint32_t>(1, field->u32_unit_div);
+            const uint64_t scaled = static_cast<uint64_t>(settings_editor_u32_new_) * div;
+            const uint32_t v = (scaled > UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(scaled);
+            writeSettingsField_(*field, &v);
             break;
-
-        case SettingsCategory::BoundsFinding:
-            if (settings_editor_index_ == 1 && settings_editor_type_ == SettingsEditorValueType::Bool) {
-                edit_settings_.test_unit.bounds_method_stallguard = settings_editor_bool_new_;
-                settings_dirty_ = true;
-            } else if (settings_editor_index_ == 4 && settings_editor_type_ == SettingsEditorValueType::I8) {
-                edit_settings_.test_unit.stallguard_sgt = settings_editor_i8_new_;
-                settings_dirty_ = true;
-            } else if (settings_editor_type_ == SettingsEditorValueType::F32) {
-                if (settings_editor_index_ == 2) {
-                    edit_settings_.test_unit.bounds_search_velocity_rpm = std::max(0.0f, settings_editor_f32_new_);
-                    settings_dirty_ = true;
-                } else if (settings_editor_index_ == 3) {
-                    edit_settings_.test_unit.stallguard_min_velocity_rpm = std::max(0.0f, settings_editor_f32_new_);
-                    settings_dirty_ = true;
-                } else if (settings_editor_index_ == 5) {
-                    edit_settings_.test_unit.stall_detection_current_factor = std::max(0.0f, settings_editor_f32_new_);
-                    settings_dirty_ = true;
-                } else if (settings_editor_index_ == 6) {
-                    edit_settings_.test_unit.bounds_search_accel_rev_s2 = std::max(0.0f, settings_editor_f32_new_);
-                    settings_dirty_ = true;
-                }
-            }
+        }
+        case SettingsEditorValueType::F32: {
+            const float v = std::max(field->min_value, settings_editor_f32_new_);
+            writeSettingsField_(*field, &v);
             break;
-
-        case SettingsCategory::UI:
-            if (settings_editor_index_ == 1 && settings_editor_type_ == SettingsEditorValueType::U8) {
-                edit_settings_.ui.brightness = settings_editor_u8_new_;
-                // Preview immediately
-                M5.Display.setBrightness(edit_settings_.ui.brightness);
-                settings_dirty_ = true;
+        }
+        case SettingsEditorValueType::Bool: {
+            const bool v = settings_editor_bool_new_;
+            writeSettingsField_(*field, &v);
+            break;
+        }
+        case SettingsEditorValueType::U8:
+            writeSettingsField_(*field, &settings_editor_u8_new_);
+            // Brightness previews immediately.
+            if (field->offset == offsetof(Settings, ui.brightness)) {
+                M5.Display.setBrightness(settings_editor_u8_new_);
             }
             break;
-
-        case SettingsCategory::Main:
+        case SettingsEditorValueType::I8:
+            writeSettingsField_(*field, &settings_editor_i8_new_);
             break;
+        default:
+            return;
     }
+    settings_dirty_ = true;
+    recordSettingsMru_(field);
 }
 
 void ui::UiController::beginSettingsValueEditor_() noexcept
@@ -1374,95 +5485,260 @@ void ui::UiController::beginSettingsValueEditor_() noexcept
     settings_popup_mode_ = SettingsPopupMode::None;
     settings_popup_selection_ = 0;
 
+    // Fresh velocity state per edit session.
+    edit_last_detent_ms_ = 0;
+    edit_velocity_dps_ = 0.0f;
+
     settings_editor_category_ = settings_category_;
     settings_editor_index_ = settings_index_;
     settings_editor_type_ = SettingsEditorValueType::None;
 
-    auto round1 = [](float v) -> float {
-        return std::round(v * 10.0f) / 10.0f;
-    };
-
-    // Snapshot the current value for the selected item.
-    // PROTOCOL V2: Menu layout is: 1=Cycles, 2=VMAX, 3=AMAX, 4=Dwell
-    switch (settings_category_) {
-        case SettingsCategory::FatigueTest:
-            if (settings_index_ == 1) {
-                // Cycles (U32)
-                settings_editor_type_ = SettingsEditorValueType::U32;
-                settings_editor_u32_old_ = edit_settings_.test_unit.cycle_amount;
-                settings_editor_u32_new_ = settings_editor_u32_old_;
-                settings_editor_u32_step_ = 10;  // Start with step of 10
-            } else if (settings_index_ == 2) {
-                // VMAX (F32 RPM)
-                settings_editor_type_ = SettingsEditorValueType::F32;
-                settings_editor_f32_old_ = round1(edit_settings_.test_unit.oscillation_vmax_rpm);
-                settings_editor_f32_new_ = settings_editor_f32_old_;
-                initSettingsEditorStep_();
-            } else if (settings_index_ == 3) {
-                // AMAX (F32 rev/s²)
-                settings_editor_type_ = SettingsEditorValueType::F32;
-                settings_editor_f32_old_ = round1(edit_settings_.test_unit.oscillation_amax_rev_s2);
-                settings_editor_f32_new_ = settings_editor_f32_old_;
-                initSettingsEditorStep_();
-            } else if (settings_index_ == 4) {
-                // Dwell (edited in 0.1s increments, stored as ms)
-                settings_editor_type_ = SettingsEditorValueType::U32;
-                // Represent dwell in tenths of a second (0.1s units)
-                settings_editor_u32_old_ = (edit_settings_.test_unit.dwell_time_ms + 50u) / 100u;
-                settings_editor_u32_new_ = settings_editor_u32_old_;
-                settings_editor_u32_step_ = 1;  // Start with 0.1s increments
-            }
+    // Schema-driven snapshot: the field table supplies location, type and
+    // editing granularity for the selected item. Non-editable rows (Main
+    // menu, "< Back") have no table entry and leave the editor type None.
+    const SettingsFieldDesc* field = findSettingsField_(settings_category_, settings_index_);
+    if (field == nullptr) {
+        return;
+    }
+    const uint8_t* slot = reinterpret_cast<const uint8_t*>(&edit_settings_) + field->offset;
+    settings_editor_type_ = field->type;
+    switch (field->type) {
+        case SettingsEditorValueType::U32: {
+            uint32_t v = 0;
+            std::memcpy(&v, slot, sizeof(v));
+            // Round into editing units (dwell shows 0.1 s steps for its ms value).
+            const uint32_t div = std::max<uint32_t>(1, field->u32_unit_div);
+            settings_editor_u32_old_ = (v + div / 2) / div;
+            settings_editor_u32_new_ = settings_editor_u32_old_;
+            settings_editor_u32_step_ = field->u32_step;
             break;
-
-        case SettingsCategory::BoundsFinding:
-            if (settings_index_ == 1) {
-                settings_editor_type_ = SettingsEditorValueType::Bool;
-                settings_editor_bool_old_ = edit_settings_.test_unit.bounds_method_stallguard;
-                settings_editor_bool_new_ = settings_editor_bool_old_;
-            } else if (settings_index_ == 4) {
-                settings_editor_type_ = SettingsEditorValueType::I8;
-                settings_editor_i8_old_ = edit_settings_.test_unit.stallguard_sgt;
-                settings_editor_i8_new_ = settings_editor_i8_old_;
-            } else {
-                settings_editor_type_ = SettingsEditorValueType::F32;
-                if (settings_index_ == 2) {
-                    settings_editor_f32_old_ = round1(edit_settings_.test_unit.bounds_search_velocity_rpm);
-                } else if (settings_index_ == 3) {
-                    settings_editor_f32_old_ = round1(edit_settings_.test_unit.stallguard_min_velocity_rpm);
-                } else if (settings_index_ == 5) {
-                    settings_editor_f32_old_ = round1(edit_settings_.test_unit.stall_detection_current_factor);
-                } else if (settings_index_ == 6) {
-                    settings_editor_f32_old_ = round1(edit_settings_.test_unit.bounds_search_accel_rev_s2);
-                } else {
-                    settings_editor_f32_old_ = 0.0f;
-                }
-                settings_editor_f32_new_ = settings_editor_f32_old_;
-                initSettingsEditorStep_();
-            }
+        }
+        case SettingsEditorValueType::F32: {
+            float v = 0.0f;
+            std::memcpy(&v, slot, sizeof(v));
+            settings_editor_f32_old_ = std::round(v * 10.0f) / 10.0f;
+            settings_editor_f32_new_ = settings_editor_f32_old_;
+            initSettingsEditorStep_();
+            break;
+        }
+        case SettingsEditorValueType::Bool: {
+            bool v = false;
+            std::memcpy(&v, slot, sizeof(v));
+            settings_editor_bool_old_ = v;
+            settings_editor_bool_new_ = v;
             break;
+        }
+        case SettingsEditorValueType::U8:
+            std::memcpy(&settings_editor_u8_old_, slot, 1);
+            settings_editor_u8_new_ = settings_editor_u8_old_;
+            break;
+        case SettingsEditorValueType::I8:
+            std::memcpy(&settings_editor_i8_old_, slot, 1);
+            settings_editor_i8_new_ = settings_editor_i8_old_;
+            break;
+        default:
+            break;
+    }
+}
 
-        case SettingsCategory::UI:
-            if (settings_index_ == 1) {
-                settings_editor_type_ = SettingsEditorValueType::U8;
-                settings_editor_u8_old_ = edit_settings_.ui.brightness;
-                settings_editor_u8_new_ = settings_editor_u8_old_;
+void ui::UiController::beginBoundsTuneEditor_() noexcept
+{
+    // Stage every bounds tuning field from the edit buffer; nothing touches
+    // edit_settings_ until APPLY, so CANCEL is a plain discard.
+    bounds_tune_active_ = true;
+    bounds_tune_editing_ = false;
+    bounds_tune_focus_ = 0;
+    settings_popup_mode_ = SettingsPopupMode::None;
+    settings_popup_selection_ = 0;
+
+    // Fresh velocity state per edit session (shared with the single editor).
+    edit_last_detent_ms_ = 0;
+    edit_velocity_dps_ = 0.0f;
+
+    const auto& tu = edit_settings_.test_unit;
+    bounds_tune_search_vel_ = std::round(tu.bounds_search_velocity_rpm * 10.0f) / 10.0f;
+    bounds_tune_sg_min_vel_ = std::round(tu.stallguard_min_velocity_rpm * 10.0f) / 10.0f;
+    bounds_tune_sgt_ = tu.stallguard_sgt;
+    bounds_tune_stall_factor_ = std::round(tu.stall_detection_current_factor * 10.0f) / 10.0f;
+    bounds_tune_search_accel_ = std::round(tu.bounds_search_accel_rev_s2 * 10.0f) / 10.0f;
+}
+
+const char* ui::UiController::boundsTuneValidate_() const noexcept
+{
+    // Set-level rules the per-field editors cannot enforce (they never see
+    // both sides of a coupling). Returns nullptr when the set is coherent.
+    if (bounds_tune_search_vel_ <= 0.0f) {
+        return "Search vel must be > 0";
+    }
+    if (bounds_tune_search_accel_ <= 0.0f) {
+        return "Search accel must be > 0";
+    }
+    if (bounds_tune_stall_factor_ <= 0.0f) {
+        return "Stall factor must be > 0";
+    }
+    // StallGuard is blind below its minimum velocity: searching slower than
+    // that would never detect the stop.
+    if (bounds_tune_sg_min_vel_ > bounds_tune_search_vel_) {
+        return "Search vel below SG min vel";
+    }
+    return nullptr;
+}
+
+void ui::UiController::handleBoundsTuneInput_(int delta, bool click, uint32_t now_ms) noexcept
+{
+    if (!bounds_tune_active_) {
+        return;
+    }
+
+    constexpr int kFocusApply = 5;
+    constexpr int kFocusCancel = 6;
+
+    if (delta != 0) {
+        if (!bounds_tune_editing_) {
+            bounds_tune_focus_ = std::clamp(bounds_tune_focus_ + delta, 0, kFocusCancel);
+            return;
+        }
+
+        // Adjust the focused field. Steps match the per-field editor
+        // granularity (rpm: 1, factor and accel: 0.1); fast spins still
+        // accelerate through the shared velocity engine.
+        const int multiplier = computeEditStepMultiplier_(now_ms);
+        const float fsteps = static_cast<float>(delta * multiplier);
+        switch (bounds_tune_focus_) {
+            case 0:
+                bounds_tune_search_vel_ =
+                    std::round(std::max(0.0f, bounds_tune_search_vel_ + fsteps * 1.0f) * 10.0f) / 10.0f;
+                break;
+            case 1:
+                bounds_tune_sg_min_vel_ =
+                    std::round(std::max(0.0f, bounds_tune_sg_min_vel_ + fsteps * 1.0f) * 10.0f) / 10.0f;
+                break;
+            case 2: {
+                // Same SGT ladder as the single-field editor: [-64, 63]
+                // plus 127 = "Default", one notch per detent.
+                auto next_sgt = [](int8_t current, int dir) -> int8_t {
+                    if (current == 127) {
+                        return (dir > 0) ? static_cast<int8_t>(-64) : static_cast<int8_t>(63);
+                    }
+                    const int next = static_cast<int>(current) + dir;
+                    if (next > 63) return 127;
+                    if (next < -64) return 127;
+                    return static_cast<int8_t>(next);
+                };
+                bounds_tune_sgt_ = next_sgt(bounds_tune_sgt_, (delta > 0) ? 1 : -1);
+                break;
             }
-            break;
+            case 3:
+                bounds_tune_stall_factor_ =
+                    std::round(std::max(0.0f, bounds_tune_stall_factor_ + fsteps * 0.1f) * 10.0f) / 10.0f;
+                break;
+            case 4:
+                bounds_tune_search_accel_ =
+                    std::round(std::max(0.0f, bounds_tune_search_accel_ + fsteps * 0.1f) * 10.0f) / 10.0f;
+                break;
+            default:
+                break;
+        }
+        return;
+    }
 
-        case SettingsCategory::Main:
-            // Should not happen (main items aren't editable), but keep it safe.
-            settings_editor_type_ = SettingsEditorValueType::None;
-            break;
+    if (!click) {
+        return;
+    }
+
+    // Field rows toggle between focus-move and value-adjust.
+    if (bounds_tune_focus_ < kFocusApply) {
+        playBeep_(2);
+        bounds_tune_editing_ = !bounds_tune_editing_;
+        if (bounds_tune_editing_) {
+            edit_last_detent_ms_ = 0;
+            edit_velocity_dps_ = 0.0f;
+        }
+        return;
+    }
+
+    if (bounds_tune_focus_ == kFocusApply) {
+        const char* warn = boundsTuneValidate_();
+        if (warn != nullptr) {
+            // Refuse to stage an incoherent set; the warning line on screen
+            // already names the rule being violated.
+            playBeep_(4);
+            logf_(now_ms, "UI: bounds set rejected (validation)");
+            return;
+        }
+
+        auto& tu = edit_settings_.test_unit;
+        const bool changed = (tu.bounds_search_velocity_rpm != bounds_tune_search_vel_) ||
+                             (tu.stallguard_min_velocity_rpm != bounds_tune_sg_min_vel_) ||
+                             (tu.stallguard_sgt != bounds_tune_sgt_) ||
+                             (tu.stall_detection_current_factor != bounds_tune_stall_factor_) ||
+                             (tu.bounds_search_accel_rev_s2 != bounds_tune_search_accel_);
+        tu.bounds_search_velocity_rpm = bounds_tune_search_vel_;
+        tu.stallguard_min_velocity_rpm = bounds_tune_sg_min_vel_;
+        tu.stallguard_sgt = bounds_tune_sgt_;
+        tu.stall_detection_current_factor = bounds_tune_stall_factor_;
+        tu.bounds_search_accel_rev_s2 = bounds_tune_search_accel_;
+        recomputeSettingsDirtyBits_();
+        if (changed) {
+            settings_dirty_ = true;
+        }
+
+        playBeep_(3);
+        logf_(now_ms, "UI: bounds set staged");
+        bounds_tune_active_ = false;
+        bounds_tune_editing_ = false;
+        return;
     }
+
+    // CANCEL: drop the staged values.
+    playBeep_(2);
+    bounds_tune_active_ = false;
+    bounds_tune_editing_ = false;
+}
+
+int ui::UiController::computeEditStepMultiplier_(uint32_t now_ms) noexcept
+{
+    // Press-and-rotate is the explicit coarse gear: a fixed 10x step,
+    // independent of spin speed. It also resets the velocity estimate so
+    // releasing the button drops straight back to fine adjustment.
+    if (chord_rotate_) {
+        edit_last_detent_ms_ = now_ms;
+        edit_velocity_dps_ = 0.0f;
+        return 10;
+    }
+
+    // Time since previous detent; a pause resets the velocity estimate so
+    // the first click after it is always a single step.
+    const uint32_t dt_ms = now_ms - edit_last_detent_ms_;
+    edit_last_detent_ms_ = now_ms;
+    if (dt_ms > kEditVelocityResetMs_) {
+        edit_velocity_dps_ = 0.0f;
+        return 1;
+    }
+
+    const float inst_dps = 1000.0f / static_cast<float>(std::max<uint32_t>(dt_ms, 1U));
+    // EWMA smoothing: one fast pair of clicks shouldn't jump decades.
+    edit_velocity_dps_ += 0.3f * (inst_dps - edit_velocity_dps_);
+
+    // Below ~5 detents/s every click is one step; past that the multiplier
+    // grows quadratically so a hard two-second spin traverses decades.
+    constexpr float base_dps = 5.0f;
+    if (edit_velocity_dps_ <= base_dps) {
+        return 1;
+    }
+    const float ratio = edit_velocity_dps_ / base_dps;
+    return static_cast<int>(std::min(ratio * ratio, 1000.0f));
 }
 
-void ui::UiController::handleSettingsValueEdit_(int delta) noexcept
+void ui::UiController::handleSettingsValueEdit_(int delta, uint32_t now_ms) noexcept
 {
     if (!settings_value_editor_active_ || delta == 0) {
         return;
     }
 
-    playBeep_(delta > 0 ? 1 : 0);
+    // Velocity-aware acceleration for the wide-range numeric types; the
+    // narrow-range types (bool/u8/i8) stay strictly one step per detent.
+    const int multiplier = computeEditStepMultiplier_(now_ms);
 
     auto clamp_add_u32 = [](uint32_t value, int delta_steps, uint32_t step) -> uint32_t {
         const int64_t next = static_cast<int64_t>(value) + static_cast<int64_t>(delta_steps) * static_cast<int64_t>(step);
@@ -1473,12 +5749,12 @@ void ui::UiController::handleSettingsValueEdit_(int delta) noexcept
 
     switch (settings_editor_type_) {
         case SettingsEditorValueType::U32: {
-            settings_editor_u32_new_ = clamp_add_u32(settings_editor_u32_new_, delta, settings_editor_u32_step_);
+            settings_editor_u32_new_ = clamp_add_u32(settings_editor_u32_new_, delta * multiplier, settings_editor_u32_step_);
             break;
         }
         case SettingsEditorValueType::F32: {
             const float step = std::max(0.0001f, settings_editor_f32_step_);
-            const float next = std::max(0.0f, settings_editor_f32_new_ + step * static_cast<float>(delta));
+            const float next = std::max(0.0f, settings_editor_f32_new_ + step * static_cast<float>(delta * multiplier));
             settings_editor_f32_new_ = std::round(next * 10.0f) / 10.0f;
             break;
         }
@@ -1627,7 +5903,6 @@ void ui::UiController::handleSettingsPopupInput_(int delta, bool click, uint32_t
     if (delta != 0) {
         const int next = static_cast<int>(settings_popup_selection_) + (delta > 0 ? 1 : -1);
         settings_popup_selection_ = static_cast<uint8_t>(std::clamp(next, 0, max_sel));
-        playBeep_(delta > 0 ? 1 : 0);
         dirty_ = true;
     }
 
@@ -1674,7 +5949,7 @@ void ui::UiController::handleSettingsPopupInput_(int delta, bool click, uint32_t
         // RESYNC: discard edits and return to landing.
         if (settings_ != nullptr) {
             edit_settings_ = *settings_;
-            original_settings_ = edit_settings_;
+            resetSettingsBaseline_();
             M5.Display.setBrightness(settings_->ui.brightness);
         }
 
@@ -1687,6 +5962,8 @@ void ui::UiController::handleSettingsPopupInput_(int delta, bool click, uint32_t
         settings_popup_selection_ = 0;
         settings_value_editor_active_ = false;
         settings_editor_type_ = SettingsEditorValueType::None;
+        bounds_tune_active_ = false;
+        bounds_tune_editing_ = false;
         page_ = Page::Landing;
         dirty_ = true;
         return;
@@ -1734,7 +6011,7 @@ void ui::UiController::drawConnectionIndicator_(uint32_t now_ms) noexcept
     uint16_t color;
     switch (conn_status_) {
         case ConnStatus::Connected:
-            color = 0x07E0;  // Green
+            color = thm().chart_good;
             break;
         case ConnStatus::Connecting: {
             // Pulsing yellow
@@ -1745,12 +6022,57 @@ void ui::UiController::drawConnectionIndicator_(uint32_t now_ms) noexcept
         }
         case ConnStatus::Disconnected:
         default:
-            color = 0xF800;  // Red
+            color = thm().chart_bad;
             break;
     }
     
     canvas_->fillCircle(x, y, 5, color);
     canvas_->drawCircle(x, y, 6, TFT_WHITE);
+
+    // Storm badge: an orange ring around the dot while ingress shedding is
+    // active — the link is alive but telemetry is being coalesced.
+    if (rx_storm_) {
+        canvas_->drawCircle(x, y, 8, thm().accent_orange);
+        canvas_->drawCircle(x, y, 9, thm().accent_orange);
+    }
+
+    // Signal bars for the active unit, left of the dot. Only drawn once
+    // link quality has at least one RSSI sample; before that the dot alone
+    // carries the state.
+    uint8_t mac[6];
+    espnow::PeerLinkQuality qual;
+    if (conn_status_ != ConnStatus::Disconnected && activeUnitMac_(mac) &&
+        espnow::GetPeerLinkQuality(mac, qual)) {
+        const int bars = signalBars_(qual.rssi_dbm);
+        const uint16_t lit = (bars >= 3) ? thm().chart_good
+                           : (bars == 2) ? thm().chart_warn
+                                         : thm().chart_bad;
+        const int16_t bx = static_cast<int16_t>(x - 24);
+        for (int i = 0; i < 4; ++i) {
+            const int16_t h = static_cast<int16_t>(3 + i * 2);
+            canvas_->fillRect(static_cast<int16_t>(bx + i * 4),
+                              static_cast<int16_t>(y + 5 - h), 3, h,
+                              (i < bars) ? lit : thm().bg_elevated);
+        }
+        // Long-range PHY profile engaged for this peer: tag the bars so a
+        // weak-but-held link is distinguishable from a merely weak one.
+        if (espnow::GetPeerLongRange(mac)) {
+            canvas_->setTextDatum(textdatum_t::top_left);
+            canvas_->setTextColor(thm().text_secondary);
+            canvas_->setTextSize(1);
+            canvas_->drawString("LR", static_cast<int16_t>(bx - 14),
+                                static_cast<int16_t>(y - 3));
+        }
+    }
+}
+
+int ui::UiController::signalBars_(int8_t rssi_dbm) noexcept
+{
+    if (rssi_dbm >= -55) return 4;
+    if (rssi_dbm >= -65) return 3;
+    if (rssi_dbm >= -75) return 2;
+    if (rssi_dbm >= -85) return 1;
+    return 0;
 }
 
 void ui::UiController::drawRoundedRect_(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color, bool filled) noexcept
@@ -1767,33 +6089,27 @@ void ui::UiController::drawButton_(const Rect& rect, const char* label, bool foc
     // Modern button with gradient-like effect
     const int16_t r = rect.h / 3;  // Rounded corners proportional to height
     
-    uint16_t bg_color = colors::bg_elevated;
-    uint16_t border_color = colors::button_border;
-    uint16_t text_color = colors::text_secondary;
+    uint16_t bg_color = thm().bg_elevated;
+    uint16_t border_color = thm().button_border;
+    uint16_t text_color = thm().text_secondary;
     
     if (pressed) {
-        bg_color = colors::accent_blue;
-        border_color = colors::accent_cyan;
-        text_color = colors::text_primary;
+        bg_color = thm().accent_blue;
+        border_color = thm().accent_cyan;
+        text_color = thm().text_primary;
     } else if (focused) {
-        bg_color = colors::button_active;
-        border_color = colors::accent_blue;
-        text_color = colors::text_primary;
-    }
-    
-    // Draw filled button with smooth corners
-    canvas_->fillSmoothRoundRect(rect.x, rect.y, rect.w, rect.h, r, bg_color);
-    
-    // Draw border (2px for focused)
-    canvas_->drawRoundRect(rect.x, rect.y, rect.w, rect.h, r, border_color);
-    if (focused) {
-        canvas_->drawRoundRect(rect.x + 1, rect.y + 1, rect.w - 2, rect.h - 2, r - 1, border_color);
+        bg_color = thm().button_active;
+        border_color = thm().accent_blue;
+        text_color = thm().text_primary;
     }
     
+    // Chrome from the corner atlas (2px border when focused)
+    drawButtonChrome_(rect.x, rect.y, rect.w, rect.h, r, bg_color, border_color, focused);
+
     // Draw label centered with size 2 font
     canvas_->setTextColor(text_color);
     canvas_->setTextSize(2);
-    const int16_t tw = static_cast<int16_t>(canvas_->textWidth(label));
+    const int16_t tw = measureText_(label);
     const int16_t th = 14;  // Approx height for size 2
     canvas_->setCursor(rect.x + (rect.w - tw) / 2, rect.y + (rect.h - th) / 2);
     canvas_->print(label);
@@ -1806,14 +6122,17 @@ void ui::UiController::drawButton_(const Rect& rect, const char* label, bool foc
 void ui::UiController::drawProgressArc_(int16_t cx, int16_t cy, int16_t r, int16_t thickness,
                                         float progress, uint16_t fg_color, uint16_t bg_color) noexcept
 {
-    // Background arc (full circle)
+    // Background arc (full circle). The span rasterizer replaces LGFX's
+    // per-pixel float fillArc for these fixed ring geometries.
     constexpr float start = -90.0f;  // Start at 12 o'clock
-    canvas_->fillArc(cx, cy, r, r - thickness, start, start + 360.0f, bg_color);
-    
-    // Progress arc
+    ui::ring::fillRingArc(canvas_, cx, cy, r, static_cast<int16_t>(r - thickness),
+                          start, start + 360.0f, bg_color, thm().bg_primary);
+
+    // Progress arc (drawn over the track, so its edges blend toward it)
     if (progress > 0.001f) {
         const float end = start + 360.0f * std::min(1.0f, progress);
-        canvas_->fillArc(cx, cy, r, r - thickness, start, end, fg_color);
+        ui::ring::fillRingArc(canvas_, cx, cy, r, static_cast<int16_t>(r - thickness),
+                              start, end, fg_color, bg_color);
     }
 }
 
@@ -1821,15 +6140,14 @@ void ui::UiController::drawModernButton_(int16_t x, int16_t y, int16_t w, int16_
                                          const char* label, bool selected, bool pressed,
                                          uint16_t accent) noexcept
 {
-    uint16_t bg = pressed ? accent : (selected ? colors::button_active : colors::button_bg);
-    uint16_t border = selected ? accent : colors::button_border;
+    uint16_t bg = pressed ? accent : (selected ? thm().button_active : thm().button_bg);
+    uint16_t border = selected ? accent : thm().button_border;
     
-    canvas_->fillSmoothRoundRect(x, y, w, h, h/4, bg);
-    canvas_->drawRoundRect(x, y, w, h, h/4, border);
-    
-    canvas_->setTextColor(colors::text_primary);
+    drawButtonChrome_(x, y, w, h, h/4, bg, border, false);
+
+    canvas_->setTextColor(thm().text_primary);
     canvas_->setTextSize(2); // Increased text size for better visibility
-    const int16_t tw = static_cast<int16_t>(canvas_->textWidth(label));
+    const int16_t tw = measureText_(label);
     const int16_t th = 14; // Approximate height for text size 2
     canvas_->setCursor(x + (w - tw) / 2, y + (h - th) / 2);
     canvas_->print(label);
@@ -1843,40 +6161,218 @@ void ui::UiController::drawActionButton_(int16_t x, int16_t y, int16_t w, int16_
     const int16_t r = h / 3;
     
     // Dim version of accent for unselected state
-    const uint16_t dim_color = ((accent_color >> 1) & 0x7BEF);  // Halve RGB components
+    const uint16_t dim_color = th::dim565(accent_color);
     
     uint16_t bg = selected ? accent_color : dim_color;
     uint16_t border = accent_color;
-    uint16_t text_color = dark_text ? colors::bg_primary : colors::text_primary;
-    
-    // Draw filled button
-    canvas_->fillSmoothRoundRect(x, y, w, h, r, bg);
-    
-    // Draw border (thicker when selected)
-    canvas_->drawRoundRect(x, y, w, h, r, border);
-    if (selected) {
-        canvas_->drawRoundRect(x + 1, y + 1, w - 2, h - 2, r - 1, border);
-    }
+    uint16_t text_color = dark_text ? thm().bg_primary : thm().text_primary;
     
+    // Chrome from the corner atlas (thicker border when selected)
+    drawButtonChrome_(x, y, w, h, r, bg, border, selected);
+
     // Draw label centered with size 2 font
     canvas_->setTextColor(text_color);
     canvas_->setTextSize(2);
-    const int16_t tw = static_cast<int16_t>(canvas_->textWidth(label));
+    const int16_t tw = measureText_(label);
     const int16_t th = 14;
     canvas_->setCursor(x + (w - tw) / 2, y + (h - th) / 2);
     canvas_->print(label);
 }
 
+ui::UiController::ChromeSlot* ui::UiController::ensureChrome_(
+    int16_t r, uint16_t bg, uint16_t border, bool double_border) noexcept
+{
+    // Style key; bg_primary participates because the corner anti-aliasing
+    // is baked against it (a theme change re-keys every style).
+    uint32_t key = 2166136261u;
+    const auto mix = [&key](uint32_t v) { key = (key ^ v) * 16777619u; };
+    mix(static_cast<uint32_t>(r));
+    mix(bg);
+    mix(border);
+    mix(double_border ? 1u : 0u);
+    mix(thm().bg_primary);
+
+    ChromeSlot* slot = nullptr;
+    for (auto& s : chrome_slots_) {
+        if (s.sprite != nullptr && s.key == key) {
+            cacheNote_(CacheId::Chrome, true);
+            return &s;
+        }
+        if (slot == nullptr && s.sprite == nullptr) {
+            slot = &s;
+        }
+    }
+    cacheNote_(CacheId::Chrome, false);
+    if (slot == nullptr) {
+        // Every slot holds some other style: recycle round-robin. Only a
+        // handful of styles are live per page, so sustained thrash means
+        // the pool is undersized - the hit counters would show it.
+        slot = &chrome_slots_[chrome_victim_];
+        chrome_victim_ = (chrome_victim_ + 1) % kChromeSlots_;
+        slot->sprite->deleteSprite();
+        delete slot->sprite;
+        slot->sprite = nullptr;
+    }
+
+    const int16_t half = static_cast<int16_t>(r + 2);
+    slot->sprite = new LGFX_Sprite(canvas_);
+    if (slot->sprite == nullptr) {
+        return nullptr;
+    }
+    slot->sprite->setColorDepth(16);
+    sprite_mem::PlaceRetained(*slot->sprite);
+    slot->sprite->createSprite(2 * half, 2 * half);
+    if (slot->sprite->getBuffer() == nullptr) {
+        delete slot->sprite;
+        slot->sprite = nullptr;
+        return nullptr;
+    }
+
+    // A rounded square whose four corners are exactly the button's
+    // corners; the straight runs between them are redrawn as flat fills
+    // by drawButtonChrome_, so only the quadrants of this tile matter.
+    LGFX_Sprite& s = *slot->sprite;
+    s.fillScreen(thm().bg_primary);
+    s.fillSmoothRoundRect(0, 0, 2 * half, 2 * half, r, bg);
+    s.drawRoundRect(0, 0, 2 * half, 2 * half, r, border);
+    if (double_border) {
+        s.drawRoundRect(1, 1, 2 * half - 2, 2 * half - 2, r - 1, border);
+    }
+    slot->key = key;
+    slot->half = half;
+    return slot;
+}
+
+void ui::UiController::drawButtonChrome_(int16_t x, int16_t y, int16_t w, int16_t h,
+                                         int16_t r, uint16_t bg, uint16_t border,
+                                         bool double_border) noexcept
+{
+    ChromeSlot* slot = (w >= 2 * (r + 2) + 2 && h >= 2 * (r + 2) + 2)
+                           ? ensureChrome_(r, bg, border, double_border)
+                           : nullptr;
+    if (slot == nullptr) {
+        // Degenerate geometry or OOM: same pixels straight to the canvas,
+        // just slower.
+        canvas_->fillSmoothRoundRect(x, y, w, h, r, bg);
+        canvas_->drawRoundRect(x, y, w, h, r, border);
+        if (double_border) {
+            canvas_->drawRoundRect(x + 1, y + 1, w - 2, h - 2, r - 1, border);
+        }
+        return;
+    }
+    chrome_last_use_ms_ = frame_now_ms_;
+
+    const int16_t R = slot->half;
+    LGFX_Sprite& s = *slot->sprite;
+
+    // Body and straight borders are flat runs; only the anti-aliased
+    // corners come from the atlas.
+    canvas_->fillRect(static_cast<int16_t>(x + R), y, static_cast<int16_t>(w - 2 * R), h, bg);
+    canvas_->fillRect(x, static_cast<int16_t>(y + R), R, static_cast<int16_t>(h - 2 * R), bg);
+    canvas_->fillRect(static_cast<int16_t>(x + w - R), static_cast<int16_t>(y + R),
+                      R, static_cast<int16_t>(h - 2 * R), bg);
+    canvas_->drawFastHLine(static_cast<int16_t>(x + R), y, w - 2 * R, border);
+    canvas_->drawFastHLine(static_cast<int16_t>(x + R), static_cast<int16_t>(y + h - 1),
+                           w - 2 * R, border);
+    canvas_->drawFastVLine(x, static_cast<int16_t>(y + R), h - 2 * R, border);
+    canvas_->drawFastVLine(static_cast<int16_t>(x + w - 1), static_cast<int16_t>(y + R),
+                           h - 2 * R, border);
+    if (double_border) {
+        canvas_->drawFastHLine(static_cast<int16_t>(x + R), static_cast<int16_t>(y + 1),
+                               w - 2 * R, border);
+        canvas_->drawFastHLine(static_cast<int16_t>(x + R), static_cast<int16_t>(y + h - 2),
+                               w - 2 * R, border);
+        canvas_->drawFastVLine(static_cast<int16_t>(x + 1), static_cast<int16_t>(y + R),
+                               h - 2 * R, border);
+        canvas_->drawFastVLine(static_cast<int16_t>(x + w - 2), static_cast<int16_t>(y + R),
+                               h - 2 * R, border);
+    }
+
+    // Corner blits: clip to each quadrant so only that corner of the tile
+    // lands, then restore the frame's clip for whoever draws next.
+    int32_t cx, cy, cw, ch;
+    canvas_->getClipRect(&cx, &cy, &cw, &ch);
+    canvas_->setClipRect(x, y, R, R);
+    s.pushSprite(canvas_, x, y);
+    canvas_->setClipRect(static_cast<int16_t>(x + w - R), y, R, R);
+    s.pushSprite(canvas_, static_cast<int16_t>(x + w - 2 * R), y);
+    canvas_->setClipRect(x, static_cast<int16_t>(y + h - R), R, R);
+    s.pushSprite(canvas_, x, static_cast<int16_t>(y + h - 2 * R));
+    canvas_->setClipRect(static_cast<int16_t>(x + w - R), static_cast<int16_t>(y + h - R), R, R);
+    s.pushSprite(canvas_, static_cast<int16_t>(x + w - 2 * R), static_cast<int16_t>(y + h - 2 * R));
+    canvas_->setClipRect(cx, cy, cw, ch);
+}
+
+void ui::UiController::freeChromeCache_() noexcept
+{
+    for (auto& s : chrome_slots_) {
+        if (s.sprite != nullptr) {
+            s.sprite->deleteSprite();
+            delete s.sprite;
+            s.sprite = nullptr;
+        }
+        s.key = 0;
+    }
+}
+
+int16_t ui::UiController::measureText_(const char* text) noexcept
+{
+    // String width from the generated advance table (tools/subset_font.py)
+    // at the canvas' current text size: a plain table sum instead of the
+    // library's per-character virtual glyph lookup. Any character outside
+    // the audited set falls back to the library measurement, so a label
+    // added without regenerating the table is never mis-measured.
+    int32_t w = 0;
+    for (const char* p = text; *p != '\0'; ++p) {
+        const uint8_t adv = ui::assets::glyphAdvance(static_cast<uint8_t>(*p));
+        if (adv == 0) {
+            return static_cast<int16_t>(canvas_->textWidth(text));
+        }
+        w += adv;
+    }
+    return static_cast<int16_t>(w * static_cast<int32_t>(canvas_->getTextSizeX()));
+}
+
 void ui::UiController::drawCenteredText_(int16_t cx, int16_t y, const char* text,
                                          uint16_t color, uint8_t size) noexcept
 {
     canvas_->setTextSize(size);
     canvas_->setTextColor(color);
-    const int16_t tw = static_cast<int16_t>(canvas_->textWidth(text));
+    const int16_t tw = measureText_(text);
     canvas_->setCursor(cx - tw / 2, y);
     canvas_->print(text);
 }
 
+bool ui::UiController::bandVisible_(int16_t y, int16_t h) const noexcept
+{
+    // Full frames (and legacy frames without a registered rect) draw
+    // everything; partial frames only touch the dirty union's scanlines,
+    // so anything outside that band can skip formatting entirely.
+    if (frame_full_ || !dirty_rects_.hasDirty()) {
+        return true;
+    }
+    return y < static_cast<int16_t>(dirty_rects_.y() + dirty_rects_.h()) &&
+           static_cast<int16_t>(y + h) > dirty_rects_.y();
+}
+
+void ui::UiController::drawCenteredTextf_(int16_t cx, int16_t y, uint16_t color,
+                                          uint8_t size, const char* fmt, ...) noexcept
+{
+    // Glyphs render downward from the cursor at 8 px per text-size unit.
+    if (!bandVisible_(y, static_cast<int16_t>(8 * size))) {
+        return;
+    }
+    char* buf = static_cast<char*>(frame_arena_.alloc(48));
+    if (buf == nullptr) {
+        return;  // arena exhausted: drop the label rather than fault
+    }
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buf, 48, fmt, args);
+    va_end(args);
+    drawCenteredText_(cx, y, buf, color, size);
+}
+
 void ui::UiController::drawSettingsItem_(int16_t y, int index, const char* label, 
                                          const char* value, bool selected, bool editing) noexcept
 {
@@ -1885,27 +6381,27 @@ void ui::UiController::drawSettingsItem_(int16_t y, int index, const char* label
     const int16_t h = kSettingsItemHeight_ - 4;
     
     // Card background
-    uint16_t bg = selected ? colors::button_active : colors::bg_card;
+    uint16_t bg = selected ? thm().button_active : thm().bg_card;
     canvas_->fillSmoothRoundRect(x, y, w, h, 8, bg);
     
     if (selected) {
-        canvas_->drawRoundRect(x, y, w, h, 8, colors::accent_blue);
+        canvas_->drawRoundRect(x, y, w, h, 8, thm().accent_blue);
     }
     
     // Label
     canvas_->setTextSize(1);
-    canvas_->setTextColor(colors::text_secondary);
+    canvas_->setTextColor(thm().text_secondary);
     canvas_->setCursor(x + 12, y + 6);
     canvas_->print(label);
     
     // Value
-    canvas_->setTextColor(editing ? colors::accent_yellow : colors::text_primary);
+    canvas_->setTextColor(editing ? thm().accent_yellow : thm().text_primary);
     canvas_->setCursor(x + 12, y + 20);
     canvas_->print(value);
     
     // Edit indicator
     if (editing) {
-        canvas_->fillSmoothCircle(x + w - 16, y + h/2, 4, colors::accent_yellow);
+        canvas_->fillSmoothCircle(x + w - 16, y + h/2, 4, thm().accent_yellow);
     }
 }
 
@@ -1924,58 +6420,128 @@ void ui::UiController::drawCircularMenuIcons_(uint32_t now_ms) noexcept
 {
     const int selected = menu_selector_.getSelectedIndex();
     const bool animating = menu_selector_.isAnimating(now_ms);
-    
+
     for (int i = 0; i < MENU_COUNT_; ++i) {
         const Point2D pos = menu_selector_.getIconPosition(i);
         const int16_t ix = static_cast<int16_t>(pos.x);
         const int16_t iy = static_cast<int16_t>(pos.y);
-        
+
         const auto& item = kMenuItems_[i];
         const bool is_selected = (i == selected);
-        
-        // Draw hollow ring highlight FIRST (behind icon) for selected item only
+
+        // Icons well outside the visible arc around the selection render as
+        // plain colored dots, so a fuller table doesn't grow the per-frame
+        // decode cost: at most 2*kMenuIconArc_+1 icons are ever expanded.
+        int ring_dist = (i >= selected) ? (i - selected) : (selected - i);
+        ring_dist = std::min(ring_dist, MENU_COUNT_ - ring_dist);
+        if (ring_dist > kMenuIconArc_) {
+            canvas_->fillSmoothCircle(ix, iy, kMenuFarDotRadius_, item.color);
+            continue;
+        }
+
+        // Draw soft glow FIRST (behind icon) for selected item only: the
+        // pre-baked ramp fades the theme color outward (see kMenuGlow_).
+        // Outermost first so the brighter inner rings win any overlap.
         if (is_selected && !animating) {
-            // Draw ring outside the icon area (icon radius is 21, draw at 23-26)
+            // Rings sit outside the icon area (icon radius is 21).
             const int16_t base_r = menu_config_.icon_bg_radius;  // 22
-            canvas_->drawCircle(ix, iy, base_r + 2, item.color);
-            canvas_->drawCircle(ix, iy, base_r + 3, item.color);
-            canvas_->drawCircle(ix, iy, base_r + 4, item.color);
+            const GlowRamp& glow = kMenuGlow_[i];
+            for (int r = kGlowRings_ - 1; r >= 0; --r) {
+                canvas_->drawCircle(ix, iy, static_cast<int16_t>(base_r + 2 + r),
+                                    glow.ring[r]);
+            }
         }
         
-        // Draw icon centered ON TOP (icon already has colored background baked in)
-        if (item.icon_data != nullptr) {
-            const int16_t icon_x = ix - item.icon_w / 2;
-            const int16_t icon_y = iy - item.icon_h / 2;
-            canvas_->pushImage(icon_x, icon_y, item.icon_w, item.icon_h, 
-                                 item.icon_data, ui::assets::kCircularIconTransparent);
+        // Draw icon centered ON TOP (icon already has colored background baked in).
+        // Icons are palettized + RLE; the decoder expands straight into the
+        // canvas and skips transparent runs instead of testing every pixel.
+        if (item.icon != nullptr) {
+            const int16_t icon_x = ix - item.icon->w / 2;
+            const int16_t icon_y = iy - item.icon->h / 2;
+            ui::assets::drawCompressedIcon(*canvas_, icon_x, icon_y, *item.icon,
+                                           ui::assets::kCircularIconTransparent);
+        }
+    }
+}
+
+bool ui::UiController::ensureMenuTag_(int selected) noexcept
+{
+    if (menu_tag_sprite_ == nullptr) {
+        menu_tag_sprite_ = new LGFX_Sprite(canvas_);
+        if (menu_tag_sprite_ != nullptr) {
+            menu_tag_sprite_->setColorDepth(8);
+            sprite_mem::PlaceRetained(*menu_tag_sprite_);
+            menu_tag_sprite_->createSprite(kMenuTagW_, kMenuTagH_);
         }
     }
+    if (menu_tag_sprite_ == nullptr || menu_tag_sprite_->getBuffer() == nullptr) {
+        return false;
+    }
+    if (menu_tag_index_ == selected) {
+        return true;
+    }
+
+    // Compose the tag once: same layout as the direct path, re-centered on
+    // the sprite. The landing page background is black, so the sprite blit
+    // is indistinguishable from in-place text.
+    const auto& item = kMenuItems_[selected];
+    const int16_t cx = kMenuTagW_ / 2;
+    const int16_t cy = kMenuTagH_ / 2;
+    LGFX_Sprite& s = *menu_tag_sprite_;
+    s.fillScreen(TFT_BLACK);
+    s.setTextColor(menu_config_.selector_color);
+    s.setTextSize(2);
+    if (item.tag_up != nullptr) {
+        const int16_t tw = measureText_(item.tag_up);
+        if (item.tag_down != nullptr) {
+            s.setCursor(cx - tw / 2, cy - 18);
+            s.print(item.tag_up);
+            const int16_t tw2 = measureText_(item.tag_down);
+            s.setCursor(cx - tw2 / 2, cy + 2);
+            s.print(item.tag_down);
+        } else {
+            s.setCursor(cx - tw / 2, cy - 8);
+            s.print(item.tag_up);
+        }
+    }
+    menu_tag_index_ = selected;
+    return true;
 }
 
 void ui::UiController::drawCircularMenuTag_(uint32_t now_ms) noexcept
 {
-    (void)now_ms;
     const int selected = menu_selector_.getSelectedIndex();
     if (selected < 0 || selected >= MENU_COUNT_) {
         return;
     }
-    
+
     const auto& item = kMenuItems_[selected];
     const int16_t cx = menu_config_.center_x;
     const int16_t cy = menu_config_.center_y;
-    
+
     // Tag color matching selector (cream/off-white)
     canvas_->setTextColor(menu_config_.selector_color);
     canvas_->setTextSize(2);
-    
+
+    // Cached path: the composed tag is a sprite blit; rasterize only when
+    // the selection changed. Falls through to direct rendering on OOM.
+    cacheNote_(CacheId::MenuTag, menu_tag_sprite_ != nullptr &&
+                                     menu_tag_sprite_->getBuffer() != nullptr &&
+                                     menu_tag_index_ == selected);
+    if (ensureMenuTag_(selected)) {
+        menu_tag_last_use_ms_ = now_ms;
+        menu_tag_sprite_->pushSprite(canvas_, cx - kMenuTagW_ / 2, cy - kMenuTagH_ / 2);
+        return;
+    }
+
     if (item.tag_up != nullptr) {
-        const int16_t tw = static_cast<int16_t>(canvas_->textWidth(item.tag_up));
+        const int16_t tw = measureText_(item.tag_up);
         if (item.tag_down != nullptr) {
             // Two-line tag
             canvas_->setCursor(cx - tw / 2, cy - 18);
             canvas_->print(item.tag_up);
             
-            const int16_t tw2 = static_cast<int16_t>(canvas_->textWidth(item.tag_down));
+            const int16_t tw2 = measureText_(item.tag_down);
             canvas_->setCursor(cx - tw2 / 2, cy + 2);
             canvas_->print(item.tag_down);
         } else {
@@ -1986,66 +6552,928 @@ void ui::UiController::drawCircularMenuTag_(uint32_t now_ms) noexcept
     }
 }
 
+void ui::UiController::markDirty_(int16_t x, int16_t y, int16_t w, int16_t h) noexcept
+{
+    dirty_rects_.mark(x, y, w, h);
+    dirty_ = true;
+}
+
 void ui::UiController::draw_(uint32_t now_ms) noexcept
+{
+    // Inline (render-task-less) frames bypass the fingerprint bookkeeping
+    // in renderLoop_, so whatever it recorded no longer matches the canvas.
+    live_fp_valid_ = false;
+    renderFrame_(now_ms);
+    flushFrame_();
+}
+
+bool ui::UiController::pageWants8Bit_(Page p) noexcept
+{
+    // Settings and Terminal are text on flat theme colors; RGB332 is
+    // visually indistinguishable there. Landing (icons, carousel),
+    // LiveCounter (progress gradient) and Bounds keep full color.
+    return p == Page::Settings || p == Page::Terminal || p == Page::Diagnostics ||
+           p == Page::History || p == Page::Timeline || p == Page::Fleet ||
+           p == Page::Dashboard;
+}
+
+void ui::UiController::applyCanvasDepth_() noexcept
+{
+    // anim_low_color_ overrides the per-page policy while a struggling
+    // animation burst is running (see the governor in renderLoop_).
+    const bool want8 = pageWants8Bit_(page_) || anim_low_color_;
+    if (canvas_ == nullptr || want8 == canvas_depth8_) {
+        return;
+    }
+
+    canvas_->deleteSprite();
+    canvas_->setColorDepth(want8 ? 8 : 16);
+    canvas_->createSprite(SCREEN_SIZE_, SCREEN_SIZE_);
+    if (canvas_->getBuffer() == nullptr && want8) {
+        // 8-bit allocation failed (unlikely; it is the smaller one) - retry
+        // at the depth that was just freed.
+        canvas_->setColorDepth(16);
+        canvas_->createSprite(SCREEN_SIZE_, SCREEN_SIZE_);
+    }
+    if (canvas_->getBuffer() == nullptr) {
+        ESP_LOGE(TAG_, "Canvas depth switch lost the framebuffer");
+        return;
+    }
+    canvas_depth8_ = (canvas_->getColorDepth() == 8);
+
+    // The retained-frame caches died with the old buffer, and the row
+    // digests describe pixels at the old depth.
+    term_cache_valid_ = false;
+    landing_cache_valid_ = false;
+    row_digest_valid_ = false;
+    dropOverlay_();  // the snapshot is at the old depth too
+    dirty_rects_.clear();
+    dirty_ = true;
+}
+
+bool ui::UiController::overlayActive_() const noexcept
+{
+    if (page_ == Page::Settings) {
+        return settings_popup_mode_ != SettingsPopupMode::None && !bounds_tune_active_;
+    }
+    if (page_ == Page::LiveCounter) {
+        if (live_popup_mode_ == LivePopupMode::QuickSettings) {
+            return quick_settings_confirm_popup_;
+        }
+        return live_popup_mode_ != LivePopupMode::None;
+    }
+    return false;
+}
+
+ui::UiController::Rect ui::UiController::overlayRect_() const noexcept
+{
+    // Must cover each popup's footprint exactly; keep in sync with the
+    // geometry in drawSettingsPopup_, drawLivePopup_ and
+    // drawQuickSettingsConfirm_.
+    if (page_ == Page::Settings) {
+        return Rect{21, 54, 198, 132};
+    }
+    if (live_popup_mode_ == LivePopupMode::QuickSettings) {
+        return Rect{30, 75, 180, 90};
+    }
+    return Rect{20, 50, 200, 140};
+}
+
+bool ui::UiController::allocOverlay_() noexcept
+{
+    if (overlay_snap_ == nullptr) {
+        overlay_snap_ = new LGFX_Sprite(canvas_);
+    }
+    if (overlay_snap_ == nullptr) {
+        return false;
+    }
+    overlay_snap_->setColorDepth(canvas_depth8_ ? 8 : 16);
+    sprite_mem::PlaceRetained(*overlay_snap_);
+    overlay_snap_->createSprite(SCREEN_SIZE_, SCREEN_SIZE_);
+    if (overlay_snap_->getBuffer() == nullptr) {
+        // Out of RAM: popups keep the inline full-page draw path.
+        delete overlay_snap_;
+        overlay_snap_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void ui::UiController::finishOverlayCapture_(uint32_t now_ms) noexcept
+{
+    // Dim the frozen page once, in place: a true 50% scrim over every
+    // pixel, word-at-a-time over the packed buffer (see blend565.hpp), so
+    // it costs microseconds at either canvas depth and keeps the page
+    // legible under the popup instead of the old alternate-row striping.
+    blend565::DimBuffer(canvas_->getBuffer(),
+                        static_cast<size_t>(SCREEN_SIZE_) * SCREEN_SIZE_,
+                        canvas_depth8_, blend565::Level::Half);
+    const size_t bytes = static_cast<size_t>(SCREEN_SIZE_) * SCREEN_SIZE_ *
+                         (canvas_depth8_ ? 1U : 2U);
+    memcpy(overlay_snap_->getBuffer(), canvas_->getBuffer(), bytes);
+    overlay_rect_ = overlayRect_();
+    overlay_valid_ = true;
+    overlay_capture_ = false;
+    drawOverlayPopup_(now_ms);
+}
+
+void ui::UiController::drawOverlayPopup_(uint32_t now_ms) noexcept
+{
+    if (page_ == Page::Settings) {
+        drawSettingsPopup_(now_ms);
+    } else if (live_popup_mode_ == LivePopupMode::QuickSettings) {
+        drawQuickSettingsConfirm_(now_ms);
+    } else {
+        drawLivePopup_(now_ms);
+    }
+}
+
+void ui::UiController::dropOverlay_() noexcept
+{
+    if (overlay_snap_ != nullptr) {
+        overlay_snap_->deleteSprite();
+        delete overlay_snap_;
+        overlay_snap_ = nullptr;
+    }
+    overlay_valid_ = false;
+    overlay_failed_ = false;
+    overlay_capture_ = false;
+}
+
+bool ui::UiController::pagePrefetchable_(Page p) noexcept
+{
+    // Only pages whose first frame is a pure function of already-live
+    // state qualify. Settings and Terminal mutate state on entry
+    // (enterSettings_ snapshot, scroll reset), so a speculative frame
+    // could differ from the real one; those plus Diagnostics would also
+    // force an RGB332 sprite realloc round-trip on every idle draw.
+    return p == Page::Bounds || p == Page::LiveCounter;
+}
+
+void ui::UiController::tryPrefetch_(uint32_t now_ms) noexcept
+{
+    const int idx = menu_selector_.getSelectedIndex();
+    if (idx < 0 || idx >= MENU_COUNT_) {
+        return;
+    }
+    const Page target = kMenuItems_[idx].target_page;
+    if (!pagePrefetchable_(target)) {
+        return;
+    }
+    if (prefetch_valid_ && prefetch_page_ == target &&
+        (now_ms - prefetch_ms_) <= kPrefetchRefresh_ms) {
+        return;  // Still fresh; nothing to redo.
+    }
+
+    // Draw the destination page into the canvas without flushing; the
+    // panel keeps showing the last pushed landing frame. renderFrame_
+    // treats an empty rect set as a full-frame request and drops the
+    // landing retained-frame cache itself (page_ != Landing path).
+    const Page saved = page_;
+    page_ = target;
+    dirty_rects_.clear();
+    renderFrame_(now_ms);
+    page_ = saved;
+
+    prefetch_page_ = target;
+    prefetch_valid_ = true;
+    prefetch_ms_ = now_ms;
+    // Canvas and panel now disagree (panel still shows the landing frame),
+    // so a slide snapshot taken from the canvas would show the wrong page.
+    shown_page_ = Page::Count;
+}
+
+const char* ui::UiController::cacheName_(CacheId id) noexcept
+{
+    switch (id) {
+        case CacheId::Glyphs:       return "glyphs";
+        case CacheId::MenuTag:      return "menutag";
+        case CacheId::SettingsRows: return "rows";
+        case CacheId::Landing:      return "landing";
+        case CacheId::Terminal:     return "term";
+        case CacheId::Chrome:       return "chrome";
+        case CacheId::Count:        break;
+    }
+    return "?";
+}
+
+void ui::UiController::freeGlyphCache_() noexcept
+{
+    for (auto*& g : digit_glyphs_) {
+        if (g != nullptr) {
+            g->deleteSprite();
+            delete g;
+            g = nullptr;
+        }
+    }
+    glyph_cache_valid_ = false;
+}
+
+void ui::UiController::serviceCacheIdle_(uint32_t now_ms) noexcept
+{
+    // At most one action per idle pass: the pass sits between paced render
+    // wakes, so a single bounded build can never push the next frame past
+    // its deadline the way an unbounded warm sweep could. Builds are timed
+    // into cache_warm_us_ so the scheduler's own cost shows up in the dump.
+    const int64_t t0_us = esp_timer_get_time();
+
+    // Stale eviction first: sprites nobody has blitted for a while hand
+    // their heap back; the next use rebuilds and is counted as a miss.
+    if (glyph_cache_valid_ && page_ != Page::LiveCounter &&
+        now_ms - glyph_last_use_ms_ > kCacheStaleMs_) {
+        freeGlyphCache_();
+        ++cache_stats_[static_cast<size_t>(CacheId::Glyphs)].evicts;
+        return;
+    }
+    if (menu_tag_sprite_ != nullptr && page_ != Page::Landing &&
+        now_ms - menu_tag_last_use_ms_ > kCacheStaleMs_) {
+        menu_tag_sprite_->deleteSprite();
+        delete menu_tag_sprite_;
+        menu_tag_sprite_ = nullptr;
+        menu_tag_index_ = -1;
+        ++cache_stats_[static_cast<size_t>(CacheId::MenuTag)].evicts;
+        return;
+    }
+    if (chrome_slots_[0].sprite != nullptr &&
+        now_ms - chrome_last_use_ms_ > kCacheStaleMs_) {
+        freeChromeCache_();
+        ++cache_stats_[static_cast<size_t>(CacheId::Chrome)].evicts;
+        return;
+    }
+
+    // Warming: build what the current context makes likely next.
+    const int selected = menu_selector_.getSelectedIndex();
+    if (page_ == Page::Landing) {
+        // LiveCounter is one click away while its item is selected; build
+        // the digit sprites now so entry pays a blit, not a rasterize.
+        if (!glyph_cache_valid_ && selected >= 0 && selected < MENU_COUNT_ &&
+            kMenuItems_[selected].target_page == Page::LiveCounter) {
+            if (buildGlyphCache_()) {
+                ++cache_stats_[static_cast<size_t>(CacheId::Glyphs)].warms;
+                glyph_last_use_ms_ = now_ms;  // fresh build is not yet stale
+            }
+        }
+    } else if (selected >= 0 && selected < MENU_COUNT_ &&
+               (menu_tag_sprite_ == nullptr || menu_tag_index_ != selected)) {
+        // Every page exits back to Landing; have its center tag composed.
+        if (ensureMenuTag_(selected)) {
+            ++cache_stats_[static_cast<size_t>(CacheId::MenuTag)].warms;
+            menu_tag_last_use_ms_ = now_ms;
+        }
+    }
+
+    cache_warm_us_ += static_cast<uint32_t>(esp_timer_get_time() - t0_us);
+}
+
+void ui::UiController::renderFrame_(uint32_t now_ms) noexcept
 {
     // All rendering goes to canvas for flicker-free display
     if (canvas_ == nullptr) {
         return;
     }
-    
-    // Clear canvas
-    canvas_->fillScreen(TFT_BLACK);
+    TRACE_SCOPE("renderFrame");
+    // Adopt the causing input's correlation id on this core: the frame's
+    // trace records join the chain the detent or proto event started.
+    trace::SetCorrelation(frame_corr_);
+
+    // Tear-free copy of the protocol-derived inputs for this frame. On a
+    // (rare) persistent torn read the previous frame's copy is reused.
+    (void)readRenderSnapshot_(frame_snapshot_);
+
+    // Everything the previous frame formatted into the arena is dead now.
+    frame_arena_.reset();
+
+    // Whatever the canvas held before this frame is about to be drawn
+    // over; tryPrefetch_ re-arms the flag after a speculative draw. A
+    // canvas holding a different page cannot back a partial redraw
+    // (pixels outside the dirty union would be the wrong page), so the
+    // frame goes full in that case.
+    if (prefetch_valid_ && prefetch_page_ != page_) {
+        dirty_rects_.markFull();
+    }
+    prefetch_valid_ = false;
+
+    // Recreate the sprite at the page's color depth when crossing the
+    // 8/16-bit boundary (forces a full redraw of the new page).
+    applyCanvasDepth_();
+
+    // Landing: if nothing visible changed except the animated selector dot,
+    // keep the previous frame and redraw just the dot's band. This turns the
+    // expensive carousel animation frames (ring + four icon decodes + pills)
+    // into two small fills.
+    landing_incremental_ = false;
+    if (page_ == Page::Landing && landing_cache_valid_ &&
+        landingSignature_(now_ms) == landing_sig_) {
+        landing_incremental_ = true;
+        dirty_rects_.clear();
+        const int16_t r = static_cast<int16_t>(menu_config_.selector_dot_radius + 1);
+        dirty_rects_.mark(static_cast<int16_t>(landing_prev_dot_x_ - r),
+                          static_cast<int16_t>(landing_prev_dot_y_ - r),
+                          static_cast<int16_t>(2 * r + 1), static_cast<int16_t>(2 * r + 1));
+        const Point2D dot = menu_selector_.getSelectorPosition(now_ms);
+        dirty_rects_.mark(static_cast<int16_t>(static_cast<int16_t>(dot.x) - r),
+                          static_cast<int16_t>(static_cast<int16_t>(dot.y) - r),
+                          static_cast<int16_t>(2 * r + 1), static_cast<int16_t>(2 * r + 1));
+    }
+    if (page_ == Page::Landing) {
+        cacheNote_(CacheId::Landing, landing_incremental_);
+    }
+
+    // Overlay compositor: while a popup is open the page beneath it is
+    // frozen. The first popup frame renders the page without its popup,
+    // snapshots and dims it, then draws the popup on top; every later
+    // popup frame restores the popup rect from the snapshot and redraws
+    // only the popup.
+    overlay_capture_ = false;
+    bool overlay_compose = false;
+    if (!overlayActive_()) {
+        if (overlay_snap_ != nullptr || overlay_failed_) {
+            dropOverlay_();  // popup closed: the live page returns in full
+            dirty_rects_.markFull();
+        }
+    } else if (overlay_valid_) {
+        overlay_compose = true;
+        // Nothing outside the popup can change over a frozen page.
+        dirty_rects_.clear();
+        dirty_rects_.mark(overlay_rect_.x, overlay_rect_.y, overlay_rect_.w, overlay_rect_.h);
+    } else if (!overlay_failed_) {
+        overlay_capture_ = allocOverlay_();
+        overlay_failed_ = !overlay_capture_;
+        dirty_rects_.markFull();  // capture pass renders the page in full
+    }
+
+    // A/B harness pass with Partial disabled: every frame renders full,
+    // pricing the dirty-rect machinery's absence.
+    if (abDisabled_(AbSubject::Partial)) {
+        landing_incremental_ = false;
+        dirty_rects_.markFull();
+    }
+
+    // A dirty_ frame without a registered rect is a legacy "redraw everything"
+    // request (page change, popup, animation); treat it as full-screen.
+    if (!dirty_rects_.hasDirty()) {
+        dirty_rects_.markFull();
+    }
+    // A terminal rebuild (cold line cache) always needs the whole frame.
+    if (page_ == Page::Terminal && !term_cache_valid_) {
+        dirty_rects_.markFull();
+    }
+    const bool full = dirty_rects_.isFull();
+    frame_full_ = full;
+    frame_now_ms_ = now_ms;
+
+    // Clip sprite writes to the dirty union so partial frames cost only the
+    // pixels they actually change (fillScreen & draw helpers honor the clip).
+    if (!full) {
+        canvas_->setClipRect(dirty_rects_.x(), dirty_rects_.y(), dirty_rects_.w(), dirty_rects_.h());
+    }
+
+    // Clear canvas. The terminal keeps its previous frame and erases per
+    // line instead (see drawTerminal_); an incremental landing frame keeps
+    // everything but the selector dot.
+    if (!(page_ == Page::Terminal && term_cache_valid_) && !landing_incremental_ &&
+        !overlay_compose) {
+        canvas_->fillScreen(TFT_BLACK);
+    }
+
+    if (overlay_compose) {
+        // Restore the pixels beneath the popup from the frozen snapshot
+        // (the clip rect limits the copy to the popup band), then draw
+        // the popup alone.
+        overlay_snap_->pushSprite(canvas_, 0, 0);
+        drawOverlayPopup_(now_ms);
+    } else {
+        switch (page_) {
+            case Page::Landing: {
+                PerfProbe probe(perf_helpers_[static_cast<size_t>(PerfHelper::Landing)]);
+                drawCircularLanding_(now_ms);
+                break;
+            }
+            case Page::Settings: {
+                PerfProbe probe(perf_helpers_[static_cast<size_t>(PerfHelper::Settings)]);
+                drawSettings_(now_ms);
+                break;
+            }
+            case Page::Bounds: {
+                PerfProbe probe(perf_helpers_[static_cast<size_t>(PerfHelper::Bounds)]);
+                drawBounds_(now_ms);
+                break;
+            }
+            case Page::LiveCounter: {
+                PerfProbe probe(perf_helpers_[static_cast<size_t>(PerfHelper::Live)]);
+                drawLiveCounter_(now_ms);
+                break;
+            }
+            case Page::Terminal: {
+                PerfProbe probe(perf_helpers_[static_cast<size_t>(PerfHelper::Terminal)]);
+                drawTerminal_(now_ms);
+                break;
+            }
+            case Page::Diagnostics: {
+                PerfProbe probe(perf_helpers_[static_cast<size_t>(PerfHelper::Diagnostics)]);
+                drawDiagnostics_(now_ms);
+                break;
+            }
+            case Page::History: {
+                PerfProbe probe(perf_helpers_[static_cast<size_t>(PerfHelper::History)]);
+                drawHistory_(now_ms);
+                break;
+            }
+            case Page::Timeline: {
+                PerfProbe probe(perf_helpers_[static_cast<size_t>(PerfHelper::Timeline)]);
+                drawTimeline_(now_ms);
+                break;
+            }
+            case Page::Fleet: {
+                PerfProbe probe(perf_helpers_[static_cast<size_t>(PerfHelper::Fleet)]);
+                drawFleet_(now_ms);
+                break;
+            }
+            case Page::Dashboard: {
+                PerfProbe probe(perf_helpers_[static_cast<size_t>(PerfHelper::Dashboard)]);
+                drawDashboard_(now_ms);
+                break;
+            }
+            default:
+                break;
+        }
+        if (overlay_capture_) {
+            finishOverlayCapture_(now_ms);  // dim, snapshot, then the popup on top
+        }
+    }
 
-    switch (page_) {
-        case Page::Landing:
-            drawCircularLanding_(now_ms);
-            break;
-        case Page::Settings:
-            drawSettings_(now_ms);
-            break;
-        case Page::Bounds:
-            drawBounds_(now_ms);
-            break;
-        case Page::LiveCounter:
-            drawLiveCounter_(now_ms);
-            break;
-        case Page::Terminal:
-            drawTerminal_(now_ms);
-            break;
-        default:
-            break;
+    if (!full) {
+        canvas_->clearClipRect();
     }
-    
-    // Push canvas to display in one operation (eliminates flicker)
-    canvas_->pushSprite(0, 0);
+
+    if (perf_overlay_) {
+        drawPerfOverlay_();
+    }
+    if (hud_overlay_) {
+        drawHudOverlay_(now_ms);
+    }
+    if (ota_state_ != espnow::OtaState::Idle) {
+        drawOtaOverlay_();
+    }
+    if (alert_sev_ != AlertSeverity::None) {
+        drawAlertRing_();
+    }
+    if (saver_active_) {
+        drawSaverArc_();
+    }
+
+    // Leaving the terminal invalidates its retained-line cache.
+    if (page_ != Page::Terminal) {
+        term_cache_valid_ = false;
+    }
+    // Same for the landing page's retained frame.
+    if (page_ != Page::Landing) {
+        landing_cache_valid_ = false;
+    }
+    // The Settings row cache only earns its heap while the page is open.
+    if (page_ != Page::Settings && settings_rows_[0].sprite != nullptr) {
+        freeSettingsRows_();
+    }
+
+    // Capture the flush band for flushFrame_(); the actual SPI transfer can
+    // then run without holding the UI mutex.
+    flush_full_ = full;
+    flush_y_ = dirty_rects_.y();
+    flush_h_ = dirty_rects_.h();
+    if (perf_overlay_ && !flush_full_) {
+        // The overlay strip repaints every frame; widen the band over it.
+        const int16_t bottom = static_cast<int16_t>(flush_y_ + flush_h_);
+        flush_y_ = 0;
+        flush_h_ = std::max<int16_t>(bottom, 22);
+    }
+    if (hud_overlay_ && hud_repaint_ && !flush_full_) {
+        // HUD digits changed; on the frames in between the blit rewrites
+        // identical pixels and the band can stay put.
+        const int16_t bottom = static_cast<int16_t>(flush_y_ + flush_h_);
+        flush_y_ = 0;
+        flush_h_ = std::max<int16_t>(bottom, kHudY_ + kHudH_);
+        hud_repaint_ = false;
+    }
+    if (ota_state_ != espnow::OtaState::Idle && !flush_full_) {
+        // The update overlay lives in the bottom band; extend down over it.
+        flush_h_ = static_cast<int16_t>(SCREEN_SIZE_ - flush_y_);
+    }
+    dirty_rects_.clear();
+}
+
+void ui::UiController::flushFrame_() noexcept
+{
+    if (canvas_ == nullptr) {
+        return;
+    }
+    TRACE_SCOPE("flushFrame");
+    PerfProbe probe(perf_helpers_[static_cast<size_t>(PerfHelper::Flush)]);
+
+    const int16_t band_y = flush_full_ ? 0 : flush_y_;
+    const int16_t band_h = flush_full_ ? SCREEN_SIZE_ : flush_h_;
+    const size_t row_bytes = canvas_depth8_ ? static_cast<size_t>(SCREEN_SIZE_)
+                                            : static_cast<size_t>(SCREEN_SIZE_) * 2;
+    const auto* buf = static_cast<const uint8_t*>(canvas_->getBuffer());
+    if (buf == nullptr || band_h <= 0) {
+        return;
+    }
+
+    // A/B harness pass with DiffPush disabled: dropping the valid flag
+    // routes every flush through the seed-and-push-whole-band path below,
+    // so re-enabling stays coherent.
+    if (abDisabled_(AbSubject::DiffPush)) {
+        row_digest_valid_ = false;
+    }
+
+    // First flush after an invalidation: push the band as-is and seed the
+    // digest table for every row. Rows outside the band still match what
+    // the panel shows (the canvas is only drawn inside dirty rects), so
+    // their digests are valid too.
+    if (!row_digest_valid_) {
+        for (int16_t y = 0; y < SCREEN_SIZE_; ++y) {
+            row_digest_[y] = rowDigest_(buf + static_cast<size_t>(y) * row_bytes, row_bytes);
+        }
+        row_digest_valid_ = true;
+        pushRowSpan_(band_y, band_h);
+        return;
+    }
+
+    // Differential push: walk the band, hash each row, and emit only spans
+    // whose digest moved. Short unchanged gaps are folded into the running
+    // span - a fresh window setup costs more than re-sending a row or two.
+    constexpr int16_t kMergeGapRows = 2;
+    int16_t span_y = -1;
+    int16_t span_end = 0;  // Exclusive end of the pending span
+    int16_t gap = 0;
+    for (int16_t y = band_y; y < static_cast<int16_t>(band_y + band_h); ++y) {
+        const uint32_t d = rowDigest_(buf + static_cast<size_t>(y) * row_bytes, row_bytes);
+        if (d != row_digest_[y]) {
+            row_digest_[y] = d;
+            if (span_y < 0) {
+                span_y = y;
+            }
+            span_end = static_cast<int16_t>(y + 1);
+            gap = 0;
+        } else if (span_y >= 0 && ++gap > kMergeGapRows) {
+            pushRowSpan_(span_y, static_cast<int16_t>(span_end - span_y));
+            span_y = -1;
+            gap = 0;
+        }
+    }
+    if (span_y >= 0) {
+        pushRowSpan_(span_y, static_cast<int16_t>(span_end - span_y));
+    }
+}
+
+uint32_t ui::UiController::rowDigest_(const void* row, size_t bytes) noexcept
+{
+    // Word-wise FNV-1a; sprite rows are 4-byte multiples at both canvas
+    // depths and the buffer is heap-aligned. A collision would leave one
+    // stale scanline on the panel until its next real change - at 2^-32
+    // per changed row that is acceptable for UI content.
+    const uint32_t* p = static_cast<const uint32_t*>(row);
+    const size_t words = bytes / 4;
+    uint32_t h = 2166136261U;
+    for (size_t i = 0; i < words; ++i) {
+        h ^= p[i];
+        h *= 16777619U;
+    }
+    return h;
+}
+
+void ui::UiController::pushRowSpan_(int16_t y, int16_t rows) noexcept
+{
+    if (rows <= 0) {
+        return;
+    }
+
+    if (canvas_depth8_) {
+        // RGB332 canvas: LGFX expands to the panel depth during the push, so
+        // the DMA slice path (which assumes a 16-bit source) is skipped. The
+        // 8-bit pages are the static ones; half-sized buffer reads keep even
+        // the converting push cheap.
+        const auto* buf = static_cast<const lgfx::rgb332_t*>(canvas_->getBuffer());
+        M5.Display.pushImage(0, y, SCREEN_SIZE_, rows,
+                             buf + static_cast<size_t>(y) * SCREEN_SIZE_);
+        return;
+    }
+
+    const auto* buf = static_cast<const uint16_t*>(canvas_->getBuffer());
+    if (!dma_flush_ok_) {
+        // Rows are contiguous in the 16-bit sprite buffer, so a full-width
+        // span needs no per-row copies.
+        M5.Display.pushImage(0, y, SCREEN_SIZE_, rows,
+                             buf + static_cast<size_t>(y) * SCREEN_SIZE_);
+        return;
+    }
+
+    // DMA path: copy the span out of the canvas slice-by-slice into the two
+    // bounce buffers and queue each slice with pushImageDMA. pushImageDMA
+    // waits for the previous transfer before starting the next, which both
+    // pipelines memcpy against SPI and guarantees a bounce buffer is idle by
+    // the time it is reused. The final slice drains asynchronously: the
+    // render task returns immediately and starts the next frame while the
+    // tail of the span is still on the wire (the canvas is never the DMA
+    // source, so redrawing it is safe).
+    for (int16_t row = 0; row < rows; row += kDmaSliceRows_) {
+        const int16_t slice = std::min<int16_t>(kDmaSliceRows_, static_cast<int16_t>(rows - row));
+        uint16_t* bounce = dma_bounce_[dma_bounce_idx_];
+        dma_bounce_idx_ ^= 1;
+        std::memcpy(bounce, buf + static_cast<size_t>(y + row) * SCREEN_SIZE_,
+                    static_cast<size_t>(slice) * SCREEN_SIZE_ * 2);
+        M5.Display.pushImageDMA(0, static_cast<int16_t>(y + row), SCREEN_SIZE_, slice, bounce);
+    }
+}
+
+void ui::UiController::serviceScreenshot_() noexcept
+{
+    int16_t row = shot_row_.load();
+    if (row < 0 || canvas_ == nullptr) {
+        return;
+    }
+    const auto* buf = static_cast<const uint8_t*>(canvas_->getBuffer());
+    if (buf == nullptr) {
+        shot_row_.store(-1);
+        return;
+    }
+
+    if (row == 0) {
+        printf("SSHOT begin 240x240 rgb565 rle\r\n");
+    }
+
+    // One hex line per row: "SSHOT <y> " then (count,pixel) runs as
+    // %02X%04X. Worst case (no two equal neighbours) is 240 runs, 1440
+    // hex chars; the buffer is static because the render task stack has
+    // no room for it and this task is the only caller.
+    static char line[1504];
+
+    const int16_t end = std::min<int16_t>(SCREEN_SIZE_,
+                                          static_cast<int16_t>(row + kShotRowsPerPass_));
+    for (; row < end; ++row) {
+        int n = snprintf(line, sizeof(line), "SSHOT %d ", static_cast<int>(row));
+        uint16_t run_px = 0;
+        int run_len = 0;
+        for (int16_t x = 0; x < SCREEN_SIZE_; ++x) {
+            uint16_t px;
+            if (canvas_depth8_) {
+                // RGB332 canvas: widen to RGB565 by bit replication so the
+                // stream is one format regardless of page depth policy.
+                const uint8_t p = buf[static_cast<size_t>(row) * SCREEN_SIZE_ + x];
+                const uint8_t r3 = static_cast<uint8_t>(p >> 5);
+                const uint8_t g3 = static_cast<uint8_t>((p >> 2) & 0x07);
+                const uint8_t b2 = static_cast<uint8_t>(p & 0x03);
+                px = static_cast<uint16_t>((((r3 << 2) | (r3 >> 1)) << 11) |
+                                           (((g3 << 3) | g3) << 5) |
+                                           ((b2 << 3) | (b2 << 1) | (b2 >> 1)));
+            } else {
+                const auto* b16 = reinterpret_cast<const uint16_t*>(buf);
+                px = b16[static_cast<size_t>(row) * SCREEN_SIZE_ + x];
+            }
+            if (run_len > 0 && px == run_px && run_len < 255) {
+                ++run_len;
+                continue;
+            }
+            if (run_len > 0) {
+                n += snprintf(line + n, sizeof(line) - static_cast<size_t>(n),
+                              "%02X%04X", run_len, run_px);
+            }
+            run_px = px;
+            run_len = 1;
+        }
+        if (run_len > 0) {
+            snprintf(line + n, sizeof(line) - static_cast<size_t>(n),
+                     "%02X%04X", run_len, run_px);
+        }
+        printf("%s\r\n", line);
+    }
+
+    if (end >= SCREEN_SIZE_) {
+        printf("SSHOT end\r\n");
+        shot_row_.store(-1);
+    } else {
+        shot_row_.store(end);
+    }
+}
+
+namespace {
+
+// Compiled slide keyframes: easeInOutCubic sampled at the six fixed frame
+// deadlines of the transition and quantized to pixel offsets, so the
+// per-frame work is a table read and two clipped sprite pushes - no easing
+// math runs on the device. The last entry must equal SCREEN_SIZE (the
+// incoming page ends flush with the panel).
+constexpr uint8_t kSlideKeyframes_[] = {4, 36, 120, 204, 236, 240};
+constexpr uint32_t kSlideFramePeriodMs_ = 33;
+
+}  // namespace
+
+bool ui::UiController::transitionStart_() noexcept
+{
+    if (canvas_ == nullptr || canvas_->getBuffer() == nullptr) {
+        return false;
+    }
+    trans_snap_ = new LGFX_Sprite(&M5.Display);
+    if (trans_snap_ == nullptr) {
+        return false;
+    }
+    // Snapshot at the outgoing frame's depth; renderFrame_ may switch the
+    // canvas depth for the incoming page, and the panel push converts each
+    // sprite from its own depth regardless.
+    trans_snap_->setColorDepth(canvas_depth8_ ? 8 : 16);
+    sprite_mem::PlaceRetained(*trans_snap_);
+    trans_snap_->createSprite(SCREEN_SIZE_, SCREEN_SIZE_);
+    if (trans_snap_->getBuffer() == nullptr) {
+        // Out of RAM: the page switch stays an instant cut.
+        delete trans_snap_;
+        trans_snap_ = nullptr;
+        return false;
+    }
+    const size_t bytes = static_cast<size_t>(SCREEN_SIZE_) * SCREEN_SIZE_ *
+                         (canvas_depth8_ ? 1U : 2U);
+    memcpy(trans_snap_->getBuffer(), canvas_->getBuffer(), bytes);
+    return true;
+}
+
+void ui::UiController::playTransition_(bool back) noexcept
+{
+    // Slide the freshly rendered canvas over the outgoing snapshot, both
+    // pushed straight to the panel at offsets from the compiled keyframe
+    // table. Runs in the flush phase with the UI mutex released, on the
+    // same fixed-deadline pacing as the animation governor: each keyframe
+    // costs one screen's worth of (clipped) pixels, so a slide is six
+    // full-frame flushes spread over ~200 ms. Entering a page slides the
+    // new content in from the right; `back` (returning to the landing
+    // menu) reverses the direction.
+    TRACE_SCOPE("slideTransition");
+    TickType_t wake_tick = xTaskGetTickCount();
+    for (uint8_t off : kSlideKeyframes_) {
+        const int16_t dx = static_cast<int16_t>(off);
+        if (back) {
+            trans_snap_->pushSprite(&M5.Display, dx, 0);
+            canvas_->pushSprite(&M5.Display, static_cast<int16_t>(dx - SCREEN_SIZE_), 0);
+        } else {
+            trans_snap_->pushSprite(&M5.Display, static_cast<int16_t>(-dx), 0);
+            canvas_->pushSprite(&M5.Display, static_cast<int16_t>(SCREEN_SIZE_ - dx), 0);
+        }
+        if (xTaskDelayUntil(&wake_tick, pdMS_TO_TICKS(kSlideFramePeriodMs_)) == pdFALSE) {
+            wake_tick = xTaskGetTickCount();  // Slow keyframe: re-anchor, don't burst
+        }
+    }
+    trans_snap_->deleteSprite();
+    delete trans_snap_;
+    trans_snap_ = nullptr;
+
+    // The final keyframe left the full canvas on the panel; seed the row
+    // digest table to match so the next differential flush starts clean.
+    const size_t row_bytes = canvas_depth8_ ? static_cast<size_t>(SCREEN_SIZE_)
+                                            : static_cast<size_t>(SCREEN_SIZE_) * 2;
+    const auto* buf = static_cast<const uint8_t*>(canvas_->getBuffer());
+    if (buf != nullptr) {
+        for (int16_t y = 0; y < SCREEN_SIZE_; ++y) {
+            row_digest_[y] = rowDigest_(buf + static_cast<size_t>(y) * row_bytes, row_bytes);
+        }
+        row_digest_valid_ = true;
+    }
+}
+
+uint32_t ui::UiController::liveCounterFingerprint_(const RenderSnapshot& snap,
+                                                   uint32_t now_ms) const noexcept
+{
+    uint32_t h = 2166136261U;  // FNV-1a
+    const auto mix = [&h](const void* data, size_t len) noexcept {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < len; ++i) {
+            h ^= p[i];
+            h *= 16777619U;
+        }
+    };
+
+    mix(&snap.conn, sizeof(snap.conn));
+    mix(&snap.have_status, sizeof(snap.have_status));
+    mix(&snap.status, sizeof(snap.status));
+    mix(&snap.active_unit, sizeof(snap.active_unit));
+    mix(&snap.unit_count, sizeof(snap.unit_count));
+
+    // Popups and overlays layered over the counter.
+    mix(&live_popup_mode_, sizeof(live_popup_mode_));
+    mix(&live_popup_selection_, sizeof(live_popup_selection_));
+    mix(&spec_.expected_state, sizeof(spec_.expected_state));
+    mix(&spec_.command_id, sizeof(spec_.command_id));
+
+    // Quick-settings editor state (values, focus, staged-edit badges).
+    mix(&quick_settings_index_, sizeof(quick_settings_index_));
+    mix(&quick_settings_editing_, sizeof(quick_settings_editing_));
+    mix(&quick_settings_confirm_popup_, sizeof(quick_settings_confirm_popup_));
+    mix(&quick_settings_confirm_sel_, sizeof(quick_settings_confirm_sel_));
+    mix(&quick_editor_f32_new_, sizeof(quick_editor_f32_new_));
+    mix(&quick_editor_f32_step_, sizeof(quick_editor_f32_step_));
+    mix(&quick_editor_u32_new_, sizeof(quick_editor_u32_new_));
+    mix(&quick_editor_u32_step_, sizeof(quick_editor_u32_step_));
+    mix(&quick_pending_mask_, sizeof(quick_pending_mask_));
+    mix(&quick_inflight_mask_, sizeof(quick_inflight_mask_));
+    mix(&edit_settings_.test_unit.oscillation_vmax_rpm, sizeof(float));
+    mix(&edit_settings_.test_unit.oscillation_amax_rev_s2, sizeof(float));
+    mix(&edit_settings_.test_unit.dwell_time_ms, sizeof(uint32_t));
+    mix(&edit_settings_.test_unit.cycle_amount, sizeof(uint32_t));
+
+    // Rate readout and trend graph follow the history ring, which can grow
+    // on a keepalive once the spacing gate passes.
+    const size_t hist_n = cycle_history_.size();
+    mix(&hist_n, sizeof(hist_n));
+    if (hist_n > 0) {
+        const auto& newest = cycle_history_.at(hist_n - 1);
+        mix(&newest, sizeof(newest));
+    }
+
+    // Signal bars on the connection indicator.
+    uint8_t bars = 255;
+    uint8_t mac[6];
+    espnow::PeerLinkQuality qual;
+    if (snap.conn != ConnStatus::Disconnected && activeUnitMac_(mac) &&
+        espnow::GetPeerLinkQuality(mac, qual)) {
+        bars = static_cast<uint8_t>(signalBars_(qual.rssi_dbm));
+    }
+    mix(&bars, sizeof(bars));
+
+    // Phase bucket: while the connection dot pulses or a SENDING overlay
+    // can expire, the fingerprint must keep moving so frames still render
+    // at the page's refresh period.
+    const uint32_t phase = (snap.conn != ConnStatus::Connected || spec_.since_ms != 0)
+                               ? (now_ms / 400U)
+                               : 0U;
+    mix(&phase, sizeof(phase));
+
+    return h;
+}
+
+ui::UiController::LandingSig ui::UiController::landingSignature_(uint32_t now_ms) const noexcept
+{
+    LandingSig sig;
+    sig.conn = frame_snapshot_.conn;
+    sig.have_status = frame_snapshot_.have_status;
+    sig.state = frame_snapshot_.status.state;
+    sig.cycle = frame_snapshot_.status.cycle_number;
+    sig.selected = menu_selector_.getSelectedIndex();
+    sig.animating = menu_selector_.isAnimating(now_ms);
+    // The connecting indicator pulses; bucket its phase so it still updates
+    // at the page's 500 ms refresh while everything else is cached.
+    sig.pulse_bucket = (sig.conn == ConnStatus::Connecting) ? (now_ms / 500U) : 0U;
+    sig.unit = frame_snapshot_.active_unit;
+    sig.unit_count = frame_snapshot_.unit_count;
+    sig.mru = mru_active_ ? static_cast<uint8_t>(mru_index_ + 1) : 0;
+    return sig;
 }
 
 void ui::UiController::drawCircularLanding_(uint32_t now_ms) noexcept
 {
+    // Incremental frame (see renderFrame_): everything but the selector dot
+    // is unchanged, so erase its old position and redraw it at the new one.
+    if (landing_incremental_) {
+        const int16_t r = static_cast<int16_t>(menu_config_.selector_dot_radius + 1);
+        canvas_->fillRect(static_cast<int16_t>(landing_prev_dot_x_ - r),
+                          static_cast<int16_t>(landing_prev_dot_y_ - r),
+                          static_cast<int16_t>(2 * r + 1), static_cast<int16_t>(2 * r + 1),
+                          TFT_BLACK);
+        drawCircularMenuSelector_(now_ms);
+        const Point2D dot = menu_selector_.getSelectorPosition(now_ms);
+        landing_prev_dot_x_ = static_cast<int16_t>(dot.x);
+        landing_prev_dot_y_ = static_cast<int16_t>(dot.y);
+        return;
+    }
+
     // Black background (already filled in draw_)
-    
+
     // Draw circular outer ring (subtle)
     const int16_t cx = menu_config_.center_x;
     const int16_t cy = menu_config_.center_y;
-    canvas_->drawCircle(cx, cy, 119, 0x2104);  // Subtle ring at edge
+    canvas_->drawCircle(cx, cy, 119, thm().bg_card);  // Subtle ring at edge
 
     // Connection status pill (centered, below the Settings menu icon).
+    // With more than one approved unit the label is prefixed with the active
+    // unit number and tapping the pill cycles units (onTouchClick_).
     {
-        const char* conn_text = "DISCONNECTED";
-        uint16_t conn_color = colors::accent_red;
-        switch (conn_status_) {
+        const char* conn_state = "DISCONNECTED";
+        uint16_t conn_color = thm().accent_red;
+        switch (frame_snapshot_.conn) {
             case ConnStatus::Connected:
-                conn_text = "CONNECTED";
-                conn_color = colors::accent_green;
+                conn_state = "CONNECTED";
+                conn_color = thm().accent_green;
                 break;
             case ConnStatus::Connecting:
-                conn_text = "CONNECTING";
-                conn_color = colors::accent_yellow;
+                conn_state = "CONNECTING";
+                conn_color = thm().accent_yellow;
                 break;
             case ConnStatus::Disconnected:
             default:
                 break;
         }
+        char conn_text[24];
+        if (frame_snapshot_.unit_count > 1) {
+            snprintf(conn_text, sizeof(conn_text), "U%u %s",
+                     static_cast<unsigned>(frame_snapshot_.active_unit + 1), conn_state);
+        } else {
+            snprintf(conn_text, sizeof(conn_text), "%s", conn_state);
+        }
 
         constexpr int16_t kPillH = 16;
         constexpr int16_t kPadX = 8;
@@ -2060,7 +7488,7 @@ void ui::UiController::drawCircularLanding_(uint32_t now_ms) noexcept
         const int16_t pill_center_y = static_cast<int16_t>(settings_y + menu_config_.icon_bg_radius + kGap + (kPillH / 2));
 
         canvas_->setTextSize(1);
-        const int16_t tw = static_cast<int16_t>(canvas_->textWidth(conn_text));
+        const int16_t tw = measureText_(conn_text);
         const int16_t pill_w = static_cast<int16_t>(tw + (kPadX * 2));
         int16_t pill_x = static_cast<int16_t>(cx - (pill_w / 2));
         int16_t pill_y = static_cast<int16_t>(pill_center_y - (kPillH / 2));
@@ -2068,7 +7496,7 @@ void ui::UiController::drawCircularLanding_(uint32_t now_ms) noexcept
         if ((pill_x + pill_w) > 236) pill_x = static_cast<int16_t>(236 - pill_w);
         if (pill_y < 4) pill_y = 4;
 
-        canvas_->fillRoundRect(pill_x, pill_y, pill_w, kPillH, kRadius, colors::bg_card);
+        canvas_->fillRoundRect(pill_x, pill_y, pill_w, kPillH, kRadius, thm().bg_card);
         canvas_->drawRoundRect(pill_x, pill_y, pill_w, kPillH, kRadius, conn_color);
         canvas_->setTextColor(conn_color);
         canvas_->setTextDatum(textdatum_t::middle_left);
@@ -2095,11 +7523,11 @@ void ui::UiController::drawCircularLanding_(uint32_t now_ms) noexcept
     constexpr int16_t kPillH = 18;
     constexpr int16_t kPillPadX = 10;
     constexpr int16_t kPillTextY = 5;
-    constexpr uint16_t kPillFill = 0x2104; // subtle dark fill (matches outer ring)
+    const uint16_t kPillFill = thm().bg_card; // subtle dark fill (matches outer ring)
 
     auto draw_pill = [&](const char* text, uint16_t border_color, uint16_t text_color) {
         canvas_->setTextSize(1);
-        const int16_t tw = static_cast<int16_t>(canvas_->textWidth(text));
+        const int16_t tw = measureText_(text);
         const int16_t pill_w = static_cast<int16_t>(tw + (kPillPadX * 2));
         const int16_t pill_x = static_cast<int16_t>(cx - (pill_w / 2));
         const int16_t pill_y = static_cast<int16_t>(status_center_y - (kPillH / 2));
@@ -2110,40 +7538,217 @@ void ui::UiController::drawCircularLanding_(uint32_t now_ms) noexcept
         canvas_->print(text);
     };
 
-    // Only show status if connected - don't show stale "Idle" or "Running" when disconnected
-    if (conn_status_ == ConnStatus::Connected && have_status_) {
+    // Only show status if connected - don't show stale "Idle" or "Running" when disconnected.
+    // Reads the per-frame snapshot so the proto handler can't tear it mid-draw.
+    if (frame_snapshot_.conn == ConnStatus::Connected && frame_snapshot_.have_status) {
         const char* state_str = "IDLE";
-        uint16_t state_color = colors::state_idle;
-        switch (static_cast<fatigue_proto::TestState>(last_status_.state)) {
+        uint16_t state_color = thm().state_idle;
+        switch (static_cast<fatigue_proto::TestState>(frame_snapshot_.status.state)) {
             case fatigue_proto::TestState::Running:
                 state_str = "RUNNING";
-                state_color = colors::state_running;
+                state_color = thm().state_running;
                 break;
             case fatigue_proto::TestState::Paused:
                 state_str = "PAUSED";
-                state_color = colors::state_paused;
+                state_color = thm().state_paused;
                 break;
             case fatigue_proto::TestState::Error:
                 state_str = "ERROR";
-                state_color = colors::state_error;
+                state_color = thm().state_error;
                 break;
             default:
                 break;
         }
 
         char status_buf[32];
-        snprintf(status_buf, sizeof(status_buf), "%s #%" PRIu32, state_str, last_status_.cycle_number);
+        snprintf(status_buf, sizeof(status_buf), "%s #%" PRIu32, state_str, frame_snapshot_.status.cycle_number);
         draw_pill(status_buf, state_color, state_color);
-    } else if (conn_status_ == ConnStatus::Connecting) {
+    } else if (frame_snapshot_.conn == ConnStatus::Connecting) {
         // Animated connecting indicator (dots)
         const int dot_count = ((now_ms / 500) % 4);
         char conn_buf[20] = "WAITING";
         for (int i = 0; i < dot_count; ++i) {
             strncat(conn_buf, ".", sizeof(conn_buf) - strlen(conn_buf) - 1);
         }
-        draw_pill(conn_buf, 0x8410, 0xAD55);
+        draw_pill(conn_buf, thm().pill_border_muted, thm().log_text);
     }
     // When disconnected, connection indicator dot (red) is enough - no text needed
+
+    // MRU fast-access overlay (long press on the Settings icon). Its state
+    // rides in the landing signature, so opening/closing always forces a
+    // full frame and the incremental dot path never draws underneath it.
+    if (mru_active_) {
+        drawSettingsMruOverlay_(now_ms);
+    }
+
+    // Full frame drawn: retain it and remember what the dot band covers.
+    const Point2D dot = menu_selector_.getSelectorPosition(now_ms);
+    landing_prev_dot_x_ = static_cast<int16_t>(dot.x);
+    landing_prev_dot_y_ = static_cast<int16_t>(dot.y);
+    landing_sig_ = landingSignature_(now_ms);
+    landing_cache_valid_ = true;
+}
+
+void ui::UiController::drawSettingsMruOverlay_(uint32_t now_ms) noexcept
+{
+    (void)now_ms;
+    constexpr int16_t px = 30;
+    constexpr int16_t py = 56;
+    constexpr int16_t pw = 180;
+    constexpr int16_t ph = 128;
+    canvas_->fillRoundRect(px, py, pw, ph, 12, thm().bg_card);
+    canvas_->drawRoundRect(px, py, pw, ph, 12, thm().popup_border);
+    drawCenteredText_(120, py + 8, "RECENT", thm().text_primary, 1);
+
+    // Rows render straight from the schema table; values are the saved
+    // settings formatted per field type (the editor shows the live ones).
+    constexpr int16_t row_h = 22;
+    int16_t ry = py + 24;
+    for (uint8_t i = 0; i < settings_mru_count_; ++i) {
+        const SettingsFieldDesc& field = kSettingsFields_[settings_mru_[i]];
+        const bool sel = (static_cast<int>(i) == mru_index_);
+        if (sel) {
+            canvas_->fillRoundRect(static_cast<int16_t>(px + 6), ry,
+                                   static_cast<int16_t>(pw - 12),
+                                   static_cast<int16_t>(row_h - 2), 6,
+                                   thm().bg_elevated);
+        }
+        char val[16] = "";
+        if (settings_ != nullptr) {
+            const uint8_t* slot =
+                reinterpret_cast<const uint8_t*>(settings_) + field.offset;
+            switch (field.type) {
+                case SettingsEditorValueType::U32: {
+                    uint32_t v = 0;
+                    std::memcpy(&v, slot, sizeof(v));
+                    const uint32_t div = std::max<uint32_t>(1, field.u32_unit_div);
+                    snprintf(val, sizeof(val), "%lu",
+                             static_cast<unsigned long>((v + div / 2) / div));
+                    break;
+                }
+                case SettingsEditorValueType::F32: {
+                    float v = 0.0f;
+                    std::memcpy(&v, slot, sizeof(v));
+                    snprintf(val, sizeof(val), "%.1f", static_cast<double>(v));
+                    break;
+                }
+                case SettingsEditorValueType::Bool: {
+                    bool v = false;
+                    std::memcpy(&v, slot, sizeof(v));
+                    snprintf(val, sizeof(val), "%s", v ? "ON" : "OFF");
+                    break;
+                }
+                case SettingsEditorValueType::U8: {
+                    uint8_t v = 0;
+                    std::memcpy(&v, slot, 1);
+                    snprintf(val, sizeof(val), "%u", static_cast<unsigned>(v));
+                    break;
+                }
+                case SettingsEditorValueType::I8: {
+                    int8_t v = 0;
+                    std::memcpy(&v, slot, 1);
+                    snprintf(val, sizeof(val), "%d", static_cast<int>(v));
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+        canvas_->setTextSize(1);
+        canvas_->setTextDatum(textdatum_t::middle_left);
+        canvas_->setTextColor(sel ? thm().text_primary : thm().text_secondary);
+        canvas_->drawString(field.label, static_cast<int16_t>(px + 14),
+                            static_cast<int16_t>(ry + row_h / 2 - 1));
+        canvas_->setTextDatum(textdatum_t::middle_right);
+        canvas_->setTextColor(thm().accent_cyan);
+        canvas_->drawString(val, static_cast<int16_t>(px + pw - 14),
+                            static_cast<int16_t>(ry + row_h / 2 - 1));
+        ry = static_cast<int16_t>(ry + row_h);
+    }
+    canvas_->setTextDatum(textdatum_t::top_left);
+    drawCenteredText_(120, static_cast<int16_t>(py + ph - 16), "Click to edit",
+                      thm().text_hint, 1);
+}
+
+uint32_t ui::UiController::settingsRowHash_(const char* label, const char* value,
+                                            bool selected, bool is_category) noexcept
+{
+    // FNV-1a over everything that affects the rendered card.
+    uint32_t h = 2166136261u;
+    const auto mix = [&h](const char* s) {
+        for (; *s != '\0'; ++s) {
+            h = (h ^ static_cast<uint8_t>(*s)) * 16777619u;
+        }
+        h = (h ^ 0xFFu) * 16777619u;  // separator
+    };
+    mix(label);
+    mix(value);
+    h = (h ^ (selected ? 1u : 0u)) * 16777619u;
+    h = (h ^ (is_category ? 2u : 0u)) * 16777619u;
+    return h;
+}
+
+bool ui::UiController::ensureSettingsRow_(SettingsRow& row) noexcept
+{
+    if (row.sprite == nullptr) {
+        row.sprite = new LGFX_Sprite(canvas_);
+        if (row.sprite != nullptr) {
+            row.sprite->setColorDepth(8);
+            sprite_mem::PlaceRetained(*row.sprite);
+            row.sprite->createSprite(kSettingsRowW_, kSettingsRowH_);
+        }
+        row.valid = false;
+    }
+    // Out of RAM: the caller falls back to drawing the card directly.
+    return row.sprite != nullptr && row.sprite->getBuffer() != nullptr;
+}
+
+void ui::UiController::renderSettingsRow_(LGFX_Sprite& s, const char* label, const char* value,
+                                          bool selected, bool is_category) noexcept
+{
+    // Same card layout as the direct path, in row-local coordinates. The
+    // corners blit page-background black, which is what surrounds the
+    // cards anyway, so no transparency handling is needed.
+    s.fillScreen(TFT_BLACK);
+    const uint16_t bg_color = selected ? thm().bg_elevated : thm().bg_card;
+    s.fillRoundRect(0, 0, kSettingsRowW_, kSettingsRowH_, 8, bg_color);
+    if (selected) {
+        s.drawRoundRect(0, 0, kSettingsRowW_, kSettingsRowH_, 8, thm().accent_orange);
+    }
+
+    s.setTextDatum(textdatum_t::middle_left);
+    s.setTextSize(2);
+    s.setTextColor(selected ? TFT_WHITE : thm().text_primary);
+    s.drawString(label, 14, 12);
+
+    s.setTextColor(selected ? thm().accent_yellow : thm().text_secondary);
+    if (s.textWidth(value) > (kSettingsRowW_ - 20)) {
+        s.setTextSize(1);
+    }
+    s.drawString(value, 14, 30);
+    s.setTextDatum(textdatum_t::top_left);
+
+    if (is_category && selected) {
+        s.setTextColor(TFT_WHITE);
+        s.setTextSize(1);
+        s.setCursor(kSettingsRowW_ - 15, 16);
+        s.print(">");
+    }
+}
+
+void ui::UiController::freeSettingsRows_() noexcept
+{
+    for (auto& row : settings_rows_) {
+        if (row.sprite != nullptr) {
+            row.sprite->deleteSprite();
+            delete row.sprite;
+            row.sprite = nullptr;
+        }
+        if (row.valid) {
+            ++cache_stats_[static_cast<size_t>(CacheId::SettingsRows)].evicts;
+        }
+        row.valid = false;
+    }
 }
 
 void ui::UiController::drawSettings_(uint32_t now_ms) noexcept
@@ -2154,17 +7759,28 @@ void ui::UiController::drawSettings_(uint32_t now_ms) noexcept
         enterSettings_();
     }
 
+    // Composite bounds editor screen.
+    if (bounds_tune_active_) {
+        drawBoundsTuneEditor_(now_ms);
+        return;
+    }
+
     // Dedicated value editor screen (optionally with confirm popup overlay).
+    // During an overlay capture pass the popup is withheld so the snapshot
+    // holds only the page beneath it; the inline draws remain as the
+    // compositor's OOM fallback.
     if (settings_value_editor_active_) {
         drawSettingsValueEditor_(now_ms);
-        if (settings_popup_mode_ != SettingsPopupMode::None) {
+        if (settings_popup_mode_ != SettingsPopupMode::None && !overlay_capture_) {
             drawSettingsPopup_(now_ms);
         }
         return;
     }
 
-    // Popup overlay (currently used for value-change confirmation).
-    if (settings_popup_mode_ != SettingsPopupMode::None) {
+    // Popup overlay (currently used for value-change confirmation). A
+    // capture pass falls through and renders the settings list the popup
+    // will float over.
+    if (settings_popup_mode_ != SettingsPopupMode::None && !overlay_capture_) {
         drawSettingsPopup_(now_ms);
         return;
     }
@@ -2181,19 +7797,18 @@ void ui::UiController::drawSettings_(uint32_t now_ms) noexcept
     int item_count = 0;
     const char* title = "SETTINGS";
     
-    // Array to store labels and values
+    // Array to store labels (values format lazily, per visible row)
     const char* labels[8]{};
-    char values[8][24]{};
-    
+
     // Main menu labels
-    static const char* main_labels[] = {"< Back", "Fatigue Test", "Bounds Finding", "UI Settings"};
-    static const char* main_values[] = {"Return to home", "Motion settings", "Stall detection", "Display options"};
+    static const char* main_labels[] = {"< Back", "Fatigue Test", "Bounds Finding", "UI Settings", "Profiles"};
+    static const char* main_values[] = {"Return to home", "Motion settings", "Stall detection", "Display options", "Fixture setups"};
     
     // Fatigue Test labels - PROTOCOL V2: velocity/acceleration control
     static const char* fatigue_labels[] = {"< Back", "Cycles", "VMAX (RPM)", kLabelAmaxRevPerS2Ui, "Dwell (s)"};
     
     // Bounds Finding labels
-    static const char* bounds_labels[] = {"< Back", "Mode", "Search Speed", "SG Min Vel", "SGT", "Stall Factor", "Search Accel"};
+    static const char* bounds_labels[] = {"< Back", "Mode", "Search Speed", "SG Min Vel", "SGT", "Stall Factor", "Search Accel", "Tune All"};
     
     // UI labels
     static const char* ui_labels[] = {"< Back", "Brightness"};
@@ -2202,115 +7817,186 @@ void ui::UiController::drawSettings_(uint32_t now_ms) noexcept
         case SettingsCategory::Main:
             title = "SETTINGS";
             item_count = 4;
-            for (int i = 0; i < item_count; ++i) {
-                labels[i] = main_labels[i];
-                snprintf(values[i], sizeof(values[i]), "%s", main_values[i]);
-            }
+            for (int i = 0; i < item_count; ++i) labels[i] = main_labels[i];
             break;
-            
+
         case SettingsCategory::FatigueTest:
             title = "FATIGUE TEST";
             item_count = 5;  // Back, Cycles, VMAX, AMAX, Dwell
             for (int i = 0; i < item_count; ++i) labels[i] = fatigue_labels[i];
-            snprintf(values[0], sizeof(values[0]), "Back to settings");
-            snprintf(values[1], sizeof(values[1]), "%" PRIu32, edit_settings_.test_unit.cycle_amount);
-            snprintf(values[2], sizeof(values[2]), "%.1f", static_cast<double>(edit_settings_.test_unit.oscillation_vmax_rpm));
-            snprintf(values[3], sizeof(values[3]), "%.1f", static_cast<double>(edit_settings_.test_unit.oscillation_amax_rev_s2));
-            if ((edit_settings_.test_unit.dwell_time_ms % 1000u) == 0u) {
-                snprintf(values[4], sizeof(values[4]), "%" PRIu32, (edit_settings_.test_unit.dwell_time_ms / 1000u));
-            } else {
-                snprintf(values[4], sizeof(values[4]), "%.1f", static_cast<double>(edit_settings_.test_unit.dwell_time_ms) / 1000.0);
-            }
             break;
-            
+
         case SettingsCategory::BoundsFinding:
             title = "BOUNDS";
-            item_count = 7;
+            item_count = 8;
             for (int i = 0; i < item_count; ++i) labels[i] = bounds_labels[i];
-            snprintf(values[0], sizeof(values[0]), "Back to settings");
-            snprintf(values[1], sizeof(values[1]), "%s", edit_settings_.test_unit.bounds_method_stallguard ? "StallGuard" : "Encoder");
-            snprintf(values[2], sizeof(values[2]), "%.1f rpm", static_cast<double>(edit_settings_.test_unit.bounds_search_velocity_rpm));
-            snprintf(values[3], sizeof(values[3]), "%.1f rpm", static_cast<double>(edit_settings_.test_unit.stallguard_min_velocity_rpm));
-            if (edit_settings_.test_unit.stallguard_sgt == 127) {
-                snprintf(values[4], sizeof(values[4]), "%s", "Default");
-            } else {
-                snprintf(values[4], sizeof(values[4]), "%d", static_cast<int>(edit_settings_.test_unit.stallguard_sgt));
-            }
-            snprintf(values[5], sizeof(values[5]), "%.1fx", static_cast<double>(edit_settings_.test_unit.stall_detection_current_factor));
-            snprintf(values[6], sizeof(values[6]), "%.1f %s", static_cast<double>(edit_settings_.test_unit.bounds_search_accel_rev_s2), kUnitRevPerS2Ui);
             break;
-            
+
         case SettingsCategory::UI:
             title = "UI SETTINGS";
             item_count = 2;
             for (int i = 0; i < item_count; ++i) labels[i] = ui_labels[i];
-            snprintf(values[0], sizeof(values[0]), "Back to settings");
-            snprintf(values[1], sizeof(values[1]), "%d%%", static_cast<int>(edit_settings_.ui.brightness * 100 / 255));
+            break;
+
+        case SettingsCategory::Profiles:
+            title = "PROFILES";
+            item_count = 1 + static_cast<int>(SettingsStore::kProfileSlots);
+            labels[0] = "< Back";
+            for (int i = 0; i < static_cast<int>(SettingsStore::kProfileSlots); ++i) {
+                labels[i + 1] = profile_used_[i] ? profiles_[i].name : "Empty slot";
+            }
             break;
     }
-    
-    // === DRAW MENU ITEMS (all drawing to canvas_ for flicker-free) ===
+
+    // Row values format on demand, per visible row, into arena scratch:
+    // the scroll cull in the draw loop skips rows outside the window, and
+    // a culled row never pays its snprintf (float formatting dominates
+    // this page's non-drawing cost). Strings live until the arena resets
+    // at the next frame, well past the row-cache hash and render below.
+    const auto& tu = edit_settings_.test_unit;
+    auto format_value = [&](int i) -> const char* {
+        switch (settings_category_) {
+            case SettingsCategory::Main:
+                if (i == 4 && profile_offer_slot_ >= 0 &&
+                    profile_used_[profile_offer_slot_]) {
+                    // A remembered profile matches the active unit: surface
+                    // it right on the main level (see offerProfileForActive_).
+                    return frame_arena_.fmt(24, "Offer: %s",
+                                            profiles_[profile_offer_slot_].name);
+                }
+                return main_values[i];
+            case SettingsCategory::FatigueTest:
+                switch (i) {
+                    case 1: {
+                        char grouped[16];
+                        formatGrouped_(tu.cycle_amount, grouped, sizeof(grouped));
+                        return frame_arena_.fmt(24, "%s", grouped);
+                    }
+                    case 2: return frame_arena_.fmt(24, "%.1f", static_cast<double>(tu.oscillation_vmax_rpm));
+                    case 3: return frame_arena_.fmt(24, "%.1f", static_cast<double>(tu.oscillation_amax_rev_s2));
+                    case 4:
+                        if ((tu.dwell_time_ms % 1000u) == 0u) {
+                            return frame_arena_.fmt(24, "%" PRIu32, tu.dwell_time_ms / 1000u);
+                        }
+                        return frame_arena_.fmt(24, "%.1f", static_cast<double>(tu.dwell_time_ms) / 1000.0);
+                    default: return "Back to settings";
+                }
+            case SettingsCategory::BoundsFinding:
+                switch (i) {
+                    case 1: return tu.bounds_method_stallguard ? "StallGuard" : "Encoder";
+                    case 2: return frame_arena_.fmt(24, "%.1f rpm", static_cast<double>(tu.bounds_search_velocity_rpm));
+                    case 3: return frame_arena_.fmt(24, "%.1f rpm", static_cast<double>(tu.stallguard_min_velocity_rpm));
+                    case 4:
+                        if (tu.stallguard_sgt == 127) {
+                            return "Default";
+                        }
+                        return frame_arena_.fmt(24, "%d", static_cast<int>(tu.stallguard_sgt));
+                    case 5: return frame_arena_.fmt(24, "%.1fx", static_cast<double>(tu.stall_detection_current_factor));
+                    case 6: return frame_arena_.fmt(24, "%.1f %s", static_cast<double>(tu.bounds_search_accel_rev_s2), kUnitRevPerS2Ui);
+                    case 7: return "Edit as a set";
+                    default: return "Back to settings";
+                }
+            case SettingsCategory::UI:
+                if (i == 1) {
+                    return frame_arena_.fmt(24, "%d%%", static_cast<int>(edit_settings_.ui.brightness * 100 / 255));
+                }
+                return "Back to settings";
+            case SettingsCategory::Profiles: {
+                if (i == 0) {
+                    return "Back to settings";
+                }
+                const int slot = i - 1;
+                if (!profile_used_[slot]) {
+                    return "Click: save current";
+                }
+                // Summary so slots are tellable apart without applying;
+                // the star marks the slot remembered for this unit.
+                return frame_arena_.fmt(
+                    24, "%" PRIu32 " cyc  %.0f rpm%s",
+                    profiles_[slot].test_unit.cycle_amount,
+                    static_cast<double>(profiles_[slot].test_unit.oscillation_vmax_rpm),
+                    (profile_offer_slot_ == slot) ? " *" : "");
+            }
+        }
+        return "";
+    };
+
+    // === DRAW MENU ITEMS ===
+    // Commands go to the per-frame draw list instead of straight to the
+    // canvas: the cards land in layer 0, the header chrome that overdraws
+    // them in layer 1, and execute() replays everything scanline-ordered
+    // in one startWrite batch with text-state changes elided.
     constexpr int16_t header_h = 54;
+    draw_list_.begin(canvas_);
     for (int i = 0; i < item_count; ++i) {
         const float item_y_offset = (static_cast<float>(i) * kSettingsItemHeight_) - settings_anim_offset_;
         const int16_t item_y = menu_center_y + static_cast<int16_t>(item_y_offset);
 
         if (item_y < (header_h + 4) || item_y > 192) continue;
-        
+
+        const char* value = format_value(i);
         const bool selected = (settings_index_ == i);
         const bool is_category = (settings_category_ == SettingsCategory::Main && i > 0);
         const bool editing = false; // No inline editing; value changes happen in a dedicated editor screen.
         
-        // Draw item card - inline to use canvas_
         const int16_t card_x = 25;
-        const int16_t card_w = 190;
-        const int16_t card_h = 40;
-        
-        // Card background
-        uint16_t bg_color = colors::bg_card;
+        const int16_t card_w = kSettingsRowW_;
+        const int16_t card_h = kSettingsRowH_;
+        const int16_t card_top = static_cast<int16_t>(item_y - card_h / 2);
+
+        // Row cache: the card renders once into a pooled row sprite keyed
+        // by its content; every scroll-animation step after that is one
+        // vertical blit. Selection changes re-render just the two rows
+        // whose hash moved.
+        SettingsRow& row = settings_rows_[i % kSettingsRowPool_];
+        const uint32_t row_hash = settingsRowHash_(labels[i], value, selected, is_category);
+        cacheNote_(CacheId::SettingsRows, row.valid && row.hash == row_hash);
+        if (ensureSettingsRow_(row)) {
+            if (!row.valid || row.hash != row_hash) {
+                renderSettingsRow_(*row.sprite, labels[i], value, selected, is_category);
+                row.hash = row_hash;
+                row.valid = true;
+            }
+            row.sprite->pushSprite(canvas_, card_x, card_top);
+            continue;
+        }
+
+        // Sprite pool allocation failed: draw the card directly through
+        // the command list (pre-cache behavior).
+        uint16_t bg_color = thm().bg_card;
         if (selected) {
-            bg_color = editing ? colors::accent_blue : colors::bg_elevated;
+            bg_color = editing ? thm().accent_blue : thm().bg_elevated;
         }
-        canvas_->fillRoundRect(card_x, item_y - card_h/2, card_w, card_h, 8, bg_color);
-        
-        // Selection ring
+        draw_list_.fillRoundRect(0, card_x, card_top, card_w, card_h, 8, bg_color);
         if (selected) {
-            canvas_->drawRoundRect(card_x, item_y - card_h/2, card_w, card_h, 8, 
-                                   editing ? TFT_WHITE : colors::accent_orange);
+            draw_list_.drawRoundRect(0, card_x, card_top, card_w, card_h, 8,
+                                     editing ? TFT_WHITE : thm().accent_orange);
         }
         
-        // Label (vertically centered upper half)
-        canvas_->setTextSize(2);
-        canvas_->setTextColor(selected ? TFT_WHITE : colors::text_primary);
-        canvas_->setTextDatum(textdatum_t::middle_left);
-        // Place label at 1/3 from top of card
-        int16_t label_y = item_y - 8;
-        canvas_->drawString(labels[i], card_x + 14, label_y);
+        // Label at 1/3 from top of card, value at 2/3; the value drops to
+        // size 1 when it would overflow the card (measured here, in build
+        // order, since textWidth depends on the current size).
+        const int16_t label_y = item_y - 8;
+        draw_list_.text(0, labels[i], card_x + 14, label_y, 2,
+                        selected ? TFT_WHITE : thm().text_primary,
+                        textdatum_t::middle_left);
 
-        // Value: vertically centered lower half, never overflow card
-        canvas_->setTextColor(selected ? colors::accent_yellow : colors::text_secondary);
         canvas_->setTextSize(2);
-        int16_t vw = static_cast<int16_t>(canvas_->textWidth(values[i]));
-        if (vw > (card_w - 20)) {
-            canvas_->setTextSize(1);
-        }
-        // Place value at 2/3 from top of card
-        int16_t value_y = item_y + 10;
-        canvas_->drawString(values[i], card_x + 14, value_y);
-        canvas_->setTextDatum(textdatum_t::top_left); // restore default
+        const int16_t vw = measureText_(value);
+        const uint8_t value_size = (vw > (card_w - 20)) ? 1 : 2;
+        const int16_t value_y = item_y + 10;
+        draw_list_.text(0, value, card_x + 14, value_y, value_size,
+                        selected ? thm().accent_yellow : thm().text_secondary,
+                        textdatum_t::middle_left);
         
-        // Draw chevron for categories (Main menu items 1-3)
+        // Chevron for categories (Main menu items 1-3)
         if (is_category && selected) {
-            canvas_->setTextColor(TFT_WHITE);
-            canvas_->setTextSize(1);
-            canvas_->setCursor(card_x + card_w - 15, item_y - 4);
-            canvas_->print(">");
+            draw_list_.text(0, ">", card_x + card_w - 15, item_y - 4, 1, TFT_WHITE);
         }
     }
     
-    // === TITLE (drawn after items for clean layering) ===
-    canvas_->fillRect(0, 0, 240, header_h, lgfx::color565(15, 15, 20));
-    canvas_->setTextColor(0xFA7000);
+    // === TITLE (layer 1: overdraws cards sliding under the header) ===
+    draw_list_.fillRect(1, 0, 0, 240, header_h, lgfx::color565(15, 15, 20));
     {
         // Fit title to circular safe area at y~26 (avoid clipping on round display)
         const float r = 118.0f;
@@ -2320,13 +8006,14 @@ void ui::UiController::drawSettings_(uint32_t now_ms) noexcept
         const int16_t max_w = static_cast<int16_t>(std::max(0.0f, (half * 2.0f) - 28.0f));
 
         canvas_->setTextSize(2);
-        int16_t title_w = static_cast<int16_t>(canvas_->textWidth(title));
+        int16_t title_w = measureText_(title);
+        uint8_t title_size = 2;
         if (title_w > max_w) {
             canvas_->setTextSize(1);
-            title_w = static_cast<int16_t>(canvas_->textWidth(title));
+            title_w = measureText_(title);
+            title_size = 1;
         }
-        canvas_->setCursor(cx - title_w / 2, 12);
-        canvas_->print(title);
+        draw_list_.text(1, title, cx - title_w / 2, 12, title_size, 0xFA7000);
     }
     
     // === SCROLL INDICATOR ===
@@ -2342,13 +8029,11 @@ void ui::UiController::drawSettings_(uint32_t now_ms) noexcept
         const float dx = std::sqrt(std::max(0.0f, r * r - dy * dy));
         const int16_t ind_x = 120 + static_cast<int16_t>(dx);
         
-        canvas_->fillSmoothCircle(ind_x, ind_y, 5, 0xFA7000);
+        draw_list_.fillSmoothCircle(1, ind_x, ind_y, 5, 0xFA7000);
     }
     
     // === BREADCRUMB (show path when in sub-category) ===
     if (settings_category_ != SettingsCategory::Main) {
-        canvas_->setTextSize(1);
-        canvas_->setTextColor(colors::text_hint);
         const float r = 118.0f;
         const float cy_safe = 120.0f;
         const int16_t crumb_y = 34;
@@ -2356,16 +8041,18 @@ void ui::UiController::drawSettings_(uint32_t now_ms) noexcept
         const float half = std::sqrt(std::max(0.0f, r * r - dy * dy));
         const int16_t max_w = static_cast<int16_t>(std::max(0.0f, (half * 2.0f) - 18.0f));
 
+        canvas_->setTextSize(1);
         const char* crumb = "Settings >";
-        int16_t w = static_cast<int16_t>(canvas_->textWidth(crumb));
+        int16_t w = measureText_(crumb);
         if (w > max_w) {
             crumb = "Settings";
-            w = static_cast<int16_t>(canvas_->textWidth(crumb));
+            w = measureText_(crumb);
         }
 
-        canvas_->setCursor(cx - w / 2, crumb_y);
-        canvas_->print(crumb);
+        draw_list_.text(1, crumb, cx - w / 2, crumb_y, 1, thm().text_hint);
     }
+
+    draw_list_.execute();
 }
 
 void ui::UiController::drawSettingsValueEditor_(uint32_t now_ms) noexcept
@@ -2376,8 +8063,8 @@ void ui::UiController::drawSettingsValueEditor_(uint32_t now_ms) noexcept
     const int16_t cy = 120;
 
     // Background
-    canvas_->fillScreen(colors::bg_primary);
-    canvas_->drawCircle(cx, cy, 118, colors::bg_card);
+    canvas_->fillScreen(thm().bg_primary);
+    canvas_->drawCircle(cx, cy, 118, thm().bg_card);
 
     // Resolve label + formatting for the current editor target
     const char* label = "";
@@ -2404,12 +8091,13 @@ void ui::UiController::drawSettingsValueEditor_(uint32_t now_ms) noexcept
             if (settings_editor_index_ == 1) { label = "Brightness"; unit = "%"; }
             break;
         case SettingsCategory::Main:
+        case SettingsCategory::Profiles:
             break;
     }
 
     // Header bar
-    canvas_->fillRect(0, 0, 240, 44, colors::bg_elevated);
-    canvas_->setTextColor(colors::accent_orange);
+    canvas_->fillRect(0, 0, 240, 44, thm().bg_elevated);
+    canvas_->setTextColor(thm().accent_orange);
 
     // Fit the title to the circular top area (shrink, then split if needed)
     const float r = 118.0f;
@@ -2421,7 +8109,7 @@ void ui::UiController::drawSettingsValueEditor_(uint32_t now_ms) noexcept
 
     const int16_t max_w_size2 = maxWidthAtY(22, 18);
     canvas_->setTextSize(2);
-    int16_t lw = static_cast<int16_t>(canvas_->textWidth(label));
+    int16_t lw = measureText_(label);
 
     if (lw <= max_w_size2) {
         canvas_->setCursor(cx - lw / 2, 14);
@@ -2430,7 +8118,7 @@ void ui::UiController::drawSettingsValueEditor_(uint32_t now_ms) noexcept
         // Try smaller text
         const int16_t max_w_size1 = maxWidthAtY(24, 18);
         canvas_->setTextSize(1);
-        lw = static_cast<int16_t>(canvas_->textWidth(label));
+        lw = measureText_(label);
 
         if (lw <= max_w_size1) {
             canvas_->setCursor(cx - lw / 2, 18);
@@ -2457,15 +8145,15 @@ void ui::UiController::drawSettingsValueEditor_(uint32_t now_ms) noexcept
             }
 
             canvas_->setTextSize(1);
-            canvas_->setTextColor(colors::accent_orange);
+            canvas_->setTextColor(thm().accent_orange);
 
             if (line2[0] == '\0') {
-                const int16_t w1 = static_cast<int16_t>(canvas_->textWidth(line1));
+                const int16_t w1 = measureText_(line1);
                 canvas_->setCursor(cx - w1 / 2, 18);
                 canvas_->print(line1);
             } else {
-                const int16_t w1 = static_cast<int16_t>(canvas_->textWidth(line1));
-                const int16_t w2 = static_cast<int16_t>(canvas_->textWidth(line2));
+                const int16_t w1 = measureText_(line1);
+                const int16_t w2 = measureText_(line2);
                 canvas_->setCursor(cx - w1 / 2, 12);
                 canvas_->print(line1);
                 canvas_->setCursor(cx - w2 / 2, 26);
@@ -2488,16 +8176,24 @@ void ui::UiController::drawSettingsValueEditor_(uint32_t now_ms) noexcept
                 const double new_s = static_cast<double>(settings_editor_u32_new_) * 0.1;
                 snprintf(old_buf, sizeof(old_buf), "Old: %.1f %s", old_s, unit);
                 snprintf(new_buf, sizeof(new_buf), "%.1f %s", new_s, unit);
-            } else if (has_unit) {
-                snprintf(old_buf, sizeof(old_buf), "Old: %" PRIu32 " %s", settings_editor_u32_old_, unit);
-                if (render_unit_separately) {
-                    snprintf(new_value_only, sizeof(new_value_only), "%" PRIu32, settings_editor_u32_new_);
+            } else {
+                // Grouped digits: the 10x target entry error happened in
+                // this editor, staring at an ungrouped digit run.
+                char old_g[16];
+                char new_g[16];
+                formatGrouped_(settings_editor_u32_old_, old_g, sizeof(old_g));
+                formatGrouped_(settings_editor_u32_new_, new_g, sizeof(new_g));
+                if (has_unit) {
+                    snprintf(old_buf, sizeof(old_buf), "Old: %s %s", old_g, unit);
+                    if (render_unit_separately) {
+                        snprintf(new_value_only, sizeof(new_value_only), "%s", new_g);
+                    } else {
+                        snprintf(new_buf, sizeof(new_buf), "%s %s", new_g, unit);
+                    }
                 } else {
-                    snprintf(new_buf, sizeof(new_buf), "%" PRIu32 " %s", settings_editor_u32_new_, unit);
+                    snprintf(old_buf, sizeof(old_buf), "Old: %s", old_g);
+                    snprintf(new_buf, sizeof(new_buf), "%s", new_g);
                 }
-            } else {
-                snprintf(old_buf, sizeof(old_buf), "Old: %" PRIu32, settings_editor_u32_old_);
-                snprintf(new_buf, sizeof(new_buf), "%" PRIu32, settings_editor_u32_new_);
             }
             break;
         case SettingsEditorValueType::F32:
@@ -2548,16 +8244,44 @@ void ui::UiController::drawSettingsValueEditor_(uint32_t now_ms) noexcept
     }
 
     canvas_->setTextSize(1);
-    canvas_->setTextColor(colors::text_hint);
-    const int16_t ow = static_cast<int16_t>(canvas_->textWidth(old_buf));
+    canvas_->setTextColor(thm().text_hint);
+    const int16_t ow = measureText_(old_buf);
     canvas_->setCursor(cx - ow / 2, 54);
     canvas_->print(old_buf);
 
+    // Schema check while dialing: an out-of-range value paints red here and
+    // the gate in sendConfigUpdateActive_ would refuse to send it anyway.
+    bool value_ok = true;
+    if (settings_editor_category_ == SettingsCategory::FatigueTest) {
+        if (settings_editor_index_ == 1) {
+            value_ok = config_check::InRange(config_check::Field::CycleAmount,
+                                             static_cast<float>(settings_editor_u32_new_));
+        } else if (settings_editor_index_ == 2) {
+            value_ok = config_check::InRange(config_check::Field::Vmax, settings_editor_f32_new_);
+        } else if (settings_editor_index_ == 3) {
+            value_ok = config_check::InRange(config_check::Field::Amax, settings_editor_f32_new_);
+        } else if (settings_editor_index_ == 4) {
+            // Editor stores tenths of a second; the rule is in milliseconds.
+            value_ok = config_check::InRange(config_check::Field::Dwell,
+                                             static_cast<float>(settings_editor_u32_new_) * 100.0f);
+        }
+    } else if (settings_editor_category_ == SettingsCategory::BoundsFinding) {
+        if (settings_editor_index_ == 2) {
+            value_ok = config_check::InRange(config_check::Field::BoundsVel, settings_editor_f32_new_);
+        } else if (settings_editor_index_ == 3) {
+            value_ok = config_check::InRange(config_check::Field::SgMinVel, settings_editor_f32_new_);
+        } else if (settings_editor_index_ == 5) {
+            value_ok = config_check::InRange(config_check::Field::StallFactor, settings_editor_f32_new_);
+        } else if (settings_editor_index_ == 6) {
+            value_ok = config_check::InRange(config_check::Field::BoundsAccel, settings_editor_f32_new_);
+        }
+    }
+
     // Big value
     canvas_->setTextSize(4);
-    canvas_->setTextColor(colors::text_primary);
+    canvas_->setTextColor(value_ok ? thm().text_primary : thm().accent_red);
     if (render_unit_separately && (new_value_only[0] != '\0')) {
-        const int16_t vw = static_cast<int16_t>(canvas_->textWidth(new_value_only));
+        const int16_t vw = measureText_(new_value_only);
         canvas_->setCursor(cx - vw / 2, cy - 28);
         canvas_->print(new_value_only);
 
@@ -2565,13 +8289,13 @@ void ui::UiController::drawSettingsValueEditor_(uint32_t now_ms) noexcept
         // For rev/s^2 we draw a manual superscript to avoid missing glyphs rendering as '|'.
         if (unit_is_rev_per_s2) {
             const int16_t unit_y = static_cast<int16_t>(cy + 10);
-            canvas_->setTextColor(colors::text_hint);
+            canvas_->setTextColor(thm().text_hint);
 
             canvas_->setTextSize(2);
             const char* base = "rev/s";
-            const int16_t base_w = static_cast<int16_t>(canvas_->textWidth(base));
+            const int16_t base_w = measureText_(base);
             canvas_->setTextSize(1);
-            const int16_t exp_w = static_cast<int16_t>(canvas_->textWidth("2"));
+            const int16_t exp_w = measureText_("2");
             const int16_t total_w = static_cast<int16_t>(base_w + exp_w);
             const int16_t x0 = static_cast<int16_t>(cx - total_w / 2);
 
@@ -2582,24 +8306,33 @@ void ui::UiController::drawSettingsValueEditor_(uint32_t now_ms) noexcept
             canvas_->setCursor(static_cast<int16_t>(x0 + base_w), static_cast<int16_t>(unit_y - 4));
             canvas_->print("2");
         } else {
-            drawCenteredText_(cx, cy + 10, unit, colors::text_hint, 2);
+            drawCenteredText_(cx, cy + 10, unit, thm().text_hint, 2);
         }
     } else {
-        const int16_t vw = static_cast<int16_t>(canvas_->textWidth(new_buf));
+        const int16_t vw = measureText_(new_buf);
         canvas_->setCursor(cx - vw / 2, cy - 22);
         canvas_->print(new_buf);
     }
 
+    if (!value_ok) {
+        canvas_->setTextSize(1);
+        canvas_->setTextColor(thm().accent_red);
+        const char* warn = "Out of range - will not send";
+        const int16_t ww = measureText_(warn);
+        canvas_->setCursor(cx - ww / 2, 154);
+        canvas_->print(warn);
+    }
+
     // Special hint for SGT
     if (label != nullptr && strcmp(label, "SGT") == 0) {
         canvas_->setTextSize(1);
-        canvas_->setTextColor(colors::text_hint);
+        canvas_->setTextColor(thm().text_hint);
         
         const char* line1 = "Lower value: more sensitive";
         const char* line2 = "Higher value: less sensitive";
         
-        const int16_t w1 = static_cast<int16_t>(canvas_->textWidth(line1));
-        const int16_t w2 = static_cast<int16_t>(canvas_->textWidth(line2));
+        const int16_t w1 = measureText_(line1);
+        const int16_t w2 = measureText_(line2);
         
         // Draw below the value/unit (approx y=150 area) and above action pills
         canvas_->setCursor(cx - w1 / 2, 154);
@@ -2650,30 +8383,133 @@ void ui::UiController::drawSettingsValueEditor_(uint32_t now_ms) noexcept
 
     // --- Action pill ---
     const char* action_hint = "Rotate: change | Click: exit";
-    const int16_t action_hw = static_cast<int16_t>(canvas_->textWidth(action_hint));
+    const int16_t action_hw = measureText_(action_hint);
     const int16_t action_pill_w = action_hw + 16;
     const int16_t action_pill_h = 18;
     const int16_t action_pill_x = cx - action_pill_w / 2;
     const int16_t action_pill_y = 205 - action_pill_h - 6;
-    canvas_->fillSmoothRoundRect(action_pill_x, action_pill_y, action_pill_w, action_pill_h, 9, colors::bg_elevated);
-    canvas_->drawRoundRect(action_pill_x, action_pill_y, action_pill_w, action_pill_h, 9, colors::text_hint);
-    canvas_->setTextColor(colors::text_secondary);
+    canvas_->fillSmoothRoundRect(action_pill_x, action_pill_y, action_pill_w, action_pill_h, 9, thm().bg_elevated);
+    canvas_->drawRoundRect(action_pill_x, action_pill_y, action_pill_w, action_pill_h, 9, thm().text_hint);
+    canvas_->setTextColor(thm().text_secondary);
     canvas_->setCursor(cx - action_hw / 2, action_pill_y + 4);
     canvas_->print(action_hint);
 
     // --- Step pill (bottom) ---
-    const int16_t step_hw = static_cast<int16_t>(canvas_->textWidth(step_hint_buf));
+    const int16_t step_hw = measureText_(step_hint_buf);
     const int16_t step_pill_w = step_hw + 16;
     const int16_t step_pill_h = 18;
     const int16_t step_pill_x = cx - step_pill_w / 2;
     const int16_t step_pill_y = 205;
-    canvas_->fillSmoothRoundRect(step_pill_x, step_pill_y, step_pill_w, step_pill_h, 9, colors::bg_elevated);
-    canvas_->drawRoundRect(step_pill_x, step_pill_y, step_pill_w, step_pill_h, 9, colors::text_hint);
-    canvas_->setTextColor(colors::text_secondary);
+    canvas_->fillSmoothRoundRect(step_pill_x, step_pill_y, step_pill_w, step_pill_h, 9, thm().bg_elevated);
+    canvas_->drawRoundRect(step_pill_x, step_pill_y, step_pill_w, step_pill_h, 9, thm().text_hint);
+    canvas_->setTextColor(thm().text_secondary);
     canvas_->setCursor(cx - step_hw / 2, step_pill_y + 4);
     canvas_->print(step_hint_buf);
 }
 
+void ui::UiController::drawBoundsTuneEditor_(uint32_t now_ms) noexcept
+{
+    (void)now_ms;
+
+    const int16_t cx = 120;
+
+    // Background + header, matching the single-field editor chrome.
+    canvas_->fillScreen(thm().bg_primary);
+    canvas_->drawCircle(cx, 120, 118, thm().bg_card);
+    canvas_->fillRect(0, 0, 240, 44, thm().bg_elevated);
+
+    const char* title = "TUNE BOUNDS";
+    canvas_->setTextSize(2);
+    canvas_->setTextColor(thm().accent_orange);
+    const int16_t tw = measureText_(title);
+    canvas_->setCursor(cx - tw / 2, 14);
+    canvas_->print(title);
+
+    // Field rows: label left, staged value right, one card per field.
+    static const char* row_labels[] = {"Search Vel", "SG Min Vel", "SGT", "Stall Fac", "Search Acc"};
+    char row_values[5][24]{};
+    snprintf(row_values[0], sizeof(row_values[0]), "%.1f rpm", static_cast<double>(bounds_tune_search_vel_));
+    snprintf(row_values[1], sizeof(row_values[1]), "%.1f rpm", static_cast<double>(bounds_tune_sg_min_vel_));
+    if (bounds_tune_sgt_ == 127) {
+        snprintf(row_values[2], sizeof(row_values[2]), "%s", "Default");
+    } else {
+        snprintf(row_values[2], sizeof(row_values[2]), "%d", static_cast<int>(bounds_tune_sgt_));
+    }
+    snprintf(row_values[3], sizeof(row_values[3]), "%.1fx", static_cast<double>(bounds_tune_stall_factor_));
+    snprintf(row_values[4], sizeof(row_values[4]), "%.1f %s", static_cast<double>(bounds_tune_search_accel_), kUnitRevPerS2Ui);
+
+    canvas_->setTextSize(1);
+    for (int i = 0; i < 5; ++i) {
+        const int16_t card_x = 30;
+        const int16_t card_w = 180;
+        const int16_t card_h = 20;
+        const int16_t card_top = static_cast<int16_t>(52 + i * 22);
+
+        const bool focused = (bounds_tune_focus_ == i);
+        const bool editing = focused && bounds_tune_editing_;
+
+        uint16_t bg_color = thm().bg_card;
+        if (focused) {
+            bg_color = editing ? thm().accent_blue : thm().bg_elevated;
+        }
+        canvas_->fillRoundRect(card_x, card_top, card_w, card_h, 6, bg_color);
+        if (focused) {
+            canvas_->drawRoundRect(card_x, card_top, card_w, card_h, 6,
+                                   editing ? TFT_WHITE : thm().accent_orange);
+        }
+
+        const int16_t text_y = static_cast<int16_t>(card_top + 6);
+        canvas_->setTextColor(focused ? TFT_WHITE : thm().text_primary);
+        canvas_->setCursor(card_x + 10, text_y);
+        canvas_->print(row_labels[i]);
+
+        const int16_t vw = measureText_(row_values[i]);
+        canvas_->setTextColor(focused ? thm().accent_yellow : thm().text_secondary);
+        canvas_->setCursor(static_cast<int16_t>(card_x + card_w - 10 - vw), text_y);
+        canvas_->print(row_values[i]);
+    }
+
+    // Live set validation: name the violated rule; APPLY refuses while shown.
+    const char* warn = boundsTuneValidate_();
+    if (warn != nullptr) {
+        canvas_->setTextColor(thm().accent_red);
+        const int16_t ww = measureText_(warn);
+        canvas_->setCursor(cx - ww / 2, 166);
+        canvas_->print(warn);
+    }
+
+    // APPLY / CANCEL pills.
+    struct Pill {
+        const char* label;
+        int16_t x;
+        int focus;
+    };
+    const Pill pills[] = {{"APPLY", 34, 5}, {"CANCEL", 124, 6}};
+    for (const Pill& p : pills) {
+        const int16_t pill_w = 82;
+        const int16_t pill_h = 22;
+        const int16_t pill_y = 180;
+        const bool focused = (bounds_tune_focus_ == p.focus);
+
+        canvas_->fillSmoothRoundRect(p.x, pill_y, pill_w, pill_h, 11,
+                                     focused ? thm().bg_elevated : thm().bg_card);
+        canvas_->drawRoundRect(p.x, pill_y, pill_w, pill_h, 11,
+                               focused ? thm().accent_orange : thm().text_hint);
+        const int16_t lw = measureText_(p.label);
+        canvas_->setTextColor(focused ? TFT_WHITE : thm().text_secondary);
+        canvas_->setCursor(static_cast<int16_t>(p.x + (pill_w - lw) / 2), pill_y + 7);
+        canvas_->print(p.label);
+    }
+
+    // Interaction hint.
+    const char* hint = bounds_tune_editing_ ? "Rotate: change | Click: done"
+                                            : "Rotate: move | Click: select";
+    canvas_->setTextColor(thm().text_hint);
+    const int16_t hw = measureText_(hint);
+    canvas_->setCursor(cx - hw / 2, 212);
+    canvas_->print(hint);
+}
+
 void ui::UiController::drawSettingsPopup_(uint32_t now_ms) noexcept
 {
     (void)now_ms;
@@ -2685,15 +8521,15 @@ void ui::UiController::drawSettingsPopup_(uint32_t now_ms) noexcept
     const int16_t x = cx - w / 2;
     const int16_t y = cy - h / 2;
 
-    drawRoundedRect_(x, y, w, h, 12, colors::bg_elevated, true);
-    drawRoundedRect_(x, y, w, h, 12, colors::accent_blue, false);
+    drawRoundedRect_(x, y, w, h, 12, thm().bg_elevated, true);
+    drawRoundedRect_(x, y, w, h, 12, thm().accent_blue, false);
 
     const char* title = (settings_popup_mode_ == SettingsPopupMode::ValueChangeConfirm)
         ? "Keep change?"
         : ((settings_popup_mode_ == SettingsPopupMode::SaveConfirm) ? "Send changes?" : "Settings");
     canvas_->setTextSize(2);
-    canvas_->setTextColor(colors::text_primary);
-    const int16_t tw = static_cast<int16_t>(canvas_->textWidth(title));
+    canvas_->setTextColor(thm().text_primary);
+    const int16_t tw = measureText_(title);
     canvas_->setCursor(cx - tw / 2, y + 14);
     canvas_->print(title);
 
@@ -2721,6 +8557,7 @@ void ui::UiController::drawSettingsPopup_(uint32_t now_ms) noexcept
                 if (settings_editor_index_ == 1) { unit = "%"; }
                 break;
             case SettingsCategory::Main:
+            case SettingsCategory::Profiles:
                 break;
         }
 
@@ -2732,12 +8569,18 @@ void ui::UiController::drawSettingsPopup_(uint32_t now_ms) noexcept
                     const double new_s = static_cast<double>(settings_editor_u32_new_) * 0.1;
                     snprintf(old_line, sizeof(old_line), "Old: %.1f %s", old_s, unit);
                     snprintf(new_line, sizeof(new_line), "New: %.1f %s", new_s, unit);
-                } else if (has_unit) {
-                    snprintf(old_line, sizeof(old_line), "Old: %" PRIu32 " %s", settings_editor_u32_old_, unit);
-                    snprintf(new_line, sizeof(new_line), "New: %" PRIu32 " %s", settings_editor_u32_new_, unit);
                 } else {
-                    snprintf(old_line, sizeof(old_line), "Old: %" PRIu32, settings_editor_u32_old_);
-                    snprintf(new_line, sizeof(new_line), "New: %" PRIu32, settings_editor_u32_new_);
+                    char old_g[16];
+                    char new_g[16];
+                    formatGrouped_(settings_editor_u32_old_, old_g, sizeof(old_g));
+                    formatGrouped_(settings_editor_u32_new_, new_g, sizeof(new_g));
+                    if (has_unit) {
+                        snprintf(old_line, sizeof(old_line), "Old: %s %s", old_g, unit);
+                        snprintf(new_line, sizeof(new_line), "New: %s %s", new_g, unit);
+                    } else {
+                        snprintf(old_line, sizeof(old_line), "Old: %s", old_g);
+                        snprintf(new_line, sizeof(new_line), "New: %s", new_g);
+                    }
                 }
                 break;
             case SettingsEditorValueType::F32:
@@ -2772,7 +8615,7 @@ void ui::UiController::drawSettingsPopup_(uint32_t now_ms) noexcept
         }
 
         canvas_->setTextSize(1);
-        canvas_->setTextColor(colors::text_secondary);
+        canvas_->setTextColor(thm().text_secondary);
         canvas_->setCursor(x + 16, y + 50);
         canvas_->print(old_line);
         canvas_->setCursor(x + 16, y + 68);
@@ -2788,7 +8631,7 @@ void ui::UiController::drawSettingsPopup_(uint32_t now_ms) noexcept
         drawButton_(disc_btn, "Discard", settings_popup_selection_ == 1, false);
     } else if (settings_popup_mode_ == SettingsPopupMode::SaveConfirm) {
         canvas_->setTextSize(1);
-        canvas_->setTextColor(colors::text_secondary);
+        canvas_->setTextColor(thm().text_secondary);
         canvas_->setCursor(x + 16, y + 52);
         canvas_->print("Send edited settings to tester");
         canvas_->setCursor(x + 16, y + 70);
@@ -2804,6 +8647,19 @@ void ui::UiController::drawSettingsPopup_(uint32_t now_ms) noexcept
     }
 }
 
+/**
+ * @brief Map a unit-reported angle onto the Bounds rim gauge
+ * @param deg Angle in degrees from center
+ * @param scale Full-scale angle (lands on the gauge end stops)
+ * @return Screen angle in the fillArc convention (-90 is 12 o'clock)
+ */
+float ui::UiController::boundsGaugeAngle_(float deg, float scale) noexcept
+{
+    float n = deg / std::max(1.0f, scale);
+    n = std::max(-1.0f, std::min(1.0f, n));
+    return -90.0f + n * kBoundsGaugeHalfSpan_deg;
+}
+
 void ui::UiController::drawBounds_(uint32_t now_ms) noexcept
 {
     const int16_t cx = th::CENTER_X;
@@ -2812,46 +8668,70 @@ void ui::UiController::drawBounds_(uint32_t now_ms) noexcept
     static constexpr bool kSwingLeftFirst_ = true;
 
     // === BACKGROUND / CROSSHAIR ===
-    canvas_->drawCircle(cx, cy, 96, colors::bg_card);
-    canvas_->drawCircle(cx, cy, 66, colors::bg_card);
-    canvas_->drawCircle(cx, cy, 38, colors::bg_card);
-    canvas_->drawLine(cx - 100, cy, cx + 100, cy, colors::bg_card);
-    canvas_->drawLine(cx, cy - 100, cx, cy + 100, colors::bg_card);
+    canvas_->drawCircle(cx, cy, 96, thm().bg_card);
+    canvas_->drawCircle(cx, cy, 66, thm().bg_card);
+    canvas_->drawCircle(cx, cy, 38, thm().bg_card);
+    canvas_->drawLine(cx - 100, cy, cx + 100, cy, thm().bg_card);
+    canvas_->drawLine(cx, cy - 100, cx, cy + 100, thm().bg_card);
 
     // Title
     canvas_->setTextSize(1);
-    canvas_->setTextColor(colors::text_primary);
-    drawCenteredText_(cx, 10, "FIND BOUNDS", colors::text_primary, 1);
+    canvas_->setTextColor(thm().text_primary);
+    drawCenteredText_(cx, 10, "FIND BOUNDS", thm().text_primary, 1);
 
     // === STATUS TEXT ===
+    // Live progress stream: trusted while fresh, otherwise the simulated
+    // swing below keeps the page visibly alive.
+    const bool progress_live = bounds_have_progress_ &&
+                               (now_ms - bounds_progress_ms_) < kBoundsProgressStale_ms;
+
     const char* status1 = "READY";
     const char* status2 = "";
-    uint16_t status_color = colors::text_secondary;
-    if (bounds_state_ == BoundsState::StartWaitAck) {
+    uint16_t status_color = thm().text_secondary;
+    if (bounds_state_ == BoundsState::Idle && bounds_result_cached_ && bounds_have_result_) {
+        status1 = "PREVIOUS";
+        status2 = bounds_bounded_ ? "From last search" : "Default range (cached)";
+        status_color = thm().text_secondary;
+    } else if (bounds_state_ == BoundsState::StartWaitAck) {
         status1 = "STARTING";
         status2 = "Waiting for ACK";
-        status_color = colors::text_hint;
+        status_color = thm().text_hint;
     } else if (bounds_state_ == BoundsState::Running) {
         status1 = "RUNNING";
         status2 = "Finding mechanical limits";
-        status_color = colors::accent_green;
+        if (progress_live) {
+            switch (static_cast<fatigue_proto::BoundsSearchPhase>(bounds_progress_phase_)) {
+                case fatigue_proto::BoundsSearchPhase::SeekingMin:
+                    status2 = "Seeking min limit";
+                    break;
+                case fatigue_proto::BoundsSearchPhase::SeekingMax:
+                    status2 = "Seeking max limit";
+                    break;
+                case fatigue_proto::BoundsSearchPhase::Centering:
+                    status2 = "Returning to center";
+                    break;
+                default:
+                    break;
+            }
+        }
+        status_color = thm().accent_green;
     } else if (bounds_state_ == BoundsState::StopWaitAck) {
         status1 = "STOPPING";
         status2 = "Waiting for ACK";
-        status_color = colors::text_hint;
+        status_color = thm().text_hint;
     } else if (bounds_state_ == BoundsState::Complete) {
         status1 = bounds_have_result_ ? (bounds_bounded_ ? "BOUNDS FOUND" : "DEFAULT RANGE") : "DONE";
         status2 = bounds_have_result_ ? "Showing min/max" : "No data";
-        status_color = colors::accent_blue;
+        status_color = thm().accent_blue;
     } else if (bounds_state_ == BoundsState::Error) {
         status1 = "CAN'T START";
         status2 = (bounds_last_error_code_ == 0) ? "No ACK from machine" : "Error from machine";
-        status_color = colors::state_error;
+        status_color = thm().state_error;
     }
 
     drawCenteredText_(cx, 28, status1, status_color, 2);
     if (status2[0] != '\0') {
-        drawCenteredText_(cx, 46, status2, colors::text_hint, 1);
+        drawCenteredText_(cx, 46, status2, thm().text_hint, 1);
     }
 
     // === VISUALIZATION (CROSSHAIR + TRACK) ===
@@ -2859,15 +8739,31 @@ void ui::UiController::drawBounds_(uint32_t now_ms) noexcept
     const int16_t track_half_w = 72;
     const int16_t track_x1 = cx - track_half_w;
     const int16_t track_x2 = cx + track_half_w;
-    canvas_->drawWideLine(track_x1, track_y, track_x2, track_y, 3, colors::bg_elevated);
-    canvas_->fillSmoothCircle(cx, track_y, 4, colors::text_secondary);
-
-    // Determine displayed bounds (if we have them)
-    const bool show_bounds = (bounds_state_ == BoundsState::Complete) && bounds_have_result_;
+    canvas_->drawWideLine(track_x1, track_y, track_x2, track_y, 3, thm().bg_elevated);
+    canvas_->fillSmoothCircle(cx, track_y, 4, thm().text_secondary);
+
+    // Determine displayed bounds (if we have them). A cached previous
+    // result draws the same markers/readout while the page sits Idle.
+    const bool show_bounds = bounds_have_result_ &&
+                             (bounds_state_ == BoundsState::Complete ||
+                              (bounds_state_ == BoundsState::Idle && bounds_result_cached_));
     const float min_deg = bounds_min_deg_;
     const float max_deg = bounds_max_deg_;
     const float max_abs = std::max(1.0f, std::max(std::fabs(min_deg), std::fabs(max_deg)));
-    const float display_max_deg = show_bounds ? max_abs : 75.0f;
+    float display_max_deg = show_bounds ? max_abs : 75.0f;
+    if (progress_live && !show_bounds) {
+        // Keep the live sweep on the track even past the nominal range.
+        display_max_deg = std::max(display_max_deg,
+                                   std::max(std::fabs(bounds_progress_min_deg_),
+                                            std::max(std::fabs(bounds_progress_max_deg_),
+                                                     std::fabs(bounds_progress_deg_))));
+    }
+    if (progress_live && !show_bounds && bounds_have_result_) {
+        // The persisted markers ride the same scale, so keep them on it
+        // while a new search runs over a smaller window.
+        display_max_deg = std::max(display_max_deg,
+                                   std::max(std::fabs(min_deg), std::fabs(max_deg)));
+    }
     const float px_per_deg = static_cast<float>(track_half_w) / display_max_deg;
 
     int16_t min_x = cx;
@@ -2879,16 +8775,32 @@ void ui::UiController::drawBounds_(uint32_t now_ms) noexcept
         max_x = std::max(track_x1, std::min(track_x2, max_x));
 
         // Bounds markers
-        canvas_->drawWideLine(min_x, track_y - 10, min_x, track_y + 10, 3, colors::accent_orange);
-        canvas_->drawWideLine(max_x, track_y - 10, max_x, track_y + 10, 3, colors::accent_orange);
+        canvas_->drawWideLine(min_x, track_y - 10, min_x, track_y + 10, 3, thm().accent_orange);
+        canvas_->drawWideLine(max_x, track_y - 10, max_x, track_y + 10, 3, thm().accent_orange);
 
         // Highlight the usable window
-        canvas_->drawWideLine(min_x, track_y, max_x, track_y, 5, colors::accent_blue);
+        canvas_->drawWideLine(min_x, track_y, max_x, track_y, 5, thm().accent_blue);
+    }
+
+    // Provisional limits touched so far: thin muted ticks while the search
+    // is still live, so the operator watches the window grow in real time.
+    if (progress_live && !show_bounds) {
+        const auto mark_x = [&](float deg) {
+            int16_t x = static_cast<int16_t>(cx + static_cast<int16_t>(deg * px_per_deg));
+            return std::max(track_x1, std::min(track_x2, x));
+        };
+        const int16_t pmin_x = mark_x(bounds_progress_min_deg_);
+        const int16_t pmax_x = mark_x(bounds_progress_max_deg_);
+        canvas_->drawLine(pmin_x, track_y - 8, pmin_x, track_y + 8, thm().accent_orange);
+        canvas_->drawLine(pmax_x, track_y - 8, pmax_x, track_y + 8, thm().accent_orange);
     }
 
-    // Armature indicator: rotational swing around center (starts left-first or right-first).
+    // Armature indicator: real angle from the progress stream when live,
+    // otherwise a rotational swing around center (left-first or right-first).
     float sim_angle_deg = 0.0f;
-    if (bounds_state_ == BoundsState::Running || bounds_state_ == BoundsState::StartWaitAck || bounds_state_ == BoundsState::StopWaitAck) {
+    if (progress_live && !show_bounds) {
+        sim_angle_deg = bounds_progress_deg_;
+    } else if (bounds_state_ == BoundsState::Running || bounds_state_ == BoundsState::StartWaitAck || bounds_state_ == BoundsState::StopWaitAck) {
         const float t = static_cast<float>((now_ms - bounds_state_since_ms_) % 2400U) / 2400.0f;
         const float phase = 2.0f * 3.14159f * t;
         const float s = kSwingLeftFirst_ ? -std::cos(phase) : std::cos(phase);
@@ -2900,21 +8812,83 @@ void ui::UiController::drawBounds_(uint32_t now_ms) noexcept
         sim_angle_deg = (min_deg + max_deg) * 0.5f + s * (max_deg - min_deg) * 0.5f;
     }
 
+    // === RIM GAUGE ===
+    // The round panel doubles as a protractor: the angle sweeps a
+    // 150-degree arc at the top rim, sharing the linear track's scale.
+    // Coverage shows the window swept so far; orange ticks persist the
+    // last result's limits so a re-run grows against the old window.
+    const float gauge_a0 = -90.0f - kBoundsGaugeHalfSpan_deg;
+    const float gauge_a1 = -90.0f + kBoundsGaugeHalfSpan_deg;
+    ui::ring::fillRingArc(canvas_, cx, cy, 115, 100, gauge_a0, gauge_a1,
+                          thm().progress_bg, thm().bg_primary);
+
+    float cov0 = 0.0f;
+    float cov1 = 0.0f;
+    bool have_cov = false;
+    if (show_bounds) {
+        cov0 = boundsGaugeAngle_(min_deg, display_max_deg);
+        cov1 = boundsGaugeAngle_(max_deg, display_max_deg);
+        have_cov = true;
+    } else if (progress_live) {
+        cov0 = boundsGaugeAngle_(bounds_progress_min_deg_, display_max_deg);
+        cov1 = boundsGaugeAngle_(bounds_progress_max_deg_, display_max_deg);
+        have_cov = true;
+    }
+    if (have_cov && cov1 > cov0 + 0.5f) {
+        ui::ring::fillRingArc(canvas_, cx, cy, 115, 100, cov0, cov1,
+                              show_bounds ? thm().accent_blue : thm().accent_green,
+                              thm().progress_bg);
+    }
+
+    // Radial tick inside the band (markArcSegment_'s box only covers the
+    // 100..115 radii, so the tick must not poke past them).
+    const auto gauge_tick = [&](float a_deg, uint16_t color) {
+        const float grad = a_deg * 3.14159f / 180.0f;
+        const float gc = std::cos(grad);
+        const float gs = std::sin(grad);
+        canvas_->drawWideLine(static_cast<int16_t>(cx + 101.0f * gc),
+                              static_cast<int16_t>(cy + 101.0f * gs),
+                              static_cast<int16_t>(cx + 114.0f * gc),
+                              static_cast<int16_t>(cy + 114.0f * gs),
+                              3, color);
+    };
+    if (bounds_have_result_) {
+        gauge_tick(boundsGaugeAngle_(min_deg, display_max_deg), thm().accent_orange);
+        gauge_tick(boundsGaugeAngle_(max_deg, display_max_deg), thm().accent_orange);
+    }
+    const float needle_a = boundsGaugeAngle_(sim_angle_deg, display_max_deg);
+    gauge_tick(needle_a, thm().text_primary);
+
+    // Live angle readout while the stream is fresh; the result pills take
+    // this spot once the numbers are final.
+    if (progress_live && !show_bounds) {
+        char abuf[16];
+        snprintf(abuf, sizeof(abuf), "%+.1f deg", static_cast<double>(bounds_progress_deg_));
+        canvas_->setTextSize(1);
+        drawCenteredText_(cx, 154, abuf, thm().text_primary, 1);
+    }
+
+    // Bookkeeping for the incremental BoundsProgress repaint path.
+    bounds_gauge_drawn_deg_ = needle_a;
+    bounds_gauge_drawn_min_ = have_cov ? cov0 : needle_a;
+    bounds_gauge_drawn_max_ = have_cov ? cov1 : needle_a;
+    bounds_gauge_scale_ = display_max_deg;
+
     const int16_t pivot_x = cx;
     const int16_t pivot_y = static_cast<int16_t>(cy - 6);
     const int16_t arm_len = 60;
     const float rad = sim_angle_deg * 3.14159f / 180.0f;
     const int16_t tip_x = static_cast<int16_t>(pivot_x + static_cast<int16_t>(arm_len * std::sin(rad)));
     const int16_t tip_y = static_cast<int16_t>(pivot_y - static_cast<int16_t>(arm_len * std::cos(rad)));
-    canvas_->drawWideLine(pivot_x, pivot_y, tip_x, tip_y, 4, colors::text_primary);
-    canvas_->fillSmoothCircle(pivot_x, pivot_y, 4, colors::bg_elevated);
-    canvas_->drawCircle(pivot_x, pivot_y, 5, colors::bg_card);
-    canvas_->fillSmoothCircle(tip_x, tip_y, 6, colors::accent_green);
+    canvas_->drawWideLine(pivot_x, pivot_y, tip_x, tip_y, 4, thm().text_primary);
+    canvas_->fillSmoothCircle(pivot_x, pivot_y, 4, thm().bg_elevated);
+    canvas_->drawCircle(pivot_x, pivot_y, 5, thm().bg_card);
+    canvas_->fillSmoothCircle(tip_x, tip_y, 6, thm().accent_green);
 
     // Show where the armature maps onto the track (small dot)
     int16_t dot_x = static_cast<int16_t>(cx + static_cast<int16_t>(sim_angle_deg * px_per_deg));
     dot_x = std::max(track_x1, std::min(track_x2, dot_x));
-    canvas_->fillSmoothCircle(dot_x, track_y, 3, colors::text_primary);
+    canvas_->fillSmoothCircle(dot_x, track_y, 3, thm().text_primary);
 
     // Numeric readout (only when we have results)
     if (show_bounds) {
@@ -2931,12 +8905,12 @@ void ui::UiController::drawBounds_(uint32_t now_ms) noexcept
         constexpr int16_t kPillH = 18;
         constexpr int16_t kRadius = 9;
         const auto draw_value_pill = [&](int16_t center_x, const char* text) {
-            const int16_t tw = static_cast<int16_t>(canvas_->textWidth(text));
+            const int16_t tw = measureText_(text);
             const int16_t pill_w = static_cast<int16_t>(tw + (kPadX * 2));
             const int16_t x = static_cast<int16_t>(center_x - (pill_w / 2));
-            canvas_->fillRoundRect(x, y, pill_w, kPillH, kRadius, colors::bg_card);
-            canvas_->drawRoundRect(x, y, pill_w, kPillH, kRadius, colors::accent_orange);
-            canvas_->setTextColor(colors::accent_orange);
+            canvas_->fillRoundRect(x, y, pill_w, kPillH, kRadius, thm().bg_card);
+            canvas_->drawRoundRect(x, y, pill_w, kPillH, kRadius, thm().accent_orange);
+            canvas_->setTextColor(thm().accent_orange);
             canvas_->setCursor(static_cast<int16_t>(x + kPadX), static_cast<int16_t>(y + 5));
             canvas_->print(text);
         };
@@ -2959,114 +8933,394 @@ void ui::UiController::drawBounds_(uint32_t now_ms) noexcept
     const Rect action_btn{ action_btn_x, btn_y, action_btn_w, btn_h };
 
     const char* action_label = "Start";
+    if (bounds_state_ == BoundsState::Idle && bounds_result_cached_) action_label = "Re-find";
     if (bounds_state_ == BoundsState::Running) action_label = "Stop";
     if (bounds_state_ == BoundsState::StartWaitAck) action_label = "Starting";
     if (bounds_state_ == BoundsState::StopWaitAck) action_label = "Stopping";
     if (bounds_state_ == BoundsState::Complete) action_label = "Run Again";
     if (bounds_state_ == BoundsState::Error) action_label = "Retry";
 
-    drawModernButton_(back_btn.x, back_btn.y, back_btn.w, back_btn.h, "Back", bounds_focus_ == BoundsFocus::Back, false, colors::accent_blue);
-    drawModernButton_(action_btn.x, action_btn.y, action_btn.w, action_btn.h, action_label, bounds_focus_ == BoundsFocus::Action, false, colors::accent_blue);
+    drawModernButton_(back_btn.x, back_btn.y, back_btn.w, back_btn.h, "Back", bounds_focus_ == BoundsFocus::Back, false, thm().accent_blue);
+    drawModernButton_(action_btn.x, action_btn.y, action_btn.w, action_btn.h, action_label, bounds_focus_ == BoundsFocus::Action, false, thm().accent_blue);
 
     // Connection indicator (top-right)
     th::drawConnectionDot(240 - 18, 18, conn_status_ == ConnStatus::Connected, now_ms);
 }
 
+/**
+ * @brief Mark the bounding box of a progress-arc segment dirty
+ * @details Angles use the fillArc convention (degrees, 0 at 3 o'clock,
+ *          clockwise, screen y down). The box covers both radii at both
+ *          endpoints plus any cardinal direction the span crosses, padded
+ *          by a pixel for the arc's anti-aliased edge.
+ * @param a0_deg Segment start angle
+ * @param a1_deg Segment end angle (>= a0_deg)
+ */
+void ui::UiController::markArcSegment_(float a0_deg, float a1_deg) noexcept
+{
+    constexpr float kDegToRad = 3.14159265f / 180.0f;
+    constexpr int16_t kArcOuterR = 115;
+    constexpr int16_t kArcInnerR = 100;
+
+    float min_x = 1e9f, min_y = 1e9f, max_x = -1e9f, max_y = -1e9f;
+    auto include = [&](float deg) {
+        for (const float r : { static_cast<float>(kArcInnerR), static_cast<float>(kArcOuterR) }) {
+            const float x = th::CENTER_X + r * std::cos(deg * kDegToRad);
+            const float y = th::CENTER_Y + r * std::sin(deg * kDegToRad);
+            min_x = std::min(min_x, x);
+            min_y = std::min(min_y, y);
+            max_x = std::max(max_x, x);
+            max_y = std::max(max_y, y);
+        }
+    };
+    include(a0_deg);
+    include(a1_deg);
+    for (float card = std::ceil(a0_deg / 90.0f) * 90.0f; card <= a1_deg; card += 90.0f) {
+        include(card);
+    }
+
+    markDirty_(static_cast<int16_t>(min_x) - 1, static_cast<int16_t>(min_y) - 1,
+               static_cast<int16_t>(max_x - min_x) + 3, static_cast<int16_t>(max_y - min_y) + 3);
+}
+
+bool ui::UiController::buildGlyphCache_() noexcept
+{
+    if (glyph_cache_valid_) {
+        return true;
+    }
+    // Ten digits plus the thousands separator; the GLCD font is monospace,
+    // so the comma gets the same fixed cell as a digit.
+    for (int d = 0; d <= kGlyphComma_; ++d) {
+        if (digit_glyphs_[d] == nullptr) {
+            digit_glyphs_[d] = new LGFX_Sprite(canvas_);
+            if (digit_glyphs_[d] != nullptr) {
+                digit_glyphs_[d]->setColorDepth(8);
+                sprite_mem::PlaceRetained(*digit_glyphs_[d]);
+                digit_glyphs_[d]->createSprite(kGlyphW_, kGlyphH_);
+            }
+        }
+        LGFX_Sprite* g = digit_glyphs_[d];
+        if (g == nullptr || g->getBuffer() == nullptr) {
+            // Out of RAM: keep whatever was built for next time and let the
+            // caller fall back to direct font rendering.
+            return false;
+        }
+        g->fillScreen(thm().bg_primary);
+        g->setTextSize(4);
+        g->setTextColor(thm().text_primary);
+        g->setCursor(0, 0);
+        g->print(d < 10 ? static_cast<char>('0' + d) : ',');
+    }
+    glyph_cache_valid_ = true;
+    return true;
+}
+
+void ui::UiController::drawCounterDigits_(const char* text, int16_t x, int16_t y) noexcept
+{
+    // Fixed-cell blits; the canvas clip rect discards cells outside a
+    // partial redraw band for free.
+    for (; *text != '\0'; ++text) {
+        if (*text >= '0' && *text <= '9') {
+            digit_glyphs_[*text - '0']->pushSprite(canvas_, x, y);
+        } else if (*text == ',') {
+            digit_glyphs_[kGlyphComma_]->pushSprite(canvas_, x, y);
+        }
+        x = static_cast<int16_t>(x + kGlyphW_);
+    }
+}
+
+void ui::UiController::formatGrouped_(uint32_t v, char* out, size_t cap) noexcept
+{
+    // Digits right-to-left with a comma every three; max uint32_t is
+    // "4,294,967,295" (13 chars + NUL).
+    char tmp[14];
+    size_t n = 0;
+    int group = 0;
+    do {
+        if (group == 3) {
+            tmp[n++] = ',';
+            group = 0;
+        }
+        tmp[n++] = static_cast<char>('0' + (v % 10U));
+        v /= 10U;
+        ++group;
+    } while (v != 0U && n < sizeof(tmp));
+    size_t o = 0;
+    while (n > 0 && o + 1 < cap) {
+        out[o++] = tmp[--n];
+    }
+    out[o] = '\0';
+}
+
+const char* ui::UiController::formatGroupedCycle_(uint32_t v) noexcept
+{
+    if (v == live_fmt_val_) {
+        return live_fmt_str_;  // Same displayed value: reuse last frame's string.
+    }
+    // Running counter steady state: only the low group advanced, so the
+    // last three characters are the only ones that can differ. Everything
+    // left of them (including every separator) is byte-identical.
+    if (live_fmt_val_ != UINT32_MAX && v >= 1000U &&
+        (v / 1000U) == (live_fmt_val_ / 1000U) && live_fmt_len_ >= 3) {
+        uint32_t low = v % 1000U;
+        char* p = live_fmt_str_ + live_fmt_len_;
+        for (int i = 0; i < 3; ++i) {
+            *--p = static_cast<char>('0' + (low % 10U));
+            low /= 10U;
+        }
+    } else {
+        formatGrouped_(v, live_fmt_str_, sizeof(live_fmt_str_));
+        live_fmt_len_ = static_cast<uint8_t>(strlen(live_fmt_str_));
+    }
+    live_fmt_val_ = v;
+    return live_fmt_str_;
+}
+
+void ui::UiController::serviceStallAlert_(uint32_t now_ms) noexcept
+{
+    // Stall detection runs on every status delivery: a running test whose
+    // rate collapsed gets flagged hours before an operator would notice
+    // the counter sitting still. The flag clears itself on recovery.
+    const bool running = have_status_ &&
+        static_cast<fatigue_proto::TestState>(last_status_.state) == fatigue_proto::TestState::Running;
+    const bool stalled = running && cycle_est_.stalled(now_ms);
+    if (stalled == live_stall_alert_) {
+        return;
+    }
+    live_stall_alert_ = stalled;
+    if (stalled) {
+        logfAt_(LogLevel::Error, now_ms, "ERR: cycle rate collapsed at #%" PRIu32 ", fixture may be stalled",
+              last_status_.cycle_number);
+        playBeep_(4);
+    } else {
+        logf_(now_ms, "Cycle rate recovered");
+    }
+    dirty_ = true;
+}
+
+void ui::UiController::noteErrorCode_(uint8_t err_code, uint32_t now_ms) noexcept
+{
+    // First occurrence (or the code changing under us) timestamps the
+    // panel; repeats of the same code keep the original time so "for 12m"
+    // reflects how long the error has actually stood.
+    if (err_code == live_err_code_) {
+        return;
+    }
+    live_err_code_ = err_code;
+    if (err_code != 0) {
+        live_err_since_ms_ = now_ms;
+        timeline_events_ |= kTlEvError_;
+        const auto& info = fatigue_proto::LookupError(err_code);
+        logfAt_(LogLevel::Error, now_ms, "ERR: E%u %s - %s", static_cast<unsigned>(err_code),
+              info.name, info.action);
+        playBeep_(4);
+        // Alert restore: a fresh error counts as activity so the power
+        // governor snaps a dimmed or sleeping display back to full on its
+        // next pass — an operator summoned by the beep must not face a
+        // dark screen.
+        last_input_ms_ = now_ms;
+        raiseAlert_(AlertSeverity::Critical, now_ms);
+    } else {
+        logf_(now_ms, "Unit error cleared");
+        clearAlert_();
+    }
+    dirty_ = true;
+}
+
+void ui::UiController::formatEta_(uint32_t ms, char* out, size_t out_len) noexcept
+{
+    const uint32_t total_s = ms / 1000;
+    if (total_s >= 99 * 3600) {
+        snprintf(out, out_len, ">99h");
+    } else if (total_s >= 3600) {
+        snprintf(out, out_len, "%luh%02lum", static_cast<unsigned long>(total_s / 3600),
+                 static_cast<unsigned long>((total_s % 3600) / 60));
+    } else if (total_s >= 60) {
+        snprintf(out, out_len, "%lum%02lus", static_cast<unsigned long>(total_s / 60),
+                 static_cast<unsigned long>(total_s % 60));
+    } else {
+        snprintf(out, out_len, "%lus", static_cast<unsigned long>(total_s));
+    }
+}
+
+/**
+ * @brief Cycle number to display, extrapolated between status samples
+ * @details At low status rates the real counter jumps by tens of cycles per
+ *          update, which reads as stutter. Between samples the value shown
+ *          in the big digits advances along the estimator's smoothed rate
+ *          from the newest real sample; each real update re-anchors,
+ *          snapping any prediction error away. Extrapolation freezes ten
+ *          seconds after the last sample so a silent link stops the number
+ *          instead of counting fiction, and never passes the target. The
+ *          progress arc and ETA keep using the real counter.
+ */
+uint32_t ui::UiController::predictedCycle_(uint32_t now_ms) const noexcept
+{
+    const uint32_t real = last_status_.cycle_number;
+    if (!have_status_ || conn_status_ != ConnStatus::Connected ||
+        static_cast<fatigue_proto::TestState>(last_status_.state) !=
+            fatigue_proto::TestState::Running ||
+        !cycle_est_.hasRate()) {
+        return real;
+    }
+    uint32_t elapsed_ms = now_ms - live_anchor_ms_;
+    if (elapsed_ms > 10000U) {
+        elapsed_ms = 10000U;
+    }
+    const float adv = cycle_est_.ratePerMin() * (1.0f / 60000.0f) *
+                      static_cast<float>(elapsed_ms);
+    uint32_t pred = real + static_cast<uint32_t>(adv);
+    const uint32_t target = edit_settings_.test_unit.cycle_amount;
+    if (target > 0 && pred > target) {
+        pred = target;
+    }
+    return pred;
+}
+
 void ui::UiController::drawLiveCounter_(uint32_t now_ms) noexcept
 {
-    // Check if popup is active
+    // Check if popup is active. An overlay capture pass falls through and
+    // renders the counter page the popup will float over; the inline draw
+    // remains as the compositor's OOM fallback.
     if (live_popup_mode_ == LivePopupMode::QuickSettings) {
         drawQuickSettings_(now_ms);
         return;
     }
-    if (live_popup_mode_ != LivePopupMode::None) {
+    if (live_popup_mode_ != LivePopupMode::None && !overlay_capture_) {
         drawLivePopup_(now_ms);
         return;
     }
 
     const int16_t cx = th::CENTER_X;
     const int16_t cy = th::CENTER_Y;
-    // Only use status if connected - don't show stale data when disconnected
-    const bool use_status = (conn_status_ == ConnStatus::Connected && have_status_);
-    const uint32_t cycle = use_status ? last_status_.cycle_number : 0;
+    // Only use status if connected - don't show stale data when disconnected.
+    // Reads the per-frame snapshot so the proto handler can't tear it mid-draw.
+    const bool use_status = (frame_snapshot_.conn == ConnStatus::Connected && frame_snapshot_.have_status);
+    const uint32_t cycle = use_status ? frame_snapshot_.status.cycle_number : 0;
     const uint32_t target = edit_settings_.test_unit.cycle_amount;
-    const auto test_state = use_status ? static_cast<fatigue_proto::TestState>(last_status_.state) : fatigue_proto::TestState::Idle;
-
-    // Check pending command timeout
-    if (pending_command_id_ != 0 && (now_ms - pending_command_tick_ > 2500)) {
-        pending_command_id_ = 0;
-    }
+    const auto test_state = use_status ? static_cast<fatigue_proto::TestState>(frame_snapshot_.status.state) : fatigue_proto::TestState::Idle;
 
     // Determine state color
-    uint16_t state_color = colors::state_idle;
+    uint16_t state_color = thm().state_idle;
     const char* state_text = "IDLE";
     
     switch (test_state) {
         case fatigue_proto::TestState::Running:
-            state_color = colors::state_running;
+            state_color = thm().state_running;
             state_text = "RUNNING";
             break;
         case fatigue_proto::TestState::Paused:
-            state_color = colors::state_paused;
+            state_color = thm().state_paused;
             state_text = "PAUSED";
             break;
         case fatigue_proto::TestState::Completed:
-            state_color = colors::state_complete;
+            state_color = thm().state_complete;
             state_text = "COMPLETE";
             break;
         case fatigue_proto::TestState::Error:
-            state_color = colors::state_error;
+            state_color = thm().state_error;
             state_text = "ERROR";
             break;
         default:
             break;
     }
     
-    if (pending_command_id_ != 0) {
-        state_color = colors::text_muted;
-        state_text = "SENDING...";
+    // Provisional pill: an open speculation shows the state the command
+    // should land in, dimmed and with a trailing '?', until the ack or a
+    // matching status report confirms it (serviceSpeculation_ rolls it
+    // back on timeout).
+    char spec_text[16];
+    if (spec_.since_ms != 0) {
+        const char* expect = "...";
+        uint16_t base = thm().text_muted;
+        switch (static_cast<fatigue_proto::TestState>(spec_.expected_state)) {
+            case fatigue_proto::TestState::Running: expect = "RUNNING"; base = thm().state_running; break;
+            case fatigue_proto::TestState::Paused:  expect = "PAUSED";  base = thm().state_paused; break;
+            case fatigue_proto::TestState::Idle:    expect = "STOPPED"; base = thm().state_idle; break;
+            default: break;
+        }
+        snprintf(spec_text, sizeof(spec_text), "%s?", expect);
+        state_text = spec_text;
+        state_color = th::dim565(base);
+    }
+
+    // A journaled critical command outranks the transient SENDING state:
+    // the pill stays on the warning until the ack retires the journal
+    // entry, so a STOP that has not landed yet is visible at a glance.
+    if (critical_pending_) {
+        state_color = thm().accent_red;
+        state_text = (critical_pending_cmd_ ==
+                      static_cast<uint8_t>(fatigue_proto::CommandId::Pause))
+                         ? "PAUSE PENDING" : "STOP PENDING";
     }
 
     // === OUTER PROGRESS ARC ===
-    // Background arc
-    canvas_->fillArc(cx, cy, 115, 100, -90, 270, colors::progress_bg);
-    
-    // Progress arc based on cycle completion
+    // Incremental: on a partial frame where progress only advanced, extend
+    // the retained arc by the newly covered segment (the proto handler has
+    // already marked its bounding box dirty). Full frames, regressions and
+    // color changes repaint the whole ring.
     const float progress = (target > 0) ? std::min(1.0f, static_cast<float>(cycle) / static_cast<float>(target)) : 0.0f;
-    if (progress > 0.001f) {
-        const float end_angle = -90.0f + 360.0f * progress;
-        canvas_->fillArc(cx, cy, 115, 100, -90, end_angle, state_color);
+    const float end_angle = -90.0f + 360.0f * progress;
+    if (frame_full_ || live_arc_drawn_progress_ < 0.0f ||
+        progress < live_arc_drawn_progress_ || state_color != live_arc_color_) {
+        ui::ring::fillRingArc(canvas_, cx, cy, 115, 100, -90, 270, thm().progress_bg,
+                              thm().bg_primary);
+        if (progress > 0.001f) {
+            ui::ring::fillRingArc(canvas_, cx, cy, 115, 100, -90, end_angle, state_color,
+                                  thm().progress_bg);
+        }
+    } else if (progress > live_arc_drawn_progress_) {
+        const float start_angle = -90.0f + 360.0f * live_arc_drawn_progress_;
+        // Hard start cut: the segment butts against already-drawn arc, so
+        // antialiasing the start toward the track would etch a seam.
+        ui::ring::fillRingArc(canvas_, cx, cy, 115, 100, start_angle, end_angle, state_color,
+                              thm().progress_bg, /*aa_start=*/false);
     }
+    live_arc_drawn_progress_ = progress;
+    live_arc_color_ = state_color;
 
     // === CENTER CONTENT ===
-    // Large cycle count
-    char num_buf[16];
-    snprintf(num_buf, sizeof(num_buf), "%" PRIu32, cycle);
-    canvas_->setTextSize(4);
-    canvas_->setTextColor(colors::text_primary);
-    const int16_t nw = static_cast<int16_t>(canvas_->textWidth(num_buf));
-    canvas_->setCursor(cx - nw / 2, cy - 30);
-    canvas_->print(num_buf);
-    
+    // Large cycle count: the interpolated display value (real counter plus
+    // rate-extrapolated advance, see predictedCycle_), blitted from the
+    // digit glyph cache instead of re-rasterizing size-4 glyphs per frame.
+    // Arc-only partial frames (segment append) clip to the arc's bounding
+    // band; when that band misses the center, the digits skip formatting
+    // and blitting entirely instead of rasterizing into the clip.
+    const uint32_t shown_cycle = use_status ? frame_snapshot_.display_cycle : 0;
+    if (bandVisible_(static_cast<int16_t>(cy - 30), 32)) {
+        const char* num_buf = formatGroupedCycle_(shown_cycle);
+        const int16_t nw = static_cast<int16_t>(strlen(num_buf) * kGlyphW_);
+        cacheNote_(CacheId::Glyphs, glyph_cache_valid_);
+        if (buildGlyphCache_()) {
+            glyph_last_use_ms_ = now_ms;
+            drawCounterDigits_(num_buf, static_cast<int16_t>(cx - nw / 2), static_cast<int16_t>(cy - 30));
+        } else {
+            canvas_->setTextSize(4);
+            canvas_->setTextColor(thm().text_primary);
+            canvas_->setCursor(cx - nw / 2, cy - 30);
+            canvas_->print(num_buf);
+        }
+    }
+
     // Target label
-    char target_buf[24];
-    snprintf(target_buf, sizeof(target_buf), "/ %" PRIu32, target);
-    canvas_->setTextSize(1);
-    canvas_->setTextColor(colors::text_muted);
-    const int16_t tw = static_cast<int16_t>(canvas_->textWidth(target_buf));
-    canvas_->setCursor(cx - tw / 2, cy + 8);
-    canvas_->print(target_buf);
-    
-    // State indicator (rounded pill)
-    const int16_t pill_w = 80;
+    {
+        char tgt_buf[16];
+        formatGrouped_(target, tgt_buf, sizeof(tgt_buf));
+        drawCenteredTextf_(cx, static_cast<int16_t>(cy + 8), thm().text_muted, 1,
+                           "/ %s", tgt_buf);
+    }
+
+    // State indicator (rounded pill); widened while a journaled command's
+    // longer pending text is showing.
+    const int16_t pill_w = critical_pending_ ? 96 : 80;
     const int16_t pill_h = 20;
     const int16_t pill_x = cx - pill_w / 2;
     const int16_t pill_y = cy + 28;
     canvas_->fillSmoothRoundRect(pill_x, pill_y, pill_w, pill_h, pill_h/2, state_color);
     
     canvas_->setTextSize(1);
-    canvas_->setTextColor(colors::bg_primary);
-    const int16_t sw = static_cast<int16_t>(canvas_->textWidth(state_text));
+    canvas_->setTextColor(thm().bg_primary);
+    const int16_t sw = measureText_(state_text);
     canvas_->setCursor(cx - sw / 2, pill_y + 6);
     canvas_->print(state_text);
 
@@ -3077,22 +9331,108 @@ void ui::UiController::drawLiveCounter_(uint32_t now_ms) noexcept
     const int16_t back_w = 88;
     const int16_t back_h = 30;
     const bool back_focused = (live_focus_ == LiveFocus::Back);
-    canvas_->fillSmoothRoundRect(back_x, back_y, back_w, back_h, 10, back_focused ? colors::accent_blue : colors::bg_elevated);
+    canvas_->fillSmoothRoundRect(back_x, back_y, back_w, back_h, 10, back_focused ? thm().accent_blue : thm().bg_elevated);
     if (back_focused) {
-        canvas_->drawRoundRect(back_x, back_y, back_w, back_h, 10, colors::text_primary);
+        canvas_->drawRoundRect(back_x, back_y, back_w, back_h, 10, thm().text_primary);
     }
     canvas_->setTextSize(1);
-    canvas_->setTextColor(back_focused ? colors::bg_primary : colors::text_secondary);
+    canvas_->setTextColor(back_focused ? thm().bg_primary : thm().text_secondary);
     canvas_->setCursor(back_x + 18, back_y + 9);
     canvas_->print("< Back");
 
     // Connection indicator (top-right)
     th::drawConnectionDot(240 - 18, 18, conn_status_ == ConnStatus::Connected, now_ms);
 
+    // === ERROR PANEL ===
+    // A nonzero err_code takes over the lower readout area: raw code plus
+    // the knowledge-base decode (fatigue_errors.hpp) and how long the
+    // error has stood, so nobody has to radio engineering for a number.
+    const uint8_t err_code = use_status ? frame_snapshot_.status.err_code : 0;
+    if (err_code != 0) {
+        const auto& info = fatigue_proto::LookupError(err_code);
+        const uint16_t err_color = (info.severity == fatigue_proto::ErrSeverity::Fault)
+                                       ? thm().accent_red
+                                       : thm().accent_yellow;
+        char line_buf[44];
+        snprintf(line_buf, sizeof(line_buf), "E%u %s",
+                 static_cast<unsigned>(err_code), info.name);
+        drawCenteredText_(cx, cy + 52, line_buf, err_color, 1);
+        drawCenteredText_(cx, cy + 64, info.action, thm().text_secondary, 1);
+        if (live_err_code_ == err_code) {
+            char age_buf[12];
+            formatEta_(now_ms - live_err_since_ms_, age_buf, sizeof(age_buf));
+            snprintf(line_buf, sizeof(line_buf), "for %s", age_buf);
+            drawCenteredText_(cx, cy + 76, line_buf, thm().text_muted, 1);
+        }
+    }
+
+    // === CYCLE RATE SPARKLINE ===
+    // Rate readout plus a per-segment trend graph from the history ring.
+    if (err_code == 0 && use_status && cycle_history_.size() >= 2 &&
+        (test_state == fatigue_proto::TestState::Running || test_state == fatigue_proto::TestState::Paused)) {
+        // Rate readout plus ETA (with 90% half-spread once the rate
+        // variance supports one); a flagged stall takes over the line.
+        char rate_buf[40];
+        uint32_t eta_ms = 0;
+        uint32_t spread_ms = 0;
+        if (live_stall_alert_) {
+            snprintf(rate_buf, sizeof(rate_buf), "STALLED  rate %.1f/min",
+                     static_cast<double>(cycle_est_.ratePerMin()));
+            drawCenteredText_(cx, cy + 52, rate_buf, thm().accent_red, 1);
+        } else if (test_state == fatigue_proto::TestState::Running &&
+                   cycle_est_.eta(cycle, target, eta_ms, spread_ms)) {
+            char eta_buf[12];
+            formatEta_(eta_ms, eta_buf, sizeof(eta_buf));
+            if (spread_ms > 0) {
+                char spread_buf[12];
+                formatEta_(spread_ms, spread_buf, sizeof(spread_buf));
+                snprintf(rate_buf, sizeof(rate_buf), "%.1f/min  ETA %s +/-%s",
+                         static_cast<double>(cycle_est_.ratePerMin()), eta_buf, spread_buf);
+            } else {
+                snprintf(rate_buf, sizeof(rate_buf), "%.1f/min  ETA %s",
+                         static_cast<double>(cycle_est_.ratePerMin()), eta_buf);
+            }
+            drawCenteredText_(cx, cy + 52, rate_buf, thm().text_muted, 1);
+        } else {
+            snprintf(rate_buf, sizeof(rate_buf), "%.1f /min",
+                     static_cast<double>(cycle_history_.ratePerMin()));
+            drawCenteredText_(cx, cy + 52, rate_buf, thm().text_muted, 1);
+        }
+
+        // One pass over the ring: rate of each adjacent sample pair.
+        float seg_rates[CycleHistory::kCapacity];
+        size_t nseg = 0;
+        float max_rate = 0.0f;
+        for (size_t i = 1; i < cycle_history_.size(); ++i) {
+            const auto& a = cycle_history_.at(i - 1);
+            const auto& b = cycle_history_.at(i);
+            const uint32_t dt = b.t_ms - a.t_ms;
+            if (dt == 0) {
+                continue;
+            }
+            const float r = static_cast<float>(b.cycle - a.cycle) * 60000.0f / static_cast<float>(dt);
+            seg_rates[nseg++] = r;
+            max_rate = std::max(max_rate, r);
+        }
+        if (nseg >= 2 && max_rate > 0.0f) {
+            const int16_t graph_w = 90;
+            const int16_t graph_h = 12;
+            const int16_t graph_x = cx - graph_w / 2;
+            const int16_t graph_y = cy + 64;
+            for (size_t i = 0; i < nseg; ++i) {
+                const int16_t x0 = graph_x + static_cast<int16_t>(i * graph_w / nseg);
+                const int16_t x1 = graph_x + static_cast<int16_t>((i + 1) * graph_w / nseg);
+                const int16_t bar_w = std::max<int16_t>(1, static_cast<int16_t>(x1 - x0 - 1));
+                const int16_t bar_h = 1 + static_cast<int16_t>((seg_rates[i] / max_rate) * (graph_h - 1));
+                canvas_->fillRect(x0, graph_y + graph_h - bar_h, bar_w, bar_h, thm().accent_blue);
+            }
+        }
+    }
+
     // === BOTTOM ACTION HINT ===
     const int16_t hint_y = 240 - 28;
     canvas_->setTextSize(1);
-    canvas_->setTextColor(colors::text_hint);
+    canvas_->setTextColor(thm().text_hint);
     
     // Show different hints based on state
     const char* hint_text = (live_focus_ == LiveFocus::Back) ? "Press: back" : "Press: actions";
@@ -3100,10 +9440,11 @@ void ui::UiController::drawLiveCounter_(uint32_t now_ms) noexcept
         // During test: show that long-press opens quick settings (abbreviated to fit)
         hint_text = (live_focus_ == LiveFocus::Back) ? "Press: back" : "Click: menu | Hold: cfg";
     }
-    drawCenteredText_(cx, hint_y, hint_text, colors::text_hint, 1);
+    drawCenteredText_(cx, hint_y, hint_text, thm().text_hint, 1);
     
     // Touch target indicator (subtle arc at bottom)
-    canvas_->drawArc(cx, cy, 98, 96, 160, 200, colors::bg_elevated);
+    ui::ring::fillRingArc(canvas_, cx, cy, 98, 96, 160, 200, thm().bg_elevated,
+                          thm().bg_primary);
 }
 
 void ui::UiController::drawLivePopup_(uint32_t now_ms) noexcept
@@ -3120,8 +9461,8 @@ void ui::UiController::drawLivePopup_(uint32_t now_ms) noexcept
     const int16_t popup_x = cx - popup_w / 2;
     const int16_t popup_y = cy - popup_h / 2;
     
-    drawRoundedRect_(popup_x, popup_y, popup_w, popup_h, 12, 0x2104, true);
-    drawRoundedRect_(popup_x, popup_y, popup_w, popup_h, 12, 0x6B9F, false);
+    drawRoundedRect_(popup_x, popup_y, popup_w, popup_h, 12, thm().bg_card, true);
+    drawRoundedRect_(popup_x, popup_y, popup_w, popup_h, 12, thm().popup_border, false);
     
     // Title
     canvas_->setTextSize(2);
@@ -3130,7 +9471,7 @@ void ui::UiController::drawLivePopup_(uint32_t now_ms) noexcept
     if (live_popup_mode_ == LivePopupMode::StartConfirm) {
         title = "Start Test?";
     }
-    const int16_t title_w = static_cast<int16_t>(canvas_->textWidth(title));
+    const int16_t title_w = measureText_(title);
     canvas_->setCursor(cx - title_w / 2, popup_y + 14);
     canvas_->print(title);
     
@@ -3149,7 +9490,7 @@ void ui::UiController::drawLivePopup_(uint32_t now_ms) noexcept
         
         drawButton_(cancel_btn, "Cancel", live_popup_selection_ == 0, false);
         drawActionButton_(btn_x2, btn_y1, btn_w, btn_h, "Start", 
-                         live_popup_selection_ == 1, colors::accent_green, false);
+                         live_popup_selection_ == 1, thm().accent_green, false);
         
     } else if (live_popup_mode_ == LivePopupMode::RunningActions) {
         // Three buttons: Back / Pause / Stop
@@ -3163,9 +9504,9 @@ void ui::UiController::drawLivePopup_(uint32_t now_ms) noexcept
         
         drawButton_(back_btn, "Back", live_popup_selection_ == 0, false);
         drawActionButton_(btn_x2, btn_y1, btn_w, btn_h, "Pause",
-                         live_popup_selection_ == 1, colors::accent_yellow, true);
+                         live_popup_selection_ == 1, thm().accent_yellow, true);
         drawActionButton_(stop_x, btn_y2, btn_w, btn_h, "Stop",
-                         live_popup_selection_ == 2, colors::accent_red, false);
+                         live_popup_selection_ == 2, thm().accent_red, false);
         
     } else if (live_popup_mode_ == LivePopupMode::PausedActions) {
         // Three buttons: Back / Resume / Stop
@@ -3179,10 +9520,33 @@ void ui::UiController::drawLivePopup_(uint32_t now_ms) noexcept
         
         drawButton_(back_btn, "Back", live_popup_selection_ == 0, false);
         drawActionButton_(btn_x2, btn_y1, btn_w, btn_h, "Resume",
-                         live_popup_selection_ == 1, colors::accent_green, false);
+                         live_popup_selection_ == 1, thm().accent_green, false);
         drawActionButton_(stop_x, btn_y2, btn_w, btn_h, "Stop",
-                         live_popup_selection_ == 2, colors::accent_red, false);
+                         live_popup_selection_ == 2, thm().accent_red, false);
+    }
+}
+
+void ui::UiController::speculate_(fatigue_proto::CommandId cmd,
+                                  fatigue_proto::TestState expected,
+                                  uint32_t now_ms) noexcept
+{
+    spec_.expected_state = static_cast<uint8_t>(expected);
+    spec_.command_id = static_cast<uint8_t>(cmd);
+    spec_.since_ms = now_ms;
+}
+
+void ui::UiController::serviceSpeculation_(uint32_t now_ms) noexcept
+{
+    if (spec_.since_ms == 0 || now_ms - spec_.since_ms <= kSpecTimeout_ms) {
+        return;
     }
+    // Neither an ack nor a confirming status inside the window: roll the
+    // pill back to whatever the unit last reported and say so.
+    logfAt_(LogLevel::Warn, now_ms, "Cmd %u unconfirmed, rolled back",
+            static_cast<unsigned>(spec_.command_id));
+    playBeep_(4);
+    spec_ = {};
+    dirty_ = true;
 }
 
 void ui::UiController::handleLivePopupInput_(int delta, bool click, uint32_t now_ms) noexcept
@@ -3195,7 +9559,6 @@ void ui::UiController::handleLivePopupInput_(int delta, bool click, uint32_t now
         } else {
             live_popup_selection_ = static_cast<uint8_t>((live_popup_selection_ + max_sel) % (max_sel + 1));
         }
-        playBeep_(delta > 0 ? 1 : 0);
         dirty_ = true;
     }
     
@@ -3208,15 +9571,14 @@ void ui::UiController::handleLivePopupInput_(int delta, bool click, uint32_t now
                 live_popup_mode_ = LivePopupMode::None;
             } else {
                 // Start
-                const bool ok = espnow::SendCommand(
-                    fatigue_proto::DEVICE_ID_FATIGUE_TESTER_,
-                    static_cast<uint8_t>(fatigue_proto::CommandId::Start),
-                    nullptr,
-                    0);
+                const bool ok = sendCommandActive_(static_cast<uint8_t>(fatigue_proto::CommandId::Start), nullptr, 0);
                 if (ok) {
-                    pending_command_id_ = 1;
-                    pending_command_tick_ = now_ms;
+                    speculate_(fatigue_proto::CommandId::Start,
+                               fatigue_proto::TestState::Running, now_ms);
                     logf_(now_ms, "TX: Start cmd");
+                    // Dense samples through the ramp-up, where rate and
+                    // bounds problems show first.
+                    requestStatusBurst_(now_ms, 5000);
                 } else {
                     logf_(now_ms, "TX: Start cmd FAILED");
                 }
@@ -3228,14 +9590,10 @@ void ui::UiController::handleLivePopupInput_(int delta, bool click, uint32_t now
                 live_popup_mode_ = LivePopupMode::None;
             } else if (live_popup_selection_ == 1) {
                 // Pause
-                const bool ok = espnow::SendCommand(
-                    fatigue_proto::DEVICE_ID_FATIGUE_TESTER_,
-                    static_cast<uint8_t>(fatigue_proto::CommandId::Pause),
-                    nullptr,
-                    0);
+                const bool ok = sendCommandActive_(static_cast<uint8_t>(fatigue_proto::CommandId::Pause), nullptr, 0);
                 if (ok) {
-                    pending_command_id_ = 2;
-                    pending_command_tick_ = now_ms;
+                    speculate_(fatigue_proto::CommandId::Pause,
+                               fatigue_proto::TestState::Paused, now_ms);
                     logf_(now_ms, "TX: Pause cmd");
                 } else {
                     logf_(now_ms, "TX: Pause cmd FAILED");
@@ -3243,14 +9601,10 @@ void ui::UiController::handleLivePopupInput_(int delta, bool click, uint32_t now
                 live_popup_mode_ = LivePopupMode::None;
             } else {
                 // Stop
-                const bool ok = espnow::SendCommand(
-                    fatigue_proto::DEVICE_ID_FATIGUE_TESTER_,
-                    static_cast<uint8_t>(fatigue_proto::CommandId::Stop),
-                    nullptr,
-                    0);
+                const bool ok = sendCommandActive_(static_cast<uint8_t>(fatigue_proto::CommandId::Stop), nullptr, 0);
                 if (ok) {
-                    pending_command_id_ = 4;
-                    pending_command_tick_ = now_ms;
+                    speculate_(fatigue_proto::CommandId::Stop,
+                               fatigue_proto::TestState::Idle, now_ms);
                     logf_(now_ms, "TX: Stop cmd");
                 } else {
                     logf_(now_ms, "TX: Stop cmd FAILED");
@@ -3263,14 +9617,10 @@ void ui::UiController::handleLivePopupInput_(int delta, bool click, uint32_t now
                 live_popup_mode_ = LivePopupMode::None;
             } else if (live_popup_selection_ == 1) {
                 // Resume
-                const bool ok = espnow::SendCommand(
-                    fatigue_proto::DEVICE_ID_FATIGUE_TESTER_,
-                    static_cast<uint8_t>(fatigue_proto::CommandId::Resume),
-                    nullptr,
-                    0);
+                const bool ok = sendCommandActive_(static_cast<uint8_t>(fatigue_proto::CommandId::Resume), nullptr, 0);
                 if (ok) {
-                    pending_command_id_ = 3;
-                    pending_command_tick_ = now_ms;
+                    speculate_(fatigue_proto::CommandId::Resume,
+                               fatigue_proto::TestState::Running, now_ms);
                     logf_(now_ms, "TX: Resume cmd");
                 } else {
                     logf_(now_ms, "TX: Resume cmd FAILED");
@@ -3278,14 +9628,10 @@ void ui::UiController::handleLivePopupInput_(int delta, bool click, uint32_t now
                 live_popup_mode_ = LivePopupMode::None;
             } else {
                 // Stop
-                const bool ok = espnow::SendCommand(
-                    fatigue_proto::DEVICE_ID_FATIGUE_TESTER_,
-                    static_cast<uint8_t>(fatigue_proto::CommandId::Stop),
-                    nullptr,
-                    0);
+                const bool ok = sendCommandActive_(static_cast<uint8_t>(fatigue_proto::CommandId::Stop), nullptr, 0);
                 if (ok) {
-                    pending_command_id_ = 4;
-                    pending_command_tick_ = now_ms;
+                    speculate_(fatigue_proto::CommandId::Stop,
+                               fatigue_proto::TestState::Idle, now_ms);
                     logf_(now_ms, "TX: Stop cmd");
                 } else {
                     logf_(now_ms, "TX: Stop cmd FAILED");
@@ -3310,14 +9656,14 @@ void ui::UiController::drawQuickSettings_(uint32_t now_ms) noexcept
     const int16_t cy = th::CENTER_Y;
     
     // Full-screen overlay with dark background
-    canvas_->fillScreen(colors::bg_primary);
-    canvas_->drawCircle(cx, cy, 118, colors::bg_elevated);
+    canvas_->fillScreen(thm().bg_primary);
+    canvas_->drawCircle(cx, cy, 118, thm().bg_elevated);
     
     // Title - use size 1 with bold simulation for compact fit
     canvas_->setTextSize(1);
-    canvas_->setTextColor(colors::text_primary);
+    canvas_->setTextColor(thm().text_primary);
     const char* title = "Quick Config";
-    int16_t tw = static_cast<int16_t>(canvas_->textWidth(title));
+    int16_t tw = measureText_(title);
     // Draw twice offset by 1px for bold effect
     canvas_->setCursor(cx - tw / 2, 22);
     canvas_->print(title);
@@ -3326,9 +9672,9 @@ void ui::UiController::drawQuickSettings_(uint32_t now_ms) noexcept
     
     // Subtitle hint
     canvas_->setTextSize(1);
-    canvas_->setTextColor(colors::text_hint);
+    canvas_->setTextColor(thm().text_hint);
     const char* hint = "Adjust mid-test";
-    const int16_t hw = static_cast<int16_t>(canvas_->textWidth(hint));
+    const int16_t hw = measureText_(hint);
     canvas_->setCursor(cx - hw / 2, 36);
     canvas_->print(hint);
     
@@ -3375,13 +9721,13 @@ void ui::UiController::drawQuickSettings_(uint32_t now_ms) noexcept
         if (quick_editor_u32_new_ == 0) {
             snprintf(values[4], sizeof(values[4]), "Infinite");
         } else {
-            snprintf(values[4], sizeof(values[4]), "%" PRIu32, quick_editor_u32_new_);
+            formatGrouped_(quick_editor_u32_new_, values[4], sizeof(values[4]));
         }
     } else {
         if (edit_settings_.test_unit.cycle_amount == 0) {
             snprintf(values[4], sizeof(values[4]), "Infinite");
         } else {
-            snprintf(values[4], sizeof(values[4]), "%" PRIu32, edit_settings_.test_unit.cycle_amount);
+            formatGrouped_(edit_settings_.test_unit.cycle_amount, values[4], sizeof(values[4]));
         }
     }
     
@@ -3393,22 +9739,31 @@ void ui::UiController::drawQuickSettings_(uint32_t now_ms) noexcept
         // Background - use smaller rounding for compact items
         if (selected) {
             canvas_->fillSmoothRoundRect(kListX, y, kListW, kItemH - 2, 6, 
-                editing ? colors::accent_orange : colors::accent_blue);
+                editing ? thm().accent_orange : thm().accent_blue);
         } else {
-            canvas_->fillSmoothRoundRect(kListX, y, kListW, kItemH - 2, 6, colors::bg_elevated);
+            canvas_->fillSmoothRoundRect(kListX, y, kListW, kItemH - 2, 6, thm().bg_elevated);
         }
         
         // Label - text size 2 for better readability
         canvas_->setTextSize(2);
-        canvas_->setTextColor(selected ? colors::bg_primary : colors::text_secondary);
+        canvas_->setTextColor(selected ? thm().bg_primary : thm().text_secondary);
         canvas_->setCursor(kListX + 8, y + 5);
         canvas_->print(labels[i]);
         
         // Value (right-aligned)
         if (i > 0) {
-            const int16_t vw = static_cast<int16_t>(canvas_->textWidth(values[i]));
+            const int16_t vw = measureText_(values[i]);
             canvas_->setCursor(kListX + kListW - vw - 8, y + 5);
             canvas_->print(values[i]);
+
+            // Staged-edit badge: amber while pending locally, cyan while
+            // the coalesced update awaits its ConfigAck.
+            const uint8_t bit = static_cast<uint8_t>(1U << i);
+            if ((quick_pending_mask_ & bit) != 0) {
+                canvas_->fillCircle(kListX + kListW + 8, y + kItemH / 2 - 1, 3, thm().accent_orange);
+            } else if ((quick_inflight_mask_ & bit) != 0) {
+                canvas_->fillCircle(kListX + kListW + 8, y + kItemH / 2 - 1, 3, thm().accent_cyan);
+            }
         }
     }
     
@@ -3425,68 +9780,79 @@ void ui::UiController::drawQuickSettings_(uint32_t now_ms) noexcept
         } else {
             action_hint = "Rotate: adjust";
         }
+    } else if (quick_pending_mask_ != 0) {
+        action_hint = "Pending - sends on idle/exit";
     } else {
         action_hint = "Click:edit | Back:exit";
     }
     canvas_->setTextSize(1);
-    const int16_t ahw = static_cast<int16_t>(canvas_->textWidth(action_hint));
+    const int16_t ahw = measureText_(action_hint);
     const int16_t pill_w = ahw + 16;  // padding on each side
     const int16_t pill_h = 18;
     const int16_t pill_x = cx - pill_w / 2;
     const int16_t pill_y = 205;
     // Draw pill background with border
-    canvas_->fillSmoothRoundRect(pill_x, pill_y, pill_w, pill_h, 9, colors::bg_elevated);
-    canvas_->drawRoundRect(pill_x, pill_y, pill_w, pill_h, 9, colors::text_hint);
+    canvas_->fillSmoothRoundRect(pill_x, pill_y, pill_w, pill_h, 9, thm().bg_elevated);
+    canvas_->drawRoundRect(pill_x, pill_y, pill_w, pill_h, 9, thm().text_hint);
     // Draw text centered in pill
-    canvas_->setTextColor(colors::text_secondary);
+    canvas_->setTextColor(thm().text_secondary);
     canvas_->setCursor(cx - ahw / 2, pill_y + 4);
     canvas_->print(action_hint);
     
-    // Draw confirmation popup if active
-    if (quick_settings_confirm_popup_) {
-        // Popup overlay
-        const int16_t pw = 180;
-        const int16_t ph = 90;
-        const int16_t px = cx - pw / 2;
-        const int16_t py = cy - ph / 2;
-        
-        canvas_->fillSmoothRoundRect(px, py, pw, ph, 12, colors::bg_elevated);
-        canvas_->drawRoundRect(px, py, pw, ph, 12, colors::accent_blue);
-        
-        // Title
-        canvas_->setTextSize(2);
-        canvas_->setTextColor(colors::text_primary);
-        const char* popup_title = "Apply?";
-        const int16_t ptw = static_cast<int16_t>(canvas_->textWidth(popup_title));
-        canvas_->setCursor(cx - ptw / 2, py + 12);
-        canvas_->print(popup_title);
-        
-        // Buttons: Keep / Revert
-        const int16_t btn_w = 70;
-        const int16_t btn_h = 32;
-        const int16_t btn_y = py + ph - btn_h - 12;
-        const int16_t btn_spacing = 10;
-        const int16_t total_btn_w = btn_w * 2 + btn_spacing;
-        const int16_t keep_x = cx - total_btn_w / 2;
-        const int16_t revert_x = keep_x + btn_w + btn_spacing;
-        
-        // Keep button (green accent)
-        drawActionButton_(keep_x, btn_y, btn_w, btn_h, "Keep",
-                         quick_settings_confirm_sel_ == 0, colors::accent_green, false);
-        
-        // Revert button (red accent)
-        drawActionButton_(revert_x, btn_y, btn_w, btn_h, "Revert",
-                         quick_settings_confirm_sel_ == 1, colors::accent_red, false);
+    // Draw confirmation popup if active (withheld during an overlay
+    // capture pass; the compositor draws it over the frozen snapshot).
+    if (quick_settings_confirm_popup_ && !overlay_capture_) {
+        drawQuickSettingsConfirm_(now_ms);
     }
 }
 
+void ui::UiController::drawQuickSettingsConfirm_(uint32_t now_ms) noexcept
+{
+    (void)now_ms;
+    const int16_t cx = 240 / 2;
+    const int16_t cy = 240 / 2;
+
+    // Popup overlay
+    const int16_t pw = 180;
+    const int16_t ph = 90;
+    const int16_t px = cx - pw / 2;
+    const int16_t py = cy - ph / 2;
+
+    canvas_->fillSmoothRoundRect(px, py, pw, ph, 12, thm().bg_elevated);
+    canvas_->drawRoundRect(px, py, pw, ph, 12, thm().accent_blue);
+
+    // Title
+    canvas_->setTextSize(2);
+    canvas_->setTextColor(thm().text_primary);
+    const char* popup_title = "Apply?";
+    const int16_t ptw = measureText_(popup_title);
+    canvas_->setCursor(cx - ptw / 2, py + 12);
+    canvas_->print(popup_title);
+
+    // Buttons: Keep / Revert
+    const int16_t btn_w = 70;
+    const int16_t btn_h = 32;
+    const int16_t btn_y = py + ph - btn_h - 12;
+    const int16_t btn_spacing = 10;
+    const int16_t total_btn_w = btn_w * 2 + btn_spacing;
+    const int16_t keep_x = cx - total_btn_w / 2;
+    const int16_t revert_x = keep_x + btn_w + btn_spacing;
+
+    // Keep button (green accent)
+    drawActionButton_(keep_x, btn_y, btn_w, btn_h, "Keep",
+                     quick_settings_confirm_sel_ == 0, thm().accent_green, false);
+
+    // Revert button (red accent)
+    drawActionButton_(revert_x, btn_y, btn_w, btn_h, "Revert",
+                     quick_settings_confirm_sel_ == 1, thm().accent_red, false);
+}
+
 void ui::UiController::handleQuickSettingsInput_(int delta, bool click, uint32_t now_ms) noexcept
 {
     // Handle confirmation popup first
     if (quick_settings_confirm_popup_) {
         if (delta != 0) {
             quick_settings_confirm_sel_ = (quick_settings_confirm_sel_ == 0) ? 1 : 0;
-            playBeep_(delta > 0 ? 1 : 0);
             dirty_ = true;
         }
         if (click) {
@@ -3534,13 +9900,14 @@ void ui::UiController::handleQuickSettingsInput_(int delta, bool click, uint32_t
     // Normal navigation
     if (delta != 0) {
         quick_settings_index_ = (quick_settings_index_ + delta + kQuickSettingsItemCount_) % kQuickSettingsItemCount_;
-        playBeep_(delta > 0 ? 1 : 0);
         dirty_ = true;
     }
     
     if (click) {
         if (quick_settings_index_ == 0) {
-            // Back - exit quick settings
+            // Back - exit quick settings; staged edits go out now rather
+            // than waiting for the quiescence window.
+            flushQuickSettings_(now_ms);
             live_popup_mode_ = LivePopupMode::None;
             playBeep_(2);
         } else {
@@ -3588,275 +9955,1346 @@ void ui::UiController::beginQuickSettingsEdit_() noexcept
     }
 }
 
-void ui::UiController::handleQuickSettingsValueEdit_(int delta) noexcept
+void ui::UiController::handleQuickSettingsValueEdit_(int delta) noexcept
+{
+    if (!quick_settings_editing_ || delta == 0) {
+        return;
+    }
+    
+    switch (quick_editor_type_) {
+        case QuickEditorType::F32: {
+            const float next = quick_editor_f32_new_ + quick_editor_f32_step_ * static_cast<float>(delta);
+            quick_editor_f32_new_ = std::max(0.1f, std::round(next * 10.0f) / 10.0f);
+            break;
+        }
+        case QuickEditorType::U32: {
+            const int64_t next = static_cast<int64_t>(quick_editor_u32_new_) + static_cast<int64_t>(delta) * static_cast<int64_t>(quick_editor_u32_step_);
+            quick_editor_u32_new_ = static_cast<uint32_t>(std::max(int64_t{0}, next));
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+bool ui::UiController::quickEditorHasChange_() const noexcept
+{
+    switch (quick_editor_type_) {
+        case QuickEditorType::F32:
+            return std::fabs(static_cast<double>(quick_editor_f32_new_ - quick_editor_f32_old_)) > 0.001;
+        case QuickEditorType::U32:
+            return quick_editor_u32_new_ != quick_editor_u32_old_;
+        default:
+            return false;
+    }
+}
+
+void ui::UiController::cycleQuickSettingsStep_() noexcept
+{
+    // Handle F32 types (VMAX, AMAX)
+    if (quick_editor_type_ == QuickEditorType::F32) {
+        // VMAX and AMAX both use 0.1, 1, 10 steps
+        static constexpr float kSteps[] = {0.1f, 1.0f, 10.0f};
+        static constexpr size_t kCount = sizeof(kSteps) / sizeof(kSteps[0]);
+        
+        size_t idx = 0;
+        for (size_t i = 0; i < kCount; ++i) {
+            if (std::fabs(static_cast<double>(kSteps[i] - quick_editor_f32_step_)) < 1e-6) {
+                idx = i;
+                break;
+            }
+        }
+        idx = (idx + 1) % kCount;
+        quick_editor_f32_step_ = kSteps[idx];
+    }
+    // Handle U32 types (Cycles only - Dwell is now F32)
+    else if (quick_editor_type_ == QuickEditorType::U32) {
+        if (quick_settings_index_ == 4) {
+            // Cycles: 10, 100, 1000 steps
+            static constexpr uint32_t kCycleSteps[] = {10, 100, 1000};
+            static constexpr size_t kCycleCount = sizeof(kCycleSteps) / sizeof(kCycleSteps[0]);
+            
+            size_t idx = 0;
+            for (size_t i = 0; i < kCycleCount; ++i) {
+                if (kCycleSteps[i] == quick_editor_u32_step_) {
+                    idx = i;
+                    break;
+                }
+            }
+            idx = (idx + 1) % kCycleCount;
+            quick_editor_u32_step_ = kCycleSteps[idx];
+        }
+    }
+}
+
+void ui::UiController::applyQuickSettingsValue_(uint32_t now_ms) noexcept
+{
+    // Apply the value to edit_settings_ through the schema write path, so
+    // the quick editor shares the per-field dirty tracking instead of
+    // carrying its own copy of the detection logic. Quick rows 1..4 map to
+    // the FatigueTest submenu items VMAX/AMAX/Dwell/Cycles.
+    static constexpr uint8_t kQuickFieldIndex[] = {0, 2, 3, 4, 1};
+    if (quick_settings_index_ < 1 || quick_settings_index_ > 4) {
+        return;
+    }
+    const SettingsFieldDesc* field = findSettingsField_(
+        SettingsCategory::FatigueTest, kQuickFieldIndex[quick_settings_index_]);
+    if (field == nullptr) {
+        return;
+    }
+    switch (quick_settings_index_) {
+        case 1: {  // VMAX
+            const float v = std::max(5.0f, quick_editor_f32_new_);
+            writeSettingsField_(*field, &v);
+            break;
+        }
+        case 2: {  // AMAX
+            const float v = std::max(0.5f, quick_editor_f32_new_);
+            writeSettingsField_(*field, &v);
+            break;
+        }
+        case 3: {  // Dwell (convert seconds to ms)
+            const uint32_t v =
+                static_cast<uint32_t>(std::max(0.0f, quick_editor_f32_new_) * 1000.0f);
+            writeSettingsField_(*field, &v);
+            break;
+        }
+        case 4: {  // Cycles
+            writeSettingsField_(*field, &quick_editor_u32_new_);
+            break;
+        }
+        default:
+            return;
+    }
+    
+    // Also update the main settings
+    if (settings_ != nullptr) {
+        *settings_ = edit_settings_;
+        SettingsStore::SaveAsync(*settings_);
+    }
+    
+    // Stage instead of sending: the field is badged pending and travels in
+    // one coalesced update once editing goes quiet (or on exit), so a
+    // VMAX+AMAX+dwell tuning pass costs one round trip instead of three.
+    quick_pending_mask_ |= static_cast<uint8_t>(1U << quick_settings_index_);
+    quick_pending_since_ms_ = now_ms;
+}
+
+void ui::UiController::flushQuickSettings_(uint32_t now_ms) noexcept
+{
+    if (quick_pending_mask_ == 0) {
+        return;
+    }
+    if (conn_status_ != ConnStatus::Connected) {
+        logf_(now_ms, "TX: Quick config skipped (not connected)");
+        quick_pending_mask_ = 0;
+        return;
+    }
+    // BuildConfigDelta diffs against the unit's last known config, so all
+    // staged fields coalesce into one ConfigDelta (or one full ConfigSet
+    // without a baseline) here.
+    const auto payload = fatigue_proto::BuildConfigPayload(edit_settings_);
+    if (config_check::Validate(payload, nullptr, 0) > 0) {
+        // Invalid values never converge by retrying; unstage so the
+        // quiescence window does not loop on a blocked send. The gate in
+        // sendConfigUpdateActive_ has logged the specifics.
+        (void)sendConfigUpdateActive_(payload, now_ms);
+        quick_pending_mask_ = 0;
+        dirty_ = true;
+        return;
+    }
+    if (sendConfigUpdateActive_(payload, now_ms)) {
+        quick_inflight_mask_ = quick_pending_mask_;
+        quick_pending_mask_ = 0;
+        dirty_ = true;
+    } else {
+        // Keep the fields staged; the quiescence window retries.
+        logf_(now_ms, "TX: Quick config FAILED");
+        quick_pending_since_ms_ = now_ms;
+    }
+}
+
+void ui::UiController::discardQuickSettingsValue_() noexcept
+{
+    // Just reset the editor values - no changes applied
+    switch (quick_editor_type_) {
+        case QuickEditorType::F32:
+            quick_editor_f32_new_ = quick_editor_f32_old_;
+            break;
+        case QuickEditorType::U32:
+            quick_editor_u32_new_ = quick_editor_u32_old_;
+            break;
+        default:
+            break;
+    }
+}
+
+void ui::UiController::drawDiagnostics_(uint32_t now_ms) noexcept
+{
+    const int16_t cx = th::CENTER_X;
+
+    // Back button (matches the global top-left touch target).
+    canvas_->fillSmoothRoundRect(10, 8, 70, 30, 10, thm().bg_elevated);
+    canvas_->setTextSize(1);
+    canvas_->setTextColor(thm().text_secondary);
+    canvas_->setCursor(24, 19);
+    canvas_->print("< Back");
+
+    drawCenteredText_(cx, 18, "LINK STATS", thm().text_primary, 2);
+
+    // Lifecycle line: boot number, lifetime uptime, what ended the last
+    // session (newest reset-ring entry). Red when the last end was a fault.
+    {
+        lifecycle::Stats lc{};
+        lifecycle::GetStats(lc);
+        char lc_buf[48];
+        int n;
+        bool fault = false;
+        if (lc.ring_count > 0) {
+            n = snprintf(lc_buf, sizeof(lc_buf), "boot %lu  up %luh  last %s",
+                         static_cast<unsigned long>(lc.boot_count),
+                         static_cast<unsigned long>((lc.total_uptime_min + lc.session_min) / 60U),
+                         lifecycle::ReasonName(lc.ring[0].reason));
+            fault = lc.ring[0].reason == ESP_RST_PANIC ||
+                    lc.ring[0].reason == ESP_RST_INT_WDT ||
+                    lc.ring[0].reason == ESP_RST_TASK_WDT ||
+                    lc.ring[0].reason == ESP_RST_WDT ||
+                    lc.ring[0].reason == ESP_RST_BROWNOUT;
+        } else {
+            n = snprintf(lc_buf, sizeof(lc_buf), "boot %lu  up %luh",
+                         static_cast<unsigned long>(lc.boot_count),
+                         static_cast<unsigned long>((lc.total_uptime_min + lc.session_min) / 60U));
+        }
+        // Power-on self-test flag rides the same line; the per-check
+        // table goes to serial with the PERF dump.
+        if (self_test::FailMask() != 0 && n > 0 &&
+            n < static_cast<int>(sizeof(lc_buf))) {
+            snprintf(lc_buf + n, sizeof(lc_buf) - static_cast<size_t>(n), "  post!");
+            fault = true;
+            n = static_cast<int>(strlen(lc_buf));
+        }
+        // Encoder drift flag (latched once a cross-check ever found the
+        // logical position out of sync with the PCNT count); counters go
+        // to serial with the PERF dump.
+        if (enc_drift_events_ > 0 && n > 0 && n < static_cast<int>(sizeof(lc_buf))) {
+            snprintf(lc_buf + n, sizeof(lc_buf) - static_cast<size_t>(n), "  enc!");
+            fault = true;
+        }
+        drawCenteredText_(cx, 35, lc_buf,
+                          fault ? thm().accent_red : thm().text_muted, 1);
+    }
+
+    // Snapshot under the protocol's lock; everything below renders copies.
+    espnow::LinkStats stats{};
+    espnow::GetLinkStats(stats);
+
+    // Headline: smoothed RTT normally; last/average input-to-photon latency
+    // while the probe is armed (long-press toggles it).
+    char buf[32];
+    uint8_t mac[6];
+    uint32_t srtt_ms = 0;
+    if (latency_probe_) {
+        if (latency_count_ > 0) {
+            const uint32_t avg_us =
+                static_cast<uint32_t>(latency_sum_us_ / latency_count_);
+            snprintf(buf, sizeof(buf), "LAT %lu/%lu ms",
+                     static_cast<unsigned long>(latency_last_us_ / 1000U),
+                     static_cast<unsigned long>(avg_us / 1000U));
+        } else {
+            snprintf(buf, sizeof(buf), "LAT -- turn dial");
+        }
+        drawCenteredText_(cx, 44, buf, thm().accent_yellow, 2);
+    } else if (ab_phase_ != 0) {
+        snprintf(buf, sizeof(buf), "AB %s pass %c",
+                 abSubjectName_(ab_result_subject_), 'A' + (ab_phase_ - 1));
+        drawCenteredText_(cx, 44, buf, thm().accent_blue, 2);
+    } else if (ab_have_results_) {
+        // Per-frame cost (render + flush) with the subject on vs off.
+        const auto avg10 = [](const AbPassStats& p) {
+            return (p.frames > 0)
+                       ? static_cast<uint32_t>((p.sum_us + p.flush_us) / p.frames / 100U)
+                       : 0U;
+        };
+        const uint32_t a = avg10(ab_pass_[0]);
+        const uint32_t b = avg10(ab_pass_[1]);
+        snprintf(buf, sizeof(buf), "AB %s %lu.%lu/%lu.%lums",
+                 abSubjectName_(ab_result_subject_),
+                 static_cast<unsigned long>(a / 10), static_cast<unsigned long>(a % 10),
+                 static_cast<unsigned long>(b / 10), static_cast<unsigned long>(b % 10));
+        drawCenteredText_(cx, 44, buf, thm().accent_blue, 2);
+    } else if (activeUnitMac_(mac) && espnow::GetPeerRttMs(mac, srtt_ms)) {
+        snprintf(buf, sizeof(buf), "RTT %lu ms", static_cast<unsigned long>(srtt_ms));
+        drawCenteredText_(cx, 44, buf, thm().accent_green, 2);
+    } else {
+        snprintf(buf, sizeof(buf), "RTT --");
+        drawCenteredText_(cx, 44, buf, thm().accent_green, 2);
+    }
+
+    // Delivery counters for tracked (ack-requiring) packets, then the
+    // receive-window verdicts (duplicates dropped / reordered deliveries).
+    snprintf(buf, sizeof(buf), "sent %lu  ack %lu",
+             static_cast<unsigned long>(stats.tracked_sent),
+             static_cast<unsigned long>(stats.acked));
+    drawCenteredText_(cx, 62, buf, thm().text_secondary, 1);
+    snprintf(buf, sizeof(buf), "retx %lu  lost %lu",
+             static_cast<unsigned long>(stats.retransmits),
+             static_cast<unsigned long>(stats.lost));
+    drawCenteredText_(cx, 72, buf,
+                      (stats.lost > 0) ? thm().accent_red : thm().text_secondary, 1);
+    // Malformed-frame rejects ride the delivery block: the total here, the
+    // per-reason table to serial with the PERF dump. Red is reserved for
+    // frames that passed the CRC and still failed (unapproved sender or a
+    // payload its parser refused) - those are hostile or seriously wrong,
+    // not RF noise.
+    espnow::RxRejectStats rej{};
+    espnow::GetRxRejectStats(rej);
+    const uint32_t rej_total = rej.runt + rej.bad_sync + rej.bad_version +
+                               rej.bad_length + rej.bad_crc + rej.unapproved +
+                               rej.bad_payload;
+    snprintf(buf, sizeof(buf), "dup %lu  reord %lu  rej %lu  ch%u",
+             static_cast<unsigned long>(stats.rx_duplicates),
+             static_cast<unsigned long>(stats.rx_reordered),
+             static_cast<unsigned long>(rej_total),
+             static_cast<unsigned>(espnow::GetCurrentChannel()));
+    drawCenteredText_(cx, 82, buf,
+                      (rej.unapproved + rej.bad_payload > 0) ? thm().accent_red
+                                                             : thm().text_secondary, 1);
+
+    // Memory telemetry (sampled every 5 s by the housekeeping tick).
+    if (mem_.valid) {
+        const bool mem_warn = mem_alert_heap_ || mem_alert_frag_ || mem_alert_stack_;
+        snprintf(buf, sizeof(buf), "heap %luk min %luk big %luk",
+                 static_cast<unsigned long>(mem_.heap_free / 1024),
+                 static_cast<unsigned long>(mem_.heap_min_free / 1024),
+                 static_cast<unsigned long>(mem_.heap_largest / 1024));
+        drawCenteredText_(cx, 91, buf,
+                          mem_warn ? thm().accent_red : thm().text_muted, 1);
+    }
+
+    // Histogram area: ack RTT normally, input-to-photon latency while the
+    // probe is armed. Log2 buckets either way, bars normalized to the
+    // fullest one.
+    constexpr int16_t kHistY = 100;
+    constexpr int16_t kHistH = 70;
+    constexpr int16_t kBarW = 12;
+    constexpr int16_t kBarGap = 4;
+    const bool ab_view = !latency_probe_ && (ab_phase_ != 0 || ab_have_results_);
+    if (ab_view) {
+        // A/B frame-time distributions: pass A (left half-bar, blue)
+        // against pass B (right half-bar, yellow) per log2 bucket, both
+        // normalized to the fullest half-bar of either pass.
+        const int16_t hist_x = static_cast<int16_t>(
+            120 - (kAbBuckets_ * (kBarW + kBarGap) - kBarGap) / 2);
+        uint32_t max_count = 1;
+        for (size_t i = 0; i < kAbBuckets_; ++i) {
+            max_count = std::max(max_count,
+                                 std::max(ab_pass_[0].hist[i], ab_pass_[1].hist[i]));
+        }
+        constexpr int16_t kHalfW = (kBarW - 2) / 2;
+        for (size_t i = 0; i < kAbBuckets_; ++i) {
+            const int16_t x = static_cast<int16_t>(hist_x + i * (kBarW + kBarGap));
+            canvas_->drawRect(x, kHistY, kBarW, kHistH, thm().bg_elevated);
+            const int16_t ha = static_cast<int16_t>(
+                (static_cast<uint64_t>(ab_pass_[0].hist[i]) * kHistH) / max_count);
+            if (ha > 0) {
+                canvas_->fillRect(static_cast<int16_t>(x + 1),
+                                  static_cast<int16_t>(kHistY + kHistH - ha), kHalfW, ha,
+                                  thm().accent_blue);
+            }
+            const int16_t hb = static_cast<int16_t>(
+                (static_cast<uint64_t>(ab_pass_[1].hist[i]) * kHistH) / max_count);
+            if (hb > 0) {
+                canvas_->fillRect(static_cast<int16_t>(x + 1 + kHalfW),
+                                  static_cast<int16_t>(kHistY + kHistH - hb), kHalfW, hb,
+                                  thm().accent_yellow);
+            }
+        }
+        canvas_->setTextSize(1);
+        canvas_->setTextColor(thm().text_muted);
+        canvas_->setCursor(hist_x, kHistY + kHistH + 4);
+        canvas_->print("1ms");
+        canvas_->setCursor(static_cast<int16_t>(hist_x + (kAbBuckets_ - 1) * (kBarW + kBarGap) - 10),
+                           kHistY + kHistH + 4);
+        canvas_->print(">=64");
+    } else {
+        const uint32_t* hist = latency_probe_ ? latency_hist_ : stats.hist;
+        const size_t buckets = latency_probe_ ? kLatencyBuckets_
+                                              : espnow::LinkStats::HIST_BUCKETS;
+        const int16_t hist_x =
+            static_cast<int16_t>(120 - (buckets * (kBarW + kBarGap) - kBarGap) / 2);
+        uint32_t max_count = 1;
+        for (size_t i = 0; i < buckets; ++i) {
+            max_count = std::max(max_count, hist[i]);
+        }
+        for (size_t i = 0; i < buckets; ++i) {
+            const int16_t x = static_cast<int16_t>(hist_x + i * (kBarW + kBarGap));
+            const int16_t h =
+                static_cast<int16_t>((static_cast<uint64_t>(hist[i]) * kHistH) / max_count);
+            canvas_->drawRect(x, kHistY, kBarW, kHistH, thm().bg_elevated);
+            if (h > 0) {
+                canvas_->fillRect(x, static_cast<int16_t>(kHistY + kHistH - h), kBarW, h,
+                                  latency_probe_ ? thm().accent_yellow : thm().accent_blue);
+            }
+        }
+        canvas_->setTextSize(1);
+        canvas_->setTextColor(thm().text_muted);
+        canvas_->setCursor(hist_x, kHistY + kHistH + 4);
+        canvas_->print(latency_probe_ ? "4ms" : "1ms");
+        canvas_->setCursor(static_cast<int16_t>(hist_x + (buckets - 1) * (kBarW + kBarGap) - 10),
+                           kHistY + kHistH + 4);
+        canvas_->print(latency_probe_ ? ">256" : ">512");
+    }
+
+    // Tightest task stack headroom plus the frame arena's high-water mark,
+    // between the histogram axis labels.
+    if (mem_.valid && mem_.worst_stack_task[0] != '\0') {
+        snprintf(buf, sizeof(buf), "stk %lu %s  ar %lu",
+                 static_cast<unsigned long>(mem_.worst_stack_free), mem_.worst_stack_task,
+                 static_cast<unsigned long>(frame_arena_.highWater()));
+        canvas_->setTextColor(mem_alert_stack_ ? thm().accent_red : thm().text_muted);
+        const int16_t sw = measureText_(buf);
+        canvas_->setCursor(static_cast<int16_t>(cx - sw / 2), kHistY + kHistH + 4);
+        canvas_->print(buf);
+    }
+
+    // Health-monitor budget misses per task (late turnarounds + work over
+    // budget), main/render/proto. Red once anything has missed its budget.
+    {
+        health::Stats hm{};
+        uint32_t miss_total = 0;
+        char* p = buf;
+        const char* names[3] = {"m", "r", "p"};
+        const health::Task tasks[3] = {health::Task::MainLoop, health::Task::Render,
+                                       health::Task::ProtoRecv};
+        p += snprintf(p, sizeof(buf), "slo");
+        for (size_t i = 0; i < 3; ++i) {
+            uint32_t misses = 0;
+            if (health::GetStats(tasks[i], hm)) {
+                misses = hm.late_checkins + hm.work_misses;
+            }
+            miss_total += misses;
+            p += snprintf(p, static_cast<size_t>(buf + sizeof(buf) - p), " %s%lu",
+                          names[i], static_cast<unsigned long>(misses));
+        }
+        // Die temperature rides the same line: current/peak, with "!"
+        // while the panel clock is derated (see thermal.hpp).
+        thermal::Stats ts{};
+        thermal::GetStats(ts);
+        if (ts.valid) {
+            p += snprintf(p, static_cast<size_t>(buf + sizeof(buf) - p), "  %d/%dC%s",
+                          static_cast<int>(ts.celsius),
+                          static_cast<int>(ts.peak_celsius), ts.hot ? "!" : "");
+        }
+        // Queue drops ride the same line; the per-queue table (capacities,
+        // high-water marks) goes to serial with the PERF dump.
+        const uint32_t qdrops = queue_stats::TotalDrops();
+        p += snprintf(p, static_cast<size_t>(buf + sizeof(buf) - p), "  q%lu",
+                      static_cast<unsigned long>(qdrops));
+        drawCenteredText_(cx, 184, buf,
+                          (miss_total > 0 || ts.hot || qdrops > 0) ? thm().accent_red
+                                                                   : thm().text_muted, 1);
+    }
+
+    // Bottom buttons (touch): stats reset and the frame-profiler overlay.
+    canvas_->fillSmoothRoundRect(44, 196, 72, 30, 10, thm().bg_elevated);
+    canvas_->setTextColor(thm().text_secondary);
+    const int16_t rw = measureText_("RESET");
+    canvas_->setCursor(static_cast<int16_t>(80 - rw / 2), 207);
+    canvas_->print("RESET");
+    const bool perf_on = perf_overlay_ || hud_overlay_;
+    canvas_->fillSmoothRoundRect(124, 196, 72, 30, 10,
+                                 perf_on ? thm().accent_blue : thm().bg_elevated);
+    canvas_->setTextColor(perf_on ? TFT_WHITE : thm().text_secondary);
+    const int16_t pw = measureText_("PERF");
+    canvas_->setCursor(static_cast<int16_t>(160 - pw / 2), 207);
+    canvas_->print("PERF");
+
+    // Connection indicator (top-right), same as the other pages.
+    th::drawConnectionDot(240 - 18, 18, conn_status_ == ConnStatus::Connected, now_ms);
+    (void)now_ms;
+}
+
+void ui::UiController::noteRunTransition_(uint8_t prev_state, uint8_t new_state,
+                                          const fatigue_proto::StatusPayload& status,
+                                          uint32_t now_ms) noexcept
+{
+    const auto prev = static_cast<fatigue_proto::TestState>(prev_state);
+    const auto st = static_cast<fatigue_proto::TestState>(new_state);
+
+    // A run starts on the transition into Running; resuming from Paused
+    // continues the same run.
+    if (st == fatigue_proto::TestState::Running && !run_active_) {
+        run_active_ = true;
+        run_start_ms_ = now_ms;
+        timeline_events_ |= kTlEvRunStart_;
+        // Hold off coexistence work (WiFi scan slices) for the whole run.
+        espnow::NoteTestRunning(true);
+        return;
+    }
+    if (!run_active_) {
+        return;
+    }
+    const bool was_live = (prev == fatigue_proto::TestState::Running ||
+                           prev == fatigue_proto::TestState::Paused);
+    const bool ended = (st == fatigue_proto::TestState::Completed ||
+                        st == fatigue_proto::TestState::Idle ||
+                        st == fatigue_proto::TestState::Error);
+    if (!was_live || !ended) {
+        return;
+    }
+    run_active_ = false;
+    espnow::NoteTestRunning(false);
+    timeline_events_ |= kTlEvRunEnd_;
+
+    run_db::RunRecord rec{};
+    rec.start_ms = run_start_ms_;
+    rec.duration_ms = now_ms - run_start_ms_;
+    rec.cycles_done = status.cycle_number;
+    rec.cycle_target = edit_settings_.test_unit.cycle_amount;
+    rec.vmax_rpm = edit_settings_.test_unit.oscillation_vmax_rpm;
+    rec.dwell_ms = static_cast<uint16_t>(
+        std::min<uint32_t>(edit_settings_.test_unit.dwell_time_ms, 0xFFFFu));
+    uint8_t mac[6];
+    if (activeUnitMac_(mac)) {
+        rec.mac4 = mac[4];
+        rec.mac5 = mac[5];
+    }
+    rec.state = new_state;
+    rec.err_code = status.err_code;
+    rec.bounds_method = edit_settings_.test_unit.bounds_method_stallguard ? 0 : 1;
+    (void)rfid::GetCurrentBadge(rec.badge_uid, rec.badge_len);
+    if (run_db::Append(rec)) {
+        telemetry_bridge::PublishRun(rec);
+        logf_(now_ms, "Run #%lu recorded: %lu cycles in %lus",
+              static_cast<unsigned long>(rec.seq),
+              static_cast<unsigned long>(rec.cycles_done),
+              static_cast<unsigned long>(rec.duration_ms / 1000U));
+    }
+}
+
+void ui::UiController::drawHistory_(uint32_t now_ms) noexcept
+{
+    const int16_t cx = th::CENTER_X;
+
+    // Back button (matches the global top-left touch target).
+    canvas_->fillSmoothRoundRect(10, 8, 70, 30, 10, thm().bg_elevated);
+    canvas_->setTextSize(1);
+    canvas_->setTextColor(thm().text_secondary);
+    canvas_->setCursor(24, 19);
+    canvas_->print("< Back");
+
+    // Tapping the title flips between runs and the settings audit trail.
+    drawCenteredText_(cx, 18, history_show_audit_ ? "CONFIG AUDIT" : "RUN HISTORY",
+                      thm().text_primary, 2);
+
+    const size_t total = history_show_audit_ ? audit::Count() : run_db::Count();
+    char buf[48];
+    if (total == 0) {
+        drawCenteredText_(cx, 110,
+                          history_show_audit_ ? "No changes recorded"
+                                              : "No runs recorded",
+                          thm().text_muted, 1);
+    } else {
+        // One row per record, newest first; the encoder scrolls deeper.
+        constexpr int16_t kListTop = 48;
+        constexpr int16_t kRowH = 24;
+        constexpr int kVisibleRows = 6;
+        for (int row = 0; row < kVisibleRows; ++row) {
+            const size_t idx = static_cast<size_t>(history_scroll_) + row;
+            const int16_t y = static_cast<int16_t>(kListTop + row * kRowH);
+
+            if (history_show_audit_) {
+                audit::Record rec{};
+                if (idx >= total || !audit::ReadBack(idx, rec)) {
+                    break;
+                }
+                char old_buf[16];
+                char new_buf[16];
+                audit::FormatValue(rec.field, rec.old_val, old_buf, sizeof(old_buf));
+                audit::FormatValue(rec.field, rec.new_val, new_buf, sizeof(new_buf));
+
+                snprintf(buf, sizeof(buf), "#%" PRIu32 " %s %s > %s",
+                         rec.seq, audit::FieldName(rec.field), old_buf, new_buf);
+                canvas_->setTextColor(thm().text_secondary);
+                canvas_->setCursor(44, y);
+                canvas_->print(buf);
+
+                const uint32_t up_min = rec.ms / 60000U;
+                if (rec.badge_len > 0) {
+                    snprintf(buf, sizeof(buf), "+%" PRIu32 "h%02" PRIu32 "m  badge %02X%02X",
+                             up_min / 60U, up_min % 60U,
+                             rec.badge_uid[0], rec.badge_uid[1]);
+                } else {
+                    snprintf(buf, sizeof(buf), "+%" PRIu32 "h%02" PRIu32 "m  no badge",
+                             up_min / 60U, up_min % 60U);
+                }
+                canvas_->setTextColor(thm().text_muted);
+                canvas_->setCursor(44, static_cast<int16_t>(y + 10));
+                canvas_->print(buf);
+                continue;
+            }
+
+            run_db::RunRecord rec{};
+            if (idx >= total || !run_db::ReadBack(idx, rec)) {
+                break;
+            }
+
+            const auto st = static_cast<fatigue_proto::TestState>(rec.state);
+            const char* verdict = "end";
+            uint16_t color = thm().text_secondary;
+            if (st == fatigue_proto::TestState::Completed) {
+                verdict = "done";
+                color = thm().accent_green;
+            } else if (st == fatigue_proto::TestState::Error) {
+                verdict = "err";
+                color = thm().accent_red;
+            }
+
+            snprintf(buf, sizeof(buf), "#%" PRIu32 " %s %" PRIu32 "/%" PRIu32,
+                     rec.seq, verdict, rec.cycles_done, rec.cycle_target);
+            canvas_->setTextColor(color);
+            canvas_->setCursor(44, y);
+            canvas_->print(buf);
+
+            const uint32_t dur_s = rec.duration_ms / 1000U;
+            snprintf(buf, sizeof(buf), "%02X%02X  %" PRIu32 "m%02" PRIu32 "s  e%u",
+                     rec.mac4, rec.mac5, dur_s / 60U, dur_s % 60U,
+                     static_cast<unsigned>(rec.err_code));
+            canvas_->setTextColor(thm().text_muted);
+            canvas_->setCursor(44, static_cast<int16_t>(y + 10));
+            canvas_->print(buf);
+        }
+
+        snprintf(buf, sizeof(buf), "%d-%d of %u",
+                 history_scroll_ + 1,
+                 static_cast<int>(std::min<size_t>(history_scroll_ + kVisibleRows, total)),
+                 static_cast<unsigned>(total));
+        drawCenteredText_(cx, 186, buf, thm().text_muted, 1);
+    }
+
+    // Bottom button (touch): dump all records to serial as CSV.
+    canvas_->fillSmoothRoundRect(84, 196, 72, 30, 10, thm().bg_elevated);
+    canvas_->setTextColor(thm().text_secondary);
+    const int16_t dw = measureText_("DUMP");
+    canvas_->setCursor(static_cast<int16_t>(120 - dw / 2), 207);
+    canvas_->print("DUMP");
+
+    // Connection indicator (top-right), same as the other pages.
+    th::drawConnectionDot(240 - 18, 18, conn_status_ == ConnStatus::Connected, now_ms);
+}
+
+void ui::UiController::serviceTimeline_(uint32_t now_ms) noexcept
+{
+    if (timeline_last_ms_ == 0) {
+        timeline_last_ms_ = now_ms;  // first call anchors the bucket clock
+        return;
+    }
+    // A gap longer than the whole window (deep sleep, long power-off wait)
+    // would replay thousands of empty buckets; everything before the
+    // window is lost anyway, so fast-forward to its left edge.
+    const uint32_t window_ms = kTimelineBucketMs_ * static_cast<uint32_t>(kTimelineCapacity_);
+    if (now_ms - timeline_last_ms_ > window_ms) {
+        timeline_last_ms_ = now_ms - window_ms;
+    }
+    bool pushed = false;
+    while (now_ms - timeline_last_ms_ >= kTimelineBucketMs_) {
+        timeline_last_ms_ += kTimelineBucketMs_;
+        TimelineSample s{};
+        if (now_ms - timeline_last_ms_ >= kTimelineBucketMs_) {
+            // A bucket that closed while the tick was asleep (light sleep,
+            // long render) carries no data; replicating the current state
+            // backwards would invent history.
+            s.state = kTimelineNoLink_;
+            timeline_have_cycle_ = false;
+        } else if (conn_status_ == ConnStatus::Connected && have_status_) {
+            s.state = last_status_.state;
+            const uint32_t cycle = last_status_.cycle_number;
+            if (timeline_have_cycle_ && cycle >= timeline_last_cycle_) {
+                const uint32_t cpm =
+                    (cycle - timeline_last_cycle_) * 60000U / kTimelineBucketMs_;
+                s.rate_cpm = static_cast<uint16_t>(std::min<uint32_t>(cpm, 0xFFFFu));
+            }
+            timeline_last_cycle_ = cycle;
+            timeline_have_cycle_ = true;
+        } else {
+            s.state = kTimelineNoLink_;
+            timeline_have_cycle_ = false;
+        }
+        s.events = timeline_events_;
+        timeline_events_ = 0;
+        HOT_ASSERT(timeline_head_ < kTimelineCapacity_);
+        timeline_[timeline_head_] = s;
+        timeline_head_ = (timeline_head_ + 1) % kTimelineCapacity_;
+        timeline_count_ = std::min(timeline_count_ + 1, kTimelineCapacity_);
+        timelineCascade_(s);
+        pushed = true;
+    }
+    if (pushed && page_ == Page::Timeline) {
+        // Every column shifts one slot left; the cursor stays put in screen
+        // space (it now points one bucket further into the past).
+        dirty_ = true;
+    }
+}
+
+uint8_t ui::UiController::tlDominantState_(uint8_t a, uint8_t b) noexcept
 {
-    if (!quick_settings_editing_ || delta == 0) {
+    // Significance order for downsampled buckets: an error anywhere in
+    // the span must survive folding; link loss is the least interesting.
+    const auto rank = [](uint8_t st) -> int {
+        switch (static_cast<fatigue_proto::TestState>(st)) {
+            case fatigue_proto::TestState::Error:     return 5;
+            case fatigue_proto::TestState::Running:   return 4;
+            case fatigue_proto::TestState::Paused:    return 3;
+            case fatigue_proto::TestState::Completed: return 2;
+            case fatigue_proto::TestState::Idle:      return 1;
+            default:                                  return 0;  // no link
+        }
+    };
+    return rank(a) >= rank(b) ? a : b;
+}
+
+void ui::UiController::timelineCascade_(const TimelineSample& s) noexcept
+{
+    // Tier 1: fold kTlCascadeFold_ base buckets into one 30 s sample.
+    tl_acc1_.rate_sum += s.rate_cpm;
+    tl_acc1_.state = tlDominantState_(tl_acc1_.state, s.state);
+    tl_acc1_.events |= s.events;
+    if (++tl_acc1_.n < kTlCascadeFold_) {
         return;
     }
-    
-    playBeep_(delta > 0 ? 1 : 0);
-    
-    switch (quick_editor_type_) {
-        case QuickEditorType::F32: {
-            const float next = quick_editor_f32_new_ + quick_editor_f32_step_ * static_cast<float>(delta);
-            quick_editor_f32_new_ = std::max(0.1f, std::round(next * 10.0f) / 10.0f);
-            break;
-        }
-        case QuickEditorType::U32: {
-            const int64_t next = static_cast<int64_t>(quick_editor_u32_new_) + static_cast<int64_t>(delta) * static_cast<int64_t>(quick_editor_u32_step_);
-            quick_editor_u32_new_ = static_cast<uint32_t>(std::max(int64_t{0}, next));
-            break;
-        }
-        default:
-            break;
+    TimelineSample c1{};
+    c1.rate_cpm = static_cast<uint16_t>(tl_acc1_.rate_sum / kTlCascadeFold_);
+    c1.state = tl_acc1_.state;
+    c1.events = tl_acc1_.events;
+    tl_acc1_ = {};
+    tl_tier1_[tl_tier1_head_] = c1;
+    tl_tier1_head_ = (tl_tier1_head_ + 1) % kTlTier1Cap_;
+    tl_tier1_count_ = std::min(tl_tier1_count_ + 1, kTlTier1Cap_);
+
+    // Tier 2: the same fold again, 30 s -> 5 min.
+    tl_acc2_.rate_sum += c1.rate_cpm;
+    tl_acc2_.state = tlDominantState_(tl_acc2_.state, c1.state);
+    tl_acc2_.events |= c1.events;
+    if (++tl_acc2_.n < kTlCascadeFold_) {
+        return;
     }
+    TimelineSample c2{};
+    c2.rate_cpm = static_cast<uint16_t>(tl_acc2_.rate_sum / kTlCascadeFold_);
+    c2.state = tl_acc2_.state;
+    c2.events = tl_acc2_.events;
+    tl_acc2_ = {};
+    tl_tier2_[tl_tier2_head_] = c2;
+    tl_tier2_head_ = (tl_tier2_head_ + 1) % kTlTier2Cap_;
+    tl_tier2_count_ = std::min(tl_tier2_count_ + 1, kTlTier2Cap_);
 }
 
-bool ui::UiController::quickEditorHasChange_() const noexcept
+const ui::UiController::TimelineSample& ui::UiController::timelineZoomAt_(size_t back) const noexcept
 {
-    switch (quick_editor_type_) {
-        case QuickEditorType::F32:
-            return std::fabs(static_cast<double>(quick_editor_f32_new_ - quick_editor_f32_old_)) > 0.001;
-        case QuickEditorType::U32:
-            return quick_editor_u32_new_ != quick_editor_u32_old_;
+    switch (timeline_zoom_) {
+        case 1:
+            return tl_tier1_[(tl_tier1_head_ + kTlTier1Cap_ - 1 - back) % kTlTier1Cap_];
+        case 2:
+            return tl_tier2_[(tl_tier2_head_ + kTlTier2Cap_ - 1 - back) % kTlTier2Cap_];
         default:
-            return false;
+            return timelineAt_(back);
     }
 }
 
-void ui::UiController::cycleQuickSettingsStep_() noexcept
+size_t ui::UiController::timelineZoomCount_() const noexcept
 {
-    // Handle F32 types (VMAX, AMAX)
-    if (quick_editor_type_ == QuickEditorType::F32) {
-        // VMAX and AMAX both use 0.1, 1, 10 steps
-        static constexpr float kSteps[] = {0.1f, 1.0f, 10.0f};
-        static constexpr size_t kCount = sizeof(kSteps) / sizeof(kSteps[0]);
-        
-        size_t idx = 0;
-        for (size_t i = 0; i < kCount; ++i) {
-            if (std::fabs(static_cast<double>(kSteps[i] - quick_editor_f32_step_)) < 1e-6) {
-                idx = i;
-                break;
-            }
-        }
-        idx = (idx + 1) % kCount;
-        quick_editor_f32_step_ = kSteps[idx];
-    }
-    // Handle U32 types (Cycles only - Dwell is now F32)
-    else if (quick_editor_type_ == QuickEditorType::U32) {
-        if (quick_settings_index_ == 4) {
-            // Cycles: 10, 100, 1000 steps
-            static constexpr uint32_t kCycleSteps[] = {10, 100, 1000};
-            static constexpr size_t kCycleCount = sizeof(kCycleSteps) / sizeof(kCycleSteps[0]);
-            
-            size_t idx = 0;
-            for (size_t i = 0; i < kCycleCount; ++i) {
-                if (kCycleSteps[i] == quick_editor_u32_step_) {
-                    idx = i;
-                    break;
-                }
-            }
-            idx = (idx + 1) % kCycleCount;
-            quick_editor_u32_step_ = kCycleSteps[idx];
-        }
+    switch (timeline_zoom_) {
+        case 1:  return tl_tier1_count_;
+        case 2:  return tl_tier2_count_;
+        default: return timeline_count_;
     }
 }
 
-void ui::UiController::applyQuickSettingsValue_(uint32_t now_ms) noexcept
+uint32_t ui::UiController::timelineZoomBucketMs_() const noexcept
 {
-    // Apply the value to edit_settings_
-    switch (quick_settings_index_) {
-        case 1:  // VMAX
-            edit_settings_.test_unit.oscillation_vmax_rpm = std::max(5.0f, quick_editor_f32_new_);
-            break;
-        case 2:  // AMAX
-            edit_settings_.test_unit.oscillation_amax_rev_s2 = std::max(0.5f, quick_editor_f32_new_);
-            break;
-        case 3:  // Dwell (convert seconds to ms)
-            edit_settings_.test_unit.dwell_time_ms = static_cast<uint32_t>(std::max(0.0f, quick_editor_f32_new_) * 1000.0f);
-            break;
-        case 4:  // Cycles
-            edit_settings_.test_unit.cycle_amount = quick_editor_u32_new_;
-            break;
-        default:
-            return;
+    switch (timeline_zoom_) {
+        case 1:  return kTimelineBucketMs_ * kTlCascadeFold_;
+        case 2:  return kTimelineBucketMs_ * kTlCascadeFold_ * kTlCascadeFold_;
+        default: return kTimelineBucketMs_;
     }
-    
-    // Also update the main settings
-    if (settings_ != nullptr) {
-        *settings_ = edit_settings_;
-        (void)SettingsStore::Save(*settings_);
+}
+
+void ui::UiController::drawTimeline_(uint32_t now_ms) noexcept
+{
+    static_assert(kTlPlotW == static_cast<int16_t>(kTimelineCapacity_),
+                  "one timeline bucket per plot column");
+    const int16_t cx = th::CENTER_X;
+
+    // Back button (matches the global top-left touch target).
+    canvas_->fillSmoothRoundRect(10, 8, 70, 30, 10, thm().bg_elevated);
+    canvas_->setTextSize(1);
+    canvas_->setTextColor(thm().text_secondary);
+    canvas_->setCursor(24, 19);
+    canvas_->print("< Back");
+
+    drawCenteredText_(cx, 18, "TIMELINE", thm().text_primary, 2);
+
+    // Zoom badge under the title (tap the title to cycle tiers).
+    const char* zoom_label = (timeline_zoom_ == 0)   ? "3s buckets"
+                             : (timeline_zoom_ == 1) ? "30s buckets"
+                                                     : "5min buckets";
+    drawCenteredText_(cx, 36, zoom_label, thm().text_muted, 1);
+
+    const size_t total = timelineZoomCount_();
+    if (total == 0) {
+        drawCenteredText_(cx, 110, "Collecting...", thm().text_muted, 1);
+        th::drawConnectionDot(240 - 18, 18, conn_status_ == ConnStatus::Connected, now_ms);
+        return;
     }
-    
-    // Send config to unit immediately
-    if (conn_status_ == ConnStatus::Connected) {
-        const auto payload = fatigue_proto::BuildConfigPayload(edit_settings_);
-        const bool ok = espnow::SendConfigSet(fatigue_proto::DEVICE_ID_FATIGUE_TESTER_, &payload, sizeof(payload));
-        if (ok) {
-            logf_(now_ms, "TX: Quick config update sent");
-        } else {
-            logf_(now_ms, "TX: Quick config FAILED");
+
+    const int max_back = static_cast<int>(total) - 1;
+    timeline_cursor_ = std::clamp(timeline_cursor_, 0, max_back);
+    timeline_window_ = std::clamp(timeline_window_,
+                                  timeline_cursor_ - (static_cast<int>(kTlPlotW) - 1),
+                                  timeline_cursor_);
+    timeline_window_ = std::clamp(timeline_window_, 0,
+                                  std::max(0, max_back - (static_cast<int>(kTlPlotW) - 1)));
+    const size_t visible =
+        std::min(total - static_cast<size_t>(timeline_window_), static_cast<size_t>(kTlPlotW));
+
+    // Rate scale: the peak over the visible window, floored so an idle
+    // window draws a flat baseline instead of amplified noise.
+    uint16_t peak = 10;
+    for (size_t i = 0; i < visible; ++i) {
+        peak = std::max(peak, timelineZoomAt_(static_cast<size_t>(timeline_window_) + i).rate_cpm);
+    }
+
+    // Track baselines; the plot itself is drawn column by column below.
+    canvas_->drawFastHLine(kTlPlotX, kTlRateY + kTlRateH, kTlPlotW, thm().bg_elevated);
+
+    const int16_t right = static_cast<int16_t>(kTlPlotX + kTlPlotW - 1);
+    for (size_t i = 0; i < visible; ++i) {
+        const TimelineSample& s = timelineZoomAt_(static_cast<size_t>(timeline_window_) + i);
+        const int16_t x = static_cast<int16_t>(right - static_cast<int16_t>(i));
+
+        // Rate curve as a filled 1px column (reads as an area sparkline).
+        if (s.state != kTimelineNoLink_ && s.rate_cpm > 0) {
+            const int16_t h = static_cast<int16_t>(
+                std::max<int32_t>(1, static_cast<int32_t>(s.rate_cpm) * kTlRateH / peak));
+            canvas_->drawFastVLine(x, static_cast<int16_t>(kTlRateY + kTlRateH - h), h,
+                                   thm().chart_good);
+        }
+
+        // State band: one colored column per bucket.
+        uint16_t band = thm().bg_elevated;  // no link
+        switch (static_cast<fatigue_proto::TestState>(s.state)) {
+            case fatigue_proto::TestState::Idle:      band = thm().state_idle; break;
+            case fatigue_proto::TestState::Running:   band = thm().state_running; break;
+            case fatigue_proto::TestState::Paused:    band = thm().state_paused; break;
+            case fatigue_proto::TestState::Completed: band = thm().state_complete; break;
+            case fatigue_proto::TestState::Error:     band = thm().state_error; break;
+            default: break;
         }
+        canvas_->drawFastVLine(x, kTlBandY, kTlBandH, band);
+
+        // Event markers, worst first so overlaps keep the important color.
+        if (s.events != 0) {
+            uint16_t mark = thm().accent_cyan;
+            if (s.events & kTlEvError_) {
+                mark = thm().accent_red;
+            } else if (s.events & kTlEvRunEnd_) {
+                mark = thm().accent_yellow;
+            } else if (s.events & kTlEvRunStart_) {
+                mark = thm().accent_green;
+            }
+            canvas_->fillRect(static_cast<int16_t>(x - 1), kTlMarkY, 3, kTlMarkH, mark);
+        }
+    }
+
+    // Cursor line through all three tracks.
+    const int16_t cur_x = static_cast<int16_t>(right - (timeline_cursor_ - timeline_window_));
+    canvas_->drawFastVLine(cur_x, kTlCursorY, kTlCursorH, thm().text_primary);
+
+    // Readout for the bucket under the cursor.
+    const TimelineSample& cur = timelineZoomAt_(static_cast<size_t>(timeline_cursor_));
+    const uint32_t back_s =
+        static_cast<uint32_t>(timeline_cursor_) * timelineZoomBucketMs_() / 1000U;
+    char buf[48];
+    if (back_s >= 3600U) {
+        snprintf(buf, sizeof(buf), "-%luh%02lum  %u/min",
+                 static_cast<unsigned long>(back_s / 3600U),
+                 static_cast<unsigned long>((back_s % 3600U) / 60U),
+                 static_cast<unsigned>(cur.rate_cpm));
     } else {
-        logf_(now_ms, "TX: Quick config skipped (not connected)");
+        snprintf(buf, sizeof(buf), "-%lum%02lus  %u/min",
+                 static_cast<unsigned long>(back_s / 60U),
+                 static_cast<unsigned long>(back_s % 60U),
+                 static_cast<unsigned>(cur.rate_cpm));
+    }
+    drawCenteredText_(cx, kTlReadoutY + 6, buf, thm().text_secondary, 1);
+
+    uint16_t state_color = thm().text_muted;
+    const char* state_text = "NO LINK";
+    switch (static_cast<fatigue_proto::TestState>(cur.state)) {
+        case fatigue_proto::TestState::Idle:      state_color = thm().state_idle;     state_text = "IDLE"; break;
+        case fatigue_proto::TestState::Running:   state_color = thm().state_running;  state_text = "RUNNING"; break;
+        case fatigue_proto::TestState::Paused:    state_color = thm().state_paused;   state_text = "PAUSED"; break;
+        case fatigue_proto::TestState::Completed: state_color = thm().state_complete; state_text = "COMPLETE"; break;
+        case fatigue_proto::TestState::Error:     state_color = thm().state_error;    state_text = "ERROR"; break;
+        default: break;
+    }
+    drawCenteredText_(cx, kTlReadoutY + 20, state_text, state_color, 1);
+
+    if (cur.events != 0) {
+        buf[0] = '\0';
+        if (cur.events & kTlEvError_)     strlcat(buf, "ERR ", sizeof(buf));
+        if (cur.events & kTlEvReconnect_) strlcat(buf, "RECONN ", sizeof(buf));
+        if (cur.events & kTlEvRunStart_)  strlcat(buf, "START ", sizeof(buf));
+        if (cur.events & kTlEvRunEnd_)    strlcat(buf, "END ", sizeof(buf));
+        drawCenteredText_(cx, kTlReadoutY + 34, buf, thm().accent_yellow, 1);
     }
+
+    drawCenteredText_(cx, 212, "Rotate to scrub", thm().text_hint, 1);
+
+    // Connection indicator (top-right), same as the other pages.
+    th::drawConnectionDot(240 - 18, 18, conn_status_ == ConnStatus::Connected, now_ms);
 }
 
-void ui::UiController::discardQuickSettingsValue_() noexcept
+void ui::UiController::drawFleet_(uint32_t now_ms) noexcept
 {
-    // Just reset the editor values - no changes applied
-    switch (quick_editor_type_) {
-        case QuickEditorType::F32:
-            quick_editor_f32_new_ = quick_editor_f32_old_;
-            break;
-        case QuickEditorType::U32:
-            quick_editor_u32_new_ = quick_editor_u32_old_;
-            break;
-        default:
-            break;
+    const int16_t cx = th::CENTER_X;
+
+    // Back button (matches the global top-left touch target).
+    canvas_->fillSmoothRoundRect(10, 8, 70, 30, 10, thm().bg_elevated);
+    canvas_->setTextSize(1);
+    canvas_->setTextColor(thm().text_secondary);
+    canvas_->setCursor(24, 19);
+    canvas_->print("< Back");
+
+    drawCenteredText_(cx, 18, "FLEET", thm().text_primary, 2);
+
+    // Presence snapshot from the protocol layer: every unit heard this
+    // session, refreshed by the periodic discovery broadcast. At most
+    // MAX_APPROVED_PEERS rows, so the whole table always fits on screen.
+    espnow::PresenceEntry peers[kMaxUnits_];
+    const size_t n = espnow::GetPresence(peers, kMaxUnits_);
+
+    uint8_t active_mac[6] = {};
+    const bool have_active = activeUnitMac_(active_mac);
+
+    char buf[48];
+    if (n == 0) {
+        drawCenteredText_(cx, 104, "No units heard", thm().text_muted, 1);
+        drawCenteredText_(cx, 120, "discovery broadcasting...", thm().text_muted, 1);
+    } else {
+        constexpr int16_t kListTop = 56;
+        constexpr int16_t kRowH = 32;
+        for (size_t i = 0; i < n; ++i) {
+            const espnow::PresenceEntry& p = peers[i];
+            const int16_t y = static_cast<int16_t>(kListTop + static_cast<int16_t>(i) * kRowH);
+            const bool is_active = have_active && std::memcmp(p.mac, active_mac, 6) == 0;
+            // Quiet past a few discovery periods: likely powered off or
+            // out of range, so the row dims instead of disappearing.
+            const bool stale = p.age_ms > 45000U;
+
+            if (p.name[0] != '\0') {
+                snprintf(buf, sizeof(buf), "%s%s", is_active ? "> " : "", p.name);
+            } else {
+                snprintf(buf, sizeof(buf), "%sUnit %02X%02X",
+                         is_active ? "> " : "", p.mac[4], p.mac[5]);
+            }
+            canvas_->setTextColor(stale ? thm().text_muted
+                                        : (is_active ? thm().text_primary
+                                                     : thm().text_secondary));
+            canvas_->setCursor(34, y);
+            canvas_->print(buf);
+
+            snprintf(buf, sizeof(buf), "%02X:%02X:%02X:%02X:%02X:%02X",
+                     p.mac[0], p.mac[1], p.mac[2], p.mac[3], p.mac[4], p.mac[5]);
+            canvas_->setTextColor(thm().text_muted);
+            canvas_->setCursor(34, static_cast<int16_t>(y + 12));
+            canvas_->print(buf);
+
+            const uint32_t age_s = p.age_ms / 1000U;
+            if (age_s < 60) {
+                snprintf(buf, sizeof(buf), "%" PRIu32 "s", age_s);
+            } else {
+                snprintf(buf, sizeof(buf), "%" PRIu32 "m%02" PRIu32 "s",
+                         age_s / 60U, age_s % 60U);
+            }
+            canvas_->setTextColor(stale ? thm().accent_red : thm().text_muted);
+            canvas_->setCursor(164, static_cast<int16_t>(y + 12));
+            canvas_->print(buf);
+        }
+
+        snprintf(buf, sizeof(buf), "%u unit%s this session",
+                 static_cast<unsigned>(n), n == 1 ? "" : "s");
+        drawCenteredText_(cx, 196, buf, thm().text_muted, 1);
+    }
+
+    // Allowlist replication hint (see longPressFleet_).
+    drawCenteredText_(cx, 212, "hold: share pairings", thm().text_muted, 1);
+
+    // Connection indicator (top-right), same as the other pages.
+    th::drawConnectionDot(240 - 18, 18, conn_status_ == ConnStatus::Connected, now_ms);
+}
+
+void ui::UiController::drawDashboard_(uint32_t now_ms) noexcept
+{
+    const int16_t cx = th::CENTER_X;
+
+    // Back button (matches the global top-left touch target).
+    canvas_->fillSmoothRoundRect(10, 8, 70, 30, 10, thm().bg_elevated);
+    canvas_->setTextSize(1);
+    canvas_->setTextColor(thm().text_secondary);
+    canvas_->setCursor(24, 19);
+    canvas_->print("< Back");
+
+    drawCenteredText_(cx, 18, "UNITS", thm().text_primary, 2);
+
+    if (unit_count_ == 0) {
+        drawCenteredText_(cx, 104, "No units in the fleet", thm().text_muted, 1);
+        drawCenteredText_(cx, 120, "pair a tester to begin", thm().text_muted, 1);
+        th::drawConnectionDot(240 - 18, 18, conn_status_ == ConnStatus::Connected, now_ms);
+        return;
+    }
+
+    // One tile per fleet slot. Partial frames arrive clipped to the dirty
+    // union serviceDashboard_ marked, so drawing every tile here only
+    // touches the pixels of the tiles that actually changed.
+    char buf[32];
+    for (size_t i = 0; i < kMaxUnits_; ++i) {
+        const Rect r = dashTileRect_(i);
+        if (i >= unit_count_) {
+            // Empty slot: dim outline so the grid still reads as four bays.
+            canvas_->drawRoundRect(r.x, r.y, r.w, r.h, 10, thm().bg_card);
+            continue;
+        }
+
+        const bool active = static_cast<int>(i) == active_unit_;
+        const bool focused = static_cast<int>(i) == dash_focus_;
+        const ConnStatus conn = active ? conn_status_ : units_[i].conn;
+        const bool have = active ? have_status_ : units_[i].have_status;
+        const fatigue_proto::StatusPayload& st = active ? last_status_ : units_[i].status;
+        const bool linked = conn == ConnStatus::Connected;
+
+        canvas_->fillSmoothRoundRect(r.x, r.y, r.w, r.h, 10, thm().bg_card);
+        if (focused) {
+            canvas_->drawRoundRect(r.x, r.y, r.w, r.h, 10, thm().text_primary);
+            canvas_->drawRoundRect(static_cast<int16_t>(r.x + 1), static_cast<int16_t>(r.y + 1),
+                                   static_cast<int16_t>(r.w - 2), static_cast<int16_t>(r.h - 2),
+                                   9, thm().text_primary);
+        }
+
+        // Identity: peer name once heard, slot number until then. The
+        // active unit keeps the same "> " marker the Fleet page uses.
+        const char* label = espnow::PeerLabel(espnow::LookupPeerIndex(units_[i].mac));
+        if (label[0] == '\0') {
+            snprintf(buf, sizeof(buf), "Unit %u", static_cast<unsigned>(i) + 1);
+            label = buf;
+        }
+        canvas_->setTextSize(1);
+        canvas_->setTextColor(linked ? thm().text_primary : thm().text_muted);
+        canvas_->setCursor(static_cast<int16_t>(r.x + 8), static_cast<int16_t>(r.y + 7));
+        canvas_->printf("%s%.11s", active ? "> " : "", label);
+
+        // Link dot, tile-local (static, unlike the animated page dot).
+        canvas_->fillSmoothCircle(static_cast<int16_t>(r.x + r.w - 12),
+                                  static_cast<int16_t>(r.y + 11), 3,
+                                  linked ? thm().accent_green : thm().text_muted);
+
+        uint16_t state_color = thm().text_muted;
+        const char* state_text = "NO LINK";
+        if (linked) {
+            state_color = thm().state_idle;
+            state_text = have ? "IDLE" : "...";
+            if (have) {
+                switch (static_cast<fatigue_proto::TestState>(st.state)) {
+                    case fatigue_proto::TestState::Running:   state_color = thm().state_running;  state_text = "RUNNING"; break;
+                    case fatigue_proto::TestState::Paused:    state_color = thm().state_paused;   state_text = "PAUSED"; break;
+                    case fatigue_proto::TestState::Completed: state_color = thm().state_complete; state_text = "DONE"; break;
+                    case fatigue_proto::TestState::Error:     state_color = thm().state_error;    state_text = "ERROR"; break;
+                    default: break;
+                }
+            }
+        }
+        canvas_->setTextColor(state_color);
+        canvas_->setCursor(static_cast<int16_t>(r.x + 8), static_cast<int16_t>(r.y + 20));
+        canvas_->print(state_text);
+
+        if (have) {
+            canvas_->setTextSize(2);
+            canvas_->setTextColor(linked ? thm().text_primary : thm().text_muted);
+            canvas_->setCursor(static_cast<int16_t>(r.x + 8), static_cast<int16_t>(r.y + 32));
+            canvas_->printf("%lu", static_cast<unsigned long>(st.cycle_number));
+            canvas_->setTextSize(1);
+
+            if (st.err_code != 0) {
+                canvas_->setTextColor(thm().state_error);
+                canvas_->setCursor(static_cast<int16_t>(r.x + 8), static_cast<int16_t>(r.y + 50));
+                canvas_->printf("err %u", static_cast<unsigned>(st.err_code));
+            }
+        }
+
+        // Progress toward the configured target; only known for the
+        // active unit (background units are not config-polled).
+        if (active && have && have_remote_config_ && last_remote_config_.cycle_amount > 0) {
+            const float prog = std::min(
+                1.0f, static_cast<float>(st.cycle_number) /
+                          static_cast<float>(last_remote_config_.cycle_amount));
+            const int16_t bw = static_cast<int16_t>(r.w - 16);
+            canvas_->fillRect(static_cast<int16_t>(r.x + 8), static_cast<int16_t>(r.y + 62),
+                              bw, 4, thm().bg_elevated);
+            canvas_->fillRect(static_cast<int16_t>(r.x + 8), static_cast<int16_t>(r.y + 62),
+                              static_cast<int16_t>(static_cast<float>(bw) * prog), 4,
+                              thm().state_running);
+        }
     }
+
+    drawCenteredText_(cx, 206, "rotate: focus  click: open", thm().text_hint, 1);
 }
 
 void ui::UiController::drawTerminal_(uint32_t now_ms) noexcept
 {
     const int16_t cx = 240 / 2;
     const int16_t cy = 240 / 2;
-    
-    // Circular frame for round screen
-    canvas_->drawCircle(cx, cy, 118, 0x2104);
-    
-    // Header - centered title
-    canvas_->setTextSize(2);
-    canvas_->setTextColor(TFT_WHITE);
-    const char* title = "Log";
-    const int16_t tw = static_cast<int16_t>(canvas_->textWidth(title));
-    canvas_->setCursor(cx - tw / 2, 8);
-    canvas_->print(title);
-    
-    // Connection indicator in top-right area
-    drawConnectionIndicator_(now_ms);
-    
-    // Back button hint (small, top-left)
-    canvas_->setTextSize(1);
-    canvas_->setTextColor(0x6B9F);
-    canvas_->setCursor(12, 12);
-    canvas_->print("<");
-    
+
     // Log area - centered, respecting round edges
-    // Use narrower width in middle, wider at center-height
     const int16_t log_top = 38;
     const int16_t log_bottom = 240 - 28;
     const int16_t line_h = 14;
     const int max_lines = (log_bottom - log_top) / line_h;
-    
-    // Scroll indicator (left edge, circular-bound style + springy ends)
-    if (log_count_ > static_cast<size_t>(max_lines)) {
-        const int max_scroll = std::max(0, static_cast<int>(log_count_) - max_lines);
-        const float scroll_pos = (max_scroll > 0)
-            ? (1.0f - static_cast<float>(scroll_lines_) / static_cast<float>(max_scroll))
-            : 1.0f;
 
-        const int16_t arc_top = static_cast<int16_t>(log_top + 8);
-        const int16_t arc_bottom = static_cast<int16_t>(log_bottom - 8);
+    // Incremental mode: the canvas still holds the previous terminal frame
+    // (renderFrame_ skips the clear for us), so only rows whose content
+    // changed - plus the moving chrome - get erased and repainted.
+    const bool incremental = term_cache_valid_;
+    cacheNote_(CacheId::Terminal, incremental);
 
-        int16_t dot_y = static_cast<int16_t>(arc_top + scroll_pos * static_cast<float>(arc_bottom - arc_top));
-        dot_y = std::clamp(dot_y, arc_top, arc_bottom);
-
-        const float r = 110.0f;
-        const float cy_arc = 120.0f;
-        const float dy = static_cast<float>(dot_y) - cy_arc;
-        const float dx = std::sqrt(std::max(0.0f, r * r - dy * dy));
-        const int16_t dot_x = 120 - static_cast<int16_t>(dx);
-
-        // Dot
-        canvas_->fillSmoothCircle(dot_x, dot_y, 4, colors::accent_blue);
-
-        // End markers
-        const float dy_top = static_cast<float>(arc_top) - cy_arc;
-        const float dx_top = std::sqrt(std::max(0.0f, r * r - dy_top * dy_top));
-        const int16_t x_top = 120 - static_cast<int16_t>(dx_top);
-        const float dy_bot = static_cast<float>(arc_bottom) - cy_arc;
-        const float dx_bot = std::sqrt(std::max(0.0f, r * r - dy_bot * dy_bot));
-        const int16_t x_bot = 120 - static_cast<int16_t>(dx_bot);
-        canvas_->fillCircle(x_top, arc_top, 1, colors::text_hint);
-        canvas_->fillCircle(x_bot, arc_bottom, 1, colors::text_hint);
-
-        // Springy end feedback
-        if (terminal_overscroll_px_ != 0.0f) {
-            const bool at_bottom = terminal_overscroll_px_ > 0.0f;
-            const int16_t spring_y = at_bottom ? arc_bottom : arc_top;
-            const float dy_s = static_cast<float>(spring_y) - cy_arc;
-            const float dx_s = std::sqrt(std::max(0.0f, r * r - dy_s * dy_s));
-            const int16_t spring_x = 120 - static_cast<int16_t>(dx_s);
-
-            const float amp = std::min(10.0f, std::fabs(terminal_overscroll_px_));
-            const int16_t rr = static_cast<int16_t>(4 + (amp * 0.25f));
-            canvas_->drawCircle(spring_x, spring_y, rr + 2, colors::accent_blue);
+    if (!incremental) {
+        for (int i = 0; i < kTermMaxRows_; ++i) {
+            term_row_hash_[i] = kTermRowInvalid_;
         }
+        term_prev_dot_y_ = -1;
+        term_prev_spring_y_ = -1;
+        term_prev_spring_r_ = 0;
+        term_prev_count_ = static_cast<size_t>(-1);
 
-        // Decay overscroll spring
-        terminal_overscroll_px_ *= 0.72f;
-        if (std::fabs(terminal_overscroll_px_) < 0.25f) {
-            terminal_overscroll_px_ = 0.0f;
+        // Static chrome: circular frame, centered title, back hint.
+        canvas_->drawCircle(cx, cy, 118, thm().bg_card);
+        canvas_->setTextSize(2);
+        canvas_->setTextColor(TFT_WHITE);
+        const char* title = "Log";
+        const int16_t tw = measureText_(title);
+        canvas_->setCursor(cx - tw / 2, 8);
+        canvas_->print(title);
+        canvas_->setTextSize(1);
+        canvas_->setTextColor(thm().terminal_hint);
+        canvas_->setCursor(12, 12);
+        canvas_->print("<");
+    }
+
+    // Connection indicator overdraws itself completely; no erase needed.
+    drawConnectionIndicator_(now_ms);
+
+    // Force rows under an erased chrome region to repaint this frame.
+    auto invalidateRows = [&](int16_t ry, int16_t rh) {
+        for (int i = 0; i < max_lines && i < kTermMaxRows_; ++i) {
+            const int16_t y = static_cast<int16_t>(log_bottom - line_h - i * line_h);
+            if (ry < (y + line_h) && (ry + rh) > y) {
+                term_row_hash_[i] = kTermRowInvalid_;
+            }
         }
+    };
+
+    // x of the left scroll arc (radius 110) at a given y.
+    auto arcXAt = [](int16_t y) {
+        const float dy = static_cast<float>(y) - 120.0f;
+        const float dx = std::sqrt(std::max(0.0f, 110.0f * 110.0f - dy * dy));
+        return static_cast<int16_t>(120 - static_cast<int16_t>(dx));
+    };
+
+    // Scroll indicator state (left edge, circular-bound style + springy ends);
+    // drawn after the rows so it sits on top, erased before they repaint.
+    const int16_t arc_top = static_cast<int16_t>(log_top + 8);
+    const int16_t arc_bottom = static_cast<int16_t>(log_bottom - 8);
+    const size_t history = terminalHistoryCount_();
+    const uint32_t undrained = log_generation_ - session_log_drained_gen_;
+    const bool have_scrollbar = history > static_cast<size_t>(max_lines);
+    int16_t dot_y = -1;
+    if (have_scrollbar) {
+        const int max_scroll = std::max(0, static_cast<int>(history) - max_lines);
+        const float scroll_pos = (max_scroll > 0)
+            ? (1.0f - static_cast<float>(scroll_lines_) / static_cast<float>(max_scroll))
+            : 1.0f;
+        dot_y = static_cast<int16_t>(arc_top + scroll_pos * static_cast<float>(arc_bottom - arc_top));
+        dot_y = std::clamp(dot_y, arc_top, arc_bottom);
     } else {
         terminal_overscroll_px_ = 0.0f;
     }
 
-    // Render log lines - adjust width per line to fit in circle
-    int start_from_newest = scroll_lines_;
-    int printed = 0;
+    int16_t spring_y = -1;
+    int16_t spring_r = 0;
+    if (have_scrollbar && terminal_overscroll_px_ != 0.0f) {
+        spring_y = (terminal_overscroll_px_ > 0.0f) ? arc_bottom : arc_top;
+        const float amp = std::min(10.0f, std::fabs(terminal_overscroll_px_));
+        spring_r = static_cast<int16_t>(static_cast<int16_t>(4 + (amp * 0.25f)) + 2);
+    }
+
+    // Erase chrome that moved or disappeared since the previous frame.
+    if (incremental) {
+        if (term_prev_dot_y_ >= 0 && term_prev_dot_y_ != dot_y) {
+            const int16_t px = arcXAt(term_prev_dot_y_);
+            canvas_->fillRect(static_cast<int16_t>(px - 5), static_cast<int16_t>(term_prev_dot_y_ - 5),
+                              11, 11, TFT_BLACK);
+            invalidateRows(static_cast<int16_t>(term_prev_dot_y_ - 5), 11);
+        }
+        if (term_prev_spring_y_ >= 0 &&
+            (term_prev_spring_y_ != spring_y || term_prev_spring_r_ != spring_r)) {
+            const int16_t px = arcXAt(term_prev_spring_y_);
+            const int16_t pr = static_cast<int16_t>(term_prev_spring_r_ + 1);
+            canvas_->fillRect(static_cast<int16_t>(px - pr), static_cast<int16_t>(term_prev_spring_y_ - pr),
+                              static_cast<int16_t>(2 * pr + 1), static_cast<int16_t>(2 * pr + 1), TFT_BLACK);
+            invalidateRows(static_cast<int16_t>(term_prev_spring_y_ - pr), static_cast<int16_t>(2 * pr + 1));
+        }
+    }
 
+    // Render log rows - redraw only rows whose content hash changed.
     canvas_->setTextSize(1);
-    
-    for (int i = 0; i < max_lines; ++i) {
-        const int idx_from_newest = start_from_newest + i;
-        if (idx_from_newest >= static_cast<int>(log_count_)) {
-            break;
+    for (int i = 0; i < max_lines && i < kTermMaxRows_; ++i) {
+        const int16_t y = static_cast<int16_t>(log_bottom - line_h - i * line_h);
+        const int idx_from_newest = scroll_lines_ + i;
+
+        const LogRecord* rec = nullptr;
+        char flash_text[96];
+        bool from_flash = false;
+        uint32_t hash = kTermRowEmpty_;
+        if (idx_from_newest < static_cast<int>(log_count_)) {
+            const size_t newest_index = (log_head_ + LOG_CAPACITY_ - 1) % LOG_CAPACITY_;
+            const size_t index = (newest_index + LOG_CAPACITY_ - static_cast<size_t>(idx_from_newest)) % LOG_CAPACITY_;
+            HOT_ASSERT(index < LOG_CAPACITY_);
+            rec = &log_[index];
+
+            // FNV-1a over the record identity (format pointer + raw args);
+            // unchanged rows are skipped without ever being formatted.
+            hash = 2166136261u;
+            auto mix = [&hash](uint32_t v) {
+                for (int b = 0; b < 4; ++b) {
+                    hash = (hash ^ ((v >> (8 * b)) & 0xFFu)) * 16777619u;
+                }
+            };
+            mix(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(rec->fmt)));
+            for (uint8_t a = 0; a < rec->argc; ++a) {
+                mix(rec->args[a]);
+            }
+            if (hash == kTermRowEmpty_ || hash == kTermRowInvalid_) {
+                hash ^= 0x5bd1e995u;  // keep real content clear of the sentinels
+            }
+        } else if (idx_from_newest < static_cast<int>(history)) {
+            // Scrolled past the RAM ring: pull the line from flash history.
+            // The newest flash records duplicate already-drained RAM lines,
+            // so the flash index is offset by the undrained overhang only.
+            uint32_t flash_ms = 0;
+            if (session_log::ReadBack(static_cast<size_t>(idx_from_newest) - undrained,
+                                      flash_ms, flash_text, sizeof(flash_text))) {
+                from_flash = true;
+                hash = 2166136261u;
+                for (const char* p = flash_text; *p != '\0'; ++p) {
+                    hash = (hash ^ static_cast<uint8_t>(*p)) * 16777619u;
+                }
+                if (hash == kTermRowEmpty_ || hash == kTermRowInvalid_) {
+                    hash ^= 0x5bd1e995u;
+                }
+            }
+        }
+
+        if (incremental && term_row_hash_[i] == hash) {
+            continue;  // unchanged: retained pixels stay as-is
+        }
+        term_row_hash_[i] = hash;
+
+        // Erase the row band inside the frame ring (chord at radius 116 so
+        // the ring at 118 is preserved).
+        {
+            const float dy_far = std::max(std::fabs(static_cast<float>(y - cy)),
+                                          std::fabs(static_cast<float>(y + line_h - cy)));
+            const float chord = std::sqrt(std::max(0.0f, 116.0f * 116.0f - dy_far * dy_far));
+            canvas_->fillRect(static_cast<int16_t>(cx - chord), y,
+                              static_cast<int16_t>(2.0f * chord), line_h, TFT_BLACK);
+        }
+
+        if (rec == nullptr && !from_flash) {
+            continue;
+        }
+
+        // This row actually changed - expand the record into frame-arena
+        // scratch (stack fallback if a busy frame exhausted it).
+        constexpr size_t kRowTextCap = 96;
+        char fallback[kRowTextCap];
+        char* text = static_cast<char*>(frame_arena_.alloc(kRowTextCap));
+        if (text == nullptr) {
+            text = fallback;
+        }
+        if (from_flash) {
+            snprintf(text, kRowTextCap, "%s", flash_text);
+        } else {
+            formatLogRecord_(*rec, text, kRowTextCap);
         }
-        const size_t newest_index = (log_head_ + LOG_CAPACITY_ - 1) % LOG_CAPACITY_;
-        const size_t index = (newest_index + LOG_CAPACITY_ - static_cast<size_t>(idx_from_newest)) % LOG_CAPACITY_;
-        const auto& line = log_[index];
 
-        const int16_t y = static_cast<int16_t>(log_bottom - line_h - (printed * line_h));
-        
         // Calculate available width at this Y position (circular bounds)
         const float dy = static_cast<float>(y + line_h/2 - cy);
         const float max_radius = 115.0f;
         float half_width = std::sqrt(std::max(0.0f, max_radius * max_radius - dy * dy));
         const int16_t available_width = static_cast<int16_t>(half_width * 2.0f) - 24;  // margin
         const int16_t start_x = cx - static_cast<int16_t>(half_width) + 12;
-        
+
         // Color-code log lines
-        uint16_t text_color = 0xAD55;  // Default: light gray
-        if (strstr(line.text, "TX:") != nullptr) {
-            text_color = 0x6B9F;  // Blue for TX
-        } else if (strstr(line.text, "RX:") != nullptr) {
-            text_color = 0x07E0;  // Green for RX
-        } else if (strstr(line.text, "Error") != nullptr || strstr(line.text, "ERR") != nullptr) {
-            text_color = 0xFB20;  // Orange for errors
-        } else if (strstr(line.text, "Connected") != nullptr) {
-            text_color = 0x07FF;  // Cyan for connection
+        uint16_t text_color = thm().log_text;
+        if (strstr(text, "TX:") != nullptr) {
+            text_color = thm().log_tx;
+        } else if (strstr(text, "RX:") != nullptr) {
+            text_color = thm().log_rx;
+        } else if (strstr(text, "Error") != nullptr || strstr(text, "ERR") != nullptr) {
+            text_color = thm().log_err;
+        } else if (strstr(text, "Connected") != nullptr) {
+            text_color = thm().log_conn;
         }
-        
+
         canvas_->setCursor(start_x, y);
         canvas_->setTextColor(text_color);
-        
+
         // Truncate message to fit available width
         const int max_chars = available_width / 6;  // approx 6px per char at size 1
         char msg_buf[80];
-        snprintf(msg_buf, std::min(static_cast<size_t>(max_chars), sizeof(msg_buf)), "%s", line.text);
+        snprintf(msg_buf, std::min(static_cast<size_t>(max_chars), sizeof(msg_buf)), "%s", text);
         canvas_->print(msg_buf);
-        
-        printed++;
     }
-    
-    // Bottom status - show entry count
-    canvas_->setTextColor(0x4208);
-    canvas_->setTextSize(1);
-    char count_buf[20];
-    snprintf(count_buf, sizeof(count_buf), "%zu entries", log_count_);
-    const int16_t ctw = static_cast<int16_t>(canvas_->textWidth(count_buf));
-    canvas_->setCursor(cx - ctw / 2, 240 - 18);
-    canvas_->print(count_buf);
+
+    // Scroll indicator chrome on top of the rows.
+    if (have_scrollbar) {
+        canvas_->fillSmoothCircle(arcXAt(dot_y), dot_y, 4, thm().accent_blue);
+        canvas_->fillCircle(arcXAt(arc_top), arc_top, 1, thm().text_hint);
+        canvas_->fillCircle(arcXAt(arc_bottom), arc_bottom, 1, thm().text_hint);
+        if (spring_y >= 0) {
+            canvas_->drawCircle(arcXAt(spring_y), spring_y, spring_r, thm().accent_blue);
+        }
+
+        // Decay overscroll spring
+        terminal_overscroll_px_ *= 0.72f;
+        if (std::fabs(terminal_overscroll_px_) < 0.25f) {
+            terminal_overscroll_px_ = 0.0f;
+        }
+    }
+    term_prev_dot_y_ = dot_y;
+    term_prev_spring_y_ = spring_y;
+    term_prev_spring_r_ = spring_r;
+
+    // Bottom status - show entry count (only when it changed)
+    if (!incremental || term_prev_count_ != history) {
+        term_prev_count_ = history;
+        char count_buf[20];
+        snprintf(count_buf, sizeof(count_buf), "%zu entries", history);
+        canvas_->setTextColor(thm().text_watermark);
+        canvas_->setTextSize(1);
+        const int16_t ctw = measureText_(count_buf);
+        canvas_->fillRect(static_cast<int16_t>(cx - 60), 240 - 18, 120, 10, TFT_BLACK);
+        canvas_->setCursor(cx - ctw / 2, 240 - 18);
+        canvas_->print(count_buf);
+    }
+
+    term_cache_valid_ = true;
 }
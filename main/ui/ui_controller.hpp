@@ -10,6 +10,8 @@
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
 
 #include "settings.hpp"
 
@@ -22,12 +24,20 @@
 
 #include "ui/assets/menu_icons.hpp"
 #include "ui/assets/circular_icons.hpp"
+#include "ui/assets/ui_font_metrics.hpp"
 #include "ui/ui_theme.hpp"
 #include "smooth_menu.hpp"
+#include "dirty_rect.hpp"
+#include "cycle_history.hpp"
+#include "cycle_estimator.hpp"
+#include "draw_list.hpp"
+#include "frame_arena.hpp"
 
 #include <M5GFX.h>
 #include <lgfx/v1/LGFX_Sprite.hpp>
 
+#include <atomic>
+#include <cstdarg>
 #include <cstddef>
 #include <cstdint>
 
@@ -58,8 +68,10 @@ public:
     void Init() noexcept;
     
     /**
-     * @brief Main UI tick function
-     * @details Call this regularly (~60 FPS) to update UI and handle input
+     * @brief Main UI tick function (core 0)
+     * @details Call this regularly to handle input and protocol events.
+     *          Rendering runs separately on the pinned render task, so a slow
+     *          frame never delays input-to-ACK latency.
      */
     void Tick() noexcept;
 
@@ -70,6 +82,11 @@ private:
         Bounds,
         LiveCounter,
         Terminal,
+        Diagnostics,
+        History,
+        Timeline,
+        Fleet,
+        Dashboard,
         Count
     };
 
@@ -83,17 +100,51 @@ private:
         }
     };
 
-    struct LogLine {
+    // Compact log record: format-string pointer plus raw captured arguments.
+    // Every logf_ format (and every %s argument) is a string literal in
+    // flash, so storing pointers is safe; formatting happens lazily in
+    // drawTerminal_ and only for the rows actually displayed.
+    static constexpr uint8_t kLogMaxArgs_ = 5;
+
+    // Log severity, carried per record so each sink can filter on its own
+    // threshold. logf_ records Info; alert paths use logfAt_.
+    enum class LogLevel : uint8_t { Info = 0, Warn, Error };
+
+    struct LogRecord {
+        const char* fmt;
         uint32_t ms;
-        char text[96];
+        uint32_t args[kLogMaxArgs_];
+        uint8_t argc;
+        uint8_t level;  ///< LogLevel (fits the record's existing padding)
+    };
+
+    // Format interning: the conversion-spec walk over the format string
+    // runs once per distinct format, not once per call. Every logf_ format
+    // is a flash literal, so its address is a ready-made stable id — the
+    // first call parses the spec layout into this table and every later
+    // call is a hash hit plus argc va_arg copies, keeping a MAC-heavy
+    // connection-flap burst at a flat O(args) per record. Single-writer
+    // (all logging happens on the UI task); if the table ever fills, new
+    // formats just parse per call as before.
+    enum class LogArgKind : uint8_t { Int = 0, Long, Float, Ptr };
+    struct LogFmtSpec {
+        const char* fmt = nullptr;  ///< Interned format literal (table key)
+        uint8_t argc = 0;           ///< Captured argument count
+        uint16_t kinds = 0;         ///< 2 bits per argument (LogArgKind)
     };
+    static constexpr size_t kLogFmtTable_ = 128;  ///< Power of two, ~100 call sites
+    LogFmtSpec log_fmt_table_[kLogFmtTable_]{};
+    uint8_t log_fmt_count_ = 0;  ///< Interned formats (PERF dump)
+    static void parseLogFmt_(const char* fmt, LogFmtSpec& out) noexcept;
+    void logFmtSpecFor_(const char* fmt, LogFmtSpec& out) noexcept;
 
     // Settings menu category/layer
     enum class SettingsCategory : uint8_t {
-        Main = 0,       // Top-level: Fatigue Test, Bounds Finding, UI
+        Main = 0,       // Top-level: Fatigue Test, Bounds Finding, UI, Profiles
         FatigueTest,    // Cycles, VMAX/AMAX, Dwell
         BoundsFinding,  // Mode, Search Speed, SG Min Vel, Stall Factor, Search Accel
-        UI              // Brightness
+        UI,             // Brightness
+        Profiles        // Named fixture setups (recall / save slots)
     };
 
     // Connection status
@@ -106,25 +157,614 @@ private:
     QueueHandle_t proto_events_;
     Settings* settings_;
 
-    // Input
-    EC11Encoder encoder_;
-    int32_t encoder_pos_ = 0;
-
-    // UI state
+    // ---- Hot per-frame state (declared first on purpose) ----------------
+    // The Tick loop (core 0) and the render loop (core 1) touch this
+    // handful of fields on every pass, while the rest of the object has
+    // grown into several KB of mostly episodic state. Front-loading the
+    // hot set keeps each of these accesses inside Xtensa's
+    // single-instruction offset range (l8ui/s8i reach the first 256 bytes
+    // of the object, l32i/s32i the first KB — fields past that need an
+    // extra address add per access) and packs the per-frame working set
+    // into a couple of 32-byte lines instead of scattering it across the
+    // object. Keep this block small and strictly per-frame; episodic
+    // state stays grouped by topic below.
     Page page_ = Page::Landing;
+    /// Page whose pixels the canvas and the panel both hold; Page::Count
+    /// while they diverge (boot, prefetched canvas), which disarms slides.
+    Page shown_page_ = Page::Count;
     bool dirty_ = true;
+    /// Whether the current renderFrame_ pass repaints the whole canvas
+    /// (page draws use it to pick full vs incremental primitives).
+    bool frame_full_ = true;
+    bool anim_low_color_ = false;       ///< Animation burst is rendering at RGB332
+    uint8_t anim_strain_ = 0;           ///< Consecutive-ish over-budget animation frames
+    ConnStatus conn_status_ = ConnStatus::Disconnected;
+    // Flush band captured while the mutex is held, consumed off-lock.
+    bool flush_full_ = true;
+    int16_t flush_y_ = 0;
+    int16_t flush_h_ = 0;
+    int32_t encoder_pos_ = 0;
     uint32_t last_render_ms_ = 0;
+    uint32_t frame_now_ms_ = 0;  ///< now_ms of the in-flight renderFrame_ pass
+    uint32_t last_input_ms_ = 0;
+    uint32_t perf_last_us_ = 0;  ///< Render time of the most recent frame
+    // ---------------------------------------------------------------------
+
+    // Render task (core 1). UI state is mutated on core 0 under ui_mutex_;
+    // the render task snapshots into the canvas sprite while holding the
+    // mutex, then performs the slow SPI flush with the mutex released so
+    // input/protocol handling is never blocked on panel I/O.
+    SemaphoreHandle_t ui_mutex_ = nullptr;
+    TaskHandle_t render_task_ = nullptr;
+    static constexpr BaseType_t kRenderTaskCore_ = 1;
+    static constexpr uint32_t kRenderTaskStack_ = 6144;
+    static constexpr UBaseType_t kRenderTaskPrio_ = 4;
+
+    // Thermal derate state (render task only): whether the write clock is
+    // currently stepped down, and the proven level to restore afterwards.
+    bool display_derated_ = false;
+    uint32_t derate_saved_hz_ = 0;
+
+    // Frame-time profiler: scoped cycle-counter probes around each draw
+    // helper fold into per-helper and per-page stats. Cheap enough to stay
+    // compiled in; surfaced via the Diagnostics PERF overlay and dumped to
+    // the serial log whenever the overlay is toggled.
+    struct PerfHelperStats {
+        uint64_t cycles = 0;      ///< Accumulated cycles across calls
+        uint32_t calls = 0;       ///< Probe activations
+        uint32_t max_cycles = 0;  ///< Worst single call
+    };
+    struct PerfPageStats {
+        uint64_t sum_us = 0;      ///< Total render time on this page
+        uint32_t frames = 0;      ///< Frames rendered on this page
+        uint32_t min_us = 0;      ///< Fastest frame (0 until first sample)
+        uint32_t max_us = 0;      ///< Slowest frame
+    };
+    enum class PerfHelper : uint8_t {
+        Landing = 0, Settings, Bounds, Live, Terminal, Diagnostics, History, Timeline, Fleet, Dashboard, Flush, Count
+    };
+    /// RAII cycle probe; construct with the helper's accumulator in scope.
+    class PerfProbe {
+    public:
+        explicit PerfProbe(PerfHelperStats& stats) noexcept;
+        ~PerfProbe() noexcept;
+    private:
+        PerfHelperStats& stats_;
+        uint32_t start_cycles_;
+    };
+    PerfPageStats perf_pages_[static_cast<size_t>(Page::Count)]{};
+    PerfHelperStats perf_helpers_[static_cast<size_t>(PerfHelper::Count)]{};
+    bool perf_overlay_ = false;   ///< Overlay strip drawn on every frame
+    uint32_t perf_deadline_misses_ = 0;  ///< Frames over kFrameBudget_us_
+    void perfRecordFrame_(Page page, uint32_t frame_us) noexcept;
+    void perfReset_() noexcept;
+    void perfDump_() const noexcept;
+    void drawPerfOverlay_() noexcept;
+    static const char* perfHelperName_(PerfHelper h) noexcept;
+
+    // Micro HUD: a 30x12 corner readout (instantaneous FPS, last-frame
+    // cost in ms, deadline-miss count) cheap enough to leave on through a
+    // whole tuning session. The readout is retained as a pre-rendered
+    // sprite and re-rendered only when a displayed value changes; the
+    // per-frame cost is three compares and a 360-pixel blit, so observing
+    // the frame rate does not move it. Cycled with the strip from the
+    // Diagnostics PERF button (off -> hud -> strip).
+    static constexpr int16_t kHudW_ = 30;
+    static constexpr int16_t kHudH_ = 12;
+    static constexpr int16_t kHudX_ = 105;  ///< Centered in the visible top band
+    static constexpr int16_t kHudY_ = 6;
+    bool hud_overlay_ = false;
+    bool hud_repaint_ = false;           ///< Sprite changed this frame (widen flush)
+    LGFX_Sprite* hud_sprite_ = nullptr;
+    uint32_t hud_prev_frame_ms_ = 0;     ///< Previous frame's now_ms (FPS delta)
+    uint32_t hud_shown_fps_ = ~0U;       ///< Values currently baked into the sprite
+    uint32_t hud_shown_ms_ = ~0U;
+    uint32_t hud_shown_drops_ = ~0U;
+    void drawHudOverlay_(uint32_t now_ms) noexcept;
+    void freeHudSprite_() noexcept;
+
+    // Input-to-photon latency probe (Diagnostics long-press). Core 0 stamps
+    // the oldest unconsumed encoder detent; core 1 closes the measurement
+    // after the frame that consumed it has fully drained to the panel.
+    // Cross-core, so timestamps come from the shared esp_timer clock (the
+    // per-core cycle counters are not synchronized between cores), truncated
+    // to 32 bits so the shared slot stays a single word-sized write. The
+    // optional GPIO mirrors the stamp/drain window for oscilloscope
+    // measurement against a photodiode on the panel.
+    static constexpr gpio_num_t kLatencyProbeGpio_ = GPIO_NUM_NC;
+    static constexpr size_t kLatencyBuckets_ = 8;  ///< log2 ms: <4 ... >=256
+    bool latency_probe_ = false;
+    volatile uint32_t latency_input_us_ = 0;  ///< Oldest pending detent, 0=none
+    uint32_t latency_frame_input_us_ = 0;     ///< Stamp the in-flight frame covers
+    uint32_t latency_hist_[kLatencyBuckets_]{};
+    uint32_t latency_count_ = 0;
+    uint64_t latency_sum_us_ = 0;
+    uint32_t latency_last_us_ = 0;
+    uint32_t latency_max_us_ = 0;
+    void latencyNoteInput_() noexcept;
+    void latencyFrameStart_() noexcept;
+    void latencyFrameFlushed_() noexcept;
+    void latencyReset_() noexcept;
+
+    // Render A/B harness (Diagnostics title tap). One run replays a
+    // synthesized workload script twice through the input-trace replay
+    // engine - pass A as shipped, pass B with the subject optimization
+    // forced off - and folds each pass's frame times into its own
+    // distribution, so "does this optimization pay on this panel batch"
+    // is one tap and one histogram. Subjects cycle per run; the disable
+    // mask is honored at each optimization's own decision point
+    // (renderFrame_ for partial frames, flushFrame_ for the differential
+    // push, the animation governor for the RGB332 drop).
+    enum class AbSubject : uint8_t { Partial = 0, DiffPush, LowColor, Count };
+    static constexpr size_t kAbBuckets_ = 8;  ///< log2 ms: <1 ... >=64
+    struct AbPassStats {
+        uint32_t frames = 0;
+        uint64_t sum_us = 0;       ///< Render time total
+        uint32_t max_us = 0;
+        uint64_t flush_us = 0;     ///< Flush time total (from the Flush probe)
+        uint32_t hist[kAbBuckets_]{};
+    };
+    uint8_t ab_phase_ = 0;             ///< 0 idle, 1 = pass A, 2 = pass B
+    AbSubject ab_subject_ = AbSubject::Partial;   ///< Next run's subject
+    AbSubject ab_result_subject_ = AbSubject::Partial;
+    uint8_t ab_disabled_mask_ = 0;     ///< AbSubject bits forced off
+    bool ab_have_results_ = false;
+    uint32_t ab_deadline_ms_ = 0;      ///< Stall guard for the replay
+    uint64_t ab_flush_base_cycles_ = 0;  ///< Flush-probe cycles at pass start
+    AbPassStats ab_pass_[2]{};
+    bool abDisabled_(AbSubject s) const noexcept
+    {
+        return ((ab_disabled_mask_ >> static_cast<uint8_t>(s)) & 1U) != 0;
+    }
+    void abStart_(uint32_t now_ms) noexcept;
+    void abBeginPass_(uint32_t now_ms) noexcept;
+    void serviceAbHarness_(uint32_t now_ms) noexcept;
+    void abDump_() const noexcept;
+    static const char* abSubjectName_(AbSubject s) noexcept;
+
+    // DMA flush engine: the flush band is copied slice-by-slice into two
+    // small DMA-capable bounce buffers and pushed with pushImageDMA, so the
+    // memcpy of slice N overlaps the SPI transfer of slice N-1 and the final
+    // slice drains while the render task already draws the next frame into
+    // the canvas. Falls back to the synchronous push if the buffers cannot
+    // be allocated.
+    static constexpr int16_t kDmaSliceRows_ = 24;
+    uint16_t* dma_bounce_[2] = { nullptr, nullptr };
+    uint8_t dma_bounce_idx_ = 0;
+    bool dma_flush_ok_ = false;
+
+    // Differential push: a 4-byte digest per scanline of the last pushed
+    // frame (the canvas is retained, so panel content == canvas content
+    // after every flush). Rows inside the flush band whose digest is
+    // unchanged are skipped and only the differing spans go out over SPI -
+    // during scroll animations most band rows repaint to identical pixels.
+    // A full previous-frame copy would want PSRAM this board doesn't have;
+    // the digest table costs 960 bytes of internal RAM instead.
+    uint32_t row_digest_[240]{};
+    bool row_digest_valid_ = false;
+    static uint32_t rowDigest_(const void* row, size_t bytes) noexcept;
+    void pushRowSpan_(int16_t y, int16_t rows) noexcept;
+
+    // Screenshot streaming (press+rotate on Diagnostics): the retained
+    // canvas goes out over the USB-CDC console as per-row RLE-compressed
+    // RGB565 hex, a bounded band per render pass so the capture rides the
+    // idle poll instead of hitching a frame. The cursor is the only shared
+    // word: core 0 arms it from the input path, the render task walks it to
+    // the end. Rows carry their own y, so a frame rendered mid-capture
+    // shows up as a torn but well-formed dump; byte-exact captures (the
+    // point - verifying the differential push against a host decode) are
+    // taken on static pages where no frame interleaves.
+    static constexpr int16_t kShotRowsPerPass_ = 20;
+    std::atomic<int16_t> shot_row_{-1};  ///< Next row to stream; -1 = idle
+    void serviceScreenshot_() noexcept;
+
+    // Per-page canvas depth policy: text-only pages (Settings, Terminal)
+    // render into an 8-bit RGB332 sprite, halving the framebuffer to ~57KB;
+    // icon/gradient pages keep the 16-bit canvas. LGFX interprets the
+    // uint16_t color constants as RGB565 and converts on write, so draw
+    // code is depth-agnostic. The sprite is recreated on page switches that
+    // cross the depth boundary (see applyCanvasDepth_).
+    bool canvas_depth8_ = false;
+    static bool pageWants8Bit_(Page p) noexcept;
+    void applyCanvasDepth_() noexcept;
+
+    // Adaptive animation quality: when animation frames keep missing the
+    // 16 ms budget, the canvas drops to RGB332 for the rest of the burst -
+    // halving every fill and blit's framebuffer writes - and the resting
+    // frame re-renders at full color once the motion stops. During motion
+    // temporal smoothness beats color fidelity; the eye gets the full-
+    // quality frame the moment it can actually inspect one. Strain
+    // accumulates on over-budget animation frames and decays on fast ones,
+    // so a single slow frame never triggers the switch.
+    // (anim_strain_ / anim_low_color_ live in the hot block up top.)
+    static constexpr uint32_t kFrameBudget_us_ = 16000;  ///< Deadline the strain counter measures
+    static constexpr uint8_t kAnimStrainEngage_ = 3;     ///< Strain level that drops the depth
+
+    // LiveCounter digit glyph cache: the size-4 counter digits are rendered
+    // once into small RGB332 sprites and blitted per frame afterwards, so
+    // the font rasterizer no longer runs for the page's largest text at
+    // high status rates. Built lazily on first use, torn down never (7.7KB).
+    static constexpr int16_t kGlyphW_ = 24;  ///< 6 px GLCD cell x text size 4
+    static constexpr int16_t kGlyphH_ = 32;  ///< 8 px GLCD cell x text size 4
+    static constexpr int kGlyphComma_ = 10;  ///< Slot for the group separator
+    LGFX_Sprite* digit_glyphs_[11] = {};
+    bool glyph_cache_valid_ = false;
+    bool buildGlyphCache_() noexcept;
+    void drawCounterDigits_(const char* text, int16_t x, int16_t y) noexcept;
+
+    // Grouped number formatting (1,234,567): operators misread magnitudes
+    // in raw digit runs, and one 10x target entry slipped through because
+    // of it. formatGrouped_ is the plain helper for labels and settings
+    // rows; the counter hot path goes through formatGroupedCycle_, which
+    // keeps the previous frame's string and, when only the low group
+    // moved (the steady state of a running counter), patches those three
+    // digits in place instead of reformatting.
+    static void formatGrouped_(uint32_t v, char* out, size_t cap) noexcept;
+    const char* formatGroupedCycle_(uint32_t v) noexcept;
+    uint32_t live_fmt_val_ = UINT32_MAX;  ///< Value live_fmt_str_ renders
+    char live_fmt_str_[16] = {0};
+    uint8_t live_fmt_len_ = 0;
+
+    // Circular menu tag cache: the selected item's composed center label
+    // renders once into a small 8-bit sprite and is blitted on every
+    // selector animation frame afterwards, so the font rasterizer runs on
+    // selection change instead of per frame. One slot suffices - only the
+    // selected item's tag is ever on screen. Built lazily, kept (~4.2KB);
+    // on OOM the caller falls back to direct text rendering.
+    static constexpr int16_t kMenuTagW_ = 104;  ///< Widest tag ("Terminal") at size 2
+    static constexpr int16_t kMenuTagH_ = 40;   ///< Two size-2 lines + leading
+    LGFX_Sprite* menu_tag_sprite_ = nullptr;
+    int menu_tag_index_ = -1;           ///< Menu index the sprite holds (-1 = none)
+    bool ensureMenuTag_(int selected) noexcept;
+
+    // Settings row cache: each visible card renders once into a pooled
+    // 8-bit row sprite keyed by a content hash, so the per-step frames of
+    // the scroll animation cost vertical blits instead of rounded-rect and
+    // text rasterization. Slots map by item index modulo the pool size (a
+    // four-row visible window never collides); a row re-renders only when
+    // its hash (label, value text, selection) changes. The pool is torn
+    // down on leaving the page (~38KB of heap while it is open).
+    struct SettingsRow {
+        LGFX_Sprite* sprite = nullptr;  ///< 8-bit row canvas (lazy)
+        uint32_t hash = 0;              ///< Content hash of the rendered card
+        bool valid = false;             ///< Sprite holds a rendered card
+    };
+    static constexpr size_t kSettingsRowPool_ = 5;
+    static constexpr int16_t kSettingsRowW_ = 190;
+    static constexpr int16_t kSettingsRowH_ = 40;
+    SettingsRow settings_rows_[kSettingsRowPool_];
+    bool ensureSettingsRow_(SettingsRow& row) noexcept;
+    void renderSettingsRow_(LGFX_Sprite& s, const char* label, const char* value,
+                            bool selected, bool is_category) noexcept;
+    void freeSettingsRows_() noexcept;
+    static uint32_t settingsRowHash_(const char* label, const char* value,
+                                     bool selected, bool is_category) noexcept;
+
+    // Button chrome atlas: the anti-aliased corners fillSmoothRoundRect
+    // recomputes per button per frame render once into a small rounded-
+    // square sprite per (radius, fill, border, ring count) style, and the
+    // button helpers assemble chrome from four corner blits plus flat
+    // body/edge runs - only the label still rasterizes live. Popup frames
+    // with three buttons get constant-time chrome. Tiles are 16-bit so
+    // accent colors survive on the full-color pages; at ~(2r+4)^2 pixels
+    // each the whole pool stays under a few KB. Styles map to slots by
+    // lookup with round-robin recycling, and the idle pass evicts the
+    // pool when no button has blitted for a while. On OOM the helpers
+    // fall back to direct rendering.
+    struct ChromeSlot {
+        LGFX_Sprite* sprite = nullptr;  ///< 2Rx2R rounded square (lazy)
+        uint32_t key = 0;               ///< Style hash the tiles hold
+        int16_t half = 0;               ///< R: corner tile edge (radius + 2)
+    };
+    static constexpr size_t kChromeSlots_ = 6;
+    ChromeSlot chrome_slots_[kChromeSlots_];
+    size_t chrome_victim_ = 0;           ///< Next slot recycled on overflow
+    uint32_t chrome_last_use_ms_ = 0;    ///< Last frame that blitted chrome
+    ChromeSlot* ensureChrome_(int16_t r, uint16_t bg, uint16_t border,
+                              bool double_border) noexcept;
+    void drawButtonChrome_(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r,
+                           uint16_t bg, uint16_t border, bool double_border) noexcept;
+    void freeChromeCache_() noexcept;
+
+    // Cache scheduler: lifecycle management for the render-side caches
+    // above. Idle render passes (no frame wanted, no animation) warm the
+    // cache the current context is about to need and evict sprites nobody
+    // has blitted for a while, so page entry pays a blit instead of a
+    // build and stale sprites stop pinning heap. Every lookup is counted,
+    // and perfDump_ prints per-cache hit rates next to the helper costs,
+    // so cache effectiveness is measured in the field rather than assumed.
+    enum class CacheId : uint8_t {
+        Glyphs = 0,    ///< LiveCounter digit sprites
+        MenuTag,       ///< Landing center tag sprite
+        SettingsRows,  ///< Settings card sprite pool
+        Landing,       ///< Landing retained frame
+        Terminal,      ///< Terminal line cache
+        Chrome,        ///< Button chrome corner tiles
+        Count
+    };
+    struct CacheCounters {
+        uint32_t hits = 0;    ///< Lookups served from the cache
+        uint32_t misses = 0;  ///< Lookups that had to (re)build
+        uint32_t warms = 0;   ///< Builds done ahead of use on idle passes
+        uint32_t evicts = 0;  ///< Entries dropped as stale
+    };
+    CacheCounters cache_stats_[static_cast<size_t>(CacheId::Count)];
+    /// Count one cache lookup (two words; cheap enough for draw paths).
+    void cacheNote_(CacheId id, bool hit) noexcept
+    {
+        CacheCounters& c = cache_stats_[static_cast<size_t>(id)];
+        if (hit) {
+            ++c.hits;
+        } else {
+            ++c.misses;
+        }
+    }
+    static const char* cacheName_(CacheId id) noexcept;
+    /// Idle-pass warming and stale eviction (render task, ui_mutex_ held).
+    void serviceCacheIdle_(uint32_t now_ms) noexcept;
+    void freeGlyphCache_() noexcept;
+    uint32_t glyph_last_use_ms_ = 0;     ///< Last frame that blitted digits
+    uint32_t menu_tag_last_use_ms_ = 0;  ///< Last frame that blitted the tag
+    uint32_t cache_warm_us_ = 0;         ///< Total idle time spent warming
+    static constexpr uint32_t kCacheStaleMs_ = 30000;  ///< Unused this long => evict
+
+    // Event-driven tick: Tick() blocks on a queue set (proto + encoder
+    // events) with a timeout computed from animation/touch activity instead
+    // of waking unconditionally every 16 ms. Touch is polled by M5.update(),
+    // so a short wait is used while a touch session is plausible.
+    QueueSetHandle_t event_set_ = nullptr;
+    static constexpr uint32_t kActiveWait_ms = 16;   ///< Wait while animating/touching
+    static constexpr uint32_t kDragWait_ms = 8;      ///< Wait while a drag is live
+    static constexpr uint32_t kIdleWait_ms = 100;    ///< Wait on a fully idle screen
+    static constexpr uint32_t kTouchWindow_ms = 600; ///< Post-input window kept responsive
+
+    // Touch-down wake: the FT3267 INT line (active low) posts into this
+    // length-1 queue from a GPIO ISR, so first contact interrupts the idle
+    // event wait instead of landing on the next 100 ms deadline. The I2C
+    // side is already interrupt-gated — the touch driver skips the bus
+    // read entirely while INT reads released — so idle ticks cost one GPIO
+    // read, never a bus transaction.
+    QueueHandle_t touch_irq_queue_ = nullptr;
+    static void touchIrqIsr_(void* arg);
+
+    // Power governor: mounted dials sit untouched for most of a shift, so
+    // after an inactivity window the display dims, and after a second one
+    // the Tick event wait is replaced by light sleep in short slices. Wake
+    // sources are the EC11 pins, the touch controller's interrupt line and
+    // WiFi RX, so ESP-NOW keepalives keep arriving and connection state
+    // survives the nap. RAM is retained across light sleep: the canvas is
+    // intact on wake and the repaint costs one ordinary frame.
+    enum class PowerState : uint8_t { Active, Dimmed, Sleeping };
+    PowerState power_state_ = PowerState::Active;
+    uint32_t power_state_since_ms_ = 0;
+    uint8_t pre_dim_brightness_ = 0;   ///< Brightness to restore on wake
+    // Panel sleep: once the fade-to-black lands, the panel itself is put
+    // into sleep-in (SLPIN) — its frame RAM is retained, only the refresh
+    // machinery stops. Wake is sleep-out plus a blit of the retained
+    // canvas, never the init sequence with its full reset timing, so
+    // wake-to-visible is one SLPOUT and one sprite push.
+    bool panel_asleep_ = false;        ///< Panel is in SLPIN (frame RAM retained)
+    bool wake_blit_pending_ = false;   ///< Render task: push the retained canvas as-is
+    static constexpr uint32_t kDimAfter_ms = 30000;     ///< Input-idle window before dimming
+    static constexpr uint32_t kSleepAfter_ms = 120000;  ///< Input-idle window before sleeping
+    static constexpr uint8_t kDimBrightness_ = 16;      ///< Dimmed backlight ceiling
+    static constexpr uint64_t kSleepSlice_us = 500000;  ///< Timer wake so polls keep their cadence
+    void servicePowerGovernor_(uint32_t now_ms) noexcept;
+    bool lightSleepWait_() noexcept;
+
+    // Adaptive brightness: the governor no longer steps the backlight
+    // instantly or pins itself Active whenever frames render. Targets are
+    // activity-aware — full while the operator is interacting, a "watching"
+    // floor while a test streams telemetry with nobody touching the dial,
+    // the dim floor when idle, lower still at night once the RTC has real
+    // time — and every downward transition fades along a precomputed
+    // gamma-2.2 curve so the ramp reads linear to the eye with integer
+    // math only. Wake stays deliberately instant: input or an alert-driven
+    // redraw snaps to the active level in one step.
+    uint8_t bright_from_ = 0;          ///< Down-ramp start duty
+    uint8_t bright_to_ = 0;            ///< Down-ramp target duty
+    uint32_t bright_ramp_ms_ = 0;      ///< Ramp start timestamp (0 = no ramp running)
+    static constexpr uint32_t kFade_ms = 450;         ///< Down-ramp duration
+    static constexpr uint8_t kWatchBrightness_ = 72;  ///< Floor while a test is live
+    static constexpr uint8_t kNightBrightness_ = 6;   ///< Idle floor during night hours
+    uint8_t brightnessTarget_(PowerState state) const noexcept;
+    void startBrightnessRamp_(uint8_t target, uint32_t now_ms) noexcept;
+    void serviceBrightnessRamp_(uint32_t now_ms) noexcept;
+    static bool nightHours_() noexcept;
+
+    // Alert engine: a fault during an unattended run must read across the
+    // room, and it must not buy that visibility with full-screen repaints.
+    // A raise breathes the backlight (PWM writes only — zero render work)
+    // and composites a thin severity-colored rim ring: one full frame lays
+    // it down, after which the unclipped per-frame redraw writes identical
+    // pixels and the differential push never re-sends untouched rows. Any
+    // operator input acknowledges; a Warn also self-clears, Critical
+    // stands until acknowledged or the unit reports the error gone.
+    enum class AlertSeverity : uint8_t { None = 0, Warn, Critical };
+    AlertSeverity alert_sev_ = AlertSeverity::None;
+    uint32_t alert_since_ms_ = 0;          ///< Raise timestamp (pulse phase anchor)
+    bool alert_pulsing_ = false;           ///< Pulse owns the backlight right now
+    uint8_t alert_base_brightness_ = 0;    ///< Level restored when the pulse stops
+    static constexpr uint32_t kAlertWarnAuto_ms = 6000;    ///< Warn self-clear window
+    static constexpr uint32_t kAlertWarnPeriod_ms = 1600;  ///< Gentle breathe
+    static constexpr uint32_t kAlertCritPeriod_ms = 640;   ///< Urgent breathe
+    void raiseAlert_(AlertSeverity sev, uint32_t now_ms) noexcept;
+    void clearAlert_() noexcept;
+    void serviceAlertPulse_(uint32_t now_ms) noexcept;
+    void drawAlertRing_() noexcept;
+
+    // Idle screensaver: a static dimmed screen burns in the panel and reads
+    // as dead from across the floor, but an animated saver must not undo the
+    // idle-power work. This one is a dim comet arc crawling the rim: one
+    // short fillArc pair per step, dirty rects the size of the comet, so a
+    // step costs a ~40 px partial frame every 250 ms — well under 1% CPU
+    // and never a full-frame push. Entered from a settled Dimmed state;
+    // any input or alert ends it on the next tick (the wake repaint
+    // already restores the screen).
+    bool saver_active_ = false;
+    uint16_t saver_deg_ = 0;           ///< Comet tail angle (head leads by kSaverArc_deg)
+    uint32_t saver_step_ms_ = 0;       ///< Last advance timestamp
+    static constexpr uint32_t kSaverAfter_ms = 15000;  ///< Dimmed dwell before the saver starts
+    static constexpr uint32_t kSaverStep_ms = 250;     ///< Advance cadence
+    static constexpr uint16_t kSaverArc_deg = 30;      ///< Comet length
+    static constexpr uint16_t kSaverStep_deg = 3;      ///< Advance per step (30 s per orbit)
+    void serviceScreensaver_(uint32_t now_ms) noexcept;
+    void drawSaverArc_() noexcept;
+    static void saverArcBBox_(int a0, int a1, int16_t& x, int16_t& y,
+                              int16_t& w, int16_t& h) noexcept;
+
+    // Boot animation: runs as an incremental state machine on the render
+    // task while radio bring-up and peer restore proceed on core 0, so
+    // boot-to-usable is the slower of the two rather than their sum. The
+    // hold phase ends when the radio reports ready (or at the cap), and the
+    // progress arc tracks that real completion instead of pure elapsed time.
+    enum class BootPhase : uint8_t { FadeIn, Hold, FadeOut, Blank, Done };
+    BootPhase boot_phase_ = BootPhase::Done;            ///< Current animation phase
+    uint32_t boot_phase_ms_ = 0;                        ///< Phase entry timestamp
+    float boot_progress_ = 0.0f;                        ///< Arc progress (monotonic)
+    bool boot_radio_ready_ = false;                     ///< RadioReady seen (set on core 0)
+    static constexpr uint32_t kBootFadeIn_ms = 480;     ///< Fade-in duration
+    static constexpr uint32_t kBootHoldMin_ms = 700;    ///< Min hold (lets the logo register)
+    static constexpr uint32_t kBootHoldMax_ms = 3000;   ///< Hold cap if the radio is slow
+    static constexpr uint32_t kBootFadeOut_ms = 200;    ///< Fade-out duration
+    static constexpr uint32_t kBootBlank_ms = 100;      ///< Black gap before the first page
+    static constexpr uint8_t kBootBrightness_ = 128;    ///< Splash brightness ceiling
+    void serviceBootAnimation_(uint32_t now_ms) noexcept;
+
+    // Input
+    EC11Encoder encoder_;
+
+    // Trace correlation: each dispatched input (and each consumed proto
+    // event) allocates a correlation id and makes it ambient on the tick
+    // core, so every trace record it causes carries the id; frame_corr_
+    // hands the latest one across to the render task (read under
+    // ui_mutex_), which re-arms it at the top of draw_. The host converter
+    // then reconstructs detent -> state change -> redraw chains instead of
+    // leaving the reader to line up timestamps. Free when tracing is off.
+    uint16_t frame_corr_ = 0;
+    void traceInputCorr_() noexcept;
+
+    // UI state (page_/dirty_/encoder_pos_ live in the hot block up top)
+    // Poll cadence comes from the protocol layer's token-bucket scheduler
+    // (espnow::RegisterPeriodicJob): the active-unit status poll and the
+    // background round-robin poll each own a jittered bucket, so their
+    // airtime never phase-locks with discovery or each other. last_poll_ms_
+    // survives only as the fixed-cadence fallback if registration fails.
+    int poll_job_ = -1;        ///< Active-unit poll + housekeeping gate
+    int fleet_poll_job_ = -1;  ///< Background-unit round-robin poll
     uint32_t last_poll_ms_ = 0;
+    bool rssi_weak_ = false;  ///< Active unit signal below the weak threshold (for log crossings)
+    bool health_registered_ = false;  ///< Tick has joined the health monitor
+    espnow::ControllerRole ctrl_role_seen_ =
+        espnow::ControllerRole::Solo;  ///< Arbitration role (for log crossings)
 
-    // Connection tracking
-    ConnStatus conn_status_ = ConnStatus::Disconnected;
+    // Ingress overload: cap the proto events consumed per tick so a packet
+    // storm can never starve handleInputs_ — the backlog drains across
+    // ticks (the non-empty queue re-wakes the event set immediately) while
+    // the STOP button stays live. rx_storm_ mirrors the protocol layer's
+    // shedding latch for the header indicator and log transitions.
+    static constexpr int kProtoEventBudget_ = 12;
+    bool rx_storm_ = false;
+
+    // Critical command journal mirror (see espnow::CriticalCommandPending):
+    // while a Stop/Pause is journaled but unacked the LiveCounter state
+    // pill shows it pending, so an unobserved run-on is visible at a glance.
+    bool critical_pending_ = false;
+    uint8_t critical_pending_cmd_ = 0;
+
+    // Firmware update mirror (see espnow::GetOtaProgress): the receiver
+    // lives in the protocol layer; the UI just overlays its progress.
+    espnow::OtaState ota_state_ = espnow::OtaState::Idle;
+    uint8_t ota_percent_ = 0;
+    void drawOtaOverlay_() noexcept;
+
+    // Page-driven status rate control: the attended page decides how fast
+    // the unit streams StatusUpdate (LiveCounter/Bounds foreground = fast,
+    // everything else = trickle), with a time-boxed burst around moments
+    // that need dense samples. Re-sent on change and on LinkUp.
+    uint16_t status_rate_sent_ms_ = 0;    ///< Interval last pushed to the unit (0 = never)
+    uint32_t status_burst_until_ms_ = 0;  ///< Burst rate active until this tick
+    void serviceStatusRate_(uint32_t now_ms) noexcept;
+    void requestStatusBurst_(uint32_t now_ms, uint32_t duration_ms) noexcept;
+    uint16_t desiredStatusIntervalMs_(uint32_t now_ms) const noexcept;
+
+    // Dirty-rectangle tracking: draw paths register the regions they touch so
+    // draw_() can re-render (clipped) and flush only the affected scanlines.
+    // A frame with dirty_ set but no registered rects falls back to full redraw.
+    DirtyRectTracker dirty_rects_{240, 240};
+    // Progress fraction last rendered by drawLiveCounter_; lets the proto
+    // handler tell "arc moved" (segment append) from "digits only", and the
+    // draw path extend the arc instead of repainting all 360 degrees.
+    float live_arc_drawn_progress_ = -1.0f;
+    uint16_t live_arc_color_ = 0;  ///< Color the retained arc was drawn in
+    void markArcSegment_(float a0_deg, float a1_deg) noexcept;
+
+    // Last page / connection state reported to the black-box recorder.
+    Page bb_page_noted_ = Page::Landing;
+    ConnStatus bb_conn_noted_ = ConnStatus::Disconnected;
+
+    // Session restore (session_restore.hpp): Init() arms a pending restore
+    // when a warm reset interrupted a running test; the housekeeping tick
+    // completes it once the checkpointed unit reappears in the peer table,
+    // jumping to LiveCounter and reconciling with one ConfigRequest. Any
+    // operator input before then cancels it — they already chose a view.
+    bool restore_pending_ = false;
+    uint8_t restore_mac_[6] = {};
+    uint8_t restore_cmd_ = 0;            ///< Checkpointed pending command
+    uint32_t restore_deadline_ms_ = 0;   ///< Give up waiting for the unit
+    uint8_t sr_unit_noted_[6] = {};      ///< Last MAC checkpointed
+    static constexpr uint32_t kRestoreWindow_ms = 15000;
+    void attemptSessionRestore_(uint32_t now_ms) noexcept;
     uint32_t last_rx_ms_ = 0;
     // Set when we newly transition to Connected; cleared after first ConfigResponse.
     bool pending_machine_resync_ = false;
     static constexpr uint32_t kConnTimeout_ms = 3000;
 
-    // Main menu (Landing) - Circular carousel like M5Dial factory demo
-    static constexpr int MENU_COUNT_ = 4;
+    // Multi-unit fleet: one slot per approved FatigueTester peer. The active
+    // unit is mirrored into the legacy single-unit fields above so every page
+    // keeps working unchanged; background units only track liveness and the
+    // last status, refreshed by a round-robin poll (one unit per poll tick).
+    static constexpr size_t kMaxUnits_ = MAX_APPROVED_PEERS;
+    struct UnitState {
+        uint8_t mac[6] = {};
+        bool in_use = false;
+        ConnStatus conn = ConnStatus::Disconnected;
+        uint32_t last_rx_ms = 0;
+        bool have_status = false;
+        uint8_t peer_index = espnow::PEER_INDEX_NONE;  ///< Interned identity (cached on first event)
+        fatigue_proto::StatusPayload status{};
+        fatigue_proto::StatusDecoder decoder{};  ///< v2 delta-status context
+    };
+    UnitState units_[kMaxUnits_]{};
+    size_t unit_count_ = 0;
+    int active_unit_ = 0;
+    size_t unit_poll_cursor_ = 0;
+    // Delta-status context for senders not (yet) in the unit table.
+    fatigue_proto::StatusDecoder status_decoder_{};
+    void refreshUnitTable_(uint32_t now_ms) noexcept;
+    int unitIndexForMac_(const uint8_t mac[6]) const noexcept;
+    int unitIndexForEvent_(const espnow::ProtoEvent& evt) noexcept;
+    void selectNextUnit_(uint32_t now_ms) noexcept;
+    void selectUnit_(int index, uint32_t now_ms) noexcept;
+    bool activeUnitMac_(uint8_t mac_out[6]) const noexcept;
+    // Active-unit sends: route through the fleet table when populated and
+    // fall back to the protocol's first-peer resolution otherwise.
+    bool sendConfigRequestActive_() noexcept;
+    bool sendConfigSetActive_(const void* config_data, size_t config_len) noexcept;
+    bool sendConfigUpdateActive_(const fatigue_proto::ConfigPayload& desired,
+                                 uint32_t now_ms) noexcept;
+    bool sendCommandActive_(uint8_t command_id, const void* payload, size_t payload_len) noexcept;
+
+    // Main menu (Landing) - Circular carousel like M5Dial factory demo.
+    // Items live in the kMenuItems_ table; adding a page means adding a row
+    // (up to CircularMenuSelector::kMaxItems). Per-frame cost stays flat as
+    // the table grows: only icons within kMenuIconArc_ positions of the
+    // selection are RLE-decoded, the rest render as colored dots.
+    static constexpr int MENU_COUNT_ = 9;
+    static_assert(MENU_COUNT_ <= CircularMenuSelector::kMaxItems,
+                  "Landing menu table exceeds selector capacity");
+    static constexpr int kMenuIconArc_ = 2;
+    static constexpr int16_t kMenuFarDotRadius_ = 6;
     int menu_index_ = 0;
     CircularMenuSelector menu_selector_{};
     CircularMenuConfig menu_config_{};
@@ -135,9 +775,7 @@ private:
         const char* tag_up;
         const char* tag_down;
         uint16_t color;
-        const uint16_t* icon_data;
-        int16_t icon_w;
-        int16_t icon_h;
+        const assets::CompressedIcon* icon;  // Palettized RLE icon (icon_codec.hpp)
         Page target_page;
     };
     static const CircularMenuItem kMenuItems_[MENU_COUNT_];
@@ -150,7 +788,23 @@ private:
     
     SettingsCategory settings_category_ = SettingsCategory::Main;
     int settings_index_ = 0;
-    
+
+    // Named profiles (Settings > Profiles): RAM cache of the persisted
+    // slots, loaded lazily on first entry. Click on a saved slot applies
+    // it and pushes the result through the config sync engine as a diff;
+    // click on an empty slot (or long-press anywhere) saves the current
+    // parameters. profile_offer_slot_ is the slot remembered for the
+    // active unit's MAC, surfaced on the main-level Profiles row after a
+    // unit switch so changeover is recall, not re-keying.
+    SettingsProfile profiles_[SettingsStore::kProfileSlots]{};
+    bool profile_used_[SettingsStore::kProfileSlots]{};
+    bool profiles_loaded_ = false;
+    int8_t profile_offer_slot_ = -1;
+    void loadProfiles_() noexcept;
+    void applyProfileSlot_(int slot, uint32_t now_ms) noexcept;
+    void saveProfileSlot_(int slot, uint32_t now_ms) noexcept;
+    void offerProfileForActive_(uint32_t now_ms) noexcept;
+
     enum class SettingsFocus : uint8_t { List, Back, Save };
     SettingsFocus settings_focus_ = SettingsFocus::List;
     bool settings_value_editing_ = false;
@@ -186,6 +840,102 @@ private:
     float settings_editor_f32_step_ = 0.1f;
     uint32_t settings_editor_u32_step_ = 10;
 
+    // Bounds composite editor ("Tune All"): the five coupled stall-tuning
+    // fields staged on one screen, validated as a set and applied together.
+    // Staged values live here until APPLY writes them into edit_settings_,
+    // so CANCEL discards everything and the per-field editors stay untouched.
+    bool bounds_tune_active_ = false;
+    int bounds_tune_focus_ = 0;        // 0..4 = fields, 5 = APPLY, 6 = CANCEL
+    bool bounds_tune_editing_ = false; // Rotation adjusts the focused field
+    float bounds_tune_search_vel_ = 0.0f;
+    float bounds_tune_sg_min_vel_ = 0.0f;
+    int8_t bounds_tune_sgt_ = 0;
+    float bounds_tune_stall_factor_ = 0.0f;
+    float bounds_tune_search_accel_ = 0.0f;
+
+    // Settings field schema: one row per editable field (location inside
+    // Settings, value type, clamp floor, editing granularity). The value
+    // editor snapshot/write-back and settingsHaveChanges_() iterate this
+    // table, so adding a TestUnitSettings field is one new row instead of
+    // matching branches in every editor path.
+    struct SettingsFieldDesc {
+        SettingsCategory category;     ///< Submenu owning the field
+        uint8_t index;                 ///< Item index inside the submenu
+        SettingsEditorValueType type;  ///< Editor value type
+        uint16_t offset;               ///< Byte offset inside Settings
+        float min_value;               ///< Clamp floor (F32 fields)
+        uint32_t u32_step;             ///< Initial encoder step (U32 fields)
+        uint32_t u32_unit_div;         ///< U32 edited in storage/div units (dwell: 100 = 0.1 s)
+        const char* label;             ///< Short field name
+    };
+    static constexpr SettingsFieldDesc kSettingsFields_[] = {
+        {SettingsCategory::FatigueTest, 1, SettingsEditorValueType::U32,
+         offsetof(Settings, test_unit.cycle_amount), 0.0f, 10, 1, "cycles"},
+        {SettingsCategory::FatigueTest, 2, SettingsEditorValueType::F32,
+         offsetof(Settings, test_unit.oscillation_vmax_rpm), 5.0f, 0, 0, "vmax"},
+        {SettingsCategory::FatigueTest, 3, SettingsEditorValueType::F32,
+         offsetof(Settings, test_unit.oscillation_amax_rev_s2), 0.5f, 0, 0, "amax"},
+        {SettingsCategory::FatigueTest, 4, SettingsEditorValueType::U32,
+         offsetof(Settings, test_unit.dwell_time_ms), 0.0f, 1, 100, "dwell"},
+        {SettingsCategory::BoundsFinding, 1, SettingsEditorValueType::Bool,
+         offsetof(Settings, test_unit.bounds_method_stallguard), 0.0f, 0, 0, "method"},
+        {SettingsCategory::BoundsFinding, 2, SettingsEditorValueType::F32,
+         offsetof(Settings, test_unit.bounds_search_velocity_rpm), 0.0f, 0, 0, "bnd vel"},
+        {SettingsCategory::BoundsFinding, 3, SettingsEditorValueType::F32,
+         offsetof(Settings, test_unit.stallguard_min_velocity_rpm), 0.0f, 0, 0, "sg vel"},
+        {SettingsCategory::BoundsFinding, 4, SettingsEditorValueType::I8,
+         offsetof(Settings, test_unit.stallguard_sgt), 0.0f, 0, 0, "sgt"},
+        {SettingsCategory::BoundsFinding, 5, SettingsEditorValueType::F32,
+         offsetof(Settings, test_unit.stall_detection_current_factor), 0.0f, 0, 0, "stall fac"},
+        {SettingsCategory::BoundsFinding, 6, SettingsEditorValueType::F32,
+         offsetof(Settings, test_unit.bounds_search_accel_rev_s2), 0.0f, 0, 0, "bnd acc"},
+        {SettingsCategory::UI, 1, SettingsEditorValueType::U8,
+         offsetof(Settings, ui.brightness), 0.0f, 0, 0, "brightness"},
+    };
+    static constexpr size_t kSettingsFieldCount_ =
+        sizeof(kSettingsFields_) / sizeof(kSettingsFields_[0]);
+    static const SettingsFieldDesc* findSettingsField_(SettingsCategory category,
+                                                       int index) noexcept;
+    static size_t settingsFieldSize_(SettingsEditorValueType type) noexcept;
+
+    // Per-field change tracking: writes into edit_settings_ go through
+    // writeSettingsField_, which compares the new bytes against the entry
+    // snapshot and sets or clears that field's dirty bit. Change detection
+    // is then a mask test instead of a repeated struct scan, a value edited
+    // away and back clears its own bit, and "which fields changed" is a
+    // bit-scan over the schema — the shape a config diff wants. Bulk writes
+    // (profile recall, the bounds composite editor) recompute the mask in
+    // one schema pass instead of threading bits through every assignment.
+    uint16_t settings_dirty_bits_ = 0;
+    static_assert(kSettingsFieldCount_ <= 16, "settings_dirty_bits_ needs widening");
+    void writeSettingsField_(const SettingsFieldDesc& field, const void* value) noexcept;
+    void resetSettingsBaseline_() noexcept;
+    void recomputeSettingsDirtyBits_() noexcept;
+
+    // Settings MRU fast access: a long press on the Settings icon opens an
+    // overlay of the most recently edited fields and a click jumps straight
+    // into the value editor, skipping the category walk. The ring holds
+    // indices into kSettingsFields_ (most recent first, deduplicated) and
+    // everything renders from the schema table - no allocation, no state
+    // beyond these few bytes. RAM-only by design: it tracks a shift's edit
+    // habits, not configuration.
+    static constexpr size_t kSettingsMruSize_ = 4;
+    uint8_t settings_mru_[kSettingsMruSize_]{};  ///< kSettingsFields_ indices, MRU first
+    uint8_t settings_mru_count_ = 0;
+    bool mru_active_ = false;  ///< Overlay open on the landing page
+    int mru_index_ = 0;        ///< Highlighted overlay row
+    void recordSettingsMru_(const SettingsFieldDesc* field) noexcept;
+    void openSettingsMruField_(uint32_t now_ms) noexcept;
+    void drawSettingsMruOverlay_(uint32_t now_ms) noexcept;
+
+    // Encoder velocity engine: fast spins multiply the effective step so
+    // large values (e.g. cycle_amount) are reachable in a couple of seconds,
+    // while slow motion keeps single-step precision.
+    static constexpr uint32_t kEditVelocityResetMs_ = 250;  // gap that resets velocity
+    uint32_t edit_last_detent_ms_ = 0;   // timestamp of previous editor detent
+    float edit_velocity_dps_ = 0.0f;     // smoothed detents/second
+    bool chord_rotate_ = false;          // current detent is a press-and-rotate chord
+
     // Settings navigation: remember which main item opened a sub-category.
     int settings_return_main_index_ = 0;
 
@@ -216,6 +966,64 @@ private:
     float bounds_global_max_deg_ = 0.0f;
     uint8_t bounds_last_error_code_ = 0;
 
+    // The displayed result came from the per-peer NVS cache (a previous
+    // session), not from a search run while this page was open. Cleared by
+    // a fresh BoundsResult and by every path through boundsResetResult_.
+    bool bounds_result_cached_ = false;
+
+    // Live progress streamed while the search runs (BoundsProgress, few Hz).
+    // drawBounds_ animates from this when fresh and falls back to the
+    // simulated swing when the stream goes quiet.
+    bool bounds_have_progress_ = false;
+    uint8_t bounds_progress_phase_ = 0;
+    float bounds_progress_deg_ = 0.0f;
+    float bounds_progress_min_deg_ = 0.0f;
+    float bounds_progress_max_deg_ = 0.0f;
+    uint32_t bounds_progress_ms_ = 0;
+    static constexpr uint32_t kBoundsProgressStale_ms = 2000;
+
+    // Rim gauge: unit angles map onto a 150-degree arc at the top of the
+    // round panel, riding the same 100..115 band as the LiveCounter
+    // progress arc so markArcSegment_ serves both. The angles (screen
+    // degrees) and scale as last drawn let a BoundsProgress packet mark
+    // just the sweep delta dirty; the sentinel means "no retained gauge"
+    // and the next live packet falls back to a full frame.
+    static constexpr float kBoundsGaugeHalfSpan_deg = 75.0f;
+    float bounds_gauge_drawn_deg_ = 1e9f;
+    float bounds_gauge_drawn_min_ = 1e9f;
+    float bounds_gauge_drawn_max_ = 1e9f;
+    float bounds_gauge_scale_ = 75.0f;
+    static float boundsGaugeAngle_(float deg, float scale) noexcept;
+
+    // Versioned snapshot of the protocol-derived render inputs (seqlock).
+    // Protocol handling publishes after each Tick's event batch; the render
+    // task copies it tear-free at frame start without needing the mutex for
+    // these fields. Sequence is odd while a write is in flight; readers
+    // retry on a torn read. This is the decoupling point for moving more
+    // draw state off the shared mutex.
+    struct RenderSnapshot {
+        fatigue_proto::StatusPayload status{};
+        fatigue_proto::ConfigPayload remote_config{};
+        ConnStatus conn = ConnStatus::Disconnected;
+        bool have_status = false;
+        BoundsState bounds_state = BoundsState::Idle;
+        bool bounds_have_result = false;
+        bool bounds_bounded = false;
+        float bounds_min_deg = 0.0f;
+        float bounds_max_deg = 0.0f;
+        uint32_t log_generation = 0;  ///< Bumps whenever logf_ appends a line
+        uint32_t display_cycle = 0;   ///< Interpolated counter for the big digits
+        uint8_t unit_count = 0;       ///< Approved FatigueTester units
+        uint8_t active_unit = 0;      ///< Index shown on the Landing pill
+    };
+    std::atomic<uint32_t> snapshot_seq_{0};
+    RenderSnapshot snapshot_{};        // Published copy (seqlock-protected)
+    RenderSnapshot frame_snapshot_{};  // Renderer-local copy for one frame
+    uint32_t log_generation_ = 0;
+
+    void publishRenderSnapshot_() noexcept;
+    bool readRenderSnapshot_(RenderSnapshot& out) const noexcept;
+
     // Live Counter - popup support for Start/Pause/Resume/Stop
     enum class LiveFocus : uint8_t { Actions = 0, Back = 1 };
     enum class LivePopupMode : uint8_t {
@@ -228,9 +1036,26 @@ private:
     LiveFocus live_focus_ = LiveFocus::Actions;
     LivePopupMode live_popup_mode_ = LivePopupMode::None;
     uint8_t live_popup_selection_ = 0;
-    uint8_t pending_command_id_ = 0;
-    uint32_t pending_command_tick_ = 0;
-    
+    // Speculative command transitions: a command-issuing flow immediately
+    // shows the state the command should produce, in a provisional style
+    // (dimmed state color, trailing '?'), instead of parking on a generic
+    // SENDING placeholder - on a healthy link the pill leads the ack by a
+    // full round trip. CommandAck (uncorrelated, so the usual timing
+    // heuristic) or a status report matching the expectation confirms it;
+    // the timeout rolls the pill back to the reported state with the
+    // error buzz and a log line.
+    struct Speculation {
+        uint8_t expected_state = 0;  ///< TestState the command should land in
+        uint8_t command_id = 0;      ///< CommandId, for the rollback log line
+        uint32_t since_ms = 0;       ///< Send time; 0 = no speculation open
+    };
+    Speculation spec_{};
+    static constexpr uint32_t kSpecTimeout_ms = 2500;
+    void speculate_(fatigue_proto::CommandId cmd, fatigue_proto::TestState expected,
+                    uint32_t now_ms) noexcept;
+    void serviceSpeculation_(uint32_t now_ms) noexcept;
+
+
     // Quick Settings (accessible via long-press on LiveCounter during Running/Paused)
     // Items: 0=Back, 1=VMAX, 2=AMAX, 3=Dwell, 4=Cycles
     static constexpr int kQuickSettingsItemCount_ = 5;
@@ -250,20 +1075,104 @@ private:
     // Quick settings confirmation popup
     bool quick_settings_confirm_popup_ = false;
     uint8_t quick_settings_confirm_sel_ = 0;  // 0=Keep, 1=Revert
+
+    // Staged quick edits: kept values accumulate locally (badged per field)
+    // and travel as one coalesced config update when editing goes quiet or
+    // the popup is exited, instead of one round trip per field.
+    uint8_t quick_pending_mask_ = 0;        ///< Field bits (by item index) edited but not sent
+    uint8_t quick_inflight_mask_ = 0;       ///< Field bits sent, awaiting ConfigAck
+    uint32_t quick_pending_since_ms_ = 0;   ///< Last staged edit (starts the quiescence window)
+    static constexpr uint32_t kQuickFlushQuiesceMs_ = 1500;  ///< Idle time before auto-send
     
     // Brightness control (0-255)
     uint8_t brightness_ = 128;
 
-    // Terminal
-    static constexpr size_t LOG_CAPACITY_ = 120;
-    LogLine log_[LOG_CAPACITY_]{};
+    // Terminal - same RAM as the old 120-line formatted-text ring now holds
+    // 3x the history in 32-byte records.
+    static constexpr size_t LOG_CAPACITY_ = 360;
+    LogRecord log_[LOG_CAPACITY_]{};
+
+    // Terminal incremental rendering: per-line damage tracking (drawTerminal_).
+    static constexpr int kTermMaxRows_ = 16;                   ///< Max visible log rows
+    static constexpr uint32_t kTermRowInvalid_ = 0xFFFFFFFFu;  ///< Force-redraw sentinel
+    static constexpr uint32_t kTermRowEmpty_ = 0u;             ///< Blank-row hash
+    uint32_t term_row_hash_[kTermMaxRows_] = {};  ///< Content hash of each drawn row
+    bool term_cache_valid_ = false;               ///< Canvas holds a complete terminal frame
+    int16_t term_prev_dot_y_ = -1;                ///< Last scroll-dot y (-1 = none)
+    int16_t term_prev_spring_y_ = -1;             ///< Last spring-ring y (-1 = none)
+    int16_t term_prev_spring_r_ = 0;              ///< Last spring-ring radius
+    size_t term_prev_count_ = 0;                  ///< Entry count shown in the footer
     size_t log_head_ = 0;
     size_t log_count_ = 0;
     int scroll_lines_ = 0; // 0 = bottom
+    uint32_t session_log_drained_gen_ = 0;  ///< log_generation_ already fed to flash
+
+    // Landing incremental rendering: during the 300 ms carousel animation
+    // only the selector dot moves, so the previous frame is retained and
+    // just the dot's band is erased/redrawn. Any other visible change is
+    // caught by the signature and forces a full landing redraw.
+    struct LandingSig {
+        ConnStatus conn = ConnStatus::Disconnected;
+        bool have_status = false;
+        uint8_t state = 0;
+        uint32_t cycle = 0;
+        int selected = -1;
+        bool animating = false;
+        uint32_t pulse_bucket = 0;  ///< Connecting-pulse phase (0 otherwise)
+        uint8_t unit = 0;           ///< Active unit index (pill label)
+        uint8_t unit_count = 0;
+        uint8_t mru = 0;            ///< MRU overlay: 0 closed, else row+1
+
+        bool operator==(const LandingSig& o) const noexcept {
+            return conn == o.conn && have_status == o.have_status &&
+                   state == o.state && cycle == o.cycle &&
+                   selected == o.selected && animating == o.animating &&
+                   pulse_bucket == o.pulse_bucket &&
+                   unit == o.unit && unit_count == o.unit_count &&
+                   mru == o.mru;
+        }
+    };
+    bool landing_cache_valid_ = false;  ///< Canvas holds a complete landing frame
+    bool landing_incremental_ = false;  ///< This frame redraws the dot only
+    LandingSig landing_sig_{};          ///< Signature of the cached frame
+    int16_t landing_prev_dot_x_ = -1;   ///< Last selector-dot position
+    int16_t landing_prev_dot_y_ = -1;
+    LandingSig landingSignature_(uint32_t now_ms) const noexcept;
+
+    // LiveCounter content fingerprint: keepalive-heavy status traffic sets
+    // dirty_ without changing anything the page draws (same cycle_number,
+    // same state), so renderLoop_ hashes the rendered state (FNV-1a) and
+    // skips the frame when it matches the last rendered one. Time-driven
+    // elements (connecting pulse, pending-command overlay expiry) fold in
+    // through a phase bucket so they keep animating at the page's refresh.
+    uint32_t live_fp_ = 0;        ///< Fingerprint of the frame on the canvas
+    bool live_fp_valid_ = false;  ///< live_fp_ describes the current canvas
+    uint32_t liveCounterFingerprint_(const RenderSnapshot& snap, uint32_t now_ms) const noexcept;
+
+    // Idle-time page prefetch: while the landing page sits still, the
+    // render task speculatively draws the menu-selected destination page
+    // into the canvas without flushing it (the panel keeps showing the
+    // last pushed landing frame). If the user then clicks through, the
+    // first frame is already in the sprite and only costs a blit; the
+    // real frame follows one render pass later. Any ordinary renderFrame_
+    // overwrites the canvas and therefore invalidates the prefetch.
+    Page prefetch_page_ = Page::Landing;    ///< Page held by the canvas (Landing = none)
+    bool prefetch_valid_ = false;           ///< Canvas holds a prefetched frame
+    uint32_t prefetch_ms_ = 0;              ///< When the prefetch was drawn
+    static constexpr uint32_t kPrefetchRefresh_ms = 500;  ///< Idle re-draw cadence
+    static constexpr uint32_t kPrefetchFresh_ms = 1500;   ///< Max age to push on entry
+    static bool pagePrefetchable_(Page p) noexcept;
+    void tryPrefetch_(uint32_t now_ms) noexcept;
+
     bool encoder_scroll_mode_ = true;
     float terminal_overscroll_px_ = 0.0f;
 
-    // Touch tracking and gestures
+    // Touch tracking and gestures.
+    // Raw M5Unified samples are read once per input pass, which coalesces
+    // every move that arrived in between into one net delta. The gesture
+    // engine filters a vertical velocity from those deltas, classifies the
+    // session centrally (tap / long press / swipe / drag), and carries
+    // flick momentum after release so lists keep scrolling.
     bool touch_dragging_ = false;
     int16_t last_touch_y_ = 0;
     int16_t last_touch_x_ = 0;
@@ -271,6 +1180,20 @@ private:
     int16_t touch_start_y_ = 0;
     uint32_t touch_start_ms_ = 0;
     bool swipe_detected_ = false;
+    bool touch_moved_ = false;          ///< Crossed the tap slop radius
+    bool long_press_fired_ = false;     ///< Long press already dispatched
+    uint32_t last_touch_move_ms_ = 0;   ///< Timestamp of last consumed move
+    float touch_velocity_px_s_ = 0.0f;  ///< EWMA-filtered vertical velocity
+    float inertia_px_s_ = 0.0f;         ///< Flick velocity still coasting
+    float inertia_carry_px_ = 0.0f;     ///< Sub-pixel remainder between frames
+    uint32_t last_inertia_ms_ = 0;
+    static constexpr int16_t kTapSlop_px = 12;        ///< Max movement for a tap
+    static constexpr uint32_t kTapMax_ms = 500;       ///< Max hold for a tap
+    static constexpr uint32_t kLongPress_ms = 600;    ///< Hold time for a long press
+    static constexpr float kVelocityAlpha = 0.35f;    ///< EWMA weight of new samples
+    static constexpr float kFlickMin_px_s = 250.0f;   ///< Release speed that starts a flick
+    static constexpr float kFlickMax_px_s = 2400.0f;  ///< Flick speed clamp
+    static constexpr float kInertiaFriction = 0.0035f; ///< Velocity decay per ms
 
     // Settings scrolling and animation
     int settings_scroll_offset_ = 0;
@@ -289,32 +1212,195 @@ private:
     static constexpr uint32_t kFeedbackDuration_ms = 150;
 
     // Helpers
+    // Heap/stack telemetry: sampled on a slow cadence from the housekeeping
+    // tick, shown on the Diagnostics page, with threshold crossings logged
+    // through logf_ (latched so a sustained low state logs once).
+    struct MemTelemetry {
+        uint32_t heap_free = 0;         ///< Free internal heap (bytes)
+        uint32_t heap_min_free = 0;     ///< Lifetime heap low-water mark
+        uint32_t heap_largest = 0;      ///< Largest free block (fragmentation)
+        uint32_t worst_stack_free = 0;  ///< Smallest task stack headroom (bytes)
+        char worst_stack_task[8] = {};  ///< Task owning that headroom
+        bool valid = false;             ///< At least one sample taken
+    };
+    MemTelemetry mem_{};
+    uint32_t last_mem_sample_ms_ = 0;
+    bool mem_alert_heap_ = false;   ///< Latched low-heap alert
+    bool mem_alert_frag_ = false;   ///< Latched fragmentation alert
+    bool mem_alert_stack_ = false;  ///< Latched stack-headroom alert
+    static constexpr uint32_t kMemSamplePeriod_ms = 5000;
+    static constexpr uint32_t kHeapFreeWarn_bytes = 20 * 1024;
+    static constexpr uint32_t kHeapLargestWarn_bytes = 16 * 1024;
+    static constexpr uint32_t kStackFreeWarn_bytes = 512;
+    void sampleMemTelemetry_(uint32_t now_ms) noexcept;
+
+    // Encoder position integrity: periodic cross-check of the logical
+    // detent position against the PCNT hardware count (see
+    // EC11Encoder::checkDrift), run from the housekeeping tick. Drift is
+    // corrected in place only during input-idle windows — mid-interaction
+    // the counter is legitimately ahead of the last poll, and a silent
+    // position jump under the operator's thumb would read as a glitch.
+    // Any detection latches the "enc!" flag on the Diagnostics page; the
+    // counters go to serial with the PERF dump.
+    uint32_t last_enc_check_ms_ = 0;
+    uint32_t enc_drift_checks_ = 0;    ///< Cross-checks run
+    uint32_t enc_drift_events_ = 0;    ///< Checks that found nonzero drift
+    uint32_t enc_drift_detents_ = 0;   ///< Total |correction| applied
+    static constexpr uint32_t kEncCheckPeriod_ms = 60000;
+    static constexpr uint32_t kEncIdleForResync_ms = 2000;
+    void serviceEncoderDrift_(uint32_t now_ms) noexcept;
+
     void logf_(uint32_t now_ms, const char* fmt, ...) __attribute__((format(printf, 3, 4)));
+    void logfAt_(LogLevel level, uint32_t now_ms, const char* fmt, ...)
+        __attribute__((format(printf, 4, 5)));
+    void logVa_(LogLevel level, uint32_t now_ms, const char* fmt, va_list args) noexcept;
+    static void formatLogRecord_(const LogRecord& rec, char* out, size_t out_size) noexcept;
+    void drainLogSinks_() noexcept;
+
+    // Serial mirror sink: drainLogSinks_ formats each record once (shared
+    // with the flash sink) and queues the line to a low-priority task that
+    // owns the UART write, so console baud never backpressures the tick.
+    // A full queue drops the line and counts the drop.
+    struct SerialLogLine {
+        uint32_t ms;
+        uint8_t level;
+        char text[80];
+    };
+    QueueHandle_t serial_log_queue_ = nullptr;
+    static constexpr uint32_t kSerialLogTaskStack_ = 2560;
+    static constexpr UBaseType_t kSerialLogTaskPrio_ = 1;
+    bool log_serial_mirror_ = true;               ///< Mirror sink enabled
+    LogLevel log_serial_level_ = LogLevel::Info;  ///< Serial sink threshold
+    LogLevel log_flash_level_ = LogLevel::Info;   ///< Session-log sink threshold
+    uint32_t serial_log_drops_ = 0;               ///< Lines dropped on queue overflow
+    int8_t qs_slog_ = -1;                         ///< queue_stats slot (serial mirror)
+    int8_t qs_beep_ = -1;                         ///< queue_stats slot (beep player)
+    static void serialLogTaskEntry_(void* arg) noexcept;
+    size_t terminalHistoryCount_() const noexcept;
     void handleProtoEvents_(uint32_t now_ms) noexcept;
     void handleInputs_(uint32_t now_ms) noexcept;
+    // Input pipeline, split by latency class (see handleInputs_): the
+    // discrete drain dispatches queued detents/clicks and is cheap enough
+    // to run twice per tick; the touch pass classifies the one coalesced
+    // sample M5.update latched.
+    void drainEncoderEvents_(uint32_t now_ms) noexcept;
+    void handleTouchInputs_(uint32_t now_ms) noexcept;
+    void serviceInputReplay_(uint32_t now_ms) noexcept;
     void cycleSettingsEditorStep_() noexcept;
     void initSettingsEditorStep_() noexcept;
     void getSettingsEditorF32StepOptions_(const float*& steps, size_t& count) const noexcept;
     void onRotate_(int delta, uint32_t now_ms) noexcept;
     void onClick_(uint32_t now_ms) noexcept;
+    void onLongPress_(uint32_t now_ms) noexcept;
     void onTouchClick_(int16_t x, int16_t y, uint32_t now_ms) noexcept;
+
+    // Per-page input routing: each dispatcher above is one table load and
+    // an indirect call instead of a page compare chain, and a new page is
+    // a table row plus its handlers instead of growth in four switch
+    // functions. Popup/editor precedence (settings_popup_mode_,
+    // live_popup_mode_, quick settings) stays inside the owning page's
+    // handler, next to the state it reads. A null slot means the page
+    // ignores that input. Rows are indexed by Page; kRoutes_ is
+    // static_asserted against Page::Count in the translation unit.
+    struct InputRoute {
+        void (UiController::*rotate)(int delta, uint32_t now_ms) noexcept;
+        void (UiController::*click)(uint32_t now_ms) noexcept;
+        void (UiController::*long_press)(uint32_t now_ms) noexcept;
+        void (UiController::*touch_click)(int16_t x, int16_t y, uint32_t now_ms) noexcept;
+        void (UiController::*touch_drag)(int16_t delta_y, uint32_t now_ms) noexcept;
+    };
+    static const InputRoute kRoutes_[];
+
+    void rotateLanding_(int delta, uint32_t now_ms) noexcept;
+    void rotateSettings_(int delta, uint32_t now_ms) noexcept;
+    void rotateBounds_(int delta, uint32_t now_ms) noexcept;
+    void rotateLive_(int delta, uint32_t now_ms) noexcept;
+    void rotateTerminal_(int delta, uint32_t now_ms) noexcept;
+    void rotateDiagnostics_(int delta, uint32_t now_ms) noexcept;
+    void rotateHistory_(int delta, uint32_t now_ms) noexcept;
+    void rotateTimeline_(int delta, uint32_t now_ms) noexcept;
+    void rotateDashboard_(int delta, uint32_t now_ms) noexcept;
+    void clickLanding_(uint32_t now_ms) noexcept;
+    void clickSettings_(uint32_t now_ms) noexcept;
+    void clickBounds_(uint32_t now_ms) noexcept;
+    void clickLive_(uint32_t now_ms) noexcept;
+    void clickTerminal_(uint32_t now_ms) noexcept;
+    void clickDashboard_(uint32_t now_ms) noexcept;
+    void clickBackToLanding_(uint32_t now_ms) noexcept;
+    void longPressLanding_(uint32_t now_ms) noexcept;
+    void longPressSettings_(uint32_t now_ms) noexcept;
+    void longPressLive_(uint32_t now_ms) noexcept;
+    void longPressDiagnostics_(uint32_t now_ms) noexcept;
+    void longPressFleet_(uint32_t now_ms) noexcept;
+    void touchLanding_(int16_t x, int16_t y, uint32_t now_ms) noexcept;
+    void touchSettings_(int16_t x, int16_t y, uint32_t now_ms) noexcept;
+    void touchBounds_(int16_t x, int16_t y, uint32_t now_ms) noexcept;
+    void touchLive_(int16_t x, int16_t y, uint32_t now_ms) noexcept;
+    void touchTerminal_(int16_t x, int16_t y, uint32_t now_ms) noexcept;
+    void touchDiagnostics_(int16_t x, int16_t y, uint32_t now_ms) noexcept;
+    void touchHistory_(int16_t x, int16_t y, uint32_t now_ms) noexcept;
+    void touchTimeline_(int16_t x, int16_t y, uint32_t now_ms) noexcept;
+    void touchDashboard_(int16_t x, int16_t y, uint32_t now_ms) noexcept;
+    void dragSettings_(int16_t delta_y, uint32_t now_ms) noexcept;
+    void dragTerminal_(int16_t delta_y, uint32_t now_ms) noexcept;
+    void onTouchLongPress_(int16_t x, int16_t y, uint32_t now_ms) noexcept;
     void onTouchDrag_(int16_t delta_y, uint32_t now_ms) noexcept;
+    void serviceTouchInertia_(uint32_t now_ms) noexcept;
     void onSwipe_(int16_t dx, int16_t dy, uint32_t now_ms) noexcept;
 
     void updateBoundsState_(uint32_t now_ms) noexcept;
     void boundsStart_(uint32_t now_ms) noexcept;
     void boundsStop_(uint32_t now_ms) noexcept;
     void boundsResetResult_() noexcept;
+    void boundsOfferCached_(uint32_t now_ms) noexcept;
 
     void nextPage_(int delta) noexcept;
     void enterSettings_() noexcept;
     void settingsBack_() noexcept;
     void settingsSave_(uint32_t now_ms) noexcept;
 
+    static void renderTaskEntry_(void* arg) noexcept;
+    void renderLoop_() noexcept;
+
+    // Async beeper: input paths enqueue a pattern id and return; a tiny
+    // high-priority player task drives M5.Speaker, so tactile-to-audible
+    // latency stays flat regardless of render load and multi-step patterns
+    // never block an input handler. Falls back to playing inline if the
+    // task cannot be created.
+    QueueHandle_t beep_queue_ = nullptr;
+    // Detent feedback entry: runs on the encoder driver task at detent
+    // time (see EC11Encoder::setDetentFeedback) and only enqueues the
+    // tone; feedback latency stays independent of frame time.
+    static void detentFeedbackEntry_(EC11Encoder::Direction direction, void* ctx) noexcept;
+
+    // Emergency stop fast path: holding the encoder button past 1 s fires
+    // a hook in the encoder driver task (see EC11Encoder::setEmergencyHold)
+    // that sends CommandId::Stop straight through the protocol layer's
+    // critical-command path - no Tick, no popup state machine, no frame in
+    // between, so stop latency is bounded by radio time. The target MAC is
+    // mirrored under a spinlock whenever the active unit changes (the
+    // driver task must not touch ui_mutex_); Tick consumes estop_fired_ to
+    // catch the UI up (log line, beep, redraw) after the fact.
+    static void emergencyStopEntry_(void* ctx) noexcept;
+    void publishEstopTarget_() noexcept;
+    portMUX_TYPE estop_mux_ = portMUX_INITIALIZER_UNLOCKED;
+    uint8_t estop_mac_[6] = {};
+    bool estop_target_valid_ = false;
+    std::atomic<uint8_t> estop_fired_{0};  ///< Stops sent, pending UI catch-up
+    static constexpr uint32_t kBeepTaskStack_ = 2048;
+    static constexpr UBaseType_t kBeepTaskPrio_ = 5;
+    static void beepTaskEntry_(void* arg) noexcept;
+    static void playBeepPattern_(int type, bool allow_sleep) noexcept;
+    uint32_t renderPeriodMs_(uint32_t now_ms) const noexcept;
+    uint32_t computeWaitMs_(uint32_t now_ms) const noexcept;
     void draw_(uint32_t now_ms) noexcept;
+    void renderFrame_(uint32_t now_ms) noexcept;
+    void flushFrame_() noexcept;
+    void markDirty_(int16_t x, int16_t y, int16_t w, int16_t h) noexcept;
     void drawHeader_(const char* title) noexcept;
     void drawBackButton_() noexcept;
     void drawConnectionIndicator_(uint32_t now_ms) noexcept;
+    static int signalBars_(int8_t rssi_dbm) noexcept;
     void initCircularMenu_() noexcept;
     void drawCircularLanding_(uint32_t now_ms) noexcept;
     void drawCircularMenuSelector_(uint32_t now_ms) noexcept;
@@ -329,27 +1415,188 @@ private:
     void handleSettingsPopupInput_(int delta, bool click, uint32_t now_ms) noexcept;
     bool settingsHaveChanges_() const noexcept;
     int getSettingsItemCount_() const noexcept;
-    void handleSettingsValueEdit_(int delta) noexcept;
+    void handleSettingsValueEdit_(int delta, uint32_t now_ms) noexcept;
+    int computeEditStepMultiplier_(uint32_t now_ms) noexcept;
     void beginSettingsValueEditor_() noexcept;
     bool settingsEditorHasChange_() const noexcept;
     void applySettingsEditorValue_() noexcept;
     void discardSettingsEditorValue_() noexcept;
+    void beginBoundsTuneEditor_() noexcept;
+    void handleBoundsTuneInput_(int delta, bool click, uint32_t now_ms) noexcept;
+    const char* boundsTuneValidate_() const noexcept;
+    void drawBoundsTuneEditor_(uint32_t now_ms) noexcept;
     void drawBounds_(uint32_t now_ms) noexcept;
     void drawLiveCounter_(uint32_t now_ms) noexcept;
     void drawLivePopup_(uint32_t now_ms) noexcept;
     void handleLivePopupInput_(int delta, bool click, uint32_t now_ms) noexcept;
     void drawTerminal_(uint32_t now_ms) noexcept;
-    
+
+    /**
+     * @brief Draw the link diagnostics page (RTT histogram, delivery counters)
+     * @param now_ms Current time in milliseconds
+     */
+    void drawDiagnostics_(uint32_t now_ms) noexcept;
+
+    /**
+     * @brief Draw the run history page (persisted run_db records)
+     * @param now_ms Current time in milliseconds
+     */
+    void drawHistory_(uint32_t now_ms) noexcept;
+    /// Persist a finished run into run_db when a status transition ends one.
+    void noteRunTransition_(uint8_t prev_state, uint8_t new_state,
+                            const fatigue_proto::StatusPayload& status,
+                            uint32_t now_ms) noexcept;
+    int history_scroll_ = 0;       ///< Records scrolled back from newest
+    bool history_show_audit_ = false;  ///< false = runs, true = config changes
+    bool run_active_ = false;      ///< A run is in progress (Running/Paused)
+    uint32_t run_start_ms_ = 0;    ///< Uptime when the active run started
+
+    /**
+     * @brief Draw the timeline page (rate curve, state bands, event markers)
+     * @param now_ms Current time in milliseconds
+     */
+    void drawTimeline_(uint32_t now_ms) noexcept;
+    /// Close elapsed timeline buckets; called from the housekeeping tick.
+    void serviceTimeline_(uint32_t now_ms) noexcept;
+
+    // Timeline page: the last ~10 minutes of link/run history in fixed
+    // buckets, one bucket per plot column. serviceTimeline_ closes a
+    // bucket every kTimelineBucketMs_; event bits latched between closes
+    // land in the bucket that closes over them. The encoder scrubs a
+    // cursor over the retained columns (timeline_cursor_ counts back
+    // from the newest one).
+    struct TimelineSample {
+        uint16_t rate_cpm;  ///< Cycle rate over the bucket (cycles/min)
+        uint8_t state;      ///< fatigue_proto::TestState, or kTimelineNoLink_
+        uint8_t events;     ///< kTlEv* bits seen during the bucket
+    };
+    static constexpr uint8_t kTimelineNoLink_ = 0xFF;  ///< state: no unit link
+    static constexpr uint8_t kTlEvError_ = 0x01;       ///< error code appeared
+    static constexpr uint8_t kTlEvReconnect_ = 0x02;   ///< link (re)established
+    static constexpr uint8_t kTlEvRunStart_ = 0x04;    ///< run started
+    static constexpr uint8_t kTlEvRunEnd_ = 0x08;      ///< run ended
+    static constexpr size_t kTimelineCapacity_ = 200;    ///< Plot columns retained
+    static constexpr uint32_t kTimelineBucketMs_ = 3000; ///< 200 x 3 s = 10 min
+    /// Sample @p back buckets behind the newest one (0 = newest)
+    const TimelineSample& timelineAt_(size_t back) const noexcept {
+        return timeline_[(timeline_head_ + kTimelineCapacity_ - 1 - back) % kTimelineCapacity_];
+    }
+    TimelineSample timeline_[kTimelineCapacity_] = {};  ///< Bucket ring
+    size_t timeline_head_ = 0;         ///< Next write position
+    size_t timeline_count_ = 0;        ///< Valid buckets in the ring
+    uint32_t timeline_last_ms_ = 0;    ///< When the last bucket closed
+    uint32_t timeline_last_cycle_ = 0; ///< Cycle number at that close
+    bool timeline_have_cycle_ = false; ///< timeline_last_cycle_ is meaningful
+    uint8_t timeline_events_ = 0;      ///< Bits latched since the last close
+    int timeline_cursor_ = 0;          ///< Scrub position, buckets back from newest
+
+    // Multi-resolution cascade: every closed 3 s bucket also folds into
+    // coarser rings (30 s and 5 min buckets) through incremental
+    // accumulators, so the scrubber zooms from the last ten minutes to a
+    // multi-day run with O(visible columns) render cost and ~3 KB total.
+    // Rates average across sub-buckets, the state keeps the most
+    // significant sub-state (errors outrank everything), events OR
+    // together so a marker can never fold away. Coarse tiers retain more
+    // buckets than the plot has columns; timeline_window_ pans the
+    // 200-column view when the cursor scrubs past its left edge.
+    static constexpr size_t kTlCascadeFold_ = 10;  ///< Sub-buckets per coarse bucket
+    static constexpr size_t kTlTier1Cap_ = 200;    ///< 30 s buckets (~100 min)
+    static constexpr size_t kTlTier2Cap_ = 576;    ///< 5 min buckets (48 h)
+    struct TlAccum {
+        uint32_t rate_sum = 0;             ///< Sum of sub-bucket rates
+        uint8_t n = 0;                     ///< Sub-buckets folded so far
+        uint8_t state = kTimelineNoLink_;  ///< Most significant sub-state
+        uint8_t events = 0;                ///< OR of sub-bucket events
+    };
+    TimelineSample tl_tier1_[kTlTier1Cap_] = {};
+    TimelineSample tl_tier2_[kTlTier2Cap_] = {};
+    size_t tl_tier1_head_ = 0;
+    size_t tl_tier1_count_ = 0;
+    size_t tl_tier2_head_ = 0;
+    size_t tl_tier2_count_ = 0;
+    TlAccum tl_acc1_{};
+    TlAccum tl_acc2_{};
+    uint8_t timeline_zoom_ = 0;  ///< 0 = 3 s, 1 = 30 s, 2 = 5 min buckets
+    int timeline_window_ = 0;    ///< Pan: buckets back of newest at the right edge
+    void timelineCascade_(const TimelineSample& s) noexcept;
+    static uint8_t tlDominantState_(uint8_t a, uint8_t b) noexcept;
+    /// Sample @p back buckets behind the newest one at the current zoom
+    const TimelineSample& timelineZoomAt_(size_t back) const noexcept;
+    size_t timelineZoomCount_() const noexcept;
+    uint32_t timelineZoomBucketMs_() const noexcept;
+
+    /**
+     * @brief Draw the fleet page (peer presence table)
+     * @param now_ms Current time in milliseconds
+     */
+    void drawFleet_(uint32_t now_ms) noexcept;
+
+    /**
+     * @brief Draw the dashboard page (one live-status tile per unit)
+     * @param now_ms Current time in milliseconds
+     */
+    void drawDashboard_(uint32_t now_ms) noexcept;
+    /// Mark changed tiles dirty; called from the housekeeping tick.
+    void serviceDashboard_(uint32_t now_ms) noexcept;
+
+    // Dashboard page: a 2x2 tile grid, one tile per fleet slot, each
+    // showing that unit's connection, state and cycle count from the
+    // per-unit tables. Tiles are dirty-tracked individually: the tick
+    // hashes each tile's displayed fields and marks only the changed
+    // tile's rect, so one background unit's status update repaints
+    // roughly a quarter of the screen. Rotation moves the focus ring;
+    // click switches the active unit to the focused tile and drills
+    // into Live Counter.
+    static Rect dashTileRect_(size_t i) noexcept;
+    uint32_t dashTileSignature_(size_t i) const noexcept;
+    int dash_focus_ = 0;                        ///< Tile under the focus ring
+    uint32_t dash_tile_sig_[kMaxUnits_] = {};   ///< Last-marked tile signatures
+
+
     // Quick Settings helpers (long-press during Running/Paused)
     void drawQuickSettings_(uint32_t now_ms) noexcept;
+    void drawQuickSettingsConfirm_(uint32_t now_ms) noexcept;
     void handleQuickSettingsInput_(int delta, bool click, uint32_t now_ms) noexcept;
     void beginQuickSettingsEdit_() noexcept;
     void handleQuickSettingsValueEdit_(int delta) noexcept;
     void applyQuickSettingsValue_(uint32_t now_ms) noexcept;
+    void flushQuickSettings_(uint32_t now_ms) noexcept;
     void discardQuickSettingsValue_() noexcept;
     bool quickEditorHasChange_() const noexcept;
     void cycleQuickSettingsStep_() noexcept;
 
+    // Overlay compositor: while a popup is open, the page beneath it is
+    // frozen into a retained full-screen snapshot (dimmed once at
+    // capture), and each popup frame restores the popup rect from the
+    // snapshot and redraws only the popup. Popup frames used to be the
+    // worst case - full page plus popup - and become proportional to the
+    // popup instead. On snapshot OOM the inline draw paths take over
+    // unchanged.
+    bool overlayActive_() const noexcept;           ///< A compositable popup is open
+    Rect overlayRect_() const noexcept;             ///< Bounds of the open popup
+    bool allocOverlay_() noexcept;                  ///< Allocate the snapshot sprite
+    void finishOverlayCapture_(uint32_t now_ms) noexcept; ///< Dim, snapshot, draw popup
+    void drawOverlayPopup_(uint32_t now_ms) noexcept;     ///< Draw just the popup
+    void dropOverlay_() noexcept;                   ///< Free snapshot, re-arm
+    LGFX_Sprite* overlay_snap_ = nullptr;  ///< Frozen (dimmed) page beneath the popup
+    bool overlay_valid_ = false;           ///< Snapshot matches the open popup
+    bool overlay_failed_ = false;          ///< Snapshot OOM; inline fallback until close
+    bool overlay_capture_ = false;         ///< Page helpers: suppress inline popups
+    Rect overlay_rect_{};                  ///< Popup bounds for compose frames
+
+    // Page-slide transitions: on a page switch the outgoing frame is
+    // snapshotted into a retained sprite and the flush phase slides the
+    // new canvas over it, driven by a compiled keyframe table (easing
+    // pre-sampled and quantized to pixel offsets, nothing computed per
+    // frame). Per keyframe the panel sees one full frame's worth of
+    // clipped sprite pushes, so the cost is bounded and known. On
+    // snapshot OOM (or outside PowerState::Active) the switch stays an
+    // instant cut, exactly as before.
+    bool transitionStart_() noexcept;          ///< Snapshot outgoing page; false on OOM
+    void playTransition_(bool back) noexcept;  ///< Run keyframes, free snapshot
+    LGFX_Sprite* trans_snap_ = nullptr;        ///< Outgoing page during the slide
+    // (shown_page_ lives in the hot block up top.)
+
     // Modern UI helpers
     void drawProgressArc_(int16_t cx, int16_t cy, int16_t r, int16_t thickness,
                           float progress, uint16_t fg_color, uint16_t bg_color) noexcept;
@@ -358,6 +1605,15 @@ private:
     void drawActionButton_(int16_t x, int16_t y, int16_t w, int16_t h,
                            const char* label, bool selected, uint16_t accent_color, bool dark_text) noexcept;
     void drawCenteredText_(int16_t cx, int16_t y, const char* text, uint16_t color, uint8_t size) noexcept;
+    int16_t measureText_(const char* text) noexcept;
+    // Clip-aware text pipeline: formatting deferred behind a band check
+    // against the frame's dirty union, so text entirely outside a partial
+    // frame's clip never formats or rasterizes. Strings live in the frame
+    // arena until the end of the pass.
+    bool bandVisible_(int16_t y, int16_t h) const noexcept;
+    void drawCenteredTextf_(int16_t cx, int16_t y, uint16_t color, uint8_t size,
+                            const char* fmt, ...) noexcept
+        __attribute__((format(printf, 6, 7)));
     
     // Legacy helpers (kept for compatibility)
     void drawRoundedRect_(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color, bool filled) noexcept;
@@ -370,9 +1626,47 @@ private:
     fatigue_proto::StatusPayload last_status_{};
     bool have_remote_config_ = false;
     fatigue_proto::ConfigPayload last_remote_config_{};
-    
+
+    // Config sync: generation last reported by the unit (ConfigResponse v3
+    // or ConfigAck). Saves are diffed against last_remote_config_ and sent
+    // as ConfigDelta while this is known; a reconnect whose ConfigResponse
+    // still carries this generation converges without the edit-discarding
+    // resync. Older unit firmware reports no generation and keeps the
+    // full ConfigSet + blanket resync behavior.
+    uint16_t remote_config_gen_ = 0;
+    bool have_remote_config_gen_ = false;
+
+    // Config verification: CRC32 of the last config push, captured when the
+    // payload is built. A v2 ConfigAck echoes the CRC of the unit's active
+    // config; a match confirms the write in one packet, a mismatch drops the
+    // optimistic baseline and triggers the full re-fetch that used to run
+    // unconditionally on reconnect-style doubts.
+    uint32_t cfg_sent_crc_ = 0;       ///< CRC of the last pushed config
+    bool cfg_sent_crc_valid_ = false; ///< Awaiting ack for cfg_sent_crc_
+    CycleHistory cycle_history_{};  ///< Cycle-rate history for the Live Counter sparkline
+    CycleEstimator cycle_est_{};    ///< EWMA rate/ETA statistics and stall detector
+    // Display-side counter interpolation: between sparse status samples the
+    // big digits advance along the estimator rate from the newest real
+    // sample; each real update re-anchors, snapping prediction error away.
+    uint32_t live_anchor_ms_ = 0;     ///< Local time of the newest real sample
+    uint32_t live_shown_cycle_ = 0;   ///< Interpolated value last published
+    uint32_t predictedCycle_(uint32_t now_ms) const noexcept;
+    bool live_stall_alert_ = false; ///< Rate collapse currently flagged on screen
+    void serviceStallAlert_(uint32_t now_ms) noexcept;
+    static void formatEta_(uint32_t ms, char* out, size_t out_len) noexcept;
+    // Active unit error for the LiveCounter error panel: code plus the tick
+    // it was first reported, so the panel can show how long it has stood.
+    uint8_t live_err_code_ = 0;
+    uint32_t live_err_since_ms_ = 0;
+    void noteErrorCode_(uint8_t err_code, uint32_t now_ms) noexcept;
+
     // Double-buffering canvas (eliminates flickering)
     LGFX_Sprite* canvas_ = nullptr;
+    DrawList draw_list_{};  ///< Per-frame command arena (Settings frames), see draw_list.hpp
+    // Transient scratch for the frame being rendered (formatting buffers,
+    // short-lived temporaries). Reset at the top of renderFrame_, so it is
+    // render-task-only; Tick-side helpers keep their stack buffers.
+    FrameArena frame_arena_{};
     static constexpr int16_t SCREEN_SIZE_ = 240;
     static constexpr int16_t CENTER_X_ = 120;
     static constexpr int16_t CENTER_Y_ = 120;
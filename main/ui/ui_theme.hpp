@@ -67,6 +67,183 @@ namespace colors {
     }
 }
 
+// ============================================================================
+// Theme table
+// ============================================================================
+//
+// Every color the UI draws with lives in one Theme struct. A build selects
+// its table at compile time (define UI_THEME_HIGH_CONTRAST for the bright
+// variant); draw code reads colors through active(), which costs a single
+// pointer load, so a runtime SetTheme() swap restyles the whole UI with no
+// per-draw overhead. Blended variants (pressed buttons, dimmed accents)
+// are computed once by withDerived() at compile time, so draw paths never
+// mix colors per frame.
+
+/**
+ * @brief Alpha-blend two RGB565 colors (constexpr)
+ * @param fg Foreground color
+ * @param bg Background color
+ * @param alpha Foreground weight, 0 (all @p bg) to 255 (all @p fg)
+ * @return Blended RGB565 color
+ */
+constexpr uint16_t blend565(uint16_t fg, uint16_t bg, uint8_t alpha) {
+    const uint32_t fr = (fg >> 11) & 0x1F, fg_g = (fg >> 5) & 0x3F, fb = fg & 0x1F;
+    const uint32_t br = (bg >> 11) & 0x1F, bg_g = (bg >> 5) & 0x3F, bb = bg & 0x1F;
+    const uint32_t r = (fr * alpha + br * (255u - alpha)) / 255u;
+    const uint32_t g = (fg_g * alpha + bg_g * (255u - alpha)) / 255u;
+    const uint32_t b = (fb * alpha + bb * (255u - alpha)) / 255u;
+    return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+/**
+ * @brief Halve each RGB565 channel - a cheap 50% dim toward black
+ * @param c Color to dim
+ * @return Dimmed RGB565 color
+ */
+constexpr uint16_t dim565(uint16_t c) {
+    return static_cast<uint16_t>((c >> 1) & 0x7BEF);
+}
+
+/**
+ * @brief Complete color table for one UI look
+ * @details Base fields mirror the colors:: palette; the sections below
+ *          them name every role that used to be a scattered RGB565
+ *          literal in ui_controller.cpp. Derived fields are filled by
+ *          withDerived() - never set them by hand.
+ */
+struct Theme {
+    // Base surfaces
+    uint16_t bg_primary, bg_secondary, bg_card, bg_elevated;
+    // Text
+    uint16_t text_primary, text_secondary, text_muted, text_hint;
+    // Accents
+    uint16_t accent_blue, accent_green, accent_red, accent_yellow, accent_cyan, accent_orange;
+    // Test states
+    uint16_t state_idle, state_running, state_paused, state_error, state_complete;
+    // Buttons and chrome
+    uint16_t button_bg, button_border, button_active, progress_bg, selector;
+    // Boot screen
+    uint16_t boot_bg, boot_glow_outer, boot_glow_inner, boot_ring_track, boot_ring_fill;
+    // Landing chrome (connection pill, carousel)
+    uint16_t pill_bg, pill_text, pill_border_muted, menu_selector, menu_accent;
+    // Signal bars / charts
+    uint16_t chart_good, chart_warn, chart_bad;
+    // Terminal log
+    uint16_t log_text, log_tx, log_rx, log_err, log_conn, text_watermark, terminal_hint;
+    // Popup chrome
+    uint16_t popup_border;
+    // Derived (withDerived)
+    uint16_t button_pressed;       ///< accent_blue sunk toward the background
+    uint16_t accent_blue_dim, accent_green_dim, accent_red_dim, accent_yellow_dim;
+};
+
+/**
+ * @brief Fill a theme's derived fields from its base colors
+ * @param t Theme with base fields populated
+ * @return The same theme with blended variants computed
+ */
+constexpr Theme withDerived(Theme t) {
+    t.button_pressed = blend565(t.accent_blue, t.bg_primary, 200);
+    t.accent_blue_dim = dim565(t.accent_blue);
+    t.accent_green_dim = dim565(t.accent_green);
+    t.accent_red_dim = dim565(t.accent_red);
+    t.accent_yellow_dim = dim565(t.accent_yellow);
+    return t;
+}
+
+/** @brief The stock dark look (values match the colors:: palette). */
+constexpr Theme makeDarkTheme() {
+    Theme t{};
+    t.bg_primary = colors::bg_primary;
+    t.bg_secondary = colors::bg_secondary;
+    t.bg_card = colors::bg_card;
+    t.bg_elevated = colors::bg_elevated;
+    t.text_primary = colors::text_primary;
+    t.text_secondary = colors::text_secondary;
+    t.text_muted = colors::text_muted;
+    t.text_hint = colors::text_hint;
+    t.accent_blue = colors::accent_blue;
+    t.accent_green = colors::accent_green;
+    t.accent_red = colors::accent_red;
+    t.accent_yellow = colors::accent_yellow;
+    t.accent_cyan = colors::accent_cyan;
+    t.accent_orange = colors::accent_orange;
+    t.state_idle = colors::state_idle;
+    t.state_running = colors::state_running;
+    t.state_paused = colors::state_paused;
+    t.state_error = colors::state_error;
+    t.state_complete = colors::state_complete;
+    t.button_bg = colors::button_bg;
+    t.button_border = colors::button_border;
+    t.button_active = colors::button_active;
+    t.progress_bg = colors::progress_bg;
+    t.selector = colors::selector;
+    t.boot_bg = 0x0005;            // Near-black with a hint of blue
+    t.boot_glow_outer = 0x000A;
+    t.boot_glow_inner = 0x000F;
+    t.boot_ring_track = 0x1084;
+    t.boot_ring_fill = 0x04FF;
+    t.pill_bg = 0x18E3;
+    t.pill_text = 0x9CD3;
+    t.pill_border_muted = 0x8410;
+    t.menu_selector = 0xF3E9;      // Cream/off-white
+    t.menu_accent = 0xFA00;
+    t.chart_good = 0x07E0;
+    t.chart_warn = 0xFE60;
+    t.chart_bad = 0xF800;
+    t.log_text = 0xAD55;
+    t.log_tx = 0x6B9F;
+    t.log_rx = 0x07E0;
+    t.log_err = 0xFB20;
+    t.log_conn = 0x07FF;
+    t.text_watermark = 0x4208;
+    t.terminal_hint = 0x6B9F;
+    t.popup_border = 0x6B9F;
+    return withDerived(t);
+}
+
+/** @brief Brighter text and borders for sunlit cells / low-vision operators. */
+constexpr Theme makeHighContrastTheme() {
+    Theme t = makeDarkTheme();
+    t.text_secondary = 0xDEFB;
+    t.text_muted = 0x9CF3;
+    t.text_hint = 0x6B6D;
+    t.button_border = 0x8C71;
+    t.pill_text = 0xDEFB;
+    t.pill_border_muted = 0xB5B6;
+    t.log_text = 0xDEFB;
+    t.text_watermark = 0x6B6D;
+    return withDerived(t);
+}
+
+inline constexpr Theme kThemeDark = makeDarkTheme();
+inline constexpr Theme kThemeHighContrast = makeHighContrastTheme();
+
+#if defined(UI_THEME_HIGH_CONTRAST)
+inline constexpr const Theme& kThemeDefault = kThemeHighContrast;
+#else
+inline constexpr const Theme& kThemeDefault = kThemeDark;
+#endif
+
+namespace detail {
+inline const Theme* s_active_theme_ = &kThemeDefault;
+}
+
+/**
+ * @brief Currently active theme
+ * @return Reference resolved through one pointer load
+ */
+inline const Theme& active() noexcept { return *detail::s_active_theme_; }
+
+/**
+ * @brief Swap the active theme at runtime
+ * @details Takes effect on each page's next frame; callers should mark the
+ *          UI dirty after swapping. @p t must outlive its use (pass one of
+ *          the constexpr tables above or another static).
+ * @param t Theme to activate
+ */
+inline void SetTheme(const Theme& t) noexcept { detail::s_active_theme_ = &t; }
+
 // ============================================================================
 // Constants
 // ============================================================================
@@ -121,14 +298,14 @@ inline void drawProgressArc(int16_t cx, int16_t cy, int16_t radius, int16_t thic
  */
 inline void drawModernButton(int16_t x, int16_t y, int16_t w, int16_t h,
                              const char* label, bool selected, bool pressed,
-                             uint16_t accent_color = colors::accent_blue) {
-    uint16_t bg = pressed ? accent_color : (selected ? colors::button_active : colors::button_bg);
-    uint16_t border = selected ? accent_color : colors::button_border;
+                             uint16_t accent_color = active().accent_blue) {
+    uint16_t bg = pressed ? accent_color : (selected ? active().button_active : active().button_bg);
+    uint16_t border = selected ? accent_color : active().button_border;
     
     M5.Display.fillSmoothRoundRect(x, y, w, h, h/4, bg);
     M5.Display.drawRoundRect(x, y, w, h, h/4, border);
     
-    M5.Display.setTextColor(colors::text_primary);
+    M5.Display.setTextColor(active().text_primary);
     M5.Display.setTextSize(1);
     const int16_t tw = M5.Display.textWidth(label);
     M5.Display.setCursor(x + (w - tw) / 2, y + (h - 8) / 2);
@@ -139,7 +316,7 @@ inline void drawModernButton(int16_t x, int16_t y, int16_t w, int16_t h,
  * @brief Draw centered text
  */
 inline void drawCenteredText(int16_t cx, int16_t y, const char* text, 
-                             uint16_t color = colors::text_primary, uint8_t size = 1) {
+                             uint16_t color = active().text_primary, uint8_t size = 1) {
     M5.Display.setTextSize(size);
     M5.Display.setTextColor(color);
     const int16_t tw = M5.Display.textWidth(text);
@@ -157,10 +334,10 @@ inline void drawCircularBackButton(bool focused = false) {
     
     // Draw arc segment in top-left
     M5.Display.fillArc(cx, cy, r + 10, r - 10, 0, 90, 
-                       focused ? colors::accent_blue : colors::bg_elevated);
+                       focused ? active().accent_blue : active().bg_elevated);
     
     // Back arrow icon (simple <)
-    M5.Display.setTextColor(colors::text_primary);
+    M5.Display.setTextColor(active().text_primary);
     M5.Display.setTextSize(2);
     M5.Display.setCursor(12, 12);
     M5.Display.print("<");
@@ -172,7 +349,7 @@ inline void drawCircularBackButton(bool focused = false) {
 inline void drawConnectionDot(int16_t x, int16_t y, bool connected, uint32_t now_ms) {
     uint16_t color;
     if (connected) {
-        color = colors::accent_green;
+        color = active().accent_green;
     } else {
         // Pulsing animation
         const float pulse = 0.5f + 0.5f * std::sin(static_cast<float>(now_ms) * 0.006f);
@@ -181,7 +358,7 @@ inline void drawConnectionDot(int16_t x, int16_t y, bool connected, uint32_t now
     }
     
     M5.Display.fillSmoothCircle(x, y, 6, color);
-    M5.Display.drawCircle(x, y, 7, colors::text_secondary);
+    M5.Display.drawCircle(x, y, 7, active().text_secondary);
 }
 
 /**
@@ -189,8 +366,8 @@ inline void drawConnectionDot(int16_t x, int16_t y, bool connected, uint32_t now
  */
 inline void drawCircularVignette() {
     // Draw subtle ring at edge to emphasize circular display
-    M5.Display.drawCircle(CENTER_X, CENTER_Y, 118, colors::bg_secondary);
-    M5.Display.drawCircle(CENTER_X, CENTER_Y, 119, colors::text_hint);
+    M5.Display.drawCircle(CENTER_X, CENTER_Y, 118, active().bg_secondary);
+    M5.Display.drawCircle(CENTER_X, CENTER_Y, 119, active().text_hint);
 }
 
 /**
@@ -201,22 +378,22 @@ inline void drawValueArc(int16_t cx, int16_t cy, int16_t r,
                          const char* label, const char* unit,
                          uint16_t color) {
     // Background arc
-    drawProgressArc(cx, cy, r, 12, 0.0f, colors::bg_secondary, colors::progress_bg);
+    drawProgressArc(cx, cy, r, 12, 0.0f, active().bg_secondary, active().progress_bg);
     
     // Value arc
     const float progress = std::min(1.0f, value / max_val);
-    drawProgressArc(cx, cy, r, 12, progress, color, colors::progress_bg);
+    drawProgressArc(cx, cy, r, 12, progress, color, active().progress_bg);
     
     // Center value
     char buf[16];
     snprintf(buf, sizeof(buf), "%.0f", static_cast<double>(value));
-    drawCenteredText(cx, cy - 20, buf, colors::text_primary, 3);
+    drawCenteredText(cx, cy - 20, buf, active().text_primary, 3);
     
     // Unit
-    drawCenteredText(cx, cy + 10, unit, colors::text_muted, 1);
+    drawCenteredText(cx, cy + 10, unit, active().text_muted, 1);
     
     // Label at bottom
-    drawCenteredText(cx, cy + r + 15, label, colors::text_secondary, 1);
+    drawCenteredText(cx, cy + r + 15, label, active().text_secondary, 1);
 }
 
 } // namespace theme
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""Diff two captured benchmark reports from the bench firmware.
+
+The bench app (APP_TYPE "bench", main/bench_main.cpp) prints lines like
+
+    BENCH name=crc16_ccitt iters=2000 total_us=48120 per_us=24 bytes_per_s=...
+
+between BENCH-REPORT-BEGIN/END markers. Capture the serial output of a
+baseline run and a candidate run to files, then:
+
+    scripts/bench_diff.py baseline.log candidate.log [--threshold PCT]
+
+Exit status is 1 if any benchmark regressed by more than the threshold
+(default 5%), so the diff can gate a release script.
+"""
+
+import argparse
+import re
+import sys
+
+LINE_RE = re.compile(r"^BENCH\s+(.*)$")
+
+
+def parse_report(path):
+    """Return {bench name: {key: int}} for the first report in the file."""
+    results = {}
+    in_report = False
+    with open(path, "r", errors="replace") as f:
+        for line in f:
+            line = line.strip()
+            if line.startswith("BENCH-REPORT-BEGIN"):
+                in_report = True
+                continue
+            if line.startswith("BENCH-REPORT-END"):
+                break
+            if not in_report:
+                continue
+            m = LINE_RE.match(line)
+            if not m:
+                continue
+            fields = {}
+            for token in m.group(1).split():
+                if "=" not in token:
+                    continue
+                key, _, value = token.partition("=")
+                try:
+                    fields[key] = int(value)
+                except ValueError:
+                    fields[key] = value
+            name = fields.pop("name", None)
+            if name:
+                results[name] = fields
+    if not results:
+        sys.exit(f"error: no benchmark report found in {path}")
+    return results
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("baseline", help="serial capture of the baseline run")
+    ap.add_argument("candidate", help="serial capture of the candidate run")
+    ap.add_argument("--threshold", type=float, default=5.0,
+                    help="regression threshold in percent (default: 5)")
+    args = ap.parse_args()
+
+    base = parse_report(args.baseline)
+    cand = parse_report(args.candidate)
+
+    names = sorted(set(base) | set(cand))
+    width = max(len(n) for n in names)
+    regressed = []
+
+    print(f"{'benchmark':<{width}}  {'base us/op':>10}  {'cand us/op':>10}  {'delta':>8}")
+    for name in names:
+        b = base.get(name)
+        c = cand.get(name)
+        if b is None or c is None:
+            missing = "baseline" if b is None else "candidate"
+            print(f"{name:<{width}}  {'-':>10}  {'-':>10}  missing in {missing}")
+            continue
+        b_us = b.get("per_us", 0)
+        c_us = c.get("per_us", 0)
+        if b_us == 0:
+            delta = "n/a"
+        else:
+            pct = (c_us - b_us) * 100.0 / b_us
+            delta = f"{pct:+6.1f}%"
+            if pct > args.threshold:
+                delta += " REGRESSED"
+                regressed.append(name)
+        print(f"{name:<{width}}  {b_us:>10}  {c_us:>10}  {delta:>8}")
+
+    if regressed:
+        print(f"\n{len(regressed)} benchmark(s) regressed beyond "
+              f"{args.threshold:.1f}%: {', '.join(regressed)}")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
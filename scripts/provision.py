@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+"""Export or import remote-controller configuration over the USB console.
+
+The firmware's provisioning listener (main/provisioning.cpp) speaks 0x00
+delimited COBS frames carrying Settings plus SecuritySettings with a
+CRC16-CCITT trailer. This script drives it:
+
+    scripts/provision.py export /dev/ttyACM0 --out remote.cfg
+    scripts/provision.py import /dev/ttyACM0 remote.cfg
+
+Export saves the device's configuration blob to a file; import pushes a
+previously exported blob back (the device reboots to apply it). Log
+output on the same port is harmless - only frames that COBS-decode and
+pass the CRC are trusted. Requires pyserial.
+"""
+
+import argparse
+import sys
+
+try:
+    import serial
+except ImportError:
+    sys.exit("error: pyserial is required (pip install pyserial)")
+
+PROTO_VERSION = 1
+
+CMD_EXPORT_REQ = 0x01
+CMD_IMPORT = 0x02
+CMD_EXPORT_DATA = 0x81
+CMD_STATUS = 0x82
+
+STATUS_TEXT = {
+    0: "ok",
+    1: "firmware speaks a different protocol version",
+    2: "configuration size mismatch (different firmware revision?)",
+    3: "malformed request",
+}
+
+
+def crc16_ccitt(data):
+    """CRC16-CCITT, poly 0x1021, init 0xFFFF (matches espnow::crc16_ccitt)."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            if crc & 0x8000:
+                crc = ((crc << 1) ^ 0x1021) & 0xFFFF
+            else:
+                crc = (crc << 1) & 0xFFFF
+    return crc
+
+
+def cobs_encode(data):
+    out = bytearray()
+    idx = 0
+    while idx <= len(data):
+        block = data[idx:idx + 254]
+        zero = block.find(b"\x00")
+        if zero < 0:
+            out.append(len(block) + 1)
+            out += block
+            idx += len(block)
+            if len(block) < 254:
+                break
+        else:
+            out.append(zero + 1)
+            out += block[:zero]
+            idx += zero + 1
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data) + 1:
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def send_frame(port, cmd, body=b""):
+    payload = bytes([ord("P"), ord("V"), PROTO_VERSION, cmd]) + body
+    payload += crc16_ccitt(payload).to_bytes(2, "little")
+    port.write(b"\x00" + cobs_encode(payload) + b"\x00")
+    port.flush()
+
+
+def read_frame(port, timeout_s):
+    """Return (cmd, body) of the next valid frame, or None on timeout."""
+    port.timeout = 0.2
+    deadline = timeout_s
+    buf = bytearray()
+    while deadline > 0:
+        chunk = port.read(256)
+        if not chunk:
+            deadline -= 0.2
+            continue
+        buf += chunk
+        while b"\x00" in buf:
+            segment, _, rest = bytes(buf).partition(b"\x00")
+            buf = bytearray(rest)
+            if not segment:
+                continue
+            payload = cobs_decode(segment)
+            if payload is None or len(payload) < 6:
+                continue
+            if payload[:2] != b"PV":
+                continue
+            if crc16_ccitt(payload[:-2]) != int.from_bytes(payload[-2:], "little"):
+                continue
+            return payload[3], payload[4:-2]
+    return None
+
+
+def do_export(port, args):
+    send_frame(port, CMD_EXPORT_REQ)
+    frame = read_frame(port, timeout_s=5.0)
+    if frame is None:
+        sys.exit("error: no response from device (is the firmware running?)")
+    cmd, body = frame
+    if cmd != CMD_EXPORT_DATA:
+        sys.exit(f"error: unexpected response 0x{cmd:02X}")
+    slen = int.from_bytes(body[0:2], "little")
+    qlen = int.from_bytes(body[2:4], "little")
+    if len(body) != 4 + slen + qlen:
+        sys.exit("error: export body length inconsistent")
+    with open(args.out, "wb") as f:
+        f.write(body)
+    print(f"exported {slen} settings + {qlen} security bytes to {args.out}")
+
+
+def do_import(port, args):
+    with open(args.file, "rb") as f:
+        body = f.read()
+    if len(body) < 4:
+        sys.exit(f"error: {args.file} is not an exported configuration")
+    send_frame(port, CMD_IMPORT, body)
+    frame = read_frame(port, timeout_s=10.0)
+    if frame is None:
+        sys.exit("error: no response from device")
+    cmd, status = frame
+    if cmd != CMD_STATUS or not status:
+        sys.exit(f"error: unexpected response 0x{cmd:02X}")
+    if status[0] != 0:
+        sys.exit(f"error: import failed: "
+                 f"{STATUS_TEXT.get(status[0], f'status {status[0]}')}")
+    print("imported; device is rebooting to apply the configuration")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("command", choices=["export", "import"])
+    ap.add_argument("port", help="serial port, e.g. /dev/ttyACM0")
+    ap.add_argument("file", nargs="?",
+                    help="configuration file to import (import only)")
+    ap.add_argument("--out", default="remote.cfg",
+                    help="output file for export (default: remote.cfg)")
+    ap.add_argument("--baud", type=int, default=115200)
+    args = ap.parse_args()
+
+    with serial.Serial(args.port, args.baud) as port:
+        if args.command == "export":
+            do_export(port, args)
+        else:
+            if not args.file:
+                ap.error("import requires a configuration file")
+            do_import(port, args)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,296 @@
+#!/usr/bin/env python3
+"""Collect the remote-controller fleet telemetry stream over USB serial.
+
+The firmware's telemetry bridge (main/telemetry_bridge.cpp) streams 0x00
+delimited COBS frames with a 'TB' magic and CRC16-CCITT trailer: per-unit
+status samples, finished run records and 1 Hz link statistics. This script
+arms the stream through the provisioning listener, then appends records to
+per-unit CSV files (status_<mac>.csv, runs.csv, link.csv) or a single
+SQLite database:
+
+    scripts/telemetry_collect.py /dev/ttyACM0 --out-dir telemetry/
+    scripts/telemetry_collect.py /dev/ttyACM0 --sqlite plant.db
+
+Log output and provisioning frames on the same port are harmless - only
+frames that COBS-decode, carry the TB magic and pass the CRC are trusted.
+Stop with Ctrl-C (the stream is disarmed on exit). Requires pyserial.
+"""
+
+import argparse
+import csv
+import datetime
+import os
+import sqlite3
+import struct
+import sys
+
+try:
+    import serial
+except ImportError:
+    sys.exit("error: pyserial is required (pip install pyserial)")
+
+PROTO_VERSION = 1
+
+# Provisioning frame (PV magic) used only to arm/disarm the bridge.
+PV_CMD_BRIDGE = 0x06
+
+# Bridge record types (TB magic).
+REC_HELLO = 0x01
+REC_STATUS = 0x02
+REC_RUN = 0x03
+REC_LINK = 0x04
+
+STATE_NAMES = {0: "idle", 1: "running", 2: "paused", 3: "completed", 4: "error"}
+
+# Matches run_db::RunRecord (40-byte flash format).
+RUN_STRUCT = struct.Struct("<IIIIIfHBBBBBB7sB")
+
+
+def crc16_ccitt(data):
+    """CRC16-CCITT, poly 0x1021, init 0xFFFF (matches espnow::crc16_ccitt)."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            if crc & 0x8000:
+                crc = ((crc << 1) ^ 0x1021) & 0xFFFF
+            else:
+                crc = (crc << 1) & 0xFFFF
+    return crc
+
+
+def cobs_encode(data):
+    out = bytearray()
+    idx = 0
+    while idx <= len(data):
+        block = data[idx:idx + 254]
+        zero = block.find(b"\x00")
+        if zero < 0:
+            out.append(len(block) + 1)
+            out += block
+            idx += len(block)
+            if len(block) < 254:
+                break
+        else:
+            out.append(zero + 1)
+            out += block[:zero]
+            idx += zero + 1
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data) + 1:
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def send_bridge_cmd(port, armed):
+    payload = bytes([ord("P"), ord("V"), PROTO_VERSION, PV_CMD_BRIDGE,
+                     1 if armed else 0])
+    payload += crc16_ccitt(payload).to_bytes(2, "little")
+    port.write(b"\x00" + cobs_encode(payload) + b"\x00")
+    port.flush()
+
+
+class CsvSink:
+    """One CSV per unit for status, shared files for runs and link stats."""
+
+    def __init__(self, out_dir):
+        os.makedirs(out_dir, exist_ok=True)
+        self.out_dir = out_dir
+        self.status_files = {}
+        self.runs = self._open("runs.csv",
+                               ["host_time", "seq", "start_ms", "duration_ms",
+                                "cycles_done", "cycle_target", "vmax_rpm",
+                                "dwell_ms", "mac_suffix", "state", "err_code"])
+        self.link = self._open("link.csv",
+                               ["host_time", "device_ms", "sent", "acked", "lost",
+                                "retransmits", "duplicates", "shed", "channel",
+                                "bridge_dropped"])
+
+    def _open(self, name, header):
+        path = os.path.join(self.out_dir, name)
+        fresh = not os.path.exists(path) or os.path.getsize(path) == 0
+        f = open(path, "a", newline="")
+        w = csv.writer(f)
+        if fresh:
+            w.writerow(header)
+        return (f, w)
+
+    def status(self, when, mac, device_ms, cycle, state, err):
+        if mac not in self.status_files:
+            self.status_files[mac] = self._open(
+                f"status_{mac}.csv",
+                ["host_time", "device_ms", "cycle", "state", "err_code"])
+        f, w = self.status_files[mac]
+        w.writerow([when, device_ms, cycle,
+                    STATE_NAMES.get(state, state), err])
+        f.flush()
+
+    def run(self, when, rec):
+        f, w = self.runs
+        w.writerow([when, rec["seq"], rec["start_ms"], rec["duration_ms"],
+                    rec["cycles_done"], rec["cycle_target"],
+                    f"{rec['vmax_rpm']:.2f}", rec["dwell_ms"],
+                    rec["mac_suffix"],
+                    STATE_NAMES.get(rec["state"], rec["state"]),
+                    rec["err_code"]])
+        f.flush()
+
+    def link_sample(self, when, fields):
+        f, w = self.link
+        w.writerow([when] + fields)
+        f.flush()
+
+    def close(self):
+        for f, _ in self.status_files.values():
+            f.close()
+        self.runs[0].close()
+        self.link[0].close()
+
+
+class SqliteSink:
+    """All record types in one database, unit identity as a column."""
+
+    def __init__(self, path):
+        self.db = sqlite3.connect(path)
+        self.db.executescript("""
+            CREATE TABLE IF NOT EXISTS status (
+                host_time TEXT, mac TEXT, device_ms INTEGER,
+                cycle INTEGER, state TEXT, err_code INTEGER);
+            CREATE TABLE IF NOT EXISTS runs (
+                host_time TEXT, seq INTEGER, start_ms INTEGER,
+                duration_ms INTEGER, cycles_done INTEGER,
+                cycle_target INTEGER, vmax_rpm REAL, dwell_ms INTEGER,
+                mac_suffix TEXT, state TEXT, err_code INTEGER);
+            CREATE TABLE IF NOT EXISTS link (
+                host_time TEXT, device_ms INTEGER, sent INTEGER,
+                acked INTEGER, lost INTEGER, retransmits INTEGER,
+                duplicates INTEGER, shed INTEGER, channel INTEGER,
+                bridge_dropped INTEGER);
+        """)
+
+    def status(self, when, mac, device_ms, cycle, state, err):
+        self.db.execute("INSERT INTO status VALUES (?,?,?,?,?,?)",
+                        (when, mac, device_ms, cycle,
+                         STATE_NAMES.get(state, str(state)), err))
+        self.db.commit()
+
+    def run(self, when, rec):
+        self.db.execute(
+            "INSERT INTO runs VALUES (?,?,?,?,?,?,?,?,?,?,?)",
+            (when, rec["seq"], rec["start_ms"], rec["duration_ms"],
+             rec["cycles_done"], rec["cycle_target"], rec["vmax_rpm"],
+             rec["dwell_ms"], rec["mac_suffix"],
+             STATE_NAMES.get(rec["state"], str(rec["state"])),
+             rec["err_code"]))
+        self.db.commit()
+
+    def link_sample(self, when, fields):
+        self.db.execute("INSERT INTO link VALUES (?,?,?,?,?,?,?,?,?,?)",
+                        tuple([when] + fields))
+        self.db.commit()
+
+    def close(self):
+        self.db.close()
+
+
+def parse_run(body):
+    if len(body) != RUN_STRUCT.size:
+        return None
+    (seq, start_ms, duration_ms, cycles_done, cycle_target, vmax_rpm,
+     dwell_ms, mac4, mac5, state, err_code, _bounds, _badge_len, _badge,
+     _res) = RUN_STRUCT.unpack(body)
+    return {
+        "seq": seq, "start_ms": start_ms, "duration_ms": duration_ms,
+        "cycles_done": cycles_done, "cycle_target": cycle_target,
+        "vmax_rpm": vmax_rpm, "dwell_ms": dwell_ms,
+        "mac_suffix": f"{mac4:02x}{mac5:02x}",
+        "state": state, "err_code": err_code,
+    }
+
+
+def handle_record(sink, rec_type, body):
+    when = datetime.datetime.now().isoformat(timespec="seconds")
+    if rec_type == REC_HELLO and len(body) >= 5:
+        device_ms = int.from_bytes(body[0:4], "little")
+        print(f"stream armed (device uptime {device_ms / 1000:.0f}s, "
+              f"bridge v{body[4]})")
+    elif rec_type == REC_STATUS and len(body) == 16:
+        device_ms = int.from_bytes(body[0:4], "little")
+        mac = body[4:10].hex()
+        cycle = int.from_bytes(body[10:14], "little")
+        sink.status(when, mac, device_ms, cycle, body[14], body[15])
+    elif rec_type == REC_RUN:
+        rec = parse_run(body)
+        if rec is not None:
+            sink.run(when, rec)
+            print(f"run #{rec['seq']}: {rec['cycles_done']} cycles "
+                  f"({STATE_NAMES.get(rec['state'], rec['state'])})")
+    elif rec_type == REC_LINK and len(body) == 33:
+        device_ms = int.from_bytes(body[0:4], "little")
+        words = [int.from_bytes(body[4 + i * 4:8 + i * 4], "little")
+                 for i in range(6)]
+        channel = body[28]
+        dropped = int.from_bytes(body[29:33], "little")
+        sink.link_sample(when, [device_ms] + words + [channel, dropped])
+
+
+def collect(port, sink):
+    buf = bytearray()
+    count = 0
+    while True:
+        chunk = port.read(512)
+        if not chunk:
+            continue
+        buf += chunk
+        while b"\x00" in buf:
+            segment, _, rest = bytes(buf).partition(b"\x00")
+            buf = bytearray(rest)
+            if not segment:
+                continue
+            payload = cobs_decode(segment)
+            if payload is None or len(payload) < 6:
+                continue
+            if payload[:2] != b"TB" or payload[2] != PROTO_VERSION:
+                continue
+            if crc16_ccitt(payload[:-2]) != int.from_bytes(payload[-2:], "little"):
+                continue
+            handle_record(sink, payload[3], payload[4:-2])
+            count += 1
+            if count % 100 == 0:
+                print(f"{count} records collected", file=sys.stderr)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("port", help="serial port, e.g. /dev/ttyACM0")
+    ap.add_argument("--baud", type=int, default=115200)
+    out = ap.add_mutually_exclusive_group()
+    out.add_argument("--out-dir", default="telemetry",
+                     help="directory for per-unit CSV files (default: telemetry/)")
+    out.add_argument("--sqlite", help="write everything to this SQLite database")
+    args = ap.parse_args()
+
+    sink = SqliteSink(args.sqlite) if args.sqlite else CsvSink(args.out_dir)
+    with serial.Serial(args.port, args.baud, timeout=0.2) as port:
+        send_bridge_cmd(port, True)
+        try:
+            collect(port, sink)
+        except KeyboardInterrupt:
+            print("\ndisarming stream")
+            send_bridge_cmd(port, False)
+        finally:
+            sink.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Convert a captured trace dump to Chrome trace JSON.
+
+Firmware built with -DTRACE_ENABLED=1 prints, on trace::Dump(), a block
+between TRACE-BEGIN/END markers:
+
+    N <id> <name>                         name registry
+    E <phase> <id> <core> <ts_us> [corr]  one record, phase is B/E/i
+
+Capture the serial output to a file, then:
+
+    scripts/trace_to_chrome.py capture.log -o trace.json
+
+Load trace.json in chrome://tracing or https://ui.perfetto.dev. Cores
+become threads, so cross-core causality (proto event on core 1 waking a
+redraw on core 0) lines up on one timeline. Records carrying a nonzero
+correlation id (allocated at the originating input or received packet)
+get it as a slice argument plus Chrome flow arrows, so one detent's
+detent -> state change -> send -> redraw chain reads as a single
+connected path. The on-device timestamp is a truncated 32-bit
+microsecond counter; wraps (every ~71 min) are unwrapped here assuming
+records are dumped oldest-first. Dumps from older firmware without the
+correlation column still convert.
+"""
+
+import argparse
+import json
+import sys
+
+
+def parse_dump(path):
+    """Return (names {id: str}, events [(phase, id, core, ts_us, corr)])."""
+    names = {}
+    events = []
+    in_dump = False
+    with open(path, "r", errors="replace") as f:
+        for line in f:
+            line = line.strip()
+            if line.startswith("TRACE-BEGIN"):
+                in_dump = True
+                names.clear()
+                events.clear()  # keep only the last dump in the capture
+                continue
+            if line.startswith("TRACE-END"):
+                in_dump = False
+                continue
+            if not in_dump:
+                continue
+            parts = line.split(None, 2)
+            if parts and parts[0] == "N" and len(parts) == 3:
+                names[int(parts[1])] = parts[2]
+            elif parts and parts[0] == "E":
+                fields = line.split()
+                if len(fields) in (5, 6):
+                    phase, scope_id, core, ts = (fields[1], int(fields[2]),
+                                                 int(fields[3]), int(fields[4]))
+                    corr = int(fields[5]) if len(fields) == 6 else 0
+                    events.append((phase, scope_id, core, ts, corr))
+    if not events:
+        sys.exit(f"error: no trace dump found in {path}")
+    return names, events
+
+
+def unwrap(events):
+    """Undo 32-bit timestamp wraps, assuming oldest-first order."""
+    out = []
+    offset = 0
+    prev = None
+    for phase, scope_id, core, ts, corr in events:
+        if prev is not None and ts < prev:
+            offset += 1 << 32
+        prev = ts
+        out.append((phase, scope_id, core, ts + offset, corr))
+    return out
+
+
+def to_chrome(names, events):
+    """Build the Chrome trace event list (phase i maps to an instant).
+
+    Correlated records additionally emit flow events: the first slice seen
+    for a correlation id starts the flow, each later slice is a step, so
+    the viewer draws arrows along the whole causality chain.
+    """
+    trace = []
+    flows_started = set()
+    for phase, scope_id, core, ts, corr in events:
+        name = names.get(scope_id, f"id{scope_id}")
+        ev = {"name": name, "ph": phase, "ts": ts, "pid": 0, "tid": core}
+        if phase == "i":
+            ev["s"] = "t"  # thread-scoped instant
+        if corr:
+            ev["args"] = {"corr": corr}
+        trace.append(ev)
+        if corr and phase == "B":
+            flow_ph = "t" if corr in flows_started else "s"
+            flows_started.add(corr)
+            trace.append({"name": "chain", "cat": "corr", "ph": flow_ph,
+                          "id": corr, "ts": ts, "pid": 0, "tid": core})
+    for core in sorted({e[2] for e in events}):
+        trace.append({"name": "thread_name", "ph": "M", "pid": 0, "tid": core,
+                      "args": {"name": f"core{core}"}})
+    return trace
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("capture", help="serial capture containing a trace dump")
+    ap.add_argument("-o", "--output", default="trace.json",
+                    help="output file (default: trace.json)")
+    args = ap.parse_args()
+
+    names, events = parse_dump(args.capture)
+    trace = to_chrome(names, unwrap(events))
+    with open(args.output, "w") as f:
+        json.dump({"traceEvents": trace}, f)
+    print(f"{len(events)} events, {len(names)} scopes -> {args.output}")
+
+
+if __name__ == "__main__":
+    main()
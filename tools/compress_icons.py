@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""
+Compress raw RGB565 icon headers into palettized + RLE form.
+
+Takes a header produced by generate_menu_icons.py / generate_circular_icons.py
+(raw `static const uint16_t NAME[N]` arrays) and rewrites each icon as:
+
+  - a per-icon RGB565 palette (<= 256 entries)
+  - a run-length encoded stream of (run_length, palette_index) byte pairs
+  - a `CompressedIcon` descriptor consumed by ui::assets::drawCompressedIcon()
+    (see main/ui/assets/icon_codec.hpp)
+
+Everything else in the input header (size constants, color tables, comments)
+is preserved verbatim, so the pipeline stays:
+
+    python generate_circular_icons.py > raw.hpp
+    python compress_icons.py raw.hpp > ../main/ui/assets/circular_icons.hpp
+
+Compression stats are printed to stderr.
+"""
+
+import re
+import sys
+
+MAX_RUN = 255
+VALUES_PER_LINE = 16
+
+
+def rle_encode(pixels, palette_index):
+    """Encode pixels as (run_length, palette_index) byte pairs."""
+    stream = []
+    i = 0
+    n = len(pixels)
+    while i < n:
+        color = pixels[i]
+        run = 1
+        while i + run < n and pixels[i + run] == color and run < MAX_RUN:
+            run += 1
+        stream.append(run)
+        stream.append(palette_index[color])
+        i += run
+    return stream
+
+
+def format_values(values, fmt, indent="  "):
+    lines = []
+    for i in range(0, len(values), VALUES_PER_LINE):
+        chunk = values[i:i + VALUES_PER_LINE]
+        lines.append(indent + ", ".join(fmt % v for v in chunk) + ",")
+    # Drop the trailing comma on the last line for consistency with the
+    # generators' output style.
+    if lines:
+        lines[-1] = lines[-1].rstrip(",")
+    return "\n".join(lines)
+
+
+def compress_array(match):
+    name = match.group("name")
+    count = int(match.group("count"))
+    body = match.group("body")
+
+    pixels = [int(x, 16) for x in re.findall(r"0x[0-9A-Fa-f]+", body)]
+    if len(pixels) != count:
+        sys.exit(f"error: {name}: expected {count} pixels, found {len(pixels)}")
+
+    # Palette in first-appearance order; index 0 is whatever color the icon
+    # starts with (usually the transparent background).
+    palette = []
+    palette_index = {}
+    for color in pixels:
+        if color not in palette_index:
+            palette_index[color] = len(palette)
+            palette.append(color)
+    if len(palette) > 256:
+        sys.exit(f"error: {name}: {len(palette)} colors exceed 8-bit palette")
+
+    stream = rle_encode(pixels, palette_index)
+
+    raw_bytes = count * 2
+    packed_bytes = len(palette) * 2 + len(stream)
+    print(f"{name}: {raw_bytes} -> {packed_bytes} bytes "
+          f"({raw_bytes / packed_bytes:.1f}x, {len(palette)} colors, "
+          f"{len(stream) // 2} runs)", file=sys.stderr)
+
+    # Width is needed for the descriptor; the _W constant precedes the array.
+    w = int(match.group("w"))
+    h = count // w
+
+    out = []
+    out.append(f"static constexpr uint16_t {name}_Palette[{len(palette)}] = {{")
+    out.append(format_values(palette, "0x%04X"))
+    out.append("};")
+    out.append(f"static constexpr uint8_t {name}_Rle[{len(stream)}] = {{")
+    out.append(format_values(stream, "%d"))
+    out.append("};")
+    out.append(f"static constexpr CompressedIcon {name}{{{w}, {h}, "
+               f"{name}_Palette, {len(palette)}, {name}_Rle, {len(stream)}}};")
+    return match.group("prefix") + "\n".join(out)
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(f"usage: {sys.argv[0]} <raw_icon_header.hpp> > <compressed.hpp>")
+
+    src = open(sys.argv[1]).read()
+
+    # Replace each raw pixel array (and keep its _W/_H/_Color companions).
+    pattern = re.compile(
+        r"(?P<prefix>static constexpr int (?P<name>\w+)_W = (?P<w>\d+);\n"
+        r"static constexpr int (?P=name)_H = \d+;\n"
+        r"(?:static constexpr uint16_t (?P=name)_Color = 0x[0-9A-Fa-f]+;\n)?)"
+        r"static const uint16_t (?P=name)\[(?P<count>\d+)\] = \{(?P<body>.*?)\};",
+        re.S)
+
+    out, n = pattern.subn(compress_array, src)
+    if n == 0:
+        sys.exit("error: no raw icon arrays found in input")
+
+    # The descriptors need the codec types.
+    out = out.replace("#include <cstdint>",
+                      '#include <cstdint>\n\n#include "icon_codec.hpp"', 1)
+
+    sys.stdout.write(out)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,363 @@
+#!/usr/bin/env python3
+"""Convert an arbitrary image into the palettized + RLE asset format.
+
+No external dependencies (no Pillow): PNG (8-bit gray/RGB/palette, with
+alpha), BMP (24/32-bit uncompressed) and PPM/PGM are decoded with the
+stdlib. Convert anything else (JPEG, SVG, ...) to PNG first.
+
+The output is a header in the same shape compress_icons.py emits - an
+RGB565 palette, an (run_length, palette_index) RLE stream and a
+`CompressedIcon` descriptor - so branding assets share the existing
+decoder (main/ui/assets/icon_codec.hpp) and cost a run-walk at draw time
+instead of a runtime PNG decoder and its hundreds of ms at boot.
+
+Pixels with alpha below 128 become the chroma key (opaque pixels that
+collide with the key are nudged by one blue LSB). More than 256 distinct
+RGB565 colors are median-cut quantized down to 256.
+
+A flash budget is enforced at convert time so an oversized asset fails
+the build instead of quietly growing the image:
+
+    tools/convert_image.py logo.png --name kLogo_boot \\
+        --budget-bytes 8192 > main/ui/assets/boot_logo.hpp
+"""
+
+from __future__ import annotations
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+MAX_RUN = 255
+VALUES_PER_LINE = 16
+
+
+# ---------------------------------------------------------------------------
+# Decoders: each returns (width, height, pixels) with pixels as a flat list
+# of (r, g, b, a) tuples, 8 bits per channel.
+# ---------------------------------------------------------------------------
+
+def decode_png(data):
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        return None
+    pos = 8
+    width = height = bit_depth = color_type = interlace = None
+    palette = []
+    trns = b""
+    idat = bytearray()
+    while pos + 8 <= len(data):
+        length, ctype = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b"IHDR":
+            width, height, bit_depth, color_type, _, _, interlace = \
+                struct.unpack(">IIBBBBB", chunk)
+        elif ctype == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif ctype == b"tRNS":
+            trns = chunk
+        elif ctype == b"IDAT":
+            idat += chunk
+        elif ctype == b"IEND":
+            break
+    if width is None:
+        sys.exit("error: PNG missing IHDR")
+    if bit_depth != 8:
+        sys.exit(f"error: only 8-bit PNG supported (got {bit_depth}-bit)")
+    if interlace != 0:
+        sys.exit("error: interlaced PNG not supported (re-save without Adam7)")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(color_type)
+    if channels is None:
+        sys.exit(f"error: unsupported PNG color type {color_type}")
+
+    raw = zlib.decompress(bytes(idat))
+    stride = width * channels
+    out = bytearray(height * stride)
+    prev = bytearray(stride)
+    pos = 0
+    for y in range(height):
+        filt = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for x in range(stride):
+            a = line[x - channels] if x >= channels else 0
+            b = prev[x]
+            if filt == 1:
+                line[x] = (line[x] + a) & 0xFF
+            elif filt == 2:
+                line[x] = (line[x] + b) & 0xFF
+            elif filt == 3:
+                line[x] = (line[x] + ((a + b) >> 1)) & 0xFF
+            elif filt == 4:
+                c = prev[x - channels] if x >= channels else 0
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if (pa <= pb and pa <= pc) else (b if pb <= pc else c)
+                line[x] = (line[x] + pred) & 0xFF
+        out[y * stride:(y + 1) * stride] = line
+        prev = line
+
+    pixels = []
+    for i in range(width * height):
+        o = i * channels
+        if color_type == 0:
+            g = out[o]
+            pixels.append((g, g, g, 255))
+        elif color_type == 2:
+            pixels.append((out[o], out[o + 1], out[o + 2], 255))
+        elif color_type == 3:
+            idx = out[o]
+            r, g, b = palette[idx]
+            a = trns[idx] if idx < len(trns) else 255
+            pixels.append((r, g, b, a))
+        elif color_type == 4:
+            g = out[o]
+            pixels.append((g, g, g, out[o + 1]))
+        else:
+            pixels.append((out[o], out[o + 1], out[o + 2], out[o + 3]))
+    return width, height, pixels
+
+
+def decode_bmp(data):
+    if data[:2] != b"BM":
+        return None
+    pixel_off = struct.unpack("<I", data[10:14])[0]
+    width, height = struct.unpack("<ii", data[18:26])
+    bpp = struct.unpack("<H", data[28:30])[0]
+    compression = struct.unpack("<I", data[30:34])[0]
+    if compression != 0 or bpp not in (24, 32):
+        sys.exit("error: only uncompressed 24/32-bit BMP supported")
+    flipped = height > 0
+    height = abs(height)
+    row_bytes = (width * (bpp // 8) + 3) & ~3
+    pixels = [(0, 0, 0, 0)] * (width * height)
+    for y in range(height):
+        src_y = (height - 1 - y) if flipped else y
+        o = pixel_off + src_y * row_bytes
+        for x in range(width):
+            p = o + x * (bpp // 8)
+            b, g, r = data[p], data[p + 1], data[p + 2]
+            a = data[p + 3] if bpp == 32 else 255
+            pixels[y * width + x] = (r, g, b, a)
+    return width, height, pixels
+
+
+def decode_pnm(data):
+    if data[:2] not in (b"P5", b"P6"):
+        return None
+    fields = []
+    pos = 2
+    while len(fields) < 3:
+        while pos < len(data) and data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            while pos < len(data) and data[pos] != 0x0A:
+                pos += 1
+            continue
+        start = pos
+        while pos < len(data) and not data[pos:pos + 1].isspace():
+            pos += 1
+        fields.append(int(data[start:pos]))
+    pos += 1  # single whitespace after maxval
+    width, height, maxval = fields
+    if maxval != 255:
+        sys.exit("error: only maxval 255 PNM supported")
+    gray = data[:2] == b"P5"
+    pixels = []
+    for i in range(width * height):
+        o = pos + i * (1 if gray else 3)
+        if gray:
+            g = data[o]
+            pixels.append((g, g, g, 255))
+        else:
+            pixels.append((data[o], data[o + 1], data[o + 2], 255))
+    return width, height, pixels
+
+
+def load_image(path):
+    data = open(path, "rb").read()
+    for decoder in (decode_png, decode_bmp, decode_pnm):
+        result = decoder(data)
+        if result is not None:
+            return result
+    sys.exit(f"error: {path}: not a PNG, BMP or PNM (convert JPEG to PNG first)")
+
+
+# ---------------------------------------------------------------------------
+# Quantization to RGB565 with chroma-key transparency.
+# ---------------------------------------------------------------------------
+
+def to_rgb565(r, g, b):
+    return (((r * 31 + 127) // 255) << 11) | (((g * 63 + 127) // 255) << 5) | \
+        ((b * 31 + 127) // 255)
+
+
+def median_cut(colors, target):
+    """Reduce {rgb565: count} to <= target colors; returns {rgb565: rgb565}."""
+    def chan(c):
+        return ((c >> 11) & 0x1F, (c >> 5) & 0x3F, c & 0x1F)
+
+    boxes = [list(colors.items())]
+    while len(boxes) < target:
+        # Split the most populous box along its widest channel.
+        boxes.sort(key=lambda box: -sum(n for _, n in box))
+        box = boxes[0]
+        if len(box) == 1:
+            break
+        spans = [0, 0, 0]
+        for axis in range(3):
+            vals = [chan(c)[axis] for c, _ in box]
+            spans[axis] = max(vals) - min(vals)
+        axis = spans.index(max(spans))
+        box.sort(key=lambda cn: chan(cn[0])[axis])
+        half = sum(n for _, n in box) // 2
+        acc = 0
+        cut = 1
+        for i, (_, n) in enumerate(box):
+            acc += n
+            if acc >= half and i + 1 < len(box):
+                cut = i + 1
+                break
+        boxes[0:1] = [box[:cut], box[cut:]]
+
+    mapping = {}
+    for box in boxes:
+        total = sum(n for _, n in box)
+        r = sum(((c >> 11) & 0x1F) * n for c, n in box) // total
+        g = sum(((c >> 5) & 0x3F) * n for c, n in box) // total
+        b = sum((c & 0x1F) * n for c, n in box) // total
+        rep = (r << 11) | (g << 5) | b
+        for c, _ in box:
+            mapping[c] = rep
+    return mapping
+
+
+def quantize(pixels, key):
+    out = []
+    counts = {}
+    for r, g, b, a in pixels:
+        if a < 128:
+            out.append(key)
+            continue
+        c = to_rgb565(r, g, b)
+        if c == key:
+            c ^= 0x0001  # Nudge off the chroma key by one blue LSB
+        out.append(c)
+        counts[c] = counts.get(c, 0) + 1
+
+    budget = 256 - (1 if key in out else 0)
+    if len(counts) > budget:
+        mapping = median_cut(counts, budget)
+        # Representatives may themselves collide with the key.
+        out = [c if c == key else
+               (mapping[c] ^ 0x0001 if mapping[c] == key else mapping[c])
+               for c in out]
+        print(f"quantized {len(counts)} colors -> "
+              f"{len(set(out) - {key})}", file=sys.stderr)
+    return out
+
+
+# ---------------------------------------------------------------------------
+# Emission (same shapes as compress_icons.py output).
+# ---------------------------------------------------------------------------
+
+def rle_encode(pixels, palette_index):
+    stream = []
+    i = 0
+    n = len(pixels)
+    while i < n:
+        color = pixels[i]
+        run = 1
+        while i + run < n and pixels[i + run] == color and run < MAX_RUN:
+            run += 1
+        stream.append(run)
+        stream.append(palette_index[color])
+        i += run
+    return stream
+
+
+def format_values(values, fmt, indent="  "):
+    lines = []
+    for i in range(0, len(values), VALUES_PER_LINE):
+        chunk = values[i:i + VALUES_PER_LINE]
+        lines.append(indent + ", ".join(fmt % v for v in chunk) + ",")
+    if lines:
+        lines[-1] = lines[-1].rstrip(",")
+    return "\n".join(lines)
+
+
+def main():
+    ap = argparse.ArgumentParser(
+        description="Convert an image to a palettized + RLE asset header")
+    ap.add_argument("image", help="PNG, BMP or PPM/PGM input")
+    ap.add_argument("--name", help="asset identifier (default from filename)")
+    ap.add_argument("--transparent", type=lambda v: int(v, 0), default=0x0000,
+                    help="RGB565 chroma key for alpha < 128 (default 0x0000)")
+    ap.add_argument("--budget-bytes", type=int, default=0,
+                    help="fail if palette + RLE exceed this many bytes")
+    args = ap.parse_args()
+
+    name = args.name
+    if name is None:
+        stem = os.path.splitext(os.path.basename(args.image))[0]
+        name = "kImg_" + "".join(c if c.isalnum() else "_" for c in stem)
+
+    width, height, rgba = load_image(args.image)
+    pixels = quantize(rgba, args.transparent)
+
+    palette = []
+    palette_index = {}
+    for color in pixels:
+        if color not in palette_index:
+            palette_index[color] = len(palette)
+            palette.append(color)
+    stream = rle_encode(pixels, palette_index)
+
+    raw_bytes = width * height * 2
+    packed_bytes = len(palette) * 2 + len(stream)
+    print(f"{name}: {width}x{height}, {raw_bytes} -> {packed_bytes} bytes "
+          f"({raw_bytes / packed_bytes:.1f}x, {len(palette)} colors, "
+          f"{len(stream) // 2} runs)", file=sys.stderr)
+    if args.budget_bytes and packed_bytes > args.budget_bytes:
+        sys.exit(f"error: {name}: {packed_bytes} bytes exceeds the "
+                 f"{args.budget_bytes}-byte budget")
+
+    guard_name = os.path.basename(args.image)
+    out = []
+    out.append("/**")
+    out.append(f" * @file (generated)")
+    out.append(f" * @brief {name} asset, converted from {guard_name}")
+    out.append(" * @details Palettized + RLE (see icon_codec.hpp); generated by")
+    out.append(f" *          tools/convert_image.py - do not edit by hand.")
+    out.append(" */")
+    out.append("")
+    out.append("#pragma once")
+    out.append("")
+    out.append("#include <cstdint>")
+    out.append("")
+    out.append('#include "icon_codec.hpp"')
+    out.append("")
+    out.append("namespace ui::assets {")
+    out.append("")
+    out.append(f"static constexpr int {name}_W = {width};")
+    out.append(f"static constexpr int {name}_H = {height};")
+    out.append(f"static constexpr uint16_t {name}_Transparent = "
+               f"0x{args.transparent:04X};")
+    out.append(f"static constexpr uint16_t {name}_Palette[{len(palette)}] = {{")
+    out.append(format_values(palette, "0x%04X"))
+    out.append("};")
+    out.append(f"static constexpr uint8_t {name}_Rle[{len(stream)}] = {{")
+    out.append(format_values(stream, "%d"))
+    out.append("};")
+    out.append(f"static constexpr CompressedIcon {name}{{{width}, {height}, "
+               f"{name}_Palette, {len(palette)}, {name}_Rle, {len(stream)}}};")
+    out.append("")
+    out.append("} // namespace ui::assets")
+    out.append("")
+    sys.stdout.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
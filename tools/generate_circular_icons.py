@@ -11,8 +11,9 @@ Features:
 - Optimized line widths for small display sizes
 - Enhanced contrast for visibility
 
-Usage:
-    python generate_circular_icons.py > ../main/ui/assets/circular_icons.hpp
+Usage (raw output goes through the compressor before shipping):
+    python generate_circular_icons.py > /tmp/circular_icons_raw.hpp
+    python compress_icons.py /tmp/circular_icons_raw.hpp > ../main/ui/assets/circular_icons.hpp
 """
 
 import math
@@ -499,6 +500,50 @@ def draw_more_symbol(pixels: List[int], size: int, fg_color: int) -> None:
                 idx = y * size + x
                 pixels[idx] = blend_565(fg_color, pixels[idx], coverage * 0.93)
 
+def draw_history_symbol(pixels: List[int], size: int, fg_color: int) -> None:
+    """Draw a clock face (history/run log) symbol."""
+    cx = size / 2 - 0.5
+    cy = size / 2 - 0.5
+    face_r = 11.0
+    ring_w = 2.2
+    hand_w = 1.3
+    # Hands at 10 o'clock (hour) and 12 (minute) read as "past time"
+    hour_len = 5.5
+    minute_len = 8.0
+    hour_angle = math.radians(-150)
+    minute_angle = math.radians(-90)
+
+    def point_to_segment_dist(px, py, x1, y1, x2, y2):
+        dx, dy = x2 - x1, y2 - y1
+        length_sq = dx * dx + dy * dy
+        if length_sq < 0.0001:
+            return distance(px, py, x1, y1)
+        t = clamp(((px - x1) * dx + (py - y1) * dy) / length_sq)
+        return distance(px, py, x1 + t * dx, y1 + t * dy)
+
+    def history_coverage(x: float, y: float) -> float:
+        coverage = 0.0
+        # Ring outline
+        dist = distance(x, y, cx, cy)
+        ring_d = abs(dist - face_r)
+        if ring_d < ring_w / 2 + 0.5:
+            coverage = max(coverage, clamp(ring_w / 2 + 0.5 - ring_d))
+        # Hands from center
+        for angle, length in ((hour_angle, hour_len), (minute_angle, minute_len)):
+            ex = cx + length * math.cos(angle)
+            ey = cy + length * math.sin(angle)
+            d = point_to_segment_dist(x, y, cx, cy, ex, ey)
+            if d < hand_w / 2 + 0.5:
+                coverage = max(coverage, clamp(hand_w / 2 + 0.5 - d))
+        return coverage
+
+    for y in range(size):
+        for x in range(size):
+            coverage = sample_pixel_aa(x, y, size, history_coverage)
+            if coverage > 0.01:
+                idx = y * size + x
+                pixels[idx] = blend_565(fg_color, pixels[idx], coverage * 0.93)
+
 def generate_icon(icon_def: IconDef, transparent: int = 0x0000) -> List[int]:
     """Generate a complete icon with background and symbol."""
     # Create circular background
@@ -521,7 +566,9 @@ def generate_icon(icon_def: IconDef, transparent: int = 0x0000) -> List[int]:
         draw_wifi_symbol(pixels, ICON_SIZE, symbol_color)
     elif icon_def.symbol == 'more':
         draw_more_symbol(pixels, ICON_SIZE, symbol_color)
-    
+    elif icon_def.symbol == 'history':
+        draw_history_symbol(pixels, ICON_SIZE, symbol_color)
+
     return pixels
 
 def format_pixel_array(name: str, pixels: List[int], width: int) -> str:
@@ -551,6 +598,7 @@ def main():
         IconDef("brightness", ICON_COLORS['orange'], "brightness"),
         IconDef("wifi", ICON_COLORS['mint'], "wifi"),
         IconDef("more", ICON_COLORS['gray'], "more"),
+        IconDef("history", ICON_COLORS['cyan'], "history"),
     ]
     
     # Generate header file
@@ -4,7 +4,8 @@
 No external dependencies (no Pillow). Icons are geometric rasterizations
 with anti-aliasing, gradients, and stylized designs.
 
-Output: main/ui/assets/menu_icons.hpp
+Output: raw header for main/ui/assets/menu_icons.hpp; run the result
+through compress_icons.py to produce the shipped palettized + RLE form.
 """
 
 from __future__ import annotations
@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""
+Pack UI resources into an assets partition image.
+
+Builds the flash image mounted by main/asset_store.cpp: a 16-byte header,
+a directory of 16-byte entries indexed by asset id, then the payloads
+4-byte aligned. The manifest is a plain text file, one asset per line:
+
+    # id  symbol          path
+    0     boot_logo       build_assets/boot_logo.bin
+    1     glow_sprites    build_assets/glow.bin
+
+Ids must be dense (0..count-1, any order) — the firmware indexes the
+directory by id, so gaps would serve garbage. The symbol column becomes a
+constexpr in the optional --ids-header output so firmware call sites say
+asset_store::Get(kAssetBootLogo, v) instead of a bare number.
+
+Flash with:
+
+    python pack_assets.py manifest.txt assets.bin --ids-header asset_ids.hpp
+    esptool.py write_flash <assets partition offset> assets.bin
+
+(see partitions.csv for the current offset). Stats go to stderr; any
+manifest or size error exits nonzero so CI fails loudly.
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+MAGIC = 0x5341354D  # "M5AS" little-endian
+VERSION = 1
+HEADER_SIZE = 16
+ENTRY_SIZE = 16
+ALIGN = 4
+
+
+def parse_manifest(path):
+    """Return [(id, symbol, path)] with dense-id validation."""
+    rows = []
+    with open(path) as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            parts = line.split()
+            if len(parts) != 3:
+                sys.exit(f"{path}:{lineno}: expected 'id symbol path', got {line!r}")
+            try:
+                asset_id = int(parts[0], 0)
+            except ValueError:
+                sys.exit(f"{path}:{lineno}: bad id {parts[0]!r}")
+            rows.append((asset_id, parts[1], parts[2]))
+    ids = sorted(r[0] for r in rows)
+    if ids != list(range(len(rows))):
+        sys.exit(f"{path}: ids must be dense 0..{len(rows) - 1}, got {ids}")
+    return sorted(rows)  # directory order == id order
+
+
+def camel(symbol):
+    return "kAsset" + "".join(w.capitalize() for w in symbol.split("_"))
+
+
+def emit_ids_header(rows, out_path):
+    with open(out_path, "w") as f:
+        f.write("// Generated by tools/pack_assets.py - do not edit.\n")
+        f.write("// Asset ids for the image flashed to the assets partition;\n")
+        f.write("// regenerate whenever the manifest changes.\n")
+        f.write("#pragma once\n\n")
+        f.write("#include <cstdint>\n\n")
+        f.write("namespace asset_store {\n\n")
+        for asset_id, symbol, _ in rows:
+            f.write(f"constexpr uint16_t {camel(symbol)} = {asset_id};\n")
+        f.write("\n}  // namespace asset_store\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("manifest", help="manifest file: 'id symbol path' lines")
+    ap.add_argument("output", help="partition image to write")
+    ap.add_argument("--ids-header", help="also emit a C++ header of asset ids")
+    ap.add_argument("--partition-size", type=lambda s: int(s, 0), default=0x40000,
+                    help="fail if the image exceeds this (default: 256 KB)")
+    args = ap.parse_args()
+
+    rows = parse_manifest(args.manifest)
+
+    payloads = []
+    offset = HEADER_SIZE + len(rows) * ENTRY_SIZE
+    directory = b""
+    for asset_id, symbol, src in rows:
+        with open(src, "rb") as f:
+            data = f.read()
+        pad = (-offset) % ALIGN
+        offset += pad
+        directory += struct.pack("<HHIII", asset_id, 0, offset, len(data),
+                                 zlib.crc32(data) & 0xFFFFFFFF)
+        payloads.append((pad, data))
+        print(f"  {asset_id:3d} {symbol:<20s} {len(data):7d} B  @0x{offset:06X}",
+              file=sys.stderr)
+        offset += len(data)
+
+    if offset > args.partition_size:
+        sys.exit(f"image is {offset} bytes, over the {args.partition_size} "
+                 f"byte partition")
+
+    header = struct.pack("<IHHII", MAGIC, VERSION, len(rows),
+                         zlib.crc32(directory) & 0xFFFFFFFF, 0)
+    with open(args.output, "wb") as f:
+        f.write(header)
+        f.write(directory)
+        for pad, data in payloads:
+            f.write(b"\xFF" * pad)
+            f.write(data)
+
+    if args.ids_header:
+        emit_ids_header(rows, args.ids_header)
+
+    print(f"{args.output}: {len(rows)} assets, {offset} bytes "
+          f"({offset * 100 // args.partition_size}% of partition)",
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
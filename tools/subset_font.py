@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""Audit the UI's glyph usage and emit precomputed font metrics.
+
+Scans the UI sources for every character that can reach the display
+(string literals plus the runtime-formatting alphabet: digits, hex, sign,
+separators) and cross-checks the set against the vendored GLCD font in
+components/M5GFX/src/lgfx/Fonts/glcdfont.h. Two outputs:
+
+- main/ui/assets/ui_font_metrics.hpp: per-glyph advance table for the
+  covered set, so string measurement is a table sum instead of a per-char
+  library call with virtual glyph lookups (see UiController::measureText_).
+  An advance of 0 marks a glyph the UI never uses; the firmware falls back
+  to the library measurement for those, so new labels are never
+  mis-measured — rerun this tool to fold them in.
+- a flash report on stdout: glyphs used vs. shipped, and the size of a
+  range-subset font. Note Font0 itself stays linked regardless — LGFX's
+  runtime font table references it — so the subset glyph bitmaps are only
+  emitted on request (--emit-glyphs) for a future custom font binding;
+  committing them today would grow the image, not shrink it.
+
+No external dependencies. Rerun after adding UI text:
+
+    python3 tools/subset_font.py
+"""
+
+from __future__ import annotations
+
+import argparse
+import re
+from pathlib import Path
+
+REPO_ROOT = Path(__file__).resolve().parent.parent
+UI_DIR = REPO_ROOT / "main" / "ui"
+GLCD_FONT = REPO_ROOT / "components" / "M5GFX" / "src" / "lgfx" / "Fonts" / "glcdfont.h"
+OUT_HEADER = UI_DIR / "assets" / "ui_font_metrics.hpp"
+
+# Characters producible by runtime formatting (numbers, MAC addresses,
+# percentages, signed deltas) that may not appear in any literal.
+RUNTIME_ALPHABET = "0123456789abcdefABCDEF:.+-%/ "
+
+# Fixed GLCD geometry: 5 data columns + 1 column of spacing, 8 rows.
+GLYPH_ADVANCE = 6
+GLYPH_HEIGHT = 8
+GLYPH_DATA_WIDTH = 5
+
+STRING_LITERAL_RE = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+ESCAPE_RE = re.compile(r"\\(?:[abfnrtv\\'\"?]|x[0-9a-fA-F]+|[0-7]{1,3})")
+
+
+def collect_used_chars() -> set[int]:
+    used: set[int] = {ord(c) for c in RUNTIME_ALPHABET}
+    for path in sorted(UI_DIR.rglob("*")):
+        if path.suffix not in (".cpp", ".hpp", ".h"):
+            continue
+        if path == OUT_HEADER:
+            continue
+        text = path.read_text(encoding="utf-8", errors="replace")
+        # Strip comments so doc text does not inflate the glyph set.
+        text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+        text = re.sub(r"//[^\n]*", "", text)
+        for match in STRING_LITERAL_RE.finditer(text):
+            literal = ESCAPE_RE.sub("", match.group(1))
+            for ch in literal:
+                code = ord(ch)
+                if 0x20 <= code < 0x7F:
+                    used.add(code)
+    return used
+
+
+def load_glcd_glyphs() -> list[list[int]]:
+    text = GLCD_FONT.read_text(encoding="utf-8", errors="replace")
+    values = [int(v, 16) for v in re.findall(r"0[xX][0-9a-fA-F]{2}", text)]
+    glyphs = [values[i : i + GLYPH_DATA_WIDTH]
+              for i in range(0, len(values) - GLYPH_DATA_WIDTH + 1, GLYPH_DATA_WIDTH)]
+    if len(glyphs) < 0x7F:
+        raise SystemExit(f"unexpected glyph count {len(glyphs)} in {GLCD_FONT}")
+    return glyphs
+
+
+def emit_header(used: set[int], emit_glyphs: bool) -> str:
+    lines: list[str] = []
+    lines.append("/**")
+    lines.append(" * @file ui_font_metrics.hpp")
+    lines.append(" * @brief Auto-generated font metrics for the UI glyph set")
+    lines.append(" * @details Per-glyph advances (at text size 1) for every character the")
+    lines.append(" *          UI can display, audited from the sources by")
+    lines.append(" *          tools/subset_font.py against the vendored GLCD font. An")
+    lines.append(" *          advance of 0 marks an unused glyph; measurement falls back")
+    lines.append(" *          to the library for those. Regenerate after adding UI text.")
+    lines.append(" */")
+    lines.append("")
+    lines.append("#pragma once")
+    lines.append("")
+    lines.append("#include <cstdint>")
+    lines.append("")
+    lines.append("namespace ui::assets {")
+    lines.append("")
+    lines.append("static constexpr uint8_t kUiFontFirstCode = 0x20;  ///< First covered code")
+    lines.append("static constexpr uint8_t kUiFontLastCode = 0x7E;   ///< Last covered code")
+    lines.append(f"static constexpr uint8_t kUiFontHeight = {GLYPH_HEIGHT};       ///< Glyph height at size 1")
+    lines.append("")
+    lines.append("/// Advance width at text size 1, indexed by (code - kUiFontFirstCode).")
+    lines.append("/// 0 = glyph not in the audited set (caller must fall back).")
+    lines.append("static constexpr uint8_t kUiFontAdvance[] = {")
+    for base in range(0x20, 0x7F, 16):
+        row = []
+        for code in range(base, min(base + 16, 0x7F)):
+            row.append(f"{GLYPH_ADVANCE if code in used else 0}")
+        chars = "".join(chr(c) if c in used else "." for c in range(base, min(base + 16, 0x7F)))
+        lines.append(f"    {', '.join(row)},  // {chars}")
+    lines.append("};")
+    lines.append("")
+    lines.append("/// Advance width for one character, 0 when outside the audited set.")
+    lines.append("constexpr uint8_t glyphAdvance(uint8_t code) {")
+    lines.append("    return (code >= kUiFontFirstCode && code <= kUiFontLastCode)")
+    lines.append("               ? kUiFontAdvance[code - kUiFontFirstCode]")
+    lines.append("               : 0;")
+    lines.append("}")
+    if emit_glyphs:
+        glyphs = load_glcd_glyphs()
+        first = min(used)
+        last = max(used)
+        lines.append("")
+        lines.append("/// Range-subset GLCD glyph bitmaps (5 bytes per glyph, column-major),")
+        lines.append("/// covering codes [kUiSubsetFirst, kUiSubsetLast]. Bind with")
+        lines.append("/// lgfx::v1::GLCDfont only if Font0 is ever unpinned from the LGFX")
+        lines.append("/// runtime font table; until then this would grow the image.")
+        lines.append(f"static constexpr uint8_t kUiSubsetFirst = 0x{first:02X};")
+        lines.append(f"static constexpr uint8_t kUiSubsetLast = 0x{last:02X};")
+        lines.append("static constexpr uint8_t kUiSubsetGlyphs[] = {")
+        for code in range(first, last + 1):
+            data = ", ".join(f"0x{b:02X}" for b in glyphs[code])
+            label = chr(code) if code in used else "(unused)"
+            lines.append(f"    {data},  // 0x{code:02X} {label}")
+        lines.append("};")
+    lines.append("")
+    lines.append("}  // namespace ui::assets")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--emit-glyphs", action="store_true",
+                        help="also emit range-subset glyph bitmaps into the header")
+    args = parser.parse_args()
+
+    used = collect_used_chars()
+    header = emit_header(used, args.emit_glyphs)
+    OUT_HEADER.write_text(header, encoding="utf-8")
+
+    full_bytes = 255 * GLYPH_DATA_WIDTH
+    subset_bytes = (max(used) - min(used) + 1) * GLYPH_DATA_WIDTH
+    print(f"glyphs used: {len(used)} of 95 printable ASCII")
+    print(f"range subset 0x{min(used):02X}..0x{max(used):02X}: "
+          f"{subset_bytes} bytes vs {full_bytes} shipped in Font0")
+    print(f"wrote {OUT_HEADER.relative_to(REPO_ROOT)}")
+
+
+if __name__ == "__main__":
+    main()